@@ -0,0 +1,97 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "SgfcArchiveEntryReadResult.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <memory>
+#include <string>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcDocumentReader;
+
+  /// @brief The ISgfcArchiveReader interface provides functions to read the
+  /// .sgf files that are stored in a tar or zip archive, one archive member
+  /// at a time, without extracting the archive to the filesystem. Use
+  /// SgfcPlusPlusFactory to construct new ISgfcArchiveReader objects.
+  ///
+  /// @ingroup public-api
+  /// @ingroup sgfc-frontend
+  ///
+  /// ISgfcArchiveReader detects the archive format from the content of the
+  /// archive file, not from its file name extension. The following formats
+  /// are supported:
+  /// - tar archives in the ustar, GNU and pax variants. The tar archive may
+  ///   be compressed with gzip or Zstandard (.tar.gz, .tgz, .tar.zst) if the
+  ///   library was built with support for the compression format. The
+  ///   archive is read sequentially, i.e. it is never decompressed as a
+  ///   whole.
+  /// - zip archives, including zip64 archives. Members must be stored
+  ///   without compression or compressed with the deflate method. Reading
+  ///   deflate-compressed members requires that the library was built with
+  ///   support for gzip compression. Encrypted members cannot be read.
+  ///
+  /// Only regular file members whose name ends with ".sgf" (compared case
+  /// insensitively) are read, all other members are skipped. Each member is
+  /// read into memory and then passed to an ISgfcDocumentReader. The
+  /// arguments and the read options of that document reader therefore apply
+  /// to each member. Memory for only one member is required at a time.
+  class SGFCPLUSPLUS_EXPORT ISgfcArchiveReader
+  {
+  public:
+    /// @brief Initializes a newly constructed ISgfcArchiveReader object.
+    ISgfcArchiveReader();
+
+    /// @brief Destroys and cleans up the ISgfcArchiveReader object.
+    virtual ~ISgfcArchiveReader();
+
+    /// @brief Returns the path of the archive file that ISgfcArchiveReader
+    /// reads from.
+    virtual std::string GetArchiveFilePath() const = 0;
+
+    /// @brief Returns the ISgfcDocumentReader object that ISgfcArchiveReader
+    /// uses to read archive members. Change the arguments or the read options
+    /// of the document reader to change the way how archive members are
+    /// read.
+    virtual std::shared_ptr<ISgfcDocumentReader> GetDocumentReader() const = 0;
+
+    /// @brief Reads the next .sgf file from the archive and stores the
+    /// outcome in @a entryReadResult.
+    ///
+    /// A member that cannot be extracted from the archive, e.g. because it
+    /// is encrypted, uses an unsupported compression method, or is larger
+    /// than the maximum member size that the library extracts (256 MiB),
+    /// does not abort the iteration. Instead the read result stored in
+    /// @a entryReadResult has a single fatal error message.
+    ///
+    /// @retval true if an archive member was read. @a entryReadResult holds
+    ///         the outcome.
+    /// @retval false if there are no more .sgf files in the archive.
+    ///         @a entryReadResult is not modified.
+    ///
+    /// @exception std::runtime_error Is thrown if the archive is corrupt or
+    /// truncated, or if the archive file cannot be read.
+    virtual bool ReadNextEntry(SgfcArchiveEntryReadResult& entryReadResult) = 0;
+  };
+}
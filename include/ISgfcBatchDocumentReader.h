@@ -0,0 +1,164 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "ISgfcArguments.h"
+#include "SgfcBatchReadOptions.h"
+#include "SgfcBatchReadResult.h"
+#include "SgfcDocumentReadOptions.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The ISgfcBatchDocumentReader interface provides functions to
+  /// read a batch of .sgf files on a pool of worker threads. Use
+  /// SgfcPlusPlusFactory to construct new ISgfcBatchDocumentReader objects.
+  ///
+  /// @ingroup public-api
+  /// @ingroup sgfc-frontend
+  ///
+  /// Each worker thread reads files with its own ISgfcDocumentReader object.
+  /// The worker threads' document readers are kept from one batch to the
+  /// next. When a batch is started, the arguments and the read options of
+  /// ISgfcBatchDocumentReader are copied to the document readers, so
+  /// changing them while a batch is being read has no effect on that batch.
+  ///
+  /// There are two ways how to obtain the results of a batch:
+  /// - Invoke StartReading(), then invoke ReadNextResult() until it returns
+  ///   false. The worker threads read files in the background while the
+  ///   library client processes results.
+  /// - Invoke ReadSgfFiles() with a result handler function. This is a
+  ///   convenience wrapper around StartReading() and ReadNextResult().
+  ///
+  /// In both cases the library client receives results on the thread that
+  /// started the batch. SgfcBatchReadOptions controls the number of worker
+  /// threads, the order in which files are read and in which results are
+  /// handed out, and how many results may wait to be handed out.
+  ///
+  /// ISgfcBatchDocumentReader is not thread-safe, i.e. the functions of an
+  /// ISgfcBatchDocumentReader object must be invoked from one thread at a
+  /// time.
+  class SGFCPLUSPLUS_EXPORT ISgfcBatchDocumentReader
+  {
+  public:
+    /// @brief Initializes a newly constructed ISgfcBatchDocumentReader
+    /// object.
+    ISgfcBatchDocumentReader();
+
+    /// @brief Destroys and cleans up the ISgfcBatchDocumentReader object.
+    /// If a batch is being read it is stopped as if StopReading() had been
+    /// invoked.
+    virtual ~ISgfcBatchDocumentReader();
+
+    /// @brief Returns an object with the collection of arguments that
+    /// ISgfcBatchDocumentReader passes to SGFC when it reads a file. The
+    /// collection is initially empty.
+    virtual std::shared_ptr<ISgfcArguments> GetArguments() const = 0;
+
+    /// @brief Returns the options that control which parts of the game
+    /// trees are built into the document object tree of each file. The
+    /// default is a default-constructed SgfcDocumentReadOptions object.
+    virtual SgfcDocumentReadOptions GetReadOptions() const = 0;
+
+    /// @brief Sets the options that control which parts of the game trees
+    /// are built into the document object tree of each file. The options
+    /// take effect when the next batch is started.
+    virtual void SetReadOptions(const SgfcDocumentReadOptions& readOptions) = 0;
+
+    /// @brief Returns the options that control how the files of a batch are
+    /// read. The default is a default-constructed SgfcBatchReadOptions
+    /// object.
+    virtual SgfcBatchReadOptions GetBatchReadOptions() const = 0;
+
+    /// @brief Sets the options that control how the files of a batch are
+    /// read. The options take effect when the next batch is started.
+    virtual void SetBatchReadOptions(const SgfcBatchReadOptions& batchReadOptions) = 0;
+
+    /// @brief Returns the paths of all files that are located in the
+    /// directory @a directoryPath or in one of its subdirectories, and whose
+    /// name matches @a fileNamePattern. The paths are sorted. The result
+    /// can be passed to StartReading() or ReadSgfFiles().
+    ///
+    /// In @a fileNamePattern the character "*" matches any sequence of
+    /// characters, including the empty sequence, and the character "?"
+    /// matches any single character. All other characters match themselves.
+    /// The comparison is case sensitive. Example: "*.sgf".
+    ///
+    /// @exception std::invalid_argument Is thrown if @a directoryPath does
+    /// not refer to a directory.
+    virtual std::vector<std::string> FindFiles(
+      const std::string& directoryPath,
+      const std::string& fileNamePattern) const = 0;
+
+    /// @brief Starts reading the files located at the paths in
+    /// @a sgfFilePaths on the worker threads, then returns immediately.
+    /// Invoke ReadNextResult() to obtain the results.
+    ///
+    /// A file that cannot be read, e.g. because it does not exist, results
+    /// in an ISgfcDocumentReadResult with a fatal error, the same as if the
+    /// file had been read with ISgfcDocumentReader.
+    ///
+    /// @exception std::logic_error Is thrown if a batch is already being
+    /// read, i.e. if IsReading() returns true.
+    virtual void StartReading(const std::vector<std::string>& sgfFilePaths) = 0;
+
+    /// @brief Waits until the next result of the batch that is being read
+    /// is available and stores it in @a batchReadResult.
+    ///
+    /// @retval true if a result was stored in @a batchReadResult.
+    /// @retval false if all results of the batch have been handed out, or
+    ///         if no batch is being read. @a batchReadResult is not
+    ///         modified.
+    virtual bool ReadNextResult(SgfcBatchReadResult& batchReadResult) = 0;
+
+    /// @brief Returns true if a batch is being read and not all of its
+    /// results have been handed out yet. Returns false otherwise.
+    virtual bool IsReading() const = 0;
+
+    /// @brief Stops reading the batch that is being read. Files that are
+    /// being read when this method is invoked are read to the end, but
+    /// their results are discarded, as are the results that are waiting to
+    /// be handed out. Returns when all worker threads have finished. Does
+    /// nothing if no batch is being read.
+    virtual void StopReading() = 0;
+
+    /// @brief Reads the files located at the paths in @a sgfFilePaths on
+    /// the worker threads and invokes @a resultHandler once for each
+    /// result. Returns when all results have been handed out.
+    ///
+    /// @a resultHandler is invoked on the thread that invoked
+    /// ReadSgfFiles(), one result at a time, so it does not have to be
+    /// thread-safe. If @a resultHandler throws an exception, the batch is
+    /// stopped as if StopReading() had been invoked, and the exception is
+    /// rethrown.
+    ///
+    /// @exception std::logic_error Is thrown if a batch is already being
+    /// read, i.e. if IsReading() returns true.
+    virtual void ReadSgfFiles(
+      const std::vector<std::string>& sgfFilePaths,
+      const std::function<void(const SgfcBatchReadResult& batchReadResult)>& resultHandler) = 0;
+  };
+}
@@ -0,0 +1,130 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "ISgfcArguments.h"
+#include "ISgfcDocument.h"
+#include "SgfcBatchWriteOptions.h"
+#include "SgfcBatchWriteResult.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The ISgfcBatchDocumentWriter interface provides functions to
+  /// write a batch of ISgfcDocument objects to .sgf files on a pool of worker
+  /// threads. Use SgfcPlusPlusFactory to construct new
+  /// ISgfcBatchDocumentWriter objects.
+  ///
+  /// @ingroup public-api
+  /// @ingroup sgfc-frontend
+  ///
+  /// Each document is written in the same way as if it had been written with
+  /// ISgfcDocumentWriter::WriteSgfFile(), i.e. it is encoded, validated by
+  /// SGFC and then written to the filesystem. Read the ISgfcDocumentWriter
+  /// class documentation for a note about encodings. A file whose path has
+  /// the file name extension ".gz" or ".zst" is written compressed.
+  ///
+  /// When a batch is started, the arguments of ISgfcBatchDocumentWriter are
+  /// copied for use by the worker threads, so changing them while a batch is
+  /// being written has no effect on that batch. The documents of a batch
+  /// must not be modified until the batch has been written.
+  ///
+  /// ISgfcBatchDocumentWriter is not thread-safe, i.e. the functions of an
+  /// ISgfcBatchDocumentWriter object must be invoked from one thread at a
+  /// time.
+  class SGFCPLUSPLUS_EXPORT ISgfcBatchDocumentWriter
+  {
+  public:
+    /// @brief Initializes a newly constructed ISgfcBatchDocumentWriter
+    /// object.
+    ISgfcBatchDocumentWriter();
+
+    /// @brief Destroys and cleans up the ISgfcBatchDocumentWriter object.
+    virtual ~ISgfcBatchDocumentWriter();
+
+    /// @brief Returns an object with the collection of arguments that
+    /// ISgfcBatchDocumentWriter passes to SGFC when it writes a document.
+    ///
+    /// The collection of arguments initially contains
+    /// #SgfcArgumentType::DefaultEncoding with the parameter "UTF-8", the
+    /// same as the collection of arguments of ISgfcDocumentWriter.
+    virtual std::shared_ptr<ISgfcArguments> GetArguments() const = 0;
+
+    /// @brief Returns the options that control how the documents of a batch
+    /// are written. The default is a default-constructed
+    /// SgfcBatchWriteOptions object.
+    virtual SgfcBatchWriteOptions GetBatchWriteOptions() const = 0;
+
+    /// @brief Sets the options that control how the documents of a batch
+    /// are written. The options take effect when the next batch is started.
+    virtual void SetBatchWriteOptions(const SgfcBatchWriteOptions& batchWriteOptions) = 0;
+
+    /// @brief Writes each document in @a documents to the file located at
+    /// the path with the same index in @a sgfFilePaths, on the worker
+    /// threads. Returns when all documents have been written.
+    ///
+    /// A document that cannot be encoded, e.g. because it contains a game
+    /// without a root node, results in an ISgfcDocumentWriteResult with a
+    /// fatal error. Unlike ISgfcDocumentWriter, ISgfcBatchDocumentWriter does
+    /// not throw an exception in this case, so that the other documents of
+    /// the batch can still be written.
+    ///
+    /// @return A collection of SgfcBatchWriteResult objects, one for each
+    /// document, in the order in which the documents appear in
+    /// @a documents.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a documents and
+    /// @a sgfFilePaths have a different number of elements, or if
+    /// @a documents contains @e nullptr.
+    virtual std::vector<SgfcBatchWriteResult> WriteSgfFiles(
+      const std::vector<std::shared_ptr<ISgfcDocument>>& documents,
+      const std::vector<std::string>& sgfFilePaths) = 0;
+
+    /// @brief Writes each document in @a documents to the file located at
+    /// the path with the same index in @a sgfFilePaths, on the worker
+    /// threads, and invokes @a resultHandler once for each document as soon
+    /// as the document has been written. Returns when all documents have
+    /// been written.
+    ///
+    /// @a resultHandler is invoked on the thread that invoked
+    /// WriteSgfFiles(), one result at a time and in the order in which the
+    /// documents finish writing, so it does not have to be thread-safe. If
+    /// @a resultHandler throws an exception, the documents whose writing
+    /// has not started yet are skipped, and the exception is rethrown after
+    /// the worker threads have finished.
+    ///
+    /// A document that cannot be encoded is handled in the same way as by
+    /// the other overload of WriteSgfFiles().
+    ///
+    /// @exception std::invalid_argument Is thrown if @a documents and
+    /// @a sgfFilePaths have a different number of elements, or if
+    /// @a documents contains @e nullptr.
+    virtual void WriteSgfFiles(
+      const std::vector<std::shared_ptr<ISgfcDocument>>& documents,
+      const std::vector<std::string>& sgfFilePaths,
+      const std::function<void(const SgfcBatchWriteResult& batchWriteResult)>& resultHandler) = 0;
+  };
+}
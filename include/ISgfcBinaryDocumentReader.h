@@ -0,0 +1,71 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <memory>
+#include <string>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcDocument;
+
+  /// @brief The ISgfcBinaryDocumentReader interface provides functions to
+  /// generate ISgfcDocument objects by loading data in the library's binary
+  /// document format from the filesystem or from in-memory data. Use
+  /// SgfcPlusPlusFactory to construct new ISgfcBinaryDocumentReader objects.
+  ///
+  /// @ingroup public-api
+  /// @ingroup document
+  ///
+  /// The data must have been written by ISgfcBinaryDocumentWriter. Unlike
+  /// ISgfcDocumentReader, ISgfcBinaryDocumentReader does not operate the SGFC
+  /// backend and does not parse any SGF data. The data is read in large
+  /// blocks, one per column of the format, and the document object tree is
+  /// then built directly from the loaded columns.
+  class SGFCPLUSPLUS_EXPORT ISgfcBinaryDocumentReader
+  {
+  public:
+    /// @brief Initializes a newly constructed ISgfcBinaryDocumentReader
+    /// object.
+    ISgfcBinaryDocumentReader();
+
+    /// @brief Destroys and cleans up the ISgfcBinaryDocumentReader object.
+    virtual ~ISgfcBinaryDocumentReader();
+
+    /// @brief Loads the binary document stored in the file located at the
+    /// specified path and returns the document.
+    ///
+    /// @exception std::runtime_error Is thrown if @a binaryFilePath cannot be
+    /// opened for reading, if the file does not contain a binary document in
+    /// a format version supported by the library, or if the data is
+    /// corrupt.
+    virtual std::shared_ptr<ISgfcDocument> ReadBinaryFile(const std::string& binaryFilePath) const = 0;
+
+    /// @brief Loads the binary document stored in @a binaryContent and
+    /// returns the document.
+    ///
+    /// @exception std::runtime_error Is thrown if @a binaryContent does not
+    /// contain a binary document in a format version supported by the
+    /// library, or if the data is corrupt.
+    virtual std::shared_ptr<ISgfcDocument> ReadBinaryContent(const std::string& binaryContent) const = 0;
+  };
+}
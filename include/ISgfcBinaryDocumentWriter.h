@@ -0,0 +1,85 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <memory>
+#include <string>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcDocument;
+
+  /// @brief The ISgfcBinaryDocumentWriter interface provides functions to
+  /// store ISgfcDocument objects in the library's binary document format,
+  /// either in the filesystem or in an in-memory string. Use
+  /// SgfcPlusPlusFactory to construct new ISgfcBinaryDocumentWriter objects.
+  /// Use ISgfcBinaryDocumentReader to load the stored data.
+  ///
+  /// @ingroup public-api
+  /// @ingroup document
+  ///
+  /// The binary document format is meant as a fast-loading cache for
+  /// documents that were previously obtained by other means, typically by
+  /// reading SGF data with ISgfcDocumentReader. It is not a replacement for
+  /// SGF as an interchange format. Unlike ISgfcDocumentWriter,
+  /// ISgfcBinaryDocumentWriter does not operate the SGFC backend: The
+  /// document object tree is stored as-is, without any validation.
+  ///
+  /// The format is versioned and stores the tree structure of the games,
+  /// the property names and types, and the property values together with
+  /// their typed values. Reading the stored data with
+  /// ISgfcBinaryDocumentReader produces a document object tree that is
+  /// identical to the original one.
+  class SGFCPLUSPLUS_EXPORT ISgfcBinaryDocumentWriter
+  {
+  public:
+    /// @brief Initializes a newly constructed ISgfcBinaryDocumentWriter
+    /// object.
+    ISgfcBinaryDocumentWriter();
+
+    /// @brief Destroys and cleans up the ISgfcBinaryDocumentWriter object.
+    virtual ~ISgfcBinaryDocumentWriter();
+
+    /// @brief Writes the content of @a document to a single file located at
+    /// the specified path. An existing file is overwritten.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a document is
+    /// @e nullptr, or if @a document is too large to be stored in the binary
+    /// document format.
+    /// @exception std::runtime_error Is thrown if @a binaryFilePath cannot be
+    /// opened for writing, or if writing to the file fails.
+    virtual void WriteBinaryFile(
+      std::shared_ptr<ISgfcDocument> document,
+      const std::string& binaryFilePath) const = 0;
+
+    /// @brief Writes the content of @a document into the specified string
+    /// object @a binaryContent. The previous content of @a binaryContent is
+    /// replaced.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a document is
+    /// @e nullptr, or if @a document is too large to be stored in the binary
+    /// document format.
+    virtual void WriteBinaryContent(
+      std::shared_ptr<ISgfcDocument> document,
+      std::string& binaryContent) const = 0;
+  };
+}
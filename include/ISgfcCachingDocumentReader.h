@@ -0,0 +1,103 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "ISgfcDocumentReader.h"
+#include "SgfcDocumentCacheKeyType.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <string>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The ISgfcCachingDocumentReader interface extends
+  /// ISgfcDocumentReader with an on-disk cache of read results. Use
+  /// SgfcPlusPlusFactory to construct new ISgfcCachingDocumentReader objects.
+  ///
+  /// @ingroup public-api
+  /// @ingroup sgfc-frontend
+  /// @ingroup document
+  ///
+  /// When ISgfcCachingDocumentReader is asked to read SGF data it first
+  /// looks for a cache entry for the data in its cache directory. If there
+  /// is an entry it returns the document and the parse result stored in the
+  /// entry without invoking SGFC. If there is no entry it reads the SGF data
+  /// in the same way as ISgfcDocumentReader, and then stores the read result
+  /// in a new cache entry. Documents are stored in the binary document format
+  /// written by ISgfcBinaryDocumentWriter.
+  ///
+  /// A cache entry is identified by the SGF data (see
+  /// SgfcDocumentCacheKeyType for the ways how SGF files can be identified)
+  /// together with the arguments that GetArguments() returns at the time of
+  /// the read operation. Changing the arguments therefore never causes a
+  /// stale read result to be returned.
+  ///
+  /// The cache directory can be shared by several ISgfcCachingDocumentReader
+  /// objects, also across processes. Cache entries are written to a
+  /// temporary file first and then renamed, so a reader never sees a
+  /// partially written entry. Cache entries that cannot be read, e.g.
+  /// because they were written by an incompatible version of the library,
+  /// are treated as if they did not exist.
+  ///
+  /// ISgfcCachingDocumentReader keeps track of the size of the entries that
+  /// it stores. When a new cache entry causes the tracked size to exceed the
+  /// maximum cache size, the least recently used entries are deleted until
+  /// the total size of all entries is a bit below the maximum cache size.
+  /// Because other processes may store entries in the same cache directory,
+  /// the actual size of all entries is also determined at regular intervals.
+  /// The cache can therefore temporarily exceed its maximum size.
+  class SGFCPLUSPLUS_EXPORT ISgfcCachingDocumentReader : public ISgfcDocumentReader
+  {
+  public:
+    /// @brief Initializes a newly constructed ISgfcCachingDocumentReader
+    /// object.
+    ISgfcCachingDocumentReader();
+
+    /// @brief Destroys and cleans up the ISgfcCachingDocumentReader object.
+    virtual ~ISgfcCachingDocumentReader();
+
+    /// @brief Returns the path of the directory in which the cache entries
+    /// are stored.
+    virtual std::string GetCacheDirectoryPath() const = 0;
+
+    /// @brief Returns how ReadSgfFile() identifies SGF files in the cache. The
+    /// default is #SgfcDocumentCacheKeyType::FileContent.
+    ///
+    /// ReadSgfContent() always identifies SGF data by a hash of its content.
+    virtual SgfcDocumentCacheKeyType GetCacheKeyType() const = 0;
+
+    /// @brief Sets how ReadSgfFile() identifies SGF files in the cache.
+    virtual void SetCacheKeyType(SgfcDocumentCacheKeyType cacheKeyType) = 0;
+
+    /// @brief Returns the maximum size in bytes of all cache entries
+    /// together. The default is 256 MiB.
+    virtual std::uint64_t GetMaximumCacheSize() const = 0;
+
+    /// @brief Sets the maximum size in bytes of all cache entries together.
+    /// The new maximum is enforced the next time that storing a cache entry
+    /// causes the cache to exceed the new maximum.
+    virtual void SetMaximumCacheSize(std::uint64_t maximumCacheSize) = 0;
+
+    /// @brief Deletes all cache entries from the cache directory.
+    virtual void ClearCache() const = 0;
+  };
+}
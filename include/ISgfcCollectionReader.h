@@ -0,0 +1,126 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "ISgfcDocumentReadResult.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcDocumentReader;
+
+  /// @brief The ISgfcCollectionReader interface provides functions to read
+  /// individual game trees, or ranges of game trees, from a single .sgf file
+  /// that contains a large collection of game trees, without reading the
+  /// rest of the file. Use SgfcPlusPlusFactory to construct new
+  /// ISgfcCollectionReader objects.
+  ///
+  /// @ingroup public-api
+  /// @ingroup sgfc-frontend
+  ///
+  /// When it is constructed, ISgfcCollectionReader obtains an index of the
+  /// byte offsets at which the top-level game trees in the .sgf file begin
+  /// and end. The index is either built by scanning the .sgf file, which
+  /// requires only a small, fixed amount of memory, or it is loaded from a
+  /// sidecar index file that an earlier ISgfcCollectionReader has written.
+  /// The scan looks only at the parentheses and the property value brackets
+  /// of the SGF data; it does not check the SGF data in any other way.
+  ///
+  /// A read operation reads the bytes of the requested game trees from the
+  /// .sgf file and passes them to an ISgfcDocumentReader. The arguments and
+  /// the read options of that document reader therefore apply to each read
+  /// operation. To process all games of a collection one at a time with
+  /// bounded memory, invoke ReadGame() for each game index in turn.
+  ///
+  /// Because each read operation puts only part of the .sgf file through
+  /// SGFC, the following differences exist compared to reading the entire
+  /// .sgf file with ISgfcDocumentReader:
+  /// - Line and column numbers in the messages of a read result refer to
+  ///   the beginning of the first game tree that was read, not to the
+  ///   beginning of the .sgf file.
+  /// - With SgfcArgumentType::EncodingMode 1, the text encoding is
+  ///   determined from the game trees that are read, not from the first
+  ///   game tree in the .sgf file. A UTF-8 BOM at the beginning of the .sgf
+  ///   file is honored for all read operations.
+  class SGFCPLUSPLUS_EXPORT ISgfcCollectionReader
+  {
+  public:
+    /// @brief Initializes a newly constructed ISgfcCollectionReader object.
+    ISgfcCollectionReader();
+
+    /// @brief Destroys and cleans up the ISgfcCollectionReader object.
+    virtual ~ISgfcCollectionReader();
+
+    /// @brief Returns the path of the .sgf file that ISgfcCollectionReader
+    /// reads from.
+    virtual std::string GetSgfFilePath() const = 0;
+
+    /// @brief Returns the ISgfcDocumentReader object that
+    /// ISgfcCollectionReader uses to read game trees. Change the arguments
+    /// or the read options of the document reader to change the way how
+    /// game trees are read.
+    virtual std::shared_ptr<ISgfcDocumentReader> GetDocumentReader() const = 0;
+
+    /// @brief Returns true if the index was loaded from the sidecar index
+    /// file. Returns false if the index was built by scanning the .sgf file.
+    virtual bool IsIndexLoadedFromIndexFile() const = 0;
+
+    /// @brief Returns the number of top-level game trees in the .sgf file.
+    virtual std::size_t GetNumberOfGames() const = 0;
+
+    /// @brief Reads the game tree with index @a gameIndex from the .sgf
+    /// file.
+    ///
+    /// @return An ISgfcDocumentReadResult object that provides the result of
+    /// the read operation. If the read operation is successful, the
+    /// document contains exactly one game.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a gameIndex is equal
+    /// to or greater than GetNumberOfGames().
+    /// @exception std::runtime_error Is thrown if the game tree cannot be
+    /// read from the .sgf file, e.g. because the file was modified after
+    /// the index was obtained.
+    virtual std::shared_ptr<ISgfcDocumentReadResult> ReadGame(std::size_t gameIndex) const = 0;
+
+    /// @brief Reads @a numberOfGames consecutive game trees from the .sgf
+    /// file, starting with the game tree with index @a firstGameIndex. The
+    /// game trees are read with a single read operation.
+    ///
+    /// @return An ISgfcDocumentReadResult object that provides the result of
+    /// the read operation. If the read operation is successful, the
+    /// document contains the games in the order in which they appear in the
+    /// .sgf file.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a numberOfGames is 0,
+    /// or if the range of game indexes exceeds GetNumberOfGames().
+    /// @exception std::runtime_error Is thrown if the game trees cannot be
+    /// read from the .sgf file, e.g. because the file was modified after
+    /// the index was obtained.
+    virtual std::shared_ptr<ISgfcDocumentReadResult> ReadGames(
+      std::size_t firstGameIndex,
+      std::size_t numberOfGames) const = 0;
+  };
+}
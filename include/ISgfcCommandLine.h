@@ -105,6 +105,11 @@ namespace LibSgfcPlusPlus
     /// through the SGFC parser. This method may only be invoked if
     /// IsCommandLineValid() returns true.
     ///
+    /// A file that is compressed in the gzip or Zstandard format is
+    /// recognized by its content and decompressed transparently, provided
+    /// that support for the compression format was enabled when the library
+    /// was built.
+    ///
     /// @return An SgfcExitCode value whose numeric value matches one of the
     /// exit codes of SGFC.
     ///
@@ -159,6 +164,11 @@ namespace LibSgfcPlusPlus
     ///
     /// If a file already exists at the specified path it is overwritten.
     ///
+    /// If @a sgfFilePath has the file name extension ".gz" or ".zst", the
+    /// file is written compressed in the gzip or Zstandard format, provided
+    /// that support for the compression format was enabled when the library
+    /// was built.
+    ///
     /// @return An SgfcExitCode value whose numeric value matches one of the
     /// exit codes of SGFC.
     ///
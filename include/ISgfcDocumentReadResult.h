@@ -76,6 +76,14 @@ namespace LibSgfcPlusPlus
     /// object that is returned contains no data.
     virtual std::shared_ptr<ISgfcDocument> GetDocument() const = 0;
 
+    /// @brief Returns true if the document object that GetDocument() returns
+    /// is missing one or more nodes of the SGF data because the read options
+    /// of the ISgfcDocumentReader prevented the nodes from being built.
+    /// Returns false if the document object contains all nodes.
+    ///
+    /// @see ISgfcDocumentReader::SetReadOptions()
+    virtual bool IsDocumentTruncated() const = 0;
+
     /// @brief Prints the content of the ISgfcDocumentReadResult to stdout for
     /// debugging purposes.
     virtual void DebugPrintToConsole() const = 0;
@@ -18,6 +18,7 @@
 
 // Project includes
 #include "ISgfcDocumentReadResult.h"
+#include "SgfcDocumentReadOptions.h"
 
 // Project includes (generated)
 #include "SgfcPlusPlusExport.h"
@@ -89,11 +90,35 @@ namespace LibSgfcPlusPlus
     /// operations use the same arguments.
     virtual std::shared_ptr<ISgfcArguments> GetArguments() const = 0;
 
+    /// @brief Returns the options that limit which parts of the game trees
+    /// ISgfcDocumentReader builds into the document object tree. The default
+    /// is an SgfcDocumentReadOptions object with default values, i.e. the
+    /// entire game trees are built.
+    virtual SgfcDocumentReadOptions GetReadOptions() const = 0;
+
+    /// @brief Sets the options that limit which parts of the game trees
+    /// ISgfcDocumentReader builds into the document object tree to
+    /// @a readOptions. The options retain their state between read
+    /// operations.
+    ///
+    /// Use this to save time and memory when only a part of each game is
+    /// needed, e.g. the first moves of the main variation.
+    ///
+    /// @see ISgfcDocumentReadResult::IsDocumentTruncated()
+    virtual void SetReadOptions(const SgfcDocumentReadOptions& readOptions) = 0;
+
     /// @brief Reads SGF data from a single .sgf file located at the specified
     /// path and puts the data through the SGFC parser, using the arguments that
     /// GetArguments() currently returns.
     ///
-    /// Read the class documentation for details about encodings.
+    /// Read the class documentation for details about encodings. The
+    /// document object tree is built according to the options that
+    /// GetReadOptions() currently returns.
+    ///
+    /// A file that is compressed in the gzip or Zstandard format is
+    /// recognized by its content and decompressed transparently, provided
+    /// that support for the compression format was enabled when the library
+    /// was built.
     ///
     /// @return An ISgfcDocumentReadResult object that provides the result of
     /// the read operation.
@@ -103,7 +128,9 @@ namespace LibSgfcPlusPlus
     /// through the SGFC parser, using the arguments that GetArguments()
     /// currently returns.
     ///
-    /// Read the class documentation for details about encodings.
+    /// Read the class documentation for details about encodings. The
+    /// document object tree is built according to the options that
+    /// GetReadOptions() currently returns.
     ///
     /// @return An ISgfcDocumentReadResult object that provides the result of
     /// the read operation.
@@ -116,6 +116,52 @@ namespace LibSgfcPlusPlus
     /// that repeated write operations use the same arguments.
     virtual std::shared_ptr<ISgfcArguments> GetArguments() const = 0;
 
+    /// @brief Returns the number of worker threads that are used to encode
+    /// a document into SGF content before it is passed to SGFC. The value 0
+    /// means that the number of threads is determined by the number of
+    /// concurrent threads supported by the hardware. The default is 1, i.e.
+    /// the document is encoded on the thread that performs the write
+    /// operation.
+    ///
+    /// Multiple threads encode the games of a document, and large subtrees of
+    /// a game, independently of each other. The resulting SGF content is the
+    /// same regardless of the number of threads. SGFC itself processes the
+    /// SGF content on a single thread.
+    virtual unsigned int GetNumberOfThreads() const = 0;
+
+    /// @brief Sets the number of worker threads that are used to encode a
+    /// document into SGF content before it is passed to SGFC.
+    virtual void SetNumberOfThreads(unsigned int numberOfThreads) = 0;
+
+    /// @brief Returns true if ISgfcDocumentWriter encodes documents
+    /// incrementally. Returns false if ISgfcDocumentWriter encodes every
+    /// document in its entirety. The default is false.
+    ///
+    /// When incremental encoding is enabled, ISgfcDocumentWriter keeps the
+    /// SGF content that it generated for every node of the document that it
+    /// wrote most recently. When the same document is written again, only the
+    /// nodes that were modified in the meantime, and their ancestors, need to
+    /// be visited, and only the nodes whose properties were modified need to
+    /// be encoded. This is useful for an application that writes a large
+    /// document after every small change. SGFC still processes the entire SGF
+    /// content.
+    ///
+    /// A node is modified if its collection of properties is changed via
+    /// ISgfcNode, or if it gains or loses a child node via ISgfcTreeBuilder.
+    /// @attention Changes that are made to an ISgfcProperty object, or to
+    /// one of its property values, after the property was added to a node are
+    /// @b not detected. To make such a change visible, set the property on
+    /// the node again.
+    ///
+    /// The kept SGF content requires about as much memory as the SGF content
+    /// of the document.
+    virtual bool GetUseIncrementalEncoding() const = 0;
+
+    /// @brief Sets whether ISgfcDocumentWriter encodes documents
+    /// incrementally. Disabling incremental encoding discards the SGF content
+    /// that ISgfcDocumentWriter has kept.
+    virtual void SetUseIncrementalEncoding(bool useIncrementalEncoding) = 0;
+
     /// @brief Writes the content of @a document to a single .sgf file located
     /// at the specified path, using the arguments that GetArguments() currently
     /// returns.
@@ -125,6 +171,11 @@ namespace LibSgfcPlusPlus
     /// functions. The messages in the result object therefore are a combination
     /// of a full cycle of SGFC backend load/parse/write operations.
     ///
+    /// If @a sgfFilePath has the file name extension ".gz" or ".zst", the
+    /// file is written compressed in the gzip or Zstandard format, provided
+    /// that support for the compression format was enabled when the library
+    /// was built.
+    ///
     /// @attention Read the class documentation for a note about encodings.
     ///
     /// @return An ISgfcDocumentWriteResult object that provides the result of
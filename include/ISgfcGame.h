@@ -20,19 +20,24 @@
 #include "ISgfcNode.h"
 #include "SgfcBoardSize.h"
 #include "SgfcGameType.h"
+#include "SgfcGoMoveBuffers.h"
+#include "SgfcNodeChange.h"
 #include "SgfcTypedefs.h"
 
 // Project includes (generated)
 #include "SgfcPlusPlusExport.h"
 
 // C++ Standard Library includes
+#include <cstddef>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace LibSgfcPlusPlus
 {
   // Forward declarations
   class ISgfcGameInfo;
+  class ISgfcGoPosition;
   class ISgfcTreeBuilder;
 
   /// @brief The ISgfcGame interface provides access to the data of one SGF
@@ -176,6 +181,157 @@ namespace LibSgfcPlusPlus
     /// @see SgfcNodeTraits::GameInfo
     virtual std::vector<std::shared_ptr<ISgfcNode>> GetGameInfoNodes() const = 0;
 
+    /// @brief Returns all nodes in the game tree that contain a property with
+    /// the specified type @a propertyType. Returns an empty list if no node
+    /// contains such a property, or if the game has no root node.
+    ///
+    /// The nodes are returned in the order in which a depth-first search
+    /// would find them.
+    ///
+    /// The query is answered from the game's property index. If the game
+    /// has no property index yet, one is built on the first query (see
+    /// BuildPropertyIndex()). The cost of the query then is proportional to
+    /// the size of the result, not to the size of the game tree.
+    ///
+    /// This method may be invoked concurrently by several threads, as long as
+    /// no thread modifies the game at the same time.
+    virtual std::vector<std::shared_ptr<ISgfcNode>> GetNodesWithProperty(SgfcPropertyType propertyType) const = 0;
+
+    /// @brief Returns all nodes in the game tree that contain a property with
+    /// the specified name @a propertyName. Returns an empty list if no node
+    /// contains such a property, or if the game has no root node.
+    ///
+    /// This is useful mainly for finding nodes with custom properties, i.e.
+    /// properties whose type is SgfcPropertyType::Unknown. Otherwise this
+    /// method behaves like GetNodesWithProperty(SgfcPropertyType).
+    virtual std::vector<std::shared_ptr<ISgfcNode>> GetNodesWithProperty(const std::string& propertyName) const = 0;
+
+    /// @brief Returns true if the game has a property index. Returns false if
+    /// the game has no property index.
+    virtual bool HasPropertyIndex() const = 0;
+
+    /// @brief Builds the game's property index, an inverted index that maps
+    /// each property type and each property name to the nodes that contain
+    /// a property with that type or name. Discards the previous property
+    /// index, if there is one.
+    ///
+    /// Invoking this method is optional, the index is also built on demand
+    /// by GetNodesWithProperty(). Building the index eagerly is useful for
+    /// clients that want to pay the cost up-front, e.g. immediately after a
+    /// document has been loaded.
+    ///
+    /// Once it has been built the index is maintained automatically:
+    /// - Changes to a node's properties made via the ISgfcNode property
+    ///   setters update the index incrementally.
+    /// - Changes to the structure of the game tree made via ISgfcTreeBuilder
+    ///   or SetRootNode() cause the index to be rebuilt the next time
+    ///   GetNodesWithProperty() is invoked.
+    virtual void BuildPropertyIndex() const = 0;
+
+    /// @brief Discards the game's property index to free up the memory it
+    /// uses. Does nothing if the game has no property index.
+    virtual void DiscardPropertyIndex() = 0;
+
+    /// @brief Writes the Go moves of the game tree's main variation to the
+    /// buffers described by @a moveBuffers. Returns the number of moves in
+    /// the main variation.
+    ///
+    /// The main variation is the path that starts with the root node and
+    /// continues along the first child descendants down to the last node that
+    /// has no more children. This is the path that ISgfcNode::GetMainVariationNodes()
+    /// returns when it is invoked on the root node.
+    ///
+    /// If the return value is greater than SgfcGoMoveBuffers::Capacity then
+    /// only the first SgfcGoMoveBuffers::Capacity moves have been written. The
+    /// caller can then enlarge the buffers and invoke this method again.
+    ///
+    /// This method is designed for bulk extraction of moves, e.g. for
+    /// machine learning pipelines. Unlike ISgfcNode::GetMainVariationNodes()
+    /// it does not create any collections of nodes, and it reads the moves
+    /// directly from the decoded property values.
+    ///
+    /// A node with property SgfcPropertyType::B and/or SgfcPropertyType::W
+    /// contributes one move per property, black before white. Move property
+    /// values that could not be interpreted as Go moves (i.e. that have no
+    /// ISgfcGoMovePropertyValue) are skipped.
+    ///
+    /// Returns 0 if GetGameType() does not return SgfcGameType::Go, or if the
+    /// game has no root node.
+    virtual std::size_t GetMainVariationGoMoves(const SgfcGoMoveBuffers& moveBuffers) const = 0;
+
+    /// @brief Writes the Go moves of the variation that contains @a node to
+    /// the buffers described by @a moveBuffers. Returns the number of moves
+    /// in the variation.
+    ///
+    /// The variation consists of the nodes that ISgfcNode::GetMainVariationNodes()
+    /// returns when it is invoked on @a node: The path from the root node down
+    /// to @a node, followed by the first child descendants of @a node. This
+    /// allows to select any variation in the game tree by passing the
+    /// variation's leaf node.
+    ///
+    /// Otherwise this method behaves like GetMainVariationGoMoves(const SgfcGoMoveBuffers&).
+    ///
+    /// @exception std::invalid_argument Is thrown if @a node is @e nullptr,
+    /// or if @a node is not part of the game tree.
+    virtual std::size_t GetMainVariationGoMoves(
+      std::shared_ptr<ISgfcNode> node,
+      const SgfcGoMoveBuffers& moveBuffers) const = 0;
+
+    /// @brief Returns the Go board position after all nodes on the path from
+    /// the root node down to and including @a node have been applied. Returns
+    /// @e nullptr if GetGameType() does not return SgfcGameType::Go, or if
+    /// GetBoardSize() does not return a valid board size for
+    /// SgfcGameType::Go.
+    ///
+    /// Nodes are applied as described in the documentation of
+    /// ISgfcGoReplayEngine, with the ruleset taken from the game's root node
+    /// and game info node. Unlike ISgfcGoReplayEngine::ReplayToNode(), an
+    /// illegal move does not stop the replay: The move is not played, but the
+    /// nodes after it are still applied.
+    ///
+    /// To make repeated queries cheap, the game stores replay checkpoints
+    /// along the paths that it has replayed: A checkpoint is stored every
+    /// so many nodes, and at every node that has more than one child. A query
+    /// replays only the nodes between the nearest checkpoint above @a node
+    /// and @a node. The number of checkpoints is limited, when the limit is
+    /// reached the least recently used checkpoint is discarded. Use
+    /// ConfigureGoPositionCheckpoints() to change the defaults.
+    ///
+    /// The checkpoints are discarded when the structure of the game tree
+    /// changes, or when the properties of a node that was replayed change
+    /// via the ISgfcNode property setters.
+    ///
+    /// This method may be invoked concurrently by several threads, as long as
+    /// no thread modifies the game at the same time.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a node is @e nullptr,
+    /// or if @a node is not part of the game tree.
+    virtual std::shared_ptr<ISgfcGoPosition> GetGoPosition(std::shared_ptr<ISgfcNode> node) const = 0;
+
+    /// @brief Configures how GetGoPosition() stores replay checkpoints. A
+    /// checkpoint is stored every @a checkpointInterval nodes along a path,
+    /// and at most @a maximumNumberOfCheckpoints checkpoints are kept. Discards
+    /// all checkpoints that are currently stored.
+    ///
+    /// The defaults are SgfcConstants::GoPositionCheckpointIntervalDefault and
+    /// SgfcConstants::GoPositionMaximumNumberOfCheckpointsDefault. Each
+    /// checkpoint holds a copy of the board. The position history that is
+    /// needed for superko checks is shared between the checkpoints on a
+    /// path, each checkpoint adds only the positions since the previous
+    /// checkpoint. Memory usage therefore grows linearly with
+    /// @a maximumNumberOfCheckpoints. If @a maximumNumberOfCheckpoints is 0
+    /// no checkpoints are stored and every query replays from the root node.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a checkpointInterval is
+    /// 0.
+    virtual void ConfigureGoPositionCheckpoints(
+      std::size_t checkpointInterval,
+      std::size_t maximumNumberOfCheckpoints) = 0;
+
+    /// @brief Discards all replay checkpoints stored by GetGoPosition() to
+    /// free up the memory they use.
+    virtual void DiscardGoPositionCheckpoints() = 0;
+
     /// @brief Returns a newly constructed ISgfcGameInfo object with values
     /// taken from the properties in the root node that GetRootNode() returns
     /// and the first game info node in the list of game info nodes returned by
@@ -233,6 +389,43 @@ namespace LibSgfcPlusPlus
     /// @exception std::invalid_argument Is thrown if @a gameInfo is @e nullptr.
     virtual void WriteGameInfo(std::shared_ptr<ISgfcGameInfo> gameInfo) = 0;
 
+    /// @brief Returns a collection with the differences between the game tree
+    /// of the game and the game tree of @a newGame. The game is the old
+    /// version, @a newGame is the new version. The collection is empty if
+    /// both game trees have the same content.
+    ///
+    /// The two game trees are compared node by node, starting with the root
+    /// nodes. Subtrees with the same content are recognized in O(1) via
+    /// ISgfcNode::GetContentHash() and skipped. Therefore the cost of the
+    /// comparison mainly depends on the number of differences, not on the
+    /// size of the game trees. When two nodes are compared, their child nodes
+    /// are matched like this:
+    /// - Child nodes with the same content are matched first, regardless of
+    ///   their position. This recognizes variations that were inserted,
+    ///   removed or reordered.
+    /// - The remaining child nodes are paired up in the order in which they
+    ///   appear in the game tree. A node is reported as
+    ///   SgfcNodeChangeType::Changed if its properties differ from the
+    ///   properties of the node it was paired with. The comparison then
+    ///   continues with the child nodes of the pair.
+    /// - The child nodes that are left over are reported as
+    ///   SgfcNodeChangeType::Added or SgfcNodeChangeType::Removed.
+    ///
+    /// A consequence is that inserting a node in the middle of a sequence of
+    /// nodes is reported as a change of all nodes that follow it in the
+    /// sequence, plus one added node at the end of the sequence.
+    ///
+    /// The collection is ordered depth-first. If only one of the games has a
+    /// root node then the collection contains a single element that reports
+    /// the root node as added or removed.
+    ///
+    /// This method may be invoked concurrently by several threads, also with
+    /// the same games, as long as no thread modifies the games at the same
+    /// time.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a newGame is @e nullptr.
+    virtual std::vector<SgfcNodeChange> GetNodeChanges(std::shared_ptr<ISgfcGame> newGame) const = 0;
+
     /// @brief Returns an ISgfcTreeBuilder object that can be used to
     /// manipulate the game tree.
     virtual std::shared_ptr<ISgfcTreeBuilder> GetTreeBuilder() const = 0;
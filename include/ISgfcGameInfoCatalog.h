@@ -0,0 +1,75 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "SgfcGameInfoCatalogEntry.h"
+#include "SgfcGameInfoCatalogQuery.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The ISgfcGameInfoCatalog interface provides functions to query a
+  /// catalog of game information, written by ISgfcGameInfoCatalogWriter. Use
+  /// SgfcPlusPlusFactory to construct new ISgfcGameInfoCatalog objects.
+  ///
+  /// @ingroup public-api
+  /// @ingroup game
+  ///
+  /// The catalog is loaded into memory in its columnar form. A query is
+  /// evaluated column by column: Each criterion of the query is checked with
+  /// a tight loop over a single column, which narrows down the set of
+  /// matching games. String criteria are first resolved to a reference into
+  /// the string dictionary, so that the loop compares only integers. This
+  /// makes queries fast even if the catalog contains millions of games.
+  ///
+  /// Games are identified by their index in the catalog, in the range from 0
+  /// to GetNumberOfGames() - 1. Games appear in the catalog ordered by file,
+  /// then by their index in the file.
+  ///
+  /// The functions of ISgfcGameInfoCatalog may be invoked concurrently from
+  /// multiple threads.
+  class SGFCPLUSPLUS_EXPORT ISgfcGameInfoCatalog
+  {
+  public:
+    /// @brief Initializes a newly constructed ISgfcGameInfoCatalog object.
+    ISgfcGameInfoCatalog();
+
+    /// @brief Destroys and cleans up the ISgfcGameInfoCatalog object.
+    virtual ~ISgfcGameInfoCatalog();
+
+    /// @brief Returns the number of games in the catalog.
+    virtual std::size_t GetNumberOfGames() const = 0;
+
+    /// @brief Returns the game information of the game with index
+    /// @a catalogIndex.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a catalogIndex is equal to
+    /// or greater than GetNumberOfGames().
+    virtual SgfcGameInfoCatalogEntry GetEntry(std::size_t catalogIndex) const = 0;
+
+    /// @brief Returns the indexes of the games that match @a query, in
+    /// ascending order. Returns an empty collection if no games match.
+    virtual std::vector<std::size_t> FindGames(const SgfcGameInfoCatalogQuery& query) const = 0;
+  };
+}
@@ -0,0 +1,82 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <string>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The ISgfcGameInfoCatalogWriter interface provides functions to
+  /// build an on-disk catalog of the game information of all games in a
+  /// corpus of SGF files. Use SgfcPlusPlusFactory to construct new
+  /// ISgfcGameInfoCatalogWriter objects. Use ISgfcGameInfoCatalog to query
+  /// the catalog.
+  ///
+  /// @ingroup public-api
+  /// @ingroup game
+  ///
+  /// For every game in the corpus the catalog stores the values listed in
+  /// SgfcGameInfoCatalogEntry. The game information is taken from the first
+  /// game info node of the game (see ISgfcGame::CreateGameInfo()). SGF files
+  /// that cannot be read are skipped.
+  ///
+  /// The catalog is stored in columnar form, i.e. the values of one kind
+  /// (e.g. all Black player names) are stored together. String values are
+  /// dictionary-encoded, i.e. every distinct string is stored only once and
+  /// the columns store references to the strings.
+  ///
+  /// The SGF files are processed in parallel by a pool of worker threads.
+  /// Note that SGFC, which the library uses to read SGF files, processes only
+  /// one SGF file at a time, so parsing is serialized.
+  class SGFCPLUSPLUS_EXPORT ISgfcGameInfoCatalogWriter
+  {
+  public:
+    /// @brief Initializes a newly constructed ISgfcGameInfoCatalogWriter
+    /// object.
+    ISgfcGameInfoCatalogWriter();
+
+    /// @brief Destroys and cleans up the ISgfcGameInfoCatalogWriter object.
+    virtual ~ISgfcGameInfoCatalogWriter();
+
+    /// @brief Returns the number of worker threads that are used to build the
+    /// catalog. The value 0 means that the number of threads is determined by
+    /// the number of concurrent threads supported by the hardware. The default
+    /// is 0.
+    virtual unsigned int GetNumberOfThreads() const = 0;
+
+    /// @brief Sets the number of worker threads that are used to build the
+    /// catalog.
+    virtual void SetNumberOfThreads(unsigned int numberOfThreads) = 0;
+
+    /// @brief Builds a catalog of all games in all files with the extension
+    /// ".sgf" that are located in the directory @a sgfDirectoryPath or in one
+    /// of its subdirectories, and writes the catalog to the file
+    /// @a catalogFilePath. An existing file is overwritten. Returns the number
+    /// of games in the catalog.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a sgfDirectoryPath does
+    /// not refer to a directory.
+    /// @exception std::runtime_error Is thrown if @a catalogFilePath cannot be
+    /// opened for writing.
+    virtual std::size_t WriteCatalog(const std::string& sgfDirectoryPath, const std::string& catalogFilePath) const = 0;
+  };
+}
@@ -0,0 +1,90 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "SgfcGameInfoScanResult.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <string>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The ISgfcGameInfoScanner interface provides functions to obtain
+  /// the game information of all game trees in SGF data from the filesystem
+  /// or from in-memory data, without reading the entire SGF data. Use
+  /// SgfcPlusPlusFactory to construct new ISgfcGameInfoScanner objects.
+  ///
+  /// @ingroup public-api
+  /// @ingroup sgfc-frontend
+  ///
+  /// ISgfcGameInfoScanner is intended for tasks such as cataloging and
+  /// indexing that only need the root and game info properties of a game
+  /// tree. Instead of putting the SGF data through the SGFC parser and
+  /// building a document object tree, ISgfcGameInfoScanner scans the raw SGF
+  /// data for the root node and the first game info node of each game tree.
+  /// It decodes only the root and game info properties in those nodes,
+  /// applying the same rules as ISgfcDocumentReader, and skips over the
+  /// remaining nodes without looking at their property values.
+  ///
+  /// The fast scan is used only if the SGF data is well-formed and free of
+  /// anything that SGFC would have to correct. If this is not the case,
+  /// ISgfcGameInfoScanner transparently falls back to reading the SGF data
+  /// with an ISgfcDocumentReader that uses the default arguments, and then
+  /// obtains the game information from the document object tree. Notably,
+  /// the fallback is used in the following cases:
+  /// - The SGF data violates the SGF syntax, e.g. unbalanced parentheses or
+  ///   an unterminated property value.
+  /// - Property identifiers contain lowercase letters (FF1-3 style).
+  /// - A root or game info property occurs more than once in a node, has a
+  ///   value that cannot be converted to the type required by the SGF
+  ///   standard, or has a value with leading or trailing whitespace.
+  /// - The SGF data contains non-ASCII characters and the text encoding is
+  ///   neither UTF-8 nor ISO-8859-1, or the SGF data is not valid UTF-8.
+  ///
+  /// Like ISgfcDocumentReader, ISgfcGameInfoScanner decodes the SGF data to
+  /// UTF-8. The encoding is determined in the same way as
+  /// SgfcArgumentType::EncodingMode 1 does it.
+  ///
+  /// @note The fast scan checks only the syntax of the nodes that it skips
+  /// over. If a game tree contains errors that SGFC considers fatal in a node
+  /// that the scan skips over, ISgfcGameInfoScanner still provides the game
+  /// information for the game tree.
+  class SGFCPLUSPLUS_EXPORT ISgfcGameInfoScanner
+  {
+  public:
+    /// @brief Initializes a newly constructed ISgfcGameInfoScanner object.
+    ISgfcGameInfoScanner();
+
+    /// @brief Destroys and cleans up the ISgfcGameInfoScanner object.
+    virtual ~ISgfcGameInfoScanner();
+
+    /// @brief Scans SGF data from a single .sgf file located at the specified
+    /// path and returns the game information of all game trees in the file.
+    ///
+    /// If the file cannot be read, the fallback is used so that
+    /// SgfcGameInfoScanResult::FallbackReadResult describes the problem.
+    virtual SgfcGameInfoScanResult ScanSgfFile(const std::string& sgfFilePath) const = 0;
+
+    /// @brief Scans SGF data from the specified string and returns the game
+    /// information of all game trees in the string.
+    virtual SgfcGameInfoScanResult ScanSgfContent(const std::string& sgfContent) const = 0;
+  };
+}
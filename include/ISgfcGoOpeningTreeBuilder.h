@@ -0,0 +1,172 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "SgfcBoardSize.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcDocument;
+  class ISgfcGame;
+
+  /// @brief The ISgfcGoOpeningTreeBuilder interface provides functions to
+  /// merge the moves of many Go games into a single game tree, an opening
+  /// tree, that records how often each sequence of moves was played and how
+  /// the games that played it ended. Use SgfcPlusPlusFactory to construct new
+  /// ISgfcGoOpeningTreeBuilder objects.
+  ///
+  /// @ingroup public-api
+  /// @ingroup go
+  ///
+  /// Every game that is added contributes the moves of its main variation
+  /// (see ISgfcGame::GetMainVariationGoMoves()). The moves are inserted into
+  /// a trie: Games that start with the same moves share the nodes for these
+  /// moves, and every node counts the games that passed through it, together
+  /// with the results of these games (see ISgfcGameInfo::GetGameResult()).
+  /// Looking up the child node for a move costs O(1) regardless of how many
+  /// different continuations have been played, so the cost of adding a game
+  /// is proportional to the number of its moves.
+  ///
+  /// Only games that can be merged meaningfully are added. A game is skipped
+  /// if it is not a Go game, if its board size differs from the board size
+  /// of the opening tree, or if its root node contains setup properties
+  /// (SgfcPropertyType::AB, SgfcPropertyType::AW or SgfcPropertyType::AE),
+  /// e.g. because it is a handicap game. The moves are not checked for
+  /// legality.
+  ///
+  /// If canonical symmetry is enabled, each game is first rotated and/or
+  /// reflected so that its move sequence becomes the smallest of all
+  /// equivalent move sequences. As a result games that differ only by a
+  /// symmetry of the board are merged into the same nodes. The moves in the
+  /// opening tree then tend to be played in the upper left part of the
+  /// board.
+  ///
+  /// AddGames() processes the games on a pool of worker threads. The part of
+  /// the opening tree below the first few moves is split into shards, and
+  /// each shard is merged by only one thread at a time, so the threads do not
+  /// need to synchronize while they merge. The result does not depend on the
+  /// number of threads.
+  ///
+  /// ISgfcGoOpeningTreeBuilder is not thread-safe. A library client must not
+  /// invoke methods of the same object concurrently.
+  class SGFCPLUSPLUS_EXPORT ISgfcGoOpeningTreeBuilder
+  {
+  public:
+    /// @brief Initializes a newly constructed ISgfcGoOpeningTreeBuilder
+    /// object.
+    ISgfcGoOpeningTreeBuilder();
+
+    /// @brief Destroys and cleans up the ISgfcGoOpeningTreeBuilder object.
+    virtual ~ISgfcGoOpeningTreeBuilder();
+
+    /// @brief Returns the board size of the opening tree. Only games with
+    /// this board size are added.
+    virtual SgfcBoardSize GetBoardSize() const = 0;
+
+    /// @brief Returns the maximum number of moves of each game that are
+    /// added to the opening tree. The value 0 means that all moves are
+    /// added. The default is 0.
+    virtual std::size_t GetMaximumNumberOfMoves() const = 0;
+
+    /// @brief Sets the maximum number of moves of each game that are added
+    /// to the opening tree.
+    ///
+    /// @exception std::logic_error Is thrown if games were already added.
+    virtual void SetMaximumNumberOfMoves(std::size_t maximumNumberOfMoves) = 0;
+
+    /// @brief Returns true if games that differ only by a rotation or
+    /// reflection of the board are merged into the same nodes. Returns false
+    /// if games are merged as they were played. The default is false.
+    virtual bool GetUseCanonicalSymmetry() const = 0;
+
+    /// @brief Sets whether games that differ only by a rotation or
+    /// reflection of the board are merged into the same nodes.
+    ///
+    /// @exception std::logic_error Is thrown if games were already added.
+    virtual void SetUseCanonicalSymmetry(bool useCanonicalSymmetry) = 0;
+
+    /// @brief Returns the minimum number of games that must have passed
+    /// through a node so that CreateDocument() includes the node. The
+    /// default is 1, i.e. all nodes are included.
+    virtual std::size_t GetMinimumNumberOfGames() const = 0;
+
+    /// @brief Sets the minimum number of games that must have passed through
+    /// a node so that CreateDocument() includes the node. The value 0 is
+    /// treated like the value 1.
+    virtual void SetMinimumNumberOfGames(std::size_t minimumNumberOfGames) = 0;
+
+    /// @brief Returns the number of worker threads that AddGames() uses. The
+    /// value 0 means that the number of threads is determined by the number
+    /// of concurrent threads supported by the hardware. The default is 0.
+    virtual unsigned int GetNumberOfThreads() const = 0;
+
+    /// @brief Sets the number of worker threads that AddGames() uses.
+    virtual void SetNumberOfThreads(unsigned int numberOfThreads) = 0;
+
+    /// @brief Adds the moves of @a game to the opening tree. Returns true if
+    /// the game was added. Returns false if the game was skipped.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a game is @e nullptr.
+    virtual bool AddGame(std::shared_ptr<ISgfcGame> game) = 0;
+
+    /// @brief Adds the moves of the games in @a games to the opening tree,
+    /// using multiple worker threads. Returns the number of games that were
+    /// added. The result is the same as if AddGame() had been invoked for
+    /// each game, in the order in which the games appear in @a games.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a games contains a
+    /// @e nullptr element. No game is added in that case.
+    virtual std::size_t AddGames(const std::vector<std::shared_ptr<ISgfcGame>>& games) = 0;
+
+    /// @brief Returns the number of games that were added to the opening
+    /// tree.
+    virtual std::size_t GetNumberOfGames() const = 0;
+
+    /// @brief Returns the number of nodes in the opening tree, not counting
+    /// the root node. Each node represents a distinct sequence of moves.
+    virtual std::size_t GetNumberOfNodes() const = 0;
+
+    /// @brief Returns a newly constructed ISgfcDocument object that contains
+    /// the opening tree as its only game.
+    ///
+    /// The root node of the game contains the properties
+    /// SgfcPropertyType::GM and SgfcPropertyType::SZ. Every other node
+    /// contains one move, as property SgfcPropertyType::B or
+    /// SgfcPropertyType::W. The child nodes of a node are ordered by the
+    /// number of games that played them, most frequent first, so the main
+    /// variation is the most popular line of play. Nodes through which fewer
+    /// than GetMinimumNumberOfGames() games have passed are omitted, together
+    /// with their descendants.
+    ///
+    /// Every node, including the root node, contains a property
+    /// SgfcPropertyType::C with the statistics of the node: The number of
+    /// games that passed through the node, and how many of them were won by
+    /// Black, won by White, or ended in a draw. The winning percentages are
+    /// relative to the total number of games.
+    virtual std::shared_ptr<ISgfcDocument> CreateDocument() const = 0;
+  };
+}
@@ -0,0 +1,112 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "SgfcBoardSize.h"
+#include "SgfcColor.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <memory>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The ISgfcGoPosition interface represents a position in a Go game,
+  /// i.e. the stones that are on the Go board at a given point in the game,
+  /// plus the number of stones that have been captured so far.
+  ///
+  /// @ingroup public-api
+  /// @ingroup go
+  ///
+  /// All methods that take a position on the board expect 1-based x-axis and
+  /// y-axis positions in the coordinate system
+  /// SgfcCoordinateSystem::UpperLeftOrigin. This is the same coordinate system
+  /// that ISgfcGoPoint uses.
+  ///
+  /// ISgfcGoPosition objects are immutable snapshots, they do not change when
+  /// the ISgfcGoReplayEngine object that created them continues to replay.
+  ///
+  /// @see ISgfcGoReplayEngine
+  class SGFCPLUSPLUS_EXPORT ISgfcGoPosition
+  {
+  public:
+    /// @brief Initializes a newly constructed ISgfcGoPosition object.
+    ISgfcGoPosition();
+
+    /// @brief Destroys and cleans up the ISgfcGoPosition object.
+    virtual ~ISgfcGoPosition();
+
+    /// @brief Returns the size of the Go board.
+    virtual SgfcBoardSize GetBoardSize() const = 0;
+
+    /// @brief Returns true if there is a stone on the intersection with the
+    /// specified position @a xPosition and @a yPosition. Returns false if the
+    /// intersection is empty.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a xPosition or
+    /// @a yPosition are outside of the board.
+    virtual bool HasStone(unsigned int xPosition, unsigned int yPosition) const = 0;
+
+    /// @brief Returns the color of the stone on the intersection with the
+    /// specified position @a xPosition and @a yPosition.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a xPosition or
+    /// @a yPosition are outside of the board, or if HasStone() returns false
+    /// for the intersection.
+    virtual SgfcColor GetStoneColor(unsigned int xPosition, unsigned int yPosition) const = 0;
+
+    /// @brief Returns the number of stones with color @a color that are on
+    /// the board.
+    virtual unsigned int GetNumberOfStones(SgfcColor color) const = 0;
+
+    /// @brief Returns the number of stones with color @a color that have been
+    /// captured so far. Stones that were removed from the board by a suicide
+    /// move are included in this number.
+    virtual unsigned int GetNumberOfCapturedStones(SgfcColor color) const = 0;
+
+    /// @brief Returns true if the stones on the board are the same for the
+    /// current ISgfcGoPosition object and for @a other. The number of
+    /// captured stones is not considered. Returns false if any stones are
+    /// different, or if the two positions have different board sizes.
+    virtual bool IsSameBoard(const ISgfcGoPosition& other) const = 0;
+
+    /// @brief Returns the Zobrist hash of the stones on the board and of the
+    /// board size. The number of captured stones is not considered.
+    ///
+    /// The hash is maintained incrementally while moves are replayed, so this
+    /// method is cheap. The random keys on which the hash is based are
+    /// generated from a fixed seed, so the hash of a given position is the
+    /// same across processes and platforms and can be persisted.
+    virtual std::uint64_t GetZobristHash() const = 0;
+
+    /// @brief Returns the Zobrist hash of the canonical form of the position,
+    /// i.e. the smallest hash over all board symmetries. Positions that are
+    /// rotations or reflections of each other have the same canonical hash.
+    ///
+    /// A square board has 8 symmetries (4 rotations, each of them optionally
+    /// mirrored). A rectangular board has 4 symmetries (identity, horizontal
+    /// reflection, vertical reflection, 180 degree rotation).
+    ///
+    /// Unlike GetZobristHash() this method computes the hash on demand, at a
+    /// cost proportional to the number of stones on the board.
+    virtual std::uint64_t GetCanonicalZobristHash() const = 0;
+  };
+}
@@ -0,0 +1,93 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "SgfcGoPositionIndexEntry.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcGoPosition;
+
+  /// @brief The ISgfcGoPositionIndex interface provides functions to query an
+  /// on-disk index, written by ISgfcGoPositionIndexWriter, for the nodes at
+  /// which a Go position occurs. Use SgfcPlusPlusFactory to construct new
+  /// ISgfcGoPositionIndex objects.
+  ///
+  /// @ingroup public-api
+  /// @ingroup go
+  ///
+  /// Only the index header and the table of SGF file paths are loaded into
+  /// memory. The entries are located with a binary search directly in the
+  /// index file, so a query reads only a few dozen small blocks of data,
+  /// regardless of the size of the index.
+  ///
+  /// The functions of ISgfcGoPositionIndex may be invoked concurrently from
+  /// multiple threads.
+  class SGFCPLUSPLUS_EXPORT ISgfcGoPositionIndex
+  {
+  public:
+    /// @brief Initializes a newly constructed ISgfcGoPositionIndex object.
+    ISgfcGoPositionIndex();
+
+    /// @brief Destroys and cleans up the ISgfcGoPositionIndex object.
+    virtual ~ISgfcGoPositionIndex();
+
+    /// @brief Returns true if the index is keyed by canonical Zobrist hashes.
+    /// Returns false if the index is keyed by plain Zobrist hashes.
+    virtual bool IsCanonical() const = 0;
+
+    /// @brief Returns the number of entries in the index.
+    virtual std::size_t GetNumberOfEntries() const = 0;
+
+    /// @brief Returns the paths of the SGF files that were indexed, in the
+    /// order in which they were indexed.
+    virtual std::vector<std::string> GetFilePaths() const = 0;
+
+    /// @brief Returns the entries whose key is @a hash. Returns an empty
+    /// collection if the index contains no such entries. The entries are
+    /// ordered by file, then by game, then in the order in which the nodes
+    /// were visited when the index was built.
+    ///
+    /// @a hash must be a value returned by ISgfcGoPosition::GetZobristHash()
+    /// if IsCanonical() returns false, or a value returned by
+    /// ISgfcGoPosition::GetCanonicalZobristHash() if IsCanonical() returns
+    /// true.
+    ///
+    /// @exception std::runtime_error Is thrown if reading from the index file
+    /// fails.
+    virtual std::vector<SgfcGoPositionIndexEntry> FindPositions(std::uint64_t hash) const = 0;
+
+    /// @brief Returns the entries for the position @a goPosition. This is a
+    /// convenience function that obtains the hash of @a goPosition that
+    /// matches IsCanonical(), then invokes FindPositions(std::uint64_t).
+    ///
+    /// @exception std::runtime_error Is thrown if reading from the index file
+    /// fails.
+    virtual std::vector<SgfcGoPositionIndexEntry> FindPositions(const ISgfcGoPosition& goPosition) const = 0;
+  };
+}
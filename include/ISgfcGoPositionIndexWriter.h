@@ -0,0 +1,91 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <string>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The ISgfcGoPositionIndexWriter interface provides functions to
+  /// build an on-disk index that maps Go positions to the nodes at which they
+  /// occur in a corpus of SGF files. Use SgfcPlusPlusFactory to construct new
+  /// ISgfcGoPositionIndexWriter objects. Use ISgfcGoPositionIndex to query the
+  /// index.
+  ///
+  /// @ingroup public-api
+  /// @ingroup go
+  ///
+  /// Every Go game in the corpus is replayed with ISgfcGoReplayEngine, along
+  /// every variation of the game tree. For every node at which at least one
+  /// stone is on the board, an entry is added to the index. The entry is
+  /// keyed by the Zobrist hash of the position (ISgfcGoPosition::GetZobristHash())
+  /// or, if canonical hashes are enabled, by the canonical Zobrist hash
+  /// (ISgfcGoPosition::GetCanonicalZobristHash()). Illegal moves are not
+  /// played, but the replay continues with the next node. Games that are not
+  /// Go games, and SGF files that cannot be read, are skipped.
+  ///
+  /// The SGF files are processed in parallel by a pool of worker threads.
+  /// Note that SGFC, which the library uses to read SGF files, processes only
+  /// one SGF file at a time, so parsing is serialized. Replaying and hashing
+  /// the games, which is usually the larger part of the work, is done in
+  /// parallel.
+  class SGFCPLUSPLUS_EXPORT ISgfcGoPositionIndexWriter
+  {
+  public:
+    /// @brief Initializes a newly constructed ISgfcGoPositionIndexWriter
+    /// object.
+    ISgfcGoPositionIndexWriter();
+
+    /// @brief Destroys and cleans up the ISgfcGoPositionIndexWriter object.
+    virtual ~ISgfcGoPositionIndexWriter();
+
+    /// @brief Returns true if the index is keyed by canonical Zobrist hashes,
+    /// i.e. if positions that are equal except for a rotation or reflection of
+    /// the board are treated as the same position. The default is false.
+    virtual bool GetUseCanonicalHashes() const = 0;
+
+    /// @brief Sets whether the index is keyed by canonical Zobrist hashes.
+    virtual void SetUseCanonicalHashes(bool useCanonicalHashes) = 0;
+
+    /// @brief Returns the number of worker threads that are used to build the
+    /// index. The value 0 means that the number of threads is determined by
+    /// the number of concurrent threads supported by the hardware. The default
+    /// is 0.
+    virtual unsigned int GetNumberOfThreads() const = 0;
+
+    /// @brief Sets the number of worker threads that are used to build the
+    /// index.
+    virtual void SetNumberOfThreads(unsigned int numberOfThreads) = 0;
+
+    /// @brief Builds an index over all files with the extension ".sgf" that
+    /// are located in the directory @a sgfDirectoryPath or in one of its
+    /// subdirectories, and writes the index to the file @a indexFilePath.
+    /// An existing file is overwritten. Returns the number of entries in the
+    /// index.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a sgfDirectoryPath does
+    /// not refer to a directory.
+    /// @exception std::runtime_error Is thrown if @a indexFilePath cannot be
+    /// opened for writing.
+    virtual std::size_t WriteIndex(const std::string& sgfDirectoryPath, const std::string& indexFilePath) const = 0;
+  };
+}
@@ -0,0 +1,131 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "SgfcBoardSize.h"
+#include "SgfcGoMoveLegality.h"
+#include "SgfcGoReplayResult.h"
+#include "SgfcGoRuleset.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <memory>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcGoMove;
+  class ISgfcGoPosition;
+  class ISgfcNode;
+
+  /// @brief The ISgfcGoReplayEngine interface provides functions to replay
+  /// the moves and setup stones of a Go game on a Go board, and to check the
+  /// moves for legality. Use SgfcPlusPlusFactory to construct new
+  /// ISgfcGoReplayEngine objects.
+  ///
+  /// @ingroup public-api
+  /// @ingroup go
+  ///
+  /// ISgfcGoReplayEngine maintains a current position that starts out as an
+  /// empty board. Applying a node to the current position first applies the
+  /// setup properties SgfcPropertyType::AB, SgfcPropertyType::AW and
+  /// SgfcPropertyType::AE, then the move properties SgfcPropertyType::B and
+  /// SgfcPropertyType::W. Moves capture opponent stones that are left without
+  /// liberties.
+  ///
+  /// The legality of moves is checked according to the ruleset that the
+  /// ISgfcGoReplayEngine object was created with:
+  /// - SgfcGoRulesetType::AGA: Suicide is illegal. Ko is checked with
+  ///   situational superko.
+  /// - SgfcGoRulesetType::Ing: Suicide is legal. Ko is checked with the basic
+  ///   ko rule.
+  /// - SgfcGoRulesetType::Japanese: Suicide is illegal. Ko is checked with the
+  ///   basic ko rule.
+  /// - SgfcGoRulesetType::NZ: Suicide is legal. Ko is checked with situational
+  ///   superko.
+  /// - An invalid ruleset (SgfcGoRuleset::IsValid is false) is treated like
+  ///   SgfcGoRulesetType::Japanese.
+  ///
+  /// An illegal move is not played, i.e. the current position is left as it
+  /// was before the move was attempted.
+  ///
+  /// Positions are stored as bitboards, one bit per intersection and color.
+  /// All board sizes allowed by the SGF standard for Go (up to 52x52) are
+  /// supported.
+  class SGFCPLUSPLUS_EXPORT ISgfcGoReplayEngine
+  {
+  public:
+    /// @brief Initializes a newly constructed ISgfcGoReplayEngine object.
+    ISgfcGoReplayEngine();
+
+    /// @brief Destroys and cleans up the ISgfcGoReplayEngine object.
+    virtual ~ISgfcGoReplayEngine();
+
+    /// @brief Returns the size of the board on which moves are replayed.
+    virtual SgfcBoardSize GetBoardSize() const = 0;
+
+    /// @brief Returns the ruleset according to which moves are checked for
+    /// legality.
+    virtual SgfcGoRuleset GetGoRuleset() const = 0;
+
+    /// @brief Resets the current position to an empty board and discards the
+    /// history of previous positions.
+    virtual void Reset() = 0;
+
+    /// @brief Applies the setup properties and the move properties of
+    /// @a node to the current position. Returns the legality of the move
+    /// found in @a node. Returns SgfcGoMoveLegality::Legal if @a node contains
+    /// no move.
+    ///
+    /// If @a node contains an illegal move, the setup properties are applied
+    /// but the move is not played.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a node is @e nullptr.
+    virtual SgfcGoMoveLegality ApplyNode(std::shared_ptr<ISgfcNode> node) = 0;
+
+    /// @brief Plays @a goMove on the current position. Returns the legality
+    /// of the move. The move is not played if it is illegal.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a goMove is @e nullptr,
+    /// or if the move's stone location is outside of the board.
+    virtual SgfcGoMoveLegality ApplyGoMove(std::shared_ptr<ISgfcGoMove> goMove) = 0;
+
+    /// @brief Resets the current position, then applies the nodes in
+    /// @a nodes in the order in which they appear in the collection. Stops at
+    /// the first node that contains an illegal move. Returns an object that
+    /// describes the outcome of the replay.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a nodes contains a
+    /// @e nullptr element.
+    virtual SgfcGoReplayResult ReplayNodes(const std::vector<std::shared_ptr<ISgfcNode>>& nodes) = 0;
+
+    /// @brief Resets the current position, then applies the nodes on the path
+    /// from the root node of the game tree down to and including @a node.
+    /// Stops at the first node that contains an illegal move. Returns an
+    /// object that describes the outcome of the replay.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a node is @e nullptr.
+    virtual SgfcGoReplayResult ReplayToNode(std::shared_ptr<ISgfcNode> node) = 0;
+
+    /// @brief Returns a snapshot of the current position.
+    virtual std::shared_ptr<ISgfcGoPosition> GetPosition() const = 0;
+  };
+}
@@ -0,0 +1,104 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "ISgfcDocumentReader.h"
+#include "SgfcDocumentCacheKeyType.h"
+#include "SgfcDocumentCacheStatistics.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <cstdint>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The ISgfcMemoryCachingDocumentReader interface extends
+  /// ISgfcDocumentReader with an in-memory cache of read results. Use
+  /// SgfcPlusPlusFactory to construct new ISgfcMemoryCachingDocumentReader
+  /// objects.
+  ///
+  /// @ingroup public-api
+  /// @ingroup sgfc-frontend
+  /// @ingroup document
+  ///
+  /// ISgfcMemoryCachingDocumentReader delegates read operations to another
+  /// ISgfcDocumentReader, e.g. an ISgfcCachingDocumentReader, and keeps the
+  /// read results in memory. When the same SGF data is read again the read
+  /// result from the cache is returned. A read result is identified by the
+  /// SGF data (see SgfcDocumentCacheKeyType) together with the arguments that
+  /// GetArguments() returns at the time of the read operation.
+  ///
+  /// @attention The read results in the cache are shared by all callers.
+  /// Clients must not modify the document of a read result returned by
+  /// ISgfcMemoryCachingDocumentReader.
+  ///
+  /// The cache holds as many read results as fit into a configurable amount
+  /// of memory. The memory usage of a read result is estimated when the read
+  /// result is added to the cache. When the cache is full, the least
+  /// recently used read results are removed from the cache. Read results
+  /// whose exit code is SgfcExitCode::FatalError are not cached.
+  ///
+  /// All methods of ISgfcMemoryCachingDocumentReader can be invoked
+  /// concurrently from multiple threads, except that the arguments returned
+  /// by GetArguments() must not be changed while a read operation is in
+  /// progress. If several threads read the same SGF data at the same time
+  /// and there is no read result in the cache yet, only one thread reads the
+  /// SGF data and the other threads wait for its read result.
+  class SGFCPLUSPLUS_EXPORT ISgfcMemoryCachingDocumentReader : public ISgfcDocumentReader
+  {
+  public:
+    /// @brief Initializes a newly constructed ISgfcMemoryCachingDocumentReader
+    /// object.
+    ISgfcMemoryCachingDocumentReader();
+
+    /// @brief Destroys and cleans up the ISgfcMemoryCachingDocumentReader
+    /// object.
+    virtual ~ISgfcMemoryCachingDocumentReader();
+
+    /// @brief Returns how ReadSgfFile() identifies SGF files in the cache. The
+    /// default is #SgfcDocumentCacheKeyType::FileMetadata.
+    ///
+    /// ReadSgfContent() always identifies SGF data by a hash of its content.
+    virtual SgfcDocumentCacheKeyType GetCacheKeyType() const = 0;
+
+    /// @brief Sets how ReadSgfFile() identifies SGF files in the cache.
+    virtual void SetCacheKeyType(SgfcDocumentCacheKeyType cacheKeyType) = 0;
+
+    /// @brief Returns the maximum number of bytes of memory that the read
+    /// results in the cache may occupy together. The default is 64 MiB.
+    virtual std::uint64_t GetMaximumMemoryUsage() const = 0;
+
+    /// @brief Sets the maximum number of bytes of memory that the read
+    /// results in the cache may occupy together. If the cache currently
+    /// occupies more memory, the least recently used read results are
+    /// removed from the cache immediately.
+    virtual void SetMaximumMemoryUsage(std::uint64_t maximumMemoryUsage) = 0;
+
+    /// @brief Returns the current values of the cache counters.
+    virtual SgfcDocumentCacheStatistics GetStatistics() const = 0;
+
+    /// @brief Resets the counters that count events (hits, misses, coalesced
+    /// reads and evictions) to 0.
+    virtual void ResetStatistics() = 0;
+
+    /// @brief Removes all read results from the cache.
+    virtual void ClearCache() = 0;
+  };
+}
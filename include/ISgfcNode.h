@@ -25,6 +25,7 @@
 #include "SgfcPlusPlusExport.h"
 
 // C++ Standard Library includes
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -327,10 +328,20 @@ namespace LibSgfcPlusPlus
     /// @brief Removes all properties from the node's collection of properties.
     virtual void RemoveAllProperties() = 0;
 
+    /// @brief Returns true if the node has a property with the specified type
+    /// @a propertyType. Returns false if the node has no such property.
+    ///
+    /// This is a constant-time operation. It is the preferred way to check
+    /// for the existence of a property when the property object itself is not
+    /// needed.
+    virtual bool HasProperty(SgfcPropertyType propertyType) const = 0;
+
     /// @brief Returns the property with the specified type @a propertyType if
     /// the node has such a property. Returns @e nullptr if the node has no
     /// such property.
     ///
+    /// This is a constant-time operation.
+    ///
     /// If @a propertyType is SgfcPropertyType::Unknown and the node has several
     /// such properties, returns the property that appears first in the list
     /// that is returned by GetProperties().
@@ -343,6 +354,11 @@ namespace LibSgfcPlusPlus
     /// the node has such a property. Returns @e nullptr if the node has no
     /// such property.
     ///
+    /// If @a propertyName is the name of a property defined in the SGF
+    /// standard the lookup is a constant-time operation (apart from mapping
+    /// the name to an SgfcPropertyType). Otherwise the node's properties are
+    /// searched linearly.
+    ///
     /// The SGF standard defines that only one of each property is allowed per
     /// node.
     virtual std::shared_ptr<ISgfcProperty> GetProperty(const std::string& propertyName) const = 0;
@@ -383,5 +399,41 @@ namespace LibSgfcPlusPlus
     /// interpretation of the property value to the library client.
     virtual std::vector<std::shared_ptr<ISgfcProperty>> GetInheritedProperties() const = 0;
     //@}
+
+    /// @name Content comparison
+    //@{
+    /// @brief Returns a hash of the content of the subtree that starts with
+    /// the node. Two subtrees with the same content have the same hash.
+    ///
+    /// The hash is a Merkle hash: It is computed from a hash of the node's
+    /// properties and from the hashes of the node's child nodes, in the order
+    /// in which the child nodes appear in the game tree. The properties are
+    /// hashed in the order of their names, because the SGF standard does not
+    /// define an order of properties within a node (see GetProperties()).
+    /// Property values are hashed in the order in which they appear in the
+    /// property, using their raw values.
+    ///
+    /// The hash of each node is cached, so the first invocation costs O(n)
+    /// where n is the number of nodes in the subtree, but subsequent
+    /// invocations cost O(1) until the subtree is modified. A modification
+    /// only discards the cached hashes of the modified node and of its
+    /// ancestors. Hashes do not depend on the platform, but they may change
+    /// between different versions of the library.
+    ///
+    /// As with any hash, different content can in rare cases have the same
+    /// hash.
+    ///
+    /// This method may be invoked concurrently by several threads, also on
+    /// nodes of the same game tree, as long as no thread modifies the game
+    /// tree at the same time.
+    ///
+    /// @attention A modification is detected only if it is made via the
+    /// ISgfcNode property setters or via ISgfcTreeBuilder. If a library
+    /// client changes an ISgfcProperty object, or one of its values, after
+    /// the property was added to a node, the library client must add the
+    /// property to the node again, e.g. with SetProperty(), to discard the
+    /// cached hash.
+    virtual std::uint64_t GetContentHash() const = 0;
+    //@}
   };
 }
@@ -0,0 +1,109 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "ISgfcPropertyValue.h"
+#include "SgfcBoardSize.h"
+#include "SgfcGameType.h"
+#include "SgfcPropertyType.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The ISgfcParseEventHandler interface receives the events that
+  /// ISgfcParseEventReader generates while it reads SGF data. Library clients
+  /// implement this interface and pass an instance to ISgfcParseEventReader.
+  ///
+  /// @ingroup public-api
+  /// @ingroup sgfc-frontend
+  ///
+  /// The events describe the SGF data in the order in which it appears in the
+  /// SGF data (depth-first, pre-order):
+  /// - Each game tree is enclosed by BeginGame() and EndGame().
+  /// - Each node is enclosed by BeginNode() and EndNode(). Property() is
+  ///   invoked once for every property of the node, between BeginNode() and
+  ///   EndNode().
+  /// - The nodes that follow a node are its children. If a node has only one
+  ///   child, the child's events immediately follow the node's EndNode().
+  ///   If a node has more than one child, the events of each child and its
+  ///   descendants are enclosed by BeginVariation() and EndVariation().
+  ///
+  /// Example: The SGF data "(;GM[1](;B[aa];W[bb])(;B[cc]))" generates the
+  /// following events: BeginGame, BeginNode, Property (GM), EndNode,
+  /// BeginVariation, BeginNode, Property (B), EndNode, BeginNode, Property
+  /// (W), EndNode, EndVariation, BeginVariation, BeginNode, Property (B),
+  /// EndNode, EndVariation, EndGame.
+  ///
+  /// The default implementations of all methods do nothing, so a subclass
+  /// only needs to override the methods for the events it is interested in.
+  class SGFCPLUSPLUS_EXPORT ISgfcParseEventHandler
+  {
+  public:
+    /// @brief Initializes a newly constructed ISgfcParseEventHandler object.
+    ISgfcParseEventHandler();
+
+    /// @brief Destroys and cleans up the ISgfcParseEventHandler object.
+    virtual ~ISgfcParseEventHandler();
+
+    /// @brief Is invoked when a game tree begins. @a gameType and
+    /// @a boardSize are the values that ISgfcGame::GetGameType() and
+    /// ISgfcGame::GetBoardSize() would return for the game.
+    virtual void BeginGame(SgfcGameType gameType, SgfcBoardSize boardSize);
+
+    /// @brief Is invoked when a game tree ends.
+    virtual void EndGame();
+
+    /// @brief Is invoked when a variation begins, i.e. before the events of
+    /// a node that has at least one sibling.
+    virtual void BeginVariation();
+
+    /// @brief Is invoked when a variation ends, i.e. after the events of the
+    /// last descendant of a node that has at least one sibling.
+    virtual void EndVariation();
+
+    /// @brief Is invoked when a node begins.
+    virtual void BeginNode();
+
+    /// @brief Is invoked when a node ends. The events of the node's children
+    /// follow after this event.
+    virtual void EndNode();
+
+    /// @brief Is invoked for each property of the current node.
+    ///
+    /// @a propertyType is SgfcPropertyType::Unknown if the property is not
+    /// defined in the SGF standard, in which case @a propertyName is the only
+    /// way to identify the property. @a propertyValues holds the values that
+    /// the corresponding ISgfcProperty object would hold if the SGF data were
+    /// read by ISgfcDocumentReader. Each value provides both the decoded value
+    /// and the raw value.
+    ///
+    /// The objects in @a propertyValues are not retained by
+    /// ISgfcParseEventReader after this method returns.
+    virtual void Property(
+      SgfcPropertyType propertyType,
+      const std::string& propertyName,
+      const std::vector<std::shared_ptr<ISgfcPropertyValue>>& propertyValues);
+  };
+}
@@ -0,0 +1,112 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "ISgfcDocumentReadResult.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <memory>
+#include <string>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcArguments;
+  class ISgfcParseEventHandler;
+
+  /// @brief The ISgfcParseEventReader interface provides functions to read
+  /// SGF data from the filesystem or from in-memory data and to report the
+  /// content to an ISgfcParseEventHandler, without building a document object
+  /// tree. Use SgfcPlusPlusFactory to construct new ISgfcParseEventReader
+  /// objects.
+  ///
+  /// @ingroup public-api
+  /// @ingroup sgfc-frontend
+  ///
+  /// ISgfcParseEventReader operates the SGFC backend in the same way as
+  /// ISgfcDocumentReader, but instead of creating ISgfcNode and ISgfcProperty
+  /// objects it walks SGFC's data structures and invokes the event handler for
+  /// each game, variation, node and property. Apart from the SGFC data
+  /// structures, the memory required by a read operation grows with the depth
+  /// of the game tree, not with the number of nodes. This makes
+  /// ISgfcParseEventReader suitable for tasks that only need to look at the
+  /// SGF data once, e.g. counting moves or extracting comments.
+  ///
+  /// Exceptions thrown by the event handler abort the read operation and are
+  /// passed through to the caller.
+  ///
+  /// ISgfcParseEventReader reports the CA property value "UTF-8" in the root
+  /// node of each game, like ISgfcDocumentReader writes it into the document
+  /// object tree. Read the ISgfcDocumentReader class documentation for
+  /// details about encodings.
+  class SGFCPLUSPLUS_EXPORT ISgfcParseEventReader
+  {
+  public:
+    /// @brief Initializes a newly constructed ISgfcParseEventReader object.
+    ISgfcParseEventReader();
+
+    /// @brief Destroys and cleans up the ISgfcParseEventReader object.
+    virtual ~ISgfcParseEventReader();
+
+    /// @brief Returns an object with the collection of arguments that
+    /// ISgfcParseEventReader passes on to SGFC whenever it performs a read
+    /// operation.
+    ///
+    /// The collection of arguments is initially empty. Add arguments to the
+    /// collection to change the way how SGFC reads SGF content. The collection
+    /// retains its state between read operations so that repeated read
+    /// operations use the same arguments.
+    virtual std::shared_ptr<ISgfcArguments> GetArguments() const = 0;
+
+    /// @brief Reads SGF data from a single .sgf file located at the specified
+    /// path, puts the data through the SGFC parser, using the arguments that
+    /// GetArguments() currently returns, and reports the content to
+    /// @a eventHandler.
+    ///
+    /// @return An ISgfcDocumentReadResult object that provides the result of
+    /// the read operation. The document of the read result is always empty.
+    /// If an error occurs while the events are generated, the read result
+    /// contains a message that describes the error, and @a eventHandler has
+    /// received only part of the events.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a eventHandler is
+    /// @e nullptr.
+    virtual std::shared_ptr<ISgfcDocumentReadResult> ReadSgfFile(
+      const std::string& sgfFilePath,
+      std::shared_ptr<ISgfcParseEventHandler> eventHandler) const = 0;
+
+    /// @brief Reads SGF data from the specified string, puts the data
+    /// through the SGFC parser, using the arguments that GetArguments()
+    /// currently returns, and reports the content to @a eventHandler.
+    ///
+    /// @return An ISgfcDocumentReadResult object that provides the result of
+    /// the read operation. The document of the read result is always empty.
+    /// If an error occurs while the events are generated, the read result
+    /// contains a message that describes the error, and @a eventHandler has
+    /// received only part of the events.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a eventHandler is
+    /// @e nullptr.
+    virtual std::shared_ptr<ISgfcDocumentReadResult> ReadSgfContent(
+      const std::string& sgfContent,
+      std::shared_ptr<ISgfcParseEventHandler> eventHandler) const = 0;
+  };
+}
@@ -0,0 +1,52 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <memory>
+#include <string>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcDocumentReadResult;
+
+  /// @brief The SgfcArchiveEntryReadResult struct is a simple type that holds
+  /// the outcome of reading a single archive member with ISgfcArchiveReader.
+  ///
+  /// @ingroup public-api
+  /// @ingroup sgfc-frontend
+  ///
+  /// @see ISgfcArchiveReader
+  struct SGFCPLUSPLUS_EXPORT SgfcArchiveEntryReadResult
+  {
+  public:
+    /// @brief The name of the archive member, i.e. the path of the member
+    /// inside the archive as it is stored in the archive. The default is an
+    /// empty string.
+    std::string MemberName;
+
+    /// @brief The result of reading the content of the archive member with
+    /// ISgfcDocumentReader. If the archive member could not be extracted,
+    /// e.g. because it is encrypted, the read result has a single fatal
+    /// error message and an empty document. The default is @e nullptr.
+    std::shared_ptr<ISgfcDocumentReadResult> DocumentReadResult;
+  };
+}
@@ -0,0 +1,74 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <cstddef>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcBatchReadOptions struct is a simple type that holds
+  /// options that control how ISgfcBatchDocumentReader distributes the files
+  /// of a batch over its worker threads, and how it hands out the results.
+  ///
+  /// @ingroup public-api
+  /// @ingroup sgfc-frontend
+  ///
+  /// @see ISgfcBatchDocumentReader::SetBatchReadOptions()
+  struct SGFCPLUSPLUS_EXPORT SgfcBatchReadOptions
+  {
+  public:
+    /// @brief The number of worker threads that read the files of a batch.
+    /// The value 0 means that the number of threads is determined by the
+    /// number of concurrent threads supported by the hardware. The number
+    /// of threads never exceeds the number of files in the batch. The
+    /// default is 0.
+    ///
+    /// SGFC cannot parse concurrently because it keeps its state in global
+    /// variables, so the worker threads take turns while SGFC parses a
+    /// file. Reading and decompressing the files, and building the document
+    /// object trees, takes place in parallel.
+    unsigned int NumberOfThreads = 0;
+
+    /// @brief If true, the results are handed out in the order in which the
+    /// files appear in the batch. If false, the results are handed out in
+    /// the order in which the files finish reading. The default is false.
+    bool IsResultOrderPreserved = false;
+
+    /// @brief If true, the files of a batch are read in the order of
+    /// descending file size, so that a large file that is read last does not
+    /// keep a single worker thread busy while the other worker threads are
+    /// idle. If false, the files are read in the order in which they appear
+    /// in the batch. The default is true.
+    ///
+    /// If IsResultOrderPreserved is true, files are reordered only within
+    /// consecutive groups of MaximumNumberOfPendingResults files, so that
+    /// the results that wait to be handed out never exceed the limit.
+    bool IsLargestFileReadFirst = true;
+
+    /// @brief The maximum number of files that are being read or whose
+    /// results are waiting to be handed out. When the limit is reached, the
+    /// worker threads wait until the library client takes a result. This
+    /// bounds the amount of memory that a batch occupies if the library
+    /// client processes results more slowly than they are read. A value of
+    /// 0 has the same effect as 1. The default is 64.
+    std::size_t MaximumNumberOfPendingResults = 64;
+  };
+}
@@ -0,0 +1,47 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcBatchWriteOptions struct is a simple type that holds
+  /// options that control how ISgfcBatchDocumentWriter distributes the
+  /// documents of a batch over its worker threads.
+  ///
+  /// @ingroup public-api
+  /// @ingroup sgfc-frontend
+  ///
+  /// @see ISgfcBatchDocumentWriter::SetBatchWriteOptions()
+  struct SGFCPLUSPLUS_EXPORT SgfcBatchWriteOptions
+  {
+  public:
+    /// @brief The number of worker threads that write the documents of a
+    /// batch. The value 0 means that the number of threads is determined by
+    /// the number of concurrent threads supported by the hardware. The
+    /// number of threads never exceeds the number of documents in the batch.
+    /// The default is 0.
+    ///
+    /// SGFC cannot validate concurrently because it keeps its state in
+    /// global variables, so the worker threads take turns while SGFC
+    /// validates a document. Encoding the documents, and writing and
+    /// compressing the files, takes place in parallel.
+    unsigned int NumberOfThreads = 0;
+  };
+}
@@ -0,0 +1,55 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcDocumentWriteResult;
+
+  /// @brief The SgfcBatchWriteResult struct is a simple type that holds the
+  /// outcome of writing a single document of a batch with
+  /// ISgfcBatchDocumentWriter.
+  ///
+  /// @ingroup public-api
+  /// @ingroup sgfc-frontend
+  ///
+  /// @see ISgfcBatchDocumentWriter
+  struct SGFCPLUSPLUS_EXPORT SgfcBatchWriteResult
+  {
+  public:
+    /// @brief The index of the document in the list of documents that was
+    /// passed to ISgfcBatchDocumentWriter::WriteSgfFiles(). The default is
+    /// 0.
+    std::size_t FileIndex = 0;
+
+    /// @brief The path of the file that was written. The default is an
+    /// empty string.
+    std::string SgfFilePath;
+
+    /// @brief The result of writing the file. The default is @e nullptr.
+    std::shared_ptr<ISgfcDocumentWriteResult> DocumentWriteResult;
+  };
+}
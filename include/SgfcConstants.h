@@ -29,6 +29,7 @@
 #include "SgfcPlusPlusExport.h"
 
 // C++ Standard Library includes
+#include <cstddef>
 #include <map>
 #include <string>
 
@@ -218,6 +219,14 @@ namespace LibSgfcPlusPlus
     /// SgfcPropertyType::KM (a Go specific property).
     static const SgfcReal KomiNone;
 
+    /// @brief The default number of nodes between two replay checkpoints that
+    /// ISgfcGame::GetGoPosition() stores along a path in the game tree.
+    static const std::size_t GoPositionCheckpointIntervalDefault;
+
+    /// @brief The default maximum number of replay checkpoints that
+    /// ISgfcGame::GetGoPosition() stores per game.
+    static const std::size_t GoPositionMaximumNumberOfCheckpointsDefault;
+
     /// @brief An SgfcNodeTraits value that denotes a node that has no traits.
     static const SgfcNodeTraits NodeTraitsNone;
 
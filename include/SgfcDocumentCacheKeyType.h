@@ -0,0 +1,44 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief SgfcDocumentCacheKeyType enumerates the ways how
+  /// ISgfcCachingDocumentReader and ISgfcMemoryCachingDocumentReader can
+  /// identify an SGF file in their cache.
+  ///
+  /// @ingroup public-api
+  /// @ingroup document
+  enum class SGFCPLUSPLUS_EXPORT SgfcDocumentCacheKeyType
+  {
+    /// @brief The SGF file is identified by a hash of its content. The file
+    /// must be read completely to look it up in the cache, but changes to
+    /// the file are always detected, and copies of the same file share a
+    /// single cache entry.
+    FileContent,
+
+    /// @brief The SGF file is identified by its path, its size and the time
+    /// of its last modification. The file does not need to be read to look
+    /// it up in the cache, but changes to the file that preserve both its
+    /// size and its modification time go unnoticed.
+    FileMetadata,
+  };
+}
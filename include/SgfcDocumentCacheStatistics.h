@@ -0,0 +1,64 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <cstdint>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcDocumentCacheStatistics struct is a simple type that holds
+  /// the counters of an ISgfcMemoryCachingDocumentReader.
+  ///
+  /// @ingroup public-api
+  /// @ingroup document
+  ///
+  /// @see ISgfcMemoryCachingDocumentReader
+  struct SGFCPLUSPLUS_EXPORT SgfcDocumentCacheStatistics
+  {
+  public:
+    /// @brief The number of read operations that were satisfied by a read
+    /// result in the cache. The default is 0.
+    std::uint64_t NumberOfHits = 0;
+
+    /// @brief The number of read operations that found no read result in the
+    /// cache and therefore had to read the SGF data. The default is 0.
+    std::uint64_t NumberOfMisses = 0;
+
+    /// @brief The number of read operations that found no read result in the
+    /// cache but did not have to read the SGF data because another thread
+    /// was already reading the same SGF data. These read operations waited
+    /// for the other thread and then shared its read result. The default is
+    /// 0.
+    std::uint64_t NumberOfCoalescedReads = 0;
+
+    /// @brief The number of read results that were removed from the cache to
+    /// keep the memory usage within the configured maximum. The default is 0.
+    std::uint64_t NumberOfEvictions = 0;
+
+    /// @brief The number of read results that are currently in the cache.
+    /// The default is 0.
+    std::uint64_t NumberOfReadResults = 0;
+
+    /// @brief The estimated number of bytes of memory that the read results
+    /// currently in the cache occupy. The default is 0.
+    std::uint64_t MemoryUsage = 0;
+  };
+}
@@ -0,0 +1,117 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "SgfcPropertyFilterMode.h"
+#include "SgfcPropertyType.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <limits>
+#include <set>
+#include <string>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcDocumentReadOptions struct is a simple type that holds
+  /// options that limit which parts of the game trees ISgfcDocumentReader
+  /// builds into the document object tree.
+  ///
+  /// @ingroup public-api
+  /// @ingroup sgfc-frontend
+  ///
+  /// The node options are applied to each game separately. The root node of
+  /// a game is always built. Nodes that are outside the window defined by the
+  /// options are not built at all, i.e. their properties are not decoded and
+  /// no ISgfcNode objects are created for them. If a read operation skips at
+  /// least one node, ISgfcDocumentReadResult::IsDocumentTruncated() returns
+  /// true.
+  ///
+  /// The property filter options are applied to all nodes that are built,
+  /// including root nodes. Properties that are filtered out are not decoded
+  /// and no ISgfcProperty objects are created for them. Filtering out
+  /// properties does not count as truncating the document. Note that
+  /// ISgfcGame obtains the game type and the board size from the root
+  /// node's GM and SZ properties, so a filter that drops these properties
+  /// changes what ISgfcGame reports.
+  ///
+  /// The options have no effect on SGFC, i.e. SGFC still parses and checks
+  /// the entire SGF content.
+  ///
+  /// @see ISgfcDocumentReader::SetReadOptions()
+  struct SGFCPLUSPLUS_EXPORT SgfcDocumentReadOptions
+  {
+  public:
+    /// @brief If true, only the main variation of each game is built, i.e.
+    /// the nodes reached from the root node by following the first child of
+    /// each node. The default is false.
+    bool IsMainVariationOnly = false;
+
+    /// @brief The maximum depth of the nodes that are built. The root node
+    /// has depth 0, its children have depth 1, etc. The default is the
+    /// maximum value of std::size_t, i.e. there is no limit.
+    std::size_t MaximumDepth = std::numeric_limits<std::size_t>::max();
+
+    /// @brief The maximum number of nodes that are built per game, including
+    /// the root node. Nodes are built in depth-first order, i.e. the main
+    /// variation is built first. A value of 0 has the same effect as 1. The
+    /// default is the maximum value of std::size_t, i.e. there is no limit.
+    std::size_t MaximumNumberOfNodes = std::numeric_limits<std::size_t>::max();
+
+    /// @brief Specifies how the properties listed in PropertyFilterTypes
+    /// and PropertyFilterNames are treated. The default is
+    /// SgfcPropertyFilterMode::KeepAllProperties, i.e. all properties are
+    /// built.
+    SgfcPropertyFilterMode PropertyFilterMode = SgfcPropertyFilterMode::KeepAllProperties;
+
+    /// @brief The property types that PropertyFilterMode applies to. Listing
+    /// SgfcPropertyType::Unknown matches all properties that are not defined
+    /// by the SGF standard, such as private properties of an application.
+    /// The default is an empty set.
+    std::set<SgfcPropertyType> PropertyFilterTypes;
+
+    /// @brief The property names that PropertyFilterMode applies to, e.g.
+    /// the names of individual private properties. A name matches a property
+    /// regardless of the property's type. The default is an empty set.
+    std::set<std::string> PropertyFilterNames;
+
+    /// @brief The number of worker threads that are used to build the games
+    /// of a document. The value 0 means that the number of threads is
+    /// determined by the number of concurrent threads supported by the
+    /// hardware. The default is 1, i.e. the games are built one after the
+    /// other on the thread that performs the read operation.
+    ///
+    /// The games are always built independently of each other, and the
+    /// document contains them in the order in which they appear in the SGF
+    /// content, regardless of the number of threads. If the document
+    /// contains fewer games than there are threads, the remaining threads
+    /// are used to decode the properties of the nodes within each game, so
+    /// a document that consists of a single large game also benefits. The
+    /// nodes are always linked to form the game tree on a single thread, in
+    /// the order in which they appear in the SGF content. SGFC itself parses the
+    /// entire SGF content before the games are built, so the line and
+    /// column numbers of the messages in the read result refer to the SGF
+    /// content as a whole. Only the construction of the document object
+    /// tree is parallelized; SGFC cannot parse concurrently because it keeps
+    /// its state in global variables.
+    unsigned int NumberOfThreads = 1;
+  };
+}
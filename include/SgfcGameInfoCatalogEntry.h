@@ -0,0 +1,94 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "SgfcDate.h"
+#include "SgfcGameResult.h"
+#include "SgfcTypedefs.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <string>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcGameInfoCatalogEntry struct is a simple type that holds
+  /// the game information of one game in a catalog read by
+  /// ISgfcGameInfoCatalog.
+  ///
+  /// @ingroup public-api
+  /// @ingroup game
+  ///
+  /// The members hold the values that ISgfcGameInfo and ISgfcGoGameInfo
+  /// return for the game when the catalog is built.
+  ///
+  /// @see ISgfcGameInfoCatalog
+  struct SGFCPLUSPLUS_EXPORT SgfcGameInfoCatalogEntry
+  {
+  public:
+    /// @brief The path of the SGF file that contains the game, as it was found
+    /// when the catalog was built. The default is an empty string.
+    std::string FilePath;
+
+    /// @brief The 0-based index of the game in the SGF file, i.e. the index
+    /// of the game in the collection returned by ISgfcDocument::GetGames().
+    /// The default is 0.
+    std::size_t GameIndex = 0;
+
+    /// @brief The value of ISgfcGameInfo::GetBlackPlayerName(). The default
+    /// is an empty string.
+    SgfcSimpleText BlackPlayerName;
+
+    /// @brief The value of ISgfcGameInfo::GetBlackPlayerRank(). The default
+    /// is an empty string.
+    SgfcSimpleText BlackPlayerRank;
+
+    /// @brief The value of ISgfcGameInfo::GetWhitePlayerName(). The default
+    /// is an empty string.
+    SgfcSimpleText WhitePlayerName;
+
+    /// @brief The value of ISgfcGameInfo::GetWhitePlayerRank(). The default
+    /// is an empty string.
+    SgfcSimpleText WhitePlayerRank;
+
+    /// @brief The earliest of the dates returned by
+    /// ISgfcGameInfo::GetGameDates(). The year part is 0 if the game has no
+    /// dates. The default is a date whose parts are all 0.
+    SgfcDate FirstGameDate;
+
+    /// @brief The latest of the dates returned by
+    /// ISgfcGameInfo::GetGameDates(). The year part is 0 if the game has no
+    /// dates. The default is a date whose parts are all 0.
+    SgfcDate LastGameDate;
+
+    /// @brief The value of ISgfcGameInfo::GetGameResult(). The default is an
+    /// invalid game result.
+    SgfcGameResult GameResult;
+
+    /// @brief The value of ISgfcGoGameInfo::GetKomi(). Is 0.0 if the game is
+    /// not a Go game. The default is 0.0.
+    SgfcReal Komi = 0.0;
+
+    /// @brief The value of ISgfcGameInfo::GetRulesName(). The default is an
+    /// empty string.
+    SgfcSimpleText RulesName;
+  };
+}
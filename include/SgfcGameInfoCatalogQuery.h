@@ -0,0 +1,105 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "SgfcDate.h"
+#include "SgfcGameResultType.h"
+#include "SgfcTypedefs.h"
+#include "SgfcWinType.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcGameInfoCatalogQuery struct is a simple type that holds
+  /// the criteria of a query made with ISgfcGameInfoCatalog::FindGames().
+  ///
+  /// @ingroup public-api
+  /// @ingroup game
+  ///
+  /// A game matches the query if it matches all criteria that are set. A
+  /// default-constructed SgfcGameInfoCatalogQuery object has no criteria set
+  /// and therefore matches all games. String criteria are matched exactly and
+  /// case sensitive.
+  ///
+  /// @see ISgfcGameInfoCatalog
+  struct SGFCPLUSPLUS_EXPORT SgfcGameInfoCatalogQuery
+  {
+  public:
+    /// @brief Matches games in which either Black or White has this name.
+    /// Is not used if empty. The default is an empty string.
+    SgfcSimpleText PlayerName;
+
+    /// @brief Matches games in which Black has this name. Is not used if
+    /// empty. The default is an empty string.
+    SgfcSimpleText BlackPlayerName;
+
+    /// @brief Matches games in which White has this name. Is not used if
+    /// empty. The default is an empty string.
+    SgfcSimpleText WhitePlayerName;
+
+    /// @brief Matches games that were played on or after this date. Is not
+    /// used if the year part is 0. The default is a date whose parts are all
+    /// 0.
+    ///
+    /// A game matches if any of its dates is on or after this date. Missing
+    /// month or day parts of a partial date are treated as the earliest
+    /// possible value here, and as the latest possible value for the dates of
+    /// the game. Games without dates never match if a date criterion is set.
+    SgfcDate EarliestGameDate;
+
+    /// @brief Matches games that were played on or before this date. Is not
+    /// used if the year part is 0. The default is a date whose parts are all
+    /// 0.
+    ///
+    /// A game matches if any of its dates is on or before this date. Missing
+    /// month or day parts of a partial date are treated as the latest possible
+    /// value here, and as the earliest possible value for the dates of the
+    /// game. Games without dates never match if a date criterion is set.
+    SgfcDate LatestGameDate;
+
+    /// @brief True if GameResultType is used. The default is false.
+    bool IsGameResultTypeSet = false;
+
+    /// @brief Matches games with a valid game result of this type. The
+    /// default is SgfcGameResultType::UnknownResult.
+    SgfcGameResultType GameResultType = SgfcGameResultType::UnknownResult;
+
+    /// @brief True if WinType is used. The default is false.
+    bool IsWinTypeSet = false;
+
+    /// @brief Matches games won by Black or White with this win type. The
+    /// default is SgfcWinType::WinWithScore.
+    SgfcWinType WinType = SgfcWinType::WinWithScore;
+
+    /// @brief True if MinimumKomi and MaximumKomi are used. The default is
+    /// false.
+    bool IsKomiRangeSet = false;
+
+    /// @brief Matches games with at least this komi. The default is 0.0.
+    SgfcReal MinimumKomi = 0.0;
+
+    /// @brief Matches games with at most this komi. The default is 0.0.
+    SgfcReal MaximumKomi = 0.0;
+
+    /// @brief Matches games played under these rules. Is not used if empty.
+    /// The default is an empty string.
+    SgfcSimpleText RulesName;
+  };
+}
@@ -0,0 +1,58 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <memory>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcDocumentReadResult;
+  class ISgfcGameInfo;
+
+  /// @brief The SgfcGameInfoScanResult struct is a simple type that holds the
+  /// outcome of a scan operation performed by ISgfcGameInfoScanner.
+  ///
+  /// @ingroup public-api
+  /// @ingroup sgfc-frontend
+  ///
+  /// @see ISgfcGameInfoScanner
+  struct SGFCPLUSPLUS_EXPORT SgfcGameInfoScanResult
+  {
+  public:
+    /// @brief One ISgfcGameInfo object per game tree in the scanned SGF
+    /// content, in the order in which the game trees appear in the content.
+    /// Is empty if the scan operation failed. The default is an empty list.
+    std::vector<std::shared_ptr<ISgfcGameInfo>> GameInfos;
+
+    /// @brief Is true if the SGF content could not be scanned by the fast
+    /// header scanner and was instead read with ISgfcDocumentReader. Is false
+    /// if the fast header scanner succeeded. The default is false.
+    bool IsFallbackUsed = false;
+
+    /// @brief The result of the ISgfcDocumentReader read operation if
+    /// @e IsFallbackUsed is true. Use this to find out why the scan operation
+    /// failed if @e GameInfos is empty. Is @e nullptr if @e IsFallbackUsed is
+    /// false. The default is @e nullptr.
+    std::shared_ptr<ISgfcDocumentReadResult> FallbackReadResult;
+  };
+}
@@ -0,0 +1,77 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "SgfcColor.h"
+#include "SgfcCoordinateSystem.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <cstddef>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcGoMoveBuffers struct is a simple type that describes a
+  /// set of caller-provided buffers into which ISgfcGame writes a sequence of
+  /// Go moves in structure-of-arrays form.
+  ///
+  /// @ingroup public-api
+  /// @ingroup go
+  ///
+  /// Element n of each buffer describes move n of the sequence. Each buffer
+  /// must be able to hold at least @e Capacity elements. Each buffer pointer
+  /// may be @e nullptr, in which case the corresponding move attribute is not
+  /// written. If all buffer pointers are @e nullptr, or if @e Capacity is 0,
+  /// no moves are written at all, which is useful to determine the length of
+  /// a move sequence before allocating the buffers.
+  ///
+  /// The SgfcGoMoveBuffers struct does not own the buffers.
+  ///
+  /// @see ISgfcGame::GetMainVariationGoMoves()
+  struct SGFCPLUSPLUS_EXPORT SgfcGoMoveBuffers
+  {
+  public:
+    /// @brief Receives the color of the player who made the move.
+    SgfcColor* Colors = nullptr;
+
+    /// @brief Receives the 1-based x-axis position of the stone that was
+    /// placed by the move, in the coordinate system @e CoordinateSystem.
+    /// Receives 0 for a pass move.
+    unsigned int* XPositions = nullptr;
+
+    /// @brief Receives the 1-based y-axis position of the stone that was
+    /// placed by the move, in the coordinate system @e CoordinateSystem.
+    /// Receives 0 for a pass move.
+    unsigned int* YPositions = nullptr;
+
+    /// @brief Receives true if the move is a pass move, false if the move
+    /// placed a stone on the board.
+    bool* PassMoves = nullptr;
+
+    /// @brief The number of elements that each buffer can hold. The default
+    /// is 0.
+    std::size_t Capacity = 0;
+
+    /// @brief The coordinate system in which positions are written to
+    /// @e XPositions and @e YPositions. The default is
+    /// SgfcCoordinateSystem::UpperLeftOrigin.
+    SgfcCoordinateSystem CoordinateSystem = SgfcCoordinateSystem::UpperLeftOrigin;
+  };
+}
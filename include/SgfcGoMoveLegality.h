@@ -0,0 +1,57 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief SgfcGoMoveLegality enumerates the results of checking whether a
+  /// move in a Go game is legal.
+  ///
+  /// @ingroup public-api
+  /// @ingroup go
+  ///
+  /// @see ISgfcGoReplayEngine
+  enum class SGFCPLUSPLUS_EXPORT SgfcGoMoveLegality
+  {
+    /// @brief The move is legal.
+    Legal,
+
+    /// @brief The move's property value could not be interpreted as a Go
+    /// move, i.e. the property value has no ISgfcGoMovePropertyValue.
+    InvalidMoveValue,
+
+    /// @brief The move places a stone on an intersection that is already
+    /// occupied by another stone.
+    IntersectionOccupied,
+
+    /// @brief The move is a suicide move, i.e. the stone placed by the move
+    /// would have no liberties after capturing, and the ruleset does not
+    /// allow suicide.
+    Suicide,
+
+    /// @brief The move retakes a ko immediately, i.e. the move would repeat
+    /// the board position from before the opponent's last move.
+    Ko,
+
+    /// @brief The move repeats an earlier board position, and the ruleset
+    /// forbids such repetitions (superko).
+    Superko,
+  };
+}
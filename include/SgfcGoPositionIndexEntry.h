@@ -0,0 +1,56 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcGoPositionIndexEntry struct is a simple type that
+  /// identifies a node in an SGF file at which a Go position occurs. It is
+  /// the result type of queries made with ISgfcGoPositionIndex.
+  ///
+  /// @ingroup public-api
+  /// @ingroup go
+  ///
+  /// @see ISgfcGoPositionIndex
+  struct SGFCPLUSPLUS_EXPORT SgfcGoPositionIndexEntry
+  {
+  public:
+    /// @brief The path of the SGF file that contains the game, as it was found
+    /// when the index was built. The default is an empty string.
+    std::string FilePath;
+
+    /// @brief The 0-based index of the game in the SGF file, i.e. the index
+    /// of the game in the collection returned by ISgfcDocument::GetGames().
+    /// The default is 0.
+    std::size_t GameIndex = 0;
+
+    /// @brief The path from the root node of the game tree to the node at
+    /// which the position occurs. Each element is the 0-based index of a child
+    /// node in the collection returned by ISgfcNode::GetChildren(), starting
+    /// with the child of the root node. An empty vector denotes the root node.
+    /// The default is an empty vector.
+    std::vector<std::size_t> NodePath;
+  };
+}
@@ -0,0 +1,58 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "SgfcGoMoveLegality.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <memory>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcNode;
+
+  /// @brief The SgfcGoReplayResult struct is a simple type that holds the
+  /// outcome of replaying a sequence of nodes with ISgfcGoReplayEngine.
+  ///
+  /// @ingroup public-api
+  /// @ingroup go
+  ///
+  /// @see ISgfcGoReplayEngine
+  struct SGFCPLUSPLUS_EXPORT SgfcGoReplayResult
+  {
+  public:
+    /// @brief The legality of the first illegal move that was encountered
+    /// during the replay. Is SgfcGoMoveLegality::Legal if all moves were
+    /// legal. The default is SgfcGoMoveLegality::Legal.
+    SgfcGoMoveLegality MoveLegality = SgfcGoMoveLegality::Legal;
+
+    /// @brief The node that contains the first illegal move that was
+    /// encountered during the replay. Is @e nullptr if all moves were legal.
+    /// The default is @e nullptr.
+    std::shared_ptr<ISgfcNode> IllegalMoveNode;
+
+    /// @brief The number of moves that were successfully played, including
+    /// pass moves. The default is 0.
+    std::size_t NumberOfMoves = 0;
+  };
+}
@@ -0,0 +1,56 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "SgfcNodeChangeType.h"
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+// C++ Standard Library includes
+#include <memory>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcNode;
+
+  /// @brief The SgfcNodeChange struct is a simple type that describes one
+  /// difference between two game trees that ISgfcGame::GetNodeChanges()
+  /// reports.
+  ///
+  /// @ingroup public-api
+  /// @ingroup game-tree
+  ///
+  /// @see ISgfcGame::GetNodeChanges()
+  struct SGFCPLUSPLUS_EXPORT SgfcNodeChange
+  {
+  public:
+    /// @brief The kind of the difference. The default is
+    /// SgfcNodeChangeType::Changed.
+    SgfcNodeChangeType ChangeType = SgfcNodeChangeType::Changed;
+
+    /// @brief The node in the old game tree. Is @e nullptr if @e ChangeType
+    /// is SgfcNodeChangeType::Added. The default is @e nullptr.
+    std::shared_ptr<ISgfcNode> OldNode;
+
+    /// @brief The node in the new game tree. Is @e nullptr if @e ChangeType
+    /// is SgfcNodeChangeType::Removed. The default is @e nullptr.
+    std::shared_ptr<ISgfcNode> NewNode;
+  };
+}
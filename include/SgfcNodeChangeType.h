@@ -0,0 +1,43 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief SgfcNodeChangeType enumerates the kinds of differences that
+  /// ISgfcGame::GetNodeChanges() reports between two game trees.
+  ///
+  /// @ingroup public-api
+  /// @ingroup game-tree
+  enum class SGFCPLUSPLUS_EXPORT SgfcNodeChangeType
+  {
+    /// @brief The node exists only in the new game tree. The node's
+    /// descendants were added as well, they are not reported separately.
+    Added,
+
+    /// @brief The node exists only in the old game tree. The node's
+    /// descendants were removed as well, they are not reported separately.
+    Removed,
+
+    /// @brief The node exists in both game trees, at the same location, but
+    /// its properties differ.
+    Changed,
+  };
+}
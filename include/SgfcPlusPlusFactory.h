@@ -16,6 +16,10 @@
 
 #pragma once
 
+// Project includes
+#include "SgfcBoardSize.h"
+#include "SgfcGoRuleset.h"
+
 // Project includes (generated)
 #include "SgfcPlusPlusExport.h"
 
@@ -27,15 +31,31 @@
 namespace LibSgfcPlusPlus
 {
   // Forward declarations
+  class ISgfcArchiveReader;
   class ISgfcArguments;
+  class ISgfcBatchDocumentReader;
+  class ISgfcBatchDocumentWriter;
+  class ISgfcBinaryDocumentReader;
+  class ISgfcBinaryDocumentWriter;
+  class ISgfcCachingDocumentReader;
+  class ISgfcCollectionReader;
   class ISgfcCommandLine;
   class ISgfcDocument;
   class ISgfcDocumentReader;
   class ISgfcDocumentWriter;
   class ISgfcGame;
   class ISgfcGameInfo;
+  class ISgfcGameInfoCatalog;
+  class ISgfcGameInfoCatalogWriter;
+  class ISgfcGameInfoScanner;
   class ISgfcGoGameInfo;
+  class ISgfcGoOpeningTreeBuilder;
+  class ISgfcGoPositionIndex;
+  class ISgfcGoPositionIndexWriter;
+  class ISgfcGoReplayEngine;
+  class ISgfcMemoryCachingDocumentReader;
   class ISgfcNode;
+  class ISgfcParseEventReader;
   class ISgfcPropertyFactory;
   class ISgfcPropertyValueFactory;
 
@@ -75,9 +95,116 @@ namespace LibSgfcPlusPlus
     /// @brief Returns a newly constructed ISgfcDocumentReader object.
     static std::shared_ptr<ISgfcDocumentReader> CreateDocumentReader();
 
+    /// @brief Returns a newly constructed ISgfcCachingDocumentReader object
+    /// that stores its cache entries in the directory located at
+    /// @a cacheDirectoryPath. The directory is created if it does not exist.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a cacheDirectoryPath
+    /// refers to a filesystem object that is not a directory.
+    /// @exception std::runtime_error Is thrown if the directory does not
+    /// exist and cannot be created.
+    static std::shared_ptr<ISgfcCachingDocumentReader> CreateCachingDocumentReader(
+      const std::string& cacheDirectoryPath);
+
+    /// @brief Returns a newly constructed ISgfcMemoryCachingDocumentReader
+    /// object that delegates read operations to a newly constructed
+    /// ISgfcDocumentReader object.
+    static std::shared_ptr<ISgfcMemoryCachingDocumentReader> CreateMemoryCachingDocumentReader();
+
+    /// @brief Returns a newly constructed ISgfcMemoryCachingDocumentReader
+    /// object that delegates read operations to @a documentReader.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a documentReader is
+    /// @e nullptr.
+    static std::shared_ptr<ISgfcMemoryCachingDocumentReader> CreateMemoryCachingDocumentReader(
+      std::shared_ptr<ISgfcDocumentReader> documentReader);
+
+    /// @brief Returns a newly constructed ISgfcCollectionReader object that
+    /// reads game trees from the .sgf file located at @a sgfFilePath. The
+    /// index of the game trees is built by scanning the .sgf file. Game
+    /// trees are read with a newly constructed ISgfcDocumentReader object.
+    ///
+    /// @exception std::runtime_error Is thrown if @a sgfFilePath cannot be
+    /// opened for reading.
+    static std::shared_ptr<ISgfcCollectionReader> CreateCollectionReader(
+      const std::string& sgfFilePath);
+
+    /// @brief Returns a newly constructed ISgfcCollectionReader object that
+    /// reads game trees from the .sgf file located at @a sgfFilePath. Game
+    /// trees are read with a newly constructed ISgfcDocumentReader object.
+    ///
+    /// The index of the game trees is loaded from the sidecar index file
+    /// located at @a indexFilePath if that file exists and was written for
+    /// the current version of the .sgf file, i.e. the .sgf file's path, size
+    /// and last modification time are still the same. Otherwise the index is
+    /// built by scanning the .sgf file and then written to the index file.
+    /// Failure to write the index file is ignored.
+    ///
+    /// @exception std::runtime_error Is thrown if the index must be built
+    /// and @a sgfFilePath cannot be opened for reading.
+    static std::shared_ptr<ISgfcCollectionReader> CreateCollectionReader(
+      const std::string& sgfFilePath,
+      const std::string& indexFilePath);
+
+    /// @brief Returns a newly constructed ISgfcCollectionReader object that
+    /// reads game trees from the .sgf file located at @a sgfFilePath, using
+    /// @a documentReader. If @a indexFilePath is an empty string the index
+    /// of the game trees is built by scanning the .sgf file, otherwise the
+    /// sidecar index file located at @a indexFilePath is used as described
+    /// in CreateCollectionReader(const std::string&, const std::string&).
+    ///
+    /// @exception std::invalid_argument Is thrown if @a documentReader is
+    /// @e nullptr.
+    /// @exception std::runtime_error Is thrown if the index must be built
+    /// and @a sgfFilePath cannot be opened for reading.
+    static std::shared_ptr<ISgfcCollectionReader> CreateCollectionReader(
+      const std::string& sgfFilePath,
+      const std::string& indexFilePath,
+      std::shared_ptr<ISgfcDocumentReader> documentReader);
+
+    /// @brief Returns a newly constructed ISgfcArchiveReader object that
+    /// reads .sgf files from the tar or zip archive located at
+    /// @a archiveFilePath. Archive members are read with a newly constructed
+    /// ISgfcDocumentReader object.
+    ///
+    /// @exception std::runtime_error Is thrown if @a archiveFilePath cannot
+    /// be opened for reading, or if it is neither a tar nor a zip archive.
+    static std::shared_ptr<ISgfcArchiveReader> CreateArchiveReader(
+      const std::string& archiveFilePath);
+
+    /// @brief Returns a newly constructed ISgfcArchiveReader object that
+    /// reads .sgf files from the tar or zip archive located at
+    /// @a archiveFilePath, using @a documentReader.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a documentReader is
+    /// @e nullptr.
+    /// @exception std::runtime_error Is thrown if @a archiveFilePath cannot
+    /// be opened for reading, or if it is neither a tar nor a zip archive.
+    static std::shared_ptr<ISgfcArchiveReader> CreateArchiveReader(
+      const std::string& archiveFilePath,
+      std::shared_ptr<ISgfcDocumentReader> documentReader);
+
+    /// @brief Returns a newly constructed ISgfcBatchDocumentReader object.
+    static std::shared_ptr<ISgfcBatchDocumentReader> CreateBatchDocumentReader();
+
+    /// @brief Returns a newly constructed ISgfcParseEventReader object.
+    static std::shared_ptr<ISgfcParseEventReader> CreateParseEventReader();
+
+    /// @brief Returns a newly constructed ISgfcGameInfoScanner object.
+    static std::shared_ptr<ISgfcGameInfoScanner> CreateGameInfoScanner();
+
     /// @brief Returns a newly constructed ISgfcDocumentWriter object.
     static std::shared_ptr<ISgfcDocumentWriter> CreateDocumentWriter();
 
+    /// @brief Returns a newly constructed ISgfcBatchDocumentWriter object.
+    static std::shared_ptr<ISgfcBatchDocumentWriter> CreateBatchDocumentWriter();
+
+    /// @brief Returns a newly constructed ISgfcBinaryDocumentReader object.
+    static std::shared_ptr<ISgfcBinaryDocumentReader> CreateBinaryDocumentReader();
+
+    /// @brief Returns a newly constructed ISgfcBinaryDocumentWriter object.
+    static std::shared_ptr<ISgfcBinaryDocumentWriter> CreateBinaryDocumentWriter();
+
     /// @brief Returns a newly constructed ISgfcDocument object. The
     /// ISgfcDocument content consists of a single ISgfcGame object with an
     /// empty root node.
@@ -147,6 +274,66 @@ namespace LibSgfcPlusPlus
     /// or if @a gameInfoNode is @e nullptr.
     static std::shared_ptr<ISgfcGameInfo> CreateGameInfo(std::shared_ptr<ISgfcNode> rootNode, std::shared_ptr<ISgfcNode> gameInfoNode);
 
+    /// @brief Returns a newly constructed ISgfcGameInfoCatalogWriter object
+    /// that can be used to build an on-disk catalog of the game information
+    /// of all games in a corpus of SGF files.
+    static std::shared_ptr<ISgfcGameInfoCatalogWriter> CreateGameInfoCatalogWriter();
+
+    /// @brief Returns a newly constructed ISgfcGameInfoCatalog object that
+    /// can be used to query the catalog located at @a catalogFilePath. The
+    /// catalog must have been written by ISgfcGameInfoCatalogWriter.
+    ///
+    /// @exception std::runtime_error Is thrown if @a catalogFilePath cannot be
+    /// opened for reading, or if the file is not a catalog file in a format
+    /// supported by the library.
+    static std::shared_ptr<ISgfcGameInfoCatalog> CreateGameInfoCatalog(const std::string& catalogFilePath);
+
+    /// @brief Returns a newly constructed ISgfcGoReplayEngine object that
+    /// replays the moves of @a game. The board size and the ruleset are taken
+    /// from the root node and the first game info node of @a game. The
+    /// current position of the returned object is an empty board.
+    ///
+    /// If the game info node of @a game has no property of type
+    /// #SgfcPropertyType::RU, or if the property value cannot be parsed, the
+    /// ruleset of the returned object is an invalid SgfcGoRuleset object.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a game is @e nullptr,
+    /// if @a game has no root node, if the game type of @a game is not
+    /// #SgfcGameType::Go, or if the board size of @a game is not valid for
+    /// #SgfcGameType::Go.
+    static std::shared_ptr<ISgfcGoReplayEngine> CreateGoReplayEngine(std::shared_ptr<ISgfcGame> game);
+
+    /// @brief Returns a newly constructed ISgfcGoReplayEngine object that
+    /// replays moves on a board of size @a boardSize and checks moves for
+    /// legality according to @a goRuleset. The current position of the
+    /// returned object is an empty board.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a boardSize is not
+    /// valid for #SgfcGameType::Go.
+    static std::shared_ptr<ISgfcGoReplayEngine> CreateGoReplayEngine(SgfcBoardSize boardSize, SgfcGoRuleset goRuleset);
+
+    /// @brief Returns a newly constructed ISgfcGoPositionIndexWriter object
+    /// that can be used to build an on-disk index of the Go positions in a
+    /// corpus of SGF files.
+    static std::shared_ptr<ISgfcGoPositionIndexWriter> CreateGoPositionIndexWriter();
+
+    /// @brief Returns a newly constructed ISgfcGoPositionIndex object that
+    /// can be used to query the on-disk index located at @a indexFilePath.
+    /// The index must have been written by ISgfcGoPositionIndexWriter.
+    ///
+    /// @exception std::runtime_error Is thrown if @a indexFilePath cannot be
+    /// opened for reading, or if the file is not an index file in a format
+    /// supported by the library.
+    static std::shared_ptr<ISgfcGoPositionIndex> CreateGoPositionIndex(const std::string& indexFilePath);
+
+    /// @brief Returns a newly constructed ISgfcGoOpeningTreeBuilder object
+    /// that merges the games that are added to it into an opening tree for
+    /// a board of size @a boardSize.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a boardSize is not
+    /// valid for #SgfcGameType::Go.
+    static std::shared_ptr<ISgfcGoOpeningTreeBuilder> CreateGoOpeningTreeBuilder(SgfcBoardSize boardSize);
+
     /// @brief Returns a newly constructed ISgfcPropertyFactory object
     /// that can be used to create ISgfcProperty objects, and objects of every
     /// known sub-type of ISgfcProperty.
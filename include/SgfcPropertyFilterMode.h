@@ -0,0 +1,44 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes (generated)
+#include "SgfcPlusPlusExport.h"
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief SgfcPropertyFilterMode enumerates the ways how
+  /// SgfcDocumentReadOptions can restrict the properties that
+  /// ISgfcDocumentReader builds into the document object tree.
+  ///
+  /// @ingroup public-api
+  /// @ingroup sgfc-frontend
+  enum class SGFCPLUSPLUS_EXPORT SgfcPropertyFilterMode
+  {
+    /// @brief All properties are built. The property types and names listed
+    /// in SgfcDocumentReadOptions are ignored.
+    KeepAllProperties,
+
+    /// @brief Only the properties whose property type or property name is
+    /// listed in SgfcDocumentReadOptions are built.
+    KeepListedProperties,
+
+    /// @brief All properties except those whose property type or property
+    /// name is listed in SgfcDocumentReadOptions are built.
+    DropListedProperties,
+  };
+}
@@ -0,0 +1,220 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "SgfcBinaryUtility.h"
+#include "SgfcPrivateConstants.h"
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <cstring>  // for std::memcpy()
+#include <limits>
+#include <stdexcept>
+
+namespace LibSgfcPlusPlus
+{
+  void SgfcBinaryUtility::WriteUInt8(std::ostream& out, std::uint8_t value)
+  {
+    WriteBytes(out, value, 1);
+  }
+
+  void SgfcBinaryUtility::WriteUInt16(std::ostream& out, std::uint16_t value)
+  {
+    WriteBytes(out, value, 2);
+  }
+
+  void SgfcBinaryUtility::WriteUInt32(std::ostream& out, std::uint32_t value)
+  {
+    WriteBytes(out, value, 4);
+  }
+
+  void SgfcBinaryUtility::WriteUInt64(std::ostream& out, std::uint64_t value)
+  {
+    WriteBytes(out, value, 8);
+  }
+
+  void SgfcBinaryUtility::WriteDouble(std::ostream& out, double value)
+  {
+    static_assert(sizeof(double) == sizeof(std::uint64_t), "double must have 64 bits");
+
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    WriteUInt64(out, bits);
+  }
+
+  void SgfcBinaryUtility::WriteString(std::ostream& out, const std::string& string)
+  {
+    if (string.size() > std::numeric_limits<std::uint32_t>::max())
+      throw std::invalid_argument("WriteString failed: String is too long");
+
+    WriteUInt32(out, static_cast<std::uint32_t>(string.size()));
+    out.write(string.data(), static_cast<std::streamsize>(string.size()));
+  }
+
+  void SgfcBinaryUtility::WriteCharacters(std::ostream& out, const std::string& string)
+  {
+    out.write(string.data(), static_cast<std::streamsize>(string.size()));
+  }
+
+  std::uint8_t SgfcBinaryUtility::ReadUInt8(std::istream& in)
+  {
+    return static_cast<std::uint8_t>(ReadBytes(in, 1));
+  }
+
+  std::uint16_t SgfcBinaryUtility::ReadUInt16(std::istream& in)
+  {
+    return static_cast<std::uint16_t>(ReadBytes(in, 2));
+  }
+
+  std::uint32_t SgfcBinaryUtility::ReadUInt32(std::istream& in)
+  {
+    return static_cast<std::uint32_t>(ReadBytes(in, 4));
+  }
+
+  std::uint64_t SgfcBinaryUtility::ReadUInt64(std::istream& in)
+  {
+    return ReadBytes(in, 8);
+  }
+
+  double SgfcBinaryUtility::ReadDouble(std::istream& in)
+  {
+    std::uint64_t bits = ReadUInt64(in);
+
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  std::string SgfcBinaryUtility::ReadString(std::istream& in)
+  {
+    std::uint32_t length = ReadUInt32(in);
+    return ReadBlock(in, length);
+  }
+
+  std::string SgfcBinaryUtility::ReadCharacters(std::istream& in, std::size_t numberOfCharacters)
+  {
+    return ReadBlock(in, numberOfCharacters);
+  }
+
+  std::vector<std::uint8_t> SgfcBinaryUtility::ReadUInt8Vector(std::istream& in, std::size_t numberOfValues)
+  {
+    std::string block = ReadBlock(in, numberOfValues);
+    return std::vector<std::uint8_t>(block.begin(), block.end());
+  }
+
+  std::vector<std::uint32_t> SgfcBinaryUtility::ReadUInt32Vector(std::istream& in, std::size_t numberOfValues)
+  {
+    std::string block = ReadBlock(in, GetBlockSize(numberOfValues, 4));
+
+    std::vector<std::uint32_t> values(numberOfValues);
+    for (std::size_t valueIndex = 0; valueIndex < numberOfValues; valueIndex++)
+      values[valueIndex] = static_cast<std::uint32_t>(DecodeBytes(block.data() + valueIndex * 4, 4));
+
+    return values;
+  }
+
+  std::vector<std::uint64_t> SgfcBinaryUtility::ReadUInt64Vector(std::istream& in, std::size_t numberOfValues)
+  {
+    std::string block = ReadBlock(in, GetBlockSize(numberOfValues, 8));
+
+    std::vector<std::uint64_t> values(numberOfValues);
+    for (std::size_t valueIndex = 0; valueIndex < numberOfValues; valueIndex++)
+      values[valueIndex] = DecodeBytes(block.data() + valueIndex * 8, 8);
+
+    return values;
+  }
+
+  std::vector<double> SgfcBinaryUtility::ReadDoubleVector(std::istream& in, std::size_t numberOfValues)
+  {
+    std::string block = ReadBlock(in, GetBlockSize(numberOfValues, 8));
+
+    std::vector<double> values(numberOfValues);
+    for (std::size_t valueIndex = 0; valueIndex < numberOfValues; valueIndex++)
+    {
+      std::uint64_t bits = DecodeBytes(block.data() + valueIndex * 8, 8);
+      std::memcpy(&values[valueIndex], &bits, sizeof(bits));
+    }
+
+    return values;
+  }
+
+  void SgfcBinaryUtility::WriteBytes(std::ostream& out, std::uint64_t value, int numberOfBytes)
+  {
+    char bytes[8];
+    for (int byteIndex = 0; byteIndex < numberOfBytes; byteIndex++)
+      bytes[byteIndex] = static_cast<char>((value >> (byteIndex * 8)) & 0xff);
+
+    out.write(bytes, numberOfBytes);
+  }
+
+  std::uint64_t SgfcBinaryUtility::ReadBytes(std::istream& in, int numberOfBytes)
+  {
+    char bytes[8];
+    in.read(bytes, numberOfBytes);
+    if (in.gcount() != numberOfBytes)
+      throw std::runtime_error("ReadBytes failed: Unexpected end of data");
+
+    return DecodeBytes(bytes, numberOfBytes);
+  }
+
+  /// @brief Reads @a numberOfBytes bytes from @a in.
+  ///
+  /// @a numberOfBytes usually was read from the same data and cannot be
+  /// trusted. The block therefore grows only by at most
+  /// SgfcPrivateConstants::BinaryReadChunkSize bytes at a time, as the data
+  /// actually arrives. This way corrupt data causes an exception instead of
+  /// a huge allocation.
+  std::string SgfcBinaryUtility::ReadBlock(std::istream& in, std::size_t numberOfBytes)
+  {
+    std::string block;
+
+    while (block.size() < numberOfBytes)
+    {
+      std::size_t numberOfBytesInChunk = std::min(numberOfBytes - block.size(), SgfcPrivateConstants::BinaryReadChunkSize);
+      std::size_t chunkPosition = block.size();
+      block.resize(chunkPosition + numberOfBytesInChunk);
+
+      in.read(&block[chunkPosition], static_cast<std::streamsize>(numberOfBytesInChunk));
+      if (in.gcount() != static_cast<std::streamsize>(numberOfBytesInChunk))
+        throw std::runtime_error("ReadBlock failed: Unexpected end of data");
+    }
+
+    return block;
+  }
+
+  /// @brief Returns the number of bytes that @a numberOfValues values of
+  /// size @a valueSize take up.
+  ///
+  /// @exception std::runtime_error Is thrown if the number of bytes cannot
+  /// be represented by std::size_t. This can only happen if
+  /// @a numberOfValues was read from corrupt data.
+  std::size_t SgfcBinaryUtility::GetBlockSize(std::size_t numberOfValues, std::size_t valueSize)
+  {
+    if (numberOfValues > std::numeric_limits<std::size_t>::max() / valueSize)
+      throw std::runtime_error("GetBlockSize failed: Number of values is too large");
+
+    return numberOfValues * valueSize;
+  }
+
+  std::uint64_t SgfcBinaryUtility::DecodeBytes(const char* bytes, int numberOfBytes)
+  {
+    std::uint64_t value = 0;
+    for (int byteIndex = 0; byteIndex < numberOfBytes; byteIndex++)
+      value |= static_cast<std::uint64_t>(static_cast<unsigned char>(bytes[byteIndex])) << (byteIndex * 8);
+
+    return value;
+  }
+}
@@ -0,0 +1,142 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcBinaryUtility class is a container for static helper
+  /// functions that read and write the primitive values of the binary file
+  /// formats used by the library.
+  ///
+  /// @ingroup internals
+  /// @ingroup library-support
+  ///
+  /// All integer values are stored in little-endian byte order, regardless of
+  /// the byte order of the platform. Strings are stored as a 32-bit length
+  /// followed by the string's bytes, without a zero terminator.
+  ///
+  /// The read functions do not trust lengths and counts, because these
+  /// usually were read from the same data. Memory is allocated only as the
+  /// data actually arrives, so corrupt data causes std::runtime_error
+  /// instead of a huge allocation.
+  class SgfcBinaryUtility
+  {
+  public:
+    SgfcBinaryUtility() = delete;
+    ~SgfcBinaryUtility() = delete;
+
+    /// @brief Writes the 8-bit value @a value to @a out.
+    static void WriteUInt8(std::ostream& out, std::uint8_t value);
+    /// @brief Writes the 16-bit value @a value to @a out.
+    static void WriteUInt16(std::ostream& out, std::uint16_t value);
+    /// @brief Writes the 32-bit value @a value to @a out.
+    static void WriteUInt32(std::ostream& out, std::uint32_t value);
+    /// @brief Writes the 64-bit value @a value to @a out.
+    static void WriteUInt64(std::ostream& out, std::uint64_t value);
+    /// @brief Writes the IEEE 754 double precision value @a value to @a out.
+    static void WriteDouble(std::ostream& out, double value);
+    /// @brief Writes the length of @a string, followed by the bytes of
+    /// @a string, to @a out.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a string is too long to
+    /// have its length represented by a 32-bit value.
+    static void WriteString(std::ostream& out, const std::string& string);
+    /// @brief Writes the bytes of @a string to @a out, without a length.
+    static void WriteCharacters(std::ostream& out, const std::string& string);
+
+    /// @brief Reads an 8-bit value from @a in.
+    ///
+    /// @exception std::runtime_error Is thrown if @a in does not contain
+    /// enough data.
+    static std::uint8_t ReadUInt8(std::istream& in);
+    /// @brief Reads a 16-bit value from @a in.
+    ///
+    /// @exception std::runtime_error Is thrown if @a in does not contain
+    /// enough data.
+    static std::uint16_t ReadUInt16(std::istream& in);
+    /// @brief Reads a 32-bit value from @a in.
+    ///
+    /// @exception std::runtime_error Is thrown if @a in does not contain
+    /// enough data.
+    static std::uint32_t ReadUInt32(std::istream& in);
+    /// @brief Reads a 64-bit value from @a in.
+    ///
+    /// @exception std::runtime_error Is thrown if @a in does not contain
+    /// enough data.
+    static std::uint64_t ReadUInt64(std::istream& in);
+    /// @brief Reads an IEEE 754 double precision value from @a in.
+    ///
+    /// @exception std::runtime_error Is thrown if @a in does not contain
+    /// enough data.
+    static double ReadDouble(std::istream& in);
+    /// @brief Reads a string that was written by WriteString() from @a in.
+    ///
+    /// @exception std::runtime_error Is thrown if @a in does not contain
+    /// enough data.
+    static std::string ReadString(std::istream& in);
+    /// @brief Reads @a numberOfCharacters bytes that were written by
+    /// WriteCharacters() from @a in.
+    ///
+    /// @exception std::runtime_error Is thrown if @a in does not contain
+    /// enough data.
+    static std::string ReadCharacters(std::istream& in, std::size_t numberOfCharacters);
+
+    /// @brief Reads @a numberOfValues consecutive 8-bit values from @a in.
+    /// The data is read in a single block, which is much faster than reading
+    /// the values one by one.
+    ///
+    /// @exception std::runtime_error Is thrown if @a in does not contain
+    /// enough data.
+    static std::vector<std::uint8_t> ReadUInt8Vector(std::istream& in, std::size_t numberOfValues);
+    /// @brief Reads @a numberOfValues consecutive 32-bit values from @a in.
+    /// The data is read in a single block, which is much faster than reading
+    /// the values one by one.
+    ///
+    /// @exception std::runtime_error Is thrown if @a in does not contain
+    /// enough data.
+    static std::vector<std::uint32_t> ReadUInt32Vector(std::istream& in, std::size_t numberOfValues);
+    /// @brief Reads @a numberOfValues consecutive 64-bit values from @a in.
+    /// The data is read in a single block, which is much faster than reading
+    /// the values one by one.
+    ///
+    /// @exception std::runtime_error Is thrown if @a in does not contain
+    /// enough data.
+    static std::vector<std::uint64_t> ReadUInt64Vector(std::istream& in, std::size_t numberOfValues);
+    /// @brief Reads @a numberOfValues consecutive IEEE 754 double precision
+    /// values from @a in. The data is read in a single block, which is much
+    /// faster than reading the values one by one.
+    ///
+    /// @exception std::runtime_error Is thrown if @a in does not contain
+    /// enough data.
+    static std::vector<double> ReadDoubleVector(std::istream& in, std::size_t numberOfValues);
+
+  private:
+    static void WriteBytes(std::ostream& out, std::uint64_t value, int numberOfBytes);
+    static std::uint64_t ReadBytes(std::istream& in, int numberOfBytes);
+    static std::string ReadBlock(std::istream& in, std::size_t numberOfBytes);
+    static std::size_t GetBlockSize(std::size_t numberOfValues, std::size_t valueSize);
+    static std::uint64_t DecodeBytes(const char* bytes, int numberOfBytes);
+  };
+}
@@ -527,6 +527,9 @@ namespace LibSgfcPlusPlus
   const SgfcNumber SgfcConstants::HandicapStonesNone = 0;
   const SgfcReal SgfcConstants::KomiNone = 0.0;
 
+  const std::size_t SgfcConstants::GoPositionCheckpointIntervalDefault = 16;
+  const std::size_t SgfcConstants::GoPositionMaximumNumberOfCheckpointsDefault = 1024;
+
   const SgfcNodeTraits SgfcConstants::NodeTraitsNone = 0;
   const SgfcNodeTraits SgfcConstants::NodeTraitsAll = std::numeric_limits<SgfcNodeTraits>::max();
   const SgfcPropertyTraits SgfcConstants::PropertyTraitsNone = 0;
@@ -0,0 +1,91 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "SgfcParallelUtility.h"
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  unsigned int SgfcParallelUtility::GetNumberOfWorkerThreads(unsigned int numberOfThreads, std::size_t numberOfItems)
+  {
+    unsigned int numberOfWorkerThreads = numberOfThreads;
+    if (numberOfWorkerThreads == 0)
+      numberOfWorkerThreads = std::thread::hardware_concurrency();
+
+    if (numberOfWorkerThreads > numberOfItems)
+      numberOfWorkerThreads = static_cast<unsigned int>(numberOfItems);
+
+    return std::max(numberOfWorkerThreads, 1u);
+  }
+
+  void SgfcParallelUtility::ForEach(
+    std::size_t numberOfItems,
+    unsigned int numberOfWorkerThreads,
+    const std::function<void(std::size_t itemIndex, unsigned int workerThreadIndex)>& function)
+  {
+    if (numberOfWorkerThreads == 0)
+      throw std::invalid_argument("ForEach failed: Number of worker threads is 0");
+
+    std::atomic<std::size_t> nextItemIndex(0);
+    std::exception_ptr workerException;
+    std::mutex workerExceptionMutex;
+
+    auto worker = [&](unsigned int workerThreadIndex)
+    {
+      try
+      {
+        while (true)
+        {
+          std::size_t itemIndex = nextItemIndex++;
+          if (itemIndex >= numberOfItems)
+            break;
+
+          function(itemIndex, workerThreadIndex);
+        }
+      }
+      catch (...)
+      {
+        // Prevent other worker threads from starting new items
+        nextItemIndex = numberOfItems;
+
+        std::lock_guard<std::mutex> lock(workerExceptionMutex);
+        if (workerException == nullptr)
+          workerException = std::current_exception();
+      }
+    };
+
+    std::vector<std::thread> workerThreads;
+    for (unsigned int workerThreadIndex = 1; workerThreadIndex < numberOfWorkerThreads; workerThreadIndex++)
+      workerThreads.emplace_back(worker, workerThreadIndex);
+
+    worker(0);
+
+    for (auto& workerThread : workerThreads)
+      workerThread.join();
+
+    if (workerException != nullptr)
+      std::rethrow_exception(workerException);
+  }
+}
@@ -0,0 +1,67 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <functional>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcParallelUtility class is a container for static helper
+  /// functions that distribute work over a number of worker threads.
+  ///
+  /// @ingroup internals
+  /// @ingroup library-support
+  class SgfcParallelUtility
+  {
+  public:
+    SgfcParallelUtility() = delete;
+    ~SgfcParallelUtility() = delete;
+
+    /// @brief Returns the number of worker threads that should be used to
+    /// process @a numberOfItems items, if a library client requested
+    /// @a numberOfThreads threads. The value 0 for @a numberOfThreads means
+    /// that the number of threads is determined by the number of concurrent
+    /// threads supported by the hardware. The return value is never greater
+    /// than @a numberOfItems, and never less than 1.
+    static unsigned int GetNumberOfWorkerThreads(unsigned int numberOfThreads, std::size_t numberOfItems);
+
+    /// @brief Invokes @a function once for every item index in the range from
+    /// 0 to @a numberOfItems - 1, distributed over @a numberOfWorkerThreads
+    /// worker threads. Returns when all items have been processed.
+    ///
+    /// @a function receives the item index and the index of the worker
+    /// thread (in the range from 0 to @a numberOfWorkerThreads - 1) that
+    /// processes the item. A worker thread processes one item at a time, so
+    /// @a function can use the worker thread index to access per-thread state
+    /// without synchronization. Items are handed out in ascending order.
+    ///
+    /// The calling thread acts as one of the worker threads.
+    ///
+    /// If @a function throws an exception, no further items are handed out,
+    /// and the first exception that was thrown is rethrown in the calling
+    /// thread after all worker threads have finished.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a numberOfWorkerThreads
+    /// is 0.
+    static void ForEach(
+      std::size_t numberOfItems,
+      unsigned int numberOfWorkerThreads,
+      const std::function<void(std::size_t itemIndex, unsigned int workerThreadIndex)>& function);
+  };
+}
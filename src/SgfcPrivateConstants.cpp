@@ -185,4 +185,81 @@ namespace LibSgfcPlusPlus
   };
 
   const std::string SgfcPrivateConstants::TextEncodingNameUTF8 = "UTF-8";
+  const std::string SgfcPrivateConstants::Utf8ByteOrderMark = "\xEF\xBB\xBF";
+  const std::size_t SgfcPrivateConstants::BinaryReadChunkSize = 1024 * 1024;
+
+  // Header layout: Magic (8 bytes), format version (4 bytes), flags (4 bytes),
+  // number of files (8 bytes), number of entries (8 bytes), number of nodes
+  // (8 bytes), offsets of the file table, the entry table and the node table
+  // (8 bytes each).
+  // Entry layout: Hash (8 bytes), file index (4 bytes), game index (4 bytes),
+  // number of the node in the node table (8 bytes).
+  // Node layout: Distance to the parent node (4 bytes), child index (4 bytes).
+  const std::string SgfcPrivateConstants::GoPositionIndexMagic = "SGFCGPIX";
+  const std::uint32_t SgfcPrivateConstants::GoPositionIndexFormatVersion = 2;
+  const std::uint32_t SgfcPrivateConstants::GoPositionIndexFlagCanonical = 0x1;
+  const std::uint64_t SgfcPrivateConstants::GoPositionIndexHeaderSize = 64;
+  const std::uint64_t SgfcPrivateConstants::GoPositionIndexEntrySize = 24;
+  const std::uint64_t SgfcPrivateConstants::GoPositionIndexNodeSize = 8;
+  const std::size_t SgfcPrivateConstants::GoPositionIndexMaximumRunSize = 1 << 20;
+  const std::size_t SgfcPrivateConstants::GoPositionIndexMaximumMergeWidth = 64;
+  const std::size_t SgfcPrivateConstants::GoPositionIndexBatchSizePerWorkerThread = 16;
+
+  // Header layout: Magic (8 bytes), format version (4 bytes), flags (4 bytes),
+  // number of games (8 bytes), number of strings (8 bytes). The header is
+  // followed by the string table and then by the columns. A game takes up 9
+  // columns of 4 bytes, 3 columns of 1 byte and 2 columns of 8 bytes.
+  const std::string SgfcPrivateConstants::GameInfoCatalogMagic = "SGFCGICT";
+  const std::uint32_t SgfcPrivateConstants::GameInfoCatalogFormatVersion = 1;
+  const std::uint64_t SgfcPrivateConstants::GameInfoCatalogHeaderSize = 32;
+  const std::uint64_t SgfcPrivateConstants::GameInfoCatalogGameSize = 9 * 4 + 3 * 1 + 2 * 8;
+  const std::uint64_t SgfcPrivateConstants::GameInfoCatalogMinimumStringSize = 4;
+
+  const std::string SgfcPrivateConstants::CollectionIndexMagic = "SGFCCIDX";
+  const std::uint32_t SgfcPrivateConstants::CollectionIndexFormatVersion = 1;
+  const std::uint32_t SgfcPrivateConstants::CollectionIndexFlagUtf8ByteOrderMark = 0x1;
+  const std::size_t SgfcPrivateConstants::CollectionIndexScanBufferSize = 64 * 1024;
+
+  const std::string SgfcPrivateConstants::GzipMagicNumber = "\x1F\x8B";
+  const std::string SgfcPrivateConstants::ZstdMagicNumber = "\x28\xB5\x2F\xFD";
+  const std::string SgfcPrivateConstants::GzipFileNameExtension = ".gz";
+  const std::string SgfcPrivateConstants::ZstdFileNameExtension = ".zst";
+  const std::size_t SgfcPrivateConstants::CompressionStreamBufferSize = 64 * 1024;
+
+  const std::size_t SgfcPrivateConstants::TarBlockSize = 512;
+  const std::string SgfcPrivateConstants::TarUstarMagic = std::string("ustar\0", 6);
+  const std::uint32_t SgfcPrivateConstants::ZipLocalFileHeaderSignature = 0x04034B50;
+  const std::uint32_t SgfcPrivateConstants::ZipCentralDirectoryFileHeaderSignature = 0x02014B50;
+  const std::uint32_t SgfcPrivateConstants::ZipEndOfCentralDirectorySignature = 0x06054B50;
+  const std::uint32_t SgfcPrivateConstants::Zip64EndOfCentralDirectoryLocatorSignature = 0x07064B50;
+  const std::uint32_t SgfcPrivateConstants::Zip64EndOfCentralDirectorySignature = 0x06064B50;
+  const std::string SgfcPrivateConstants::SgfFileNameExtension = ".sgf";
+  const std::uint64_t SgfcPrivateConstants::ArchiveMaximumMemberSize = 256 * 1024 * 1024;
+  const std::uint64_t SgfcPrivateConstants::ZipMaximumDeflateCompressionRatio = 1032;
+  const std::size_t SgfcPrivateConstants::ArchiveReadChunkSize = 64 * 1024;
+
+  // Header layout: Magic (8 bytes), format version (4 bytes), flags (4 bytes),
+  // number of strings, games, nodes, properties, property values and single
+  // values (8 bytes each).
+  const std::string SgfcPrivateConstants::BinaryDocumentMagic = "SGFCBDOC";
+  const std::uint32_t SgfcPrivateConstants::BinaryDocumentFormatVersion = 1;
+  const std::uint64_t SgfcPrivateConstants::BinaryDocumentHeaderSize = 64;
+
+  const std::string SgfcPrivateConstants::DocumentCacheMagic = "SGFCDCCH";
+  const std::uint32_t SgfcPrivateConstants::DocumentCacheFormatVersion = 1;
+  const std::uint32_t SgfcPrivateConstants::DocumentCacheFlagDocumentTruncated = 0x1;
+  const std::string SgfcPrivateConstants::DocumentCacheFileSuffix = "sgfccache";
+  const std::uint64_t SgfcPrivateConstants::DocumentCacheDefaultMaximumSize = 256 * 1024 * 1024;
+  const std::int64_t SgfcPrivateConstants::DocumentCacheStaleTempFileAge = 60 * 60;
+  const std::uint64_t SgfcPrivateConstants::DocumentCacheEvictionScanInterval = 1000;
+  const std::uint64_t SgfcPrivateConstants::DocumentCacheEvictionTargetPercentage = 90;
+  const std::uint64_t SgfcPrivateConstants::DocumentCacheDefaultMaximumMemoryUsage = 64 * 1024 * 1024;
+
+  const std::size_t SgfcPrivateConstants::MinimumNumberOfNodesPerEncodingTask = 256;
+  const std::size_t SgfcPrivateConstants::NumberOfEncodingTasksPerWorkerThread = 4;
+
+  const std::size_t SgfcPrivateConstants::NumberOfNodesPerDecodingChunk = 256;
+
+  const std::size_t SgfcPrivateConstants::GoOpeningTreeShardingDepth = 3;
+  const std::size_t SgfcPrivateConstants::GoOpeningTreeNumberOfShards = 64;
 }
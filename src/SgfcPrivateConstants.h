@@ -23,6 +23,8 @@
 #include "../include/SgfcPropertyCategory.h"
 
 // C++ Standard Library includes
+#include <cstddef>
+#include <cstdint>
 #include <map>
 #include <regex>
 #include <string>
@@ -219,6 +221,217 @@ namespace LibSgfcPlusPlus
     /// @brief Name of the UTF-8 text encoding. This is used both as CA
     /// property value and to form SGFC command line arguments.
     static const std::string TextEncodingNameUTF8;
+    /// @brief The UTF-8 byte order mark (BOM).
+    static const std::string Utf8ByteOrderMark;
+    /// @brief The maximum number of bytes that SgfcBinaryUtility allocates
+    /// before it has actually read them. Sizes and counts read from a binary
+    /// file cannot be trusted, so larger blocks are read in chunks of this
+    /// size.
+    static const std::size_t BinaryReadChunkSize;
+    //@}
+
+    /// @name Go position index file format constants
+    //@{
+    /// @brief The magic bytes at the beginning of a Go position index file.
+    /// The string has exactly 8 characters.
+    static const std::string GoPositionIndexMagic;
+    /// @brief The version of the Go position index file format that the
+    /// library writes and is able to read.
+    static const std::uint32_t GoPositionIndexFormatVersion;
+    /// @brief Flag in the header of a Go position index file that indicates
+    /// that the index is keyed by canonical Zobrist hashes.
+    static const std::uint32_t GoPositionIndexFlagCanonical;
+    /// @brief The size in bytes of the header of a Go position index file.
+    static const std::uint64_t GoPositionIndexHeaderSize;
+    /// @brief The size in bytes of an entry in the entry table of a Go
+    /// position index file.
+    static const std::uint64_t GoPositionIndexEntrySize;
+    /// @brief The size in bytes of an entry in the node table of a Go
+    /// position index file.
+    static const std::uint64_t GoPositionIndexNodeSize;
+    /// @brief The maximum number of entries that are sorted in memory while
+    /// a Go position index file is written. Larger indexes are sorted in
+    /// runs of this size that are then merged.
+    static const std::size_t GoPositionIndexMaximumRunSize;
+    /// @brief The maximum number of sorted runs that are merged at the same
+    /// time while a Go position index file is written. This limits the
+    /// number of files that are open at the same time.
+    static const std::size_t GoPositionIndexMaximumMergeWidth;
+    /// @brief The number of SGF files per worker thread that are read in one
+    /// batch while a Go position index is built. Only the records of one
+    /// batch are held in memory at the same time.
+    static const std::size_t GoPositionIndexBatchSizePerWorkerThread;
+    //@}
+
+    /// @name Game info catalog file format constants
+    //@{
+    /// @brief The magic bytes at the beginning of a game info catalog file.
+    /// The string has exactly 8 characters.
+    static const std::string GameInfoCatalogMagic;
+    /// @brief The version of the game info catalog file format that the
+    /// library writes and is able to read.
+    static const std::uint32_t GameInfoCatalogFormatVersion;
+    /// @brief The size in bytes of the header of a game info catalog file.
+    static const std::uint64_t GameInfoCatalogHeaderSize;
+    /// @brief The size in bytes that every game takes up in the columns of
+    /// a game info catalog file.
+    static const std::uint64_t GameInfoCatalogGameSize;
+    /// @brief The minimum size in bytes of a string in the string table of a
+    /// game info catalog file. This is the size of the string's length.
+    static const std::uint64_t GameInfoCatalogMinimumStringSize;
+    //@}
+
+    /// @name Collection index file format constants
+    //@{
+    /// @brief The magic bytes at the beginning of a collection index file.
+    /// The string has exactly 8 characters.
+    static const std::string CollectionIndexMagic;
+    /// @brief The version of the collection index file format that the
+    /// library writes and is able to read.
+    static const std::uint32_t CollectionIndexFormatVersion;
+    /// @brief Flag in the header of a collection index file that indicates
+    /// that the indexed .sgf file begins with a UTF-8 BOM.
+    static const std::uint32_t CollectionIndexFlagUtf8ByteOrderMark;
+    /// @brief The size in bytes of the buffer that is used to scan an .sgf
+    /// file when a collection index is built.
+    static const std::size_t CollectionIndexScanBufferSize;
+    //@}
+
+    /// @name Compressed file constants
+    //@{
+    /// @brief The magic bytes at the beginning of a gzip compressed file.
+    static const std::string GzipMagicNumber;
+    /// @brief The magic bytes at the beginning of a Zstandard compressed file.
+    static const std::string ZstdMagicNumber;
+    /// @brief The file name extension that implies gzip compression when an
+    /// .sgf file is written.
+    static const std::string GzipFileNameExtension;
+    /// @brief The file name extension that implies Zstandard compression when
+    /// an .sgf file is written.
+    static const std::string ZstdFileNameExtension;
+    /// @brief The size in bytes of the buffers that are used to stream data
+    /// through a decompressor or compressor.
+    static const std::size_t CompressionStreamBufferSize;
+    //@}
+
+    /// @name Archive file constants
+    //@{
+    /// @brief The size in bytes of a tar archive block. Headers and member
+    /// data in a tar archive are aligned to this size.
+    static const std::size_t TarBlockSize;
+    /// @brief The magic bytes of the POSIX ustar format at offset 257 of a
+    /// tar header block, including the terminating zero byte. Only the POSIX
+    /// ustar format has a file name prefix field, the GNU tar format stores
+    /// other data at that location.
+    static const std::string TarUstarMagic;
+    /// @brief The signature of a zip local file header. Also the magic bytes
+    /// at the beginning of a non-empty zip archive.
+    static const std::uint32_t ZipLocalFileHeaderSignature;
+    /// @brief The signature of a zip central directory file header.
+    static const std::uint32_t ZipCentralDirectoryFileHeaderSignature;
+    /// @brief The signature of the zip end of central directory record.
+    /// Also the magic bytes at the beginning of an empty zip archive.
+    static const std::uint32_t ZipEndOfCentralDirectorySignature;
+    /// @brief The signature of the zip64 end of central directory locator.
+    static const std::uint32_t Zip64EndOfCentralDirectoryLocatorSignature;
+    /// @brief The signature of the zip64 end of central directory record.
+    static const std::uint32_t Zip64EndOfCentralDirectorySignature;
+    /// @brief The file name extension of the archive members that an archive
+    /// reader reads. The extension is compared case insensitively.
+    static const std::string SgfFileNameExtension;
+    /// @brief The maximum size in bytes of the uncompressed data of an
+    /// archive member that an archive reader extracts. Sizes in an archive
+    /// cannot be trusted, so they are checked against this limit before
+    /// memory is allocated for the member data.
+    static const std::uint64_t ArchiveMaximumMemberSize;
+    /// @brief The maximum ratio between the uncompressed and the compressed
+    /// size of a deflate-compressed zip archive member. The deflate format
+    /// cannot achieve a higher ratio, so a member that claims a higher ratio
+    /// is corrupt.
+    static const std::uint64_t ZipMaximumDeflateCompressionRatio;
+    /// @brief The size in bytes of the chunks in which an archive reader
+    /// reads or skips member data whose size cannot be checked against the
+    /// size of the archive before reading.
+    static const std::size_t ArchiveReadChunkSize;
+    //@}
+
+    /// @name Binary document file format constants
+    //@{
+    /// @brief The magic bytes at the beginning of a binary document. The
+    /// string has exactly 8 characters.
+    static const std::string BinaryDocumentMagic;
+    /// @brief The version of the binary document format that the library
+    /// writes and is able to read.
+    static const std::uint32_t BinaryDocumentFormatVersion;
+    /// @brief The size in bytes of the header of a binary document.
+    static const std::uint64_t BinaryDocumentHeaderSize;
+    //@}
+
+    /// @name Document cache constants
+    //@{
+    /// @brief The magic bytes at the beginning of a document cache entry
+    /// file. The string has exactly 8 characters.
+    static const std::string DocumentCacheMagic;
+    /// @brief The version of the document cache entry file format that the
+    /// library writes and is able to read.
+    static const std::uint32_t DocumentCacheFormatVersion;
+    /// @brief Flag in the header of a document cache entry that indicates
+    /// that the cached document was truncated by the read options.
+    static const std::uint32_t DocumentCacheFlagDocumentTruncated;
+    /// @brief The file extension suffix of document cache entry files.
+    static const std::string DocumentCacheFileSuffix;
+    /// @brief The default maximum size in bytes of all entries in a document
+    /// cache together.
+    static const std::uint64_t DocumentCacheDefaultMaximumSize;
+    /// @brief The age in seconds after which a temporary file in a document
+    /// cache directory is considered to be left over from an aborted write
+    /// operation and may be deleted.
+    static const std::int64_t DocumentCacheStaleTempFileAge;
+    /// @brief The number of cache entries that a document cache stores
+    /// before it scans the cache directory again, even if its estimate of the
+    /// cache size does not exceed the maximum cache size. This picks up
+    /// entries that other processes have stored in the meantime.
+    static const std::uint64_t DocumentCacheEvictionScanInterval;
+    /// @brief The percentage of the maximum cache size that a document cache
+    /// shrinks to when it evicts entries. Evicting more than necessary means
+    /// that the cache directory is not scanned again on the very next store.
+    static const std::uint64_t DocumentCacheEvictionTargetPercentage;
+    /// @brief The default maximum number of bytes of memory that the read
+    /// results in an in-memory document cache may occupy together.
+    static const std::uint64_t DocumentCacheDefaultMaximumMemoryUsage;
+    //@}
+
+    /// @name Document encoding constants
+    //@{
+    /// @brief The minimum number of nodes that a subtree must have so that
+    /// SgfcDocumentEncoder encodes it separately from the rest of its game
+    /// when it encodes a document on multiple threads.
+    static const std::size_t MinimumNumberOfNodesPerEncodingTask;
+    /// @brief The number of encoding tasks per worker thread that
+    /// SgfcDocumentEncoder aims for when it splits the games of a document
+    /// into subtrees. More tasks than threads balance the load if the
+    /// subtrees differ in size.
+    static const std::size_t NumberOfEncodingTasksPerWorkerThread;
+    //@}
+
+    /// @name Document decoding constants
+    //@{
+    /// @brief The number of consecutive nodes whose properties SgfcDocument
+    /// decodes in one piece of work when it builds a game on multiple
+    /// threads.
+    static const std::size_t NumberOfNodesPerDecodingChunk;
+    //@}
+
+    /// @name Go opening tree constants
+    //@{
+    /// @brief The number of moves that SgfcGoOpeningTreeBuilder keeps in its
+    /// upper trie. Deeper moves are merged into the lower tries.
+    static const std::size_t GoOpeningTreeShardingDepth;
+    /// @brief The number of lower tries that SgfcGoOpeningTreeBuilder merges
+    /// in parallel. This is larger than the typical number of worker threads
+    /// so that lines of play that are more popular than others do not
+    /// unbalance the load too much.
+    static const std::size_t GoOpeningTreeNumberOfShards;
     //@}
   };
 }
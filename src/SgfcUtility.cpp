@@ -20,6 +20,7 @@
 #include "SgfcUtility.h"
 
 // C++ Standard Library includes
+#include <algorithm>
 #include <cstdio>       // for remove()
 #include <filesystem>   // for std::filesystem::temp_directory_path()
 #include <fstream>      // for std::ofstream and std::ifstream
@@ -260,6 +261,47 @@ namespace LibSgfcPlusPlus
     return (string.compare(beginComparePosition, suffix.size(), suffix) == 0);
   }
 
+  bool SgfcUtility::StringMatchesWildcardPattern(const std::string& string, const std::string& pattern)
+  {
+    // Greedy matching with backtracking to the most recent "*". This is
+    // linear in practice and never recurses.
+    std::size_t stringIndex = 0;
+    std::size_t patternIndex = 0;
+    std::size_t starPatternIndex = std::string::npos;
+    std::size_t starStringIndex = 0;
+
+    while (stringIndex < string.size())
+    {
+      if (patternIndex < pattern.size() && (pattern[patternIndex] == '?' || pattern[patternIndex] == string[stringIndex]))
+      {
+        stringIndex++;
+        patternIndex++;
+      }
+      else if (patternIndex < pattern.size() && pattern[patternIndex] == '*')
+      {
+        starPatternIndex = patternIndex;
+        starStringIndex = stringIndex;
+        patternIndex++;
+      }
+      else if (starPatternIndex != std::string::npos)
+      {
+        // Let the most recent "*" match one more character
+        patternIndex = starPatternIndex + 1;
+        starStringIndex++;
+        stringIndex = starStringIndex;
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    while (patternIndex < pattern.size() && pattern[patternIndex] == '*')
+      patternIndex++;
+
+    return patternIndex == pattern.size();
+  }
+
   std::vector<std::string> SgfcUtility::SplitString(const std::string& string, char delimiter)
   {
     return SplitString(string, std::string(1, delimiter));
@@ -325,6 +367,18 @@ namespace LibSgfcPlusPlus
     return uuid;
   }
 
+  std::uint64_t SgfcUtility::GetHash(const std::string& data)
+  {
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (char character : data)
+    {
+      hash ^= static_cast<unsigned char>(character);
+      hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+  }
+
   void SgfcUtility::CreateOrTruncateFile(const std::string& path)
   {
     std::ofstream out(path, std::ios::out | std::ios::trunc);
@@ -404,4 +458,58 @@ namespace LibSgfcPlusPlus
 
     return content.str();
   }
+
+  std::vector<std::string> SgfcUtility::GetSgfFilePathsInDirectory(const std::string& directoryPath)
+  {
+    std::filesystem::path directory = std::filesystem::u8path(directoryPath);
+    if (! std::filesystem::is_directory(directory))
+    {
+      std::stringstream message;
+      message << "Path does not refer to a directory: " << directoryPath;
+      throw std::invalid_argument(message.str());
+    }
+
+    std::vector<std::string> filePaths;
+    for (const auto& directoryEntry : std::filesystem::recursive_directory_iterator(directory))
+    {
+      if (! directoryEntry.is_regular_file())
+        continue;
+      if (directoryEntry.path().extension() != ".sgf")
+        continue;
+
+      filePaths.push_back(directoryEntry.path().u8string());
+    }
+
+    std::sort(filePaths.begin(), filePaths.end());
+
+    return filePaths;
+  }
+
+  std::vector<std::string> SgfcUtility::GetFilePathsInDirectory(
+    const std::string& directoryPath,
+    const std::string& fileNamePattern)
+  {
+    std::filesystem::path directory = std::filesystem::u8path(directoryPath);
+    if (! std::filesystem::is_directory(directory))
+    {
+      std::stringstream message;
+      message << "Path does not refer to a directory: " << directoryPath;
+      throw std::invalid_argument(message.str());
+    }
+
+    std::vector<std::string> filePaths;
+    for (const auto& directoryEntry : std::filesystem::recursive_directory_iterator(directory))
+    {
+      if (! directoryEntry.is_regular_file())
+        continue;
+      if (! StringMatchesWildcardPattern(directoryEntry.path().filename().u8string(), fileNamePattern))
+        continue;
+
+      filePaths.push_back(directoryEntry.path().u8string());
+    }
+
+    std::sort(filePaths.begin(), filePaths.end());
+
+    return filePaths;
+  }
 }
@@ -28,6 +28,7 @@
 #include "../include/SgfcTypedefs.h"
 
 // C++ Standard Library includes
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -206,6 +207,13 @@ namespace LibSgfcPlusPlus
     /// sensitive.
     static bool StringEndsWith(const std::string& string, const std::string& suffix);
 
+    /// @brief Returns true if @a string matches the wildcard pattern
+    /// @a pattern. Returns false if @a string does not match @a pattern. In
+    /// @a pattern the character "*" matches any sequence of characters,
+    /// including the empty sequence, and the character "?" matches any
+    /// single character. Comparison is case sensitive.
+    static bool StringMatchesWildcardPattern(const std::string& string, const std::string& pattern);
+
     /// @brief Splits @a string into substrings using the single character
     /// @a delimiter as the delimiter.
     static std::vector<std::string> SplitString(const std::string& string, char delimiter);
@@ -217,6 +225,11 @@ namespace LibSgfcPlusPlus
     /// @brief Returns a newly generated random UUID.
     static std::string CreateUuid();
 
+    /// @brief Returns the 64-bit FNV-1a hash of the bytes of @a data. The
+    /// hash is fast to compute and does not depend on the platform, but it is
+    /// not a cryptographic hash.
+    static std::uint64_t GetHash(const std::string& data);
+
     /// @brief Makes sure that the file located at @a path in the filesystem
     /// exists and has zero length. If the file does not exist it is created.
     /// If the file already exists it is truncated to zero length.
@@ -248,5 +261,28 @@ namespace LibSgfcPlusPlus
     /// @exception std::runtime_error Is thrown if the file cannot be opened
     /// for reading for any reason.
     static std::string ReadFileContent(const std::string& path);
+
+    /// @brief Returns the paths of all files with the extension ".sgf" that
+    /// are located in the directory @a directoryPath or in one of its
+    /// subdirectories. The paths are sorted, so that the result does not
+    /// depend on the order in which the filesystem enumerates directories.
+    /// The returned path strings are UTF-8 encoded.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a directoryPath does not
+    /// refer to a directory.
+    static std::vector<std::string> GetSgfFilePathsInDirectory(const std::string& directoryPath);
+
+    /// @brief Returns the paths of all files whose name matches the wildcard
+    /// pattern @a fileNamePattern (see StringMatchesWildcardPattern()) and
+    /// that are located in the directory @a directoryPath or in one of its
+    /// subdirectories. The paths are sorted, so that the result does not
+    /// depend on the order in which the filesystem enumerates directories.
+    /// The returned path strings are UTF-8 encoded.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a directoryPath does not
+    /// refer to a directory.
+    static std::vector<std::string> GetFilePathsInDirectory(
+      const std::string& directoryPath,
+      const std::string& fileNamePattern);
   };
 }
@@ -10,9 +10,12 @@ set (
 
 set (
   SOURCES
+  document/SgfcBinaryDocumentReader.cpp
+  document/SgfcBinaryDocumentWriter.cpp
   document/SgfcComposedPropertyValue.cpp
   document/SgfcDocument.cpp
   document/SgfcGame.cpp
+  document/SgfcGamePropertyIndex.cpp
   document/SgfcNode.cpp
   document/SgfcNodeIterator.cpp
   document/SgfcNodeTraits.cpp
@@ -41,19 +44,37 @@ set (
   game/SgfcBoardSize.cpp
   game/SgfcDate.cpp
   game/SgfcGameInfo.cpp
+  game/SgfcGameInfoCatalog.cpp
+  game/SgfcGameInfoCatalogWriter.cpp
   game/SgfcGameResult.cpp
   game/SgfcGameUtility.cpp
   game/SgfcRoundInformation.cpp
+  game/go/SgfcGoBitboard.cpp
   game/go/SgfcGoGameInfo.cpp
   game/go/SgfcGoMove.cpp
+  game/go/SgfcGoOpeningTreeBuilder.cpp
   game/go/SgfcGoPlayerRank.cpp
   game/go/SgfcGoPoint.cpp
+  game/go/SgfcGoPosition.cpp
+  game/go/SgfcGoPositionCache.cpp
+  game/go/SgfcGoPositionIndex.cpp
+  game/go/SgfcGoPositionIndexFileWriter.cpp
+  game/go/SgfcGoPositionIndexWriter.cpp
+  game/go/SgfcGoReplayEngine.cpp
   game/go/SgfcGoRuleset.cpp
   game/go/SgfcGoStone.cpp
+  game/go/SgfcGoZobristTable.cpp
   interface/internal/ISgfcPropertyValueTypeDescriptor.cpp
   interface/public/ISgfcArgument.cpp
+  interface/public/ISgfcArchiveReader.cpp
   interface/public/ISgfcArguments.cpp
+  interface/public/ISgfcBatchDocumentReader.cpp
+  interface/public/ISgfcBatchDocumentWriter.cpp
+  interface/public/ISgfcBinaryDocumentReader.cpp
+  interface/public/ISgfcBinaryDocumentWriter.cpp
   interface/public/ISgfcBoardSizeProperty.cpp
+  interface/public/ISgfcCachingDocumentReader.cpp
+  interface/public/ISgfcCollectionReader.cpp
   interface/public/ISgfcColorPropertyValue.cpp
   interface/public/ISgfcCommandLine.cpp
   interface/public/ISgfcComposedPropertyValue.cpp
@@ -65,18 +86,29 @@ set (
   interface/public/ISgfcDoublePropertyValue.cpp
   interface/public/ISgfcGame.cpp
   interface/public/ISgfcGameInfo.cpp
+  interface/public/ISgfcGameInfoCatalog.cpp
+  interface/public/ISgfcGameInfoCatalogWriter.cpp
+  interface/public/ISgfcGameInfoScanner.cpp
   interface/public/ISgfcGameTypeProperty.cpp
   interface/public/ISgfcGoGameInfo.cpp
   interface/public/ISgfcGoMove.cpp
   interface/public/ISgfcGoMovePropertyValue.cpp
+  interface/public/ISgfcGoOpeningTreeBuilder.cpp
   interface/public/ISgfcGoPoint.cpp
   interface/public/ISgfcGoPointPropertyValue.cpp
+  interface/public/ISgfcGoPosition.cpp
+  interface/public/ISgfcGoPositionIndex.cpp
+  interface/public/ISgfcGoPositionIndexWriter.cpp
+  interface/public/ISgfcGoReplayEngine.cpp
   interface/public/ISgfcGoStone.cpp
   interface/public/ISgfcGoStonePropertyValue.cpp
+  interface/public/ISgfcMemoryCachingDocumentReader.cpp
   interface/public/ISgfcMessage.cpp
   interface/public/ISgfcMovePropertyValue.cpp
   interface/public/ISgfcNode.cpp
   interface/public/ISgfcNumberPropertyValue.cpp
+  interface/public/ISgfcParseEventHandler.cpp
+  interface/public/ISgfcParseEventReader.cpp
   interface/public/ISgfcPointPropertyValue.cpp
   interface/public/ISgfcProperty.cpp
   interface/public/ISgfcPropertyFactory.cpp
@@ -89,6 +121,9 @@ set (
   interface/public/ISgfcTextPropertyValue.cpp
   interface/public/ISgfcTreeBuilder.cpp
   parsing/SgfcDocumentEncoder.cpp
+  parsing/SgfcDocumentEncoderCache.cpp
+  parsing/SgfcHeaderScanner.cpp
+  parsing/SgfcParseEventGenerator.cpp
   parsing/SgfcPropertyDecoder.cpp
   parsing/SgfcPropertyValueTypeDescriptorConstants.cpp
   parsing/SgfcValueConverter.cpp
@@ -103,17 +138,30 @@ set (
   sgfc/backend/SgfcBackendDataWrapper.cpp
   sgfc/backend/SgfcBackendLoadResult.cpp
   sgfc/backend/SgfcBackendSaveResult.cpp
+  sgfc/backend/SgfcCompressionUtility.cpp
+  sgfc/backend/SgfcDecompressingInputStream.cpp
   sgfc/backend/SgfcOptions.cpp
+  sgfc/frontend/SgfcArchiveReader.cpp
+  sgfc/frontend/SgfcBatchDocumentReader.cpp
+  sgfc/frontend/SgfcBatchDocumentWriter.cpp
+  sgfc/frontend/SgfcCachingDocumentReader.cpp
+  sgfc/frontend/SgfcCollectionReader.cpp
   sgfc/frontend/SgfcCommandLine.cpp
+  sgfc/frontend/SgfcDocumentCacheUtility.cpp
   sgfc/frontend/SgfcDocumentReadResult.cpp
   sgfc/frontend/SgfcDocumentReader.cpp
   sgfc/frontend/SgfcDocumentWriteResult.cpp
   sgfc/frontend/SgfcDocumentWriter.cpp
+  sgfc/frontend/SgfcGameInfoScanner.cpp
+  sgfc/frontend/SgfcMemoryCachingDocumentReader.cpp
+  sgfc/frontend/SgfcParseEventReader.cpp
   sgfc/message/SgfcMessage.cpp
   sgfc/message/SgfcMessageStream.cpp
   sgfc/save/SgfcSaveStream.cpp
   sgfc/save/SgfcSgfContent.cpp
+  SgfcBinaryUtility.cpp
   SgfcConstants.cpp
+  SgfcParallelUtility.cpp
   SgfcPrivateConstants.cpp
   SgfcUtility.cpp
   ${PACKAGE_CONFIG_FILE_IN}
@@ -122,9 +170,14 @@ set (
 
 set (
   HEADERS_PRIVATE
+  document/SgfcBinaryDocumentColumns.h
+  document/SgfcBinaryDocumentReader.h
+  document/SgfcBinaryDocumentValueKind.h
+  document/SgfcBinaryDocumentWriter.h
   document/SgfcComposedPropertyValue.h
   document/SgfcDocument.h
   document/SgfcGame.h
+  document/SgfcGamePropertyIndex.h
   document/SgfcNode.h
   document/SgfcNodeIterator.h
   document/SgfcProperty.h
@@ -148,14 +201,30 @@ set (
   factory/SgfcPropertyFactory.h
   factory/SgfcPropertyValueFactory.h
   game/SgfcGameInfo.h
+  game/SgfcGameInfoCatalog.h
+  game/SgfcGameInfoCatalogWriter.h
   game/SgfcGameUtility.h
+  game/go/SgfcGoBitboard.h
   game/go/SgfcGoGameInfo.h
   game/go/SgfcGoMove.h
+  game/go/SgfcGoOpeningTreeBuilder.h
   game/go/SgfcGoPoint.h
+  game/go/SgfcGoPosition.h
+  game/go/SgfcGoPositionCache.h
+  game/go/SgfcGoPositionIndex.h
+  game/go/SgfcGoPositionIndexFileWriter.h
+  game/go/SgfcGoPositionIndexNode.h
+  game/go/SgfcGoPositionIndexRecord.h
+  game/go/SgfcGoPositionIndexWriter.h
+  game/go/SgfcGoReplayEngine.h
   game/go/SgfcGoStone.h
+  game/go/SgfcGoZobristTable.h
   interface/internal/ISgfcPropertyValueTypeDescriptor.h
   interface/internal/SgfcPropertyValueTypeDescriptorType.h
   parsing/SgfcDocumentEncoder.h
+  parsing/SgfcDocumentEncoderCache.h
+  parsing/SgfcHeaderScanner.h
+  parsing/SgfcParseEventGenerator.h
   parsing/SgfcPropertyDecoder.h
   parsing/SgfcPropertyValueTypeDescriptorConstants.h
   parsing/SgfcSinglePropertyValueContext.h
@@ -172,17 +241,31 @@ set (
   sgfc/backend/SgfcBackendDataWrapper.h
   sgfc/backend/SgfcBackendLoadResult.h
   sgfc/backend/SgfcBackendSaveResult.h
+  sgfc/backend/SgfcCompressionFormat.h
+  sgfc/backend/SgfcCompressionUtility.h
   sgfc/backend/SgfcDataLocation.h
+  sgfc/backend/SgfcDecompressingInputStream.h
   sgfc/backend/SgfcOptions.h
+  sgfc/frontend/SgfcArchiveReader.h
+  sgfc/frontend/SgfcBatchDocumentReader.h
+  sgfc/frontend/SgfcBatchDocumentWriter.h
+  sgfc/frontend/SgfcCachingDocumentReader.h
+  sgfc/frontend/SgfcCollectionReader.h
   sgfc/frontend/SgfcCommandLine.h
+  sgfc/frontend/SgfcDocumentCacheUtility.h
   sgfc/frontend/SgfcDocumentReadResult.h
   sgfc/frontend/SgfcDocumentReader.h
   sgfc/frontend/SgfcDocumentWriteResult.h
   sgfc/frontend/SgfcDocumentWriter.h
+  sgfc/frontend/SgfcGameInfoScanner.h
+  sgfc/frontend/SgfcMemoryCachingDocumentReader.h
+  sgfc/frontend/SgfcParseEventReader.h
   sgfc/message/SgfcMessage.h
   sgfc/message/SgfcMessageStream.h
   sgfc/save/SgfcSaveStream.h
   sgfc/save/SgfcSgfContent.h
+  SgfcBinaryUtility.h
+  SgfcParallelUtility.h
   SgfcPrivateConstants.h
   SgfcUtility.h
 )
@@ -201,8 +284,15 @@ set (
   HEADERS_PUBLIC
   ${EXPORT_HEADER_FILE_FOLDER}/${EXPORT_HEADER_FILE_NAME}
   ${HEADERS_PUBLIC_FOLDER}/ISgfcArgument.h
+  ${HEADERS_PUBLIC_FOLDER}/ISgfcArchiveReader.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcArguments.h
+  ${HEADERS_PUBLIC_FOLDER}/ISgfcBatchDocumentReader.h
+  ${HEADERS_PUBLIC_FOLDER}/ISgfcBatchDocumentWriter.h
+  ${HEADERS_PUBLIC_FOLDER}/ISgfcBinaryDocumentReader.h
+  ${HEADERS_PUBLIC_FOLDER}/ISgfcBinaryDocumentWriter.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcBoardSizeProperty.h
+  ${HEADERS_PUBLIC_FOLDER}/ISgfcCachingDocumentReader.h
+  ${HEADERS_PUBLIC_FOLDER}/ISgfcCollectionReader.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcColorPropertyValue.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcCommandLine.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcComposedPropertyValue.h
@@ -214,18 +304,29 @@ set (
   ${HEADERS_PUBLIC_FOLDER}/ISgfcDoublePropertyValue.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcGame.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcGameInfo.h
+  ${HEADERS_PUBLIC_FOLDER}/ISgfcGameInfoCatalog.h
+  ${HEADERS_PUBLIC_FOLDER}/ISgfcGameInfoCatalogWriter.h
+  ${HEADERS_PUBLIC_FOLDER}/ISgfcGameInfoScanner.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcGameTypeProperty.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcGoGameInfo.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcGoMove.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcGoMovePropertyValue.h
+  ${HEADERS_PUBLIC_FOLDER}/ISgfcGoOpeningTreeBuilder.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcGoPoint.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcGoPointPropertyValue.h
+  ${HEADERS_PUBLIC_FOLDER}/ISgfcGoPosition.h
+  ${HEADERS_PUBLIC_FOLDER}/ISgfcGoPositionIndex.h
+  ${HEADERS_PUBLIC_FOLDER}/ISgfcGoPositionIndexWriter.h
+  ${HEADERS_PUBLIC_FOLDER}/ISgfcGoReplayEngine.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcGoStone.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcGoStonePropertyValue.h
+  ${HEADERS_PUBLIC_FOLDER}/ISgfcMemoryCachingDocumentReader.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcMessage.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcMovePropertyValue.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcNode.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcNumberPropertyValue.h
+  ${HEADERS_PUBLIC_FOLDER}/ISgfcParseEventHandler.h
+  ${HEADERS_PUBLIC_FOLDER}/ISgfcParseEventReader.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcPointPropertyValue.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcProperty.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcPropertyFactory.h
@@ -237,28 +338,46 @@ set (
   ${HEADERS_PUBLIC_FOLDER}/ISgfcStonePropertyValue.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcTextPropertyValue.h
   ${HEADERS_PUBLIC_FOLDER}/ISgfcTreeBuilder.h
+  ${HEADERS_PUBLIC_FOLDER}/SgfcArchiveEntryReadResult.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcArgumentType.h
+  ${HEADERS_PUBLIC_FOLDER}/SgfcBatchReadOptions.h
+  ${HEADERS_PUBLIC_FOLDER}/SgfcBatchReadResult.h
+  ${HEADERS_PUBLIC_FOLDER}/SgfcBatchWriteOptions.h
+  ${HEADERS_PUBLIC_FOLDER}/SgfcBatchWriteResult.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcBoardSize.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcColor.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcConstants.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcCoordinateSystem.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcDate.h
+  ${HEADERS_PUBLIC_FOLDER}/SgfcDocumentCacheKeyType.h
+  ${HEADERS_PUBLIC_FOLDER}/SgfcDocumentCacheStatistics.h
+  ${HEADERS_PUBLIC_FOLDER}/SgfcDocumentReadOptions.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcDouble.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcExitCode.h
+  ${HEADERS_PUBLIC_FOLDER}/SgfcGameInfoCatalogEntry.h
+  ${HEADERS_PUBLIC_FOLDER}/SgfcGameInfoCatalogQuery.h
+  ${HEADERS_PUBLIC_FOLDER}/SgfcGameInfoScanResult.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcGameResult.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcGameResultType.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcGameType.h
+  ${HEADERS_PUBLIC_FOLDER}/SgfcGoMoveBuffers.h
+  ${HEADERS_PUBLIC_FOLDER}/SgfcGoMoveLegality.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcGoPlayerRank.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcGoPlayerRankType.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcGoPlayerRatingType.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcGoPointNotation.h
+  ${HEADERS_PUBLIC_FOLDER}/SgfcGoPositionIndexEntry.h
+  ${HEADERS_PUBLIC_FOLDER}/SgfcGoReplayResult.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcGoRuleset.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcGoRulesetType.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcMessageID.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcMessageType.h
+  ${HEADERS_PUBLIC_FOLDER}/SgfcNodeChange.h
+  ${HEADERS_PUBLIC_FOLDER}/SgfcNodeChangeType.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcNodeTraits.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcPlusPlusFactory.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcPropertyCategory.h
+  ${HEADERS_PUBLIC_FOLDER}/SgfcPropertyFilterMode.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcPropertyTraits.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcPropertyType.h
   ${HEADERS_PUBLIC_FOLDER}/SgfcPropertyValueType.h
@@ -0,0 +1,98 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcBinaryDocumentColumns struct is a simple type that holds
+  /// the content of a binary document in the flattened, columnar form in
+  /// which it is stored by SgfcBinaryDocumentWriter and loaded by
+  /// SgfcBinaryDocumentReader.
+  ///
+  /// @ingroup internals
+  /// @ingroup document
+  ///
+  /// Games are stored in document order. The nodes of all games are stored
+  /// in depth-first pre-order, game after game. The properties of all nodes
+  /// are stored node after node, the property values of all properties are
+  /// stored property after property, and the single values of all property
+  /// values are stored property value after property value. A composed
+  /// property value has two single values, all other property values have
+  /// one single value. Values that refer to a string are references into
+  /// @e Strings.
+  struct SgfcBinaryDocumentColumns
+  {
+  public:
+    /// @brief The string dictionary. Every distinct string is stored once.
+    std::vector<std::string> Strings;
+
+    /// @brief For each game the number of nodes in the game tree. 0 means
+    /// that the game has no root node.
+    std::vector<std::uint32_t> GameNumberOfNodes;
+
+    /// @brief For each node the number of child nodes.
+    std::vector<std::uint32_t> NodeNumberOfChildren;
+    /// @brief For each node the number of properties.
+    std::vector<std::uint32_t> NodeNumberOfProperties;
+
+    /// @brief For each property 1 if the property is an instance of the
+    /// property class that best fits the property type (e.g.
+    /// ISgfcBoardSizeProperty), 0 if it is a generic property object.
+    std::vector<std::uint8_t> PropertyIsTypedProperty;
+    /// @brief For each property the SgfcPropertyType value.
+    std::vector<std::uint32_t> PropertyType;
+    /// @brief For each property a reference to the property name.
+    std::vector<std::uint32_t> PropertyName;
+    /// @brief For each property the number of property values.
+    std::vector<std::uint32_t> PropertyNumberOfValues;
+
+    /// @brief For each property value 1 if the value is a composed value, 0
+    /// if it is a single value.
+    std::vector<std::uint8_t> PropertyValueIsComposed;
+
+    /// @brief For each single value the SgfcBinaryDocumentValueKind value.
+    std::vector<std::uint8_t> SingleValueKind;
+    /// @brief For each single value an attribute whose meaning depends on the
+    /// value kind: The SgfcPropertyValueType value for
+    /// SgfcBinaryDocumentValueKind::Basic, the SgfcColor value for
+    /// SgfcBinaryDocumentValueKind::GoMove and
+    /// SgfcBinaryDocumentValueKind::GoStone, 0 for all other kinds.
+    std::vector<std::uint8_t> SingleValueAttribute;
+    /// @brief For each single value a reference to the raw value.
+    std::vector<std::uint32_t> SingleValueRawValue;
+    /// @brief For each single value a reference to a string whose meaning
+    /// depends on the value kind: The type conversion error message for
+    /// SgfcBinaryDocumentValueKind::Basic, the typed value for the kinds
+    /// whose typed value is a string, the empty string for all other kinds.
+    std::vector<std::uint32_t> SingleValueText;
+    /// @brief For each single value a number whose meaning depends on the
+    /// value kind: 1 or 0 for SgfcBinaryDocumentValueKind::Basic (the
+    /// value has a typed value or not), the typed value for
+    /// SgfcBinaryDocumentValueKind::Number (two's complement),
+    /// SgfcBinaryDocumentValueKind::Double and
+    /// SgfcBinaryDocumentValueKind::Color (enumeration value), the bit
+    /// pattern of the typed value for SgfcBinaryDocumentValueKind::Real,
+    /// the number of rows of the board for the Go kinds (0 for a pass move),
+    /// 0 for all other kinds.
+    std::vector<std::uint64_t> SingleValueNumber;
+  };
+}
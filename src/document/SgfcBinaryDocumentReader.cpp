@@ -0,0 +1,490 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../include/ISgfcPropertyFactory.h"
+#include "../../include/SgfcConstants.h"
+#include "../../include/SgfcPlusPlusFactory.h"
+#include "../game/go/SgfcGoMove.h"
+#include "../game/go/SgfcGoPoint.h"
+#include "../game/go/SgfcGoStone.h"
+#include "../SgfcBinaryUtility.h"
+#include "../SgfcPrivateConstants.h"
+#include "typedpropertyvalue/go/SgfcGoMovePropertyValue.h"
+#include "typedpropertyvalue/go/SgfcGoPointPropertyValue.h"
+#include "typedpropertyvalue/go/SgfcGoStonePropertyValue.h"
+#include "typedpropertyvalue/SgfcColorPropertyValue.h"
+#include "typedpropertyvalue/SgfcDoublePropertyValue.h"
+#include "typedpropertyvalue/SgfcMovePropertyValue.h"
+#include "typedpropertyvalue/SgfcNumberPropertyValue.h"
+#include "typedpropertyvalue/SgfcPointPropertyValue.h"
+#include "typedpropertyvalue/SgfcRealPropertyValue.h"
+#include "typedpropertyvalue/SgfcSimpleTextPropertyValue.h"
+#include "typedpropertyvalue/SgfcStonePropertyValue.h"
+#include "typedpropertyvalue/SgfcTextPropertyValue.h"
+#include "SgfcBinaryDocumentReader.h"
+#include "SgfcBinaryDocumentValueKind.h"
+#include "SgfcComposedPropertyValue.h"
+#include "SgfcDocument.h"
+#include "SgfcNode.h"
+#include "SgfcProperty.h"
+#include "SgfcSinglePropertyValue.h"
+
+// C++ Standard Library includes
+#include <cstring>  // for std::memcpy()
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stack>
+#include <stdexcept>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcBinaryDocumentReader::SgfcBinaryDocumentReader()
+  {
+  }
+
+  SgfcBinaryDocumentReader::~SgfcBinaryDocumentReader()
+  {
+  }
+
+  std::shared_ptr<ISgfcDocument> SgfcBinaryDocumentReader::ReadBinaryFile(const std::string& binaryFilePath) const
+  {
+    std::ifstream in(std::filesystem::u8path(binaryFilePath), std::ios::binary | std::ios::ate);
+    if (! in.is_open())
+    {
+      std::stringstream message;
+      message << "Failed to open file for reading: " << binaryFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    std::streamoff dataSize = in.tellg();
+    in.seekg(0, std::ios::beg);
+    if (dataSize < 0 || ! in.good())
+    {
+      std::stringstream message;
+      message << "Failed to read file: " << binaryFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    return ReadDocument(in, static_cast<std::uint64_t>(dataSize));
+  }
+
+  std::shared_ptr<ISgfcDocument> SgfcBinaryDocumentReader::ReadBinaryContent(const std::string& binaryContent) const
+  {
+    std::istringstream in(binaryContent, std::ios::binary);
+    return ReadDocument(in, binaryContent.size());
+  }
+
+  std::shared_ptr<ISgfcDocument> SgfcBinaryDocumentReader::ReadDocument(std::istream& in, std::uint64_t dataSize) const
+  {
+    SgfcBinaryDocumentColumns columns = ReadColumns(in, dataSize);
+    ValidateColumns(columns);
+
+    try
+    {
+      return CreateDocument(columns);
+    }
+    catch (std::invalid_argument& exception)
+    {
+      // The object constructors reject values that a correct writer would
+      // never have stored
+      ThrowDataIsCorrupt(exception.what());
+      return nullptr;
+    }
+  }
+
+  SgfcBinaryDocumentColumns SgfcBinaryDocumentReader::ReadColumns(std::istream& in, std::uint64_t dataSize)
+  {
+    if (dataSize < SgfcPrivateConstants::BinaryDocumentHeaderSize)
+      throw std::runtime_error("Data is not a binary document");
+
+    std::string magic = SgfcBinaryUtility::ReadCharacters(in, SgfcPrivateConstants::BinaryDocumentMagic.size());
+    if (magic != SgfcPrivateConstants::BinaryDocumentMagic)
+      throw std::runtime_error("Data is not a binary document");
+
+    std::uint32_t formatVersion = SgfcBinaryUtility::ReadUInt32(in);
+    if (formatVersion != SgfcPrivateConstants::BinaryDocumentFormatVersion)
+    {
+      std::stringstream message;
+      message << "Binary document has unsupported format version " << formatVersion;
+      throw std::runtime_error(message.str());
+    }
+
+    // Flags are reserved for future use
+    SgfcBinaryUtility::ReadUInt32(in);
+
+    std::uint64_t numberOfStrings = SgfcBinaryUtility::ReadUInt64(in);
+    std::uint64_t numberOfGames = SgfcBinaryUtility::ReadUInt64(in);
+    std::uint64_t numberOfNodes = SgfcBinaryUtility::ReadUInt64(in);
+    std::uint64_t numberOfProperties = SgfcBinaryUtility::ReadUInt64(in);
+    std::uint64_t numberOfPropertyValues = SgfcBinaryUtility::ReadUInt64(in);
+    std::uint64_t numberOfSingleValues = SgfcBinaryUtility::ReadUInt64(in);
+
+    // Every element takes up at least one byte, so checking the counts
+    // individually first guarantees that the size calculation below cannot
+    // overflow
+    for (std::uint64_t count : { numberOfStrings, numberOfGames, numberOfNodes, numberOfProperties, numberOfPropertyValues, numberOfSingleValues })
+    {
+      if (count > dataSize)
+        ThrowDataIsCorrupt("Count exceeds data size");
+    }
+
+    std::uint64_t minimumDataSize =
+      SgfcPrivateConstants::BinaryDocumentHeaderSize +
+      numberOfStrings * 4 +
+      numberOfGames * 4 +
+      numberOfNodes * (4 + 4) +
+      numberOfProperties * (1 + 4 + 4 + 4) +
+      numberOfPropertyValues * 1 +
+      numberOfSingleValues * (1 + 1 + 4 + 4 + 8);
+    if (minimumDataSize > dataSize)
+      ThrowDataIsCorrupt("Data is truncated");
+
+    SgfcBinaryDocumentColumns columns;
+
+    std::vector<std::uint32_t> stringLengths = SgfcBinaryUtility::ReadUInt32Vector(in, numberOfStrings);
+    std::uint64_t sumOfStringLengths = 0;
+    for (auto stringLength : stringLengths)
+      sumOfStringLengths += stringLength;
+    if (sumOfStringLengths > dataSize - minimumDataSize)
+      ThrowDataIsCorrupt("Data is truncated");
+
+    std::string stringBytes = SgfcBinaryUtility::ReadCharacters(in, sumOfStringLengths);
+    columns.Strings.reserve(numberOfStrings);
+    std::size_t stringOffset = 0;
+    for (auto stringLength : stringLengths)
+    {
+      columns.Strings.push_back(stringBytes.substr(stringOffset, stringLength));
+      stringOffset += stringLength;
+    }
+
+    columns.GameNumberOfNodes = SgfcBinaryUtility::ReadUInt32Vector(in, numberOfGames);
+    columns.NodeNumberOfChildren = SgfcBinaryUtility::ReadUInt32Vector(in, numberOfNodes);
+    columns.NodeNumberOfProperties = SgfcBinaryUtility::ReadUInt32Vector(in, numberOfNodes);
+    columns.PropertyIsTypedProperty = SgfcBinaryUtility::ReadUInt8Vector(in, numberOfProperties);
+    columns.PropertyType = SgfcBinaryUtility::ReadUInt32Vector(in, numberOfProperties);
+    columns.PropertyName = SgfcBinaryUtility::ReadUInt32Vector(in, numberOfProperties);
+    columns.PropertyNumberOfValues = SgfcBinaryUtility::ReadUInt32Vector(in, numberOfProperties);
+    columns.PropertyValueIsComposed = SgfcBinaryUtility::ReadUInt8Vector(in, numberOfPropertyValues);
+    columns.SingleValueKind = SgfcBinaryUtility::ReadUInt8Vector(in, numberOfSingleValues);
+    columns.SingleValueAttribute = SgfcBinaryUtility::ReadUInt8Vector(in, numberOfSingleValues);
+    columns.SingleValueRawValue = SgfcBinaryUtility::ReadUInt32Vector(in, numberOfSingleValues);
+    columns.SingleValueText = SgfcBinaryUtility::ReadUInt32Vector(in, numberOfSingleValues);
+    columns.SingleValueNumber = SgfcBinaryUtility::ReadUInt64Vector(in, numberOfSingleValues);
+
+    return columns;
+  }
+
+  void SgfcBinaryDocumentReader::ValidateColumns(const SgfcBinaryDocumentColumns& columns)
+  {
+    std::uint64_t sumOfNumberOfNodes = 0;
+    for (auto numberOfNodes : columns.GameNumberOfNodes)
+      sumOfNumberOfNodes += numberOfNodes;
+    if (sumOfNumberOfNodes != columns.NodeNumberOfChildren.size())
+      ThrowDataIsCorrupt("Number of nodes does not match");
+
+    std::uint64_t sumOfNumberOfProperties = 0;
+    for (auto numberOfProperties : columns.NodeNumberOfProperties)
+      sumOfNumberOfProperties += numberOfProperties;
+    if (sumOfNumberOfProperties != columns.PropertyType.size())
+      ThrowDataIsCorrupt("Number of properties does not match");
+
+    std::uint64_t sumOfNumberOfPropertyValues = 0;
+    for (auto numberOfPropertyValues : columns.PropertyNumberOfValues)
+      sumOfNumberOfPropertyValues += numberOfPropertyValues;
+    if (sumOfNumberOfPropertyValues != columns.PropertyValueIsComposed.size())
+      ThrowDataIsCorrupt("Number of property values does not match");
+
+    std::uint64_t sumOfNumberOfSingleValues = 0;
+    for (auto isComposed : columns.PropertyValueIsComposed)
+      sumOfNumberOfSingleValues += (isComposed ? 2 : 1);
+    if (sumOfNumberOfSingleValues != columns.SingleValueKind.size())
+      ThrowDataIsCorrupt("Number of single values does not match");
+
+    // Enum values are cast without further checks when the document is
+    // created, and some of the consumers use them as indexes, so values
+    // outside of the enum's range must be rejected here
+    for (auto propertyType : columns.PropertyType)
+    {
+      if (propertyType > static_cast<std::uint32_t>(SgfcPropertyType::Unknown))
+        ThrowDataIsCorrupt("Property type is out of range");
+    }
+
+    for (std::size_t singleValueIndex = 0; singleValueIndex < columns.SingleValueKind.size(); singleValueIndex++)
+    {
+      std::uint8_t valueKind = columns.SingleValueKind[singleValueIndex];
+      std::uint8_t attribute = columns.SingleValueAttribute[singleValueIndex];
+      std::uint64_t number = columns.SingleValueNumber[singleValueIndex];
+
+      if (valueKind > static_cast<std::uint8_t>(SgfcBinaryDocumentValueKind::GoStone))
+        ThrowDataIsCorrupt("Unknown value kind");
+
+      switch (static_cast<SgfcBinaryDocumentValueKind>(valueKind))
+      {
+        case SgfcBinaryDocumentValueKind::Basic:
+          if (attribute > static_cast<std::uint8_t>(SgfcPropertyValueType::Unknown))
+            ThrowDataIsCorrupt("Property value type is out of range");
+          break;
+        case SgfcBinaryDocumentValueKind::Double:
+          if (number > static_cast<std::uint64_t>(SgfcDouble::Emphasized))
+            ThrowDataIsCorrupt("Double value is out of range");
+          break;
+        case SgfcBinaryDocumentValueKind::Color:
+          if (number > static_cast<std::uint64_t>(SgfcColor::White))
+            ThrowDataIsCorrupt("Color is out of range");
+          break;
+        case SgfcBinaryDocumentValueKind::GoMove:
+        case SgfcBinaryDocumentValueKind::GoStone:
+          if (attribute > static_cast<std::uint8_t>(SgfcColor::White))
+            ThrowDataIsCorrupt("Color is out of range");
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+  std::shared_ptr<ISgfcDocument> SgfcBinaryDocumentReader::CreateDocument(const SgfcBinaryDocumentColumns& columns)
+  {
+    auto propertyFactory = SgfcPlusPlusFactory::CreatePropertyFactory();
+
+    std::size_t nodeIndex = 0;
+    std::size_t propertyIndex = 0;
+    std::size_t propertyValueIndex = 0;
+    std::size_t singleValueIndex = 0;
+
+    std::vector<std::shared_ptr<ISgfcGame>> games;
+    games.reserve(columns.GameNumberOfNodes.size());
+
+    for (auto numberOfNodes : columns.GameNumberOfNodes)
+    {
+      if (numberOfNodes == 0)
+      {
+        auto game = SgfcPlusPlusFactory::CreateGame();
+        game->SetRootNode(nullptr);
+        games.push_back(game);
+      }
+      else
+      {
+        // The game tree is built completely before it is handed over to the
+        // game, so that the nodes can be linked directly without the checks
+        // and the cache invalidations that ISgfcTreeBuilder performs
+        auto rootNode = CreateNodes(
+          columns,
+          numberOfNodes,
+          nodeIndex,
+          propertyIndex,
+          propertyValueIndex,
+          singleValueIndex,
+          *propertyFactory);
+
+        games.push_back(SgfcPlusPlusFactory::CreateGame(rootNode));
+      }
+    }
+
+    std::shared_ptr<ISgfcDocument> document = std::shared_ptr<ISgfcDocument>(new SgfcDocument());
+    document->SetGames(games);
+    return document;
+  }
+
+  std::shared_ptr<ISgfcNode> SgfcBinaryDocumentReader::CreateNodes(
+    const SgfcBinaryDocumentColumns& columns,
+    std::size_t numberOfNodes,
+    std::size_t& nodeIndex,
+    std::size_t& propertyIndex,
+    std::size_t& propertyValueIndex,
+    std::size_t& singleValueIndex,
+    const ISgfcPropertyFactory& propertyFactory)
+  {
+    struct ParentEntry
+    {
+      std::shared_ptr<SgfcNode> Node;
+      std::shared_ptr<SgfcNode> LastChild;
+      std::uint32_t NumberOfMissingChildren;
+    };
+
+    std::stack<ParentEntry> parentEntries;
+    std::shared_ptr<SgfcNode> rootNode;
+
+    for (std::size_t nodeNumber = 0; nodeNumber < numberOfNodes; nodeNumber++, nodeIndex++)
+    {
+      auto node = std::shared_ptr<SgfcNode>(new SgfcNode());
+
+      if (nodeNumber == 0)
+      {
+        rootNode = node;
+      }
+      else
+      {
+        while (! parentEntries.empty() && parentEntries.top().NumberOfMissingChildren == 0)
+          parentEntries.pop();
+        if (parentEntries.empty())
+          ThrowDataIsCorrupt("Node has no parent");
+
+        ParentEntry& parentEntry = parentEntries.top();
+        if (parentEntry.LastChild == nullptr)
+          parentEntry.Node->SetFirstChild(node);
+        else
+          parentEntry.LastChild->SetNextSibling(node);
+        node->SetParent(parentEntry.Node);
+
+        parentEntry.LastChild = node;
+        parentEntry.NumberOfMissingChildren--;
+      }
+
+      std::vector<std::shared_ptr<ISgfcProperty>> properties;
+      properties.reserve(columns.NodeNumberOfProperties[nodeIndex]);
+
+      for (std::uint32_t propertyNumber = 0; propertyNumber < columns.NodeNumberOfProperties[nodeIndex]; propertyNumber++, propertyIndex++)
+      {
+        std::vector<std::shared_ptr<ISgfcPropertyValue>> propertyValues;
+        propertyValues.reserve(columns.PropertyNumberOfValues[propertyIndex]);
+
+        for (std::uint32_t valueNumber = 0; valueNumber < columns.PropertyNumberOfValues[propertyIndex]; valueNumber++, propertyValueIndex++)
+        {
+          if (columns.PropertyValueIsComposed[propertyValueIndex])
+          {
+            auto value1 = CreateSingleValue(columns, singleValueIndex++);
+            auto value2 = CreateSingleValue(columns, singleValueIndex++);
+            propertyValues.push_back(std::shared_ptr<ISgfcPropertyValue>(new SgfcComposedPropertyValue(value1, value2)));
+          }
+          else
+          {
+            propertyValues.push_back(CreateSingleValue(columns, singleValueIndex++));
+          }
+        }
+
+        SgfcPropertyType propertyType = static_cast<SgfcPropertyType>(columns.PropertyType[propertyIndex]);
+        if (columns.PropertyIsTypedProperty[propertyIndex])
+        {
+          properties.push_back(propertyFactory.CreateProperty(propertyType, propertyValues));
+        }
+        else
+        {
+          const std::string& propertyName = GetString(columns, columns.PropertyName[propertyIndex]);
+          properties.push_back(std::shared_ptr<ISgfcProperty>(new SgfcProperty(propertyType, propertyName, propertyValues)));
+        }
+      }
+
+      node->SetProperties(properties);
+
+      parentEntries.push({ node, nullptr, columns.NodeNumberOfChildren[nodeIndex] });
+    }
+
+    while (! parentEntries.empty())
+    {
+      if (parentEntries.top().NumberOfMissingChildren != 0)
+        ThrowDataIsCorrupt("Node has missing children");
+      parentEntries.pop();
+    }
+
+    return rootNode;
+  }
+
+  std::shared_ptr<ISgfcSinglePropertyValue> SgfcBinaryDocumentReader::CreateSingleValue(
+    const SgfcBinaryDocumentColumns& columns,
+    std::size_t singleValueIndex)
+  {
+    auto valueKind = static_cast<SgfcBinaryDocumentValueKind>(columns.SingleValueKind[singleValueIndex]);
+    std::uint8_t attribute = columns.SingleValueAttribute[singleValueIndex];
+    const std::string& rawValue = GetString(columns, columns.SingleValueRawValue[singleValueIndex]);
+    const std::string& text = GetString(columns, columns.SingleValueText[singleValueIndex]);
+    std::uint64_t number = columns.SingleValueNumber[singleValueIndex];
+
+    // The columns of the board are not relevant for the Go kinds, only the
+    // rows are needed to reconstruct the lower-left origin coordinates
+    SgfcBoardSize goBoardSize = { SgfcConstants::BoardSizeMaximumGo.Columns, static_cast<SgfcNumber>(number) };
+
+    switch (valueKind)
+    {
+      case SgfcBinaryDocumentValueKind::Basic:
+      {
+        auto valueType = static_cast<SgfcPropertyValueType>(attribute);
+        if (number == 1)
+          return std::shared_ptr<ISgfcSinglePropertyValue>(new SgfcSinglePropertyValue(rawValue, valueType));
+        else
+          return std::shared_ptr<ISgfcSinglePropertyValue>(new SgfcSinglePropertyValue(rawValue, valueType, text));
+      }
+      case SgfcBinaryDocumentValueKind::Number:
+        return std::shared_ptr<ISgfcSinglePropertyValue>(new SgfcNumberPropertyValue(
+          rawValue, static_cast<SgfcNumber>(static_cast<std::int64_t>(number))));
+      case SgfcBinaryDocumentValueKind::Real:
+      {
+        SgfcReal realValue;
+        std::memcpy(&realValue, &number, sizeof(realValue));
+        return std::shared_ptr<ISgfcSinglePropertyValue>(new SgfcRealPropertyValue(rawValue, realValue));
+      }
+      case SgfcBinaryDocumentValueKind::Double:
+        return std::shared_ptr<ISgfcSinglePropertyValue>(new SgfcDoublePropertyValue(rawValue, static_cast<SgfcDouble>(number)));
+      case SgfcBinaryDocumentValueKind::Color:
+        return std::shared_ptr<ISgfcSinglePropertyValue>(new SgfcColorPropertyValue(rawValue, static_cast<SgfcColor>(number)));
+      case SgfcBinaryDocumentValueKind::SimpleText:
+        return std::shared_ptr<ISgfcSinglePropertyValue>(new SgfcSimpleTextPropertyValue(rawValue, text));
+      case SgfcBinaryDocumentValueKind::Text:
+        return std::shared_ptr<ISgfcSinglePropertyValue>(new SgfcTextPropertyValue(rawValue, text));
+      case SgfcBinaryDocumentValueKind::Point:
+        return std::shared_ptr<ISgfcSinglePropertyValue>(new SgfcPointPropertyValue(rawValue, text));
+      case SgfcBinaryDocumentValueKind::Move:
+        return std::shared_ptr<ISgfcSinglePropertyValue>(new SgfcMovePropertyValue(rawValue, text));
+      case SgfcBinaryDocumentValueKind::Stone:
+        return std::shared_ptr<ISgfcSinglePropertyValue>(new SgfcStonePropertyValue(rawValue, text));
+      case SgfcBinaryDocumentValueKind::GoPoint:
+        return std::shared_ptr<ISgfcSinglePropertyValue>(new SgfcGoPointPropertyValue(
+          std::shared_ptr<ISgfcGoPoint>(new SgfcGoPoint(rawValue, goBoardSize))));
+      case SgfcBinaryDocumentValueKind::GoMove:
+      {
+        auto color = static_cast<SgfcColor>(attribute);
+        if (number == 0)
+        {
+          return std::shared_ptr<ISgfcSinglePropertyValue>(new SgfcGoMovePropertyValue(
+            std::shared_ptr<ISgfcGoMove>(new SgfcGoMove(color))));
+        }
+        else
+        {
+          return std::shared_ptr<ISgfcSinglePropertyValue>(new SgfcGoMovePropertyValue(
+            std::shared_ptr<ISgfcGoMove>(new SgfcGoMove(
+              std::shared_ptr<ISgfcGoStone>(new SgfcGoStone(
+                color,
+                std::shared_ptr<ISgfcGoPoint>(new SgfcGoPoint(rawValue, goBoardSize))))))));
+        }
+      }
+      case SgfcBinaryDocumentValueKind::GoStone:
+        return std::shared_ptr<ISgfcSinglePropertyValue>(new SgfcGoStonePropertyValue(
+          std::shared_ptr<ISgfcGoStone>(new SgfcGoStone(
+            static_cast<SgfcColor>(attribute),
+            std::shared_ptr<ISgfcGoPoint>(new SgfcGoPoint(rawValue, goBoardSize))))));
+      default:
+        ThrowDataIsCorrupt("Unknown value kind");
+        return nullptr;
+    }
+  }
+
+  const std::string& SgfcBinaryDocumentReader::GetString(const SgfcBinaryDocumentColumns& columns, std::uint32_t stringReference)
+  {
+    if (stringReference >= columns.Strings.size())
+      ThrowDataIsCorrupt("String reference is out of range");
+
+    return columns.Strings[stringReference];
+  }
+
+  void SgfcBinaryDocumentReader::ThrowDataIsCorrupt(const std::string& reason)
+  {
+    std::stringstream message;
+    message << "Binary document data is corrupt: " << reason;
+    throw std::runtime_error(message.str());
+  }
+}
@@ -0,0 +1,81 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../include/ISgfcBinaryDocumentReader.h"
+#include "SgfcBinaryDocumentColumns.h"
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <istream>
+#include <string>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcNode;
+  class ISgfcPropertyFactory;
+  class ISgfcSinglePropertyValue;
+
+  /// @brief The SgfcBinaryDocumentReader class provides an implementation of
+  /// the ISgfcBinaryDocumentReader interface. See the interface header file
+  /// for documentation.
+  ///
+  /// @ingroup internals
+  /// @ingroup document
+  ///
+  /// See SgfcBinaryDocumentWriter for a description of the binary document
+  /// format. Before any column is allocated the counts in the header are
+  /// checked against the size of the data, so that corrupt data cannot cause
+  /// excessive memory allocations. Before the document object tree is built
+  /// the counts in the columns are checked for consistency.
+  class SgfcBinaryDocumentReader : public ISgfcBinaryDocumentReader
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcBinaryDocumentReader object.
+    SgfcBinaryDocumentReader();
+
+    /// @brief Destroys and cleans up the SgfcBinaryDocumentReader object.
+    virtual ~SgfcBinaryDocumentReader();
+
+    virtual std::shared_ptr<ISgfcDocument> ReadBinaryFile(const std::string& binaryFilePath) const override;
+    virtual std::shared_ptr<ISgfcDocument> ReadBinaryContent(const std::string& binaryContent) const override;
+
+  private:
+    std::shared_ptr<ISgfcDocument> ReadDocument(std::istream& in, std::uint64_t dataSize) const;
+
+    static SgfcBinaryDocumentColumns ReadColumns(std::istream& in, std::uint64_t dataSize);
+    static void ValidateColumns(const SgfcBinaryDocumentColumns& columns);
+
+    static std::shared_ptr<ISgfcDocument> CreateDocument(const SgfcBinaryDocumentColumns& columns);
+    static std::shared_ptr<ISgfcNode> CreateNodes(
+      const SgfcBinaryDocumentColumns& columns,
+      std::size_t numberOfNodes,
+      std::size_t& nodeIndex,
+      std::size_t& propertyIndex,
+      std::size_t& propertyValueIndex,
+      std::size_t& singleValueIndex,
+      const ISgfcPropertyFactory& propertyFactory);
+    static std::shared_ptr<ISgfcSinglePropertyValue> CreateSingleValue(
+      const SgfcBinaryDocumentColumns& columns,
+      std::size_t singleValueIndex);
+    static const std::string& GetString(const SgfcBinaryDocumentColumns& columns, std::uint32_t stringReference);
+
+    static void ThrowDataIsCorrupt(const std::string& reason);
+  };
+}
@@ -0,0 +1,62 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief SgfcBinaryDocumentValueKind enumerates the kinds of single
+  /// property value objects that the binary document format distinguishes.
+  /// Each kind corresponds to one class that implements
+  /// ISgfcSinglePropertyValue.
+  ///
+  /// @ingroup internals
+  /// @ingroup document
+  ///
+  /// The numeric values of the enumeration are stored in binary document
+  /// files. New kinds must therefore be added at the end, and existing kinds
+  /// must never be reordered or removed.
+  enum class SgfcBinaryDocumentValueKind
+  {
+    /// @brief The value is an SgfcSinglePropertyValue object that is not an
+    /// instance of one of the typed property value classes.
+    Basic,
+    /// @brief The value is an SgfcNumberPropertyValue object.
+    Number,
+    /// @brief The value is an SgfcRealPropertyValue object.
+    Real,
+    /// @brief The value is an SgfcDoublePropertyValue object.
+    Double,
+    /// @brief The value is an SgfcColorPropertyValue object.
+    Color,
+    /// @brief The value is an SgfcSimpleTextPropertyValue object.
+    SimpleText,
+    /// @brief The value is an SgfcTextPropertyValue object.
+    Text,
+    /// @brief The value is an SgfcPointPropertyValue object.
+    Point,
+    /// @brief The value is an SgfcMovePropertyValue object.
+    Move,
+    /// @brief The value is an SgfcStonePropertyValue object.
+    Stone,
+    /// @brief The value is an SgfcGoPointPropertyValue object.
+    GoPoint,
+    /// @brief The value is an SgfcGoMovePropertyValue object.
+    GoMove,
+    /// @brief The value is an SgfcGoStonePropertyValue object.
+    GoStone,
+  };
+}
@@ -0,0 +1,375 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../include/ISgfcColorPropertyValue.h"
+#include "../../include/ISgfcComposedPropertyValue.h"
+#include "../../include/ISgfcDocument.h"
+#include "../../include/ISgfcDoublePropertyValue.h"
+#include "../../include/ISgfcGame.h"
+#include "../../include/ISgfcGoMove.h"
+#include "../../include/ISgfcGoMovePropertyValue.h"
+#include "../../include/ISgfcGoPoint.h"
+#include "../../include/ISgfcGoPointPropertyValue.h"
+#include "../../include/ISgfcGoStone.h"
+#include "../../include/ISgfcGoStonePropertyValue.h"
+#include "../../include/ISgfcMovePropertyValue.h"
+#include "../../include/ISgfcNode.h"
+#include "../../include/ISgfcNumberPropertyValue.h"
+#include "../../include/ISgfcPointPropertyValue.h"
+#include "../../include/ISgfcProperty.h"
+#include "../../include/ISgfcRealPropertyValue.h"
+#include "../../include/ISgfcSimpleTextPropertyValue.h"
+#include "../../include/ISgfcStonePropertyValue.h"
+#include "../../include/ISgfcTextPropertyValue.h"
+#include "../SgfcBinaryUtility.h"
+#include "../SgfcPrivateConstants.h"
+#include "SgfcBinaryDocumentValueKind.h"
+#include "SgfcBinaryDocumentWriter.h"
+#include "SgfcNodeIterator.h"
+
+// C++ Standard Library includes
+#include <cstring>  // for std::memcpy()
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcBinaryDocumentWriter::SgfcBinaryDocumentWriter()
+  {
+  }
+
+  SgfcBinaryDocumentWriter::~SgfcBinaryDocumentWriter()
+  {
+  }
+
+  void SgfcBinaryDocumentWriter::WriteBinaryFile(
+    std::shared_ptr<ISgfcDocument> document,
+    const std::string& binaryFilePath) const
+  {
+    if (document == nullptr)
+      throw std::invalid_argument("WriteBinaryFile failed: Document is nullptr");
+
+    std::ofstream out(std::filesystem::u8path(binaryFilePath), std::ios::binary | std::ios::trunc);
+    if (! out.is_open())
+    {
+      std::stringstream message;
+      message << "Failed to open file for writing: " << binaryFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    WriteDocument(document, out);
+
+    if (! out.good())
+    {
+      std::stringstream message;
+      message << "Failed to write file: " << binaryFilePath;
+      throw std::runtime_error(message.str());
+    }
+  }
+
+  void SgfcBinaryDocumentWriter::WriteBinaryContent(
+    std::shared_ptr<ISgfcDocument> document,
+    std::string& binaryContent) const
+  {
+    if (document == nullptr)
+      throw std::invalid_argument("WriteBinaryContent failed: Document is nullptr");
+
+    std::ostringstream out(std::ios::binary);
+    WriteDocument(document, out);
+
+    binaryContent = out.str();
+  }
+
+  void SgfcBinaryDocumentWriter::WriteDocument(std::shared_ptr<ISgfcDocument> document, std::ostream& out) const
+  {
+    SgfcBinaryDocumentColumns columns = CreateColumns(*document);
+    WriteColumns(columns, out);
+  }
+
+  SgfcBinaryDocumentColumns SgfcBinaryDocumentWriter::CreateColumns(const ISgfcDocument& document)
+  {
+    SgfcBinaryDocumentColumns columns;
+    std::unordered_map<std::string, std::uint32_t> stringToReferenceMap;
+
+    // Reference 0 is always the empty string
+    GetStringReference("", columns, stringToReferenceMap);
+
+    for (const auto& game : document.GetGames())
+    {
+      std::uint32_t numberOfNodes = AddNodes(game->GetRootNode(), columns, stringToReferenceMap);
+      columns.GameNumberOfNodes.push_back(numberOfNodes);
+    }
+
+    return columns;
+  }
+
+  std::uint32_t SgfcBinaryDocumentWriter::AddNodes(
+    std::shared_ptr<ISgfcNode> rootNode,
+    SgfcBinaryDocumentColumns& columns,
+    std::unordered_map<std::string, std::uint32_t>& stringToReferenceMap)
+  {
+    std::size_t numberOfNodes = 0;
+
+    // SgfcNodeIterator visits the nodes in depth-first pre-order, which is
+    // the order that the format requires
+    NodeVisitCallback nodeVisitCallback = [&](std::shared_ptr<ISgfcNode> node) -> SgfcNodeIterationContinuation
+    {
+      std::size_t numberOfChildren = 0;
+      for (auto child = node->GetFirstChild(); child != nullptr; child = child->GetNextSibling())
+        numberOfChildren++;
+
+      auto properties = node->GetProperties();
+
+      columns.NodeNumberOfChildren.push_back(GetCountOrThrow(numberOfChildren));
+      columns.NodeNumberOfProperties.push_back(GetCountOrThrow(properties.size()));
+
+      for (const auto& property : properties)
+        AddProperty(*property, columns, stringToReferenceMap);
+
+      numberOfNodes++;
+
+      return SgfcNodeIterationContinuation::VerticalAndLateral;
+    };
+
+    SgfcNodeIterator nodeIterator;
+    nodeIterator.IterateOverNodesDepthFirst(rootNode, nodeVisitCallback);
+
+    return GetCountOrThrow(numberOfNodes);
+  }
+
+  void SgfcBinaryDocumentWriter::AddProperty(
+    const ISgfcProperty& property,
+    SgfcBinaryDocumentColumns& columns,
+    std::unordered_map<std::string, std::uint32_t>& stringToReferenceMap)
+  {
+    bool isTypedProperty =
+      property.ToGameTypeProperty() != nullptr ||
+      property.ToBoardSizeProperty() != nullptr;
+
+    auto propertyValues = property.GetPropertyValues();
+
+    columns.PropertyIsTypedProperty.push_back(isTypedProperty ? 1 : 0);
+    columns.PropertyType.push_back(static_cast<std::uint32_t>(property.GetPropertyType()));
+    columns.PropertyName.push_back(GetStringReference(property.GetPropertyName(), columns, stringToReferenceMap));
+    columns.PropertyNumberOfValues.push_back(GetCountOrThrow(propertyValues.size()));
+
+    for (const auto& propertyValue : propertyValues)
+    {
+      if (propertyValue->IsComposedValue())
+      {
+        const ISgfcComposedPropertyValue* composedValue = propertyValue->ToComposedValue();
+
+        columns.PropertyValueIsComposed.push_back(1);
+        AddSingleValue(*composedValue->GetValue1(), columns, stringToReferenceMap);
+        AddSingleValue(*composedValue->GetValue2(), columns, stringToReferenceMap);
+      }
+      else
+      {
+        columns.PropertyValueIsComposed.push_back(0);
+        AddSingleValue(*propertyValue->ToSingleValue(), columns, stringToReferenceMap);
+      }
+    }
+  }
+
+  void SgfcBinaryDocumentWriter::AddSingleValue(
+    const ISgfcSinglePropertyValue& singleValue,
+    SgfcBinaryDocumentColumns& columns,
+    std::unordered_map<std::string, std::uint32_t>& stringToReferenceMap)
+  {
+    SgfcBinaryDocumentValueKind valueKind = SgfcBinaryDocumentValueKind::Basic;
+    std::uint8_t attribute = 0;
+    std::string text;
+    std::uint64_t number = 0;
+
+    if (singleValue.ToNumberValue() != nullptr)
+    {
+      valueKind = SgfcBinaryDocumentValueKind::Number;
+      number = static_cast<std::uint64_t>(static_cast<std::int64_t>(singleValue.ToNumberValue()->GetNumberValue()));
+    }
+    else if (singleValue.ToRealValue() != nullptr)
+    {
+      valueKind = SgfcBinaryDocumentValueKind::Real;
+      SgfcReal realValue = singleValue.ToRealValue()->GetRealValue();
+      std::memcpy(&number, &realValue, sizeof(number));
+    }
+    else if (singleValue.ToDoubleValue() != nullptr)
+    {
+      valueKind = SgfcBinaryDocumentValueKind::Double;
+      number = static_cast<std::uint64_t>(singleValue.ToDoubleValue()->GetDoubleValue());
+    }
+    else if (singleValue.ToColorValue() != nullptr)
+    {
+      valueKind = SgfcBinaryDocumentValueKind::Color;
+      number = static_cast<std::uint64_t>(singleValue.ToColorValue()->GetColorValue());
+    }
+    else if (singleValue.ToSimpleTextValue() != nullptr)
+    {
+      valueKind = SgfcBinaryDocumentValueKind::SimpleText;
+      text = singleValue.ToSimpleTextValue()->GetSimpleTextValue();
+    }
+    else if (singleValue.ToTextValue() != nullptr)
+    {
+      valueKind = SgfcBinaryDocumentValueKind::Text;
+      text = singleValue.ToTextValue()->GetTextValue();
+    }
+    else if (singleValue.ToPointValue() != nullptr)
+    {
+      const ISgfcGoPointPropertyValue* goPointValue = singleValue.ToPointValue()->ToGoPointValue();
+      if (goPointValue != nullptr)
+      {
+        auto goPoint = goPointValue->GetGoPoint();
+        valueKind = SgfcBinaryDocumentValueKind::GoPoint;
+        number = goPoint->GetYPosition(SgfcCoordinateSystem::UpperLeftOrigin) + goPoint->GetYPosition(SgfcCoordinateSystem::LowerLeftOrigin) - 1;
+      }
+      else
+      {
+        valueKind = SgfcBinaryDocumentValueKind::Point;
+        text = singleValue.ToPointValue()->GetPointValue();
+      }
+    }
+    else if (singleValue.ToMoveValue() != nullptr)
+    {
+      const ISgfcGoMovePropertyValue* goMoveValue = singleValue.ToMoveValue()->ToGoMoveValue();
+      if (goMoveValue != nullptr)
+      {
+        auto goMove = goMoveValue->GetGoMove();
+        valueKind = SgfcBinaryDocumentValueKind::GoMove;
+        attribute = static_cast<std::uint8_t>(goMove->GetPlayerColor());
+        if (! goMove->IsPassMove())
+        {
+          auto goPoint = goMove->GetStoneLocation();
+          number = goPoint->GetYPosition(SgfcCoordinateSystem::UpperLeftOrigin) + goPoint->GetYPosition(SgfcCoordinateSystem::LowerLeftOrigin) - 1;
+        }
+      }
+      else
+      {
+        valueKind = SgfcBinaryDocumentValueKind::Move;
+        text = singleValue.ToMoveValue()->GetMoveValue();
+      }
+    }
+    else if (singleValue.ToStoneValue() != nullptr)
+    {
+      const ISgfcGoStonePropertyValue* goStoneValue = singleValue.ToStoneValue()->ToGoStoneValue();
+      if (goStoneValue != nullptr)
+      {
+        auto goStone = goStoneValue->GetGoStone();
+        auto goPoint = goStone->GetLocation();
+        valueKind = SgfcBinaryDocumentValueKind::GoStone;
+        attribute = static_cast<std::uint8_t>(goStone->GetColor());
+        number = goPoint->GetYPosition(SgfcCoordinateSystem::UpperLeftOrigin) + goPoint->GetYPosition(SgfcCoordinateSystem::LowerLeftOrigin) - 1;
+      }
+      else
+      {
+        valueKind = SgfcBinaryDocumentValueKind::Stone;
+        text = singleValue.ToStoneValue()->GetStoneValue();
+      }
+    }
+    else
+    {
+      valueKind = SgfcBinaryDocumentValueKind::Basic;
+      attribute = static_cast<std::uint8_t>(singleValue.GetValueType());
+      text = singleValue.GetTypeConversionErrorMessage();
+      number = singleValue.HasTypedValue() ? 1 : 0;
+    }
+
+    columns.SingleValueKind.push_back(static_cast<std::uint8_t>(valueKind));
+    columns.SingleValueAttribute.push_back(attribute);
+    columns.SingleValueRawValue.push_back(GetStringReference(singleValue.GetRawValue(), columns, stringToReferenceMap));
+    columns.SingleValueText.push_back(GetStringReference(text, columns, stringToReferenceMap));
+    columns.SingleValueNumber.push_back(number);
+  }
+
+  std::uint32_t SgfcBinaryDocumentWriter::GetStringReference(
+    const std::string& string,
+    SgfcBinaryDocumentColumns& columns,
+    std::unordered_map<std::string, std::uint32_t>& stringToReferenceMap)
+  {
+    auto it = stringToReferenceMap.find(string);
+    if (it != stringToReferenceMap.end())
+      return it->second;
+
+    std::uint32_t stringReference = GetCountOrThrow(columns.Strings.size());
+    stringToReferenceMap[string] = stringReference;
+    columns.Strings.push_back(string);
+
+    return stringReference;
+  }
+
+  std::uint32_t SgfcBinaryDocumentWriter::GetCountOrThrow(std::size_t count)
+  {
+    if (count >= std::numeric_limits<std::uint32_t>::max())
+      throw std::invalid_argument("SgfcBinaryDocumentWriter failed: Document is too large for the binary document format");
+
+    return static_cast<std::uint32_t>(count);
+  }
+
+  void SgfcBinaryDocumentWriter::WriteColumns(const SgfcBinaryDocumentColumns& columns, std::ostream& out)
+  {
+    out.write(SgfcPrivateConstants::BinaryDocumentMagic.data(), SgfcPrivateConstants::BinaryDocumentMagic.size());
+    SgfcBinaryUtility::WriteUInt32(out, SgfcPrivateConstants::BinaryDocumentFormatVersion);
+    SgfcBinaryUtility::WriteUInt32(out, 0);
+    SgfcBinaryUtility::WriteUInt64(out, columns.Strings.size());
+    SgfcBinaryUtility::WriteUInt64(out, columns.GameNumberOfNodes.size());
+    SgfcBinaryUtility::WriteUInt64(out, columns.NodeNumberOfChildren.size());
+    SgfcBinaryUtility::WriteUInt64(out, columns.PropertyType.size());
+    SgfcBinaryUtility::WriteUInt64(out, columns.PropertyValueIsComposed.size());
+    SgfcBinaryUtility::WriteUInt64(out, columns.SingleValueKind.size());
+
+    for (const auto& string : columns.Strings)
+    {
+      if (string.size() > std::numeric_limits<std::uint32_t>::max())
+        throw std::invalid_argument("SgfcBinaryDocumentWriter failed: String is too long for the binary document format");
+
+      SgfcBinaryUtility::WriteUInt32(out, static_cast<std::uint32_t>(string.size()));
+    }
+    for (const auto& string : columns.Strings)
+      SgfcBinaryUtility::WriteCharacters(out, string);
+
+    auto writeUInt8Column = [&](const std::vector<std::uint8_t>& column)
+    {
+      for (auto value : column)
+        SgfcBinaryUtility::WriteUInt8(out, value);
+    };
+    auto writeUInt32Column = [&](const std::vector<std::uint32_t>& column)
+    {
+      for (auto value : column)
+        SgfcBinaryUtility::WriteUInt32(out, value);
+    };
+    auto writeUInt64Column = [&](const std::vector<std::uint64_t>& column)
+    {
+      for (auto value : column)
+        SgfcBinaryUtility::WriteUInt64(out, value);
+    };
+
+    writeUInt32Column(columns.GameNumberOfNodes);
+    writeUInt32Column(columns.NodeNumberOfChildren);
+    writeUInt32Column(columns.NodeNumberOfProperties);
+    writeUInt8Column(columns.PropertyIsTypedProperty);
+    writeUInt32Column(columns.PropertyType);
+    writeUInt32Column(columns.PropertyName);
+    writeUInt32Column(columns.PropertyNumberOfValues);
+    writeUInt8Column(columns.PropertyValueIsComposed);
+    writeUInt8Column(columns.SingleValueKind);
+    writeUInt8Column(columns.SingleValueAttribute);
+    writeUInt32Column(columns.SingleValueRawValue);
+    writeUInt32Column(columns.SingleValueText);
+    writeUInt64Column(columns.SingleValueNumber);
+  }
+}
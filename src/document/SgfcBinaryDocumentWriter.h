@@ -0,0 +1,95 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../include/ISgfcBinaryDocumentWriter.h"
+#include "SgfcBinaryDocumentColumns.h"
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcNode;
+  class ISgfcProperty;
+  class ISgfcPropertyValue;
+  class ISgfcSinglePropertyValue;
+
+  /// @brief The SgfcBinaryDocumentWriter class provides an implementation of
+  /// the ISgfcBinaryDocumentWriter interface. See the interface header file
+  /// for documentation.
+  ///
+  /// @ingroup internals
+  /// @ingroup document
+  ///
+  /// The binary document format has the following layout. All integers are
+  /// stored in little-endian byte order (see SgfcBinaryUtility).
+  /// - Header: Magic bytes (8 bytes), format version (32 bits), flags
+  ///   (32 bits, currently unused), number of strings, games, nodes,
+  ///   properties, property values and single values (64 bits each).
+  /// - String dictionary: The lengths of all strings (32 bits each),
+  ///   followed by the bytes of all strings without separators. The first
+  ///   string is always the empty string.
+  /// - Columns: The columns of SgfcBinaryDocumentColumns, in the order in
+  ///   which they are declared. Each column is stored as a contiguous block
+  ///   of fixed-size values so that it can be loaded with a single read.
+  class SgfcBinaryDocumentWriter : public ISgfcBinaryDocumentWriter
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcBinaryDocumentWriter object.
+    SgfcBinaryDocumentWriter();
+
+    /// @brief Destroys and cleans up the SgfcBinaryDocumentWriter object.
+    virtual ~SgfcBinaryDocumentWriter();
+
+    virtual void WriteBinaryFile(
+      std::shared_ptr<ISgfcDocument> document,
+      const std::string& binaryFilePath) const override;
+    virtual void WriteBinaryContent(
+      std::shared_ptr<ISgfcDocument> document,
+      std::string& binaryContent) const override;
+
+  private:
+    void WriteDocument(std::shared_ptr<ISgfcDocument> document, std::ostream& out) const;
+
+    static SgfcBinaryDocumentColumns CreateColumns(const ISgfcDocument& document);
+    static std::uint32_t AddNodes(
+      std::shared_ptr<ISgfcNode> rootNode,
+      SgfcBinaryDocumentColumns& columns,
+      std::unordered_map<std::string, std::uint32_t>& stringToReferenceMap);
+    static void AddProperty(
+      const ISgfcProperty& property,
+      SgfcBinaryDocumentColumns& columns,
+      std::unordered_map<std::string, std::uint32_t>& stringToReferenceMap);
+    static void AddSingleValue(
+      const ISgfcSinglePropertyValue& singleValue,
+      SgfcBinaryDocumentColumns& columns,
+      std::unordered_map<std::string, std::uint32_t>& stringToReferenceMap);
+    static std::uint32_t GetStringReference(
+      const std::string& string,
+      SgfcBinaryDocumentColumns& columns,
+      std::unordered_map<std::string, std::uint32_t>& stringToReferenceMap);
+    static std::uint32_t GetCountOrThrow(std::size_t count);
+
+    static void WriteColumns(const SgfcBinaryDocumentColumns& columns, std::ostream& out);
+  };
+}
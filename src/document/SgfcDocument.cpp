@@ -38,6 +38,8 @@
 #include "../../include/ISgfcTreeBuilder.h"
 #include "../../include/SgfcPlusPlusFactory.h"
 #include "../parsing/SgfcPropertyDecoder.h"
+#include "../SgfcParallelUtility.h"
+#include "../SgfcPrivateConstants.h"
 #include "../SgfcUtility.h"
 #include "SgfcDocument.h"
 #include "SgfcProperty.h"
@@ -45,9 +47,11 @@
 // C++ Standard Library includes
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <set>
 #include <stack>
 #include <stdexcept>
+#include <vector>
 
 // SGFC includes
 extern "C"
@@ -59,50 +63,137 @@ extern "C"
 namespace LibSgfcPlusPlus
 {
   SgfcDocument::SgfcDocument()
+    : isTruncated(false)
   {
   }
 
   SgfcDocument::SgfcDocument(SGFInfo* sgfInfo)
+    : SgfcDocument(sgfInfo, SgfcDocumentReadOptions())
+  {
+  }
+
+  SgfcDocument::SgfcDocument(SGFInfo* sgfInfo, const SgfcDocumentReadOptions& readOptions)
+    : isTruncated(false)
   {
     if (sgfInfo == nullptr)
       throw std::invalid_argument("SgfcDocument constructor failed: SGFInfo object is nullptr");
 
-    Node* sgfRootNode = sgfInfo->root;
-    TreeInfo* sgfTreeInfo = sgfInfo->tree;
-    while (sgfRootNode)
-    {
-      auto rootNode = SgfcPlusPlusFactory::CreateNode();
+    std::vector<Node*> sgfRootNodes;
+    for (Node* sgfRootNode = sgfInfo->root; sgfRootNode != nullptr; sgfRootNode = sgfRootNode->sibling)
+      sgfRootNodes.push_back(sgfRootNode);
+
+    // The game trees are independent of each other, and converting them only
+    // reads the SGFC data structures, so they can be converted concurrently.
+    // Each game is stored at its own index, which preserves the order of
+    // the games regardless of the order in which they are converted.
+    // std::vector<bool> is not used because its elements cannot be written
+    // concurrently
+    this->games.resize(sgfRootNodes.size());
+    std::vector<char> isGameTruncated(sgfRootNodes.size(), 0);
+
+    // The threads are first distributed among the games. If there are fewer
+    // games than threads, the remaining threads are used to decode the
+    // nodes within each game. This matters most for documents that consist
+    // of a single large game.
+    unsigned int totalNumberOfWorkerThreads = SgfcParallelUtility::GetNumberOfWorkerThreads(
+      readOptions.NumberOfThreads,
+      std::numeric_limits<std::size_t>::max());
+    unsigned int numberOfWorkerThreads = SgfcParallelUtility::GetNumberOfWorkerThreads(
+      totalNumberOfWorkerThreads,
+      sgfRootNodes.size());
+    unsigned int numberOfThreadsPerGame = std::max(totalNumberOfWorkerThreads / numberOfWorkerThreads, 1u);
+
+    SgfcParallelUtility::ForEach(
+      sgfRootNodes.size(),
+      numberOfWorkerThreads,
+      [&](std::size_t gameIndex, unsigned int /*workerThreadIndex*/)
+      {
+        bool isGameTreeTruncated = false;
+        this->games[gameIndex] = ParseGame(sgfRootNodes[gameIndex], readOptions, numberOfThreadsPerGame, isGameTreeTruncated);
+        isGameTruncated[gameIndex] = isGameTreeTruncated ? 1 : 0;
+      });
 
-      // Both of these methods can throw std::domain_error
-      SgfcGameType gameType = SgfcPropertyDecoder::GetGameTypeFromNode(sgfRootNode);
-      SgfcBoardSize boardSize = SgfcPropertyDecoder::GetBoardSizeFromNode(sgfRootNode, gameType);
+    this->isTruncated = std::find(isGameTruncated.begin(), isGameTruncated.end(), 1) != isGameTruncated.end();
+  }
 
-      ParseProperties(rootNode, sgfRootNode, gameType, boardSize);
+  std::shared_ptr<ISgfcGame> SgfcDocument::ParseGame(
+    Node* sgfRootNode,
+    const SgfcDocumentReadOptions& readOptions,
+    unsigned int numberOfThreads,
+    bool& isTruncated)
+  {
+    // Both of these methods can throw std::domain_error
+    SgfcGameType gameType = SgfcPropertyDecoder::GetGameTypeFromNode(sgfRootNode);
+    SgfcBoardSize boardSize = SgfcPropertyDecoder::GetBoardSizeFromNode(sgfRootNode, gameType);
+
+    // Building the game happens in three steps. First the SGFC nodes that
+    // lie within the window are collected in depth-first order, together
+    // with the index of their parent. Then the nodes are created and their
+    // properties are decoded. Decoding is by far the most expensive step,
+    // and because the nodes are not yet part of a game it can be performed
+    // concurrently in chunks of consecutive nodes. Finally the nodes are
+    // linked to form the game tree. This must happen sequentially because
+    // the tree builder updates the game's indexes.
+    std::vector<std::pair<Node*, std::size_t>> sgfNodes;
+    isTruncated = CollectGameTreeDepthFirst(sgfRootNode, readOptions, sgfNodes);
+
+    std::vector<std::shared_ptr<ISgfcNode>> nodes(sgfNodes.size());
+
+    std::size_t numberOfNodesPerChunk = SgfcPrivateConstants::NumberOfNodesPerDecodingChunk;
+    std::size_t numberOfChunks = (sgfNodes.size() + numberOfNodesPerChunk - 1) / numberOfNodesPerChunk;
+
+    unsigned int numberOfWorkerThreads = SgfcParallelUtility::GetNumberOfWorkerThreads(
+      numberOfThreads,
+      numberOfChunks);
+
+    SgfcParallelUtility::ForEach(
+      numberOfChunks,
+      numberOfWorkerThreads,
+      [&](std::size_t chunkIndex, unsigned int /*workerThreadIndex*/)
+      {
+        std::size_t firstNodeIndex = chunkIndex * numberOfNodesPerChunk;
+        std::size_t endNodeIndex = std::min(firstNodeIndex + numberOfNodesPerChunk, sgfNodes.size());
 
-      auto game = SgfcPlusPlusFactory::CreateGame(rootNode);
-      this->games.push_back(game);
+        for (std::size_t nodeIndex = firstNodeIndex; nodeIndex < endNodeIndex; nodeIndex++)
+        {
+          auto node = SgfcPlusPlusFactory::CreateNode();
+          ParseProperties(node, sgfNodes[nodeIndex].first, gameType, boardSize, readOptions);
+          nodes[nodeIndex] = node;
+        }
+      });
 
-      std::shared_ptr<ISgfcTreeBuilder> treeBuilder = game->GetTreeBuilder();
-      ParseGameTreeDepthFirst(rootNode, sgfRootNode, gameType, boardSize, treeBuilder);
+    auto game = SgfcPlusPlusFactory::CreateGame(nodes.front());
 
-      sgfRootNode = sgfRootNode->sibling;
-      sgfTreeInfo = sgfTreeInfo->next;
+    // Nodes are stored in depth-first order, so a parent always precedes its
+    // children, and siblings are appended in their original order
+    std::shared_ptr<ISgfcTreeBuilder> treeBuilder = game->GetTreeBuilder();
+    for (std::size_t nodeIndex = 1; nodeIndex < nodes.size(); nodeIndex++)
+    {
+      std::size_t parentNodeIndex = sgfNodes[nodeIndex].second;
+      treeBuilder->AppendChild(nodes[parentNodeIndex], nodes[nodeIndex]);
     }
+
+    return game;
   }
 
-  void SgfcDocument::ParseGameTreeDepthFirst(
-    std::shared_ptr<ISgfcNode> rootNode,
+  bool SgfcDocument::CollectGameTreeDepthFirst(
     Node* sgfRootNode,
-    SgfcGameType gameType,
-    SgfcBoardSize boardSize,
-    std::shared_ptr<ISgfcTreeBuilder> treeBuilder)
+    const SgfcDocumentReadOptions& readOptions,
+    std::vector<std::pair<Node*, std::size_t>>& sgfNodes) const
   {
-    std::stack<std::pair<std::shared_ptr<ISgfcNode>, Node*>> stack;
-    std::pair<std::shared_ptr<ISgfcNode>, Node*> currentStackEntry;
+    bool isTruncated = false;
+
+    // The stack entries consist of an SGFC node and the index at which the
+    // node is stored in sgfNodes
+    std::stack<std::pair<Node*, std::size_t>> stack;
+    std::pair<Node*, std::size_t> currentStackEntry;
+
+    // The root node has no parent, the parent index is never used
+    sgfNodes.push_back(std::make_pair(sgfRootNode, 0));
 
-    std::shared_ptr<ISgfcNode> currentNode = rootNode;
     Node* sgfCurrentNode = sgfRootNode;
-    std::shared_ptr<ISgfcNode> currentParentNode = nullptr;
+    std::size_t currentNodeIndex = 0;
+    std::size_t currentParentNodeIndex = 0;
 
     while (true)
     {
@@ -110,17 +201,31 @@ namespace LibSgfcPlusPlus
       {
         if (sgfCurrentNode != sgfRootNode)
         {
-          currentNode = SgfcPlusPlusFactory::CreateNode();
-          treeBuilder->AppendChild(currentParentNode, currentNode);
-          ParseProperties(currentNode, sgfCurrentNode, gameType, boardSize);
+          if (sgfNodes.size() >= readOptions.MaximumNumberOfNodes)
+          {
+            // Nodes are collected in depth-first order, so all remaining
+            // nodes are outside the window
+            return true;
+          }
+
+          // The stack contains the ancestors of the current node, so its
+          // size is the depth of the current node. Skipping the current node
+          // also skips its siblings, which have the same depth.
+          if (stack.size() > readOptions.MaximumDepth)
+          {
+            isTruncated = true;
+            break;
+          }
+
+          currentNodeIndex = sgfNodes.size();
+          sgfNodes.push_back(std::make_pair(sgfCurrentNode, currentParentNodeIndex));
         }
 
-        currentStackEntry = std::make_pair(currentNode, sgfCurrentNode);
+        currentStackEntry = std::make_pair(sgfCurrentNode, currentNodeIndex);
         stack.push(currentStackEntry);
 
-        currentParentNode = currentNode;
+        currentParentNodeIndex = currentNodeIndex;
 
-        currentNode = nullptr;
         sgfCurrentNode = sgfCurrentNode->child;
       }
 
@@ -129,8 +234,8 @@ namespace LibSgfcPlusPlus
         currentStackEntry = stack.top();
         stack.pop();
 
-        currentNode = currentStackEntry.first;
-        sgfCurrentNode = currentStackEntry.second;
+        sgfCurrentNode = currentStackEntry.first;
+        currentNodeIndex = currentStackEntry.second;
 
         if (sgfCurrentNode == sgfRootNode)
         {
@@ -143,10 +248,17 @@ namespace LibSgfcPlusPlus
           break;
         }
 
-        currentParentNode = currentNode->GetParent();
+        currentParentNodeIndex = sgfNodes[currentNodeIndex].second;
 
-        currentNode = nullptr;
         sgfCurrentNode = sgfCurrentNode->sibling;
+
+        // Siblings are the beginnings of variations other than the main
+        // variation
+        if (sgfCurrentNode && readOptions.IsMainVariationOnly)
+        {
+          isTruncated = true;
+          sgfCurrentNode = nullptr;
+        }
       }
       else
       {
@@ -154,13 +266,16 @@ namespace LibSgfcPlusPlus
         break;
       }
     }
+
+    return isTruncated;
   }
 
   void SgfcDocument::ParseProperties(
     std::shared_ptr<ISgfcNode> node,
     Node* sgfNode,
     SgfcGameType gameType,
-    SgfcBoardSize boardSize)
+    SgfcBoardSize boardSize,
+    const SgfcDocumentReadOptions& readOptions)
   {
     auto propertyFactory = SgfcPlusPlusFactory::CreatePropertyFactory();
 
@@ -169,6 +284,14 @@ namespace LibSgfcPlusPlus
     Property* sgfProperty = sgfNode->prop;
     while (sgfProperty)
     {
+      // Check the filter before SgfcPropertyDecoder is constructed so that
+      // nothing is decoded or allocated for filtered properties
+      if (! IsPropertyIncluded(sgfProperty, readOptions))
+      {
+        sgfProperty = sgfProperty->next;
+        continue;
+      }
+
       // This can throw std::domain_error
       SgfcPropertyDecoder propertyDecoder(sgfProperty, gameType, boardSize);
 
@@ -216,10 +339,37 @@ namespace LibSgfcPlusPlus
     node->SetProperties(properties);
   }
 
+  bool SgfcDocument::IsPropertyIncluded(const Property* sgfProperty, const SgfcDocumentReadOptions& readOptions) const
+  {
+    if (readOptions.PropertyFilterMode == SgfcPropertyFilterMode::KeepAllProperties)
+      return true;
+
+    // Let SgfcPropertyDecoder handle the error
+    if (sgfProperty->idstr == nullptr)
+      return true;
+
+    std::string propertyName = sgfProperty->idstr;
+    SgfcPropertyType propertyType = SgfcUtility::MapPropertyNameToPropertyType(propertyName);
+
+    bool isPropertyListed =
+      readOptions.PropertyFilterTypes.find(propertyType) != readOptions.PropertyFilterTypes.cend() ||
+      readOptions.PropertyFilterNames.find(propertyName) != readOptions.PropertyFilterNames.cend();
+
+    if (readOptions.PropertyFilterMode == SgfcPropertyFilterMode::KeepListedProperties)
+      return isPropertyListed;
+    else
+      return ! isPropertyListed;
+  }
+
   SgfcDocument::~SgfcDocument()
   {
   }
 
+  bool SgfcDocument::IsTruncated() const
+  {
+    return this->isTruncated;
+  }
+
   bool SgfcDocument::IsEmpty() const
   {
     return this->games.empty();
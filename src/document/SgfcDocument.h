@@ -18,14 +18,18 @@
 
 // Project includes
 #include "../../include/ISgfcDocument.h"
+#include "../../include/SgfcDocumentReadOptions.h"
 
 // C++ Standard Library includes
 #include <string>
+#include <utility>
+#include <vector>
 
 // Forward declarations
 class ISgfcGoPoint;
 struct SGFInfo;
 struct Node;
+struct Property;
 
 namespace LibSgfcPlusPlus
 {
@@ -58,6 +62,15 @@ namespace LibSgfcPlusPlus
     /// SGFC and libsgfc++ disagree about the data type(s) of a property value.
     SgfcDocument(SGFInfo* sgfInfo);
 
+    /// @brief Initializes a newly constructed SgfcDocument object with the
+    /// part of the SGF content in @a sgfInfo that lies within the window
+    /// defined by @a readOptions. Nodes outside the window are not built.
+    /// IsTruncated() returns true if at least one node was not built.
+    ///
+    /// @exception std::invalid_argument See SgfcDocument(SGFInfo*).
+    /// @exception std::domain_error See SgfcDocument(SGFInfo*).
+    SgfcDocument(SGFInfo* sgfInfo, const SgfcDocumentReadOptions& readOptions);
+
     /// @brief Destroys and cleans up the SgfcDocument object.
     virtual ~SgfcDocument();
 
@@ -72,20 +85,31 @@ namespace LibSgfcPlusPlus
 
     virtual void DebugPrintToConsole() const override;
 
+    /// @brief Returns true if the read options with which the SgfcDocument
+    /// was constructed prevented at least one node from being built. Returns
+    /// false if the document contains all nodes.
+    bool IsTruncated() const;
+
   private:
     std::vector<std::shared_ptr<ISgfcGame>> games;
+    bool isTruncated;
 
-    void ParseGameTreeDepthFirst(
-      std::shared_ptr<ISgfcNode> rootNode,
+    std::shared_ptr<ISgfcGame> ParseGame(
       Node* sgfRootNode,
-      SgfcGameType gameType,
-      SgfcBoardSize boardSize,
-      std::shared_ptr<ISgfcTreeBuilder> treeBuilder);
+      const SgfcDocumentReadOptions& readOptions,
+      unsigned int numberOfThreads,
+      bool& isTruncated);
+    bool CollectGameTreeDepthFirst(
+      Node* sgfRootNode,
+      const SgfcDocumentReadOptions& readOptions,
+      std::vector<std::pair<Node*, std::size_t>>& sgfNodes) const;
     void ParseProperties(
       std::shared_ptr<ISgfcNode> node,
       Node* sgfNode,
       SgfcGameType gameType,
-      SgfcBoardSize boardSize);
+      SgfcBoardSize boardSize,
+      const SgfcDocumentReadOptions& readOptions);
+    bool IsPropertyIncluded(const Property* sgfProperty, const SgfcDocumentReadOptions& readOptions) const;
 
     void DebugPrintToConsoleRecursiveParseDepthFirst(
       std::shared_ptr<ISgfcNode> parentNode,
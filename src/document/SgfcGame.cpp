@@ -17,18 +17,27 @@
 // Project includes
 #include "../../include/ISgfcGameTypeProperty.h"
 #include "../../include/ISgfcGoGameInfo.h"
+#include "../../include/ISgfcGoMove.h"
+#include "../../include/ISgfcGoMovePropertyValue.h"
+#include "../../include/ISgfcGoPoint.h"
+#include "../../include/ISgfcMovePropertyValue.h"
 #include "../../include/ISgfcNumberPropertyValue.h"
 #include "../../include/ISgfcProperty.h"
 #include "../../include/ISgfcSinglePropertyValue.h"
 #include "../../include/SgfcConstants.h"
 #include "../../include/SgfcPlusPlusFactory.h"
+#include "../game/go/SgfcGoPositionCache.h"
 #include "../game/SgfcGameInfo.h"
 #include "../game/SgfcGameUtility.h"
 #include "../SgfcUtility.h"
 #include "SgfcGame.h"
+#include "SgfcGamePropertyIndex.h"
+#include "SgfcNode.h"
 #include "SgfcNodeIterator.h"
 
 // C++ Standard Library includes
+#include <algorithm>
+#include <cstdint>
 #include <stdexcept>
 
 namespace LibSgfcPlusPlus
@@ -36,12 +45,20 @@ namespace LibSgfcPlusPlus
   SgfcGame::SgfcGame()
     : rootNode(nullptr)
     , treeBuilder(nullptr)
+    , propertyIndex(nullptr)
+    , goPositionCache(nullptr)
+    , goPositionCheckpointInterval(SgfcConstants::GoPositionCheckpointIntervalDefault)
+    , goPositionMaximumNumberOfCheckpoints(SgfcConstants::GoPositionMaximumNumberOfCheckpointsDefault)
   {
   }
 
   SgfcGame::SgfcGame(std::shared_ptr<ISgfcNode> rootNode)
     : rootNode(rootNode)
     , treeBuilder(nullptr)
+    , propertyIndex(nullptr)
+    , goPositionCache(nullptr)
+    , goPositionCheckpointInterval(SgfcConstants::GoPositionCheckpointIntervalDefault)
+    , goPositionMaximumNumberOfCheckpoints(SgfcConstants::GoPositionMaximumNumberOfCheckpointsDefault)
   {
     if (rootNode == nullptr)
       throw std::invalid_argument("SgfcGame constructor failed: Root node is nullptr");
@@ -102,6 +119,9 @@ namespace LibSgfcPlusPlus
   void SgfcGame::SetRootNode(std::shared_ptr<ISgfcNode> rootNode)
   {
     this->rootNode = rootNode;
+
+    InvalidatePropertyIndex();
+    InvalidateGoPositionCache();
   }
 
   std::vector<std::shared_ptr<ISgfcNode>> SgfcGame::GetGameInfoNodes() const
@@ -127,6 +147,144 @@ namespace LibSgfcPlusPlus
     return gameInfoNodes;
   }
 
+  std::vector<std::shared_ptr<ISgfcNode>> SgfcGame::GetNodesWithProperty(SgfcPropertyType propertyType) const
+  {
+    std::lock_guard<std::mutex> lock(this->propertyIndexMutex);
+
+    return GetValidPropertyIndex()->GetNodes(propertyType);
+  }
+
+  std::vector<std::shared_ptr<ISgfcNode>> SgfcGame::GetNodesWithProperty(const std::string& propertyName) const
+  {
+    std::lock_guard<std::mutex> lock(this->propertyIndexMutex);
+
+    return GetValidPropertyIndex()->GetNodes(propertyName);
+  }
+
+  bool SgfcGame::HasPropertyIndex() const
+  {
+    std::lock_guard<std::mutex> lock(this->propertyIndexMutex);
+
+    return (this->propertyIndex != nullptr);
+  }
+
+  void SgfcGame::BuildPropertyIndex() const
+  {
+    std::lock_guard<std::mutex> lock(this->propertyIndexMutex);
+
+    BuildPropertyIndexWithoutLocking();
+  }
+
+  void SgfcGame::DiscardPropertyIndex()
+  {
+    std::lock_guard<std::mutex> lock(this->propertyIndexMutex);
+
+    // Nodes only hold a weak reference to the index, so there's no need to
+    // deregister the index from the nodes
+    this->propertyIndex = nullptr;
+  }
+
+  void SgfcGame::InvalidatePropertyIndex()
+  {
+    std::lock_guard<std::mutex> lock(this->propertyIndexMutex);
+
+    if (this->propertyIndex != nullptr)
+      this->propertyIndex->Invalidate();
+  }
+
+  std::size_t SgfcGame::GetMainVariationGoMoves(const SgfcGoMoveBuffers& moveBuffers) const
+  {
+    if (this->rootNode == nullptr || GetGameType() != SgfcGameType::Go)
+      return 0;
+
+    std::size_t numberOfMoves = 0;
+
+    for (auto node = this->rootNode; node != nullptr; node = node->GetFirstChild())
+      numberOfMoves = WriteGoMoves(node.get(), moveBuffers, numberOfMoves);
+
+    return numberOfMoves;
+  }
+
+  std::size_t SgfcGame::GetMainVariationGoMoves(
+    std::shared_ptr<ISgfcNode> node,
+    const SgfcGoMoveBuffers& moveBuffers) const
+  {
+    if (node == nullptr)
+      throw std::invalid_argument("GetMainVariationGoMoves failed: Node argument is null");
+
+    // Collect the path from the node up to the root node. Raw pointers are
+    // sufficient because the ancestors are kept alive by the game tree.
+    std::vector<const ISgfcNode*> ancestorNodes;
+    for (auto ancestorNode = node->GetParent(); ancestorNode != nullptr; ancestorNode = ancestorNode->GetParent())
+      ancestorNodes.push_back(ancestorNode.get());
+
+    const ISgfcNode* rootNodeOfNode = ancestorNodes.empty() ? node.get() : ancestorNodes.back();
+    if (rootNodeOfNode != this->rootNode.get())
+      throw std::invalid_argument("GetMainVariationGoMoves failed: Node is not part of the game tree");
+
+    if (GetGameType() != SgfcGameType::Go)
+      return 0;
+
+    std::size_t numberOfMoves = 0;
+
+    for (auto it = ancestorNodes.rbegin(); it != ancestorNodes.rend(); it++)
+      numberOfMoves = WriteGoMoves(*it, moveBuffers, numberOfMoves);
+
+    for (auto descendantNode = node; descendantNode != nullptr; descendantNode = descendantNode->GetFirstChild())
+      numberOfMoves = WriteGoMoves(descendantNode.get(), moveBuffers, numberOfMoves);
+
+    return numberOfMoves;
+  }
+
+  std::shared_ptr<ISgfcGoPosition> SgfcGame::GetGoPosition(std::shared_ptr<ISgfcNode> node) const
+  {
+    if (node == nullptr)
+      throw std::invalid_argument("GetGoPosition failed: Node is nullptr");
+    if (this->rootNode == nullptr)
+      throw std::invalid_argument("GetGoPosition failed: Node is not part of the game tree");
+
+    if (GetGameType() != SgfcGameType::Go || ! GetBoardSize().IsValid(SgfcGameType::Go))
+      return nullptr;
+
+    std::lock_guard<std::mutex> lock(this->goPositionCacheMutex);
+
+    return GetValidGoPositionCache()->GetPosition(this->rootNode, node);
+  }
+
+  void SgfcGame::ConfigureGoPositionCheckpoints(
+    std::size_t checkpointInterval,
+    std::size_t maximumNumberOfCheckpoints)
+  {
+    if (checkpointInterval == 0)
+      throw std::invalid_argument("ConfigureGoPositionCheckpoints failed: Checkpoint interval is 0");
+
+    std::lock_guard<std::mutex> lock(this->goPositionCacheMutex);
+
+    this->goPositionCheckpointInterval = checkpointInterval;
+    this->goPositionMaximumNumberOfCheckpoints = maximumNumberOfCheckpoints;
+
+    // Nodes only hold a weak reference to the cache, so there's no need to
+    // deregister the cache from the nodes
+    this->goPositionCache = nullptr;
+  }
+
+  void SgfcGame::DiscardGoPositionCheckpoints()
+  {
+    std::lock_guard<std::mutex> lock(this->goPositionCacheMutex);
+
+    // Nodes only hold a weak reference to the cache, so there's no need to
+    // deregister the cache from the nodes
+    this->goPositionCache = nullptr;
+  }
+
+  void SgfcGame::InvalidateGoPositionCache()
+  {
+    std::lock_guard<std::mutex> lock(this->goPositionCacheMutex);
+
+    if (this->goPositionCache != nullptr)
+      this->goPositionCache->Invalidate();
+  }
+
   std::shared_ptr<ISgfcGameInfo> SgfcGame::CreateGameInfo() const
   {
     std::shared_ptr<ISgfcNode> firstGameInfoNode = GetFirstGameInfoNode();
@@ -149,6 +307,9 @@ namespace LibSgfcPlusPlus
     {
       this->rootNode = SgfcPlusPlusFactory::CreateNode();
       firstGameInfoNode = this->rootNode;
+
+      InvalidatePropertyIndex();
+      InvalidateGoPositionCache();
     }
     else
     {
@@ -160,6 +321,59 @@ namespace LibSgfcPlusPlus
     gameInfoImplementation->WriteToGameInfoNode(firstGameInfoNode);
   }
 
+  std::vector<SgfcNodeChange> SgfcGame::GetNodeChanges(std::shared_ptr<ISgfcGame> newGame) const
+  {
+    if (newGame == nullptr)
+      throw std::invalid_argument("GetNodeChanges failed: Game argument is null");
+
+    std::vector<SgfcNodeChange> nodeChanges;
+
+    std::vector<NodeChangeStep> nodeChangeSteps;
+    nodeChangeSteps.push_back({ this->rootNode, newGame->GetRootNode() });
+
+    // Use an explicit stack instead of recursion. Game trees can be very deep.
+    while (! nodeChangeSteps.empty())
+    {
+      NodeChangeStep nodeChangeStep = nodeChangeSteps.back();
+      nodeChangeSteps.pop_back();
+
+      if (nodeChangeStep.OldNode == nullptr && nodeChangeStep.NewNode == nullptr)
+        continue;
+
+      SgfcNodeChange nodeChange;
+      nodeChange.OldNode = nodeChangeStep.OldNode;
+      nodeChange.NewNode = nodeChangeStep.NewNode;
+
+      if (nodeChangeStep.OldNode == nullptr)
+      {
+        nodeChange.ChangeType = SgfcNodeChangeType::Added;
+        nodeChanges.push_back(nodeChange);
+        continue;
+      }
+      else if (nodeChangeStep.NewNode == nullptr)
+      {
+        nodeChange.ChangeType = SgfcNodeChangeType::Removed;
+        nodeChanges.push_back(nodeChange);
+        continue;
+      }
+
+      if (nodeChangeStep.OldNode->GetContentHash() == nodeChangeStep.NewNode->GetContentHash())
+        continue;
+
+      const SgfcNode* oldNodeImplementation = static_cast<const SgfcNode*>(nodeChangeStep.OldNode.get());
+      const SgfcNode* newNodeImplementation = static_cast<const SgfcNode*>(nodeChangeStep.NewNode.get());
+      if (oldNodeImplementation->GetPropertiesHash() != newNodeImplementation->GetPropertiesHash())
+      {
+        nodeChange.ChangeType = SgfcNodeChangeType::Changed;
+        nodeChanges.push_back(nodeChange);
+      }
+
+      PushChildNodeChangeSteps(nodeChangeStep.OldNode.get(), nodeChangeStep.NewNode.get(), nodeChangeSteps);
+    }
+
+    return nodeChanges;
+  }
+
   std::shared_ptr<ISgfcTreeBuilder> SgfcGame::GetTreeBuilder() const
   {
     return this->treeBuilder;
@@ -192,4 +406,199 @@ namespace LibSgfcPlusPlus
 
     return firstGameInfoNode;
   }
+
+  /// @brief Returns the game's property index after making sure that the
+  /// index exists and reflects the current state of the game tree. The
+  /// caller must hold the lock on @e propertyIndexMutex.
+  std::shared_ptr<SgfcGamePropertyIndex> SgfcGame::GetValidPropertyIndex() const
+  {
+    if (this->propertyIndex == nullptr || ! this->propertyIndex->IsValid())
+      BuildPropertyIndexWithoutLocking();
+
+    return this->propertyIndex;
+  }
+
+  /// @brief Creates the game's property index if it does not exist yet, then
+  /// populates the index with the nodes of the game tree. The caller must
+  /// hold the lock on @e propertyIndexMutex.
+  void SgfcGame::BuildPropertyIndexWithoutLocking() const
+  {
+    if (this->propertyIndex == nullptr)
+      this->propertyIndex = std::shared_ptr<SgfcGamePropertyIndex>(new SgfcGamePropertyIndex());
+
+    this->propertyIndex->Build(this->rootNode);
+  }
+
+  /// @brief Returns the game's Go position cache after making sure that the
+  /// cache exists and reflects the current state of the game tree. A new
+  /// cache is created whenever the old one became invalid, because the
+  /// board size or the ruleset may have changed along with the game tree.
+  /// The caller must hold the lock on @e goPositionCacheMutex.
+  std::shared_ptr<SgfcGoPositionCache> SgfcGame::GetValidGoPositionCache() const
+  {
+    if (this->goPositionCache != nullptr && this->goPositionCache->IsValid())
+      return this->goPositionCache;
+
+    auto gameInfo = CreateGameInfo();
+    SgfcGoRuleset goRuleset = gameInfo->ToGoGameInfo()->GetGoRuleset();
+
+    this->goPositionCache = std::shared_ptr<SgfcGoPositionCache>(new SgfcGoPositionCache(
+      GetBoardSize(),
+      goRuleset,
+      this->goPositionCheckpointInterval,
+      this->goPositionMaximumNumberOfCheckpoints));
+
+    // The cache depends on the board size and the ruleset, so it must also
+    // be invalidated when the nodes that contain these properties change.
+    // The root node is always replayed, but the game info node might not be.
+    std::shared_ptr<ISgfcNode> firstGameInfoNode = GetFirstGameInfoNode();
+    if (firstGameInfoNode != nullptr)
+    {
+      SgfcNode* gameInfoNodeImplementation = static_cast<SgfcNode*>(firstGameInfoNode.get());
+      gameInfoNodeImplementation->SetGoPositionCache(this->goPositionCache);
+    }
+
+    return this->goPositionCache;
+  }
+
+  /// @brief Matches the child nodes of @a oldNode with the child nodes of
+  /// @a newNode and pushes the pairs that GetNodeChanges() has to examine
+  /// onto @a nodeChangeSteps. See the documentation of
+  /// ISgfcGame::GetNodeChanges() for how child nodes are matched.
+  ///
+  /// Matching child nodes with the same content costs O(n * m) where n and m
+  /// are the numbers of child nodes. Nodes typically have only a few child
+  /// nodes, so this is not worth a hash map.
+  void SgfcGame::PushChildNodeChangeSteps(
+    const ISgfcNode* oldNode,
+    const ISgfcNode* newNode,
+    std::vector<NodeChangeStep>& nodeChangeSteps)
+  {
+    auto oldChildNodes = oldNode->GetChildren();
+    auto newChildNodes = newNode->GetChildren();
+
+    std::vector<bool> isOldChildNodeMatched(oldChildNodes.size(), false);
+    std::vector<bool> isNewChildNodeMatched(newChildNodes.size(), false);
+
+    // Child nodes at the same position are checked first because in the most
+    // common case the game trees differ in only one of the child nodes
+    for (std::size_t childIndex = 0; childIndex < oldChildNodes.size() && childIndex < newChildNodes.size(); childIndex++)
+    {
+      if (oldChildNodes[childIndex]->GetContentHash() == newChildNodes[childIndex]->GetContentHash())
+      {
+        isOldChildNodeMatched[childIndex] = true;
+        isNewChildNodeMatched[childIndex] = true;
+      }
+    }
+
+    for (std::size_t oldChildIndex = 0; oldChildIndex < oldChildNodes.size(); oldChildIndex++)
+    {
+      if (isOldChildNodeMatched[oldChildIndex])
+        continue;
+
+      std::uint64_t oldChildContentHash = oldChildNodes[oldChildIndex]->GetContentHash();
+      for (std::size_t newChildIndex = 0; newChildIndex < newChildNodes.size(); newChildIndex++)
+      {
+        if (! isNewChildNodeMatched[newChildIndex] && newChildNodes[newChildIndex]->GetContentHash() == oldChildContentHash)
+        {
+          isOldChildNodeMatched[oldChildIndex] = true;
+          isNewChildNodeMatched[newChildIndex] = true;
+          break;
+        }
+      }
+    }
+
+    std::vector<std::shared_ptr<ISgfcNode>> unmatchedOldChildNodes;
+    for (std::size_t oldChildIndex = 0; oldChildIndex < oldChildNodes.size(); oldChildIndex++)
+    {
+      if (! isOldChildNodeMatched[oldChildIndex])
+        unmatchedOldChildNodes.push_back(oldChildNodes[oldChildIndex]);
+    }
+
+    std::vector<std::shared_ptr<ISgfcNode>> unmatchedNewChildNodes;
+    for (std::size_t newChildIndex = 0; newChildIndex < newChildNodes.size(); newChildIndex++)
+    {
+      if (! isNewChildNodeMatched[newChildIndex])
+        unmatchedNewChildNodes.push_back(newChildNodes[newChildIndex]);
+    }
+
+    // Push in reverse order so that the steps are popped in the order in
+    // which the child nodes appear in the game trees: First the pairs, then
+    // the removed nodes, then the added nodes. A missing partner is nullptr.
+    std::size_t numberOfPairs = std::min(unmatchedOldChildNodes.size(), unmatchedNewChildNodes.size());
+
+    for (std::size_t childIndex = unmatchedNewChildNodes.size(); childIndex > numberOfPairs; childIndex--)
+      nodeChangeSteps.push_back({ nullptr, unmatchedNewChildNodes[childIndex - 1] });
+
+    for (std::size_t childIndex = unmatchedOldChildNodes.size(); childIndex > numberOfPairs; childIndex--)
+      nodeChangeSteps.push_back({ unmatchedOldChildNodes[childIndex - 1], nullptr });
+
+    for (std::size_t childIndex = numberOfPairs; childIndex > 0; childIndex--)
+      nodeChangeSteps.push_back({ unmatchedOldChildNodes[childIndex - 1], unmatchedNewChildNodes[childIndex - 1] });
+  }
+
+  /// @brief Writes the Go moves found in @a node to the buffers described by
+  /// @a moveBuffers, starting at buffer position @a moveIndex. Returns the
+  /// buffer position at which the next move should be written.
+  ///
+  /// Moves that do not fit into the buffers are not written, but the returned
+  /// buffer position is still advanced so that the caller can determine the
+  /// total number of moves.
+  std::size_t SgfcGame::WriteGoMoves(
+    const ISgfcNode* node,
+    const SgfcGoMoveBuffers& moveBuffers,
+    std::size_t moveIndex)
+  {
+    static const SgfcPropertyType movePropertyTypes[] = { SgfcPropertyType::B, SgfcPropertyType::W };
+
+    for (auto movePropertyType : movePropertyTypes)
+    {
+      if (! node->HasProperty(movePropertyType))
+        continue;
+
+      auto propertyValue = node->GetProperty(movePropertyType)->GetPropertyValue();
+      if (propertyValue == nullptr || propertyValue->IsComposedValue())
+        continue;
+
+      const ISgfcMovePropertyValue* moveValue = propertyValue->ToSingleValue()->ToMoveValue();
+      if (moveValue == nullptr)
+        continue;
+
+      const ISgfcGoMovePropertyValue* goMoveValue = moveValue->ToGoMoveValue();
+      if (goMoveValue == nullptr)
+        continue;
+
+      if (moveIndex < moveBuffers.Capacity)
+      {
+        auto goMove = goMoveValue->GetGoMove();
+        bool isPassMove = goMove->IsPassMove();
+
+        if (moveBuffers.Colors != nullptr)
+          moveBuffers.Colors[moveIndex] = goMove->GetPlayerColor();
+        if (moveBuffers.PassMoves != nullptr)
+          moveBuffers.PassMoves[moveIndex] = isPassMove;
+
+        if (moveBuffers.XPositions != nullptr || moveBuffers.YPositions != nullptr)
+        {
+          unsigned int xPosition = 0;
+          unsigned int yPosition = 0;
+          if (! isPassMove)
+          {
+            auto stoneLocation = goMove->GetStoneLocation();
+            xPosition = stoneLocation->GetXPosition(moveBuffers.CoordinateSystem);
+            yPosition = stoneLocation->GetYPosition(moveBuffers.CoordinateSystem);
+          }
+
+          if (moveBuffers.XPositions != nullptr)
+            moveBuffers.XPositions[moveIndex] = xPosition;
+          if (moveBuffers.YPositions != nullptr)
+            moveBuffers.YPositions[moveIndex] = yPosition;
+        }
+      }
+
+      moveIndex++;
+    }
+
+    return moveIndex;
+  }
 }
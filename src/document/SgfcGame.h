@@ -19,8 +19,15 @@
 // Project includes
 #include "../../include/ISgfcGame.h"
 
+// C++ Standard Library includes
+#include <mutex>
+
 namespace LibSgfcPlusPlus
 {
+  // Forward declarations
+  class SgfcGamePropertyIndex;
+  class SgfcGoPositionCache;
+
   /// @brief The SgfcGame class provides an implementation of the
   /// ISgfcGame interface. See the interface header file for
   /// documentation.
@@ -55,18 +62,82 @@ namespace LibSgfcPlusPlus
 
     virtual std::vector<std::shared_ptr<ISgfcNode>> GetGameInfoNodes() const override;
 
+    virtual std::vector<std::shared_ptr<ISgfcNode>> GetNodesWithProperty(SgfcPropertyType propertyType) const override;
+    virtual std::vector<std::shared_ptr<ISgfcNode>> GetNodesWithProperty(const std::string& propertyName) const override;
+    virtual bool HasPropertyIndex() const override;
+    virtual void BuildPropertyIndex() const override;
+    virtual void DiscardPropertyIndex() override;
+    /// @brief Notifies the SgfcGame object that the structure of the game tree
+    /// has changed. If the game has a property index it is rebuilt the next
+    /// time that it is queried.
+    ///
+    /// This is a library-internal method. Library clients should never be
+    /// able to invoke this directly.
+    void InvalidatePropertyIndex();
+
+    virtual std::size_t GetMainVariationGoMoves(const SgfcGoMoveBuffers& moveBuffers) const override;
+    virtual std::size_t GetMainVariationGoMoves(
+      std::shared_ptr<ISgfcNode> node,
+      const SgfcGoMoveBuffers& moveBuffers) const override;
+
+    virtual std::shared_ptr<ISgfcGoPosition> GetGoPosition(std::shared_ptr<ISgfcNode> node) const override;
+    virtual void ConfigureGoPositionCheckpoints(
+      std::size_t checkpointInterval,
+      std::size_t maximumNumberOfCheckpoints) override;
+    virtual void DiscardGoPositionCheckpoints() override;
+    /// @brief Notifies the SgfcGame object that the structure of the game tree
+    /// has changed. The replay checkpoints stored by GetGoPosition() are
+    /// discarded.
+    ///
+    /// This is a library-internal method. Library clients should never be
+    /// able to invoke this directly.
+    void InvalidateGoPositionCache();
+
     virtual std::shared_ptr<ISgfcGameInfo> CreateGameInfo() const override;
     virtual void WriteGameInfo(std::shared_ptr<ISgfcGameInfo> gameInfo) override;
 
+    virtual std::vector<SgfcNodeChange> GetNodeChanges(std::shared_ptr<ISgfcGame> newGame) const override;
+
     virtual std::shared_ptr<ISgfcTreeBuilder> GetTreeBuilder() const override;
     /// @brief Configures the SgfcGame object with @a treeBuilder, an object
     /// that can be used to manipulate the game tree.
     void SetTreeBuilder(std::shared_ptr<ISgfcTreeBuilder> treeBuilder);
 
   private:
+    /// @brief A pair of nodes that GetNodeChanges() still has to examine.
+    /// One of the nodes is @e nullptr if the other node was added or removed.
+    struct NodeChangeStep
+    {
+      std::shared_ptr<ISgfcNode> OldNode;
+      std::shared_ptr<ISgfcNode> NewNode;
+    };
+
     std::shared_ptr<ISgfcNode> rootNode;
     std::shared_ptr<ISgfcTreeBuilder> treeBuilder;
+    // The property index is built on demand, also by const methods. The
+    // mutex makes sure that concurrent const queries don't race to build it.
+    mutable std::shared_ptr<SgfcGamePropertyIndex> propertyIndex;
+    mutable std::mutex propertyIndexMutex;
+    // The Go position cache is created and updated on demand, also by const
+    // methods. The mutex makes sure that concurrent const queries don't race
+    // to update it.
+    mutable std::shared_ptr<SgfcGoPositionCache> goPositionCache;
+    mutable std::mutex goPositionCacheMutex;
+    std::size_t goPositionCheckpointInterval;
+    std::size_t goPositionMaximumNumberOfCheckpoints;
 
     std::shared_ptr<ISgfcNode> GetFirstGameInfoNode() const;
+    std::shared_ptr<SgfcGamePropertyIndex> GetValidPropertyIndex() const;
+    void BuildPropertyIndexWithoutLocking() const;
+    std::shared_ptr<SgfcGoPositionCache> GetValidGoPositionCache() const;
+
+    static void PushChildNodeChangeSteps(
+      const ISgfcNode* oldNode,
+      const ISgfcNode* newNode,
+      std::vector<NodeChangeStep>& nodeChangeSteps);
+    static std::size_t WriteGoMoves(
+      const ISgfcNode* node,
+      const SgfcGoMoveBuffers& moveBuffers,
+      std::size_t moveIndex);
   };
 }
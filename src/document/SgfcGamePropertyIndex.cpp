@@ -0,0 +1,200 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../include/ISgfcProperty.h"
+#include "SgfcGamePropertyIndex.h"
+#include "SgfcNode.h"
+#include "SgfcNodeIterator.h"
+
+// C++ Standard Library includes
+#include <algorithm>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcGamePropertyIndex::SgfcGamePropertyIndex()
+    : isValid(false)
+  {
+  }
+
+  SgfcGamePropertyIndex::~SgfcGamePropertyIndex()
+  {
+  }
+
+  bool SgfcGamePropertyIndex::IsValid() const
+  {
+    return this->isValid;
+  }
+
+  void SgfcGamePropertyIndex::Build(std::shared_ptr<ISgfcNode> rootNode)
+  {
+    Invalidate();
+
+    std::weak_ptr<SgfcGamePropertyIndex> gamePropertyIndex = weak_from_this();
+
+    NodeVisitCallback nodeVisitCallback = [this, &gamePropertyIndex](std::shared_ptr<ISgfcNode> node) -> SgfcNodeIterationContinuation
+    {
+      std::size_t nodeNumber = this->nodes.size();
+
+      SgfcNode* nodeImplementation = static_cast<SgfcNode*>(node.get());
+
+      this->nodes.push_back(nodeImplementation);
+      this->nodeNumbers[nodeImplementation] = nodeNumber;
+      this->indexedProperties.emplace_back();
+      SetIndexedProperties(nodeNumber, *node);
+      AddIndexEntries(nodeNumber);
+
+      nodeImplementation->SetGamePropertyIndex(gamePropertyIndex);
+
+      return SgfcNodeIterationContinuation::VerticalAndLateral;
+    };
+
+    SgfcNodeIterator nodeIterator;
+    nodeIterator.IterateOverNodesDepthFirst(rootNode, nodeVisitCallback);
+
+    this->isValid = true;
+  }
+
+  void SgfcGamePropertyIndex::Invalidate()
+  {
+    this->isValid = false;
+
+    this->nodes.clear();
+    this->nodeNumbers.clear();
+    this->indexedProperties.clear();
+    this->nodeNumbersByPropertyType.clear();
+    this->propertyNameIds.clear();
+    this->nodeNumbersByPropertyNameId.clear();
+  }
+
+  void SgfcGamePropertyIndex::UpdateNode(const ISgfcNode* node)
+  {
+    if (! this->isValid)
+      return;
+
+    auto it = this->nodeNumbers.find(node);
+    if (it == this->nodeNumbers.end())
+      return;
+
+    std::size_t nodeNumber = it->second;
+
+    RemoveIndexEntries(nodeNumber);
+    SetIndexedProperties(nodeNumber, *node);
+    AddIndexEntries(nodeNumber);
+  }
+
+  std::vector<std::shared_ptr<ISgfcNode>> SgfcGamePropertyIndex::GetNodes(SgfcPropertyType propertyType) const
+  {
+    std::size_t propertyTypeIndex = static_cast<std::size_t>(propertyType);
+    if (propertyTypeIndex >= this->nodeNumbersByPropertyType.size())
+      return std::vector<std::shared_ptr<ISgfcNode>>();
+
+    return GetNodes(this->nodeNumbersByPropertyType[propertyTypeIndex]);
+  }
+
+  std::vector<std::shared_ptr<ISgfcNode>> SgfcGamePropertyIndex::GetNodes(const std::string& propertyName) const
+  {
+    auto it = this->propertyNameIds.find(propertyName);
+    if (it == this->propertyNameIds.end())
+      return std::vector<std::shared_ptr<ISgfcNode>>();
+
+    return GetNodes(this->nodeNumbersByPropertyNameId[it->second]);
+  }
+
+  /// @brief Records the types and names of the properties of @a node as the
+  /// indexed properties of the node with number @a nodeNumber. Property names
+  /// are assigned a number when they are encountered for the first time.
+  void SgfcGamePropertyIndex::SetIndexedProperties(std::size_t nodeNumber, const ISgfcNode& node)
+  {
+    std::vector<IndexedProperty>& indexedProperties = this->indexedProperties[nodeNumber];
+    indexedProperties.clear();
+
+    for (const auto& property : node.GetProperties())
+    {
+      auto result = this->propertyNameIds.emplace(property->GetPropertyName(), this->propertyNameIds.size());
+      if (result.second)
+        this->nodeNumbersByPropertyNameId.emplace_back();
+
+      indexedProperties.push_back({ property->GetPropertyType(), result.first->second });
+    }
+  }
+
+  void SgfcGamePropertyIndex::AddIndexEntries(std::size_t nodeNumber)
+  {
+    for (const auto& indexedProperty : this->indexedProperties[nodeNumber])
+    {
+      std::size_t propertyTypeIndex = static_cast<std::size_t>(indexedProperty.PropertyType);
+      if (propertyTypeIndex >= this->nodeNumbersByPropertyType.size())
+        this->nodeNumbersByPropertyType.resize(propertyTypeIndex + 1);
+
+      InsertNodeNumber(this->nodeNumbersByPropertyType[propertyTypeIndex], nodeNumber);
+      InsertNodeNumber(this->nodeNumbersByPropertyNameId[indexedProperty.PropertyNameId], nodeNumber);
+    }
+  }
+
+  void SgfcGamePropertyIndex::RemoveIndexEntries(std::size_t nodeNumber)
+  {
+    for (const auto& indexedProperty : this->indexedProperties[nodeNumber])
+    {
+      std::size_t propertyTypeIndex = static_cast<std::size_t>(indexedProperty.PropertyType);
+      EraseNodeNumber(this->nodeNumbersByPropertyType[propertyTypeIndex], nodeNumber);
+      EraseNodeNumber(this->nodeNumbersByPropertyNameId[indexedProperty.PropertyNameId], nodeNumber);
+    }
+  }
+
+  std::vector<std::shared_ptr<ISgfcNode>> SgfcGamePropertyIndex::GetNodes(const std::vector<std::size_t>& nodeNumbers) const
+  {
+    std::vector<std::shared_ptr<ISgfcNode>> nodes;
+    nodes.reserve(nodeNumbers.size());
+
+    // shared_from_this returns a const object pointer because the index
+    // stores const pointers
+    for (auto nodeNumber : nodeNumbers)
+      nodes.push_back(std::const_pointer_cast<SgfcNode>(this->nodes[nodeNumber]->shared_from_this()));
+
+    return nodes;
+  }
+
+  /// @brief Inserts @a nodeNumber into @a nodeNumbers so that @a nodeNumbers
+  /// remains sorted in ascending order. Does nothing if @a nodeNumbers already
+  /// contains @a nodeNumber. This happens if a node contains several custom
+  /// properties.
+  void SgfcGamePropertyIndex::InsertNodeNumber(std::vector<std::size_t>& nodeNumbers, std::size_t nodeNumber)
+  {
+    // Optimize for the common case where Build() appends node numbers
+    if (nodeNumbers.empty() || nodeNumbers.back() < nodeNumber)
+    {
+      nodeNumbers.push_back(nodeNumber);
+      return;
+    }
+
+    auto it = std::lower_bound(nodeNumbers.begin(), nodeNumbers.end(), nodeNumber);
+    if (it != nodeNumbers.end() && *it == nodeNumber)
+      return;
+
+    nodeNumbers.insert(it, nodeNumber);
+  }
+
+  /// @brief Removes @a nodeNumber from @a nodeNumbers. Does nothing if
+  /// @a nodeNumbers does not contain @a nodeNumber. This happens if a node
+  /// contains several custom properties.
+  void SgfcGamePropertyIndex::EraseNodeNumber(std::vector<std::size_t>& nodeNumbers, std::size_t nodeNumber)
+  {
+    auto it = std::lower_bound(nodeNumbers.begin(), nodeNumbers.end(), nodeNumber);
+    if (it != nodeNumbers.end() && *it == nodeNumber)
+      nodeNumbers.erase(it);
+  }
+}
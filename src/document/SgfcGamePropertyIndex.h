@@ -0,0 +1,159 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../include/ISgfcNode.h"
+#include "../../include/SgfcPropertyType.h"
+
+// C++ Standard Library includes
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  class SgfcNode;
+
+  /// @brief The SgfcGamePropertyIndex class is an inverted index that maps
+  /// property types and property names to the nodes of a game tree that
+  /// contain a property with that type or name.
+  ///
+  /// @ingroup internals
+  /// @ingroup game-tree
+  ///
+  /// SgfcGame owns an SgfcGamePropertyIndex object and uses it to answer
+  /// queries such as "all nodes that have a comment" in O(result) instead of
+  /// iterating the entire game tree.
+  ///
+  /// The index assigns each node a number that corresponds to the position of
+  /// the node in a depth-first iteration of the game tree. The index stores
+  /// only these numbers, in ascending order, for every property type and every
+  /// property name. Query results are therefore always in depth-first order.
+  ///
+  /// Keeping the index up-to-date works like this:
+  /// - Build() populates the index and registers the index with every SgfcNode
+  ///   object in the game tree.
+  /// - SgfcNode invokes UpdateNode() whenever the node's collection of
+  ///   properties changes. The index then incrementally updates only the
+  ///   entries for that node.
+  /// - SgfcTreeBuilder and SgfcGame invoke Invalidate() whenever the structure
+  ///   of the game tree changes, because such a change invalidates the node
+  ///   numbers. The owner of the index must invoke Build() again before the
+  ///   next query.
+  /// - When SgfcTreeBuilder removes a node from a game tree it also invokes
+  ///   Invalidate() on the index that the node's parent is registered with.
+  ///   This covers the case where the tree builder of one game moves a node
+  ///   out of the game tree of another game.
+  ///
+  /// The SgfcGamePropertyIndex class inherits from std::enable_shared_from_this
+  /// so that it can register itself with SgfcNode objects. This only works if
+  /// the SgfcGamePropertyIndex object is owned by a std::shared_ptr.
+  class SgfcGamePropertyIndex : public std::enable_shared_from_this<SgfcGamePropertyIndex>
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcGamePropertyIndex object.
+    /// The index is invalid until Build() is invoked.
+    SgfcGamePropertyIndex();
+
+    /// @brief Destroys and cleans up the SgfcGamePropertyIndex object.
+    virtual ~SgfcGamePropertyIndex();
+
+    /// @brief Returns true if the index reflects the current state of the game
+    /// tree. Returns false if Build() has not been invoked yet, or if
+    /// Invalidate() has been invoked since the last time that Build() was
+    /// invoked.
+    bool IsValid() const;
+
+    /// @brief Discards the current content of the index and populates the
+    /// index with the nodes in the game tree that starts with @a rootNode.
+    /// @a rootNode may be @e nullptr, in which case the index is empty. After
+    /// this method returns the index is valid.
+    ///
+    /// The implementation of this method assumes that all node objects are
+    /// instances of SgfcNode.
+    void Build(std::shared_ptr<ISgfcNode> rootNode);
+
+    /// @brief Discards the current content of the index and marks the index
+    /// as invalid.
+    void Invalidate();
+
+    /// @brief Updates the index entries of @a node to reflect the node's
+    /// current collection of properties. Does nothing if the index is invalid
+    /// or if @a node is not part of the index.
+    void UpdateNode(const ISgfcNode* node);
+
+    /// @brief Returns the nodes that contain a property with the specified
+    /// type @a propertyType, in depth-first order. Returns an empty collection
+    /// if no node contains such a property or if the index is invalid.
+    std::vector<std::shared_ptr<ISgfcNode>> GetNodes(SgfcPropertyType propertyType) const;
+
+    /// @brief Returns the nodes that contain a property with the specified
+    /// name @a propertyName, in depth-first order. Returns an empty collection
+    /// if no node contains such a property or if the index is invalid.
+    std::vector<std::shared_ptr<ISgfcNode>> GetNodes(const std::string& propertyName) const;
+
+  private:
+    /// @brief A property that was indexed for a node. Used by UpdateNode() to
+    /// find out which index entries need to be removed after the node's
+    /// collection of properties changed.
+    struct IndexedProperty
+    {
+      SgfcPropertyType PropertyType;
+      std::size_t PropertyNameId;
+    };
+
+    bool isValid;
+
+    /// @brief The nodes of the game tree in depth-first order. The position
+    /// of a node in this collection is the node number. The index does not
+    /// keep the nodes alive, the game tree does. Removing a node from the
+    /// game tree invalidates the index, regardless of which game's tree
+    /// builder removes the node.
+    std::vector<const SgfcNode*> nodes;
+
+    /// @brief Maps nodes to their node number.
+    std::unordered_map<const ISgfcNode*, std::size_t> nodeNumbers;
+
+    /// @brief The properties that were indexed for each node, in the same
+    /// order as @e nodes.
+    std::vector<std::vector<IndexedProperty>> indexedProperties;
+
+    /// @brief Node numbers in ascending order for each SgfcPropertyType. The
+    /// position of an element in this collection is the numeric value of the
+    /// SgfcPropertyType.
+    std::vector<std::vector<std::size_t>> nodeNumbersByPropertyType;
+
+    /// @brief Maps property names to a number, so that property names need to
+    /// be stored only once.
+    std::unordered_map<std::string, std::size_t> propertyNameIds;
+
+    /// @brief Node numbers in ascending order for each property name. The
+    /// position of an element in this collection is the number of the
+    /// property name in @e propertyNameIds.
+    std::vector<std::vector<std::size_t>> nodeNumbersByPropertyNameId;
+
+    void SetIndexedProperties(std::size_t nodeNumber, const ISgfcNode& node);
+    void AddIndexEntries(std::size_t nodeNumber);
+    void RemoveIndexEntries(std::size_t nodeNumber);
+    std::vector<std::shared_ptr<ISgfcNode>> GetNodes(const std::vector<std::size_t>& nodeNumbers) const;
+
+    static void InsertNodeNumber(std::vector<std::size_t>& nodeNumbers, std::size_t nodeNumber);
+    static void EraseNodeNumber(std::vector<std::size_t>& nodeNumbers, std::size_t nodeNumber);
+  };
+}
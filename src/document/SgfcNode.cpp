@@ -15,22 +15,37 @@
 // -----------------------------------------------------------------------------
 
 // Project includes
+#include "../../include/ISgfcComposedPropertyValue.h"
+#include "../../include/ISgfcSinglePropertyValue.h"
 #include "../../include/SgfcConstants.h"
 #include "../../include/SgfcPlusPlusFactory.h"
+#include "../game/go/SgfcGoPositionCache.h"
 #include "../game/SgfcGameInfo.h"
 #include "../SgfcUtility.h"
+#include "SgfcGamePropertyIndex.h"
 #include "SgfcNode.h"
 
 // C++ Standard Library includes
 #include <algorithm>
+#include <array>
 #include <list>
 #include <map>
 #include <set>
 #include <sstream>
+#include <utility>
 
 namespace LibSgfcPlusPlus
 {
+  std::atomic<std::uint64_t> SgfcNode::nextGeneration(1);
+
   SgfcNode::SgfcNode()
+    : propertiesGeneration(nextGeneration++)
+    , subtreeGeneration(propertiesGeneration)
+    , isSubtreeModified(true)
+    , propertiesHash(0)
+    , propertiesHashGeneration(0)
+    , contentHash(0)
+    , contentHashGeneration(0)
   {
   }
 
@@ -306,6 +321,7 @@ namespace LibSgfcPlusPlus
       throw std::invalid_argument("SetProperties failed: " + validationFailedReason);
 
     this->properties = properties;
+    OnPropertiesChanged();
   }
 
   void SgfcNode::SetProperty(std::shared_ptr<ISgfcProperty> property)
@@ -338,6 +354,7 @@ namespace LibSgfcPlusPlus
     }
 
     this->properties.push_back(property);
+    OnPropertiesChanged();
   }
 
   void SgfcNode::AppendProperty(std::shared_ptr<ISgfcProperty> property)
@@ -358,6 +375,7 @@ namespace LibSgfcPlusPlus
       throw std::invalid_argument("AppendProperty failed: " + validationFailedReason);
 
     this->properties = propertiesCopy;
+    OnPropertiesChanged();
   }
 
   void SgfcNode::RemoveProperty(std::shared_ptr<ISgfcProperty> property)
@@ -368,33 +386,202 @@ namespace LibSgfcPlusPlus
       throw std::invalid_argument("RemoveProperty failed: Property is not part of the node");
 
     this->properties.erase(result);
+    OnPropertiesChanged();
   }
 
   void SgfcNode::RemoveAllProperties()
   {
     this->properties.clear();
+    OnPropertiesChanged();
+  }
+
+  bool SgfcNode::HasProperty(SgfcPropertyType propertyType) const
+  {
+    return this->propertyTypes.test(static_cast<std::size_t>(propertyType));
   }
 
   std::shared_ptr<ISgfcProperty> SgfcNode::GetProperty(SgfcPropertyType propertyType) const
   {
+    if (! HasProperty(propertyType))
+      return nullptr;
+
+    std::size_t propertyIndex = this->propertyTypeSlots[GetPropertyTypeSlot(propertyType)];
+    return this->properties[propertyIndex];
+  }
+
+  std::shared_ptr<ISgfcProperty> SgfcNode::GetProperty(const std::string& propertyName) const
+  {
+    // Fast path for the common case where the property name is the name of a
+    // property defined in the SGF standard. We still have to compare the
+    // name because the node does not enforce that the property type and the
+    // property name of a property match.
+    SgfcPropertyType propertyType = SgfcUtility::MapPropertyNameToPropertyType(propertyName);
+    if (propertyType != SgfcPropertyType::Unknown)
+    {
+      auto property = GetProperty(propertyType);
+      if (property != nullptr && property->GetPropertyName() == propertyName)
+        return property;
+    }
+
     for (const auto& property : this->properties)
     {
-      if (property->GetPropertyType() == propertyType)
+      if (property->GetPropertyName() == propertyName)
         return property;
     }
 
     return nullptr;
   }
 
-  std::shared_ptr<ISgfcProperty> SgfcNode::GetProperty(const std::string& propertyName) const
+  void SgfcNode::SetGamePropertyIndex(std::weak_ptr<SgfcGamePropertyIndex> gamePropertyIndex)
+  {
+    this->gamePropertyIndex = gamePropertyIndex;
+  }
+
+  void SgfcNode::SetGoPositionCache(std::weak_ptr<SgfcGoPositionCache> goPositionCache)
+  {
+    this->goPositionCache = goPositionCache;
+  }
+
+  void SgfcNode::InvalidateGameIndexes()
+  {
+    auto gamePropertyIndexLocked = this->gamePropertyIndex.lock();
+    if (gamePropertyIndexLocked != nullptr)
+      gamePropertyIndexLocked->Invalidate();
+
+    auto goPositionCacheLocked = this->goPositionCache.lock();
+    if (goPositionCacheLocked != nullptr)
+      goPositionCacheLocked->Invalidate();
+  }
+
+  /// @brief Updates all indexes that depend on the node's collection of
+  /// properties. Must be invoked whenever the content of the collection of
+  /// properties changes.
+  void SgfcNode::OnPropertiesChanged()
+  {
+    RebuildPropertyIndex();
+
+    std::uint64_t generation = nextGeneration++;
+    this->propertiesGeneration = generation;
+    MarkSubtreeModified(generation);
+
+    auto gamePropertyIndexLocked = this->gamePropertyIndex.lock();
+    if (gamePropertyIndexLocked != nullptr)
+      gamePropertyIndexLocked->UpdateNode(this);
+
+    // The cached positions of this node and of all its descendants may now
+    // be wrong. Finding out which checkpoints are affected would be more
+    // expensive than simply replaying again, so all of them are discarded.
+    auto goPositionCacheLocked = this->goPositionCache.lock();
+    if (goPositionCacheLocked != nullptr)
+      goPositionCacheLocked->Invalidate();
+  }
+
+  std::uint64_t SgfcNode::GetPropertiesGeneration() const
+  {
+    return this->propertiesGeneration;
+  }
+
+  std::uint64_t SgfcNode::GetSubtreeGeneration() const
+  {
+    return this->subtreeGeneration;
+  }
+
+  bool SgfcNode::IsSubtreeModified() const
+  {
+    return this->isSubtreeModified;
+  }
+
+  void SgfcNode::ClearSubtreeModified()
+  {
+    this->isSubtreeModified = false;
+  }
+
+  void SgfcNode::OnChildrenChanged()
   {
+    MarkSubtreeModified(nextGeneration++);
+  }
+
+  /// @brief Assigns @a generation as the new subtree generation to the node
+  /// and to its ancestors, and marks their subtrees as modified.
+  ///
+  /// If a node is marked as modified then all of its ancestors are marked as
+  /// well, and the generations that they received when they were marked have
+  /// not been seen by anyone yet. The walk up the game tree therefore stops at
+  /// the first ancestor that is already marked. This keeps the cost of
+  /// building a game tree node by node independent of the depth of the game
+  /// tree.
+  ///
+  /// The implementation of this method assumes that all ancestors are
+  /// instances of SgfcNode.
+  void SgfcNode::MarkSubtreeModified(std::uint64_t generation)
+  {
+    this->subtreeGeneration = generation;
+    if (this->isSubtreeModified.exchange(true))
+      return;
+
+    std::shared_ptr<ISgfcNode> ancestorNode = GetParent();
+    while (ancestorNode != nullptr)
+    {
+      SgfcNode* ancestorNodeImplementation = static_cast<SgfcNode*>(ancestorNode.get());
+      ancestorNodeImplementation->subtreeGeneration = generation;
+      if (ancestorNodeImplementation->isSubtreeModified.exchange(true))
+        break;
+
+      ancestorNode = ancestorNodeImplementation->GetParent();
+    }
+  }
+
+  /// @brief Rebuilds the property index from scratch.
+  ///
+  /// Rebuilding costs O(n) where n is the number of properties in the node,
+  /// which is typically a small number. In exchange all lookups by property
+  /// type cost O(1).
+  void SgfcNode::RebuildPropertyIndex()
+  {
+    this->propertyTypes.reset();
+    this->propertyTypeSlots.clear();
+
+    if (this->properties.empty())
+      return;
+
+    std::array<std::size_t, PropertyTypeCount> propertyIndexes;
+
+    std::size_t propertyIndex = 0;
     for (const auto& property : this->properties)
     {
-      if (property->GetPropertyName() == propertyName)
-        return property;
+      std::size_t propertyTypeIndex = static_cast<std::size_t>(property->GetPropertyType());
+
+      // If there are several custom properties we index the first one, to
+      // preserve the behaviour documented for GetProperty()
+      if (! this->propertyTypes.test(propertyTypeIndex))
+      {
+        this->propertyTypes.set(propertyTypeIndex);
+        propertyIndexes[propertyTypeIndex] = propertyIndex;
+      }
+
+      propertyIndex++;
     }
 
-    return nullptr;
+    this->propertyTypeSlots.reserve(this->propertyTypes.count());
+    for (std::size_t propertyTypeIndex = 0; propertyTypeIndex < PropertyTypeCount; propertyTypeIndex++)
+    {
+      if (this->propertyTypes.test(propertyTypeIndex))
+        this->propertyTypeSlots.push_back(propertyIndexes[propertyTypeIndex]);
+    }
+  }
+
+  /// @brief Returns the position in the compact slot collection of the element
+  /// that refers to the property with type @a propertyType. The caller must
+  /// make sure that the node has a property with type @a propertyType.
+  std::size_t SgfcNode::GetPropertyTypeSlot(SgfcPropertyType propertyType) const
+  {
+    std::size_t propertyTypeIndex = static_cast<std::size_t>(propertyType);
+
+    // Shifting left discards the bit for propertyType and all bits above it.
+    // Counting the remaining bits gives the number of property types that are
+    // lower than propertyType and that are present in the node.
+    auto lowerPropertyTypes = this->propertyTypes << (PropertyTypeCount - propertyTypeIndex);
+    return lowerPropertyTypes.count();
   }
 
   bool SgfcNode::ValidateProperties(const std::vector<std::shared_ptr<ISgfcProperty>>& properties, std::string& validationFailedReason)
@@ -497,4 +684,141 @@ namespace LibSgfcPlusPlus
 
     return properties;
   }
+
+  std::uint64_t SgfcNode::GetContentHash() const
+  {
+    if (HasValidContentHash())
+      return this->contentHash;
+
+    // Use an explicit stack instead of recursion. Game trees can be very deep.
+    // Subtrees whose hash is still valid are not visited.
+    std::vector<ContentHashStep> contentHashSteps;
+    contentHashSteps.push_back({ this, false });
+
+    while (! contentHashSteps.empty())
+    {
+      ContentHashStep& contentHashStep = contentHashSteps.back();
+      const SgfcNode* node = contentHashStep.Node;
+
+      if (contentHashStep.AreChildNodesHashed)
+      {
+        contentHashSteps.pop_back();
+        node->UpdateContentHash();
+        continue;
+      }
+
+      // Must be done before pushing invalidates the reference
+      contentHashStep.AreChildNodesHashed = true;
+
+      for (auto childNode = node->firstChild; childNode != nullptr; childNode = childNode->GetNextSibling())
+      {
+        const SgfcNode* childNodeImplementation = static_cast<const SgfcNode*>(childNode.get());
+        if (! childNodeImplementation->HasValidContentHash())
+          contentHashSteps.push_back({ childNodeImplementation, false });
+      }
+    }
+
+    return this->contentHash;
+  }
+
+  std::uint64_t SgfcNode::GetPropertiesHash() const
+  {
+    if (this->propertiesHashGeneration == this->propertiesGeneration)
+      return this->propertiesHash;
+
+    // The SGF standard does not define an order of properties, so two nodes
+    // that differ only in the order of their properties must have the same
+    // hash
+    std::vector<std::pair<std::string, const ISgfcProperty*>> sortedProperties;
+    for (const auto& property : this->properties)
+      sortedProperties.push_back(std::make_pair(property->GetPropertyName(), property.get()));
+    std::sort(
+      std::begin(sortedProperties),
+      std::end(sortedProperties),
+      [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    // Lengths and counts are included so that different content cannot
+    // result in the same sequence of bytes
+    std::string hashData;
+    for (const auto& sortedProperty : sortedProperties)
+    {
+      AppendHashData(sortedProperty.first, hashData);
+
+      auto propertyValues = sortedProperty.second->GetPropertyValues();
+      AppendHashData(static_cast<std::uint64_t>(propertyValues.size()), hashData);
+
+      for (const auto& propertyValue : propertyValues)
+      {
+        if (propertyValue->IsComposedValue())
+        {
+          const ISgfcComposedPropertyValue* composedValue = propertyValue->ToComposedValue();
+          hashData.push_back('c');
+          AppendHashData(composedValue->GetValue1()->GetRawValue(), hashData);
+          AppendHashData(composedValue->GetValue2()->GetRawValue(), hashData);
+        }
+        else
+        {
+          hashData.push_back('s');
+          AppendHashData(propertyValue->ToSingleValue()->GetRawValue(), hashData);
+        }
+      }
+    }
+
+    // The hash must be stored before the generation that publishes it
+    this->propertiesHash = SgfcUtility::GetHash(hashData);
+    this->propertiesHashGeneration = this->propertiesGeneration;
+
+    return this->propertiesHash;
+  }
+
+  /// @brief Returns true if the cached content hash of the node is valid.
+  /// Returns false if the node has no content hash yet, or if the subtree
+  /// that starts with the node was modified since the hash was computed.
+  bool SgfcNode::HasValidContentHash() const
+  {
+    return this->contentHashGeneration == this->subtreeGeneration;
+  }
+
+  /// @brief Computes the content hash of the node from the hash of the
+  /// node's properties and the content hashes of the node's child nodes, and
+  /// caches it. The content hashes of all child nodes must be valid.
+  ///
+  /// Caching the hash also clears the node's dirty flag. MarkSubtreeModified()
+  /// stops its walk up the game tree at the first ancestor whose flag is
+  /// set, so without clearing the flag later modifications of descendants
+  /// would not give the node a new subtree generation, and the cached hash
+  /// would not be discarded. Clearing the flag is safe because the flags of
+  /// all child nodes were cleared when their hashes were cached.
+  void SgfcNode::UpdateContentHash() const
+  {
+    std::string hashData;
+    AppendHashData(GetPropertiesHash(), hashData);
+
+    for (auto childNode = this->firstChild; childNode != nullptr; childNode = childNode->GetNextSibling())
+      AppendHashData(static_cast<const SgfcNode*>(childNode.get())->contentHash.load(), hashData);
+
+    // The hash must be stored before the generation that publishes it
+    this->contentHash = SgfcUtility::GetHash(hashData);
+    this->contentHashGeneration = this->subtreeGeneration;
+    this->isSubtreeModified = false;
+  }
+
+  /// @brief Appends the 8 bytes of @a value to @a hashData, in little endian
+  /// byte order so that the hash does not depend on the platform.
+  void SgfcNode::AppendHashData(std::uint64_t value, std::string& hashData)
+  {
+    for (int byteIndex = 0; byteIndex < 8; byteIndex++)
+    {
+      hashData.push_back(static_cast<char>(value & 0xff));
+      value >>= 8;
+    }
+  }
+
+  /// @brief Appends the length of @a value, followed by the bytes of
+  /// @a value, to @a hashData.
+  void SgfcNode::AppendHashData(const std::string& value, std::string& hashData)
+  {
+    AppendHashData(static_cast<std::uint64_t>(value.size()), hashData);
+    hashData.append(value);
+  }
 }
@@ -19,8 +19,18 @@
 // Project includes
 #include "../../include/ISgfcNode.h"
 
+// C++ Standard Library includes
+#include <atomic>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
 namespace LibSgfcPlusPlus
 {
+  // Forward declarations
+  class SgfcGamePropertyIndex;
+  class SgfcGoPositionCache;
+
   /// @brief The SgfcNode class provides an implementation of the
   /// ISgfcNode interface. See the interface header file for
   /// documentation.
@@ -113,17 +123,169 @@ namespace LibSgfcPlusPlus
     virtual void AppendProperty(std::shared_ptr<ISgfcProperty> property) override;
     virtual void RemoveProperty(std::shared_ptr<ISgfcProperty> property) override;
     virtual void RemoveAllProperties() override;
+    virtual bool HasProperty(SgfcPropertyType propertyType) const override;
     virtual std::shared_ptr<ISgfcProperty> GetProperty(SgfcPropertyType propertyType) const override;
     virtual std::shared_ptr<ISgfcProperty> GetProperty(const std::string& propertyName) const override;
     virtual std::vector<std::shared_ptr<ISgfcProperty>> GetProperties(SgfcPropertyCategory propertyCategory) const override;
     virtual std::vector<std::shared_ptr<ISgfcProperty>> GetInheritedProperties() const override;
 
+    virtual std::uint64_t GetContentHash() const override;
+    /// @brief Returns a hash of the node's properties. This is the part of
+    /// the hash returned by GetContentHash() that does not depend on the
+    /// node's child nodes. The hash is cached until the node's collection of
+    /// properties changes.
+    ///
+    /// This is a library-internal getter method.
+    std::uint64_t GetPropertiesHash() const;
+
+    /// @brief Sets the game property index that the node notifies whenever
+    /// its collection of properties changes to @a gamePropertyIndex,
+    /// overwriting the previously set game property index.
+    ///
+    /// This is a library-internal setter method. Library clients should never
+    /// be able to invoke this directly.
+    void SetGamePropertyIndex(std::weak_ptr<SgfcGamePropertyIndex> gamePropertyIndex);
+
+    /// @brief Sets the Go position cache that the node invalidates whenever
+    /// its collection of properties changes to @a goPositionCache,
+    /// overwriting the previously set Go position cache.
+    ///
+    /// This is a library-internal setter method. Library clients should never
+    /// be able to invoke this directly.
+    void SetGoPositionCache(std::weak_ptr<SgfcGoPositionCache> goPositionCache);
+
+    /// @brief Invalidates the game property index and the Go position cache
+    /// that the node is registered with.
+    ///
+    /// This is a library-internal method. Library clients should never be
+    /// able to invoke this directly. Instead SgfcTreeBuilder invokes this on
+    /// the parent of a node that it removes from a game tree. The game tree
+    /// can belong to a game other than the one that the tree builder
+    /// operates on, so invalidating only the tree builder's own game is not
+    /// sufficient.
+    void InvalidateGameIndexes();
+
+    /// @brief Returns the generation of the node's collection of properties.
+    /// The generation changes whenever the node's collection of properties
+    /// changes. Generations are unique across all nodes, i.e. two nodes never
+    /// have the same generation.
+    ///
+    /// This is a library-internal getter method.
+    std::uint64_t GetPropertiesGeneration() const;
+
+    /// @brief Returns the generation of the subtree that starts with the node.
+    /// The generation changes whenever the node's collection of properties
+    /// changes, whenever the node gains or loses a child node, and whenever
+    /// the subtree of one of the node's descendants changes.
+    ///
+    /// This is a library-internal getter method.
+    std::uint64_t GetSubtreeGeneration() const;
+
+    /// @brief Returns true if the subtree that starts with the node was
+    /// modified since ClearSubtreeModified() was last invoked. Returns false
+    /// if the subtree was not modified. A newly constructed node is modified.
+    ///
+    /// If a node is modified then all of its ancestors are modified as well.
+    /// This is a library-internal getter method.
+    bool IsSubtreeModified() const;
+
+    /// @brief Clears the flag that IsSubtreeModified() returns. The caller
+    /// must make sure that the flag of all descendants of the node is also
+    /// cleared, otherwise later modifications of the descendants are not
+    /// propagated to the node.
+    ///
+    /// This is a library-internal method. Library clients should never be
+    /// able to invoke this directly.
+    void ClearSubtreeModified();
+
+    /// @brief Notifies the node that it gained or lost a child node. The
+    /// node and its ancestors receive a new subtree generation.
+    ///
+    /// This is a library-internal method. Library clients should never be
+    /// able to invoke this directly. Instead SgfcTreeBuilder invokes this.
+    void OnChildrenChanged();
+
   private:
     std::shared_ptr<ISgfcNode> firstChild;
     std::shared_ptr<ISgfcNode> nextSibling;
     std::weak_ptr<ISgfcNode> parent;  // must be weak_ptr to break reference cycle
     std::vector<std::shared_ptr<ISgfcProperty>> properties;
 
+    /// @brief The number of SgfcPropertyType enum values, including
+    /// SgfcPropertyType::Unknown which is the last enum value.
+    static constexpr std::size_t PropertyTypeCount = static_cast<std::size_t>(SgfcPropertyType::Unknown) + 1;
+
+    /// @brief Property index, part 1: A bitset that has one bit per
+    /// SgfcPropertyType. A bit is set if the node has a property of the
+    /// corresponding type. The bit for SgfcPropertyType::Unknown is set if the
+    /// node has at least one custom property.
+    std::bitset<PropertyTypeCount> propertyTypes;
+
+    /// @brief Property index, part 2: A compact map from SgfcPropertyType to
+    /// the position of the property in @e properties. The collection has one
+    /// element for each bit that is set in @e propertyTypes, ordered by
+    /// property type. The position of the element for a given property type
+    /// is the number of bits set in @e propertyTypes below the bit for that
+    /// property type. For SgfcPropertyType::Unknown the element refers to the
+    /// first custom property.
+    std::vector<std::size_t> propertyTypeSlots;
+
+    /// @brief The index of the game whose game tree the node was part of when
+    /// the index was last built. Can be expired.
+    std::weak_ptr<SgfcGamePropertyIndex> gamePropertyIndex;
+
+    /// @brief The Go position cache that last replayed the node. Can be
+    /// expired.
+    std::weak_ptr<SgfcGoPositionCache> goPositionCache;
+
+    /// @brief Modification tracking, part 1: The generation of the node's
+    /// collection of properties.
+    std::uint64_t propertiesGeneration;
+
+    /// @brief Modification tracking, part 2: The generation of the subtree
+    /// that starts with the node.
+    std::uint64_t subtreeGeneration;
+
+    /// @brief Modification tracking, part 3: The dirty flag. This is atomic
+    /// because the flag is cleared while a document is encoded, which
+    /// multiple threads are allowed to do concurrently. This is mutable
+    /// because the flag is also cleared when GetContentHash() caches a hash.
+    mutable std::atomic<bool> isSubtreeModified;
+
+    /// @brief The source of the generations of all nodes.
+    static std::atomic<std::uint64_t> nextGeneration;
+
+    // The hashes are computed on demand, also by const methods. A hash is
+    // valid while its generation matches the corresponding generation of
+    // the node. Generations start with 1, so 0 means "no hash". The members
+    // are atomic because several threads may query hashes at the same time.
+    // A hash is stored before its generation, and the generation is loaded
+    // before the hash, so a thread that sees a matching generation also sees
+    // the hash. Threads that compute the same hash at the same time store
+    // the same values.
+    mutable std::atomic<std::uint64_t> propertiesHash;
+    mutable std::atomic<std::uint64_t> propertiesHashGeneration;
+    mutable std::atomic<std::uint64_t> contentHash;
+    mutable std::atomic<std::uint64_t> contentHashGeneration;
+
+    /// @brief A node whose content hash GetContentHash() has to compute,
+    /// and whether the content hashes of the node's child nodes have
+    /// already been computed.
+    struct ContentHashStep
+    {
+      const SgfcNode* Node;
+      bool AreChildNodesHashed;
+    };
+
+    void OnPropertiesChanged();
+    void MarkSubtreeModified(std::uint64_t generation);
+    bool HasValidContentHash() const;
+    void UpdateContentHash() const;
+    void RebuildPropertyIndex();
+    std::size_t GetPropertyTypeSlot(SgfcPropertyType propertyType) const;
+
+    static void AppendHashData(std::uint64_t value, std::string& hashData);
+    static void AppendHashData(const std::string& value, std::string& hashData);
     static bool ValidateProperties(const std::vector<std::shared_ptr<ISgfcProperty>>& properties, std::string& validationFailedReason);
   };
 }
@@ -15,6 +15,7 @@
 // -----------------------------------------------------------------------------
 
 // Project includes
+#include "SgfcGame.h"
 #include "SgfcNode.h"
 #include "SgfcTreeBuilder.h"
 
@@ -275,11 +276,17 @@ namespace LibSgfcPlusPlus
     if (node->IsRoot())
       return;
 
+    InvalidateGameIndexes();
+
     SgfcNode* nodeImplementation = static_cast<SgfcNode*>(node.get());
 
     auto parentNode = nodeImplementation->GetParent();
     SgfcNode* parentNodeImplementation = static_cast<SgfcNode*>(parentNode.get());
 
+    // The node may be removed from the game tree of a different game. That
+    // game's indexes must not keep referring to the node.
+    parentNodeImplementation->InvalidateGameIndexes();
+
     if (parentNodeImplementation->GetFirstChild() == node)
     {
       parentNodeImplementation->SetFirstChild(nodeImplementation->GetNextSibling());
@@ -295,6 +302,8 @@ namespace LibSgfcPlusPlus
     // Important: This must happen after we have re-linked the original
     // next sibling, otherwise the next sibling would become deallocated.
     nodeImplementation->SetNextSibling(nullptr);
+
+    parentNodeImplementation->OnChildrenChanged();
   }
 
   /// @brief Removes @a node and all of its next siblings from their current
@@ -318,6 +327,8 @@ namespace LibSgfcPlusPlus
     if (node == nullptr)
       return;
 
+    InvalidateGameIndexes();
+
     SgfcNode* previousSiblingNodeImplementation = static_cast<SgfcNode*>(node->GetPreviousSibling().get());
     if (previousSiblingNodeImplementation != nullptr)
       previousSiblingNodeImplementation->SetNextSibling(nullptr);
@@ -328,8 +339,14 @@ namespace LibSgfcPlusPlus
     SgfcNode* parentNodeImplementation = static_cast<SgfcNode*>(node->GetParent().get());
     if (parentNodeImplementation != nullptr)
     {
+      // The nodes may be removed from the game tree of a different game.
+      // That game's indexes must not keep referring to the nodes.
+      parentNodeImplementation->InvalidateGameIndexes();
+
       if (parentNodeImplementation->GetFirstChild() == node)
         parentNodeImplementation->SetFirstChild(nullptr);
+
+      parentNodeImplementation->OnChildrenChanged();
     }
 
     SgfcNode* nodeImplementation = static_cast<SgfcNode*>(node.get());
@@ -364,6 +381,8 @@ namespace LibSgfcPlusPlus
     std::shared_ptr<ISgfcNode> newParent,
     std::shared_ptr<ISgfcNode> newNextSibling) const
   {
+    InvalidateGameIndexes();
+
     SgfcNode* nodeImplementation = static_cast<SgfcNode*>(node.get());
 
     SgfcNode* newParentNodeImplementation = static_cast<SgfcNode*>(newParent.get());
@@ -389,5 +408,24 @@ namespace LibSgfcPlusPlus
 
     nodeImplementation->SetParent(newParent);
     nodeImplementation->SetNextSibling(newNextSibling);
+
+    newParentNodeImplementation->OnChildrenChanged();
+  }
+
+  /// @brief Notifies the game that the structure of the game tree is about to
+  /// change, so that the game can invalidate its property index and its Go
+  /// position cache.
+  ///
+  /// The implementation of this method assumes that the game object is an
+  /// instance of SgfcGame.
+  void SgfcTreeBuilder::InvalidateGameIndexes() const
+  {
+    auto gameLocked = this->game.lock();
+    if (gameLocked == nullptr)
+      return;
+
+    SgfcGame* gameImplementation = static_cast<SgfcGame*>(gameLocked.get());
+    gameImplementation->InvalidatePropertyIndex();
+    gameImplementation->InvalidateGoPositionCache();
   }
 }
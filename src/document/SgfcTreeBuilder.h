@@ -76,5 +76,6 @@ namespace LibSgfcPlusPlus
       std::shared_ptr<ISgfcNode> node,
       std::shared_ptr<ISgfcNode> newParent,
       std::shared_ptr<ISgfcNode> newNextSibling) const;
+    void InvalidateGameIndexes() const;
   };
 }
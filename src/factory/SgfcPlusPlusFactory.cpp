@@ -15,19 +15,37 @@
 // -----------------------------------------------------------------------------
 
 // Project includes
+#include "../../include/ISgfcGame.h"
+#include "../../include/ISgfcGoGameInfo.h"
 #include "../../include/SgfcConstants.h"
 #include "../../include/SgfcPlusPlusFactory.h"
+#include "../document/SgfcBinaryDocumentReader.h"
+#include "../document/SgfcBinaryDocumentWriter.h"
 #include "../document/SgfcDocument.h"
 #include "../document/SgfcGame.h"
 #include "../document/SgfcNode.h"
 #include "../document/SgfcTreeBuilder.h"
 #include "../game/go/SgfcGoGameInfo.h"
+#include "../game/go/SgfcGoOpeningTreeBuilder.h"
+#include "../game/go/SgfcGoPositionIndex.h"
+#include "../game/go/SgfcGoPositionIndexWriter.h"
+#include "../game/go/SgfcGoReplayEngine.h"
 #include "../game/SgfcGameInfo.h"
+#include "../game/SgfcGameInfoCatalog.h"
+#include "../game/SgfcGameInfoCatalogWriter.h"
 #include "../game/SgfcGameUtility.h"
 #include "../sgfc/argument/SgfcArguments.h"
+#include "../sgfc/frontend/SgfcArchiveReader.h"
+#include "../sgfc/frontend/SgfcBatchDocumentReader.h"
+#include "../sgfc/frontend/SgfcBatchDocumentWriter.h"
+#include "../sgfc/frontend/SgfcCachingDocumentReader.h"
+#include "../sgfc/frontend/SgfcCollectionReader.h"
 #include "../sgfc/frontend/SgfcCommandLine.h"
 #include "../sgfc/frontend/SgfcDocumentReader.h"
 #include "../sgfc/frontend/SgfcDocumentWriter.h"
+#include "../sgfc/frontend/SgfcGameInfoScanner.h"
+#include "../sgfc/frontend/SgfcMemoryCachingDocumentReader.h"
+#include "../sgfc/frontend/SgfcParseEventReader.h"
 #include "SgfcPropertyFactory.h"
 #include "SgfcPropertyValueFactory.h"
 
@@ -61,12 +79,113 @@ namespace LibSgfcPlusPlus
     return reader;
   }
 
+  std::shared_ptr<ISgfcCachingDocumentReader> SgfcPlusPlusFactory::CreateCachingDocumentReader(
+    const std::string& cacheDirectoryPath)
+  {
+    std::shared_ptr<ISgfcCachingDocumentReader> reader = std::shared_ptr<ISgfcCachingDocumentReader>(new SgfcCachingDocumentReader(
+      cacheDirectoryPath));
+    return reader;
+  }
+
+  std::shared_ptr<ISgfcMemoryCachingDocumentReader> SgfcPlusPlusFactory::CreateMemoryCachingDocumentReader()
+  {
+    auto documentReader = CreateDocumentReader();
+    return SgfcPlusPlusFactory::CreateMemoryCachingDocumentReader(documentReader);
+  }
+
+  std::shared_ptr<ISgfcMemoryCachingDocumentReader> SgfcPlusPlusFactory::CreateMemoryCachingDocumentReader(
+    std::shared_ptr<ISgfcDocumentReader> documentReader)
+  {
+    std::shared_ptr<ISgfcMemoryCachingDocumentReader> reader = std::shared_ptr<ISgfcMemoryCachingDocumentReader>(new SgfcMemoryCachingDocumentReader(
+      documentReader));
+    return reader;
+  }
+
+  std::shared_ptr<ISgfcCollectionReader> SgfcPlusPlusFactory::CreateCollectionReader(
+    const std::string& sgfFilePath)
+  {
+    return SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath, "");
+  }
+
+  std::shared_ptr<ISgfcCollectionReader> SgfcPlusPlusFactory::CreateCollectionReader(
+    const std::string& sgfFilePath,
+    const std::string& indexFilePath)
+  {
+    auto documentReader = CreateDocumentReader();
+    return SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath, indexFilePath, documentReader);
+  }
+
+  std::shared_ptr<ISgfcCollectionReader> SgfcPlusPlusFactory::CreateCollectionReader(
+    const std::string& sgfFilePath,
+    const std::string& indexFilePath,
+    std::shared_ptr<ISgfcDocumentReader> documentReader)
+  {
+    std::shared_ptr<ISgfcCollectionReader> reader = std::shared_ptr<ISgfcCollectionReader>(new SgfcCollectionReader(
+      sgfFilePath,
+      indexFilePath,
+      documentReader));
+    return reader;
+  }
+
+  std::shared_ptr<ISgfcArchiveReader> SgfcPlusPlusFactory::CreateArchiveReader(
+    const std::string& archiveFilePath)
+  {
+    auto documentReader = CreateDocumentReader();
+    return SgfcPlusPlusFactory::CreateArchiveReader(archiveFilePath, documentReader);
+  }
+
+  std::shared_ptr<ISgfcArchiveReader> SgfcPlusPlusFactory::CreateArchiveReader(
+    const std::string& archiveFilePath,
+    std::shared_ptr<ISgfcDocumentReader> documentReader)
+  {
+    std::shared_ptr<ISgfcArchiveReader> reader = std::shared_ptr<ISgfcArchiveReader>(new SgfcArchiveReader(
+      archiveFilePath,
+      documentReader));
+    return reader;
+  }
+
+  std::shared_ptr<ISgfcBatchDocumentReader> SgfcPlusPlusFactory::CreateBatchDocumentReader()
+  {
+    std::shared_ptr<ISgfcBatchDocumentReader> reader = std::shared_ptr<ISgfcBatchDocumentReader>(new SgfcBatchDocumentReader());
+    return reader;
+  }
+
+  std::shared_ptr<ISgfcParseEventReader> SgfcPlusPlusFactory::CreateParseEventReader()
+  {
+    std::shared_ptr<ISgfcParseEventReader> reader = std::shared_ptr<ISgfcParseEventReader>(new SgfcParseEventReader());
+    return reader;
+  }
+
+  std::shared_ptr<ISgfcGameInfoScanner> SgfcPlusPlusFactory::CreateGameInfoScanner()
+  {
+    std::shared_ptr<ISgfcGameInfoScanner> scanner = std::shared_ptr<ISgfcGameInfoScanner>(new SgfcGameInfoScanner());
+    return scanner;
+  }
+
   std::shared_ptr<ISgfcDocumentWriter> SgfcPlusPlusFactory::CreateDocumentWriter()
   {
     std::shared_ptr<ISgfcDocumentWriter> writer = std::shared_ptr<ISgfcDocumentWriter>(new SgfcDocumentWriter());
     return writer;
   }
 
+  std::shared_ptr<ISgfcBatchDocumentWriter> SgfcPlusPlusFactory::CreateBatchDocumentWriter()
+  {
+    std::shared_ptr<ISgfcBatchDocumentWriter> writer = std::shared_ptr<ISgfcBatchDocumentWriter>(new SgfcBatchDocumentWriter());
+    return writer;
+  }
+
+  std::shared_ptr<ISgfcBinaryDocumentReader> SgfcPlusPlusFactory::CreateBinaryDocumentReader()
+  {
+    std::shared_ptr<ISgfcBinaryDocumentReader> reader = std::shared_ptr<ISgfcBinaryDocumentReader>(new SgfcBinaryDocumentReader());
+    return reader;
+  }
+
+  std::shared_ptr<ISgfcBinaryDocumentWriter> SgfcPlusPlusFactory::CreateBinaryDocumentWriter()
+  {
+    std::shared_ptr<ISgfcBinaryDocumentWriter> writer = std::shared_ptr<ISgfcBinaryDocumentWriter>(new SgfcBinaryDocumentWriter());
+    return writer;
+  }
+
   std::shared_ptr<ISgfcDocument> SgfcPlusPlusFactory::CreateDocument()
   {
     auto game = CreateGame();
@@ -161,6 +280,69 @@ namespace LibSgfcPlusPlus
     return gameInfo;
   }
 
+  std::shared_ptr<ISgfcGameInfoCatalogWriter> SgfcPlusPlusFactory::CreateGameInfoCatalogWriter()
+  {
+    std::shared_ptr<ISgfcGameInfoCatalogWriter> gameInfoCatalogWriter = std::shared_ptr<ISgfcGameInfoCatalogWriter>(
+      new SgfcGameInfoCatalogWriter());
+    return gameInfoCatalogWriter;
+  }
+
+  std::shared_ptr<ISgfcGameInfoCatalog> SgfcPlusPlusFactory::CreateGameInfoCatalog(const std::string& catalogFilePath)
+  {
+    std::shared_ptr<ISgfcGameInfoCatalog> gameInfoCatalog = std::shared_ptr<ISgfcGameInfoCatalog>(
+      new SgfcGameInfoCatalog(catalogFilePath));
+    return gameInfoCatalog;
+  }
+
+  std::shared_ptr<ISgfcGoReplayEngine> SgfcPlusPlusFactory::CreateGoReplayEngine(std::shared_ptr<ISgfcGame> game)
+  {
+    if (game == nullptr)
+      throw std::invalid_argument("SgfcPlusPlusFactory::CreateGoReplayEngine failed: Game is nullptr");
+    if (! game->HasRootNode())
+      throw std::invalid_argument("SgfcPlusPlusFactory::CreateGoReplayEngine failed: Game has no root node");
+    if (game->GetGameType() != SgfcGameType::Go)
+      throw std::invalid_argument("SgfcPlusPlusFactory::CreateGoReplayEngine failed: Game type is not Go");
+
+    auto gameInfo = game->CreateGameInfo();
+    SgfcGoRuleset goRuleset = gameInfo->ToGoGameInfo()->GetGoRuleset();
+
+    return CreateGoReplayEngine(game->GetBoardSize(), goRuleset);
+  }
+
+  std::shared_ptr<ISgfcGoReplayEngine> SgfcPlusPlusFactory::CreateGoReplayEngine(SgfcBoardSize boardSize, SgfcGoRuleset goRuleset)
+  {
+    if (! boardSize.IsValid(SgfcGameType::Go))
+      throw std::invalid_argument("SgfcPlusPlusFactory::CreateGoReplayEngine failed: Board size is not valid for Go");
+
+    std::shared_ptr<ISgfcGoReplayEngine> goReplayEngine = std::shared_ptr<ISgfcGoReplayEngine>(
+      new SgfcGoReplayEngine(boardSize, goRuleset));
+    return goReplayEngine;
+  }
+
+  std::shared_ptr<ISgfcGoPositionIndexWriter> SgfcPlusPlusFactory::CreateGoPositionIndexWriter()
+  {
+    std::shared_ptr<ISgfcGoPositionIndexWriter> goPositionIndexWriter = std::shared_ptr<ISgfcGoPositionIndexWriter>(
+      new SgfcGoPositionIndexWriter());
+    return goPositionIndexWriter;
+  }
+
+  std::shared_ptr<ISgfcGoPositionIndex> SgfcPlusPlusFactory::CreateGoPositionIndex(const std::string& indexFilePath)
+  {
+    std::shared_ptr<ISgfcGoPositionIndex> goPositionIndex = std::shared_ptr<ISgfcGoPositionIndex>(
+      new SgfcGoPositionIndex(indexFilePath));
+    return goPositionIndex;
+  }
+
+  std::shared_ptr<ISgfcGoOpeningTreeBuilder> SgfcPlusPlusFactory::CreateGoOpeningTreeBuilder(SgfcBoardSize boardSize)
+  {
+    if (! boardSize.IsValid(SgfcGameType::Go))
+      throw std::invalid_argument("SgfcPlusPlusFactory::CreateGoOpeningTreeBuilder failed: Board size is not valid for Go");
+
+    std::shared_ptr<ISgfcGoOpeningTreeBuilder> goOpeningTreeBuilder = std::shared_ptr<ISgfcGoOpeningTreeBuilder>(
+      new SgfcGoOpeningTreeBuilder(boardSize));
+    return goOpeningTreeBuilder;
+  }
+
   std::shared_ptr<ISgfcPropertyFactory> SgfcPlusPlusFactory::CreatePropertyFactory()
   {
     std::shared_ptr<ISgfcPropertyFactory> factory = std::shared_ptr<ISgfcPropertyFactory>(
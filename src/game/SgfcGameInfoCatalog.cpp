@@ -0,0 +1,319 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../SgfcBinaryUtility.h"
+#include "../SgfcPrivateConstants.h"
+#include "SgfcGameInfoCatalog.h"
+
+// C++ Standard Library includes
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcGameInfoCatalog::SgfcGameInfoCatalog(const std::string& catalogFilePath)
+    : numberOfGames(0)
+  {
+    std::ifstream in(std::filesystem::u8path(catalogFilePath), std::ios::binary);
+    if (! in.is_open())
+    {
+      std::stringstream message;
+      message << "Failed to open file for reading: " << catalogFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    std::string magic(SgfcPrivateConstants::GameInfoCatalogMagic.size(), '\0');
+    in.read(&magic[0], static_cast<std::streamsize>(magic.size()));
+    if (magic != SgfcPrivateConstants::GameInfoCatalogMagic)
+    {
+      std::stringstream message;
+      message << "File is not a game info catalog file: " << catalogFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    std::uint32_t formatVersion = SgfcBinaryUtility::ReadUInt32(in);
+    if (formatVersion != SgfcPrivateConstants::GameInfoCatalogFormatVersion)
+    {
+      std::stringstream message;
+      message << "Game info catalog file has unsupported format version " << formatVersion << ": " << catalogFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    // Flags are reserved for future use
+    SgfcBinaryUtility::ReadUInt32(in);
+
+    std::uint64_t numberOfGames = SgfcBinaryUtility::ReadUInt64(in);
+    std::uint64_t numberOfStrings = SgfcBinaryUtility::ReadUInt64(in);
+
+    // Every game and every string takes up a minimum number of bytes. Checking
+    // the counts against the file size prevents a corrupt count from causing
+    // huge allocations. Checking the counts individually first guarantees
+    // that the size calculation cannot overflow.
+    std::uint64_t fileSize = std::filesystem::file_size(std::filesystem::u8path(catalogFilePath));
+    if (numberOfGames > fileSize / SgfcPrivateConstants::GameInfoCatalogGameSize ||
+        numberOfStrings > fileSize / SgfcPrivateConstants::GameInfoCatalogMinimumStringSize ||
+        SgfcPrivateConstants::GameInfoCatalogHeaderSize +
+          numberOfGames * SgfcPrivateConstants::GameInfoCatalogGameSize +
+          numberOfStrings * SgfcPrivateConstants::GameInfoCatalogMinimumStringSize > fileSize)
+    {
+      std::stringstream message;
+      message << "Game info catalog file is corrupt, counts exceed file size: " << catalogFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    this->numberOfGames = static_cast<std::size_t>(numberOfGames);
+
+    for (std::uint64_t stringReference = 0; stringReference < numberOfStrings; stringReference++)
+    {
+      std::string string = SgfcBinaryUtility::ReadString(in);
+      this->stringToReferenceMap[string] = static_cast<std::uint32_t>(stringReference);
+      this->strings.push_back(std::move(string));
+    }
+
+    this->filePathColumn = SgfcBinaryUtility::ReadUInt32Vector(in, this->numberOfGames);
+    this->gameIndexColumn = SgfcBinaryUtility::ReadUInt32Vector(in, this->numberOfGames);
+    this->blackPlayerNameColumn = SgfcBinaryUtility::ReadUInt32Vector(in, this->numberOfGames);
+    this->blackPlayerRankColumn = SgfcBinaryUtility::ReadUInt32Vector(in, this->numberOfGames);
+    this->whitePlayerNameColumn = SgfcBinaryUtility::ReadUInt32Vector(in, this->numberOfGames);
+    this->whitePlayerRankColumn = SgfcBinaryUtility::ReadUInt32Vector(in, this->numberOfGames);
+    this->rulesNameColumn = SgfcBinaryUtility::ReadUInt32Vector(in, this->numberOfGames);
+    this->firstGameDateColumn = SgfcBinaryUtility::ReadUInt32Vector(in, this->numberOfGames);
+    this->lastGameDateColumn = SgfcBinaryUtility::ReadUInt32Vector(in, this->numberOfGames);
+    this->gameResultIsValidColumn = SgfcBinaryUtility::ReadUInt8Vector(in, this->numberOfGames);
+    this->gameResultTypeColumn = SgfcBinaryUtility::ReadUInt8Vector(in, this->numberOfGames);
+    this->winTypeColumn = SgfcBinaryUtility::ReadUInt8Vector(in, this->numberOfGames);
+    this->scoreColumn = SgfcBinaryUtility::ReadDoubleVector(in, this->numberOfGames);
+    this->komiColumn = SgfcBinaryUtility::ReadDoubleVector(in, this->numberOfGames);
+
+    const std::vector<std::uint32_t>* stringColumns[] =
+    {
+      &this->filePathColumn,
+      &this->blackPlayerNameColumn,
+      &this->blackPlayerRankColumn,
+      &this->whitePlayerNameColumn,
+      &this->whitePlayerRankColumn,
+      &this->rulesNameColumn,
+    };
+    for (const auto* stringColumn : stringColumns)
+    {
+      for (auto stringReference : *stringColumn)
+      {
+        if (stringReference >= this->strings.size())
+        {
+          std::stringstream message;
+          message << "Game info catalog file is corrupt, column refers to unknown string: " << catalogFilePath;
+          throw std::runtime_error(message.str());
+        }
+      }
+    }
+  }
+
+  SgfcGameInfoCatalog::~SgfcGameInfoCatalog()
+  {
+  }
+
+  std::size_t SgfcGameInfoCatalog::GetNumberOfGames() const
+  {
+    return this->numberOfGames;
+  }
+
+  SgfcGameInfoCatalogEntry SgfcGameInfoCatalog::GetEntry(std::size_t catalogIndex) const
+  {
+    if (catalogIndex >= this->numberOfGames)
+      throw std::invalid_argument("GetEntry failed: Catalog index is out of range");
+
+    SgfcGameInfoCatalogEntry entry;
+    entry.FilePath = this->strings[this->filePathColumn[catalogIndex]];
+    entry.GameIndex = this->gameIndexColumn[catalogIndex];
+    entry.BlackPlayerName = this->strings[this->blackPlayerNameColumn[catalogIndex]];
+    entry.BlackPlayerRank = this->strings[this->blackPlayerRankColumn[catalogIndex]];
+    entry.WhitePlayerName = this->strings[this->whitePlayerNameColumn[catalogIndex]];
+    entry.WhitePlayerRank = this->strings[this->whitePlayerRankColumn[catalogIndex]];
+    entry.RulesName = this->strings[this->rulesNameColumn[catalogIndex]];
+    entry.FirstGameDate = DecodeDate(this->firstGameDateColumn[catalogIndex]);
+    entry.LastGameDate = DecodeDate(this->lastGameDateColumn[catalogIndex]);
+    entry.GameResult.IsValid = (this->gameResultIsValidColumn[catalogIndex] != 0);
+    entry.GameResult.GameResultType = static_cast<SgfcGameResultType>(this->gameResultTypeColumn[catalogIndex]);
+    entry.GameResult.WinType = static_cast<SgfcWinType>(this->winTypeColumn[catalogIndex]);
+    entry.GameResult.Score = this->scoreColumn[catalogIndex];
+    entry.Komi = this->komiColumn[catalogIndex];
+
+    return entry;
+  }
+
+  std::vector<std::size_t> SgfcGameInfoCatalog::FindGames(const SgfcGameInfoCatalogQuery& query) const
+  {
+    // One byte per game instead of std::vector<bool> so that the filter loops
+    // operate on whole bytes and can be vectorized by the compiler
+    std::vector<std::uint8_t> selection(this->numberOfGames, 1);
+
+    // A string that is not in the dictionary cannot match any game
+    if (! query.PlayerName.empty() && ! FilterByPlayerName(query.PlayerName, selection))
+      return std::vector<std::size_t>();
+    if (! query.BlackPlayerName.empty() && ! FilterByString(query.BlackPlayerName, this->blackPlayerNameColumn, selection))
+      return std::vector<std::size_t>();
+    if (! query.WhitePlayerName.empty() && ! FilterByString(query.WhitePlayerName, this->whitePlayerNameColumn, selection))
+      return std::vector<std::size_t>();
+    if (! query.RulesName.empty() && ! FilterByString(query.RulesName, this->rulesNameColumn, selection))
+      return std::vector<std::size_t>();
+
+    if (query.EarliestGameDate.Year != 0 || query.LatestGameDate.Year != 0)
+      FilterByGameDate(query.EarliestGameDate, query.LatestGameDate, selection);
+    if (query.IsGameResultTypeSet)
+      FilterByGameResultType(query.GameResultType, selection);
+    if (query.IsWinTypeSet)
+      FilterByWinType(query.WinType, selection);
+    if (query.IsKomiRangeSet)
+      FilterByKomi(query.MinimumKomi, query.MaximumKomi, selection);
+
+    std::vector<std::size_t> catalogIndexes;
+    for (std::size_t catalogIndex = 0; catalogIndex < this->numberOfGames; catalogIndex++)
+    {
+      if (selection[catalogIndex])
+        catalogIndexes.push_back(catalogIndex);
+    }
+
+    return catalogIndexes;
+  }
+
+  std::uint32_t SgfcGameInfoCatalog::EncodeDate(const SgfcDate& date, bool isLatestPossibleDate)
+  {
+    if (date.Year == 0)
+      return 0;
+
+    SgfcNumber month = date.Month;
+    SgfcNumber day = date.Day;
+    if (isLatestPossibleDate)
+    {
+      if (month == 0)
+        month = 99;
+      if (day == 0)
+        day = 99;
+    }
+
+    return static_cast<std::uint32_t>(date.Year * 10000 + month * 100 + day);
+  }
+
+  SgfcDate SgfcGameInfoCatalog::DecodeDate(std::uint32_t encodedDate)
+  {
+    SgfcDate date;
+    date.Year = encodedDate / 10000;
+    date.Month = (encodedDate / 100) % 100;
+    date.Day = encodedDate % 100;
+
+    if (date.Month == 99)
+      date.Month = 0;
+    if (date.Day == 99)
+      date.Day = 0;
+
+    return date;
+  }
+
+  bool SgfcGameInfoCatalog::FilterByString(
+    const std::string& string,
+    const std::vector<std::uint32_t>& column,
+    std::vector<std::uint8_t>& selection) const
+  {
+    auto it = this->stringToReferenceMap.find(string);
+    if (it == this->stringToReferenceMap.end())
+      return false;
+
+    std::uint32_t stringReference = it->second;
+    for (std::size_t catalogIndex = 0; catalogIndex < this->numberOfGames; catalogIndex++)
+      selection[catalogIndex] &= (column[catalogIndex] == stringReference);
+
+    return true;
+  }
+
+  bool SgfcGameInfoCatalog::FilterByPlayerName(const std::string& playerName, std::vector<std::uint8_t>& selection) const
+  {
+    auto it = this->stringToReferenceMap.find(playerName);
+    if (it == this->stringToReferenceMap.end())
+      return false;
+
+    std::uint32_t stringReference = it->second;
+    for (std::size_t catalogIndex = 0; catalogIndex < this->numberOfGames; catalogIndex++)
+    {
+      selection[catalogIndex] &=
+        (this->blackPlayerNameColumn[catalogIndex] == stringReference) |
+        (this->whitePlayerNameColumn[catalogIndex] == stringReference);
+    }
+
+    return true;
+  }
+
+  void SgfcGameInfoCatalog::FilterByGameDate(const SgfcDate& earliestGameDate, const SgfcDate& latestGameDate, std::vector<std::uint8_t>& selection) const
+  {
+    // A game matches if the span between its first and its last date overlaps
+    // the queried span. A game without dates has encoded dates 0 and never
+    // matches because the lower bound is at least 1.
+    std::uint32_t lowerBound = 1;
+    if (earliestGameDate.Year != 0)
+      lowerBound = EncodeDate(earliestGameDate, false);
+    std::uint32_t upperBound = std::numeric_limits<std::uint32_t>::max();
+    if (latestGameDate.Year != 0)
+      upperBound = EncodeDate(latestGameDate, true);
+
+    for (std::size_t catalogIndex = 0; catalogIndex < this->numberOfGames; catalogIndex++)
+    {
+      selection[catalogIndex] &=
+        (this->lastGameDateColumn[catalogIndex] >= lowerBound) &
+        (this->firstGameDateColumn[catalogIndex] != 0) &
+        (this->firstGameDateColumn[catalogIndex] <= upperBound);
+    }
+  }
+
+  void SgfcGameInfoCatalog::FilterByGameResultType(SgfcGameResultType gameResultType, std::vector<std::uint8_t>& selection) const
+  {
+    std::uint8_t gameResultTypeValue = static_cast<std::uint8_t>(gameResultType);
+
+    for (std::size_t catalogIndex = 0; catalogIndex < this->numberOfGames; catalogIndex++)
+    {
+      selection[catalogIndex] &=
+        (this->gameResultIsValidColumn[catalogIndex] != 0) &
+        (this->gameResultTypeColumn[catalogIndex] == gameResultTypeValue);
+    }
+  }
+
+  void SgfcGameInfoCatalog::FilterByWinType(SgfcWinType winType, std::vector<std::uint8_t>& selection) const
+  {
+    std::uint8_t winTypeValue = static_cast<std::uint8_t>(winType);
+    std::uint8_t blackWinValue = static_cast<std::uint8_t>(SgfcGameResultType::BlackWin);
+    std::uint8_t whiteWinValue = static_cast<std::uint8_t>(SgfcGameResultType::WhiteWin);
+
+    for (std::size_t catalogIndex = 0; catalogIndex < this->numberOfGames; catalogIndex++)
+    {
+      selection[catalogIndex] &=
+        (this->gameResultIsValidColumn[catalogIndex] != 0) &
+        ((this->gameResultTypeColumn[catalogIndex] == blackWinValue) | (this->gameResultTypeColumn[catalogIndex] == whiteWinValue)) &
+        (this->winTypeColumn[catalogIndex] == winTypeValue);
+    }
+  }
+
+  void SgfcGameInfoCatalog::FilterByKomi(SgfcReal minimumKomi, SgfcReal maximumKomi, std::vector<std::uint8_t>& selection) const
+  {
+    for (std::size_t catalogIndex = 0; catalogIndex < this->numberOfGames; catalogIndex++)
+    {
+      selection[catalogIndex] &=
+        (this->komiColumn[catalogIndex] >= minimumKomi) &
+        (this->komiColumn[catalogIndex] <= maximumKomi);
+    }
+  }
+}
@@ -0,0 +1,98 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../include/ISgfcGameInfoCatalog.h"
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcGameInfoCatalog class provides an implementation of the
+  /// ISgfcGameInfoCatalog interface. See the interface header file for
+  /// documentation.
+  ///
+  /// @ingroup internals
+  /// @ingroup game
+  ///
+  /// SgfcGameInfoCatalog reads the entire catalog file into memory when it is
+  /// constructed. See SgfcGameInfoCatalogWriter for the file format. The
+  /// in-memory columns are never modified after construction, so concurrent
+  /// queries need no synchronization.
+  class SgfcGameInfoCatalog : public ISgfcGameInfoCatalog
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcGameInfoCatalog object that
+    /// reads the catalog file located at @a catalogFilePath.
+    ///
+    /// @exception std::runtime_error Is thrown if @a catalogFilePath cannot be
+    /// opened for reading, or if the file is not a catalog file in a format
+    /// supported by the library.
+    SgfcGameInfoCatalog(const std::string& catalogFilePath);
+
+    /// @brief Destroys and cleans up the SgfcGameInfoCatalog object.
+    virtual ~SgfcGameInfoCatalog();
+
+    virtual std::size_t GetNumberOfGames() const override;
+    virtual SgfcGameInfoCatalogEntry GetEntry(std::size_t catalogIndex) const override;
+    virtual std::vector<std::size_t> FindGames(const SgfcGameInfoCatalogQuery& query) const override;
+
+    /// @brief Returns @a date encoded as an integer in the form YYYYMMDD, so
+    /// that encoded dates can be compared numerically. Missing month or day
+    /// parts are encoded as 00 if @a isLatestPossibleDate is false, or as 99
+    /// if @a isLatestPossibleDate is true. Returns 0 if the year part of
+    /// @a date is 0.
+    static std::uint32_t EncodeDate(const SgfcDate& date, bool isLatestPossibleDate);
+    /// @brief Returns the date encoded in @a encodedDate by EncodeDate().
+    static SgfcDate DecodeDate(std::uint32_t encodedDate);
+
+  private:
+    std::size_t numberOfGames;
+    std::vector<std::string> strings;
+    std::unordered_map<std::string, std::uint32_t> stringToReferenceMap;
+
+    std::vector<std::uint32_t> filePathColumn;
+    std::vector<std::uint32_t> gameIndexColumn;
+    std::vector<std::uint32_t> blackPlayerNameColumn;
+    std::vector<std::uint32_t> blackPlayerRankColumn;
+    std::vector<std::uint32_t> whitePlayerNameColumn;
+    std::vector<std::uint32_t> whitePlayerRankColumn;
+    std::vector<std::uint32_t> rulesNameColumn;
+    std::vector<std::uint32_t> firstGameDateColumn;
+    std::vector<std::uint32_t> lastGameDateColumn;
+    std::vector<std::uint8_t> gameResultIsValidColumn;
+    std::vector<std::uint8_t> gameResultTypeColumn;
+    std::vector<std::uint8_t> winTypeColumn;
+    std::vector<double> scoreColumn;
+    std::vector<double> komiColumn;
+
+    bool FilterByString(
+      const std::string& string,
+      const std::vector<std::uint32_t>& column,
+      std::vector<std::uint8_t>& selection) const;
+    bool FilterByPlayerName(const std::string& playerName, std::vector<std::uint8_t>& selection) const;
+    void FilterByGameDate(const SgfcDate& earliestGameDate, const SgfcDate& latestGameDate, std::vector<std::uint8_t>& selection) const;
+    void FilterByGameResultType(SgfcGameResultType gameResultType, std::vector<std::uint8_t>& selection) const;
+    void FilterByWinType(SgfcWinType winType, std::vector<std::uint8_t>& selection) const;
+    void FilterByKomi(SgfcReal minimumKomi, SgfcReal maximumKomi, std::vector<std::uint8_t>& selection) const;
+  };
+}
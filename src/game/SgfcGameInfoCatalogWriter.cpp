@@ -0,0 +1,246 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../include/ISgfcDocument.h"
+#include "../../include/ISgfcDocumentReader.h"
+#include "../../include/ISgfcDocumentReadResult.h"
+#include "../../include/ISgfcGame.h"
+#include "../../include/ISgfcGameInfo.h"
+#include "../../include/ISgfcGoGameInfo.h"
+#include "../../include/SgfcPlusPlusFactory.h"
+#include "../SgfcBinaryUtility.h"
+#include "../SgfcParallelUtility.h"
+#include "../SgfcPrivateConstants.h"
+#include "../SgfcUtility.h"
+#include "SgfcGameInfoCatalog.h"
+#include "SgfcGameInfoCatalogWriter.h"
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcGameInfoCatalogWriter::SgfcGameInfoCatalogWriter()
+    : numberOfThreads(0)
+  {
+  }
+
+  SgfcGameInfoCatalogWriter::~SgfcGameInfoCatalogWriter()
+  {
+  }
+
+  unsigned int SgfcGameInfoCatalogWriter::GetNumberOfThreads() const
+  {
+    return this->numberOfThreads;
+  }
+
+  void SgfcGameInfoCatalogWriter::SetNumberOfThreads(unsigned int numberOfThreads)
+  {
+    this->numberOfThreads = numberOfThreads;
+  }
+
+  std::size_t SgfcGameInfoCatalogWriter::WriteCatalog(const std::string& sgfDirectoryPath, const std::string& catalogFilePath) const
+  {
+    std::vector<std::string> filePaths = SgfcUtility::GetSgfFilePathsInDirectory(sgfDirectoryPath);
+
+    unsigned int numberOfWorkerThreads = SgfcParallelUtility::GetNumberOfWorkerThreads(
+      this->numberOfThreads,
+      filePaths.size());
+
+    std::vector<std::vector<SgfcGameInfoCatalogEntry>> entriesPerFile(filePaths.size());
+    std::vector<std::shared_ptr<ISgfcDocumentReader>> documentReaders(numberOfWorkerThreads);
+
+    SgfcParallelUtility::ForEach(
+      filePaths.size(),
+      numberOfWorkerThreads,
+      [&](std::size_t fileIndex, unsigned int workerThreadIndex)
+      {
+        auto& documentReader = documentReaders[workerThreadIndex];
+        if (documentReader == nullptr)
+          documentReader = SgfcPlusPlusFactory::CreateDocumentReader();
+
+        auto readResult = documentReader->ReadSgfFile(filePaths[fileIndex]);
+        if (readResult->GetExitCode() == SgfcExitCode::FatalError)
+          return;
+
+        auto games = readResult->GetDocument()->GetGames();
+        for (std::size_t gameIndex = 0; gameIndex < games.size(); gameIndex++)
+          entriesPerFile[fileIndex].push_back(CreateEntry(*games[gameIndex], gameIndex));
+      });
+
+    WriteCatalogFile(catalogFilePath, filePaths, entriesPerFile);
+
+    std::size_t numberOfGames = 0;
+    for (const auto& fileEntries : entriesPerFile)
+      numberOfGames += fileEntries.size();
+
+    return numberOfGames;
+  }
+
+  SgfcGameInfoCatalogEntry SgfcGameInfoCatalogWriter::CreateEntry(const ISgfcGame& game, std::size_t gameIndex)
+  {
+    auto gameInfo = game.CreateGameInfo();
+
+    SgfcGameInfoCatalogEntry entry;
+    entry.GameIndex = gameIndex;
+    entry.BlackPlayerName = gameInfo->GetBlackPlayerName();
+    entry.BlackPlayerRank = gameInfo->GetBlackPlayerRank();
+    entry.WhitePlayerName = gameInfo->GetWhitePlayerName();
+    entry.WhitePlayerRank = gameInfo->GetWhitePlayerRank();
+    entry.RulesName = gameInfo->GetRulesName();
+    entry.GameResult = gameInfo->GetGameResult();
+
+    auto goGameInfo = gameInfo->ToGoGameInfo();
+    if (goGameInfo != nullptr)
+      entry.Komi = goGameInfo->GetKomi();
+
+    // Dates are compared in their encoded form because partial dates have no
+    // natural order otherwise
+    bool hasGameDate = false;
+    for (const auto& gameDate : gameInfo->GetGameDates())
+    {
+      if (gameDate.Year == 0)
+        continue;
+
+      if (! hasGameDate)
+      {
+        entry.FirstGameDate = gameDate;
+        entry.LastGameDate = gameDate;
+        hasGameDate = true;
+      }
+      else
+      {
+        if (SgfcGameInfoCatalog::EncodeDate(gameDate, false) < SgfcGameInfoCatalog::EncodeDate(entry.FirstGameDate, false))
+          entry.FirstGameDate = gameDate;
+        if (SgfcGameInfoCatalog::EncodeDate(gameDate, true) > SgfcGameInfoCatalog::EncodeDate(entry.LastGameDate, true))
+          entry.LastGameDate = gameDate;
+      }
+    }
+
+    return entry;
+  }
+
+  void SgfcGameInfoCatalogWriter::WriteCatalogFile(
+    const std::string& catalogFilePath,
+    const std::vector<std::string>& filePaths,
+    const std::vector<std::vector<SgfcGameInfoCatalogEntry>>& entriesPerFile)
+  {
+    if (filePaths.size() != entriesPerFile.size())
+      throw std::invalid_argument("WriteCatalogFile failed: Number of file paths does not match number of entry collections");
+
+    // Build the string dictionary. Reference 0 is always the empty string.
+    std::vector<const std::string*> strings;
+    std::unordered_map<std::string, std::uint32_t> stringToReferenceMap;
+    auto getStringReference = [&](const std::string& string) -> std::uint32_t
+    {
+      auto it = stringToReferenceMap.find(string);
+      if (it != stringToReferenceMap.end())
+        return it->second;
+
+      std::uint32_t stringReference = static_cast<std::uint32_t>(strings.size());
+      auto insertResult = stringToReferenceMap.insert(std::make_pair(string, stringReference));
+      strings.push_back(&insertResult.first->first);
+      return stringReference;
+    };
+    getStringReference(std::string());
+
+    std::vector<std::uint32_t> filePathReferences;
+    for (const auto& filePath : filePaths)
+      filePathReferences.push_back(getStringReference(filePath));
+
+    std::vector<const SgfcGameInfoCatalogEntry*> entries;
+    std::vector<std::uint32_t> filePathColumn;
+    for (std::size_t fileIndex = 0; fileIndex < entriesPerFile.size(); fileIndex++)
+    {
+      for (const auto& entry : entriesPerFile[fileIndex])
+      {
+        entries.push_back(&entry);
+        filePathColumn.push_back(filePathReferences[fileIndex]);
+      }
+    }
+
+    std::vector<std::uint32_t> blackPlayerNameColumn;
+    std::vector<std::uint32_t> blackPlayerRankColumn;
+    std::vector<std::uint32_t> whitePlayerNameColumn;
+    std::vector<std::uint32_t> whitePlayerRankColumn;
+    std::vector<std::uint32_t> rulesNameColumn;
+    for (const auto* entry : entries)
+    {
+      blackPlayerNameColumn.push_back(getStringReference(entry->BlackPlayerName));
+      blackPlayerRankColumn.push_back(getStringReference(entry->BlackPlayerRank));
+      whitePlayerNameColumn.push_back(getStringReference(entry->WhitePlayerName));
+      whitePlayerRankColumn.push_back(getStringReference(entry->WhitePlayerRank));
+      rulesNameColumn.push_back(getStringReference(entry->RulesName));
+    }
+
+    std::ofstream out(std::filesystem::u8path(catalogFilePath), std::ios::binary | std::ios::trunc);
+    if (! out.is_open())
+    {
+      std::stringstream message;
+      message << "Failed to open file for writing: " << catalogFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    out.write(SgfcPrivateConstants::GameInfoCatalogMagic.data(), SgfcPrivateConstants::GameInfoCatalogMagic.size());
+    SgfcBinaryUtility::WriteUInt32(out, SgfcPrivateConstants::GameInfoCatalogFormatVersion);
+    SgfcBinaryUtility::WriteUInt32(out, 0);
+    SgfcBinaryUtility::WriteUInt64(out, entries.size());
+    SgfcBinaryUtility::WriteUInt64(out, strings.size());
+
+    for (const auto* string : strings)
+      SgfcBinaryUtility::WriteString(out, *string);
+
+    auto writeUInt32Column = [&](const std::vector<std::uint32_t>& column)
+    {
+      for (auto value : column)
+        SgfcBinaryUtility::WriteUInt32(out, value);
+    };
+    auto writeEntryColumn = [&](const std::function<void(const SgfcGameInfoCatalogEntry&)>& writeValue)
+    {
+      for (const auto* entry : entries)
+        writeValue(*entry);
+    };
+
+    writeUInt32Column(filePathColumn);
+    writeEntryColumn([&](const SgfcGameInfoCatalogEntry& entry) { SgfcBinaryUtility::WriteUInt32(out, static_cast<std::uint32_t>(entry.GameIndex)); });
+    writeUInt32Column(blackPlayerNameColumn);
+    writeUInt32Column(blackPlayerRankColumn);
+    writeUInt32Column(whitePlayerNameColumn);
+    writeUInt32Column(whitePlayerRankColumn);
+    writeUInt32Column(rulesNameColumn);
+    writeEntryColumn([&](const SgfcGameInfoCatalogEntry& entry) { SgfcBinaryUtility::WriteUInt32(out, SgfcGameInfoCatalog::EncodeDate(entry.FirstGameDate, false)); });
+    writeEntryColumn([&](const SgfcGameInfoCatalogEntry& entry) { SgfcBinaryUtility::WriteUInt32(out, SgfcGameInfoCatalog::EncodeDate(entry.LastGameDate, true)); });
+    writeEntryColumn([&](const SgfcGameInfoCatalogEntry& entry) { SgfcBinaryUtility::WriteUInt8(out, entry.GameResult.IsValid ? 1 : 0); });
+    writeEntryColumn([&](const SgfcGameInfoCatalogEntry& entry) { SgfcBinaryUtility::WriteUInt8(out, static_cast<std::uint8_t>(entry.GameResult.GameResultType)); });
+    writeEntryColumn([&](const SgfcGameInfoCatalogEntry& entry) { SgfcBinaryUtility::WriteUInt8(out, static_cast<std::uint8_t>(entry.GameResult.WinType)); });
+    writeEntryColumn([&](const SgfcGameInfoCatalogEntry& entry) { SgfcBinaryUtility::WriteDouble(out, entry.GameResult.Score); });
+    writeEntryColumn([&](const SgfcGameInfoCatalogEntry& entry) { SgfcBinaryUtility::WriteDouble(out, entry.Komi); });
+
+    if (! out.good())
+    {
+      std::stringstream message;
+      message << "Failed to write file: " << catalogFilePath;
+      throw std::runtime_error(message.str());
+    }
+  }
+}
@@ -0,0 +1,88 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../include/ISgfcGameInfoCatalogWriter.h"
+#include "../../include/SgfcGameInfoCatalogEntry.h"
+
+// C++ Standard Library includes
+#include <string>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcGame;
+
+  /// @brief The SgfcGameInfoCatalogWriter class provides an implementation of
+  /// the ISgfcGameInfoCatalogWriter interface. See the interface header file
+  /// for documentation.
+  ///
+  /// @ingroup internals
+  /// @ingroup game
+  ///
+  /// The catalog file has the following layout. All integers are stored in
+  /// little-endian byte order (see SgfcBinaryUtility).
+  /// - Header: Magic bytes (8 bytes), format version (32 bits), flags
+  ///   (32 bits, currently unused), number of games (64 bits), number of
+  ///   strings in the string dictionary (64 bits).
+  /// - String dictionary: The distinct strings of all string columns. The
+  ///   first string is always the empty string.
+  /// - Columns: Each column stores one value per game, in catalog order. The
+  ///   columns are, in this order: File path, game index, Black player name,
+  ///   Black player rank, White player name, White player rank, rules name
+  ///   (all 32 bits; string columns store references into the string
+  ///   dictionary), first game date, last game date (32 bits each, encoded by
+  ///   SgfcGameInfoCatalog::EncodeDate()), game result validity, game result
+  ///   type, win type (8 bits each), score, komi (64-bit doubles each).
+  class SgfcGameInfoCatalogWriter : public ISgfcGameInfoCatalogWriter
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcGameInfoCatalogWriter
+    /// object.
+    SgfcGameInfoCatalogWriter();
+
+    /// @brief Destroys and cleans up the SgfcGameInfoCatalogWriter object.
+    virtual ~SgfcGameInfoCatalogWriter();
+
+    virtual unsigned int GetNumberOfThreads() const override;
+    virtual void SetNumberOfThreads(unsigned int numberOfThreads) override;
+    virtual std::size_t WriteCatalog(const std::string& sgfDirectoryPath, const std::string& catalogFilePath) const override;
+
+    /// @brief Returns a catalog entry with the game information of @a game,
+    /// which has the index @a gameIndex in its SGF file. The file path of the
+    /// entry is left empty.
+    static SgfcGameInfoCatalogEntry CreateEntry(const ISgfcGame& game, std::size_t gameIndex);
+
+    /// @brief Writes a catalog file to @a catalogFilePath. @a entriesPerFile
+    /// contains the entries of the games in the file at the same index in
+    /// @a filePaths. The file paths stored in the entries are ignored.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a filePaths and
+    /// @a entriesPerFile have different sizes.
+    /// @exception std::runtime_error Is thrown if @a catalogFilePath cannot be
+    /// opened for writing, or if writing to the file fails.
+    static void WriteCatalogFile(
+      const std::string& catalogFilePath,
+      const std::vector<std::string>& filePaths,
+      const std::vector<std::vector<SgfcGameInfoCatalogEntry>>& entriesPerFile);
+
+  private:
+    unsigned int numberOfThreads;
+  };
+}
@@ -0,0 +1,267 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "SgfcGoBitboard.h"
+
+// C++ Standard Library includes
+#include <bitset>
+#include <stdexcept>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcGoBitboard::SgfcGoBitboard(unsigned int numberOfRows)
+    : numberOfRows(numberOfRows)
+  {
+    if (numberOfRows > MaximumDimension)
+      throw std::invalid_argument("SgfcGoBitboard constructor failed: Number of rows exceeds maximum");
+
+    this->rows.fill(0);
+  }
+
+  SgfcGoBitboard::~SgfcGoBitboard()
+  {
+  }
+
+  SgfcGoBitboard SgfcGoBitboard::CreateBoardMask(SgfcBoardSize boardSize)
+  {
+    if (boardSize.Columns < 0 || boardSize.Rows < 0 ||
+        boardSize.Columns > static_cast<SgfcNumber>(MaximumDimension) ||
+        boardSize.Rows > static_cast<SgfcNumber>(MaximumDimension))
+    {
+      throw std::invalid_argument("CreateBoardMask failed: Board size exceeds maximum");
+    }
+
+    SgfcGoBitboard boardMask(static_cast<unsigned int>(boardSize.Rows));
+
+    std::uint64_t rowMask = (static_cast<std::uint64_t>(1) << boardSize.Columns) - 1;
+    for (unsigned int row = 0; row < boardMask.numberOfRows; row++)
+      boardMask.rows[row] = rowMask;
+
+    return boardMask;
+  }
+
+  bool SgfcGoBitboard::Test(unsigned int column, unsigned int row) const
+  {
+    return (this->rows[row] >> column) & 1;
+  }
+
+  void SgfcGoBitboard::Set(unsigned int column, unsigned int row)
+  {
+    this->rows[row] |= (static_cast<std::uint64_t>(1) << column);
+  }
+
+  void SgfcGoBitboard::Clear(unsigned int column, unsigned int row)
+  {
+    this->rows[row] &= ~(static_cast<std::uint64_t>(1) << column);
+  }
+
+  void SgfcGoBitboard::ClearAll()
+  {
+    for (unsigned int row = 0; row < this->numberOfRows; row++)
+      this->rows[row] = 0;
+  }
+
+  bool SgfcGoBitboard::IsEmpty() const
+  {
+    for (unsigned int row = 0; row < this->numberOfRows; row++)
+    {
+      if (this->rows[row] != 0)
+        return false;
+    }
+
+    return true;
+  }
+
+  unsigned int SgfcGoBitboard::Count() const
+  {
+    unsigned int count = 0;
+
+    for (unsigned int row = 0; row < this->numberOfRows; row++)
+      count += static_cast<unsigned int>(std::bitset<64>(this->rows[row]).count());
+
+    return count;
+  }
+
+  SgfcGoBitboard SgfcGoBitboard::GetNeighbors(const SgfcGoBitboard& boardMask) const
+  {
+    SgfcGoBitboard neighbors(this->numberOfRows);
+
+    for (unsigned int row = 0; row < this->numberOfRows; row++)
+    {
+      std::uint64_t rowBits = this->rows[row];
+      std::uint64_t neighborBits = (rowBits << 1) | (rowBits >> 1);
+
+      if (row > 0)
+        neighborBits |= this->rows[row - 1];
+      if (row + 1 < this->numberOfRows)
+        neighborBits |= this->rows[row + 1];
+
+      neighbors.rows[row] = neighborBits & boardMask.rows[row] & ~rowBits;
+    }
+
+    return neighbors;
+  }
+
+  SgfcGoBitboard SgfcGoBitboard::GetGroup(unsigned int column, unsigned int row) const
+  {
+    SgfcGoBitboard group(this->numberOfRows);
+    if (! Test(column, row))
+      return group;
+
+    group.Set(column, row);
+
+    // Grow the group one step in all directions at a time, but only onto
+    // intersections that are set in this bitboard, until it stops growing.
+    // The rows that can change are tracked to avoid scanning the entire
+    // board in every step.
+    unsigned int firstRow = row;
+    unsigned int lastRow = row;
+
+    bool groupDidGrow = true;
+    while (groupDidGrow)
+    {
+      groupDidGrow = false;
+
+      unsigned int scanFirstRow = (firstRow > 0) ? firstRow - 1 : 0;
+      unsigned int scanLastRow = (lastRow + 1 < this->numberOfRows) ? lastRow + 1 : lastRow;
+
+      for (unsigned int scanRow = scanFirstRow; scanRow <= scanLastRow; scanRow++)
+      {
+        std::uint64_t rowBits = group.rows[scanRow];
+        std::uint64_t grownBits = rowBits | (rowBits << 1) | (rowBits >> 1);
+
+        if (scanRow > 0)
+          grownBits |= group.rows[scanRow - 1];
+        if (scanRow + 1 < this->numberOfRows)
+          grownBits |= group.rows[scanRow + 1];
+
+        grownBits &= this->rows[scanRow];
+
+        // Spread horizontally within the row until the row is saturated. This
+        // considerably reduces the number of outer iterations for groups that
+        // consist of long horizontal chains.
+        std::uint64_t previousBits = 0;
+        while (grownBits != previousBits)
+        {
+          previousBits = grownBits;
+          grownBits = (grownBits | (grownBits << 1) | (grownBits >> 1)) & this->rows[scanRow];
+        }
+
+        if (grownBits != rowBits)
+        {
+          group.rows[scanRow] = grownBits;
+          groupDidGrow = true;
+
+          if (scanRow < firstRow)
+            firstRow = scanRow;
+          if (scanRow > lastRow)
+            lastRow = scanRow;
+        }
+      }
+    }
+
+    return group;
+  }
+
+  bool SgfcGoBitboard::Intersects(const SgfcGoBitboard& other) const
+  {
+    for (unsigned int row = 0; row < this->numberOfRows; row++)
+    {
+      if ((this->rows[row] & other.rows[row]) != 0)
+        return true;
+    }
+
+    return false;
+  }
+
+  bool SgfcGoBitboard::GetFirst(unsigned int& column, unsigned int& row) const
+  {
+    for (unsigned int rowIndex = 0; rowIndex < this->numberOfRows; rowIndex++)
+    {
+      std::uint64_t rowBits = this->rows[rowIndex];
+      if (rowBits == 0)
+        continue;
+
+      unsigned int columnIndex = 0;
+      while (((rowBits >> columnIndex) & 1) == 0)
+        columnIndex++;
+
+      column = columnIndex;
+      row = rowIndex;
+      return true;
+    }
+
+    return false;
+  }
+
+  SgfcGoBitboard SgfcGoBitboard::operator&(const SgfcGoBitboard& other) const
+  {
+    SgfcGoBitboard result(*this);
+    result &= other;
+    return result;
+  }
+
+  SgfcGoBitboard SgfcGoBitboard::operator|(const SgfcGoBitboard& other) const
+  {
+    SgfcGoBitboard result(*this);
+    result |= other;
+    return result;
+  }
+
+  SgfcGoBitboard& SgfcGoBitboard::operator&=(const SgfcGoBitboard& other)
+  {
+    for (unsigned int row = 0; row < this->numberOfRows; row++)
+      this->rows[row] &= other.rows[row];
+
+    return *this;
+  }
+
+  SgfcGoBitboard& SgfcGoBitboard::operator|=(const SgfcGoBitboard& other)
+  {
+    for (unsigned int row = 0; row < this->numberOfRows; row++)
+      this->rows[row] |= other.rows[row];
+
+    return *this;
+  }
+
+  SgfcGoBitboard& SgfcGoBitboard::operator-=(const SgfcGoBitboard& other)
+  {
+    for (unsigned int row = 0; row < this->numberOfRows; row++)
+      this->rows[row] &= ~other.rows[row];
+
+    return *this;
+  }
+
+  bool SgfcGoBitboard::operator==(const SgfcGoBitboard& other) const
+  {
+    if (this->numberOfRows != other.numberOfRows)
+      return false;
+
+    for (unsigned int row = 0; row < this->numberOfRows; row++)
+    {
+      if (this->rows[row] != other.rows[row])
+        return false;
+    }
+
+    return true;
+  }
+
+  bool SgfcGoBitboard::operator!=(const SgfcGoBitboard& other) const
+  {
+    return ! (*this == other);
+  }
+}
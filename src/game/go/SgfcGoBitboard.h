@@ -0,0 +1,115 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../../include/SgfcBoardSize.h"
+
+// C++ Standard Library includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcGoBitboard class represents a set of intersections on a
+  /// Go board, with one bit per intersection.
+  ///
+  /// @ingroup internals
+  /// @ingroup go
+  ///
+  /// Each board row is stored in a 64-bit word. Bit n of a word represents
+  /// the intersection in column n (0-based) of the row. The SGF standard
+  /// limits Go boards to 52x52, so a row always fits into one word.
+  ///
+  /// Only the first @e numberOfRows words are used, which keeps operations
+  /// fast on small boards. Bits that are outside of the board must never be
+  /// set. Operations that can produce such bits (e.g. GetNeighbors()) accept
+  /// a board mask to cut off those bits.
+  ///
+  /// Columns and rows are 0-based.
+  class SgfcGoBitboard
+  {
+  public:
+    /// @brief The maximum number of columns and rows that a bitboard can
+    /// represent.
+    static constexpr std::size_t MaximumDimension = 52;
+
+    /// @brief Initializes a newly constructed SgfcGoBitboard object with
+    /// @a numberOfRows rows. No bits are set.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a numberOfRows is
+    /// greater than MaximumDimension.
+    SgfcGoBitboard(unsigned int numberOfRows);
+
+    /// @brief Destroys and cleans up the SgfcGoBitboard object.
+    ~SgfcGoBitboard();
+
+    /// @brief Returns a newly constructed SgfcGoBitboard object in which the
+    /// bits for all intersections on a board of size @a boardSize are set.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a boardSize has more
+    /// than MaximumDimension columns or rows.
+    static SgfcGoBitboard CreateBoardMask(SgfcBoardSize boardSize);
+
+    /// @brief Returns true if the bit for the intersection at @a column and
+    /// @a row is set.
+    bool Test(unsigned int column, unsigned int row) const;
+    /// @brief Sets the bit for the intersection at @a column and @a row.
+    void Set(unsigned int column, unsigned int row);
+    /// @brief Clears the bit for the intersection at @a column and @a row.
+    void Clear(unsigned int column, unsigned int row);
+    /// @brief Clears all bits.
+    void ClearAll();
+
+    /// @brief Returns true if no bits are set.
+    bool IsEmpty() const;
+    /// @brief Returns the number of bits that are set.
+    unsigned int Count() const;
+
+    /// @brief Returns the intersections that are orthogonally adjacent to the
+    /// intersections in this bitboard, excluding the intersections in this
+    /// bitboard, and restricted to the intersections in @a boardMask.
+    SgfcGoBitboard GetNeighbors(const SgfcGoBitboard& boardMask) const;
+
+    /// @brief Returns the group of connected intersections in this bitboard
+    /// that contains the intersection at @a column and @a row. Returns an empty
+    /// bitboard if the bit for the intersection is not set.
+    SgfcGoBitboard GetGroup(unsigned int column, unsigned int row) const;
+
+    /// @brief Returns true if this bitboard and @a other have at least one
+    /// bit in common.
+    bool Intersects(const SgfcGoBitboard& other) const;
+
+    /// @brief Returns the first set bit in row-major order in @a column and
+    /// @a row. Returns false if no bit is set.
+    bool GetFirst(unsigned int& column, unsigned int& row) const;
+
+    SgfcGoBitboard operator&(const SgfcGoBitboard& other) const;
+    SgfcGoBitboard operator|(const SgfcGoBitboard& other) const;
+    SgfcGoBitboard& operator&=(const SgfcGoBitboard& other);
+    SgfcGoBitboard& operator|=(const SgfcGoBitboard& other);
+    /// @brief Clears all bits that are set in @a other.
+    SgfcGoBitboard& operator-=(const SgfcGoBitboard& other);
+    bool operator==(const SgfcGoBitboard& other) const;
+    bool operator!=(const SgfcGoBitboard& other) const;
+
+  private:
+    unsigned int numberOfRows;
+    std::array<std::uint64_t, MaximumDimension> rows;
+  };
+}
@@ -0,0 +1,572 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../../include/ISgfcDocument.h"
+#include "../../../include/ISgfcGame.h"
+#include "../../../include/ISgfcGameInfo.h"
+#include "../../../include/ISgfcGoMovePropertyValue.h"
+#include "../../../include/ISgfcNode.h"
+#include "../../../include/ISgfcNumberPropertyValue.h"
+#include "../../../include/ISgfcPropertyFactory.h"
+#include "../../../include/ISgfcPropertyValueFactory.h"
+#include "../../../include/ISgfcTextPropertyValue.h"
+#include "../../../include/ISgfcTreeBuilder.h"
+#include "../../../include/SgfcPlusPlusFactory.h"
+#include "../../SgfcParallelUtility.h"
+#include "../../SgfcPrivateConstants.h"
+#include "SgfcGoOpeningTreeBuilder.h"
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <iomanip>
+#include <locale>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcGoOpeningTreeBuilder::SgfcGoOpeningTreeBuilder(SgfcBoardSize boardSize)
+    : boardSize(boardSize)
+    , maximumNumberOfMoves(0)
+    , useCanonicalSymmetry(false)
+    , minimumNumberOfGames(1)
+    , numberOfThreads(0)
+    , numberOfGames(0)
+    , lowerTries(SgfcPrivateConstants::GoOpeningTreeNumberOfShards)
+  {
+    if (! boardSize.IsValid(SgfcGameType::Go))
+      throw std::invalid_argument("SgfcGoOpeningTreeBuilder constructor failed: Board size is not valid for Go");
+
+    // The root node
+    this->upperTrie.Nodes.push_back(TrieNode());
+  }
+
+  SgfcGoOpeningTreeBuilder::~SgfcGoOpeningTreeBuilder()
+  {
+  }
+
+  SgfcBoardSize SgfcGoOpeningTreeBuilder::GetBoardSize() const
+  {
+    return this->boardSize;
+  }
+
+  std::size_t SgfcGoOpeningTreeBuilder::GetMaximumNumberOfMoves() const
+  {
+    return this->maximumNumberOfMoves;
+  }
+
+  void SgfcGoOpeningTreeBuilder::SetMaximumNumberOfMoves(std::size_t maximumNumberOfMoves)
+  {
+    if (this->numberOfGames > 0)
+      throw std::logic_error("SetMaximumNumberOfMoves failed: Games were already added");
+
+    this->maximumNumberOfMoves = maximumNumberOfMoves;
+  }
+
+  bool SgfcGoOpeningTreeBuilder::GetUseCanonicalSymmetry() const
+  {
+    return this->useCanonicalSymmetry;
+  }
+
+  void SgfcGoOpeningTreeBuilder::SetUseCanonicalSymmetry(bool useCanonicalSymmetry)
+  {
+    if (this->numberOfGames > 0)
+      throw std::logic_error("SetUseCanonicalSymmetry failed: Games were already added");
+
+    this->useCanonicalSymmetry = useCanonicalSymmetry;
+  }
+
+  std::size_t SgfcGoOpeningTreeBuilder::GetMinimumNumberOfGames() const
+  {
+    return this->minimumNumberOfGames;
+  }
+
+  void SgfcGoOpeningTreeBuilder::SetMinimumNumberOfGames(std::size_t minimumNumberOfGames)
+  {
+    this->minimumNumberOfGames = minimumNumberOfGames;
+  }
+
+  unsigned int SgfcGoOpeningTreeBuilder::GetNumberOfThreads() const
+  {
+    return this->numberOfThreads;
+  }
+
+  void SgfcGoOpeningTreeBuilder::SetNumberOfThreads(unsigned int numberOfThreads)
+  {
+    this->numberOfThreads = numberOfThreads;
+  }
+
+  bool SgfcGoOpeningTreeBuilder::AddGame(std::shared_ptr<ISgfcGame> game)
+  {
+    if (game == nullptr)
+      throw std::invalid_argument("AddGame failed: Game is nullptr");
+
+    return AddGames({ game }) == 1;
+  }
+
+  std::size_t SgfcGoOpeningTreeBuilder::AddGames(const std::vector<std::shared_ptr<ISgfcGame>>& games)
+  {
+    for (const auto& game : games)
+    {
+      if (game == nullptr)
+        throw std::invalid_argument("AddGames failed: Games collection contains nullptr element");
+    }
+
+    // Step 1: Extract the moves and the result of each game. This is done
+    // in parallel because it requires walking the game tree.
+    std::vector<GameMoves> gameMovesCollection(games.size());
+
+    SgfcParallelUtility::ForEach(
+      games.size(),
+      SgfcParallelUtility::GetNumberOfWorkerThreads(this->numberOfThreads, games.size()),
+      [&](std::size_t gameIndex, unsigned int /*workerThreadIndex*/)
+      {
+        GetGameMoves(*games[gameIndex], gameMovesCollection[gameIndex]);
+      });
+
+    // Step 2: Merge the moves up to the sharding depth into the upper trie,
+    // in the order of the games. Also distribute the games over the lower
+    // tries for step 3.
+    std::size_t numberOfGamesAdded = 0;
+    std::vector<std::vector<std::size_t>> gameIndexesPerLowerTrie(this->lowerTries.size());
+
+    for (std::size_t gameIndex = 0; gameIndex < gameMovesCollection.size(); gameIndex++)
+    {
+      GameMoves& gameMoves = gameMovesCollection[gameIndex];
+      if (! gameMoves.IsMergeable)
+        continue;
+
+      std::uint32_t nodeIndex = 0;
+      AddGameResult(this->upperTrie.Nodes[nodeIndex].Statistics, gameMoves.GameResult);
+
+      std::size_t numberOfUpperMoves = std::min(gameMoves.MoveKeys.size(), SgfcPrivateConstants::GoOpeningTreeShardingDepth);
+      for (std::size_t moveIndex = 0; moveIndex < numberOfUpperMoves; moveIndex++)
+      {
+        nodeIndex = GetOrAddChildNode(this->upperTrie, this->upperTrie.Nodes, nodeIndex, gameMoves.MoveKeys[moveIndex]);
+        AddGameResult(this->upperTrie.Nodes[nodeIndex].Statistics, gameMoves.GameResult);
+      }
+
+      if (gameMoves.MoveKeys.size() > numberOfUpperMoves)
+      {
+        gameMoves.UpperNodeIndex = nodeIndex;
+        gameIndexesPerLowerTrie[nodeIndex % this->lowerTries.size()].push_back(gameIndex);
+      }
+
+      numberOfGamesAdded++;
+    }
+
+    // Step 3: Merge the remaining moves into the lower tries. Each lower trie
+    // is merged by only one thread, which also is the only thread that links
+    // the upper trie nodes assigned to the lower trie with their child nodes.
+    SgfcParallelUtility::ForEach(
+      this->lowerTries.size(),
+      SgfcParallelUtility::GetNumberOfWorkerThreads(this->numberOfThreads, this->lowerTries.size()),
+      [&](std::size_t lowerTrieIndex, unsigned int /*workerThreadIndex*/)
+      {
+        Trie& lowerTrie = this->lowerTries[lowerTrieIndex];
+
+        for (std::size_t gameIndex : gameIndexesPerLowerTrie[lowerTrieIndex])
+        {
+          const GameMoves& gameMoves = gameMovesCollection[gameIndex];
+
+          std::vector<TrieNode>* parentNodes = &this->upperTrie.Nodes;
+          std::uint32_t nodeIndex = gameMoves.UpperNodeIndex;
+
+          for (std::size_t moveIndex = SgfcPrivateConstants::GoOpeningTreeShardingDepth; moveIndex < gameMoves.MoveKeys.size(); moveIndex++)
+          {
+            nodeIndex = GetOrAddChildNode(lowerTrie, *parentNodes, nodeIndex, gameMoves.MoveKeys[moveIndex]);
+            AddGameResult(lowerTrie.Nodes[nodeIndex].Statistics, gameMoves.GameResult);
+            parentNodes = &lowerTrie.Nodes;
+          }
+        }
+      });
+
+    this->numberOfGames += numberOfGamesAdded;
+
+    return numberOfGamesAdded;
+  }
+
+  std::size_t SgfcGoOpeningTreeBuilder::GetNumberOfGames() const
+  {
+    return this->numberOfGames;
+  }
+
+  std::size_t SgfcGoOpeningTreeBuilder::GetNumberOfNodes() const
+  {
+    // Don't count the root node
+    std::size_t numberOfNodes = this->upperTrie.Nodes.size() - 1;
+
+    for (const auto& lowerTrie : this->lowerTries)
+      numberOfNodes += lowerTrie.Nodes.size();
+
+    return numberOfNodes;
+  }
+
+  std::shared_ptr<ISgfcDocument> SgfcGoOpeningTreeBuilder::CreateDocument() const
+  {
+    auto propertyFactory = SgfcPlusPlusFactory::CreatePropertyFactory();
+    auto propertyValueFactory = SgfcPlusPlusFactory::CreatePropertyValueFactory();
+
+    auto rootNode = SgfcPlusPlusFactory::CreateNode();
+    rootNode->SetProperties(
+    {
+      propertyFactory->CreateProperty(
+        SgfcPropertyType::GM,
+        propertyValueFactory->CreateGameTypePropertyValue(SgfcGameType::Go)),
+      propertyFactory->CreateProperty(
+        SgfcPropertyType::SZ,
+        propertyValueFactory->CreateBoardSizePropertyValue(this->boardSize, SgfcGameType::Go)),
+      propertyFactory->CreateProperty(
+        SgfcPropertyType::C,
+        propertyValueFactory->CreateTextPropertyValue(GetStatisticsText(this->upperTrie.Nodes[0].Statistics))),
+    });
+
+    auto game = SgfcPlusPlusFactory::CreateGame(rootNode);
+    auto treeBuilder = game->GetTreeBuilder();
+
+    // A trie node together with the depth at which it is located in the
+    // opening tree, and the document node that was created for it
+    struct ExportStep
+    {
+      const Trie* NodeTrie;
+      std::uint32_t NodeIndex;
+      std::size_t Depth;
+      std::shared_ptr<ISgfcNode> Node;
+    };
+
+    std::size_t minimumNumberOfGames = std::max(this->minimumNumberOfGames, static_cast<std::size_t>(1));
+
+    // Use an explicit stack instead of recursion. Opening trees can be very
+    // deep if the number of moves is not limited.
+    std::vector<ExportStep> exportSteps;
+    exportSteps.push_back({ &this->upperTrie, 0, 0, rootNode });
+
+    while (! exportSteps.empty())
+    {
+      ExportStep exportStep = exportSteps.back();
+      exportSteps.pop_back();
+
+      const Trie& childTrie = GetChildTrie(*exportStep.NodeTrie, exportStep.NodeIndex, exportStep.Depth);
+
+      std::vector<std::uint32_t> childNodeIndexes;
+      for (std::uint32_t childNodeIndex = exportStep.NodeTrie->Nodes[exportStep.NodeIndex].FirstChildIndex;
+           childNodeIndex != NoNodeIndex;
+           childNodeIndex = childTrie.Nodes[childNodeIndex].NextSiblingIndex)
+      {
+        if (childTrie.Nodes[childNodeIndex].Statistics.NumberOfGames >= minimumNumberOfGames)
+          childNodeIndexes.push_back(childNodeIndex);
+      }
+
+      // The most popular move first, so that it becomes the main variation.
+      // Ties are broken by move so that the result does not depend on the
+      // order in which the games were added.
+      std::sort(
+        childNodeIndexes.begin(),
+        childNodeIndexes.end(),
+        [&childTrie](std::uint32_t childNodeIndex1, std::uint32_t childNodeIndex2)
+        {
+          const TrieNode& childNode1 = childTrie.Nodes[childNodeIndex1];
+          const TrieNode& childNode2 = childTrie.Nodes[childNodeIndex2];
+          if (childNode1.Statistics.NumberOfGames != childNode2.Statistics.NumberOfGames)
+            return childNode1.Statistics.NumberOfGames > childNode2.Statistics.NumberOfGames;
+          else
+            return childNode1.MoveKey < childNode2.MoveKey;
+        });
+
+      std::size_t firstExportStepIndex = exportSteps.size();
+
+      for (std::uint32_t childNodeIndex : childNodeIndexes)
+      {
+        const TrieNode& trieNode = childTrie.Nodes[childNodeIndex];
+
+        SgfcColor color = (trieNode.MoveKey & 0x10000) ? SgfcColor::White : SgfcColor::Black;
+        unsigned int xPosition = (trieNode.MoveKey >> 8) & 0xff;
+        unsigned int yPosition = trieNode.MoveKey & 0xff;
+
+        std::shared_ptr<ISgfcGoMovePropertyValue> goMoveValue;
+        if ((trieNode.MoveKey & 0xffff) == 0xffff)
+        {
+          goMoveValue = propertyValueFactory->CreateGoMovePropertyValue(color);
+        }
+        else
+        {
+          std::string sgfNotation;
+          sgfNotation.push_back(GetSgfCharacter(xPosition));
+          sgfNotation.push_back(GetSgfCharacter(yPosition));
+          goMoveValue = propertyValueFactory->CreateGoMovePropertyValue(sgfNotation, this->boardSize, color);
+        }
+
+        auto node = SgfcPlusPlusFactory::CreateNode();
+        node->SetProperties(
+        {
+          propertyFactory->CreateProperty(
+            color == SgfcColor::Black ? SgfcPropertyType::B : SgfcPropertyType::W,
+            goMoveValue),
+          propertyFactory->CreateProperty(
+            SgfcPropertyType::C,
+            propertyValueFactory->CreateTextPropertyValue(GetStatisticsText(trieNode.Statistics))),
+        });
+
+        treeBuilder->AppendChild(exportStep.Node, node);
+
+        exportSteps.push_back({ &childTrie, childNodeIndex, exportStep.Depth + 1, node });
+      }
+
+      // Visit the child nodes in their natural order
+      std::reverse(exportSteps.begin() + firstExportStepIndex, exportSteps.end());
+    }
+
+    return SgfcPlusPlusFactory::CreateDocument(game);
+  }
+
+  /// @brief Fills @a gameMoves with the data of @a game that is needed to
+  /// merge the game. Sets @e IsMergeable to false if the game must be
+  /// skipped.
+  void SgfcGoOpeningTreeBuilder::GetGameMoves(const ISgfcGame& game, GameMoves& gameMoves) const
+  {
+    gameMoves.IsMergeable = false;
+
+    if (! game.HasRootNode() || game.GetGameType() != SgfcGameType::Go)
+      return;
+    if (game.GetBoardSize() != this->boardSize)
+      return;
+
+    auto rootNode = game.GetRootNode();
+    if (rootNode->HasProperty(SgfcPropertyType::AB) ||
+        rootNode->HasProperty(SgfcPropertyType::AW) ||
+        rootNode->HasProperty(SgfcPropertyType::AE))
+    {
+      return;
+    }
+
+    // The first invocation only determines the number of moves
+    SgfcGoMoveBuffers moveBuffers;
+    std::size_t numberOfMoves = game.GetMainVariationGoMoves(moveBuffers);
+    if (this->maximumNumberOfMoves > 0)
+      numberOfMoves = std::min(numberOfMoves, this->maximumNumberOfMoves);
+
+    std::vector<SgfcColor> colors(numberOfMoves);
+    std::vector<unsigned int> xPositions(numberOfMoves);
+    std::vector<unsigned int> yPositions(numberOfMoves);
+    moveBuffers.Colors = colors.data();
+    moveBuffers.XPositions = xPositions.data();
+    moveBuffers.YPositions = yPositions.data();
+    moveBuffers.Capacity = numberOfMoves;
+    moveBuffers.CoordinateSystem = SgfcCoordinateSystem::UpperLeftOrigin;
+    game.GetMainVariationGoMoves(moveBuffers);
+
+    gameMoves.MoveKeys.reserve(numberOfMoves);
+    for (std::size_t moveIndex = 0; moveIndex < numberOfMoves; moveIndex++)
+      gameMoves.MoveKeys.push_back(GetMoveKey(colors[moveIndex], xPositions[moveIndex], yPositions[moveIndex]));
+
+    if (this->useCanonicalSymmetry)
+      CanonicalizeMoveKeys(gameMoves.MoveKeys);
+
+    gameMoves.GameResult = game.CreateGameInfo()->GetGameResult();
+    gameMoves.IsMergeable = true;
+  }
+
+  /// @brief Replaces @a moveKeys with the smallest of the move sequences that
+  /// result from applying each symmetry of the board to @a moveKeys.
+  ///
+  /// Sequences are compared lexicographically, so the prefixes of the
+  /// smallest sequence are also the smallest of their equivalent prefixes.
+  /// Games that start with equivalent moves are therefore canonicalized to
+  /// the same prefix, regardless of how they continue.
+  void SgfcGoOpeningTreeBuilder::CanonicalizeMoveKeys(std::vector<std::uint32_t>& moveKeys) const
+  {
+    // Symmetries 0-3 are valid for all boards, symmetries 4-7 only for square
+    // boards. See SgfcGoPosition::GetCanonicalZobristHash().
+    int numberOfSymmetries = this->boardSize.IsSquare() ? 8 : 4;
+
+    std::vector<std::uint32_t> transformedMoveKeys(moveKeys.size());
+
+    for (int symmetry = 1; symmetry < numberOfSymmetries; symmetry++)
+    {
+      for (std::size_t moveIndex = 0; moveIndex < moveKeys.size(); moveIndex++)
+        transformedMoveKeys[moveIndex] = TransformMoveKey(moveKeys[moveIndex], symmetry);
+
+      if (transformedMoveKeys < moveKeys)
+        moveKeys.swap(transformedMoveKeys);
+    }
+  }
+
+  /// @brief Returns the move key that results from applying @a symmetry to
+  /// the move @a moveKey. The numbering of the symmetries is the same as in
+  /// SgfcGoPosition::GetCanonicalZobristHash().
+  std::uint32_t SgfcGoOpeningTreeBuilder::TransformMoveKey(std::uint32_t moveKey, int symmetry) const
+  {
+    if ((moveKey & 0xffff) == 0xffff)
+      return moveKey;
+
+    unsigned int column = (moveKey >> 8) & 0xff;
+    unsigned int row = moveKey & 0xff;
+    unsigned int mirroredColumn = this->boardSize.Columns - 1 - column;
+    unsigned int mirroredRow = this->boardSize.Rows - 1 - row;
+
+    unsigned int transformedColumn;
+    unsigned int transformedRow;
+    switch (symmetry)
+    {
+      case 1: transformedColumn = mirroredColumn; transformedRow = row; break;
+      case 2: transformedColumn = column; transformedRow = mirroredRow; break;
+      case 3: transformedColumn = mirroredColumn; transformedRow = mirroredRow; break;
+      case 4: transformedColumn = row; transformedRow = column; break;
+      case 5: transformedColumn = mirroredRow; transformedRow = column; break;
+      case 6: transformedColumn = row; transformedRow = mirroredColumn; break;
+      case 7: transformedColumn = mirroredRow; transformedRow = mirroredColumn; break;
+      default: transformedColumn = column; transformedRow = row; break;
+    }
+
+    return (moveKey & 0x10000) | (transformedColumn << 8) | transformedRow;
+  }
+
+  /// @brief Returns the trie that contains the child nodes of the node
+  /// @a nodeIndex of @a trie. @a depth is the depth of the node in the
+  /// opening tree, 0 being the root node.
+  const SgfcGoOpeningTreeBuilder::Trie& SgfcGoOpeningTreeBuilder::GetChildTrie(
+    const Trie& trie,
+    std::uint32_t nodeIndex,
+    std::size_t depth) const
+  {
+    if (depth == SgfcPrivateConstants::GoOpeningTreeShardingDepth)
+      return this->lowerTries[nodeIndex % this->lowerTries.size()];
+    else
+      return trie;
+  }
+
+  /// @brief Returns the key of a move by the player @a color at the 1-based
+  /// position @a xPosition and @a yPosition. A position 0 denotes a pass
+  /// move.
+  ///
+  /// Bit 16 of the key is the color (0 = Black, 1 = White). Bits 0-15 are
+  /// 0xffff for a pass move, otherwise bits 8-15 are the 0-based column and
+  /// bits 0-7 the 0-based row, with the origin in the upper left corner.
+  std::uint32_t SgfcGoOpeningTreeBuilder::GetMoveKey(SgfcColor color, unsigned int xPosition, unsigned int yPosition)
+  {
+    std::uint32_t colorBit = (color == SgfcColor::White) ? 0x10000 : 0;
+
+    if (xPosition == 0 || yPosition == 0)
+      return colorBit | 0xffff;
+    else
+      return colorBit | ((xPosition - 1) << 8) | (yPosition - 1);
+  }
+
+  /// @brief Returns the index of the child node for the move @a moveKey of
+  /// the node @a parentNodeIndex in @a parentNodes. Adds a new child node to
+  /// @a trie if there is none yet. @a parentNodes is either the nodes of
+  /// @a trie, or the nodes of the upper trie if the parent node is at the
+  /// sharding depth.
+  ///
+  /// @exception std::length_error Is thrown if @a trie cannot hold any more
+  /// nodes.
+  std::uint32_t SgfcGoOpeningTreeBuilder::GetOrAddChildNode(
+    Trie& trie,
+    std::vector<TrieNode>& parentNodes,
+    std::uint32_t parentNodeIndex,
+    std::uint32_t moveKey)
+  {
+    std::uint32_t parentNodeReference = parentNodeIndex;
+    if (&parentNodes != &trie.Nodes)
+      parentNodeReference |= UpperParentNodeFlag;
+
+    std::uint64_t childNodeKey = GetChildNodeKey(parentNodeReference, moveKey);
+    auto it = trie.ChildNodeIndexes.find(childNodeKey);
+    if (it != trie.ChildNodeIndexes.end())
+      return it->second;
+
+    if (trie.Nodes.size() >= UpperParentNodeFlag)
+      throw std::length_error("GetOrAddChildNode failed: Too many nodes in opening tree");
+
+    std::uint32_t childNodeIndex = static_cast<std::uint32_t>(trie.Nodes.size());
+
+    TrieNode childNode;
+    childNode.MoveKey = moveKey;
+    childNode.NextSiblingIndex = parentNodes[parentNodeIndex].FirstChildIndex;
+    trie.Nodes.push_back(childNode);
+
+    // Don't keep a reference to the parent node across push_back(), the
+    // parent node may be in the same vector
+    parentNodes[parentNodeIndex].FirstChildIndex = childNodeIndex;
+    trie.ChildNodeIndexes[childNodeKey] = childNodeIndex;
+
+    return childNodeIndex;
+  }
+
+  std::uint64_t SgfcGoOpeningTreeBuilder::GetChildNodeKey(std::uint32_t parentNodeIndex, std::uint32_t moveKey)
+  {
+    return (static_cast<std::uint64_t>(parentNodeIndex) << 32) | moveKey;
+  }
+
+  void SgfcGoOpeningTreeBuilder::AddGameResult(NodeStatistics& statistics, const SgfcGameResult& gameResult)
+  {
+    statistics.NumberOfGames++;
+
+    if (! gameResult.IsValid)
+      return;
+
+    switch (gameResult.GameResultType)
+    {
+      case SgfcGameResultType::BlackWin:
+        statistics.NumberOfBlackWins++;
+        break;
+      case SgfcGameResultType::WhiteWin:
+        statistics.NumberOfWhiteWins++;
+        break;
+      case SgfcGameResultType::Draw:
+        statistics.NumberOfDraws++;
+        break;
+      default:
+        break;
+    }
+  }
+
+  /// @brief Returns the text of the SgfcPropertyType::C property that
+  /// CreateDocument() writes for a node with the statistics @a statistics.
+  std::string SgfcGoOpeningTreeBuilder::GetStatisticsText(const NodeStatistics& statistics)
+  {
+    std::stringstream stream;
+    stream.imbue(std::locale::classic());
+    stream << std::fixed << std::setprecision(1);
+
+    auto streamCount = [&stream, &statistics](const char* label, std::uint32_t count)
+    {
+      double percentage = (statistics.NumberOfGames > 0) ? (100.0 * count / statistics.NumberOfGames) : 0.0;
+      stream << label << ": " << count << " (" << percentage << "%)";
+    };
+
+    stream << "Games: " << statistics.NumberOfGames << "\n";
+    streamCount("Black wins", statistics.NumberOfBlackWins);
+    stream << "\n";
+    streamCount("White wins", statistics.NumberOfWhiteWins);
+    stream << "\n";
+    streamCount("Draws", statistics.NumberOfDraws);
+
+    return stream.str();
+  }
+
+  /// @brief Returns the character that represents the 0-based @a position
+  /// in SGF notation.
+  char SgfcGoOpeningTreeBuilder::GetSgfCharacter(unsigned int position)
+  {
+    if (position < 26)
+      return static_cast<char>('a' + position);
+    else
+      return static_cast<char>('A' + position - 26);
+  }
+}
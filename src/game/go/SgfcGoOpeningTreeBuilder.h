@@ -0,0 +1,161 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../../include/ISgfcGoOpeningTreeBuilder.h"
+#include "../../../include/SgfcGameResult.h"
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcGoOpeningTreeBuilder class provides an implementation of
+  /// the ISgfcGoOpeningTreeBuilder interface. See the interface header file
+  /// for documentation.
+  ///
+  /// @ingroup internals
+  /// @ingroup go
+  ///
+  /// The opening tree is stored in several tries. The upper trie holds the
+  /// root node and the nodes for the first
+  /// SgfcPrivateConstants::GoOpeningTreeShardingDepth moves. Each node at
+  /// that depth is assigned to one of
+  /// SgfcPrivateConstants::GoOpeningTreeNumberOfShards lower tries, which
+  /// hold all of the node's descendants. AddGames() merges the upper part of
+  /// the games on the calling thread, then merges the lower tries in
+  /// parallel. Because the upper trie is not modified while the lower tries
+  /// are merged, and because each node at the sharding depth belongs to
+  /// exactly one lower trie, no synchronization is required.
+  ///
+  /// The nodes of a trie are stored in a vector and refer to each other by
+  /// index. The child nodes of a node form a linked list, which is used only
+  /// to export the opening tree. To find the child node for a move, a trie
+  /// has a hash map that is keyed by the parent node and the move.
+  class SgfcGoOpeningTreeBuilder : public ISgfcGoOpeningTreeBuilder
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcGoOpeningTreeBuilder
+    /// object. The opening tree is empty and has the board size
+    /// @a boardSize.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a boardSize is not
+    /// valid for #SgfcGameType::Go.
+    SgfcGoOpeningTreeBuilder(SgfcBoardSize boardSize);
+
+    /// @brief Destroys and cleans up the SgfcGoOpeningTreeBuilder object.
+    virtual ~SgfcGoOpeningTreeBuilder();
+
+    virtual SgfcBoardSize GetBoardSize() const override;
+    virtual std::size_t GetMaximumNumberOfMoves() const override;
+    virtual void SetMaximumNumberOfMoves(std::size_t maximumNumberOfMoves) override;
+    virtual bool GetUseCanonicalSymmetry() const override;
+    virtual void SetUseCanonicalSymmetry(bool useCanonicalSymmetry) override;
+    virtual std::size_t GetMinimumNumberOfGames() const override;
+    virtual void SetMinimumNumberOfGames(std::size_t minimumNumberOfGames) override;
+    virtual unsigned int GetNumberOfThreads() const override;
+    virtual void SetNumberOfThreads(unsigned int numberOfThreads) override;
+
+    virtual bool AddGame(std::shared_ptr<ISgfcGame> game) override;
+    virtual std::size_t AddGames(const std::vector<std::shared_ptr<ISgfcGame>>& games) override;
+    virtual std::size_t GetNumberOfGames() const override;
+    virtual std::size_t GetNumberOfNodes() const override;
+
+    virtual std::shared_ptr<ISgfcDocument> CreateDocument() const override;
+
+  private:
+    /// @brief Marks the absence of a node index.
+    static constexpr std::uint32_t NoNodeIndex = 0xffffffff;
+    /// @brief Marks a parent node index in GetChildNodeKey() that refers to
+    /// a node in the upper trie although the child node is in a lower trie.
+    /// A trie can therefore hold at most UpperParentNodeFlag nodes.
+    static constexpr std::uint32_t UpperParentNodeFlag = 0x80000000;
+
+    /// @brief The number of games that passed through a node, broken down
+    /// by game result.
+    struct NodeStatistics
+    {
+      std::uint32_t NumberOfGames = 0;
+      std::uint32_t NumberOfBlackWins = 0;
+      std::uint32_t NumberOfWhiteWins = 0;
+      std::uint32_t NumberOfDraws = 0;
+    };
+
+    /// @brief A node of a trie. See GetMoveKey() for the layout of
+    /// @e MoveKey. @e FirstChildIndex and @e NextSiblingIndex are
+    /// NoNodeIndex if the node has no child or no next sibling. If the node
+    /// is an upper trie node at the sharding depth then @e FirstChildIndex
+    /// refers to a node in the node's lower trie.
+    struct TrieNode
+    {
+      std::uint32_t MoveKey = 0;
+      std::uint32_t FirstChildIndex = NoNodeIndex;
+      std::uint32_t NextSiblingIndex = NoNodeIndex;
+      NodeStatistics Statistics;
+    };
+
+    /// @brief A trie. @e ChildNodeIndexes maps the key returned by
+    /// GetChildNodeKey() to the index of the child node in @e Nodes.
+    struct Trie
+    {
+      std::vector<TrieNode> Nodes;
+      std::unordered_map<std::uint64_t, std::uint32_t> ChildNodeIndexes;
+    };
+
+    /// @brief The data of a game that is needed to merge the game.
+    /// @e UpperNodeIndex is the index of the upper trie node at the sharding
+    /// depth at which the game continues in a lower trie.
+    struct GameMoves
+    {
+      bool IsMergeable = false;
+      std::vector<std::uint32_t> MoveKeys;
+      SgfcGameResult GameResult;
+      std::uint32_t UpperNodeIndex = NoNodeIndex;
+    };
+
+
+    SgfcBoardSize boardSize;
+    std::size_t maximumNumberOfMoves;
+    bool useCanonicalSymmetry;
+    std::size_t minimumNumberOfGames;
+    unsigned int numberOfThreads;
+    std::size_t numberOfGames;
+    /// @brief The upper trie. Node 0 is the root node.
+    Trie upperTrie;
+    std::vector<Trie> lowerTries;
+
+    void GetGameMoves(const ISgfcGame& game, GameMoves& gameMoves) const;
+    void CanonicalizeMoveKeys(std::vector<std::uint32_t>& moveKeys) const;
+    std::uint32_t TransformMoveKey(std::uint32_t moveKey, int symmetry) const;
+    const Trie& GetChildTrie(const Trie& trie, std::uint32_t nodeIndex, std::size_t depth) const;
+
+    static std::uint32_t GetMoveKey(SgfcColor color, unsigned int xPosition, unsigned int yPosition);
+    static std::uint32_t GetOrAddChildNode(
+      Trie& trie,
+      std::vector<TrieNode>& parentNodes,
+      std::uint32_t parentNodeIndex,
+      std::uint32_t moveKey);
+    static std::uint64_t GetChildNodeKey(std::uint32_t parentNodeIndex, std::uint32_t moveKey);
+    static void AddGameResult(NodeStatistics& statistics, const SgfcGameResult& gameResult);
+    static std::string GetStatisticsText(const NodeStatistics& statistics);
+    static char GetSgfCharacter(unsigned int position);
+  };
+}
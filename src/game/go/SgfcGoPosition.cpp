@@ -0,0 +1,230 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "SgfcGoPosition.h"
+#include "SgfcGoZobristTable.h"
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <stdexcept>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcGoPosition::SgfcGoPosition(SgfcBoardSize boardSize)
+    : boardSize(boardSize)
+    , boardMask(SgfcGoBitboard::CreateBoardMask(boardSize))
+    , blackStones(static_cast<unsigned int>(boardSize.Rows))
+    , whiteStones(static_cast<unsigned int>(boardSize.Rows))
+    , numberOfCapturedBlackStones(0)
+    , numberOfCapturedWhiteStones(0)
+    , zobristHash(SgfcGoZobristTable::GetBoardSizeKey(boardSize))
+  {
+  }
+
+  SgfcGoPosition::~SgfcGoPosition()
+  {
+  }
+
+  SgfcBoardSize SgfcGoPosition::GetBoardSize() const
+  {
+    return this->boardSize;
+  }
+
+  bool SgfcGoPosition::HasStone(unsigned int xPosition, unsigned int yPosition) const
+  {
+    ThrowIfPositionIsOutsideOfBoard(xPosition, yPosition);
+
+    return
+      this->blackStones.Test(xPosition - 1, yPosition - 1) ||
+      this->whiteStones.Test(xPosition - 1, yPosition - 1);
+  }
+
+  SgfcColor SgfcGoPosition::GetStoneColor(unsigned int xPosition, unsigned int yPosition) const
+  {
+    ThrowIfPositionIsOutsideOfBoard(xPosition, yPosition);
+
+    if (this->blackStones.Test(xPosition - 1, yPosition - 1))
+      return SgfcColor::Black;
+    else if (this->whiteStones.Test(xPosition - 1, yPosition - 1))
+      return SgfcColor::White;
+    else
+      throw std::invalid_argument("GetStoneColor failed: Intersection has no stone");
+  }
+
+  unsigned int SgfcGoPosition::GetNumberOfStones(SgfcColor color) const
+  {
+    return GetStones(color).Count();
+  }
+
+  unsigned int SgfcGoPosition::GetNumberOfCapturedStones(SgfcColor color) const
+  {
+    if (color == SgfcColor::Black)
+      return this->numberOfCapturedBlackStones;
+    else
+      return this->numberOfCapturedWhiteStones;
+  }
+
+  bool SgfcGoPosition::IsSameBoard(const ISgfcGoPosition& other) const
+  {
+    const SgfcGoPosition& otherImplementation = dynamic_cast<const SgfcGoPosition&>(other);
+
+    return
+      this->boardSize == otherImplementation.boardSize &&
+      this->blackStones == otherImplementation.blackStones &&
+      this->whiteStones == otherImplementation.whiteStones;
+  }
+
+  std::uint64_t SgfcGoPosition::GetZobristHash() const
+  {
+    return this->zobristHash;
+  }
+
+  std::uint64_t SgfcGoPosition::GetCanonicalZobristHash() const
+  {
+    unsigned int numberOfColumns = static_cast<unsigned int>(this->boardSize.Columns);
+    unsigned int numberOfRows = static_cast<unsigned int>(this->boardSize.Rows);
+    bool isSquareBoard = (numberOfColumns == numberOfRows);
+
+    // Symmetries 0-3 are valid for all boards: identity, horizontal
+    // reflection, vertical reflection, 180 degree rotation. Symmetries 4-7
+    // swap columns and rows and are therefore valid only for square boards.
+    static const int NumberOfSymmetries = 8;
+    int numberOfSymmetries = isSquareBoard ? NumberOfSymmetries : NumberOfSymmetries / 2;
+
+    std::uint64_t boardSizeKey = SgfcGoZobristTable::GetBoardSizeKey(this->boardSize);
+    std::uint64_t symmetryHashes[NumberOfSymmetries];
+    std::fill(symmetryHashes, symmetryHashes + NumberOfSymmetries, boardSizeKey);
+
+    for (auto color : { SgfcColor::Black, SgfcColor::White })
+    {
+      SgfcGoBitboard remainingStones = GetStones(color);
+      unsigned int column;
+      unsigned int row;
+      while (remainingStones.GetFirst(column, row))
+      {
+        remainingStones.Clear(column, row);
+
+        unsigned int mirroredColumn = numberOfColumns - 1 - column;
+        unsigned int mirroredRow = numberOfRows - 1 - row;
+
+        symmetryHashes[0] ^= SgfcGoZobristTable::GetStoneKey(color, column, row);
+        symmetryHashes[1] ^= SgfcGoZobristTable::GetStoneKey(color, mirroredColumn, row);
+        symmetryHashes[2] ^= SgfcGoZobristTable::GetStoneKey(color, column, mirroredRow);
+        symmetryHashes[3] ^= SgfcGoZobristTable::GetStoneKey(color, mirroredColumn, mirroredRow);
+
+        if (isSquareBoard)
+        {
+          symmetryHashes[4] ^= SgfcGoZobristTable::GetStoneKey(color, row, column);
+          symmetryHashes[5] ^= SgfcGoZobristTable::GetStoneKey(color, mirroredRow, column);
+          symmetryHashes[6] ^= SgfcGoZobristTable::GetStoneKey(color, row, mirroredColumn);
+          symmetryHashes[7] ^= SgfcGoZobristTable::GetStoneKey(color, mirroredRow, mirroredColumn);
+        }
+      }
+    }
+
+    return *std::min_element(symmetryHashes, symmetryHashes + numberOfSymmetries);
+  }
+
+  const SgfcGoBitboard& SgfcGoPosition::GetStones(SgfcColor color) const
+  {
+    if (color == SgfcColor::Black)
+      return this->blackStones;
+    else
+      return this->whiteStones;
+  }
+
+  void SgfcGoPosition::AddStone(SgfcColor color, unsigned int column, unsigned int row)
+  {
+    SgfcGoBitboard& stones = GetStonesForModification(color);
+    if (stones.Test(column, row))
+      return;
+
+    stones.Set(column, row);
+    this->zobristHash ^= SgfcGoZobristTable::GetStoneKey(color, column, row);
+  }
+
+  void SgfcGoPosition::RemoveStone(SgfcColor color, unsigned int column, unsigned int row)
+  {
+    SgfcGoBitboard& stones = GetStonesForModification(color);
+    if (! stones.Test(column, row))
+      return;
+
+    stones.Clear(column, row);
+    this->zobristHash ^= SgfcGoZobristTable::GetStoneKey(color, column, row);
+  }
+
+  void SgfcGoPosition::RemoveStones(SgfcColor color, const SgfcGoBitboard& stones)
+  {
+    GetStonesForModification(color) -= stones;
+
+    SgfcGoBitboard remainingStones = stones;
+    unsigned int column;
+    unsigned int row;
+    while (remainingStones.GetFirst(column, row))
+    {
+      remainingStones.Clear(column, row);
+      this->zobristHash ^= SgfcGoZobristTable::GetStoneKey(color, column, row);
+    }
+  }
+
+  const SgfcGoBitboard& SgfcGoPosition::GetBoardMask() const
+  {
+    return this->boardMask;
+  }
+
+  SgfcGoBitboard SgfcGoPosition::GetEmptyIntersections() const
+  {
+    SgfcGoBitboard emptyIntersections = this->boardMask;
+    emptyIntersections -= this->blackStones;
+    emptyIntersections -= this->whiteStones;
+    return emptyIntersections;
+  }
+
+  void SgfcGoPosition::AddCapturedStones(SgfcColor color, unsigned int numberOfStones)
+  {
+    if (color == SgfcColor::Black)
+      this->numberOfCapturedBlackStones += numberOfStones;
+    else
+      this->numberOfCapturedWhiteStones += numberOfStones;
+  }
+
+  void SgfcGoPosition::Clear()
+  {
+    this->blackStones.ClearAll();
+    this->whiteStones.ClearAll();
+    this->numberOfCapturedBlackStones = 0;
+    this->numberOfCapturedWhiteStones = 0;
+    this->zobristHash = SgfcGoZobristTable::GetBoardSizeKey(this->boardSize);
+  }
+
+  SgfcGoBitboard& SgfcGoPosition::GetStonesForModification(SgfcColor color)
+  {
+    if (color == SgfcColor::Black)
+      return this->blackStones;
+    else
+      return this->whiteStones;
+  }
+
+  void SgfcGoPosition::ThrowIfPositionIsOutsideOfBoard(unsigned int xPosition, unsigned int yPosition) const
+  {
+    if (xPosition < 1 || xPosition > this->boardSize.Columns ||
+        yPosition < 1 || yPosition > this->boardSize.Rows)
+    {
+      throw std::invalid_argument("Position is outside of the board");
+    }
+  }
+}
@@ -0,0 +1,101 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../../include/ISgfcGoPosition.h"
+#include "SgfcGoBitboard.h"
+
+// C++ Standard Library includes
+#include <cstdint>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcGoPosition class provides an implementation of the
+  /// ISgfcGoPosition interface. See the interface header file for
+  /// documentation.
+  ///
+  /// @ingroup internals
+  /// @ingroup go
+  ///
+  /// SgfcGoPosition stores the stones of each color in an SgfcGoBitboard.
+  /// SgfcGoReplayEngine modifies the position via the library-internal
+  /// methods of this class, which keep the Zobrist hash up to date
+  /// incrementally.
+  class SgfcGoPosition : public ISgfcGoPosition
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcGoPosition object with an
+    /// empty board of size @a boardSize.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a boardSize has more
+    /// than SgfcGoBitboard::MaximumDimension columns or rows.
+    SgfcGoPosition(SgfcBoardSize boardSize);
+
+    /// @brief Destroys and cleans up the SgfcGoPosition object.
+    virtual ~SgfcGoPosition();
+
+    virtual SgfcBoardSize GetBoardSize() const override;
+    virtual bool HasStone(unsigned int xPosition, unsigned int yPosition) const override;
+    virtual SgfcColor GetStoneColor(unsigned int xPosition, unsigned int yPosition) const override;
+    virtual unsigned int GetNumberOfStones(SgfcColor color) const override;
+    virtual unsigned int GetNumberOfCapturedStones(SgfcColor color) const override;
+    virtual bool IsSameBoard(const ISgfcGoPosition& other) const override;
+    virtual std::uint64_t GetZobristHash() const override;
+    virtual std::uint64_t GetCanonicalZobristHash() const override;
+
+    /// @brief Returns the bitboard with the stones of color @a color.
+    const SgfcGoBitboard& GetStones(SgfcColor color) const;
+    /// @brief Places a stone of color @a color on the intersection at
+    /// @a column and @a row (0-based), and updates the Zobrist hash. Does
+    /// nothing if a stone of that color is already on the intersection.
+    void AddStone(SgfcColor color, unsigned int column, unsigned int row);
+    /// @brief Removes a stone of color @a color from the intersection at
+    /// @a column and @a row (0-based), and updates the Zobrist hash. Does
+    /// nothing if no stone of that color is on the intersection.
+    void RemoveStone(SgfcColor color, unsigned int column, unsigned int row);
+    /// @brief Removes the stones of color @a color that are set in @a stones,
+    /// and updates the Zobrist hash. @a stones must be a subset of the stones
+    /// of color @a color on the board.
+    void RemoveStones(SgfcColor color, const SgfcGoBitboard& stones);
+    /// @brief Returns the bitboard in which the bits for all intersections on
+    /// the board are set.
+    const SgfcGoBitboard& GetBoardMask() const;
+    /// @brief Returns a bitboard with the intersections that are not occupied
+    /// by a stone.
+    SgfcGoBitboard GetEmptyIntersections() const;
+    /// @brief Adds @a numberOfStones to the number of captured stones of color
+    /// @a color.
+    void AddCapturedStones(SgfcColor color, unsigned int numberOfStones);
+    /// @brief Removes all stones from the board and resets the number of
+    /// captured stones to zero.
+    void Clear();
+
+  private:
+    SgfcBoardSize boardSize;
+    SgfcGoBitboard boardMask;
+    SgfcGoBitboard blackStones;
+    SgfcGoBitboard whiteStones;
+    unsigned int numberOfCapturedBlackStones;
+    unsigned int numberOfCapturedWhiteStones;
+    std::uint64_t zobristHash;
+
+    SgfcGoBitboard& GetStonesForModification(SgfcColor color);
+
+    void ThrowIfPositionIsOutsideOfBoard(unsigned int xPosition, unsigned int yPosition) const;
+  };
+}
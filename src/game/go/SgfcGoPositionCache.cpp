@@ -0,0 +1,148 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../document/SgfcNode.h"
+#include "SgfcGoPositionCache.h"
+
+// C++ Standard Library includes
+#include <stdexcept>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcGoPositionCache::SgfcGoPositionCache(
+    SgfcBoardSize boardSize,
+    SgfcGoRuleset goRuleset,
+    std::size_t checkpointInterval,
+    std::size_t maximumNumberOfCheckpoints)
+    : isValid(true)
+    , boardSize(boardSize)
+    , goRuleset(goRuleset)
+    , checkpointInterval(checkpointInterval)
+    , maximumNumberOfCheckpoints(maximumNumberOfCheckpoints)
+  {
+    if (! boardSize.IsValid(SgfcGameType::Go))
+      throw std::invalid_argument("SgfcGoPositionCache constructor failed: Board size is not valid for Go");
+    if (checkpointInterval == 0)
+      throw std::invalid_argument("SgfcGoPositionCache constructor failed: Checkpoint interval is 0");
+  }
+
+  SgfcGoPositionCache::~SgfcGoPositionCache()
+  {
+  }
+
+  bool SgfcGoPositionCache::IsValid() const
+  {
+    return this->isValid;
+  }
+
+  void SgfcGoPositionCache::Invalidate()
+  {
+    this->isValid = false;
+    this->checkpoints.clear();
+    this->leastRecentlyUsedList.clear();
+  }
+
+  std::size_t SgfcGoPositionCache::GetNumberOfCheckpoints() const
+  {
+    return this->checkpoints.size();
+  }
+
+  std::shared_ptr<ISgfcGoPosition> SgfcGoPositionCache::GetPosition(
+    std::shared_ptr<ISgfcNode> rootNode,
+    std::shared_ptr<ISgfcNode> node)
+  {
+    // Walk up the tree until we find the nearest checkpoint. Nodes with a
+    // checkpoint are known to be part of the game tree, so the walk also
+    // serves to verify that the node is part of the game tree.
+    std::vector<std::shared_ptr<ISgfcNode>> nodesToReplay;
+    const Checkpoint* checkpoint = nullptr;
+
+    auto currentNode = node;
+    while (true)
+    {
+      auto it = this->checkpoints.find(currentNode.get());
+      if (it != this->checkpoints.end())
+      {
+        checkpoint = &(it->second);
+        this->leastRecentlyUsedList.splice(
+          this->leastRecentlyUsedList.begin(),
+          this->leastRecentlyUsedList,
+          it->second.LeastRecentlyUsedPosition);
+        break;
+      }
+
+      nodesToReplay.push_back(currentNode);
+
+      if (currentNode == rootNode)
+        break;
+
+      currentNode = currentNode->GetParent();
+      if (currentNode == nullptr)
+        throw std::invalid_argument("GetPosition failed: Node is not part of the game tree");
+    }
+
+    SgfcGoReplayEngine goReplayEngine = (checkpoint != nullptr)
+      ? checkpoint->GoReplayEngine
+      : SgfcGoReplayEngine(this->boardSize, this->goRuleset);
+    std::size_t depth = (checkpoint != nullptr) ? checkpoint->Depth + 1 : 0;
+
+    std::weak_ptr<SgfcGoPositionCache> weakThis = weak_from_this();
+
+    for (auto it = nodesToReplay.rbegin(); it != nodesToReplay.rend(); it++, depth++)
+    {
+      auto nodeToReplay = *it;
+
+      SgfcNode* nodeImplementation = static_cast<SgfcNode*>(nodeToReplay.get());
+      nodeImplementation->SetGoPositionCache(weakThis);
+
+      goReplayEngine.ApplyNode(nodeToReplay);
+
+      if (ShouldStoreCheckpoint(*nodeToReplay, depth))
+        StoreCheckpoint(nodeToReplay.get(), goReplayEngine, depth);
+    }
+
+    return goReplayEngine.GetPosition();
+  }
+
+  bool SgfcGoPositionCache::ShouldStoreCheckpoint(const ISgfcNode& node, std::size_t depth) const
+  {
+    if (depth % this->checkpointInterval == 0)
+      return true;
+
+    auto firstChild = node.GetFirstChild();
+    return (firstChild != nullptr && firstChild->HasNextSibling());
+  }
+
+  void SgfcGoPositionCache::StoreCheckpoint(const ISgfcNode* node, SgfcGoReplayEngine& goReplayEngine, std::size_t depth)
+  {
+    if (this->maximumNumberOfCheckpoints == 0)
+      return;
+
+    // Don't copy the position history into the checkpoint, share it
+    goReplayEngine.SharePositionHistory();
+
+    if (this->checkpoints.size() >= this->maximumNumberOfCheckpoints)
+    {
+      this->checkpoints.erase(this->leastRecentlyUsedList.back());
+      this->leastRecentlyUsedList.pop_back();
+    }
+
+    this->leastRecentlyUsedList.push_front(node);
+    this->checkpoints.emplace(node, Checkpoint { goReplayEngine, depth, this->leastRecentlyUsedList.begin() });
+  }
+}
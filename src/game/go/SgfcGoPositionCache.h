@@ -0,0 +1,152 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../../include/ISgfcGoPosition.h"
+#include "../../../include/ISgfcNode.h"
+#include "SgfcGoReplayEngine.h"
+
+// C++ Standard Library includes
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcGoPositionCache class provides the Go board position at
+  /// any node of a game tree, and stores replay checkpoints along the paths
+  /// that it has replayed so far.
+  ///
+  /// @ingroup internals
+  /// @ingroup go
+  ///
+  /// SgfcGame owns an SgfcGoPositionCache object and uses it to answer
+  /// ISgfcGame::GetGoPosition() queries.
+  ///
+  /// A checkpoint is a copy of the replay engine state after a node has been
+  /// applied. The copy holds the board and the ko state. The position
+  /// history needed for superko checks is not copied, instead checkpoints on
+  /// the same path share the history via
+  /// SgfcGoReplayEngine::SharePositionHistory(). A checkpoint's own share of
+  /// the history therefore is limited to the positions since the previous
+  /// checkpoint. To find the position at a node, GetPosition() walks up the
+  /// game tree until it finds an ancestor with a checkpoint (or the root
+  /// node), then replays the nodes from there down to the requested node.
+  /// While replaying it stores new checkpoints at every node whose depth is a
+  /// multiple of the checkpoint interval, and at every node with more than
+  /// one child (a branch point). The cost of a query is therefore
+  /// proportional to the distance to the nearest checkpoint, which for any
+  /// path that has been replayed once is at most the checkpoint interval.
+  ///
+  /// The number of checkpoints is limited. When the limit is reached the
+  /// least recently used checkpoint is discarded.
+  ///
+  /// Keeping the cache up-to-date works like this:
+  /// - GetPosition() registers the cache with every SgfcNode object that it
+  ///   replays.
+  /// - SgfcNode invokes Invalidate() whenever the node's collection of
+  ///   properties changes.
+  /// - SgfcTreeBuilder and SgfcGame invoke Invalidate() whenever the structure
+  ///   of the game tree changes.
+  /// - When SgfcTreeBuilder removes a node from a game tree it also invokes
+  ///   Invalidate() on the cache that the node's parent is registered with.
+  ///   This covers the case where the tree builder of one game moves a node
+  ///   out of the game tree of another game. The parent is an ancestor of
+  ///   every checkpoint in the removed subtree, so it is guaranteed to be
+  ///   registered with the cache if any such checkpoint exists.
+  /// - An invalid cache must be discarded by its owner.
+  ///
+  /// The SgfcGoPositionCache class inherits from std::enable_shared_from_this
+  /// so that it can register itself with SgfcNode objects. This only works if
+  /// the SgfcGoPositionCache object is owned by a std::shared_ptr.
+  class SgfcGoPositionCache : public std::enable_shared_from_this<SgfcGoPositionCache>
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcGoPositionCache object that
+    /// replays nodes on a board of size @a boardSize, according to the
+    /// ruleset @a goRuleset. The cache stores a checkpoint every
+    /// @a checkpointInterval nodes, and it stores at most
+    /// @a maximumNumberOfCheckpoints checkpoints.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a boardSize is not a
+    /// valid board size for SgfcGameType::Go, or if @a checkpointInterval
+    /// is 0.
+    SgfcGoPositionCache(
+      SgfcBoardSize boardSize,
+      SgfcGoRuleset goRuleset,
+      std::size_t checkpointInterval,
+      std::size_t maximumNumberOfCheckpoints);
+
+    /// @brief Destroys and cleans up the SgfcGoPositionCache object.
+    virtual ~SgfcGoPositionCache();
+
+    /// @brief Returns true if the checkpoints reflect the current state of
+    /// the game tree. Returns false if Invalidate() has been invoked.
+    bool IsValid() const;
+
+    /// @brief Discards all checkpoints and marks the cache as invalid.
+    void Invalidate();
+
+    /// @brief Returns the number of checkpoints that the cache currently
+    /// stores.
+    std::size_t GetNumberOfCheckpoints() const;
+
+    /// @brief Returns the position after all nodes on the path from
+    /// @a rootNode down to @a node have been applied.
+    ///
+    /// Illegal moves are not played, but replaying continues with the next
+    /// node.
+    ///
+    /// The implementation of this method assumes that all node objects are
+    /// instances of SgfcNode.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a node is not part of
+    /// the game tree that starts with @a rootNode.
+    std::shared_ptr<ISgfcGoPosition> GetPosition(
+      std::shared_ptr<ISgfcNode> rootNode,
+      std::shared_ptr<ISgfcNode> node);
+
+  private:
+    struct Checkpoint
+    {
+      SgfcGoReplayEngine GoReplayEngine;
+      std::size_t Depth;
+      std::list<const ISgfcNode*>::iterator LeastRecentlyUsedPosition;
+    };
+
+    bool isValid;
+    SgfcBoardSize boardSize;
+    SgfcGoRuleset goRuleset;
+    std::size_t checkpointInterval;
+    std::size_t maximumNumberOfCheckpoints;
+
+    /// @brief The checkpoints. The cache does not keep the nodes alive, the
+    /// game tree does. Removing a node from the game tree invalidates the
+    /// cache, regardless of which game's tree builder removes the node, so a
+    /// key never refers to a node that was released and whose address was
+    /// reused.
+    std::unordered_map<const ISgfcNode*, Checkpoint> checkpoints;
+
+    /// @brief The nodes that have a checkpoint, the most recently used node
+    /// first.
+    std::list<const ISgfcNode*> leastRecentlyUsedList;
+
+    bool ShouldStoreCheckpoint(const ISgfcNode& node, std::size_t depth) const;
+    void StoreCheckpoint(const ISgfcNode* node, SgfcGoReplayEngine& goReplayEngine, std::size_t depth);
+  };
+}
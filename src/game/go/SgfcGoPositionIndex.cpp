@@ -0,0 +1,214 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../../include/ISgfcGoPosition.h"
+#include "../../SgfcBinaryUtility.h"
+#include "../../SgfcPrivateConstants.h"
+#include "SgfcGoPositionIndex.h"
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcGoPositionIndex::SgfcGoPositionIndex(const std::string& indexFilePath)
+    : indexFilePath(indexFilePath)
+    , isCanonical(false)
+    , numberOfEntries(0)
+    , entryTableOffset(0)
+    , numberOfNodes(0)
+    , nodeTableOffset(0)
+    , in(std::filesystem::u8path(indexFilePath), std::ios::binary)
+  {
+    if (! this->in.is_open())
+    {
+      std::stringstream message;
+      message << "Failed to open file for reading: " << indexFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    std::string magic(SgfcPrivateConstants::GoPositionIndexMagic.size(), '\0');
+    this->in.read(&magic[0], static_cast<std::streamsize>(magic.size()));
+    if (magic != SgfcPrivateConstants::GoPositionIndexMagic)
+    {
+      std::stringstream message;
+      message << "File is not a Go position index file: " << indexFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    std::uint32_t formatVersion = SgfcBinaryUtility::ReadUInt32(this->in);
+    if (formatVersion != SgfcPrivateConstants::GoPositionIndexFormatVersion)
+    {
+      std::stringstream message;
+      message << "Go position index file has unsupported format version " << formatVersion << ": " << indexFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    std::uint32_t flags = SgfcBinaryUtility::ReadUInt32(this->in);
+    this->isCanonical = (flags & SgfcPrivateConstants::GoPositionIndexFlagCanonical) != 0;
+
+    std::uint64_t numberOfFiles = SgfcBinaryUtility::ReadUInt64(this->in);
+    this->numberOfEntries = SgfcBinaryUtility::ReadUInt64(this->in);
+    this->numberOfNodes = SgfcBinaryUtility::ReadUInt64(this->in);
+    std::uint64_t fileTableOffset = SgfcBinaryUtility::ReadUInt64(this->in);
+    this->entryTableOffset = SgfcBinaryUtility::ReadUInt64(this->in);
+    this->nodeTableOffset = SgfcBinaryUtility::ReadUInt64(this->in);
+
+    SeekTo(fileTableOffset);
+    for (std::uint64_t fileIndex = 0; fileIndex < numberOfFiles; fileIndex++)
+      this->filePaths.push_back(SgfcBinaryUtility::ReadString(this->in));
+  }
+
+  SgfcGoPositionIndex::~SgfcGoPositionIndex()
+  {
+  }
+
+  bool SgfcGoPositionIndex::IsCanonical() const
+  {
+    return this->isCanonical;
+  }
+
+  std::size_t SgfcGoPositionIndex::GetNumberOfEntries() const
+  {
+    return static_cast<std::size_t>(this->numberOfEntries);
+  }
+
+  std::vector<std::string> SgfcGoPositionIndex::GetFilePaths() const
+  {
+    return this->filePaths;
+  }
+
+  std::vector<SgfcGoPositionIndexEntry> SgfcGoPositionIndex::FindPositions(std::uint64_t hash) const
+  {
+    std::lock_guard<std::mutex> lock(this->inMutex);
+
+    // Binary search for the first entry whose hash is not less than the
+    // searched hash
+    std::uint64_t firstEntryIndex = 0;
+    std::uint64_t lastEntryIndex = this->numberOfEntries;
+    while (firstEntryIndex < lastEntryIndex)
+    {
+      std::uint64_t middleEntryIndex = firstEntryIndex + (lastEntryIndex - firstEntryIndex) / 2;
+      if (ReadEntryHash(middleEntryIndex) < hash)
+        firstEntryIndex = middleEntryIndex + 1;
+      else
+        lastEntryIndex = middleEntryIndex;
+    }
+
+    std::vector<SgfcGoPositionIndexEntry> entries;
+    for (std::uint64_t entryIndex = firstEntryIndex; entryIndex < this->numberOfEntries; entryIndex++)
+    {
+      if (ReadEntryHash(entryIndex) != hash)
+        break;
+
+      entries.push_back(ReadEntry(entryIndex));
+    }
+
+    return entries;
+  }
+
+  std::vector<SgfcGoPositionIndexEntry> SgfcGoPositionIndex::FindPositions(const ISgfcGoPosition& goPosition) const
+  {
+    if (this->isCanonical)
+      return FindPositions(goPosition.GetCanonicalZobristHash());
+    else
+      return FindPositions(goPosition.GetZobristHash());
+  }
+
+  std::uint64_t SgfcGoPositionIndex::ReadEntryHash(std::uint64_t entryIndex) const
+  {
+    SeekTo(this->entryTableOffset + entryIndex * SgfcPrivateConstants::GoPositionIndexEntrySize);
+    return SgfcBinaryUtility::ReadUInt64(this->in);
+  }
+
+  SgfcGoPositionIndexEntry SgfcGoPositionIndex::ReadEntry(std::uint64_t entryIndex) const
+  {
+    // Skip the hash
+    SeekTo(this->entryTableOffset + entryIndex * SgfcPrivateConstants::GoPositionIndexEntrySize + 8);
+    std::uint32_t fileIndex = SgfcBinaryUtility::ReadUInt32(this->in);
+    std::uint32_t gameIndex = SgfcBinaryUtility::ReadUInt32(this->in);
+    std::uint64_t nodeNumber = SgfcBinaryUtility::ReadUInt64(this->in);
+
+    if (fileIndex >= this->filePaths.size())
+    {
+      std::stringstream message;
+      message << "Go position index file is corrupt, entry refers to unknown file: " << this->indexFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    SgfcGoPositionIndexEntry entry;
+    entry.FilePath = this->filePaths[fileIndex];
+    entry.GameIndex = gameIndex;
+    entry.NodePath = ReadNodePath(nodeNumber);
+
+    return entry;
+  }
+
+  std::vector<std::size_t> SgfcGoPositionIndex::ReadNodePath(std::uint64_t nodeNumber) const
+  {
+    if (nodeNumber >= this->numberOfNodes)
+    {
+      std::stringstream message;
+      message << "Go position index file is corrupt, entry refers to unknown node: " << this->indexFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    // Follow the parent references up to the root node. The parent node
+    // always has a smaller number, so this terminates even for a corrupt
+    // file.
+    std::vector<std::size_t> nodePath;
+    while (true)
+    {
+      SeekTo(this->nodeTableOffset + nodeNumber * SgfcPrivateConstants::GoPositionIndexNodeSize);
+      std::uint32_t parentNodeDistance = SgfcBinaryUtility::ReadUInt32(this->in);
+      std::uint32_t childIndex = SgfcBinaryUtility::ReadUInt32(this->in);
+
+      if (parentNodeDistance == 0)
+        break;
+
+      if (parentNodeDistance > nodeNumber)
+      {
+        std::stringstream message;
+        message << "Go position index file is corrupt, node refers to unknown parent node: " << this->indexFilePath;
+        throw std::runtime_error(message.str());
+      }
+
+      nodePath.push_back(childIndex);
+      nodeNumber -= parentNodeDistance;
+    }
+
+    std::reverse(nodePath.begin(), nodePath.end());
+
+    return nodePath;
+  }
+
+  void SgfcGoPositionIndex::SeekTo(std::uint64_t offset) const
+  {
+    // A previous read may have hit the end of the file
+    this->in.clear();
+    this->in.seekg(static_cast<std::streamoff>(offset));
+    if (! this->in.good())
+    {
+      std::stringstream message;
+      message << "Failed to seek in file: " << this->indexFilePath;
+      throw std::runtime_error(message.str());
+    }
+  }
+}
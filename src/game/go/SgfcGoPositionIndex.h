@@ -0,0 +1,75 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../../include/ISgfcGoPositionIndex.h"
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcGoPositionIndex class provides an implementation of the
+  /// ISgfcGoPositionIndex interface. See the interface header file for
+  /// documentation.
+  ///
+  /// @ingroup internals
+  /// @ingroup go
+  ///
+  /// SgfcGoPositionIndex keeps the index file open for the lifetime of the
+  /// object. Access to the file is serialized with a mutex.
+  class SgfcGoPositionIndex : public ISgfcGoPositionIndex
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcGoPositionIndex object that
+    /// reads the index file located at @a indexFilePath.
+    ///
+    /// @exception std::runtime_error Is thrown if @a indexFilePath cannot be
+    /// opened for reading, or if the file is not an index file in a format
+    /// supported by the library.
+    SgfcGoPositionIndex(const std::string& indexFilePath);
+
+    /// @brief Destroys and cleans up the SgfcGoPositionIndex object.
+    virtual ~SgfcGoPositionIndex();
+
+    virtual bool IsCanonical() const override;
+    virtual std::size_t GetNumberOfEntries() const override;
+    virtual std::vector<std::string> GetFilePaths() const override;
+    virtual std::vector<SgfcGoPositionIndexEntry> FindPositions(std::uint64_t hash) const override;
+    virtual std::vector<SgfcGoPositionIndexEntry> FindPositions(const ISgfcGoPosition& goPosition) const override;
+
+  private:
+    std::string indexFilePath;
+    bool isCanonical;
+    std::uint64_t numberOfEntries;
+    std::uint64_t entryTableOffset;
+    std::uint64_t numberOfNodes;
+    std::uint64_t nodeTableOffset;
+    std::vector<std::string> filePaths;
+
+    mutable std::ifstream in;
+    mutable std::mutex inMutex;
+
+    std::uint64_t ReadEntryHash(std::uint64_t entryIndex) const;
+    SgfcGoPositionIndexEntry ReadEntry(std::uint64_t entryIndex) const;
+    std::vector<std::size_t> ReadNodePath(std::uint64_t nodeNumber) const;
+    void SeekTo(std::uint64_t offset) const;
+  };
+}
@@ -0,0 +1,382 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../SgfcBinaryUtility.h"
+#include "../../SgfcPrivateConstants.h"
+#include "../../SgfcUtility.h"
+#include "SgfcGoPositionIndexFileWriter.h"
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcGoPositionIndexFileWriter::SgfcGoPositionIndexFileWriter(
+    bool useCanonicalHashes,
+    std::size_t maximumRunSize,
+    std::size_t maximumMergeWidth)
+    : useCanonicalHashes(useCanonicalHashes)
+    , maximumRunSize(maximumRunSize)
+    , maximumMergeWidth(maximumMergeWidth)
+    , numberOfRecords(0)
+    , numberOfNodes(0)
+    , indexFileWasWritten(false)
+    , nodeTableFilePath(SgfcUtility::GetUniqueTempFilePath())
+  {
+    if (maximumRunSize == 0)
+      throw std::invalid_argument("SgfcGoPositionIndexFileWriter constructor failed: Maximum run size is 0");
+    if (maximumMergeWidth < 2)
+      throw std::invalid_argument("SgfcGoPositionIndexFileWriter constructor failed: Maximum merge width is less than 2");
+
+    this->nodeTableStream.open(std::filesystem::u8path(this->nodeTableFilePath), std::ios::binary | std::ios::trunc);
+    if (! this->nodeTableStream.is_open())
+    {
+      std::stringstream message;
+      message << "Failed to open file for writing: " << this->nodeTableFilePath;
+      throw std::runtime_error(message.str());
+    }
+  }
+
+  SgfcGoPositionIndexFileWriter::~SgfcGoPositionIndexFileWriter()
+  {
+    // Errors are ignored because a destructor must not throw
+    std::error_code errorCode;
+
+    this->nodeTableStream.close();
+    std::filesystem::remove(std::filesystem::u8path(this->nodeTableFilePath), errorCode);
+
+    for (const auto& sortedRun : this->sortedRuns)
+      std::filesystem::remove(std::filesystem::u8path(sortedRun.FilePath), errorCode);
+  }
+
+  void SgfcGoPositionIndexFileWriter::AddRecords(
+    const std::vector<SgfcGoPositionIndexRecord>& records,
+    const std::vector<SgfcGoPositionIndexNode>& nodes)
+  {
+    // Parent references are stored as distances, so the nodes can be
+    // appended without renumbering
+    for (const auto& node : nodes)
+    {
+      SgfcBinaryUtility::WriteUInt32(this->nodeTableStream, node.ParentNodeDistance);
+      SgfcBinaryUtility::WriteUInt32(this->nodeTableStream, node.ChildIndex);
+    }
+
+    ThrowIfWriteFailed(this->nodeTableStream, this->nodeTableFilePath);
+
+    for (const auto& record : records)
+    {
+      this->currentRun.push_back(record);
+      this->currentRun.back().NodeNumber += this->numberOfNodes;
+
+      if (this->currentRun.size() >= this->maximumRunSize)
+        WriteCurrentRun();
+    }
+
+    this->numberOfRecords += records.size();
+    this->numberOfNodes += nodes.size();
+  }
+
+  std::uint64_t SgfcGoPositionIndexFileWriter::GetNumberOfRecords() const
+  {
+    return this->numberOfRecords;
+  }
+
+  std::size_t SgfcGoPositionIndexFileWriter::GetNumberOfSortedRuns() const
+  {
+    return this->sortedRuns.size();
+  }
+
+  void SgfcGoPositionIndexFileWriter::WriteIndexFile(const std::string& indexFilePath, const std::vector<std::string>& filePaths)
+  {
+    if (this->indexFileWasWritten)
+      throw std::logic_error("WriteIndexFile failed: Index file was already written");
+    this->indexFileWasWritten = true;
+
+    if (this->sortedRuns.empty())
+    {
+      SortCurrentRun();
+    }
+    else
+    {
+      if (! this->currentRun.empty())
+        WriteCurrentRun();
+
+      // Merging consecutive runs keeps records with the same hash in the
+      // order in which they were added
+      while (this->sortedRuns.size() > this->maximumMergeWidth)
+      {
+        std::vector<SortedRun> mergedRuns;
+        for (std::size_t firstRunIndex = 0; firstRunIndex < this->sortedRuns.size(); firstRunIndex += this->maximumMergeWidth)
+        {
+          std::size_t numberOfRuns = std::min(this->maximumMergeWidth, this->sortedRuns.size() - firstRunIndex);
+          mergedRuns.push_back(MergeSortedRuns(firstRunIndex, numberOfRuns));
+        }
+
+        std::error_code errorCode;
+        for (const auto& sortedRun : this->sortedRuns)
+          std::filesystem::remove(std::filesystem::u8path(sortedRun.FilePath), errorCode);
+
+        this->sortedRuns = std::move(mergedRuns);
+      }
+    }
+
+    this->nodeTableStream.close();
+    ThrowIfWriteFailed(this->nodeTableStream, this->nodeTableFilePath);
+
+    std::ofstream out(std::filesystem::u8path(indexFilePath), std::ios::binary | std::ios::trunc);
+    if (! out.is_open())
+    {
+      std::stringstream message;
+      message << "Failed to open file for writing: " << indexFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    std::uint64_t fileTableSize = 0;
+    for (const auto& filePath : filePaths)
+      fileTableSize += 4 + filePath.size();
+
+    std::uint64_t fileTableOffset = SgfcPrivateConstants::GoPositionIndexHeaderSize;
+    std::uint64_t entryTableOffset = fileTableOffset + fileTableSize;
+    std::uint64_t nodeTableOffset = entryTableOffset + this->numberOfRecords * SgfcPrivateConstants::GoPositionIndexEntrySize;
+
+    out.write(SgfcPrivateConstants::GoPositionIndexMagic.data(), SgfcPrivateConstants::GoPositionIndexMagic.size());
+    SgfcBinaryUtility::WriteUInt32(out, SgfcPrivateConstants::GoPositionIndexFormatVersion);
+    SgfcBinaryUtility::WriteUInt32(out, this->useCanonicalHashes ? SgfcPrivateConstants::GoPositionIndexFlagCanonical : 0);
+    SgfcBinaryUtility::WriteUInt64(out, filePaths.size());
+    SgfcBinaryUtility::WriteUInt64(out, this->numberOfRecords);
+    SgfcBinaryUtility::WriteUInt64(out, this->numberOfNodes);
+    SgfcBinaryUtility::WriteUInt64(out, fileTableOffset);
+    SgfcBinaryUtility::WriteUInt64(out, entryTableOffset);
+    SgfcBinaryUtility::WriteUInt64(out, nodeTableOffset);
+
+    for (const auto& filePath : filePaths)
+      SgfcBinaryUtility::WriteString(out, filePath);
+
+    if (this->sortedRuns.empty())
+    {
+      for (const auto& record : this->currentRun)
+        WriteRecord(out, record);
+      this->currentRun.clear();
+    }
+    else
+    {
+      MergeSortedRuns(0, this->sortedRuns.size(), out, indexFilePath);
+    }
+
+    CopyNodeTable(out, indexFilePath);
+
+    ThrowIfWriteFailed(out, indexFilePath);
+  }
+
+  void SgfcGoPositionIndexFileWriter::SortCurrentRun()
+  {
+    // A stable sort keeps records with the same hash in the order in which
+    // they were added
+    std::stable_sort(
+      this->currentRun.begin(),
+      this->currentRun.end(),
+      [](const SgfcGoPositionIndexRecord& record1, const SgfcGoPositionIndexRecord& record2)
+      {
+        return record1.Hash < record2.Hash;
+      });
+  }
+
+  void SgfcGoPositionIndexFileWriter::WriteCurrentRun()
+  {
+    SortCurrentRun();
+
+    SortedRun sortedRun;
+    sortedRun.FilePath = SgfcUtility::GetUniqueTempFilePath();
+    sortedRun.NumberOfRecords = this->currentRun.size();
+
+    // Register the run before writing so that the destructor deletes the
+    // file even if writing fails
+    this->sortedRuns.push_back(sortedRun);
+
+    std::ofstream out(std::filesystem::u8path(sortedRun.FilePath), std::ios::binary | std::ios::trunc);
+    if (! out.is_open())
+    {
+      std::stringstream message;
+      message << "Failed to open file for writing: " << sortedRun.FilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    for (const auto& record : this->currentRun)
+      WriteRecord(out, record);
+
+    out.close();
+    ThrowIfWriteFailed(out, sortedRun.FilePath);
+
+    // clear() keeps the capacity, the next run has the same size
+    this->currentRun.clear();
+  }
+
+  SgfcGoPositionIndexFileWriter::SortedRun SgfcGoPositionIndexFileWriter::MergeSortedRuns(
+    std::size_t firstRunIndex,
+    std::size_t numberOfRuns) const
+  {
+    SortedRun mergedRun;
+    mergedRun.FilePath = SgfcUtility::GetUniqueTempFilePath();
+    for (std::size_t runIndex = firstRunIndex; runIndex < firstRunIndex + numberOfRuns; runIndex++)
+      mergedRun.NumberOfRecords += this->sortedRuns[runIndex].NumberOfRecords;
+
+    std::ofstream out(std::filesystem::u8path(mergedRun.FilePath), std::ios::binary | std::ios::trunc);
+    if (! out.is_open())
+    {
+      std::stringstream message;
+      message << "Failed to open file for writing: " << mergedRun.FilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    try
+    {
+      MergeSortedRuns(firstRunIndex, numberOfRuns, out, mergedRun.FilePath);
+
+      out.close();
+      ThrowIfWriteFailed(out, mergedRun.FilePath);
+    }
+    catch (...)
+    {
+      out.close();
+      std::error_code errorCode;
+      std::filesystem::remove(std::filesystem::u8path(mergedRun.FilePath), errorCode);
+      throw;
+    }
+
+    return mergedRun;
+  }
+
+  void SgfcGoPositionIndexFileWriter::MergeSortedRuns(
+    std::size_t firstRunIndex,
+    std::size_t numberOfRuns,
+    std::ostream& out,
+    const std::string& outFilePath) const
+  {
+    std::vector<std::unique_ptr<std::ifstream>> runStreams;
+    std::vector<std::uint64_t> numberOfRecordsLeft;
+    for (std::size_t runIndex = firstRunIndex; runIndex < firstRunIndex + numberOfRuns; runIndex++)
+    {
+      const SortedRun& sortedRun = this->sortedRuns[runIndex];
+
+      auto runStream = std::make_unique<std::ifstream>(std::filesystem::u8path(sortedRun.FilePath), std::ios::binary);
+      if (! runStream->is_open())
+      {
+        std::stringstream message;
+        message << "Failed to open file for reading: " << sortedRun.FilePath;
+        throw std::runtime_error(message.str());
+      }
+
+      runStreams.push_back(std::move(runStream));
+      numberOfRecordsLeft.push_back(sortedRun.NumberOfRecords);
+    }
+
+    // The queue holds the next record of every run that is not yet
+    // exhausted. Records with the same hash are taken from the run with the
+    // lower index first, so the merge is stable.
+    typedef std::pair<SgfcGoPositionIndexRecord, std::size_t> RecordFromRun;
+    auto isMergedLater = [](const RecordFromRun& recordFromRun1, const RecordFromRun& recordFromRun2)
+    {
+      if (recordFromRun1.first.Hash != recordFromRun2.first.Hash)
+        return recordFromRun1.first.Hash > recordFromRun2.first.Hash;
+      else
+        return recordFromRun1.second > recordFromRun2.second;
+    };
+    std::priority_queue<RecordFromRun, std::vector<RecordFromRun>, decltype(isMergedLater)> nextRecords(isMergedLater);
+
+    auto readNextRecord = [&](std::size_t runIndex)
+    {
+      if (numberOfRecordsLeft[runIndex] == 0)
+        return;
+
+      numberOfRecordsLeft[runIndex]--;
+      nextRecords.emplace(ReadRecord(*runStreams[runIndex]), runIndex);
+    };
+
+    for (std::size_t runIndex = 0; runIndex < runStreams.size(); runIndex++)
+      readNextRecord(runIndex);
+
+    while (! nextRecords.empty())
+    {
+      RecordFromRun recordFromRun = nextRecords.top();
+      nextRecords.pop();
+
+      WriteRecord(out, recordFromRun.first);
+      readNextRecord(recordFromRun.second);
+    }
+
+    ThrowIfWriteFailed(out, outFilePath);
+  }
+
+  void SgfcGoPositionIndexFileWriter::CopyNodeTable(std::ostream& out, const std::string& outFilePath)
+  {
+    // operator<< sets the failbit of the output stream if it does not
+    // insert any characters
+    if (this->numberOfNodes == 0)
+      return;
+
+    std::ifstream in(std::filesystem::u8path(this->nodeTableFilePath), std::ios::binary);
+    if (! in.is_open())
+    {
+      std::stringstream message;
+      message << "Failed to open file for reading: " << this->nodeTableFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    out << in.rdbuf();
+
+    ThrowIfWriteFailed(out, outFilePath);
+  }
+
+  void SgfcGoPositionIndexFileWriter::WriteRecord(std::ostream& out, const SgfcGoPositionIndexRecord& record)
+  {
+    // Records are written in the layout of an entry of the index file, so
+    // that sorted runs can be merged directly into the index file
+    SgfcBinaryUtility::WriteUInt64(out, record.Hash);
+    SgfcBinaryUtility::WriteUInt32(out, record.FileIndex);
+    SgfcBinaryUtility::WriteUInt32(out, record.GameIndex);
+    SgfcBinaryUtility::WriteUInt64(out, record.NodeNumber);
+  }
+
+  SgfcGoPositionIndexRecord SgfcGoPositionIndexFileWriter::ReadRecord(std::istream& in)
+  {
+    SgfcGoPositionIndexRecord record;
+    record.Hash = SgfcBinaryUtility::ReadUInt64(in);
+    record.FileIndex = SgfcBinaryUtility::ReadUInt32(in);
+    record.GameIndex = SgfcBinaryUtility::ReadUInt32(in);
+    record.NodeNumber = SgfcBinaryUtility::ReadUInt64(in);
+
+    return record;
+  }
+
+  void SgfcGoPositionIndexFileWriter::ThrowIfWriteFailed(const std::ostream& out, const std::string& filePath)
+  {
+    if (! out.good())
+    {
+      std::stringstream message;
+      message << "Failed to write file: " << filePath;
+      throw std::runtime_error(message.str());
+    }
+  }
+}
@@ -0,0 +1,127 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "SgfcGoPositionIndexNode.h"
+#include "SgfcGoPositionIndexRecord.h"
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcGoPositionIndexFileWriter class writes a Go position
+  /// index file from records and nodes that are added to it in batches.
+  ///
+  /// @ingroup internals
+  /// @ingroup go
+  ///
+  /// SgfcGoPositionIndexFileWriter does not keep all records in memory. Nodes
+  /// are streamed to a temporary file as they are added. Records are
+  /// collected until SgfcGoPositionIndexFileWriter has a run of the maximum
+  /// run size, then the run is sorted by hash and written to a temporary
+  /// file. When the index file is written the sorted runs are merged. If
+  /// there are more runs than the maximum merge width, groups of runs are
+  /// first merged into larger runs. If all records fit into a single run
+  /// they are sorted and written without temporary files.
+  ///
+  /// Records with the same hash keep the order in which they were added.
+  ///
+  /// Temporary files are deleted when the SgfcGoPositionIndexFileWriter
+  /// object is destroyed.
+  class SgfcGoPositionIndexFileWriter
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcGoPositionIndexFileWriter
+    /// object. The index is marked as being keyed by canonical hashes if
+    /// @a useCanonicalHashes is true. The writer sorts at most
+    /// @a maximumRunSize records in memory and merges at most
+    /// @a maximumMergeWidth runs at the same time.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a maximumRunSize is 0
+    /// or if @a maximumMergeWidth is less than 2.
+    SgfcGoPositionIndexFileWriter(
+      bool useCanonicalHashes,
+      std::size_t maximumRunSize,
+      std::size_t maximumMergeWidth);
+
+    /// @brief Destroys and cleans up the SgfcGoPositionIndexFileWriter
+    /// object. Deletes all temporary files.
+    virtual ~SgfcGoPositionIndexFileWriter();
+
+    /// @brief Adds @a records and @a nodes to the index. The node numbers of
+    /// @a records and the parent references of @a nodes refer to the nodes
+    /// in @a nodes, i.e. they are numbered from 0 for every call.
+    ///
+    /// @exception std::runtime_error Is thrown if writing to a temporary
+    /// file fails.
+    void AddRecords(
+      const std::vector<SgfcGoPositionIndexRecord>& records,
+      const std::vector<SgfcGoPositionIndexNode>& nodes);
+
+    /// @brief Returns the number of records that have been added so far.
+    std::uint64_t GetNumberOfRecords() const;
+
+    /// @brief Returns the number of sorted runs that have been written to
+    /// temporary files so far.
+    std::size_t GetNumberOfSortedRuns() const;
+
+    /// @brief Writes an index file with the file table @a filePaths and all
+    /// records and nodes that have been added so far to @a indexFilePath.
+    /// Can be invoked only once.
+    ///
+    /// @exception std::logic_error Is thrown if the method is invoked more
+    /// than once.
+    /// @exception std::runtime_error Is thrown if @a indexFilePath cannot be
+    /// opened for writing, or if writing to the file or to a temporary file
+    /// fails.
+    void WriteIndexFile(const std::string& indexFilePath, const std::vector<std::string>& filePaths);
+
+  private:
+    struct SortedRun
+    {
+      std::string FilePath;
+      std::uint64_t NumberOfRecords = 0;
+    };
+
+    bool useCanonicalHashes;
+    std::size_t maximumRunSize;
+    std::size_t maximumMergeWidth;
+    std::uint64_t numberOfRecords;
+    std::uint64_t numberOfNodes;
+    bool indexFileWasWritten;
+    std::vector<SgfcGoPositionIndexRecord> currentRun;
+    std::vector<SortedRun> sortedRuns;
+    std::string nodeTableFilePath;
+    std::ofstream nodeTableStream;
+
+    void SortCurrentRun();
+    void WriteCurrentRun();
+    SortedRun MergeSortedRuns(std::size_t firstRunIndex, std::size_t numberOfRuns) const;
+    void MergeSortedRuns(std::size_t firstRunIndex, std::size_t numberOfRuns, std::ostream& out, const std::string& outFilePath) const;
+    void CopyNodeTable(std::ostream& out, const std::string& outFilePath);
+
+    static void WriteRecord(std::ostream& out, const SgfcGoPositionIndexRecord& record);
+    static SgfcGoPositionIndexRecord ReadRecord(std::istream& in);
+    static void ThrowIfWriteFailed(const std::ostream& out, const std::string& filePath);
+  };
+}
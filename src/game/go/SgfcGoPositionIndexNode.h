@@ -0,0 +1,46 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// C++ Standard Library includes
+#include <cstdint>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcGoPositionIndexNode struct is a simple type that holds
+  /// the data of one entry of the node table of a Go position index.
+  ///
+  /// @ingroup internals
+  /// @ingroup go
+  ///
+  /// The node table contains one entry for every node of every game in the
+  /// index. Each entry refers to its parent node, so the path from the root
+  /// node to any node can be reconstructed by following the parent
+  /// references. This keeps the size of the node table proportional to the
+  /// number of nodes, instead of storing a full path for every node.
+  struct SgfcGoPositionIndexNode
+  {
+  public:
+    /// @brief The difference between the number of the node and the number
+    /// of its parent node. The parent node always has the smaller number.
+    /// 0 denotes a root node.
+    std::uint32_t ParentNodeDistance = 0;
+    /// @brief The 0-based index of the node in the collection of child nodes
+    /// of its parent node. Has no meaning for a root node.
+    std::uint32_t ChildIndex = 0;
+  };
+}
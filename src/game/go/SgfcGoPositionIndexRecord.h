@@ -0,0 +1,44 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// C++ Standard Library includes
+#include <cstdint>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcGoPositionIndexRecord struct is a simple type that holds
+  /// the data of one entry of a Go position index while the index is being
+  /// built by SgfcGoPositionIndexWriter.
+  ///
+  /// @ingroup internals
+  /// @ingroup go
+  struct SgfcGoPositionIndexRecord
+  {
+  public:
+    /// @brief The Zobrist hash (plain or canonical) of the position.
+    std::uint64_t Hash = 0;
+    /// @brief The index of the SGF file in the index's file table.
+    std::uint32_t FileIndex = 0;
+    /// @brief The 0-based index of the game in the SGF file.
+    std::uint32_t GameIndex = 0;
+    /// @brief The number of the node at which the position occurs, i.e. the
+    /// position of the node in the index's node table. See
+    /// SgfcGoPositionIndexNode.
+    std::uint64_t NodeNumber = 0;
+  };
+}
@@ -0,0 +1,225 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../../include/ISgfcDocument.h"
+#include "../../../include/ISgfcDocumentReader.h"
+#include "../../../include/ISgfcDocumentReadResult.h"
+#include "../../../include/ISgfcGame.h"
+#include "../../../include/ISgfcGoGameInfo.h"
+#include "../../../include/ISgfcNode.h"
+#include "../../../include/SgfcPlusPlusFactory.h"
+#include "../../SgfcParallelUtility.h"
+#include "../../SgfcPrivateConstants.h"
+#include "../../SgfcUtility.h"
+#include "SgfcGoPositionIndexFileWriter.h"
+#include "SgfcGoPositionIndexWriter.h"
+#include "SgfcGoReplayEngine.h"
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcGoPositionIndexWriter::SgfcGoPositionIndexWriter()
+    : useCanonicalHashes(false)
+    , numberOfThreads(0)
+  {
+  }
+
+  SgfcGoPositionIndexWriter::~SgfcGoPositionIndexWriter()
+  {
+  }
+
+  bool SgfcGoPositionIndexWriter::GetUseCanonicalHashes() const
+  {
+    return this->useCanonicalHashes;
+  }
+
+  void SgfcGoPositionIndexWriter::SetUseCanonicalHashes(bool useCanonicalHashes)
+  {
+    this->useCanonicalHashes = useCanonicalHashes;
+  }
+
+  unsigned int SgfcGoPositionIndexWriter::GetNumberOfThreads() const
+  {
+    return this->numberOfThreads;
+  }
+
+  void SgfcGoPositionIndexWriter::SetNumberOfThreads(unsigned int numberOfThreads)
+  {
+    this->numberOfThreads = numberOfThreads;
+  }
+
+  std::size_t SgfcGoPositionIndexWriter::WriteIndex(const std::string& sgfDirectoryPath, const std::string& indexFilePath) const
+  {
+    std::vector<std::string> filePaths = SgfcUtility::GetSgfFilePathsInDirectory(sgfDirectoryPath);
+
+    unsigned int numberOfWorkerThreads = SgfcParallelUtility::GetNumberOfWorkerThreads(
+      this->numberOfThreads,
+      filePaths.size());
+
+    std::vector<std::shared_ptr<ISgfcDocumentReader>> documentReaders(numberOfWorkerThreads);
+    bool useCanonicalHashes = this->useCanonicalHashes;
+
+    SgfcGoPositionIndexFileWriter fileWriter(
+      useCanonicalHashes,
+      SgfcPrivateConstants::GoPositionIndexMaximumRunSize,
+      SgfcPrivateConstants::GoPositionIndexMaximumMergeWidth);
+
+    // Files are processed in batches so that only the records of one batch
+    // are held in memory. Within a batch each file gets its own slot so that
+    // the worker threads never write to the same vector, and so that the
+    // records can be handed to the file writer in file order afterwards.
+    std::size_t batchSize = static_cast<std::size_t>(numberOfWorkerThreads) * SgfcPrivateConstants::GoPositionIndexBatchSizePerWorkerThread;
+    for (std::size_t firstFileIndex = 0; firstFileIndex < filePaths.size(); firstFileIndex += batchSize)
+    {
+      std::size_t numberOfFilesInBatch = std::min(batchSize, filePaths.size() - firstFileIndex);
+      std::vector<std::vector<SgfcGoPositionIndexRecord>> recordsPerFile(numberOfFilesInBatch);
+      std::vector<std::vector<SgfcGoPositionIndexNode>> nodesPerFile(numberOfFilesInBatch);
+
+      SgfcParallelUtility::ForEach(
+        numberOfFilesInBatch,
+        numberOfWorkerThreads,
+        [&](std::size_t batchFileIndex, unsigned int workerThreadIndex)
+        {
+          auto& documentReader = documentReaders[workerThreadIndex];
+          if (documentReader == nullptr)
+            documentReader = SgfcPlusPlusFactory::CreateDocumentReader();
+
+          std::size_t fileIndex = firstFileIndex + batchFileIndex;
+          auto readResult = documentReader->ReadSgfFile(filePaths[fileIndex]);
+          if (readResult->GetExitCode() == SgfcExitCode::FatalError)
+            return;
+
+          auto games = readResult->GetDocument()->GetGames();
+          for (std::size_t gameIndex = 0; gameIndex < games.size(); gameIndex++)
+          {
+            AddGameRecords(
+              *games[gameIndex],
+              static_cast<std::uint32_t>(fileIndex),
+              static_cast<std::uint32_t>(gameIndex),
+              useCanonicalHashes,
+              recordsPerFile[batchFileIndex],
+              nodesPerFile[batchFileIndex]);
+          }
+        });
+
+      for (std::size_t batchFileIndex = 0; batchFileIndex < numberOfFilesInBatch; batchFileIndex++)
+        fileWriter.AddRecords(recordsPerFile[batchFileIndex], nodesPerFile[batchFileIndex]);
+    }
+
+    fileWriter.WriteIndexFile(indexFilePath, filePaths);
+
+    return static_cast<std::size_t>(fileWriter.GetNumberOfRecords());
+  }
+
+  void SgfcGoPositionIndexWriter::AddGameRecords(
+    const ISgfcGame& game,
+    std::uint32_t fileIndex,
+    std::uint32_t gameIndex,
+    bool useCanonicalHashes,
+    std::vector<SgfcGoPositionIndexRecord>& records,
+    std::vector<SgfcGoPositionIndexNode>& nodes)
+  {
+    if (! game.HasRootNode() || game.GetGameType() != SgfcGameType::Go)
+      return;
+
+    SgfcBoardSize boardSize = game.GetBoardSize();
+    if (! boardSize.IsValid(SgfcGameType::Go))
+      return;
+
+    SgfcGoRuleset goRuleset = game.CreateGameInfo()->ToGoGameInfo()->GetGoRuleset();
+
+    // The game tree is traversed depth-first without recursion, because game
+    // trees can be too deep for the call stack. The replay engine is copied
+    // only when a variation branches off, so that each variation continues
+    // from the position at the branch point. A variation remembers only the
+    // number of its parent node and its child index, the path from the root
+    // node is implied by the parent references in the node table.
+    struct PendingVariation
+    {
+      std::shared_ptr<ISgfcNode> FirstNode;
+      std::size_t ParentNodeNumber;
+      std::uint32_t ChildIndex;
+      SgfcGoReplayEngine GoReplayEngine;
+    };
+
+    // The root node has no parent node. Its parent node number is the number
+    // that the root node itself gets, which results in a distance of 0.
+    std::vector<PendingVariation> pendingVariations;
+    pendingVariations.push_back({ game.GetRootNode(), nodes.size(), 0, SgfcGoReplayEngine(boardSize, goRuleset) });
+
+    while (! pendingVariations.empty())
+    {
+      std::shared_ptr<ISgfcNode> node = std::move(pendingVariations.back().FirstNode);
+      std::size_t parentNodeNumber = pendingVariations.back().ParentNodeNumber;
+      std::uint32_t childIndex = pendingVariations.back().ChildIndex;
+      SgfcGoReplayEngine goReplayEngine = std::move(pendingVariations.back().GoReplayEngine);
+      pendingVariations.pop_back();
+
+      while (node != nullptr)
+      {
+        std::size_t nodeNumber = nodes.size();
+
+        SgfcGoPositionIndexNode indexNode;
+        indexNode.ParentNodeDistance = static_cast<std::uint32_t>(nodeNumber - parentNodeNumber);
+        indexNode.ChildIndex = childIndex;
+        nodes.push_back(indexNode);
+
+        goReplayEngine.ApplyNode(node);
+
+        const SgfcGoPosition& goPosition = goReplayEngine.GetCurrentPosition();
+        if (goPosition.GetNumberOfStones(SgfcColor::Black) > 0 || goPosition.GetNumberOfStones(SgfcColor::White) > 0)
+        {
+          SgfcGoPositionIndexRecord record;
+          record.Hash = useCanonicalHashes ? goPosition.GetCanonicalZobristHash() : goPosition.GetZobristHash();
+          record.FileIndex = fileIndex;
+          record.GameIndex = gameIndex;
+          record.NodeNumber = nodeNumber;
+          records.push_back(record);
+        }
+
+        auto children = node->GetChildren();
+        if (children.empty())
+          break;
+
+        // Don't copy the position history into every pending variation,
+        // share it. Otherwise memory would grow with the number of pending
+        // variations times the depth of the game tree.
+        if (children.size() > 1)
+          goReplayEngine.SharePositionHistory();
+
+        // Variations are pushed in reverse order so that they are popped,
+        // and therefore visited, in their natural order
+        for (std::size_t variationChildIndex = children.size() - 1; variationChildIndex > 0; variationChildIndex--)
+        {
+          pendingVariations.push_back({
+            children[variationChildIndex],
+            nodeNumber,
+            static_cast<std::uint32_t>(variationChildIndex),
+            goReplayEngine });
+        }
+
+        node = children.front();
+        parentNodeNumber = nodeNumber;
+        childIndex = 0;
+      }
+    }
+  }
+}
@@ -0,0 +1,87 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../../include/ISgfcGoPositionIndexWriter.h"
+#include "SgfcGoPositionIndexNode.h"
+#include "SgfcGoPositionIndexRecord.h"
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcGame;
+
+  /// @brief The SgfcGoPositionIndexWriter class provides an implementation of
+  /// the ISgfcGoPositionIndexWriter interface. See the interface header file
+  /// for documentation.
+  ///
+  /// @ingroup internals
+  /// @ingroup go
+  ///
+  /// The index file consists of a header, followed by a table of SGF file
+  /// paths, a table of entries sorted by hash, and a table of nodes. The
+  /// entry table has fixed-size entries so that SgfcGoPositionIndex can
+  /// locate entries with a binary search. Each entry refers to a node in the
+  /// node table, and each node refers to its parent node, so that the node
+  /// path of an entry can be reconstructed without storing the full path for
+  /// every entry. See SgfcPrivateConstants for the layout of the header, of
+  /// an entry and of a node.
+  ///
+  /// SGF files are read in batches so that only the records of one batch are
+  /// in memory at the same time. SgfcGoPositionIndexFileWriter sorts the
+  /// records in bounded-size runs and merges the runs when the index file is
+  /// written.
+  class SgfcGoPositionIndexWriter : public ISgfcGoPositionIndexWriter
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcGoPositionIndexWriter
+    /// object.
+    SgfcGoPositionIndexWriter();
+
+    /// @brief Destroys and cleans up the SgfcGoPositionIndexWriter object.
+    virtual ~SgfcGoPositionIndexWriter();
+
+    virtual bool GetUseCanonicalHashes() const override;
+    virtual void SetUseCanonicalHashes(bool useCanonicalHashes) override;
+    virtual unsigned int GetNumberOfThreads() const override;
+    virtual void SetNumberOfThreads(unsigned int numberOfThreads) override;
+    virtual std::size_t WriteIndex(const std::string& sgfDirectoryPath, const std::string& indexFilePath) const override;
+
+    /// @brief Replays all variations of @a game, adds a node to @a nodes for
+    /// every node of @a game, and adds a record for every node at which at
+    /// least one stone is on the board to @a records. The node numbers of the
+    /// records refer to @a nodes. Does nothing if @a game is not a Go game,
+    /// or if @a game has no valid board size.
+    static void AddGameRecords(
+      const ISgfcGame& game,
+      std::uint32_t fileIndex,
+      std::uint32_t gameIndex,
+      bool useCanonicalHashes,
+      std::vector<SgfcGoPositionIndexRecord>& records,
+      std::vector<SgfcGoPositionIndexNode>& nodes);
+
+  private:
+    bool useCanonicalHashes;
+    unsigned int numberOfThreads;
+  };
+}
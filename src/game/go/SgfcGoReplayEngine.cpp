@@ -0,0 +1,492 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../../include/ISgfcComposedPropertyValue.h"
+#include "../../../include/ISgfcGoMove.h"
+#include "../../../include/ISgfcGoMovePropertyValue.h"
+#include "../../../include/ISgfcGoPoint.h"
+#include "../../../include/ISgfcGoPointPropertyValue.h"
+#include "../../../include/ISgfcGoStone.h"
+#include "../../../include/ISgfcGoStonePropertyValue.h"
+#include "../../../include/ISgfcMovePropertyValue.h"
+#include "../../../include/ISgfcNode.h"
+#include "../../../include/ISgfcPointPropertyValue.h"
+#include "../../../include/ISgfcProperty.h"
+#include "../../../include/ISgfcSinglePropertyValue.h"
+#include "../../../include/ISgfcStonePropertyValue.h"
+#include "SgfcGoReplayEngine.h"
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <stdexcept>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcGoReplayEngine::SgfcGoReplayEngine(SgfcBoardSize boardSize, SgfcGoRuleset goRuleset)
+    : boardSize(boardSize)
+    , goRuleset(goRuleset)
+    , isSuicideAllowed(false)
+    , isSuperkoEnabled(false)
+    , position(boardSize)
+    , hasKo(false)
+    , koColor(SgfcColor::Black)
+    , koColumn(0)
+    , koRow(0)
+  {
+    if (! boardSize.IsValid(SgfcGameType::Go))
+      throw std::invalid_argument("SgfcGoReplayEngine constructor failed: Board size is not valid for Go");
+
+    if (goRuleset.IsValid)
+    {
+      switch (goRuleset.GoRulesetType)
+      {
+        case SgfcGoRulesetType::AGA:
+          this->isSuicideAllowed = false;
+          this->isSuperkoEnabled = true;
+          break;
+        case SgfcGoRulesetType::Ing:
+          this->isSuicideAllowed = true;
+          this->isSuperkoEnabled = false;
+          break;
+        case SgfcGoRulesetType::NZ:
+          this->isSuicideAllowed = true;
+          this->isSuperkoEnabled = true;
+          break;
+        case SgfcGoRulesetType::Japanese:
+        default:
+          this->isSuicideAllowed = false;
+          this->isSuperkoEnabled = false;
+          break;
+      }
+    }
+  }
+
+  SgfcGoReplayEngine::~SgfcGoReplayEngine()
+  {
+  }
+
+  SgfcBoardSize SgfcGoReplayEngine::GetBoardSize() const
+  {
+    return this->boardSize;
+  }
+
+  SgfcGoRuleset SgfcGoReplayEngine::GetGoRuleset() const
+  {
+    return this->goRuleset;
+  }
+
+  void SgfcGoReplayEngine::Reset()
+  {
+    this->position.Clear();
+    this->hasKo = false;
+    this->positionHistory.clear();
+    this->sharedPositionHistory = nullptr;
+  }
+
+  SgfcGoMoveLegality SgfcGoReplayEngine::ApplyNode(std::shared_ptr<ISgfcNode> node)
+  {
+    if (node == nullptr)
+      throw std::invalid_argument("ApplyNode failed: Node is nullptr");
+
+    std::size_t numberOfMoves = 0;
+    return ApplyNode(*node, numberOfMoves);
+  }
+
+  SgfcGoMoveLegality SgfcGoReplayEngine::ApplyGoMove(std::shared_ptr<ISgfcGoMove> goMove)
+  {
+    if (goMove == nullptr)
+      throw std::invalid_argument("ApplyGoMove failed: Go move is nullptr");
+
+    if (! goMove->IsPassMove())
+    {
+      auto stoneLocation = goMove->GetStoneLocation();
+      unsigned int xPosition = stoneLocation->GetXPosition(SgfcCoordinateSystem::UpperLeftOrigin);
+      unsigned int yPosition = stoneLocation->GetYPosition(SgfcCoordinateSystem::UpperLeftOrigin);
+      if (! IsOnBoard(xPosition, yPosition))
+        throw std::invalid_argument("ApplyGoMove failed: Stone location is outside of the board");
+    }
+
+    return PlayGoMove(*goMove);
+  }
+
+  SgfcGoReplayResult SgfcGoReplayEngine::ReplayNodes(const std::vector<std::shared_ptr<ISgfcNode>>& nodes)
+  {
+    for (const auto& node : nodes)
+    {
+      if (node == nullptr)
+        throw std::invalid_argument("ReplayNodes failed: Nodes collection contains nullptr element");
+    }
+
+    Reset();
+
+    SgfcGoReplayResult replayResult;
+
+    for (const auto& node : nodes)
+    {
+      std::size_t numberOfMoves = 0;
+      SgfcGoMoveLegality moveLegality = ApplyNode(*node, numberOfMoves);
+      replayResult.NumberOfMoves += numberOfMoves;
+
+      if (moveLegality != SgfcGoMoveLegality::Legal)
+      {
+        replayResult.MoveLegality = moveLegality;
+        replayResult.IllegalMoveNode = node;
+        break;
+      }
+    }
+
+    return replayResult;
+  }
+
+  SgfcGoReplayResult SgfcGoReplayEngine::ReplayToNode(std::shared_ptr<ISgfcNode> node)
+  {
+    if (node == nullptr)
+      throw std::invalid_argument("ReplayToNode failed: Node is nullptr");
+
+    std::vector<std::shared_ptr<ISgfcNode>> nodes;
+    for (auto currentNode = node; currentNode != nullptr; currentNode = currentNode->GetParent())
+      nodes.push_back(currentNode);
+
+    std::reverse(nodes.begin(), nodes.end());
+
+    return ReplayNodes(nodes);
+  }
+
+  std::shared_ptr<ISgfcGoPosition> SgfcGoReplayEngine::GetPosition() const
+  {
+    return std::shared_ptr<ISgfcGoPosition>(new SgfcGoPosition(this->position));
+  }
+
+  const SgfcGoPosition& SgfcGoReplayEngine::GetCurrentPosition() const
+  {
+    return this->position;
+  }
+
+  void SgfcGoReplayEngine::SharePositionHistory()
+  {
+    if (this->positionHistory.empty())
+      return;
+
+    auto segment = std::make_shared<PositionHistorySegment>();
+    segment->PositionHashes.swap(this->positionHistory);
+    segment->PreviousSegment = this->sharedPositionHistory;
+
+    this->sharedPositionHistory = segment;
+  }
+
+  SgfcGoMoveLegality SgfcGoReplayEngine::ApplyNode(const ISgfcNode& node, std::size_t& numberOfMoves)
+  {
+    static const SgfcPropertyType setupPropertyTypes[] = { SgfcPropertyType::AB, SgfcPropertyType::AW, SgfcPropertyType::AE };
+    static const SgfcPropertyType movePropertyTypes[] = { SgfcPropertyType::B, SgfcPropertyType::W };
+
+    for (auto setupPropertyType : setupPropertyTypes)
+    {
+      if (node.HasProperty(setupPropertyType))
+        ApplySetupProperty(node, setupPropertyType);
+    }
+
+    for (auto movePropertyType : movePropertyTypes)
+    {
+      if (! node.HasProperty(movePropertyType))
+        continue;
+
+      const ISgfcGoMovePropertyValue* goMoveValue = nullptr;
+
+      auto propertyValue = node.GetProperty(movePropertyType)->GetPropertyValue();
+      if (propertyValue != nullptr && ! propertyValue->IsComposedValue())
+      {
+        const ISgfcMovePropertyValue* moveValue = propertyValue->ToSingleValue()->ToMoveValue();
+        if (moveValue != nullptr)
+          goMoveValue = moveValue->ToGoMoveValue();
+      }
+
+      if (goMoveValue == nullptr)
+        return SgfcGoMoveLegality::InvalidMoveValue;
+
+      auto goMove = goMoveValue->GetGoMove();
+      if (! goMove->IsPassMove())
+      {
+        auto stoneLocation = goMove->GetStoneLocation();
+        unsigned int xPosition = stoneLocation->GetXPosition(SgfcCoordinateSystem::UpperLeftOrigin);
+        unsigned int yPosition = stoneLocation->GetYPosition(SgfcCoordinateSystem::UpperLeftOrigin);
+        if (! IsOnBoard(xPosition, yPosition))
+          return SgfcGoMoveLegality::InvalidMoveValue;
+      }
+
+      SgfcGoMoveLegality moveLegality = PlayGoMove(*goMove);
+      if (moveLegality != SgfcGoMoveLegality::Legal)
+        return moveLegality;
+
+      numberOfMoves++;
+    }
+
+    return SgfcGoMoveLegality::Legal;
+  }
+
+  void SgfcGoReplayEngine::ApplySetupProperty(const ISgfcNode& node, SgfcPropertyType propertyType)
+  {
+    for (const auto& propertyValue : node.GetProperty(propertyType)->GetPropertyValues())
+    {
+      if (propertyValue->IsComposedValue())
+      {
+        // A composed value is a rectangle from a compressed point list
+        const ISgfcComposedPropertyValue* composedValue = propertyValue->ToComposedValue();
+        ApplySetupRectangle(*composedValue->GetValue1(), *composedValue->GetValue2(), propertyType);
+      }
+      else
+      {
+        ApplySetupPoint(*propertyValue->ToSingleValue(), propertyType);
+      }
+    }
+
+    // Setup properties change the position arbitrarily, so whatever ko
+    // situation existed before no longer applies
+    this->hasKo = false;
+  }
+
+  void SgfcGoReplayEngine::ApplySetupPoint(const ISgfcSinglePropertyValue& propertyValue, SgfcPropertyType propertyType)
+  {
+    auto goPoint = GetGoPoint(propertyValue);
+    if (goPoint == nullptr)
+      return;
+
+    unsigned int xPosition = goPoint->GetXPosition(SgfcCoordinateSystem::UpperLeftOrigin);
+    unsigned int yPosition = goPoint->GetYPosition(SgfcCoordinateSystem::UpperLeftOrigin);
+    if (! IsOnBoard(xPosition, yPosition))
+      return;
+
+    SetupIntersection(xPosition - 1, yPosition - 1, propertyType);
+  }
+
+  void SgfcGoReplayEngine::ApplySetupRectangle(
+    const ISgfcSinglePropertyValue& cornerValue1,
+    const ISgfcSinglePropertyValue& cornerValue2,
+    SgfcPropertyType propertyType)
+  {
+    auto goPoint1 = GetGoPoint(cornerValue1);
+    auto goPoint2 = GetGoPoint(cornerValue2);
+    if (goPoint1 == nullptr || goPoint2 == nullptr)
+      return;
+
+    unsigned int xPosition1 = goPoint1->GetXPosition(SgfcCoordinateSystem::UpperLeftOrigin);
+    unsigned int yPosition1 = goPoint1->GetYPosition(SgfcCoordinateSystem::UpperLeftOrigin);
+    unsigned int xPosition2 = goPoint2->GetXPosition(SgfcCoordinateSystem::UpperLeftOrigin);
+    unsigned int yPosition2 = goPoint2->GetYPosition(SgfcCoordinateSystem::UpperLeftOrigin);
+    if (! IsOnBoard(xPosition1, yPosition1) || ! IsOnBoard(xPosition2, yPosition2))
+      return;
+
+    unsigned int firstColumn = std::min(xPosition1, xPosition2) - 1;
+    unsigned int lastColumn = std::max(xPosition1, xPosition2) - 1;
+    unsigned int firstRow = std::min(yPosition1, yPosition2) - 1;
+    unsigned int lastRow = std::max(yPosition1, yPosition2) - 1;
+
+    for (unsigned int row = firstRow; row <= lastRow; row++)
+    {
+      for (unsigned int column = firstColumn; column <= lastColumn; column++)
+        SetupIntersection(column, row, propertyType);
+    }
+  }
+
+  void SgfcGoReplayEngine::SetupIntersection(unsigned int column, unsigned int row, SgfcPropertyType propertyType)
+  {
+    this->position.RemoveStone(SgfcColor::Black, column, row);
+    this->position.RemoveStone(SgfcColor::White, column, row);
+
+    if (propertyType == SgfcPropertyType::AB)
+      this->position.AddStone(SgfcColor::Black, column, row);
+    else if (propertyType == SgfcPropertyType::AW)
+      this->position.AddStone(SgfcColor::White, column, row);
+  }
+
+  SgfcGoMoveLegality SgfcGoReplayEngine::PlayGoMove(const ISgfcGoMove& goMove)
+  {
+    if (goMove.IsPassMove())
+    {
+      PlayPassMove();
+      return SgfcGoMoveLegality::Legal;
+    }
+
+    auto stoneLocation = goMove.GetStoneLocation();
+    unsigned int xPosition = stoneLocation->GetXPosition(SgfcCoordinateSystem::UpperLeftOrigin);
+    unsigned int yPosition = stoneLocation->GetYPosition(SgfcCoordinateSystem::UpperLeftOrigin);
+
+    return PlayMove(goMove.GetPlayerColor(), xPosition - 1, yPosition - 1);
+  }
+
+  SgfcGoMoveLegality SgfcGoReplayEngine::PlayMove(SgfcColor color, unsigned int column, unsigned int row)
+  {
+    SgfcColor opponentColor = GetOpponentColor(color);
+
+    if (this->position.GetStones(color).Test(column, row) ||
+        this->position.GetStones(opponentColor).Test(column, row))
+    {
+      return SgfcGoMoveLegality::IntersectionOccupied;
+    }
+
+    if (! this->isSuperkoEnabled &&
+        this->hasKo &&
+        this->koColor == color &&
+        this->koColumn == column &&
+        this->koRow == row)
+    {
+      return SgfcGoMoveLegality::Ko;
+    }
+
+    if (this->isSuperkoEnabled)
+    {
+      // The position before the move is part of the history, regardless of
+      // whether it was created by a move or by setup properties
+      this->positionHistory.insert(GetPositionHash(this->position, color));
+    }
+
+    // Illegal moves must leave the position unchanged, so the move is played
+    // on a copy that is committed only if the move turns out to be legal
+    SgfcGoPosition newPosition = this->position;
+    const SgfcGoBitboard& boardMask = newPosition.GetBoardMask();
+    const SgfcGoBitboard& ownStones = newPosition.GetStones(color);
+    const SgfcGoBitboard& opponentStones = newPosition.GetStones(opponentColor);
+
+    newPosition.AddStone(color, column, row);
+
+    SgfcGoBitboard newStone(static_cast<unsigned int>(this->boardSize.Rows));
+    newStone.Set(column, row);
+    SgfcGoBitboard opponentNeighbors = newStone.GetNeighbors(boardMask) & opponentStones;
+
+    unsigned int numberOfCapturedStones = 0;
+    unsigned int capturedColumn = 0;
+    unsigned int capturedRow = 0;
+
+    unsigned int neighborColumn;
+    unsigned int neighborRow;
+    while (opponentNeighbors.GetFirst(neighborColumn, neighborRow))
+    {
+      SgfcGoBitboard opponentGroup = opponentStones.GetGroup(neighborColumn, neighborRow);
+      opponentNeighbors -= opponentGroup;
+
+      SgfcGoBitboard liberties = opponentGroup.GetNeighbors(boardMask) & newPosition.GetEmptyIntersections();
+      if (! liberties.IsEmpty())
+        continue;
+
+      newPosition.RemoveStones(opponentColor, opponentGroup);
+      numberOfCapturedStones += opponentGroup.Count();
+      capturedColumn = neighborColumn;
+      capturedRow = neighborRow;
+    }
+
+    newPosition.AddCapturedStones(opponentColor, numberOfCapturedStones);
+
+    SgfcGoBitboard ownGroup = ownStones.GetGroup(column, row);
+    SgfcGoBitboard ownLiberties = ownGroup.GetNeighbors(boardMask) & newPosition.GetEmptyIntersections();
+    if (ownLiberties.IsEmpty())
+    {
+      if (! this->isSuicideAllowed)
+        return SgfcGoMoveLegality::Suicide;
+
+      newPosition.RemoveStones(color, ownGroup);
+      newPosition.AddCapturedStones(color, ownGroup.Count());
+    }
+
+    if (this->isSuperkoEnabled)
+    {
+      std::uint64_t newPositionHash = GetPositionHash(newPosition, opponentColor);
+      if (IsInPositionHistory(newPositionHash))
+        return SgfcGoMoveLegality::Superko;
+
+      this->positionHistory.insert(newPositionHash);
+    }
+
+    this->position = newPosition;
+
+    // A ko exists if the move captured exactly one stone, and the capturing
+    // stone is a single stone whose only liberty is the intersection of the
+    // captured stone. The opponent may not immediately recapture there.
+    if (numberOfCapturedStones == 1 && ownGroup.Count() == 1 && ownLiberties.Count() == 1)
+    {
+      this->hasKo = true;
+      this->koColor = opponentColor;
+      this->koColumn = capturedColumn;
+      this->koRow = capturedRow;
+    }
+    else
+    {
+      this->hasKo = false;
+    }
+
+    return SgfcGoMoveLegality::Legal;
+  }
+
+  void SgfcGoReplayEngine::PlayPassMove()
+  {
+    this->hasKo = false;
+  }
+
+  bool SgfcGoReplayEngine::IsOnBoard(unsigned int xPosition, unsigned int yPosition) const
+  {
+    return
+      xPosition >= 1 && xPosition <= this->boardSize.Columns &&
+      yPosition >= 1 && yPosition <= this->boardSize.Rows;
+  }
+
+  bool SgfcGoReplayEngine::IsInPositionHistory(std::uint64_t positionHash) const
+  {
+    if (this->positionHistory.find(positionHash) != this->positionHistory.end())
+      return true;
+
+    for (auto segment = this->sharedPositionHistory.get(); segment != nullptr; segment = segment->PreviousSegment.get())
+    {
+      if (segment->PositionHashes.find(positionHash) != segment->PositionHashes.end())
+        return true;
+    }
+
+    return false;
+  }
+
+  std::uint64_t SgfcGoReplayEngine::GetPositionHash(const SgfcGoPosition& position, SgfcColor colorToMove)
+  {
+    // Arbitrary constant that distinguishes "White to move" from "Black to
+    // move" for the same stones
+    static const std::uint64_t whiteToMoveHash = 0x9e3779b97f4a7c15ULL;
+
+    return position.GetZobristHash() ^ (colorToMove == SgfcColor::White ? whiteToMoveHash : 0);
+  }
+
+  std::shared_ptr<ISgfcGoPoint> SgfcGoReplayEngine::GetGoPoint(const ISgfcSinglePropertyValue& propertyValue)
+  {
+    const ISgfcStonePropertyValue* stoneValue = propertyValue.ToStoneValue();
+    if (stoneValue != nullptr)
+    {
+      const ISgfcGoStonePropertyValue* goStoneValue = stoneValue->ToGoStoneValue();
+      if (goStoneValue != nullptr)
+        return goStoneValue->GetGoStone()->GetLocation();
+    }
+
+    const ISgfcPointPropertyValue* pointValue = propertyValue.ToPointValue();
+    if (pointValue != nullptr)
+    {
+      const ISgfcGoPointPropertyValue* goPointValue = pointValue->ToGoPointValue();
+      if (goPointValue != nullptr)
+        return goPointValue->GetGoPoint();
+    }
+
+    return nullptr;
+  }
+
+  SgfcColor SgfcGoReplayEngine::GetOpponentColor(SgfcColor color)
+  {
+    return color == SgfcColor::Black ? SgfcColor::White : SgfcColor::Black;
+  }
+}
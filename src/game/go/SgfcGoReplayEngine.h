@@ -0,0 +1,128 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../../include/ISgfcGoReplayEngine.h"
+#include "../../../include/SgfcColor.h"
+#include "../../../include/SgfcPropertyType.h"
+#include "SgfcGoPosition.h"
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <memory>
+#include <unordered_set>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcGoPoint;
+  class ISgfcSinglePropertyValue;
+
+  /// @brief The SgfcGoReplayEngine class provides an implementation of the
+  /// ISgfcGoReplayEngine interface. See the interface header file for
+  /// documentation.
+  ///
+  /// @ingroup internals
+  /// @ingroup go
+  class SgfcGoReplayEngine : public ISgfcGoReplayEngine
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcGoReplayEngine object that
+    /// replays moves on a board of size @a boardSize and checks moves for
+    /// legality according to @a goRuleset.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a boardSize is not a
+    /// valid board size for SgfcGameType::Go.
+    SgfcGoReplayEngine(SgfcBoardSize boardSize, SgfcGoRuleset goRuleset);
+
+    /// @brief Destroys and cleans up the SgfcGoReplayEngine object.
+    virtual ~SgfcGoReplayEngine();
+
+    virtual SgfcBoardSize GetBoardSize() const override;
+    virtual SgfcGoRuleset GetGoRuleset() const override;
+    virtual void Reset() override;
+    virtual SgfcGoMoveLegality ApplyNode(std::shared_ptr<ISgfcNode> node) override;
+    virtual SgfcGoMoveLegality ApplyGoMove(std::shared_ptr<ISgfcGoMove> goMove) override;
+    virtual SgfcGoReplayResult ReplayNodes(const std::vector<std::shared_ptr<ISgfcNode>>& nodes) override;
+    virtual SgfcGoReplayResult ReplayToNode(std::shared_ptr<ISgfcNode> node) override;
+    virtual std::shared_ptr<ISgfcGoPosition> GetPosition() const override;
+
+    /// @brief Returns the current position. Unlike GetPosition() this does
+    /// not make a copy of the position.
+    const SgfcGoPosition& GetCurrentPosition() const;
+
+    /// @brief Freezes the position history that was recorded so far for
+    /// superko checks, so that copies of the SgfcGoReplayEngine object
+    /// made after this call share the history instead of copying it. The
+    /// copies record new positions separately.
+    ///
+    /// SgfcGoPositionCache uses this to keep replay checkpoints small, and
+    /// SgfcGoPositionIndexWriter uses this to keep the replay state of
+    /// pending variations small.
+    void SharePositionHistory();
+
+  private:
+    /// @brief A frozen part of the position history. Segments form a chain
+    /// that leads back to the first position after the last reset.
+    struct PositionHistorySegment
+    {
+      std::unordered_set<std::uint64_t> PositionHashes;
+      std::shared_ptr<const PositionHistorySegment> PreviousSegment;
+    };
+
+    SgfcBoardSize boardSize;
+    SgfcGoRuleset goRuleset;
+    bool isSuicideAllowed;
+    bool isSuperkoEnabled;
+
+    SgfcGoPosition position;
+
+    /// @brief True if the basic ko rule currently forbids a move. The
+    /// forbidden move is described by @e koColor, @e koColumn and @e koRow.
+    bool hasKo;
+    SgfcColor koColor;
+    unsigned int koColumn;
+    unsigned int koRow;
+
+    /// @brief Hashes of all positions that occurred since the last reset,
+    /// combined with the color of the player to move. Used to check for
+    /// situational superko. @e positionHistory holds the positions that
+    /// occurred since the last invocation of SharePositionHistory(),
+    /// @e sharedPositionHistory holds the positions that occurred before.
+    std::unordered_set<std::uint64_t> positionHistory;
+    std::shared_ptr<const PositionHistorySegment> sharedPositionHistory;
+
+    SgfcGoMoveLegality ApplyNode(const ISgfcNode& node, std::size_t& numberOfMoves);
+    void ApplySetupProperty(const ISgfcNode& node, SgfcPropertyType propertyType);
+    void ApplySetupPoint(const ISgfcSinglePropertyValue& propertyValue, SgfcPropertyType propertyType);
+    void ApplySetupRectangle(
+      const ISgfcSinglePropertyValue& cornerValue1,
+      const ISgfcSinglePropertyValue& cornerValue2,
+      SgfcPropertyType propertyType);
+    void SetupIntersection(unsigned int column, unsigned int row, SgfcPropertyType propertyType);
+    SgfcGoMoveLegality PlayGoMove(const ISgfcGoMove& goMove);
+    SgfcGoMoveLegality PlayMove(SgfcColor color, unsigned int column, unsigned int row);
+    void PlayPassMove();
+    bool IsOnBoard(unsigned int xPosition, unsigned int yPosition) const;
+    bool IsInPositionHistory(std::uint64_t positionHash) const;
+
+    static std::uint64_t GetPositionHash(const SgfcGoPosition& position, SgfcColor colorToMove);
+    static std::shared_ptr<ISgfcGoPoint> GetGoPoint(const ISgfcSinglePropertyValue& propertyValue);
+    static SgfcColor GetOpponentColor(SgfcColor color);
+  };
+}
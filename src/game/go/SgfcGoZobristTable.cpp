@@ -0,0 +1,72 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "SgfcGoBitboard.h"
+#include "SgfcGoZobristTable.h"
+
+namespace LibSgfcPlusPlus
+{
+  // The keys are laid out like this: One key per intersection for black
+  // stones, one key per intersection for white stones, one key per possible
+  // number of columns, one key per possible number of rows.
+  static const std::size_t NumberOfIntersections =
+    SgfcGoBitboard::MaximumDimension * SgfcGoBitboard::MaximumDimension;
+  static const std::size_t ColumnsKeysOffset = 2 * NumberOfIntersections;
+  static const std::size_t RowsKeysOffset = ColumnsKeysOffset + SgfcGoBitboard::MaximumDimension + 1;
+  static const std::size_t NumberOfKeys = RowsKeysOffset + SgfcGoBitboard::MaximumDimension + 1;
+
+  std::uint64_t SgfcGoZobristTable::GetStoneKey(SgfcColor color, unsigned int column, unsigned int row)
+  {
+    std::size_t colorOffset = (color == SgfcColor::Black) ? 0 : NumberOfIntersections;
+    return GetKeys()[colorOffset + row * SgfcGoBitboard::MaximumDimension + column];
+  }
+
+  std::uint64_t SgfcGoZobristTable::GetBoardSizeKey(SgfcBoardSize boardSize)
+  {
+    const std::vector<std::uint64_t>& keys = GetKeys();
+    return
+      keys[ColumnsKeysOffset + static_cast<std::size_t>(boardSize.Columns)] ^
+      keys[RowsKeysOffset + static_cast<std::size_t>(boardSize.Rows)];
+  }
+
+  const std::vector<std::uint64_t>& SgfcGoZobristTable::GetKeys()
+  {
+    // Initialization of a function-local static is thread-safe
+    static const std::vector<std::uint64_t> keys = CreateKeys();
+    return keys;
+  }
+
+  /// @brief Generates the keys with the splitmix64 generator, which is tiny,
+  /// fast and produces keys of good quality. Changing the seed or the
+  /// generator changes all hashes, which invalidates persisted hashes.
+  std::vector<std::uint64_t> SgfcGoZobristTable::CreateKeys()
+  {
+    std::vector<std::uint64_t> keys(NumberOfKeys);
+
+    std::uint64_t state = 0x53474643474F5A42ULL;
+    for (auto& key : keys)
+    {
+      state += 0x9E3779B97F4A7C15ULL;
+      std::uint64_t value = state;
+      value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+      key = value ^ (value >> 31);
+    }
+
+    return keys;
+  }
+}
@@ -0,0 +1,64 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../../include/SgfcBoardSize.h"
+#include "../../../include/SgfcColor.h"
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcGoZobristTable class is a container for static functions
+  /// that provide the random keys used for Zobrist hashing of Go positions.
+  ///
+  /// @ingroup internals
+  /// @ingroup go
+  ///
+  /// The Zobrist hash of a position is the XOR of one key for the board size
+  /// and one key for each stone on the board. Because XOR is its own inverse,
+  /// the hash can be updated incrementally in O(1) whenever a stone is placed
+  /// or removed.
+  ///
+  /// The keys are generated from a fixed seed, so hashes are the same across
+  /// processes and platforms. This makes it possible to persist hashes, e.g.
+  /// in an SgfcGoPositionIndex file.
+  class SgfcGoZobristTable
+  {
+  public:
+    SgfcGoZobristTable() = delete;
+    ~SgfcGoZobristTable() = delete;
+
+    /// @brief Returns the key for a stone of color @a color at the
+    /// intersection at @a column and @a row. Columns and rows are 0-based.
+    /// The behaviour is undefined if @a column or @a row are not less than
+    /// SgfcGoBitboard::MaximumDimension.
+    static std::uint64_t GetStoneKey(SgfcColor color, unsigned int column, unsigned int row);
+
+    /// @brief Returns the key for the board size @a boardSize. This is the
+    /// hash of an empty board. The behaviour is undefined if @a boardSize has
+    /// more than SgfcGoBitboard::MaximumDimension columns or rows.
+    static std::uint64_t GetBoardSizeKey(SgfcBoardSize boardSize);
+
+  private:
+    static const std::vector<std::uint64_t>& GetKeys();
+    static std::vector<std::uint64_t> CreateKeys();
+  };
+}
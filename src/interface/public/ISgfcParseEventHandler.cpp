@@ -0,0 +1,60 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../../include/ISgfcParseEventHandler.h"
+
+namespace LibSgfcPlusPlus
+{
+  ISgfcParseEventHandler::ISgfcParseEventHandler()
+  {
+  }
+
+  ISgfcParseEventHandler::~ISgfcParseEventHandler()
+  {
+  }
+
+  void ISgfcParseEventHandler::BeginGame(SgfcGameType gameType, SgfcBoardSize boardSize)
+  {
+  }
+
+  void ISgfcParseEventHandler::EndGame()
+  {
+  }
+
+  void ISgfcParseEventHandler::BeginVariation()
+  {
+  }
+
+  void ISgfcParseEventHandler::EndVariation()
+  {
+  }
+
+  void ISgfcParseEventHandler::BeginNode()
+  {
+  }
+
+  void ISgfcParseEventHandler::EndNode()
+  {
+  }
+
+  void ISgfcParseEventHandler::Property(
+    SgfcPropertyType propertyType,
+    const std::string& propertyName,
+    const std::vector<std::shared_ptr<ISgfcPropertyValue>>& propertyValues)
+  {
+  }
+}
@@ -23,32 +23,54 @@
 #include "../../include/ISgfcSinglePropertyValue.h"
 #include "../../include/ISgfcSimpleTextPropertyValue.h"
 #include "../../include/ISgfcTextPropertyValue.h"
+#include "../document/SgfcNode.h"
+#include "../SgfcParallelUtility.h"
 #include "../SgfcPrivateConstants.h"
 #include "SgfcDocumentEncoder.h"
 
 // C++ Standard Library includes
+#include <algorithm>
+#include <limits>
 #include <sstream>
 #include <stack>
+#include <stdexcept>
+#include <utility>
 
 namespace LibSgfcPlusPlus
 {
   SgfcDocumentEncoder::SgfcDocumentEncoder(std::shared_ptr<ISgfcDocument> document)
     : document(document)
+    , numberOfThreads(1)
+    , encoderCache(nullptr)
   {
   }
 
+  SgfcDocumentEncoder::SgfcDocumentEncoder(std::shared_ptr<ISgfcDocument> document, unsigned int numberOfThreads)
+    : document(document)
+    , numberOfThreads(numberOfThreads)
+    , encoderCache(nullptr)
+  {
+  }
+
+  SgfcDocumentEncoder::SgfcDocumentEncoder(
+    std::shared_ptr<ISgfcDocument> document,
+    unsigned int numberOfThreads,
+    std::shared_ptr<SgfcDocumentEncoderCache> encoderCache)
+    : document(document)
+    , numberOfThreads(numberOfThreads)
+    , encoderCache(encoderCache)
+  {
+    if (encoderCache == nullptr)
+      throw std::invalid_argument("SgfcDocumentEncoder constructor failed: Encoder cache is nullptr");
+  }
+
   SgfcDocumentEncoder::~SgfcDocumentEncoder()
   {
   }
 
   std::string SgfcDocumentEncoder::Encode() const
   {
-    std::stringstream sgfContentStream;
-    // Make sure that decimal point is always a period (".") character and that
-    // there are no thousands separators
-    sgfContentStream.imbue(std::locale::classic());
-
-    int indentationLevel = 0;
+    std::vector<std::shared_ptr<ISgfcNode>> rootNodes;
 
     int indexOfGame = -1;
     for (auto game : document->GetGames())
@@ -63,24 +85,434 @@ namespace LibSgfcPlusPlus
         throw std::logic_error(errorMessage.str());
       }
 
+      rootNodes.push_back(rootNode);
+    }
+
+    if (this->encoderCache != nullptr)
+      return EncodeWithCache(rootNodes);
+
+    std::vector<EncodingTask> encodingTasks;
+    for (auto rootNode : rootNodes)
+    {
+      EncodingTask gameTask;
+      gameTask.StartNode = rootNode;
+      gameTask.IndentationLevel = 1;
+      gameTask.IsGameTask = true;
+      encodingTasks.push_back(gameTask);
+    }
+
+    std::size_t numberOfGameTasks = encodingTasks.size();
+
+    // Splitting the games into subtrees only pays off if more than one thread
+    // encodes them
+    std::unordered_map<const ISgfcNode*, std::size_t> subtreeTaskIndexes;
+    unsigned int numberOfWorkerThreads = SgfcParallelUtility::GetNumberOfWorkerThreads(
+      this->numberOfThreads,
+      std::numeric_limits<std::size_t>::max());
+    if (numberOfWorkerThreads > 1)
+      CreateSubtreeTasks(encodingTasks, subtreeTaskIndexes, numberOfWorkerThreads);
+
+    SgfcParallelUtility::ForEach(
+      encodingTasks.size(),
+      SgfcParallelUtility::GetNumberOfWorkerThreads(numberOfWorkerThreads, encodingTasks.size()),
+      [this, &encodingTasks, &subtreeTaskIndexes](std::size_t taskIndex, unsigned int)
+      {
+        EncodeTask(encodingTasks[taskIndex], subtreeTaskIndexes);
+      });
+
+    std::size_t sgfContentLength = 0;
+    for (const auto& encodingTask : encodingTasks)
+    {
+      for (const auto& segment : encodingTask.Segments)
+        sgfContentLength += segment.length();
+    }
+
+    std::string sgfContent;
+    sgfContent.reserve(sgfContentLength);
+
+    for (std::size_t gameTaskIndex = 0; gameTaskIndex < numberOfGameTasks; gameTaskIndex++)
+      AppendTaskSgfContent(encodingTasks, gameTaskIndex, sgfContent);
+
+    return sgfContent;
+  }
+
+  std::string SgfcDocumentEncoder::EncodeWithCache(const std::vector<std::shared_ptr<ISgfcNode>>& rootNodes) const
+  {
+    std::vector<std::shared_ptr<const SgfcDocumentEncoderCache::NodeEntry>> gameEntries;
+    std::vector<std::pair<std::shared_ptr<ISgfcNode>, SgfcDocumentEncoderCache::NodeEntry*>> nodesToEncode;
+    std::vector<std::shared_ptr<ISgfcNode>> updatedNodes;
+
+    for (auto rootNode : rootNodes)
+      gameEntries.push_back(UpdateNodeEntries(rootNode, nodesToEncode, updatedNodes));
+
+    // The nodes are independent of each other. Each chunk of nodes is large
+    // enough to outweigh the cost of distributing it to a worker thread.
+    std::size_t numberOfNodesPerChunk = SgfcPrivateConstants::MinimumNumberOfNodesPerEncodingTask;
+    std::size_t numberOfChunks = (nodesToEncode.size() + numberOfNodesPerChunk - 1) / numberOfNodesPerChunk;
+
+    SgfcParallelUtility::ForEach(
+      numberOfChunks,
+      SgfcParallelUtility::GetNumberOfWorkerThreads(this->numberOfThreads, numberOfChunks),
+      [this, &nodesToEncode, numberOfNodesPerChunk](std::size_t chunkIndex, unsigned int)
+      {
+        std::size_t firstNodeIndex = chunkIndex * numberOfNodesPerChunk;
+        std::size_t endNodeIndex = std::min(firstNodeIndex + numberOfNodesPerChunk, nodesToEncode.size());
+
+        for (std::size_t nodeIndex = firstNodeIndex; nodeIndex < endNodeIndex; nodeIndex++)
+        {
+          std::stringstream sgfContentStream;
+          // Make sure that decimal point is always a period (".") character
+          // and that there are no thousands separators
+          sgfContentStream.imbue(std::locale::classic());
+
+          EncodeNodeContent(nodesToEncode[nodeIndex].first.get(), sgfContentStream, 0);
+          nodesToEncode[nodeIndex].second->NodeSgfContent = sgfContentStream.str();
+        }
+      });
+
+    std::string sgfContent;
+    for (const auto& gameEntry : gameEntries)
+      AppendGameEntrySgfContent(gameEntry.get(), sgfContent);
+
+    // The modification flags are cleared only now that encoding can no
+    // longer fail. The subtrees of all other nodes were not modified.
+    for (auto updatedNode : updatedNodes)
+      static_cast<SgfcNode*>(updatedNode.get())->ClearSubtreeModified();
+
+    this->encoderCache->SetGameEntries(gameEntries);
+
+    return sgfContent;
+  }
+
+  /// @brief Creates the cache entries for the game tree that starts with
+  /// @a rootNode, reusing the cached entries of all subtrees that were not
+  /// modified since they were cached.
+  ///
+  /// Adds every node whose SGF content must be encoded, together with its
+  /// new cache entry, to @a nodesToEncode. Adds every node for which a new
+  /// cache entry was created to @a updatedNodes.
+  ///
+  /// The implementation of this method assumes that all nodes are instances
+  /// of SgfcNode.
+  std::shared_ptr<const SgfcDocumentEncoderCache::NodeEntry> SgfcDocumentEncoder::UpdateNodeEntries(
+    std::shared_ptr<ISgfcNode> rootNode,
+    std::vector<std::pair<std::shared_ptr<ISgfcNode>, SgfcDocumentEncoderCache::NodeEntry*>>& nodesToEncode,
+    std::vector<std::shared_ptr<ISgfcNode>>& updatedNodes) const
+  {
+    std::shared_ptr<const SgfcDocumentEncoderCache::NodeEntry> rootEntry;
+
+    // The game trees can be arbitrarily deep, so the traversal uses a stack
+    // instead of recursion
+    std::stack<NodeEntryUpdate> stack;
+
+    NodeEntryUpdate rootNodeEntryUpdate;
+    rootNodeEntryUpdate.Node = rootNode;
+    rootNodeEntryUpdate.CachedEntry = this->encoderCache->GetGameEntry(rootNode.get());
+    rootNodeEntryUpdate.ParentEntry = nullptr;
+    rootNodeEntryUpdate.ChildIndex = 0;
+    stack.push(rootNodeEntryUpdate);
+
+    while (! stack.empty())
+    {
+      NodeEntryUpdate nodeEntryUpdate = stack.top();
+      stack.pop();
+
+      const SgfcNode* nodeImplementation = static_cast<const SgfcNode*>(nodeEntryUpdate.Node.get());
+      auto cachedEntry = nodeEntryUpdate.CachedEntry;
+      if (cachedEntry != nullptr && cachedEntry->Node != nodeImplementation)
+        cachedEntry = nullptr;
+
+      std::shared_ptr<const SgfcDocumentEncoderCache::NodeEntry> entry;
+
+      if (cachedEntry != nullptr && cachedEntry->SubtreeGeneration == nodeImplementation->GetSubtreeGeneration())
+      {
+        entry = cachedEntry;
+      }
+      else
+      {
+        auto newEntry = std::shared_ptr<SgfcDocumentEncoderCache::NodeEntry>(new SgfcDocumentEncoderCache::NodeEntry());
+        newEntry->Node = nodeImplementation;
+        newEntry->SubtreeGeneration = nodeImplementation->GetSubtreeGeneration();
+        newEntry->PropertiesGeneration = nodeImplementation->GetPropertiesGeneration();
+
+        if (cachedEntry != nullptr && cachedEntry->PropertiesGeneration == newEntry->PropertiesGeneration)
+          newEntry->NodeSgfContent = cachedEntry->NodeSgfContent;
+        else
+          nodesToEncode.push_back(std::make_pair(nodeEntryUpdate.Node, newEntry.get()));
+
+        updatedNodes.push_back(nodeEntryUpdate.Node);
+
+        auto children = nodeEntryUpdate.Node->GetChildren();
+        newEntry->Children.resize(children.size());
+
+        std::size_t cachedChildIndex = 0;
+        for (std::size_t childIndex = 0; childIndex < children.size(); childIndex++)
+        {
+          NodeEntryUpdate childNodeEntryUpdate;
+          childNodeEntryUpdate.Node = children[childIndex];
+          childNodeEntryUpdate.CachedEntry = FindCachedChildEntry(cachedEntry, children[childIndex].get(), cachedChildIndex);
+          childNodeEntryUpdate.ParentEntry = newEntry.get();
+          childNodeEntryUpdate.ChildIndex = childIndex;
+          stack.push(childNodeEntryUpdate);
+        }
+
+        entry = newEntry;
+      }
+
+      if (nodeEntryUpdate.ParentEntry == nullptr)
+        rootEntry = entry;
+      else
+        nodeEntryUpdate.ParentEntry->Children[nodeEntryUpdate.ChildIndex] = entry;
+    }
+
+    return rootEntry;
+  }
+
+  /// @brief Returns the entry among the children of @a cachedEntry that was
+  /// cached for @a childNode. Returns nullptr if @a cachedEntry is nullptr or
+  /// if there is no such entry.
+  ///
+  /// The search starts at @a cachedChildIndex and wraps around. If the entry
+  /// is found, @a cachedChildIndex is updated to refer to the entry after the
+  /// entry that was found. Because the order of the children of a node rarely
+  /// changes, searching the entries for all children of a node usually costs
+  /// O(n).
+  std::shared_ptr<const SgfcDocumentEncoderCache::NodeEntry> SgfcDocumentEncoder::FindCachedChildEntry(
+    std::shared_ptr<const SgfcDocumentEncoderCache::NodeEntry> cachedEntry,
+    const ISgfcNode* childNode,
+    std::size_t& cachedChildIndex) const
+  {
+    if (cachedEntry == nullptr)
+      return nullptr;
+
+    std::size_t numberOfCachedChildren = cachedEntry->Children.size();
+    for (std::size_t searchIndex = 0; searchIndex < numberOfCachedChildren; searchIndex++)
+    {
+      std::size_t candidateIndex = (cachedChildIndex + searchIndex) % numberOfCachedChildren;
+      if (cachedEntry->Children[candidateIndex]->Node == childNode)
+      {
+        cachedChildIndex = candidateIndex + 1;
+        return cachedEntry->Children[candidateIndex];
+      }
+    }
+
+    return nullptr;
+  }
+
+  /// @brief Appends the SGF content of the game whose root node has the
+  /// cache entry @a gameEntry to @a sgfContent. The SGF content is exactly
+  /// the same as the one that EncodeTask() generates for a game task.
+  void SgfcDocumentEncoder::AppendGameEntrySgfContent(
+    const SgfcDocumentEncoderCache::NodeEntry* gameEntry,
+    std::string& sgfContent) const
+  {
+    AppendLine(SgfcPrivateConstants::GameTreeBeginToken, 0, sgfContent);
+
+    // An entry of nullptr marks the end of a variation
+    std::stack<NodeEntryStep> stack;
+
+    NodeEntryStep gameEntryStep;
+    gameEntryStep.Entry = gameEntry;
+    gameEntryStep.IndentationLevel = 1;
+    gameEntryStep.IsVariation = false;
+    stack.push(gameEntryStep);
+
+    while (! stack.empty())
+    {
+      NodeEntryStep nodeEntryStep = stack.top();
+      stack.pop();
+
+      int indentationLevel = nodeEntryStep.IndentationLevel;
+
+      if (nodeEntryStep.Entry == nullptr)
+      {
+        AppendLine(SgfcPrivateConstants::GameTreeEndToken, indentationLevel, sgfContent);
+        continue;
+      }
+
+      if (nodeEntryStep.IsVariation)
+      {
+        AppendLine(SgfcPrivateConstants::GameTreeBeginToken, indentationLevel, sgfContent);
+
+        NodeEntryStep variationEndStep;
+        variationEndStep.Entry = nullptr;
+        variationEndStep.IndentationLevel = indentationLevel;
+        variationEndStep.IsVariation = false;
+        stack.push(variationEndStep);
+
+        indentationLevel++;
+      }
+
+      AppendLine(nodeEntryStep.Entry->NodeSgfContent, indentationLevel, sgfContent);
+
+      // Push the children in reverse order so that the first child is
+      // visited first. Children are variations if there is more than one.
+      const auto& children = nodeEntryStep.Entry->Children;
+      bool childrenAreVariations = children.size() > 1;
+      for (auto it = children.rbegin(); it != children.rend(); it++)
+      {
+        NodeEntryStep childEntryStep;
+        childEntryStep.Entry = it->get();
+        childEntryStep.IndentationLevel = indentationLevel;
+        childEntryStep.IsVariation = childrenAreVariations;
+        stack.push(childEntryStep);
+      }
+    }
+
+    AppendLine(SgfcPrivateConstants::GameTreeEndToken, 0, sgfContent);
+  }
+
+  void SgfcDocumentEncoder::AppendLine(
+    const std::string& lineContent,
+    int indentationLevel,
+    std::string& sgfContent) const
+  {
+    while (indentationLevel > 0)
+    {
+      sgfContent += SgfcPrivateConstants::IndentationWhitespace;
+      indentationLevel--;
+    }
+
+    sgfContent += lineContent;
+    sgfContent += '\n';
+  }
+
+  void SgfcDocumentEncoder::CreateSubtreeTasks(
+    std::vector<EncodingTask>& encodingTasks,
+    std::unordered_map<const ISgfcNode*, std::size_t>& subtreeTaskIndexes,
+    unsigned int numberOfWorkerThreads) const
+  {
+    static const std::size_t NoParentNodeIndex = std::numeric_limits<std::size_t>::max();
+
+    // Collect the nodes of all games in depth-first order, so that the
+    // descendants of a node follow the node. For each node remember the
+    // indentation level that ParseDepthFirst() uses when it arrives at the
+    // node.
+    std::vector<std::shared_ptr<ISgfcNode>> nodes;
+    std::vector<std::size_t> parentNodeIndexes;
+    std::vector<int> indentationLevels;
+
+    // The stack holds each node together with the index of its parent node
+    std::stack<std::pair<std::shared_ptr<ISgfcNode>, std::size_t>> stack;
+    for (const auto& gameTask : encodingTasks)
+    {
+      stack.push(std::make_pair(gameTask.StartNode, NoParentNodeIndex));
+
+      while (! stack.empty())
+      {
+        std::shared_ptr<ISgfcNode> node = stack.top().first;
+        std::size_t parentNodeIndex = stack.top().second;
+        stack.pop();
+
+        int indentationLevel = gameTask.IndentationLevel;
+        if (parentNodeIndex != NoParentNodeIndex)
+        {
+          const auto& parentNode = nodes[parentNodeIndex];
+          indentationLevel = indentationLevels[parentNodeIndex];
+          if (parentNode->HasNextSibling() || parentNode->HasPreviousSibling())
+            indentationLevel++;
+        }
+
+        std::size_t nodeIndex = nodes.size();
+        nodes.push_back(node);
+        parentNodeIndexes.push_back(parentNodeIndex);
+        indentationLevels.push_back(indentationLevel);
+
+        // Push the children in reverse order so that the first child is
+        // visited first
+        auto children = node->GetChildren();
+        for (auto it = children.rbegin(); it != children.rend(); it++)
+          stack.push(std::make_pair(*it, nodeIndex));
+      }
+    }
+
+    std::size_t minimumNumberOfNodesPerTask = std::max(
+      SgfcPrivateConstants::MinimumNumberOfNodesPerEncodingTask,
+      nodes.size() / (numberOfWorkerThreads * SgfcPrivateConstants::NumberOfEncodingTasksPerWorkerThread));
+
+    // Visit the nodes bottom-up and count the nodes that are not yet part of
+    // a subtree task. As soon as a subtree has enough such nodes it becomes a
+    // task of its own, and its nodes no longer count for its ancestors.
+    // Root nodes are never split off, the remaining nodes of a game are
+    // encoded by the game task.
+    std::vector<std::size_t> numberOfPendingNodes(nodes.size(), 1);
+    for (std::size_t nodeIndex = nodes.size(); nodeIndex > 0; )
+    {
+      nodeIndex--;
+
+      std::size_t parentNodeIndex = parentNodeIndexes[nodeIndex];
+      if (parentNodeIndex == NoParentNodeIndex)
+        continue;
+
+      if (numberOfPendingNodes[nodeIndex] >= minimumNumberOfNodesPerTask)
+      {
+        EncodingTask subtreeTask;
+        subtreeTask.StartNode = nodes[nodeIndex];
+        subtreeTask.IndentationLevel = indentationLevels[nodeIndex];
+        subtreeTask.IsGameTask = false;
+
+        subtreeTaskIndexes[nodes[nodeIndex].get()] = encodingTasks.size();
+        encodingTasks.push_back(subtreeTask);
+      }
+      else
+      {
+        numberOfPendingNodes[parentNodeIndex] += numberOfPendingNodes[nodeIndex];
+      }
+    }
+  }
+
+  void SgfcDocumentEncoder::EncodeTask(
+    EncodingTask& encodingTask,
+    const std::unordered_map<const ISgfcNode*, std::size_t>& subtreeTaskIndexes) const
+  {
+    std::stringstream sgfContentStream;
+    // Make sure that decimal point is always a period (".") character and that
+    // there are no thousands separators
+    sgfContentStream.imbue(std::locale::classic());
+
+    int indentationLevel = encodingTask.IndentationLevel;
+
+    if (encodingTask.IsGameTask)
+    {
+      indentationLevel--;
       EncodeGameTreeBeginOrEnd(SgfcPrivateConstants::GameTreeBeginToken, sgfContentStream, indentationLevel);
       indentationLevel++;
+    }
 
-      ParseDepthFirst(rootNode, sgfContentStream, indentationLevel);
+    ParseDepthFirst(encodingTask.StartNode, sgfContentStream, indentationLevel, subtreeTaskIndexes, encodingTask);
 
+    if (encodingTask.IsGameTask)
+    {
       indentationLevel--;
       EncodeGameTreeBeginOrEnd(SgfcPrivateConstants::GameTreeEndToken, sgfContentStream, indentationLevel);
-
-      rootNode = rootNode->GetNextSibling();
     }
 
-    return sgfContentStream.str();
+    encodingTask.Segments.push_back(sgfContentStream.str());
+  }
+
+  void SgfcDocumentEncoder::AppendTaskSgfContent(
+    const std::vector<EncodingTask>& encodingTasks,
+    std::size_t taskIndex,
+    std::string& sgfContent) const
+  {
+    // There is always one more segment than there are subtree tasks. The
+    // recursion depth is limited by the number of tasks.
+    const EncodingTask& encodingTask = encodingTasks[taskIndex];
+    for (std::size_t segmentIndex = 0; segmentIndex < encodingTask.Segments.size(); segmentIndex++)
+    {
+      sgfContent += encodingTask.Segments[segmentIndex];
+
+      if (segmentIndex < encodingTask.SubtreeTaskIndexes.size())
+        AppendTaskSgfContent(encodingTasks, encodingTask.SubtreeTaskIndexes[segmentIndex], sgfContent);
+    }
   }
 
   void SgfcDocumentEncoder::ParseDepthFirst(
-    std::shared_ptr<ISgfcNode> rootNode,
+    std::shared_ptr<ISgfcNode> startNode,
     std::stringstream& sgfContentStream,
-    int indentationLevel) const
+    int indentationLevel,
+    const std::unordered_map<const ISgfcNode*, std::size_t>& subtreeTaskIndexes,
+    EncodingTask& encodingTask) const
   {
     // Implementation note: We can't use
     // SgfcNodeIterator::IterateOverNodesDepthFirst() because of the indentation
@@ -92,12 +524,29 @@ namespace LibSgfcPlusPlus
 
     std::stack<std::shared_ptr<ISgfcNode>> stack;
 
-    std::shared_ptr<ISgfcNode> currentNode = rootNode;
+    std::shared_ptr<ISgfcNode> currentNode = startNode;
 
     while (true)
     {
       while (currentNode)
       {
+        // A subtree that is encoded by another task is skipped as if it had
+        // been traversed. Its SGF content belongs between the segment that
+        // ends here and the segment that starts here.
+        if (! subtreeTaskIndexes.empty() && currentNode != startNode)
+        {
+          auto iterator = subtreeTaskIndexes.find(currentNode.get());
+          if (iterator != subtreeTaskIndexes.end())
+          {
+            encodingTask.Segments.push_back(sgfContentStream.str());
+            encodingTask.SubtreeTaskIndexes.push_back(iterator->second);
+            sgfContentStream.str(std::string());
+
+            currentNode = currentNode->GetNextSibling();
+            continue;
+          }
+        }
+
         if (currentNode->HasNextSibling() || currentNode->HasPreviousSibling())
         {
           EncodeGameTreeBeginOrEnd(SgfcPrivateConstants::GameTreeBeginToken, sgfContentStream, indentationLevel);
@@ -122,6 +571,11 @@ namespace LibSgfcPlusPlus
           EncodeGameTreeBeginOrEnd(SgfcPrivateConstants::GameTreeEndToken, sgfContentStream, indentationLevel);
         }
 
+        // The start node is the last node to be popped. Its siblings are not
+        // part of the subtree.
+        if (stack.empty())
+          break;
+
         currentNode = currentNode->GetNextSibling();
       }
       else
@@ -139,14 +593,22 @@ namespace LibSgfcPlusPlus
   {
     EncodeIndentation(indentationLevel, sgfContentStream);
 
+    EncodeNodeContent(node, sgfContentStream, indentationLevel);
+
+    sgfContentStream << std::endl;
+  }
+
+  void SgfcDocumentEncoder::EncodeNodeContent(
+    const ISgfcNode* node,
+    std::stringstream& sgfContentStream,
+    int indentationLevel) const
+  {
     sgfContentStream << SgfcPrivateConstants::NodeBeginToken;
 
     for (auto property : node->GetProperties())
     {
       EncodeProperty(property.get(), sgfContentStream, indentationLevel);
     }
-
-    sgfContentStream << std::endl;
   }
 
   void SgfcDocumentEncoder::EncodeProperty(
@@ -17,10 +17,17 @@
 #pragma once
 
 // Project includes
+#include "SgfcDocumentEncoderCache.h"
 #include "SgfcSinglePropertyValueContext.h"
 
 // C++ Standard Library includes
+#include <cstddef>
 #include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace LibSgfcPlusPlus
 {
@@ -47,13 +54,56 @@ namespace LibSgfcPlusPlus
   /// the SGF content.
   ///
   /// The purpose of generating human readable SGF content is to debug issues.
+  ///
+  /// Implementation note: SgfcDocumentEncoder can encode a document on
+  /// multiple threads. The document is split into encoding tasks, each of
+  /// which encodes either a game or a subtree of a game into a separate
+  /// buffer. A subtree is encoded by the same depth-first traversal that
+  /// encodes a game, and its SGF content occupies a contiguous stretch of the
+  /// game's SGF content. A task therefore produces a list of segments, and
+  /// the SGF content of each subtree task that was split off from the task
+  /// belongs between two segments. Concatenating the segments and the
+  /// subtree tasks' SGF content in the right order yields exactly the same
+  /// SGF content as encoding the document on a single thread.
+  ///
+  /// Implementation note: SgfcDocumentEncoder can encode a document
+  /// incrementally with the help of an SgfcDocumentEncoderCache. The cache
+  /// mirrors the game trees as they were when the document was last encoded.
+  /// SgfcDocumentEncoder walks down a game tree only as far as the subtree
+  /// generations of the nodes differ from those stored in the cache, and
+  /// encodes only those nodes whose properties generations differ. The SGF
+  /// content of all other nodes is taken from the cache. The modification
+  /// flags of the nodes make sure that modifying a node deep down in a large
+  /// game tree changes the subtree generations of all its ancestors.
   class SgfcDocumentEncoder
   {
   public:
     /// @brief Initializes a newly constructed SgfcDocumentEncoder object. The
-    /// object encodes the content of the specified @a document.
+    /// object encodes the content of the specified @a document on the thread
+    /// that invokes Encode().
     SgfcDocumentEncoder(std::shared_ptr<ISgfcDocument> document);
-    
+
+    /// @brief Initializes a newly constructed SgfcDocumentEncoder object. The
+    /// object encodes the content of the specified @a document on
+    /// @a numberOfThreads worker threads. The value 0 means that the number of
+    /// threads is determined by the number of concurrent threads supported by
+    /// the hardware.
+    SgfcDocumentEncoder(std::shared_ptr<ISgfcDocument> document, unsigned int numberOfThreads);
+
+    /// @brief Initializes a newly constructed SgfcDocumentEncoder object. The
+    /// object encodes the content of the specified @a document incrementally,
+    /// i.e. it takes the SGF content of all nodes that were not modified
+    /// since the last encoding from @a encoderCache. The object updates
+    /// @a encoderCache with the result of the encoding. The nodes that must
+    /// be encoded are encoded on @a numberOfThreads worker threads.
+    ///
+    /// @exception std::invalid_argument is thrown if @a encoderCache is
+    /// nullptr.
+    SgfcDocumentEncoder(
+      std::shared_ptr<ISgfcDocument> document,
+      unsigned int numberOfThreads,
+      std::shared_ptr<SgfcDocumentEncoderCache> encoderCache);
+
     /// @brief Destroys and cleans up the SgfcDocumentEncoder object.
     virtual ~SgfcDocumentEncoder();
 
@@ -76,18 +126,86 @@ namespace LibSgfcPlusPlus
     std::string Encode() const;
 
   private:
+    struct EncodingTask
+    {
+      std::shared_ptr<ISgfcNode> StartNode;
+      int IndentationLevel;
+      bool IsGameTask;
+      std::vector<std::string> Segments;
+      std::vector<std::size_t> SubtreeTaskIndexes;
+    };
+
+    struct NodeEntryUpdate
+    {
+      std::shared_ptr<ISgfcNode> Node;
+      std::shared_ptr<const SgfcDocumentEncoderCache::NodeEntry> CachedEntry;
+      SgfcDocumentEncoderCache::NodeEntry* ParentEntry;
+      std::size_t ChildIndex;
+    };
+
+    struct NodeEntryStep
+    {
+      const SgfcDocumentEncoderCache::NodeEntry* Entry;
+      int IndentationLevel;
+      bool IsVariation;
+    };
+
     std::shared_ptr<ISgfcDocument> document;
+    unsigned int numberOfThreads;
+    std::shared_ptr<SgfcDocumentEncoderCache> encoderCache;
 
-    void ParseDepthFirst(
+    std::string EncodeWithCache(const std::vector<std::shared_ptr<ISgfcNode>>& rootNodes) const;
+
+    std::shared_ptr<const SgfcDocumentEncoderCache::NodeEntry> UpdateNodeEntries(
       std::shared_ptr<ISgfcNode> rootNode,
+      std::vector<std::pair<std::shared_ptr<ISgfcNode>, SgfcDocumentEncoderCache::NodeEntry*>>& nodesToEncode,
+      std::vector<std::shared_ptr<ISgfcNode>>& updatedNodes) const;
+
+    std::shared_ptr<const SgfcDocumentEncoderCache::NodeEntry> FindCachedChildEntry(
+      std::shared_ptr<const SgfcDocumentEncoderCache::NodeEntry> cachedEntry,
+      const ISgfcNode* childNode,
+      std::size_t& cachedChildIndex) const;
+
+    void AppendGameEntrySgfContent(
+      const SgfcDocumentEncoderCache::NodeEntry* gameEntry,
+      std::string& sgfContent) const;
+
+    void AppendLine(
+      const std::string& lineContent,
+      int indentationLevel,
+      std::string& sgfContent) const;
+
+    void CreateSubtreeTasks(
+      std::vector<EncodingTask>& encodingTasks,
+      std::unordered_map<const ISgfcNode*, std::size_t>& subtreeTaskIndexes,
+      unsigned int numberOfWorkerThreads) const;
+
+    void EncodeTask(
+      EncodingTask& encodingTask,
+      const std::unordered_map<const ISgfcNode*, std::size_t>& subtreeTaskIndexes) const;
+
+    void AppendTaskSgfContent(
+      const std::vector<EncodingTask>& encodingTasks,
+      std::size_t taskIndex,
+      std::string& sgfContent) const;
+
+    void ParseDepthFirst(
+      std::shared_ptr<ISgfcNode> startNode,
       std::stringstream& sgfContentStream,
-      int indentationLevel) const;
+      int indentationLevel,
+      const std::unordered_map<const ISgfcNode*, std::size_t>& subtreeTaskIndexes,
+      EncodingTask& encodingTask) const;
 
     void EncodeNode(
       const ISgfcNode* node,
       std::stringstream& sgfContentStream,
       int indentationLevel) const;
 
+    void EncodeNodeContent(
+      const ISgfcNode* node,
+      std::stringstream& sgfContentStream,
+      int indentationLevel) const;
+
     void EncodeProperty(
       const ISgfcProperty* property,
       std::stringstream& sgfContentStream,
@@ -0,0 +1,56 @@
+// -----------------------------------------------------------------------------
+// Copyright 2020 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "SgfcDocumentEncoderCache.h"
+
+namespace LibSgfcPlusPlus
+{
+  SgfcDocumentEncoderCache::SgfcDocumentEncoderCache()
+  {
+  }
+
+  SgfcDocumentEncoderCache::~SgfcDocumentEncoderCache()
+  {
+  }
+
+  std::shared_ptr<const SgfcDocumentEncoderCache::NodeEntry> SgfcDocumentEncoderCache::GetGameEntry(const ISgfcNode* rootNode) const
+  {
+    std::lock_guard<std::mutex> lock(this->gameEntriesMutex);
+
+    auto it = this->gameEntries.find(rootNode);
+    if (it == this->gameEntries.end())
+      return nullptr;
+
+    return it->second;
+  }
+
+  void SgfcDocumentEncoderCache::SetGameEntries(const std::vector<std::shared_ptr<const NodeEntry>>& gameEntries)
+  {
+    std::unordered_map<const ISgfcNode*, std::shared_ptr<const NodeEntry>> newGameEntries;
+    for (const auto& gameEntry : gameEntries)
+      newGameEntries[gameEntry->Node] = gameEntry;
+
+    std::lock_guard<std::mutex> lock(this->gameEntriesMutex);
+    this->gameEntries.swap(newGameEntries);
+  }
+
+  void SgfcDocumentEncoderCache::Clear()
+  {
+    std::lock_guard<std::mutex> lock(this->gameEntriesMutex);
+    this->gameEntries.clear();
+  }
+}
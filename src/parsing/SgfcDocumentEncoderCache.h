@@ -0,0 +1,95 @@
+// -----------------------------------------------------------------------------
+// Copyright 2020 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcNode;
+
+  /// @brief The SgfcDocumentEncoderCache class stores the SGF content that
+  /// SgfcDocumentEncoder generated for the nodes of the document that it
+  /// encoded most recently, so that the next encoding of the same document
+  /// has to encode only the nodes that were modified in the meantime.
+  ///
+  /// @ingroup internals
+  /// @ingroup parsing
+  ///
+  /// The cache stores one entry per node. The entries of a game form a tree
+  /// that has the same structure as the game tree at the time when the game
+  /// was encoded. An entry stores the generations of the node (see
+  /// SgfcNode::GetSubtreeGeneration() and
+  /// SgfcNode::GetPropertiesGeneration()) at that time. If the subtree
+  /// generation of a node is still the same, the entire subtree of entries
+  /// can be reused. If only the properties generation is still the same, the
+  /// SGF content of the node can be reused.
+  ///
+  /// The entries do not store indentation and line breaks, because these
+  /// depend on the position of a node in the game tree. The cache also does
+  /// not keep the nodes alive. A node that is destroyed and whose memory is
+  /// reused for a new node cannot be confused with the new node because the
+  /// new node receives a new generation.
+  ///
+  /// SgfcDocumentEncoderCache is thread-safe. If multiple threads encode
+  /// documents with the same cache, the last thread to finish determines the
+  /// content of the cache.
+  class SgfcDocumentEncoderCache
+  {
+  public:
+    struct NodeEntry
+    {
+      const ISgfcNode* Node;
+      std::uint64_t SubtreeGeneration;
+      std::uint64_t PropertiesGeneration;
+      /// @brief The SGF content of the node itself, starting with the
+      /// node begin token, without indentation and line break.
+      std::string NodeSgfContent;
+      std::vector<std::shared_ptr<const NodeEntry>> Children;
+    };
+
+    /// @brief Initializes a newly constructed SgfcDocumentEncoderCache
+    /// object. The cache is empty.
+    SgfcDocumentEncoderCache();
+
+    /// @brief Destroys and cleans up the SgfcDocumentEncoderCache object.
+    virtual ~SgfcDocumentEncoderCache();
+
+    /// @brief Returns the entry for the root node @a rootNode of a game.
+    /// Returns nullptr if the cache has no entry for @a rootNode.
+    std::shared_ptr<const NodeEntry> GetGameEntry(const ISgfcNode* rootNode) const;
+
+    /// @brief Replaces the content of the cache with @a gameEntries, which
+    /// must contain one entry for the root node of each game of the document
+    /// that was encoded most recently.
+    void SetGameEntries(const std::vector<std::shared_ptr<const NodeEntry>>& gameEntries);
+
+    /// @brief Removes all entries from the cache.
+    void Clear();
+
+  private:
+    std::unordered_map<const ISgfcNode*, std::shared_ptr<const NodeEntry>> gameEntries;
+    mutable std::mutex gameEntriesMutex;
+  };
+}
@@ -0,0 +1,724 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../include/ISgfcComposedPropertyValue.h"
+#include "../../include/ISgfcGameInfo.h"
+#include "../../include/ISgfcNode.h"
+#include "../../include/ISgfcPropertyFactory.h"
+#include "../../include/ISgfcPropertyValueFactory.h"
+#include "../../include/ISgfcSimpleTextPropertyValue.h"
+#include "../../include/ISgfcSinglePropertyValue.h"
+#include "../../include/SgfcConstants.h"
+#include "../../include/SgfcPlusPlusFactory.h"
+#include "../SgfcPrivateConstants.h"
+#include "../SgfcUtility.h"
+#include "SgfcHeaderScanner.h"
+#include "SgfcPropertyDecoder.h"
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+
+// SGFC includes
+extern "C"
+{
+  #include "../../sgfc/src/all.h"
+  #include "../../sgfc/src/protos.h"
+}
+
+namespace LibSgfcPlusPlus
+{
+  struct SgfcHeaderScanner::SgfNodeData
+  {
+    Node SgfNode = {};
+    std::vector<std::string> PropertyNames;
+    std::vector<std::string> PropertyValues;
+    std::vector<PropValue> SgfPropertyValues;
+    std::vector<Property> SgfProperties;
+  };
+
+  SgfcHeaderScanner::SgfcHeaderScanner(const std::string& sgfContent)
+    : sgfContent(sgfContent)
+  {
+  }
+
+  SgfcHeaderScanner::~SgfcHeaderScanner()
+  {
+  }
+
+  bool SgfcHeaderScanner::ScanGameInfos(std::vector<std::shared_ptr<ISgfcGameInfo>>& gameInfos) const
+  {
+    std::size_t position = 0;
+
+    bool hasUtf8ByteOrderMark = false;
+    if (this->sgfContent.compare(0, 3, "\xEF\xBB\xBF") == 0)
+    {
+      hasUtf8ByteOrderMark = true;
+      position = 3;
+    }
+    else if (this->sgfContent.compare(0, 2, "\xFE\xFF") == 0 ||
+             this->sgfContent.compare(0, 2, "\xFF\xFE") == 0 ||
+             this->sgfContent.compare(0, 4, std::string("\x00\x00\xFE\xFF", 4)) == 0)
+    {
+      // Wide-character encodings are handled only by SGFC
+      return false;
+    }
+
+    if (! FindFirstGameTree(position))
+      return false;
+
+    std::vector<RawGameHeader> gameHeaders;
+    RawProperty firstCaProperty;
+
+    while (position < this->sgfContent.size())
+    {
+      RawGameHeader gameHeader;
+      if (! ScanGameTree(position, gameHeader, firstCaProperty))
+        return false;
+      gameHeaders.push_back(std::move(gameHeader));
+
+      // Anything other than whitespace between and after the game trees is
+      // something that SGFC reports
+      SkipWhitespace(position);
+      if (position < this->sgfContent.size() && this->sgfContent[position] != '(')
+        return false;
+    }
+
+    // Decoding starts only after the entire SGF data has been scanned, because
+    // the text encoding is defined by the first CA property in the SGF data,
+    // which is not necessarily in the first game tree.
+    TextEncoding textEncoding;
+    if (! GetTextEncoding(hasUtf8ByteOrderMark, firstCaProperty, textEncoding))
+      return false;
+
+    for (const auto& gameHeader : gameHeaders)
+    {
+      std::shared_ptr<ISgfcGameInfo> gameInfo;
+      if (! DecodeGameHeader(gameHeader, textEncoding, gameInfo))
+        return false;
+
+      gameInfos.push_back(gameInfo);
+    }
+
+    return true;
+  }
+
+  /// @brief Scans the game tree that begins at @a position. When the method
+  /// returns true @a position is behind the closing parenthesis of the game
+  /// tree.
+  bool SgfcHeaderScanner::ScanGameTree(
+    std::size_t& position,
+    RawGameHeader& gameHeader,
+    RawProperty& firstCaProperty) const
+  {
+    int nestingLevel = 0;
+    std::size_t numberOfNodes = 0;
+    bool isNodeInProgress = false;
+    bool isNodeAllowed = false;
+
+    RawNode currentNode;
+    RawProperty rawProperty;
+
+    while (position < this->sgfContent.size())
+    {
+      char character = this->sgfContent[position];
+
+      if (IsWhitespace(character))
+      {
+        position++;
+        continue;
+      }
+
+      if (character == '(' || character == ')' || character == ';')
+      {
+        if (isNodeInProgress)
+        {
+          EndNode(currentNode, numberOfNodes == 1, gameHeader);
+          currentNode.clear();
+          isNodeInProgress = false;
+        }
+      }
+
+      if (character == '(')
+      {
+        nestingLevel++;
+        position++;
+
+        // Every game tree and variation must begin with a node
+        SkipWhitespace(position);
+        if (position >= this->sgfContent.size() || this->sgfContent[position] != ';')
+          return false;
+
+        isNodeAllowed = true;
+      }
+      else if (character == ')')
+      {
+        nestingLevel--;
+        position++;
+
+        if (nestingLevel == 0)
+          return true;
+
+        // After a variation has ended only another variation or the end of
+        // the enclosing variation may follow
+        isNodeAllowed = false;
+      }
+      else if (character == ';')
+      {
+        if (! isNodeAllowed)
+          return false;
+
+        numberOfNodes++;
+        position++;
+
+        isNodeInProgress = true;
+      }
+      else if (character >= 'A' && character <= 'Z')
+      {
+        if (! isNodeInProgress)
+          return false;
+
+        if (! ScanProperty(position, rawProperty))
+          return false;
+
+        if (firstCaProperty.PropertyName.empty() && rawProperty.PropertyName == "CA")
+          firstCaProperty = rawProperty;
+
+        // Once the game info node has been found the remaining nodes are
+        // only scanned for their boundaries
+        if (! gameHeader.IsGameInfoNodeFound)
+          currentNode.push_back(rawProperty);
+      }
+      else
+      {
+        // Lowercase letters (FF1-3 property identifiers) or garbage
+        return false;
+      }
+    }
+
+    // Unterminated game tree
+    return false;
+  }
+
+  /// @brief Scans the property whose identifier begins at @a position. When
+  /// the method returns true @a position is behind the closing bracket of
+  /// the last property value and any whitespace that follows it.
+  bool SgfcHeaderScanner::ScanProperty(std::size_t& position, RawProperty& rawProperty) const
+  {
+    std::size_t propertyNameBeginPosition = position;
+    while (position < this->sgfContent.size() &&
+           this->sgfContent[position] >= 'A' &&
+           this->sgfContent[position] <= 'Z')
+    {
+      position++;
+    }
+
+    if (position < this->sgfContent.size() &&
+        this->sgfContent[position] >= 'a' &&
+        this->sgfContent[position] <= 'z')
+    {
+      return false;
+    }
+
+    rawProperty.PropertyName.assign(this->sgfContent, propertyNameBeginPosition, position - propertyNameBeginPosition);
+    rawProperty.ValueRanges.clear();
+
+    SkipWhitespace(position);
+    while (position < this->sgfContent.size() && this->sgfContent[position] == '[')
+    {
+      position++;
+      std::size_t valueBeginPosition = position;
+
+      while (true)
+      {
+        position = this->sgfContent.find_first_of("\\]", position);
+        if (position == std::string::npos || position >= this->sgfContent.size())
+          return false;
+
+        if (this->sgfContent[position] == ']')
+          break;
+
+        // Skip the escape character and the escaped character
+        position += 2;
+      }
+
+      rawProperty.ValueRanges.push_back(std::make_pair(valueBeginPosition, position));
+
+      position++;
+      SkipWhitespace(position);
+    }
+
+    // A property without value is a syntax error
+    return ! rawProperty.ValueRanges.empty();
+  }
+
+  void SgfcHeaderScanner::SkipWhitespace(std::size_t& position) const
+  {
+    while (position < this->sgfContent.size() && IsWhitespace(this->sgfContent[position]))
+      position++;
+  }
+
+  /// @brief Advances @a position to the opening parenthesis of the first
+  /// game tree. Like SGFC, the method skips any text before the first
+  /// occurrence of "(;".
+  bool SgfcHeaderScanner::FindFirstGameTree(std::size_t& position) const
+  {
+    while (true)
+    {
+      position = this->sgfContent.find('(', position);
+      if (position == std::string::npos)
+        return false;
+
+      std::size_t nodePosition = position + 1;
+      SkipWhitespace(nodePosition);
+      if (nodePosition < this->sgfContent.size() && this->sgfContent[nodePosition] == ';')
+        return true;
+
+      position++;
+    }
+  }
+
+  /// @brief Determines the text encoding the same way as SGFC does when
+  /// SgfcArgumentType::EncodingMode is 1.
+  bool SgfcHeaderScanner::GetTextEncoding(
+    bool hasUtf8ByteOrderMark,
+    const RawProperty& firstCaProperty,
+    TextEncoding& textEncoding) const
+  {
+    if (firstCaProperty.PropertyName.empty())
+    {
+      textEncoding = hasUtf8ByteOrderMark ? TextEncoding::Utf8 : TextEncoding::Iso88591;
+      return true;
+    }
+
+    if (firstCaProperty.ValueRanges.size() != 1)
+      return false;
+
+    const auto& valueRange = firstCaProperty.ValueRanges.front();
+    std::string encodingName = this->sgfContent.substr(valueRange.first, valueRange.second - valueRange.first);
+    std::transform(
+      encodingName.begin(),
+      encodingName.end(),
+      encodingName.begin(),
+      [](unsigned char character) { return std::toupper(character); });
+
+    if (encodingName == "UTF-8" || encodingName == "UTF8")
+    {
+      textEncoding = TextEncoding::Utf8;
+      return true;
+    }
+
+    // SGFC requires that the CA property matches the byte order mark
+    if (hasUtf8ByteOrderMark)
+      return false;
+
+    if (encodingName == "ISO-8859-1" || encodingName == "ISO8859-1" ||
+        encodingName == "ISO_8859-1" || encodingName == "LATIN1")
+    {
+      textEncoding = TextEncoding::Iso88591;
+      return true;
+    }
+    else if (encodingName == "US-ASCII" || encodingName == "ASCII")
+    {
+      textEncoding = TextEncoding::Ascii;
+      return true;
+    }
+
+    // All other encodings are handled only by SGFC
+    return false;
+  }
+
+  bool SgfcHeaderScanner::DecodeGameHeader(
+    const RawGameHeader& gameHeader,
+    TextEncoding textEncoding,
+    std::shared_ptr<ISgfcGameInfo>& gameInfo) const
+  {
+    SgfNodeData rootNodeData;
+    if (! CreateSgfNodeData(gameHeader.RootNode, true, gameHeader.IsRootNodeGameInfoNode, textEncoding, rootNodeData))
+      return false;
+
+    SgfcGameType gameType;
+    SgfcBoardSize boardSize;
+    try
+    {
+      gameType = SgfcPropertyDecoder::GetGameTypeFromNode(&rootNodeData.SgfNode);
+      boardSize = SgfcPropertyDecoder::GetBoardSizeFromNode(&rootNodeData.SgfNode, gameType);
+    }
+    catch (std::domain_error&)
+    {
+      return false;
+    }
+
+    // SGFC reports board sizes that violate the SGF standard
+    if (boardSize == SgfcConstants::BoardSizeInvalid)
+      return false;
+
+    std::shared_ptr<ISgfcNode> rootNode;
+    if (! DecodeNode(rootNodeData, gameType, boardSize, rootNode))
+      return false;
+
+    // Same post-processing as SgfcDocumentReader performs
+    auto propertyValueFactory = SgfcPlusPlusFactory::CreatePropertyValueFactory();
+    auto propertyFactory = SgfcPlusPlusFactory::CreatePropertyFactory();
+    auto caPropertyValue = propertyValueFactory->CreateSimpleTextPropertyValue(SgfcPrivateConstants::TextEncodingNameUTF8);
+    rootNode->SetProperty(propertyFactory->CreateProperty(SgfcPropertyType::CA, caPropertyValue));
+
+    if (gameHeader.IsRootNodeGameInfoNode)
+    {
+      gameInfo = SgfcPlusPlusFactory::CreateGameInfo(rootNode, rootNode);
+    }
+    else if (gameHeader.IsGameInfoNodeFound)
+    {
+      SgfNodeData gameInfoNodeData;
+      if (! CreateSgfNodeData(gameHeader.GameInfoNode, false, true, textEncoding, gameInfoNodeData))
+        return false;
+
+      std::shared_ptr<ISgfcNode> gameInfoNode;
+      if (! DecodeNode(gameInfoNodeData, gameType, boardSize, gameInfoNode))
+        return false;
+
+      gameInfo = SgfcPlusPlusFactory::CreateGameInfo(rootNode, gameInfoNode);
+    }
+    else
+    {
+      gameInfo = SgfcPlusPlusFactory::CreateGameInfo(rootNode);
+    }
+
+    return true;
+  }
+
+  /// @brief Fills @a sgfNodeData with the root properties (if @a isRootNode
+  /// is true) and the game info properties (if @a isGameInfoNode is true) of
+  /// @a rawNode. All other properties are ignored.
+  bool SgfcHeaderScanner::CreateSgfNodeData(
+    const RawNode& rawNode,
+    bool isRootNode,
+    bool isGameInfoNode,
+    TextEncoding textEncoding,
+    SgfNodeData& sgfNodeData) const
+  {
+    // The SGFC data structures point into the vectors, so the vectors must
+    // never reallocate. A composed value requires two strings.
+    std::size_t maximumNumberOfValues = 0;
+    for (const auto& rawProperty : rawNode)
+      maximumNumberOfValues += rawProperty.ValueRanges.size();
+    sgfNodeData.PropertyNames.reserve(rawNode.size());
+    sgfNodeData.SgfProperties.reserve(rawNode.size());
+    sgfNodeData.PropertyValues.reserve(maximumNumberOfValues * 2);
+    sgfNodeData.SgfPropertyValues.reserve(maximumNumberOfValues);
+
+    for (const auto& rawProperty : rawNode)
+    {
+      SgfcPropertyType propertyType = SgfcUtility::MapPropertyNameToPropertyType(rawProperty.PropertyName);
+      SgfcPropertyCategory propertyCategory = SgfcUtility::MapPropertyTypeToPropertyCategory(propertyType);
+
+      bool isPropertyRequired =
+        (isRootNode && propertyCategory == SgfcPropertyCategory::Root) ||
+        (isGameInfoNode && propertyCategory == SgfcPropertyCategory::GameInfo);
+      if (! isPropertyRequired)
+        continue;
+
+      // SGFC merges or deletes duplicate properties
+      auto it = std::find(sgfNodeData.PropertyNames.cbegin(), sgfNodeData.PropertyNames.cend(), rawProperty.PropertyName);
+      if (it != sgfNodeData.PropertyNames.cend())
+        return false;
+      sgfNodeData.PropertyNames.push_back(rawProperty.PropertyName);
+
+      // AP and SZ are the only root or game info properties that can have
+      // composed values. SGFC splits their values at the first unescaped
+      // colon.
+      bool canHaveComposedValue =
+        (propertyType == SgfcPropertyType::AP || propertyType == SgfcPropertyType::SZ);
+
+      Property sgfProperty = {};
+      sgfProperty.idstr = const_cast<char*>(sgfNodeData.PropertyNames.back().c_str());
+
+      for (const auto& valueRange : rawProperty.ValueRanges)
+      {
+        std::string propertyValue;
+        if (! GetPropertyValue(valueRange, textEncoding, propertyValue))
+          return false;
+
+        PropValue sgfPropertyValue = {};
+
+        std::size_t separatorPosition = canHaveComposedValue ? FindComposedValueSeparator(propertyValue) : std::string::npos;
+        if (separatorPosition == std::string::npos)
+        {
+          sgfNodeData.PropertyValues.push_back(propertyValue);
+          sgfPropertyValue.value = const_cast<char*>(sgfNodeData.PropertyValues.back().c_str());
+        }
+        else
+        {
+          sgfNodeData.PropertyValues.push_back(propertyValue.substr(0, separatorPosition));
+          sgfPropertyValue.value = const_cast<char*>(sgfNodeData.PropertyValues.back().c_str());
+          sgfNodeData.PropertyValues.push_back(propertyValue.substr(separatorPosition + 1));
+          sgfPropertyValue.value2 = const_cast<char*>(sgfNodeData.PropertyValues.back().c_str());
+        }
+
+        sgfNodeData.SgfPropertyValues.push_back(sgfPropertyValue);
+        PropValue* sgfPropertyValuePointer = &sgfNodeData.SgfPropertyValues.back();
+
+        if (sgfProperty.value == nullptr)
+          sgfProperty.value = sgfPropertyValuePointer;
+        else
+          sgfProperty.valend->next = sgfPropertyValuePointer;
+        sgfProperty.valend = sgfPropertyValuePointer;
+      }
+
+      sgfNodeData.SgfProperties.push_back(sgfProperty);
+      Property* sgfPropertyPointer = &sgfNodeData.SgfProperties.back();
+
+      if (sgfNodeData.SgfNode.prop == nullptr)
+        sgfNodeData.SgfNode.prop = sgfPropertyPointer;
+      else
+        sgfNodeData.SgfNode.last->next = sgfPropertyPointer;
+      sgfNodeData.SgfNode.last = sgfPropertyPointer;
+    }
+
+    return true;
+  }
+
+  bool SgfcHeaderScanner::DecodeNode(
+    const SgfNodeData& sgfNodeData,
+    SgfcGameType gameType,
+    SgfcBoardSize boardSize,
+    std::shared_ptr<ISgfcNode>& node) const
+  {
+    auto propertyFactory = SgfcPlusPlusFactory::CreatePropertyFactory();
+
+    std::vector<std::shared_ptr<ISgfcProperty>> properties;
+
+    for (const auto& sgfProperty : sgfNodeData.SgfProperties)
+    {
+      try
+      {
+        SgfcPropertyDecoder propertyDecoder(&sgfProperty, gameType, boardSize);
+
+        // SGFC would have removed the escape characters for us
+        propertyDecoder.SetEscapeProcessingEnabled(true);
+
+        std::vector<std::shared_ptr<ISgfcPropertyValue>> propertyValues = propertyDecoder.GetPropertyValues();
+
+        // SGFC reports and possibly deletes values that cannot be converted
+        for (const auto& propertyValue : propertyValues)
+        {
+          if (! HasTypedValue(propertyValue))
+            return false;
+        }
+
+        properties.push_back(propertyFactory->CreateProperty(propertyDecoder.GetPropertyType(), propertyValues));
+      }
+      catch (std::domain_error&)
+      {
+        return false;
+      }
+      catch (std::invalid_argument&)
+      {
+        return false;
+      }
+    }
+
+    node = SgfcPlusPlusFactory::CreateNode();
+    node->SetProperties(properties);
+
+    return true;
+  }
+
+  /// @brief Copies the raw property value in @a valueRange to
+  /// @a propertyValue and converts it to UTF-8.
+  ///
+  /// Returns false for values that SGFC would modify before handing them to
+  /// the library: Empty values, values with leading or trailing whitespace,
+  /// values with whitespace other than space and line breaks, and values
+  /// that cannot be decoded.
+  bool SgfcHeaderScanner::GetPropertyValue(
+    const std::pair<std::size_t, std::size_t>& valueRange,
+    TextEncoding textEncoding,
+    std::string& propertyValue) const
+  {
+    if (valueRange.first == valueRange.second)
+      return false;
+
+    if (IsWhitespace(this->sgfContent[valueRange.first]) ||
+        IsWhitespace(this->sgfContent[valueRange.second - 1]))
+    {
+      return false;
+    }
+
+    propertyValue.assign(this->sgfContent, valueRange.first, valueRange.second - valueRange.first);
+
+    bool isAscii = true;
+    for (char character : propertyValue)
+    {
+      unsigned char byte = static_cast<unsigned char>(character);
+      if (byte >= 0x80)
+        isAscii = false;
+      else if (byte < 0x20 && character != '\n' && character != '\r')
+        return false;
+    }
+
+    if (isAscii)
+      return true;
+
+    switch (textEncoding)
+    {
+      case TextEncoding::Utf8:
+        return IsValidUtf8(propertyValue);
+      case TextEncoding::Iso88591:
+        propertyValue = ConvertIso88591ToUtf8(propertyValue);
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  /// @brief Adds @a rawNode to @a gameHeader if it is the root node or the
+  /// first game info node of the game tree.
+  void SgfcHeaderScanner::EndNode(const RawNode& rawNode, bool isRootNode, RawGameHeader& gameHeader)
+  {
+    if (isRootNode)
+    {
+      gameHeader.RootNode = rawNode;
+
+      if (HasPropertyCategory(rawNode, SgfcPropertyCategory::GameInfo))
+      {
+        gameHeader.IsGameInfoNodeFound = true;
+        gameHeader.IsRootNodeGameInfoNode = true;
+      }
+    }
+    else if (! gameHeader.IsGameInfoNodeFound && HasPropertyCategory(rawNode, SgfcPropertyCategory::GameInfo))
+    {
+      // The SGF data is scanned in the same depth-first order in which
+      // ISgfcGame searches for the first game info node
+      gameHeader.GameInfoNode = rawNode;
+      gameHeader.IsGameInfoNodeFound = true;
+    }
+  }
+
+  bool SgfcHeaderScanner::HasPropertyCategory(const RawNode& rawNode, SgfcPropertyCategory propertyCategory)
+  {
+    for (const auto& rawProperty : rawNode)
+    {
+      SgfcPropertyType propertyType = SgfcUtility::MapPropertyNameToPropertyType(rawProperty.PropertyName);
+      if (SgfcUtility::MapPropertyTypeToPropertyCategory(propertyType) == propertyCategory)
+        return true;
+    }
+
+    return false;
+  }
+
+  bool SgfcHeaderScanner::IsWhitespace(char character)
+  {
+    switch (character)
+    {
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\r':
+      case '\v':
+      case '\f':
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  bool SgfcHeaderScanner::HasTypedValue(const std::shared_ptr<ISgfcPropertyValue>& propertyValue)
+  {
+    if (propertyValue->IsComposedValue())
+    {
+      const ISgfcComposedPropertyValue* composedPropertyValue = propertyValue->ToComposedValue();
+      return (composedPropertyValue->GetValue1()->HasTypedValue() &&
+              composedPropertyValue->GetValue2()->HasTypedValue());
+    }
+    else
+    {
+      return propertyValue->ToSingleValue()->HasTypedValue();
+    }
+  }
+
+  bool SgfcHeaderScanner::IsValidUtf8(const std::string& value)
+  {
+    std::size_t indexOfByte = 0;
+    while (indexOfByte < value.size())
+    {
+      unsigned char leadByte = static_cast<unsigned char>(value[indexOfByte]);
+
+      std::size_t numberOfContinuationBytes;
+      if (leadByte < 0x80)
+        numberOfContinuationBytes = 0;
+      else if (leadByte >= 0xC2 && leadByte <= 0xDF)
+        numberOfContinuationBytes = 1;
+      else if (leadByte >= 0xE0 && leadByte <= 0xEF)
+        numberOfContinuationBytes = 2;
+      else if (leadByte >= 0xF0 && leadByte <= 0xF4)
+        numberOfContinuationBytes = 3;
+      else
+        return false;
+
+      if (indexOfByte + numberOfContinuationBytes >= value.size())
+        return false;
+
+      for (std::size_t indexOfContinuationByte = 1; indexOfContinuationByte <= numberOfContinuationBytes; indexOfContinuationByte++)
+      {
+        unsigned char continuationByte = static_cast<unsigned char>(value[indexOfByte + indexOfContinuationByte]);
+        if ((continuationByte & 0xC0) != 0x80)
+          return false;
+      }
+
+      indexOfByte += numberOfContinuationBytes + 1;
+    }
+
+    return true;
+  }
+
+  std::string SgfcHeaderScanner::ConvertIso88591ToUtf8(const std::string& value)
+  {
+    std::string convertedValue;
+    convertedValue.reserve(value.size() * 2);
+
+    for (char character : value)
+    {
+      unsigned char byte = static_cast<unsigned char>(character);
+      if (byte < 0x80)
+      {
+        convertedValue.push_back(character);
+      }
+      else
+      {
+        convertedValue.push_back(static_cast<char>(0xC0 | (byte >> 6)));
+        convertedValue.push_back(static_cast<char>(0x80 | (byte & 0x3F)));
+      }
+    }
+
+    return convertedValue;
+  }
+
+  std::size_t SgfcHeaderScanner::FindComposedValueSeparator(const std::string& value)
+  {
+    for (std::size_t indexOfCharacter = 0; indexOfCharacter < value.size(); indexOfCharacter++)
+    {
+      if (value[indexOfCharacter] == '\\')
+        indexOfCharacter++;
+      else if (value[indexOfCharacter] == ':')
+        return indexOfCharacter;
+    }
+
+    return std::string::npos;
+  }
+}
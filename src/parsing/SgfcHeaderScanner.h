@@ -0,0 +1,152 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../include/SgfcBoardSize.h"
+#include "../../include/SgfcGameType.h"
+#include "../../include/SgfcPropertyCategory.h"
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcGameInfo;
+  class ISgfcNode;
+  class ISgfcPropertyValue;
+
+  /// @brief The SgfcHeaderScanner class scans raw SGF data for the root node
+  /// and the first game info node of each game tree and creates ISgfcGameInfo
+  /// objects from the root and game info properties in those nodes, without
+  /// involving SGFC.
+  ///
+  /// @ingroup internals
+  /// @ingroup parsing
+  ///
+  /// SgfcHeaderScanner tokenizes the SGF data just enough to find node and
+  /// property boundaries. Property values are located but not copied, except
+  /// for the values of the root and game info properties in the two nodes
+  /// that matter. Those values are decoded with SgfcPropertyDecoder with
+  /// escape processing enabled, i.e. in the same way as SgfcDocument decodes
+  /// the values that it receives from SGFC.
+  ///
+  /// SgfcHeaderScanner does not attempt to correct anything. Whenever it
+  /// encounters something that SGFC would report or fix, it gives up and
+  /// lets the caller fall back to the full SGFC read. See the
+  /// ISgfcGameInfoScanner interface documentation for the list of cases.
+  class SgfcHeaderScanner
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcHeaderScanner object that
+    /// scans @a sgfContent. The object keeps a reference to @a sgfContent,
+    /// the string must outlive the object.
+    SgfcHeaderScanner(const std::string& sgfContent);
+
+    /// @brief Destroys and cleans up the SgfcHeaderScanner object.
+    virtual ~SgfcHeaderScanner();
+
+    /// @brief Scans the SGF data and adds one ISgfcGameInfo object per game
+    /// tree to @a gameInfos.
+    ///
+    /// @retval true if the SGF data was scanned successfully.
+    /// @retval false if the SGF data cannot be handled by SgfcHeaderScanner.
+    ///         The content of @a gameInfos is undefined in this case.
+    bool ScanGameInfos(std::vector<std::shared_ptr<ISgfcGameInfo>>& gameInfos) const;
+
+  private:
+    /// @brief The text encodings that SgfcHeaderScanner is able to decode.
+    enum class TextEncoding
+    {
+      Ascii,
+      Utf8,
+      Iso88591,
+    };
+
+    /// @brief The RawProperty struct holds the location of the raw values of
+    /// a property in the SGF data.
+    struct RawProperty
+    {
+      std::string PropertyName;
+      /// @brief Pairs of begin and end positions, the brackets are excluded.
+      std::vector<std::pair<std::size_t, std::size_t>> ValueRanges;
+    };
+
+    typedef std::vector<RawProperty> RawNode;
+
+    /// @brief The RawGameHeader struct holds the raw properties of the root
+    /// node and of the first game info node of a game tree.
+    struct RawGameHeader
+    {
+      RawNode RootNode;
+      RawNode GameInfoNode;
+      bool IsGameInfoNodeFound = false;
+      bool IsRootNodeGameInfoNode = false;
+    };
+
+    const std::string& sgfContent;
+
+    bool ScanGameTree(
+      std::size_t& position,
+      RawGameHeader& gameHeader,
+      RawProperty& firstCaProperty) const;
+    bool ScanProperty(std::size_t& position, RawProperty& rawProperty) const;
+    void SkipWhitespace(std::size_t& position) const;
+    bool FindFirstGameTree(std::size_t& position) const;
+
+    /// @brief The SgfNodeData struct holds the SGFC data structures that
+    /// SgfcPropertyDecoder expects for a node. The struct is defined in the
+    /// implementation file because it needs the SGFC includes.
+    struct SgfNodeData;
+
+    bool GetTextEncoding(
+      bool hasUtf8ByteOrderMark,
+      const RawProperty& firstCaProperty,
+      TextEncoding& textEncoding) const;
+    bool DecodeGameHeader(
+      const RawGameHeader& gameHeader,
+      TextEncoding textEncoding,
+      std::shared_ptr<ISgfcGameInfo>& gameInfo) const;
+    bool CreateSgfNodeData(
+      const RawNode& rawNode,
+      bool isRootNode,
+      bool isGameInfoNode,
+      TextEncoding textEncoding,
+      SgfNodeData& sgfNodeData) const;
+    bool DecodeNode(
+      const SgfNodeData& sgfNodeData,
+      SgfcGameType gameType,
+      SgfcBoardSize boardSize,
+      std::shared_ptr<ISgfcNode>& node) const;
+    bool GetPropertyValue(
+      const std::pair<std::size_t, std::size_t>& valueRange,
+      TextEncoding textEncoding,
+      std::string& propertyValue) const;
+
+    static void EndNode(const RawNode& rawNode, bool isRootNode, RawGameHeader& gameHeader);
+    static bool HasPropertyCategory(const RawNode& rawNode, SgfcPropertyCategory propertyCategory);
+    static bool IsWhitespace(char character);
+    static bool HasTypedValue(const std::shared_ptr<ISgfcPropertyValue>& propertyValue);
+    static bool IsValidUtf8(const std::string& value);
+    static std::string ConvertIso88591ToUtf8(const std::string& value);
+    static std::size_t FindComposedValueSeparator(const std::string& value);
+  };
+}
@@ -0,0 +1,215 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../include/ISgfcParseEventHandler.h"
+#include "../../include/ISgfcPropertyValueFactory.h"
+#include "../../include/ISgfcSimpleTextPropertyValue.h"
+#include "../../include/SgfcPlusPlusFactory.h"
+#include "../SgfcPrivateConstants.h"
+#include "../SgfcUtility.h"
+#include "SgfcParseEventGenerator.h"
+#include "SgfcPropertyDecoder.h"
+
+// C++ Standard Library includes
+#include <stack>
+#include <stdexcept>
+#include <vector>
+
+// SGFC includes
+extern "C"
+{
+  #include "../../sgfc/src/all.h"
+  #include "../../sgfc/src/protos.h"
+}
+
+namespace LibSgfcPlusPlus
+{
+  SgfcParseEventGenerator::SgfcParseEventGenerator(SGFInfo* sgfInfo, bool isTextEncodingUtf8)
+    : sgfInfo(sgfInfo)
+    , isTextEncodingUtf8(isTextEncodingUtf8)
+  {
+    if (sgfInfo == nullptr)
+      throw std::invalid_argument("SgfcParseEventGenerator constructor failed: SGFInfo object is nullptr");
+  }
+
+  SgfcParseEventGenerator::~SgfcParseEventGenerator()
+  {
+  }
+
+  bool SgfcParseEventGenerator::GenerateEvents(ISgfcParseEventHandler& eventHandler, std::string& errorMessage) const
+  {
+    // Game trees are linked via the sibling pointer of their root nodes
+    Node* sgfRootNode = this->sgfInfo->root;
+    while (sgfRootNode)
+    {
+      if (! GenerateGameEvents(sgfRootNode, eventHandler, errorMessage))
+        return false;
+
+      sgfRootNode = sgfRootNode->sibling;
+    }
+
+    return true;
+  }
+
+  bool SgfcParseEventGenerator::GenerateGameEvents(
+    Node* sgfRootNode,
+    ISgfcParseEventHandler& eventHandler,
+    std::string& errorMessage) const
+  {
+    SgfcGameType gameType;
+    SgfcBoardSize boardSize;
+    try
+    {
+      gameType = SgfcPropertyDecoder::GetGameTypeFromNode(sgfRootNode);
+      boardSize = SgfcPropertyDecoder::GetBoardSizeFromNode(sgfRootNode, gameType);
+    }
+    catch (std::domain_error& exception)
+    {
+      errorMessage = exception.what();
+      return false;
+    }
+
+    eventHandler.BeginGame(gameType, boardSize);
+
+    // A stack entry either refers to a node whose events must be generated,
+    // or it is a marker for the end of a variation (sgfNode is nullptr).
+    // Pushing the variation end marker before the node's children ensures
+    // that it is popped only after all descendants have been visited.
+    struct StackEntry
+    {
+      Node* sgfNode;
+      bool isVariationBegin;
+    };
+
+    std::stack<StackEntry> stack;
+    stack.push({ sgfRootNode, false });
+
+    while (! stack.empty())
+    {
+      StackEntry stackEntry = stack.top();
+      stack.pop();
+
+      if (stackEntry.sgfNode == nullptr)
+      {
+        eventHandler.EndVariation();
+        continue;
+      }
+
+      if (stackEntry.isVariationBegin)
+      {
+        eventHandler.BeginVariation();
+        stack.push({ nullptr, false });
+      }
+
+      bool isRootNode = (stackEntry.sgfNode == sgfRootNode);
+      if (! GenerateNodeEvents(stackEntry.sgfNode, isRootNode, gameType, boardSize, eventHandler, errorMessage))
+        return false;
+
+      // Collect the children first because the stack needs them in reverse
+      // order, so that the first child is visited first
+      std::vector<Node*> sgfChildNodes;
+      for (Node* sgfChildNode = stackEntry.sgfNode->child; sgfChildNode != nullptr; sgfChildNode = sgfChildNode->sibling)
+        sgfChildNodes.push_back(sgfChildNode);
+
+      bool isVariation = (sgfChildNodes.size() > 1);
+      for (auto iterator = sgfChildNodes.rbegin(); iterator != sgfChildNodes.rend(); ++iterator)
+        stack.push({ *iterator, isVariation });
+    }
+
+    eventHandler.EndGame();
+
+    return true;
+  }
+
+  bool SgfcParseEventGenerator::GenerateNodeEvents(
+    Node* sgfNode,
+    bool isRootNode,
+    SgfcGameType gameType,
+    SgfcBoardSize boardSize,
+    ISgfcParseEventHandler& eventHandler,
+    std::string& errorMessage) const
+  {
+    struct DecodedProperty
+    {
+      SgfcPropertyType PropertyType;
+      std::string PropertyName;
+      std::vector<std::shared_ptr<ISgfcPropertyValue>> PropertyValues;
+    };
+
+    bool reportUtf8TextEncoding = isRootNode && this->isTextEncodingUtf8;
+    std::vector<std::shared_ptr<ISgfcPropertyValue>> utf8TextEncodingPropertyValues;
+    if (reportUtf8TextEncoding)
+    {
+      auto propertyValueFactory = SgfcPlusPlusFactory::CreatePropertyValueFactory();
+      utf8TextEncodingPropertyValues.push_back(
+        propertyValueFactory->CreateSimpleTextPropertyValue(SgfcPrivateConstants::TextEncodingNameUTF8));
+    }
+
+    // Decode all properties before the first event is generated, so that the
+    // event handler never sees an incomplete node
+    std::vector<DecodedProperty> decodedProperties;
+    bool isTextEncodingPropertyPresent = false;
+    try
+    {
+      Property* sgfProperty = sgfNode->prop;
+      while (sgfProperty)
+      {
+        SgfcPropertyDecoder propertyDecoder(sgfProperty, gameType, boardSize);
+
+        SgfcPropertyType propertyType = propertyDecoder.GetPropertyType();
+        if (reportUtf8TextEncoding && propertyType == SgfcPropertyType::CA)
+        {
+          decodedProperties.push_back({ propertyType, propertyDecoder.GetPropertyName(), utf8TextEncodingPropertyValues });
+          isTextEncodingPropertyPresent = true;
+        }
+        else
+        {
+          decodedProperties.push_back({ propertyType, propertyDecoder.GetPropertyName(), propertyDecoder.GetPropertyValues() });
+        }
+
+        sgfProperty = sgfProperty->next;
+      }
+    }
+    catch (std::domain_error& exception)
+    {
+      errorMessage = exception.what();
+      return false;
+    }
+
+    if (reportUtf8TextEncoding && ! isTextEncodingPropertyPresent)
+    {
+      decodedProperties.push_back({
+        SgfcPropertyType::CA,
+        SgfcUtility::MapPropertyTypeToPropertyName(SgfcPropertyType::CA),
+        utf8TextEncodingPropertyValues });
+    }
+
+    eventHandler.BeginNode();
+
+    for (const auto& decodedProperty : decodedProperties)
+    {
+      eventHandler.Property(
+        decodedProperty.PropertyType,
+        decodedProperty.PropertyName,
+        decodedProperty.PropertyValues);
+    }
+
+    eventHandler.EndNode();
+
+    return true;
+  }
+}
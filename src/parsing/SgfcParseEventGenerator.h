@@ -0,0 +1,89 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../include/SgfcBoardSize.h"
+#include "../../include/SgfcGameType.h"
+
+// C++ Standard Library includes
+#include <string>
+
+// Forward declarations
+struct SGFInfo;
+struct Node;
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcParseEventHandler;
+
+  /// @brief The SgfcParseEventGenerator class walks the data structures that
+  /// SGFC creates when it parses SGF data and reports the content to an
+  /// ISgfcParseEventHandler. See the ISgfcParseEventHandler interface
+  /// documentation for the order of events.
+  ///
+  /// @ingroup internals
+  /// @ingroup parsing
+  ///
+  /// SgfcParseEventGenerator decodes property values with
+  /// SgfcPropertyDecoder, i.e. in the same way as SgfcDocument does when it
+  /// builds a document object tree. The only state that
+  /// SgfcParseEventGenerator keeps while it walks a game tree is a stack of
+  /// the nodes whose children still have to be visited.
+  class SgfcParseEventGenerator
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcParseEventGenerator object
+    /// that reports the content of @a sgfInfo.
+    ///
+    /// If @a isTextEncodingUtf8 is true, SgfcParseEventGenerator reports the
+    /// CA property value "UTF-8" in the root node of each game, regardless of
+    /// whether the SGF data contains a CA property. This mirrors the
+    /// post-processing that SgfcDocumentReader performs.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a sgfInfo is
+    /// @e nullptr.
+    SgfcParseEventGenerator(SGFInfo* sgfInfo, bool isTextEncodingUtf8);
+
+    /// @brief Destroys and cleans up the SgfcParseEventGenerator object.
+    virtual ~SgfcParseEventGenerator();
+
+    /// @brief Reports the content of the SGFInfo object to @a eventHandler.
+    ///
+    /// @retval true if all events were generated.
+    /// @retval false if the SGFC data structures contain data that cannot be
+    ///         decoded. Event generation stops at that point and
+    ///         @a errorMessage is set to a description of the problem.
+    ///
+    /// Exceptions thrown by @a eventHandler are passed through.
+    bool GenerateEvents(ISgfcParseEventHandler& eventHandler, std::string& errorMessage) const;
+
+  private:
+    SGFInfo* sgfInfo;
+    bool isTextEncodingUtf8;
+
+    bool GenerateGameEvents(Node* sgfRootNode, ISgfcParseEventHandler& eventHandler, std::string& errorMessage) const;
+    bool GenerateNodeEvents(
+      Node* sgfNode,
+      bool isRootNode,
+      SgfcGameType gameType,
+      SgfcBoardSize boardSize,
+      ISgfcParseEventHandler& eventHandler,
+      std::string& errorMessage) const;
+  };
+}
@@ -87,6 +87,28 @@ namespace LibSgfcPlusPlus
     this->arguments.clear();
   }
 
+  void SgfcArguments::CopyArguments(
+    const ISgfcArguments& sourceArguments,
+    ISgfcArguments& destinationArguments)
+  {
+    destinationArguments.ClearArguments();
+
+    for (const auto& argument : sourceArguments.GetArguments())
+    {
+      SgfcArgumentType argumentType = argument->GetArgumentType();
+      if (argument->HasIntegerTypeParameter())
+        destinationArguments.AddArgument(argumentType, argument->GetIntegerTypeParameter());
+      else if (argument->HasStringTypeParameter())
+        destinationArguments.AddArgument(argumentType, argument->GetStringTypeParameter());
+      else if (argument->HasPropertyTypeParameter())
+        destinationArguments.AddArgument(argumentType, argument->GetPropertyTypeParameter());
+      else if (argument->HasMessageIDParameter())
+        destinationArguments.AddArgument(argumentType, argument->GetMessageIDParameter());
+      else
+        destinationArguments.AddArgument(argumentType);
+    }
+  }
+
   bool SgfcArguments::ArgumentTypeCanBeAddedMultipleTimes(SgfcArgumentType argumentType) const
   {
     switch (argumentType)
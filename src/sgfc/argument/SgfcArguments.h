@@ -48,6 +48,16 @@ namespace LibSgfcPlusPlus
 
     virtual void ClearArguments() override;
 
+    /// @brief Replaces the arguments in @a destinationArguments with copies
+    /// of the arguments in @a sourceArguments.
+    ///
+    /// This is useful to give each of several worker threads its own
+    /// collection of arguments, so that the library client can modify the
+    /// original collection while the worker threads are running.
+    static void CopyArguments(
+      const ISgfcArguments& sourceArguments,
+      ISgfcArguments& destinationArguments);
+
   private:
     std::vector<std::shared_ptr<ISgfcArgument>> arguments;
 
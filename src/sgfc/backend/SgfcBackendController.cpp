@@ -22,6 +22,7 @@
 #include "../save/SgfcSaveStream.h"
 #include "../save/SgfcSgfContent.h"
 #include "SgfcBackendController.h"
+#include "SgfcCompressionUtility.h"
 
 // SGFC includes
 extern "C"
@@ -32,6 +33,7 @@ extern "C"
 
 // C++ Standard Library includes
 #include <algorithm>
+#include <cstdlib>  // for free()
 #include <fstream>
 #include <mutex>
 #include <stdexcept>
@@ -99,6 +101,10 @@ namespace LibSgfcPlusPlus
 
   std::shared_ptr<SgfcBackendLoadResult> SgfcBackendController::LoadSgfFile(const std::string& sgfFilePath)
   {
+    SgfcCompressionFormat compressionFormat = SgfcCompressionUtility::GetCompressionFormatOfFile(sgfFilePath);
+    if (compressionFormat != SgfcCompressionFormat::None)
+      return LoadCompressedSgfFile(sgfFilePath, compressionFormat);
+
     std::string sgfContent;
     return LoadSgfContentFromFilesystemOrInMemoryBuffer(sgfFilePath, sgfContent, SgfcDataLocation::Filesystem);
   }
@@ -286,110 +292,218 @@ namespace LibSgfcPlusPlus
     }
   }
 
-  std::shared_ptr<SgfcBackendSaveResult> SgfcBackendController::SaveSgfContentToFilesystemOrInMemoryBuffer(
+  std::shared_ptr<SgfcBackendLoadResult> SgfcBackendController::LoadCompressedSgfFile(
     const std::string& sgfFilePath,
-    std::string& sgfContent,
-    std::shared_ptr<SgfcBackendDataWrapper> sgfDataWrapper,
-    SgfcDataLocation dataLocation)
+    SgfcCompressionFormat compressionFormat)
   {
     ThrowIfIsCommandLineValidReturnsFalse();
 
-    std::lock_guard sgfcGuard(sgfcMutex);
+    // Decompress before acquiring the SGFC mutex so that decompression does
+    // not block other threads that are waiting for SGFC. The buffer is handed
+    // over to SGFC as is, so the uncompressed data exists only once.
+    char* sgfContentBuffer = nullptr;
+    std::size_t sgfContentSize = 0;
+    try
+    {
+      sgfContentBuffer = SgfcCompressionUtility::DecompressFile(sgfFilePath, compressionFormat, sgfContentSize);
+    }
+    catch (std::exception& exception)
+    {
+      std::string messageString = "Reading SGF file failed: " + std::string(exception.what());
+
+      std::vector<std::shared_ptr<ISgfcMessage>> loadOperationMessages;
+      loadOperationMessages.push_back(std::shared_ptr<ISgfcMessage>(new SgfcMessage(
+        SgfcMessageID::ReadSgfContentFromFilesystemError,
+        messageString)));
 
-    this->sgfcOptions.RestoreOptions(sgfDataWrapper->GetSgfData()->options);
+      std::shared_ptr<SgfcBackendLoadResult> backendLoadResult =
+        std::shared_ptr<SgfcBackendLoadResult>(new SgfcBackendLoadResult(loadOperationMessages, nullptr));
+      return backendLoadResult;
+    }
 
-    SgfcMessageStream messageStream;
+    std::lock_guard sgfcGuard(sgfcMutex);
 
     try
     {
-      bool loadDataWasSuccessful = true;
-      if (sgfDataWrapper->GetDataState() == SgfcBackendDataState::PartiallyLoaded)
+      std::shared_ptr<SgfcBackendDataWrapper> sgfDataWrapper;
+      try
       {
-        // LoadSGFFromFileBuffer returns false if a fatal error occurred
-        loadDataWasSuccessful = LoadSGFFromFileBuffer(sgfDataWrapper->GetSgfData());
-        if (loadDataWasSuccessful)
-        {
-          // ParseSGF never has fatal errors, so it does not return a status
-          ParseSGF(sgfDataWrapper->GetSgfData());
-          sgfDataWrapper->SetDataState(SgfcBackendDataState::FullyLoaded);
-        }
+        sgfDataWrapper = std::shared_ptr<SgfcBackendDataWrapper>(new SgfcBackendDataWrapper(sgfContentBuffer, sgfContentSize));
       }
+      catch (...)
+      {
+        // The SgfcBackendDataWrapper did not take ownership of the buffer
+        free(sgfContentBuffer);
+        throw;
+      }
+
+      this->sgfcOptions.RestoreOptions(sgfDataWrapper->GetSgfData()->options);
 
-      std::vector<std::shared_ptr<SgfcSgfContent>> savedSgfContents;
+      SgfcMessageStream messageStream;
 
-      // Don't attempt to save if loading was not successful
-      if (loadDataWasSuccessful)
+      // LoadSGFFromFileBuffer returns false if a fatal error occurred
+      bool loadSgfWasSuccessful = LoadSGFFromFileBuffer(sgfDataWrapper->GetSgfData());
+      if (loadSgfWasSuccessful)
       {
-        SgfcSaveStream saveStream;
-
-        // SaveSGF() expects to receive a file name, so we have to give it one
-        // even for SgfcDataLocation::InMemoryBuffer where we dont actually
-        // interact with the filesystem. SaveSGF() can handle an empty file
-        // name.
-        // SaveSGF returns false if a fatal error occurred (which is exposed
-        // to clients via ISgfcMessage) or in case the save handler factory
-        // method in SgfcSaveStream returns nothing, i.e. an interfacing issue.
-        bool saveDataWasSuccessful = SaveSGF(sgfDataWrapper->GetSgfData(), &SgfcSaveStream::CreateSaveFileHandler, sgfFilePath.c_str());
-        if (saveDataWasSuccessful)
-          savedSgfContents = saveStream.GetSgfContents();
+        // ParseSGF never has fatal errors, so it does not return a status
+        ParseSGF(sgfDataWrapper->GetSgfData());
+        sgfDataWrapper->SetDataState(SgfcBackendDataState::FullyLoaded);
       }
 
-      // Here we get all messages, even messages from LoadSGFFromFileBuffer
-      // and ParseSGF
-      std::vector<std::shared_ptr<ISgfcMessage>> saveOperationMessages = messageStream.GetMessagees();
+      std::vector<std::shared_ptr<ISgfcMessage>> loadOperationMessages = messageStream.GetMessagees();
+
+      std::shared_ptr<SgfcBackendLoadResult> backendLoadResult =
+        std::shared_ptr<SgfcBackendLoadResult>(new SgfcBackendLoadResult(loadOperationMessages, sgfDataWrapper));
+      return backendLoadResult;
+    }
+    catch (std::runtime_error&)
+    {
+      // The SgfcBackendDataWrapper constructor and LoadSGFFromFileBuffer()
+      // throw std::runtime_error if SGFC fails to allocate memory. See
+      // LoadSgfContentFromFilesystemOrInMemoryBuffer() for details.
+
+      std::vector<std::shared_ptr<ISgfcMessage>> loadOperationMessages;
+      loadOperationMessages.push_back(std::shared_ptr<ISgfcMessage>(new SgfcMessage(
+        SgfcMessageID::OutOfMemoryError,
+        "Memory allocation failed during load operation")));
+
+      std::shared_ptr<SgfcBackendLoadResult> backendLoadResult =
+        std::shared_ptr<SgfcBackendLoadResult>(new SgfcBackendLoadResult(loadOperationMessages, nullptr));
+      return backendLoadResult;
+    }
+  }
+
+  std::shared_ptr<SgfcBackendSaveResult> SgfcBackendController::SaveSgfContentToFilesystemOrInMemoryBuffer(
+    const std::string& sgfFilePath,
+    std::string& sgfContent,
+    std::shared_ptr<SgfcBackendDataWrapper> sgfDataWrapper,
+    SgfcDataLocation dataLocation)
+  {
+    ThrowIfIsCommandLineValidReturnsFalse();
+
+    std::vector<std::shared_ptr<SgfcSgfContent>> savedSgfContents;
+    std::vector<std::shared_ptr<ISgfcMessage>> saveOperationMessages;
+
+    // Only the interaction with SGFC must be serialized. The SGF content that
+    // SGFC generates is written to the filesystem after the lock has been
+    // released, so that threads that save different documents can write
+    // their files concurrently.
+    {
+      std::lock_guard sgfcGuard(sgfcMutex);
+
+      this->sgfcOptions.RestoreOptions(sgfDataWrapper->GetSgfData()->options);
 
-      // Initialize the out variable
-      if (dataLocation == SgfcDataLocation::InMemoryBuffer)
-        sgfContent = std::string();
+      SgfcMessageStream messageStream;
 
-      for (auto sgfContentLoop : savedSgfContents)
+      try
       {
-        if (dataLocation == SgfcDataLocation::Filesystem)
+        bool loadDataWasSuccessful = true;
+        if (sgfDataWrapper->GetDataState() == SgfcBackendDataState::PartiallyLoaded)
         {
-          bool success = SaveSgfContentToFilesystem(sgfContentLoop);
-          if (! success)
+          // LoadSGFFromFileBuffer returns false if a fatal error occurred
+          loadDataWasSuccessful = LoadSGFFromFileBuffer(sgfDataWrapper->GetSgfData());
+          if (loadDataWasSuccessful)
           {
-            std::string messageString = "Writing SGF file failed: " + sgfContentLoop->GetFilePath();
-
-            auto message = std::shared_ptr<ISgfcMessage>(new SgfcMessage(
-              SgfcMessageID::SaveSgfContentToFilesystemError,
-              messageString));
-
-            saveOperationMessages.push_back(message);
+            // ParseSGF never has fatal errors, so it does not return a status
+            ParseSGF(sgfDataWrapper->GetSgfData());
+            sgfDataWrapper->SetDataState(SgfcBackendDataState::FullyLoaded);
           }
         }
-        else
+
+        // Don't attempt to save if loading was not successful
+        if (loadDataWasSuccessful)
         {
-          sgfContent += sgfContentLoop->GetSgfContent();
+          SgfcSaveStream saveStream;
+
+          // SaveSGF() expects to receive a file name, so we have to give it one
+          // even for SgfcDataLocation::InMemoryBuffer where we dont actually
+          // interact with the filesystem. SaveSGF() can handle an empty file
+          // name.
+          // SaveSGF returns false if a fatal error occurred (which is exposed
+          // to clients via ISgfcMessage) or in case the save handler factory
+          // method in SgfcSaveStream returns nothing, i.e. an interfacing issue.
+          bool saveDataWasSuccessful = SaveSGF(sgfDataWrapper->GetSgfData(), &SgfcSaveStream::CreateSaveFileHandler, sgfFilePath.c_str());
+          if (saveDataWasSuccessful)
+            savedSgfContents = saveStream.GetSgfContents();
         }
-      }
 
-      std::shared_ptr<SgfcBackendSaveResult> backendSaveResult =
-        std::shared_ptr<SgfcBackendSaveResult>(new SgfcBackendSaveResult(saveOperationMessages));
-      return backendSaveResult;
+        // Here we get all messages, even messages from LoadSGFFromFileBuffer
+        // and ParseSGF
+        saveOperationMessages = messageStream.GetMessagees();
+      }
+      catch (std::runtime_error&)
+      {
+        // LoadSGFFromFileBuffer(), ParseArgs() and SaveSGF() all throw
+        // std::runtime_error if SGFC fails to allocate memory. We handle the
+        // exception and hope that freeing some memory will magically save the
+        // OS process from crashing.
+
+        saveOperationMessages.clear();
+        saveOperationMessages.push_back(std::shared_ptr<ISgfcMessage>(new SgfcMessage(
+          SgfcMessageID::OutOfMemoryError,
+          "Memory allocation failed during load operation")));
+
+        std::shared_ptr<SgfcBackendSaveResult> backendSaveResult =
+          std::shared_ptr<SgfcBackendSaveResult>(new SgfcBackendSaveResult(saveOperationMessages));
+        return backendSaveResult;
+      }
     }
-    catch (std::runtime_error&)
+
+    // Initialize the out variable
+    if (dataLocation == SgfcDataLocation::InMemoryBuffer)
+      sgfContent = std::string();
+
+    for (auto sgfContentLoop : savedSgfContents)
     {
-      // LoadSGFFromFileBuffer(), ParseArgs() and SaveSGF() all throw
-      // std::runtime_error if SGFC fails to allocate memory. We handle the
-      // exception and hope that freeing some memory will magically save the
-      // OS process from crashing.
+      if (dataLocation == SgfcDataLocation::Filesystem)
+      {
+        bool success = SaveSgfContentToFilesystem(sgfContentLoop);
+        if (! success)
+        {
+          std::string messageString = "Writing SGF file failed: " + sgfContentLoop->GetFilePath();
 
-      std::vector<std::shared_ptr<ISgfcMessage>> saveOperationMessages;
-      saveOperationMessages.push_back(std::shared_ptr<ISgfcMessage>(new SgfcMessage(
-        SgfcMessageID::OutOfMemoryError,
-        "Memory allocation failed during load operation")));
+          SgfcCompressionFormat compressionFormat = SgfcCompressionUtility::GetCompressionFormatOfFileName(sgfContentLoop->GetFilePath());
+          if (! SgfcCompressionUtility::IsCompressionFormatSupported(compressionFormat))
+          {
+            messageString +=
+              " (support for " + SgfcCompressionUtility::GetCompressionFormatName(compressionFormat) +
+              " compression is not available in this build of the library)";
+          }
 
-      std::shared_ptr<SgfcBackendSaveResult> backendSaveResult =
-        std::shared_ptr<SgfcBackendSaveResult>(new SgfcBackendSaveResult(saveOperationMessages));
-      return backendSaveResult;
+          auto message = std::shared_ptr<ISgfcMessage>(new SgfcMessage(
+            SgfcMessageID::SaveSgfContentToFilesystemError,
+            messageString));
+
+          saveOperationMessages.push_back(message);
+        }
+      }
+      else
+      {
+        sgfContent += sgfContentLoop->GetSgfContent();
+      }
     }
+
+    std::shared_ptr<SgfcBackendSaveResult> backendSaveResult =
+      std::shared_ptr<SgfcBackendSaveResult>(new SgfcBackendSaveResult(saveOperationMessages));
+    return backendSaveResult;
   }
 
   bool SgfcBackendController::SaveSgfContentToFilesystem(std::shared_ptr<SgfcSgfContent> sgfContent) const
   {
     std::string fileName = sgfContent->GetFilePath();
 
+    // The file name extension selects the compression format. The content is
+    // streamed through the compressor, so no compressed copy is held in
+    // memory.
+    SgfcCompressionFormat compressionFormat = SgfcCompressionUtility::GetCompressionFormatOfFileName(fileName);
+    if (compressionFormat != SgfcCompressionFormat::None)
+    {
+      if (! SgfcCompressionUtility::IsCompressionFormatSupported(compressionFormat))
+        return false;
+
+      return SgfcCompressionUtility::CompressToFile(sgfContent->GetSgfContent(), fileName, compressionFormat);
+    }
+
     std::ofstream out(fileName);
     if (out.fail())
       return false;  // SGFC generates fatal error FE_DEST_FILE_OPEN for this
@@ -22,6 +22,7 @@
 #include "SgfcBackendDataWrapper.h"
 #include "SgfcBackendLoadResult.h"
 #include "SgfcBackendSaveResult.h"
+#include "SgfcCompressionFormat.h"
 #include "SgfcDataLocation.h"
 #include "SgfcOptions.h"
 
@@ -154,6 +155,12 @@ namespace LibSgfcPlusPlus
     /// load operation. Notably if the operation was successful the result
     /// object contains the SGF content that was loaded.
     ///
+    /// If the file is compressed (gzip or Zstandard, detected by the magic
+    /// number at the start of the file) it is decompressed before it is put
+    /// through the SGFC parser. If support for the compression format was not
+    /// enabled when the library was built, the result object contains a fatal
+    /// error message.
+    ///
     /// @exception std::logic_error Is thrown if IsCommandLineValid() returns
     /// false.
     std::shared_ptr<SgfcBackendLoadResult> LoadSgfFile(
@@ -178,6 +185,11 @@ namespace LibSgfcPlusPlus
     ///
     /// If a file already exists at the specified path it is overwritten.
     ///
+    /// If @a sgfFilePath has the file name extension ".gz" or ".zst", the
+    /// file is written compressed in the gzip or Zstandard format. If support
+    /// for the compression format was not enabled when the library was built,
+    /// the result object contains a fatal error message.
+    ///
     /// Before SgfcBackendController can invoke the SGFC save function, it
     /// needs to pass the SGF content through SGFC's load/parse functions.
     /// The messages in the result object therefore are a combination of a full
@@ -228,6 +240,9 @@ namespace LibSgfcPlusPlus
       const std::string& sgfFilePath,
       const std::string& sgfContent,
       SgfcDataLocation dataLocation);
+    std::shared_ptr<SgfcBackendLoadResult> LoadCompressedSgfFile(
+      const std::string& sgfFilePath,
+      SgfcCompressionFormat compressionFormat);
     std::shared_ptr<SgfcBackendSaveResult> SaveSgfContentToFilesystemOrInMemoryBuffer(
       const std::string& sgfFilePath,
       std::string& sgfContent,
@@ -44,6 +44,13 @@ namespace LibSgfcPlusPlus
     this->dataState = SgfcBackendDataState::PartiallyLoaded;
   }
 
+  SgfcBackendDataWrapper::SgfcBackendDataWrapper(char* sgfContentBuffer, std::size_t sgfContentSize)
+    : SgfcBackendDataWrapper()
+  {
+    InitializeFileBuffer(sgfContentBuffer, sgfContentSize);
+    this->dataState = SgfcBackendDataState::PartiallyLoaded;
+  }
+
   SgfcBackendDataWrapper::~SgfcBackendDataWrapper()
   {
     if (this->sgfData)
@@ -82,9 +89,22 @@ namespace LibSgfcPlusPlus
   void SgfcBackendDataWrapper::InitializeFileBuffer(const std::string& sgfContent) const
   {
     size_t sgfContentSize = sgfContent.size();
-    this->sgfData->buffer = (char *) malloc((size_t) sgfContentSize);
+    char* sgfContentBuffer = (char *) malloc((size_t) sgfContentSize);
 
-    memcpy(this->sgfData->buffer, sgfContent.c_str(), sgfContentSize);
+    memcpy(sgfContentBuffer, sgfContent.c_str(), sgfContentSize);
+
+    InitializeFileBuffer(sgfContentBuffer, sgfContentSize);
+  }
+
+  /// @brief Sets up the SGFInfo object with the buffer @a sgfContentBuffer,
+  /// which must have been allocated with malloc(). The SGFInfo object takes
+  /// ownership of the buffer.
+  ///
+  /// See the other overload of InitializeFileBuffer() for details about the
+  /// state of the SGFInfo object when this method returns.
+  void SgfcBackendDataWrapper::InitializeFileBuffer(char* sgfContentBuffer, std::size_t sgfContentSize) const
+  {
+    this->sgfData->buffer = sgfContentBuffer;
 
     // Some implementations of malloc return nullptr when a zero-size buffer is
     // requested. In that case doing pointer arithmetic would be fatal, so
@@ -20,6 +20,7 @@
 #include "SgfcBackendDataState.h"
 
 // C++ Standard Library includes
+#include <cstddef>
 #include <string>
 
 // Forward declarations
@@ -76,6 +77,20 @@ namespace LibSgfcPlusPlus
     /// state is SgfcBackendDataState::PartiallyLoaded.
     SgfcBackendDataWrapper(const std::string& sgfContent);
 
+    /// @brief Initializes a newly constructed SgfcBackendDataWrapper object
+    /// that wraps an SGFInfo data structure that contains the file buffer
+    /// @a sgfContentBuffer, which holds @a sgfContentSize bytes of SGF
+    /// content. SGFC save operations that use the SGFInfo object will write
+    /// data to a memory buffer. The data state is
+    /// SgfcBackendDataState::PartiallyLoaded.
+    ///
+    /// @a sgfContentBuffer must have been allocated with malloc(). The
+    /// SgfcBackendDataWrapper takes ownership of the buffer instead of
+    /// duplicating its content, and deallocates it when it is destroyed. If
+    /// the constructor throws an exception, ownership of the buffer remains
+    /// with the caller.
+    SgfcBackendDataWrapper(char* sgfContentBuffer, std::size_t sgfContentSize);
+
     /// @brief Destroys and cleans up the SgfcBackendDataWrapper object.
     virtual ~SgfcBackendDataWrapper();
 
@@ -88,6 +103,7 @@ namespace LibSgfcPlusPlus
     SgfcBackendDataState dataState;
 
     void InitializeFileBuffer(const std::string& sgfContent) const;
+    void InitializeFileBuffer(char* sgfContentBuffer, std::size_t sgfContentSize) const;
 
     friend class SgfcBackendController;
     SgfcBackendDataState GetDataState() const;
@@ -0,0 +1,38 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief SgfcCompressionFormat enumerates the compression formats that
+  /// libsgfc++ can recognize when it reads SGF data from, or writes SGF data
+  /// to, the filesystem.
+  ///
+  /// @ingroup internals
+  /// @ingroup sgfc-backend
+  enum class SgfcCompressionFormat
+  {
+    /// @brief The SGF data is not compressed.
+    None,
+
+    /// @brief The SGF data is compressed in the gzip format (RFC 1952).
+    Gzip,
+
+    /// @brief The SGF data is compressed in the Zstandard format (RFC 8878).
+    Zstd,
+  };
+}
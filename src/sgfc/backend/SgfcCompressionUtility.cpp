@@ -0,0 +1,570 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../SgfcPrivateConstants.h"
+#include "SgfcCompressionUtility.h"
+#include "SgfcDecompressingInputStream.h"
+
+// Compression library includes
+#ifdef SGFCPLUSPLUS_WITH_ZLIB
+#include <zlib.h>
+#endif
+#ifdef SGFCPLUSPLUS_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>  // for malloc(), realloc() and free()
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcCompressionFormat SgfcCompressionUtility::GetCompressionFormatOfFile(const std::string& filePath)
+  {
+    std::ifstream in(std::filesystem::u8path(filePath), std::ios::in | std::ios::binary);
+    if (! in)
+      return SgfcCompressionFormat::None;
+
+    std::size_t magicNumberLength = std::max(
+      SgfcPrivateConstants::GzipMagicNumber.size(),
+      SgfcPrivateConstants::ZstdMagicNumber.size());
+
+    std::string magicNumber(magicNumberLength, '\0');
+    in.read(&magicNumber[0], magicNumberLength);
+    magicNumber.resize(static_cast<std::size_t>(in.gcount()));
+
+    if (magicNumber.compare(0, SgfcPrivateConstants::GzipMagicNumber.size(), SgfcPrivateConstants::GzipMagicNumber) == 0)
+      return SgfcCompressionFormat::Gzip;
+    else if (magicNumber.compare(0, SgfcPrivateConstants::ZstdMagicNumber.size(), SgfcPrivateConstants::ZstdMagicNumber) == 0)
+      return SgfcCompressionFormat::Zstd;
+    else
+      return SgfcCompressionFormat::None;
+  }
+
+  SgfcCompressionFormat SgfcCompressionUtility::GetCompressionFormatOfFileName(const std::string& filePath)
+  {
+    if (EndsWith(filePath, SgfcPrivateConstants::GzipFileNameExtension))
+      return SgfcCompressionFormat::Gzip;
+    else if (EndsWith(filePath, SgfcPrivateConstants::ZstdFileNameExtension))
+      return SgfcCompressionFormat::Zstd;
+    else
+      return SgfcCompressionFormat::None;
+  }
+
+  bool SgfcCompressionUtility::IsCompressionFormatSupported(SgfcCompressionFormat compressionFormat)
+  {
+    switch (compressionFormat)
+    {
+      case SgfcCompressionFormat::None:
+        return true;
+      case SgfcCompressionFormat::Gzip:
+#ifdef SGFCPLUSPLUS_WITH_ZLIB
+        return true;
+#else
+        return false;
+#endif
+      case SgfcCompressionFormat::Zstd:
+#ifdef SGFCPLUSPLUS_WITH_ZSTD
+        return true;
+#else
+        return false;
+#endif
+      default:
+        return false;
+    }
+  }
+
+  std::string SgfcCompressionUtility::GetCompressionFormatName(SgfcCompressionFormat compressionFormat)
+  {
+    switch (compressionFormat)
+    {
+      case SgfcCompressionFormat::None:
+        return "uncompressed";
+      case SgfcCompressionFormat::Gzip:
+        return "gzip";
+      case SgfcCompressionFormat::Zstd:
+        return "zstd";
+      default:
+        return "unknown";
+    }
+  }
+
+  char* SgfcCompressionUtility::DecompressFile(
+    const std::string& filePath,
+    SgfcCompressionFormat compressionFormat,
+    std::size_t& decompressedSize)
+  {
+    ThrowIfCompressionFormatIsNotSupported(compressionFormat);
+
+#ifdef SGFCPLUSPLUS_WITH_ZLIB
+    if (compressionFormat == SgfcCompressionFormat::Gzip)
+      return DecompressGzipFile(filePath, decompressedSize);
+#endif
+#ifdef SGFCPLUSPLUS_WITH_ZSTD
+    if (compressionFormat == SgfcCompressionFormat::Zstd)
+      return DecompressZstdFile(filePath, decompressedSize);
+#endif
+
+    // Not reached because ThrowIfCompressionFormatIsNotSupported() has
+    // already rejected all formats that were not compiled in
+    throw std::logic_error("Unexpected compression format");
+  }
+
+  bool SgfcCompressionUtility::CompressToFile(
+    const std::string& content,
+    const std::string& filePath,
+    SgfcCompressionFormat compressionFormat)
+  {
+    ThrowIfCompressionFormatIsNotSupported(compressionFormat);
+
+#ifdef SGFCPLUSPLUS_WITH_ZLIB
+    if (compressionFormat == SgfcCompressionFormat::Gzip)
+      return CompressGzipToFile(content, filePath);
+#endif
+#ifdef SGFCPLUSPLUS_WITH_ZSTD
+    if (compressionFormat == SgfcCompressionFormat::Zstd)
+      return CompressZstdToFile(content, filePath);
+#endif
+
+    // Not reached because ThrowIfCompressionFormatIsNotSupported() has
+    // already rejected all formats that were not compiled in
+    throw std::logic_error("Unexpected compression format");
+  }
+
+  std::unique_ptr<std::istream> SgfcCompressionUtility::CreateInputStream(const std::string& filePath)
+  {
+    std::unique_ptr<std::istream> in;
+
+    SgfcCompressionFormat compressionFormat = GetCompressionFormatOfFile(filePath);
+    if (compressionFormat == SgfcCompressionFormat::None)
+    {
+      auto fileStream = std::unique_ptr<std::ifstream>(new std::ifstream(std::filesystem::u8path(filePath), std::ios::in | std::ios::binary));
+      if (! *fileStream)
+        throw std::runtime_error("Failed to open file for reading: " + filePath);
+
+      in = std::move(fileStream);
+    }
+    else
+    {
+      if (! IsCompressionFormatSupported(compressionFormat))
+      {
+        std::string message = "Support for " + GetCompressionFormatName(compressionFormat) + " compression is not available in this build of the library: " + filePath;
+        throw std::runtime_error(message);
+      }
+
+      in = std::unique_ptr<std::istream>(new SgfcDecompressingInputStream(filePath, compressionFormat));
+    }
+
+    in->exceptions(std::ios::badbit);
+
+    return in;
+  }
+
+  void SgfcCompressionUtility::DecompressDeflateData(
+    const char* compressedData,
+    std::size_t compressedSize,
+    std::string& uncompressedData)
+  {
+    ThrowIfCompressionFormatIsNotSupported(SgfcCompressionFormat::Gzip);
+
+#ifdef SGFCPLUSPLUS_WITH_ZLIB
+    // A negative window size tells zlib to expect raw deflate data without
+    // a zlib header and trailer
+    static const int rawDeflateWindowBits = -15;
+
+    z_stream zlibStream = {};
+    if (inflateInit2(&zlibStream, rawDeflateWindowBits) != Z_OK)
+      throw std::runtime_error("Memory allocation failed during decompression");
+
+    // zlib's counters are only 32 bits wide on some platforms, so the data is
+    // fed in chunks
+    static const std::size_t maximumChunkSize = std::numeric_limits<uInt>::max();
+
+    std::size_t compressedOffset = 0;
+    std::size_t uncompressedOffset = 0;
+    int inflateResult = Z_OK;
+    while (inflateResult == Z_OK)
+    {
+      std::size_t inputChunkSize = std::min(compressedSize - compressedOffset, maximumChunkSize);
+      std::size_t outputChunkSize = std::min(uncompressedData.size() - uncompressedOffset, maximumChunkSize);
+
+      zlibStream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressedData + compressedOffset));
+      zlibStream.avail_in = static_cast<uInt>(inputChunkSize);
+      zlibStream.next_out = reinterpret_cast<Bytef*>(&uncompressedData[0] + uncompressedOffset);
+      zlibStream.avail_out = static_cast<uInt>(outputChunkSize);
+
+      inflateResult = inflate(&zlibStream, Z_NO_FLUSH);
+
+      compressedOffset += inputChunkSize - zlibStream.avail_in;
+      uncompressedOffset += outputChunkSize - zlibStream.avail_out;
+
+      // Z_BUF_ERROR means that no progress was possible: Either the input
+      // is truncated, or the output is larger than announced
+      if (inflateResult == Z_BUF_ERROR)
+        break;
+    }
+
+    inflateEnd(&zlibStream);
+
+    if (inflateResult != Z_STREAM_END)
+      throw std::runtime_error("Failed to decompress deflate data: The compressed data is corrupt or truncated");
+    if (uncompressedOffset != uncompressedData.size())
+      throw std::runtime_error("Failed to decompress deflate data: The uncompressed size does not match the expected size");
+#endif
+  }
+
+  std::uint32_t SgfcCompressionUtility::GetCrc32Checksum(const std::string& data)
+  {
+    // The table is computed once for the reversed polynomial 0xEDB88320,
+    // which is the polynomial used by the gzip and zip formats
+    static const std::vector<std::uint32_t> crc32Table = []()
+    {
+      std::vector<std::uint32_t> table(256);
+      for (std::uint32_t indexOfTableEntry = 0; indexOfTableEntry < table.size(); indexOfTableEntry++)
+      {
+        std::uint32_t crc = indexOfTableEntry;
+        for (int indexOfBit = 0; indexOfBit < 8; indexOfBit++)
+          crc = (crc & 1) ? (0xEDB88320u ^ (crc >> 1)) : (crc >> 1);
+        table[indexOfTableEntry] = crc;
+      }
+      return table;
+    }();
+
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for (char character : data)
+      crc = crc32Table[(crc ^ static_cast<unsigned char>(character)) & 0xFF] ^ (crc >> 8);
+
+    return crc ^ 0xFFFFFFFFu;
+  }
+
+  void SgfcCompressionUtility::ThrowIfCompressionFormatIsNotSupported(SgfcCompressionFormat compressionFormat)
+  {
+    if (compressionFormat == SgfcCompressionFormat::None)
+      throw std::invalid_argument("Compression format is SgfcCompressionFormat::None");
+
+    if (! IsCompressionFormatSupported(compressionFormat))
+    {
+      std::string message = "Support for " + GetCompressionFormatName(compressionFormat) + " compression is not available in this build of the library";
+      throw std::invalid_argument(message);
+    }
+  }
+
+  /// @brief Grows @a buffer so that it can hold at least @a minimumCapacity
+  /// bytes. The buffer capacity is at least doubled to keep the number of
+  /// reallocations low. @a buffer may be nullptr, in which case a new buffer
+  /// is allocated. Updates both @a buffer and @a bufferCapacity.
+  ///
+  /// @exception std::runtime_error Is thrown if memory allocation fails. In
+  /// that case @a buffer remains valid and unchanged.
+  void SgfcCompressionUtility::GrowBuffer(char*& buffer, std::size_t& bufferCapacity, std::size_t minimumCapacity)
+  {
+    std::size_t newBufferCapacity = std::max(bufferCapacity * 2, minimumCapacity);
+
+    char* newBuffer = static_cast<char*>(realloc(buffer, newBufferCapacity));
+    if (newBuffer == nullptr)
+      throw std::runtime_error("Memory allocation failed during decompression");
+
+    buffer = newBuffer;
+    bufferCapacity = newBufferCapacity;
+  }
+
+  bool SgfcCompressionUtility::EndsWith(const std::string& string, const std::string& suffix)
+  {
+    if (string.size() < suffix.size())
+      return false;
+
+    return string.compare(string.size() - suffix.size(), suffix.size(), suffix) == 0;
+  }
+
+#ifdef SGFCPLUSPLUS_WITH_ZLIB
+  /// @brief Returns the uncompressed size that the gzip file at @a filePath
+  /// announces in its trailer, or 0 if the announced size is not plausible.
+  ///
+  /// The trailer stores the size modulo 2^32, and for a file that consists of
+  /// several gzip members it stores only the size of the last member. The
+  /// value is therefore only a hint. A hint that exceeds the maximum
+  /// compression ratio of the deflate algorithm is rejected.
+  std::size_t SgfcCompressionUtility::GetGzipUncompressedSizeHint(const std::string& filePath)
+  {
+    static const std::uint64_t maximumDeflateCompressionRatio = 1032;
+    static const std::streamoff trailerSizeFieldLength = 4;
+
+    std::ifstream in(std::filesystem::u8path(filePath), std::ios::in | std::ios::binary | std::ios::ate);
+    if (! in)
+      return 0;
+
+    std::streamoff compressedSize = in.tellg();
+    if (compressedSize < trailerSizeFieldLength)
+      return 0;
+
+    in.seekg(compressedSize - trailerSizeFieldLength);
+
+    unsigned char trailerSizeField[trailerSizeFieldLength];
+    in.read(reinterpret_cast<char*>(trailerSizeField), trailerSizeFieldLength);
+    if (! in)
+      return 0;
+
+    std::uint64_t uncompressedSize =
+      static_cast<std::uint64_t>(trailerSizeField[0]) |
+      (static_cast<std::uint64_t>(trailerSizeField[1]) << 8) |
+      (static_cast<std::uint64_t>(trailerSizeField[2]) << 16) |
+      (static_cast<std::uint64_t>(trailerSizeField[3]) << 24);
+
+    if (uncompressedSize > static_cast<std::uint64_t>(compressedSize) * maximumDeflateCompressionRatio)
+      return 0;
+
+    return static_cast<std::size_t>(uncompressedSize);
+  }
+
+  char* SgfcCompressionUtility::DecompressGzipFile(const std::string& filePath, std::size_t& decompressedSize)
+  {
+    // The extra byte ensures that a correct size hint does not cause an
+    // unnecessary reallocation when gzread() is invoked one last time to
+    // detect the end of the data
+    std::size_t bufferCapacity = GetGzipUncompressedSizeHint(filePath) + 1;
+
+    gzFile gzipFile = gzopen(filePath.c_str(), "rb");
+    if (gzipFile == nullptr)
+      throw std::runtime_error("Failed to open file for reading: " + filePath);
+
+    gzbuffer(gzipFile, static_cast<unsigned int>(SgfcPrivateConstants::CompressionStreamBufferSize));
+
+    char* buffer = nullptr;
+    std::size_t bufferSize = 0;
+
+    try
+    {
+      std::size_t initialBufferCapacity = bufferCapacity;
+      bufferCapacity = 0;
+      GrowBuffer(buffer, bufferCapacity, initialBufferCapacity);
+
+      while (true)
+      {
+        if (bufferSize == bufferCapacity)
+          GrowBuffer(buffer, bufferCapacity, bufferCapacity + SgfcPrivateConstants::CompressionStreamBufferSize);
+
+        std::size_t numberOfBytesToRead = std::min(
+          bufferCapacity - bufferSize,
+          static_cast<std::size_t>(std::numeric_limits<int>::max()));
+
+        int numberOfBytesRead = gzread(gzipFile, buffer + bufferSize, static_cast<unsigned int>(numberOfBytesToRead));
+        if (numberOfBytesRead <= 0)
+          break;
+
+        bufferSize += static_cast<std::size_t>(numberOfBytesRead);
+      }
+
+      // gzread() also signals the end of the data if the compressed data is
+      // truncated. Only the error state tells the two cases apart.
+      int errorNumber = Z_OK;
+      const char* errorMessage = gzerror(gzipFile, &errorNumber);
+      if (errorNumber != Z_OK)
+        throw std::runtime_error("Failed to decompress gzip file " + filePath + ": " + errorMessage);
+    }
+    catch (...)
+    {
+      free(buffer);
+      gzclose(gzipFile);
+      throw;
+    }
+
+    gzclose(gzipFile);
+
+    decompressedSize = bufferSize;
+    return buffer;
+  }
+
+  bool SgfcCompressionUtility::CompressGzipToFile(const std::string& content, const std::string& filePath)
+  {
+    gzFile gzipFile = gzopen(filePath.c_str(), "wb");
+    if (gzipFile == nullptr)
+      return false;
+
+    gzbuffer(gzipFile, static_cast<unsigned int>(SgfcPrivateConstants::CompressionStreamBufferSize));
+
+    bool success = true;
+    for (std::size_t indexOfChunk = 0; indexOfChunk < content.size(); indexOfChunk += SgfcPrivateConstants::CompressionStreamBufferSize)
+    {
+      std::size_t chunkSize = std::min(SgfcPrivateConstants::CompressionStreamBufferSize, content.size() - indexOfChunk);
+
+      int numberOfBytesWritten = gzwrite(gzipFile, content.data() + indexOfChunk, static_cast<unsigned int>(chunkSize));
+      if (numberOfBytesWritten != static_cast<int>(chunkSize))
+      {
+        success = false;
+        break;
+      }
+    }
+
+    // Closing the file flushes the remaining compressed data and the trailer
+    if (gzclose(gzipFile) != Z_OK)
+      success = false;
+
+    return success;
+  }
+#endif
+
+#ifdef SGFCPLUSPLUS_WITH_ZSTD
+  char* SgfcCompressionUtility::DecompressZstdFile(const std::string& filePath, std::size_t& decompressedSize)
+  {
+    std::ifstream in(std::filesystem::u8path(filePath), std::ios::in | std::ios::binary);
+    if (! in)
+      throw std::runtime_error("Failed to open file for reading: " + filePath);
+
+    ZSTD_DCtx* decompressionContext = ZSTD_createDCtx();
+    if (decompressionContext == nullptr)
+      throw std::runtime_error("Memory allocation failed during decompression");
+
+    std::vector<char> inputBuffer(SgfcPrivateConstants::CompressionStreamBufferSize);
+
+    char* buffer = nullptr;
+    std::size_t bufferCapacity = 0;
+    std::size_t bufferSize = 0;
+
+    try
+    {
+      bool isFirstChunk = true;
+      std::size_t lastDecompressResult = 0;
+
+      while (true)
+      {
+        in.read(inputBuffer.data(), inputBuffer.size());
+        std::size_t numberOfBytesRead = static_cast<std::size_t>(in.gcount());
+        if (numberOfBytesRead == 0)
+          break;
+
+        if (isFirstChunk)
+        {
+          isFirstChunk = false;
+
+          // The frame header announces the uncompressed size of the first
+          // frame, unless the compressor did not know it. The extra byte
+          // ensures that a correct size hint does not cause an unnecessary
+          // reallocation while the frame epilogue is consumed.
+          unsigned long long frameContentSize = ZSTD_getFrameContentSize(inputBuffer.data(), numberOfBytesRead);
+          std::size_t initialBufferCapacity = SgfcPrivateConstants::CompressionStreamBufferSize;
+          if (frameContentSize != ZSTD_CONTENTSIZE_UNKNOWN &&
+              frameContentSize != ZSTD_CONTENTSIZE_ERROR &&
+              frameContentSize < std::numeric_limits<std::size_t>::max())
+          {
+            initialBufferCapacity = static_cast<std::size_t>(frameContentSize) + 1;
+          }
+
+          GrowBuffer(buffer, bufferCapacity, initialBufferCapacity);
+        }
+
+        ZSTD_inBuffer input = { inputBuffer.data(), numberOfBytesRead, 0 };
+        while (input.pos < input.size)
+        {
+          if (bufferSize == bufferCapacity)
+            GrowBuffer(buffer, bufferCapacity, bufferCapacity + SgfcPrivateConstants::CompressionStreamBufferSize);
+
+          ZSTD_outBuffer output = { buffer + bufferSize, bufferCapacity - bufferSize, 0 };
+          lastDecompressResult = ZSTD_decompressStream(decompressionContext, &output, &input);
+          if (ZSTD_isError(lastDecompressResult))
+          {
+            std::string errorMessage = ZSTD_getErrorName(lastDecompressResult);
+            throw std::runtime_error("Failed to decompress zstd file " + filePath + ": " + errorMessage);
+          }
+
+          bufferSize += output.pos;
+        }
+      }
+
+      if (in.bad())
+        throw std::runtime_error("Failed to read file: " + filePath);
+
+      // A non-zero result means that the decompressor expects more input,
+      // i.e. the last frame is incomplete
+      if (lastDecompressResult != 0)
+        throw std::runtime_error("Failed to decompress zstd file " + filePath + ": The compressed data is truncated");
+
+      // An empty file does not contain a single frame, so no buffer was
+      // allocated
+      if (buffer == nullptr)
+        throw std::runtime_error("Failed to decompress zstd file " + filePath + ": The file is empty");
+    }
+    catch (...)
+    {
+      free(buffer);
+      ZSTD_freeDCtx(decompressionContext);
+      throw;
+    }
+
+    ZSTD_freeDCtx(decompressionContext);
+
+    decompressedSize = bufferSize;
+    return buffer;
+  }
+
+  bool SgfcCompressionUtility::CompressZstdToFile(const std::string& content, const std::string& filePath)
+  {
+    std::ofstream out(std::filesystem::u8path(filePath), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (out.fail())
+      return false;
+
+    ZSTD_CCtx* compressionContext = ZSTD_createCCtx();
+    if (compressionContext == nullptr)
+      return false;
+
+    // Announcing the uncompressed size in the frame header allows the
+    // decompressor to allocate its output buffer up front
+    ZSTD_CCtx_setPledgedSrcSize(compressionContext, content.size());
+
+    std::vector<char> outputBuffer(ZSTD_CStreamOutSize());
+    ZSTD_inBuffer input = { content.data(), content.size(), 0 };
+
+    bool success = true;
+    bool isFrameComplete = false;
+    while (! isFrameComplete)
+    {
+      ZSTD_outBuffer output = { outputBuffer.data(), outputBuffer.size(), 0 };
+
+      // With ZSTD_e_end the function returns 0 when the entire input has been
+      // consumed and the frame has been completely flushed
+      std::size_t remainingBytesToFlush = ZSTD_compressStream2(compressionContext, &output, &input, ZSTD_e_end);
+      if (ZSTD_isError(remainingBytesToFlush))
+      {
+        success = false;
+        break;
+      }
+
+      out.write(outputBuffer.data(), output.pos);
+      if (out.fail())
+      {
+        success = false;
+        break;
+      }
+
+      isFrameComplete = (remainingBytesToFlush == 0);
+    }
+
+    ZSTD_freeCCtx(compressionContext);
+
+    out.close();
+    if (out.fail())
+      success = false;
+
+    return success;
+  }
+#endif
+}
@@ -0,0 +1,163 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "SgfcCompressionFormat.h"
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcCompressionUtility class is a container for static helper
+  /// functions that detect, decompress and compress SGF data that is stored
+  /// in compressed files.
+  ///
+  /// @ingroup internals
+  /// @ingroup sgfc-backend
+  ///
+  /// Support for each compression format is optional and must be enabled when
+  /// the library is built. The gzip format requires zlib, the Zstandard
+  /// format requires libzstd. Format detection works regardless of whether a
+  /// format is supported.
+  ///
+  /// Decompression and compression are performed in streaming fashion, i.e.
+  /// neither the compressed data nor the uncompressed data are held in memory
+  /// more than once.
+  class SgfcCompressionUtility
+  {
+  public:
+    SgfcCompressionUtility() = delete;
+    ~SgfcCompressionUtility() = delete;
+
+    /// @brief Returns the compression format of the file at @a filePath,
+    /// determined by examining the magic number at the start of the file.
+    /// Returns SgfcCompressionFormat::None if the file is not compressed, or
+    /// if the file cannot be read.
+    static SgfcCompressionFormat GetCompressionFormatOfFile(const std::string& filePath);
+
+    /// @brief Returns the compression format that is implied by the file name
+    /// extension of @a filePath. The extension ".gz" implies
+    /// SgfcCompressionFormat::Gzip, the extension ".zst" implies
+    /// SgfcCompressionFormat::Zstd. Any other extension implies
+    /// SgfcCompressionFormat::None.
+    static SgfcCompressionFormat GetCompressionFormatOfFileName(const std::string& filePath);
+
+    /// @brief Returns true if support for @a compressionFormat was enabled
+    /// when the library was built. Returns false if support was not enabled.
+    /// Always returns true for SgfcCompressionFormat::None.
+    static bool IsCompressionFormatSupported(SgfcCompressionFormat compressionFormat);
+
+    /// @brief Returns a short human-readable name for @a compressionFormat,
+    /// suitable for inclusion in a message text.
+    static std::string GetCompressionFormatName(SgfcCompressionFormat compressionFormat);
+
+    /// @brief Decompresses the file at @a filePath, which must be compressed
+    /// in the format @a compressionFormat. Returns a buffer allocated with
+    /// malloc() that contains the uncompressed data. The caller becomes
+    /// responsible for deallocating the buffer with free(). The size of the
+    /// uncompressed data is stored in the out variable @a decompressedSize.
+    ///
+    /// If the compressed file announces the size of its uncompressed data,
+    /// that size is used to allocate the buffer up front. Otherwise the
+    /// buffer is grown as the data is decompressed.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a compressionFormat is
+    /// SgfcCompressionFormat::None, or if IsCompressionFormatSupported()
+    /// returns false for @a compressionFormat.
+    /// @exception std::runtime_error Is thrown if the file cannot be read, if
+    /// the compressed data is corrupt or truncated, or if memory allocation
+    /// fails.
+    static char* DecompressFile(
+      const std::string& filePath,
+      SgfcCompressionFormat compressionFormat,
+      std::size_t& decompressedSize);
+
+    /// @brief Compresses @a content in the format @a compressionFormat and
+    /// writes the compressed data to the file at @a filePath. If a file
+    /// already exists at the specified path it is overwritten.
+    ///
+    /// @retval true if writing the file succeeded.
+    /// @retval false if writing the file failed.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a compressionFormat is
+    /// SgfcCompressionFormat::None, or if IsCompressionFormatSupported()
+    /// returns false for @a compressionFormat.
+    static bool CompressToFile(
+      const std::string& content,
+      const std::string& filePath,
+      SgfcCompressionFormat compressionFormat);
+
+    /// @brief Opens the file at @a filePath for reading and returns an input
+    /// stream that provides the uncompressed content of the file. If the file
+    /// is compressed (see GetCompressionFormatOfFile()) the stream
+    /// decompresses the content on the fly, otherwise the stream reads the
+    /// file as is.
+    ///
+    /// The stream has std::ios::badbit set in its exception mask, so that
+    /// an error that occurs during decompression is not swallowed by the
+    /// stream but reaches the caller as std::runtime_error.
+    ///
+    /// @exception std::runtime_error Is thrown if the file cannot be opened
+    /// for reading, or if the file is compressed and
+    /// IsCompressionFormatSupported() returns false for the compression
+    /// format.
+    static std::unique_ptr<std::istream> CreateInputStream(const std::string& filePath);
+
+    /// @brief Decompresses @a compressedSize bytes of raw deflate data
+    /// (RFC 1951) at @a compressedData into @a uncompressedData, which must
+    /// already have the size of the uncompressed data. This is the format of
+    /// the compressed entries in a zip archive. Deflate data can be
+    /// decompressed if SgfcCompressionFormat::Gzip is supported.
+    ///
+    /// @exception std::invalid_argument Is thrown if
+    /// IsCompressionFormatSupported() returns false for
+    /// SgfcCompressionFormat::Gzip.
+    /// @exception std::runtime_error Is thrown if the deflate data is corrupt,
+    /// or if it does not decompress to exactly the size of
+    /// @a uncompressedData.
+    static void DecompressDeflateData(
+      const char* compressedData,
+      std::size_t compressedSize,
+      std::string& uncompressedData);
+
+    /// @brief Returns the CRC-32 checksum of @a data, as used by the gzip and
+    /// zip formats. This does not depend on any compression library.
+    static std::uint32_t GetCrc32Checksum(const std::string& data);
+
+  private:
+    static void ThrowIfCompressionFormatIsNotSupported(SgfcCompressionFormat compressionFormat);
+    static void GrowBuffer(char*& buffer, std::size_t& bufferCapacity, std::size_t minimumCapacity);
+    static bool EndsWith(const std::string& string, const std::string& suffix);
+
+#ifdef SGFCPLUSPLUS_WITH_ZLIB
+    static std::size_t GetGzipUncompressedSizeHint(const std::string& filePath);
+    static char* DecompressGzipFile(const std::string& filePath, std::size_t& decompressedSize);
+    static bool CompressGzipToFile(const std::string& content, const std::string& filePath);
+#endif
+
+#ifdef SGFCPLUSPLUS_WITH_ZSTD
+    static char* DecompressZstdFile(const std::string& filePath, std::size_t& decompressedSize);
+    static bool CompressZstdToFile(const std::string& content, const std::string& filePath);
+#endif
+  };
+}
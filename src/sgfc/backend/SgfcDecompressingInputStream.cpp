@@ -0,0 +1,249 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../SgfcPrivateConstants.h"
+#include "SgfcCompressionUtility.h"
+#include "SgfcDecompressingInputStream.h"
+
+// Compression library includes
+#ifdef SGFCPLUSPLUS_WITH_ZLIB
+#include <zlib.h>
+#endif
+#ifdef SGFCPLUSPLUS_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+// C++ Standard Library includes
+#include <filesystem>
+#include <stdexcept>
+
+namespace LibSgfcPlusPlus
+{
+  struct SgfcDecompressingInputStream::DecompressionContext
+  {
+#ifdef SGFCPLUSPLUS_WITH_ZLIB
+    z_stream ZlibStream = {};
+    bool IsZlibStreamInitialized = false;
+    /// @brief Is true after the end of a gzip member was reached. A gzip
+    /// file may consist of several members, so more data may follow.
+    bool IsAtEndOfGzipMember = false;
+#endif
+#ifdef SGFCPLUSPLUS_WITH_ZSTD
+    ZSTD_DCtx* ZstdContext = nullptr;
+    ZSTD_inBuffer ZstdInput = { nullptr, 0, 0 };
+    /// @brief The most recent return value of ZSTD_decompressStream(). Is 0
+    /// when a frame has been completely decoded and flushed.
+    std::size_t LastZstdResult = 0;
+#endif
+  };
+
+  SgfcDecompressingInputStream::SgfcDecompressingInputStream(const std::string& filePath, SgfcCompressionFormat compressionFormat)
+    : std::streambuf()
+    , std::istream(this)
+    , filePath(filePath)
+    , compressionFormat(compressionFormat)
+    , isCompressedStreamExhausted(false)
+    , compressedBuffer(SgfcPrivateConstants::CompressionStreamBufferSize)
+    , decompressedBuffer(SgfcPrivateConstants::CompressionStreamBufferSize)
+    , decompressionContext(new DecompressionContext())
+  {
+    if (compressionFormat == SgfcCompressionFormat::None)
+      throw std::invalid_argument("SgfcDecompressingInputStream constructor failed: Compression format is SgfcCompressionFormat::None");
+    if (! SgfcCompressionUtility::IsCompressionFormatSupported(compressionFormat))
+      throw std::invalid_argument("SgfcDecompressingInputStream constructor failed: Support for " + SgfcCompressionUtility::GetCompressionFormatName(compressionFormat) + " compression is not available in this build of the library");
+
+    this->compressedStream.open(std::filesystem::u8path(filePath), std::ios::in | std::ios::binary);
+    if (! this->compressedStream)
+      throw std::runtime_error("Failed to open file for reading: " + filePath);
+
+#ifdef SGFCPLUSPLUS_WITH_ZLIB
+    if (compressionFormat == SgfcCompressionFormat::Gzip)
+    {
+      // 16 added to the window size tells zlib to expect a gzip header and
+      // trailer instead of a zlib header and trailer
+      static const int gzipWindowBits = 15 + 16;
+      if (inflateInit2(&this->decompressionContext->ZlibStream, gzipWindowBits) != Z_OK)
+        throw std::runtime_error("Memory allocation failed during decompression");
+      this->decompressionContext->IsZlibStreamInitialized = true;
+    }
+#endif
+#ifdef SGFCPLUSPLUS_WITH_ZSTD
+    if (compressionFormat == SgfcCompressionFormat::Zstd)
+    {
+      this->decompressionContext->ZstdContext = ZSTD_createDCtx();
+      if (this->decompressionContext->ZstdContext == nullptr)
+        throw std::runtime_error("Memory allocation failed during decompression");
+    }
+#endif
+  }
+
+  SgfcDecompressingInputStream::~SgfcDecompressingInputStream()
+  {
+#ifdef SGFCPLUSPLUS_WITH_ZLIB
+    if (this->decompressionContext->IsZlibStreamInitialized)
+      inflateEnd(&this->decompressionContext->ZlibStream);
+#endif
+#ifdef SGFCPLUSPLUS_WITH_ZSTD
+    if (this->decompressionContext->ZstdContext != nullptr)
+      ZSTD_freeDCtx(this->decompressionContext->ZstdContext);
+#endif
+  }
+
+  std::streambuf::int_type SgfcDecompressingInputStream::underflow()
+  {
+    if (gptr() < egptr())
+      return std::streambuf::traits_type::to_int_type(*gptr());
+
+    std::size_t numberOfDecompressedBytes;
+    if (this->compressionFormat == SgfcCompressionFormat::Gzip)
+      numberOfDecompressedBytes = DecompressGzipData();
+    else
+      numberOfDecompressedBytes = DecompressZstdData();
+
+    if (numberOfDecompressedBytes == 0)
+      return std::streambuf::traits_type::eof();
+
+    char* bufferBegin = this->decompressedBuffer.data();
+    setg(bufferBegin, bufferBegin, bufferBegin + numberOfDecompressedBytes);
+
+    return std::streambuf::traits_type::to_int_type(*gptr());
+  }
+
+  /// @brief Reads the next chunk of compressed data into the compressed
+  /// buffer and returns the number of bytes read. Sets
+  /// @e isCompressedStreamExhausted when the end of the file is reached.
+  std::size_t SgfcDecompressingInputStream::ReadCompressedData()
+  {
+    this->compressedStream.read(this->compressedBuffer.data(), this->compressedBuffer.size());
+    if (this->compressedStream.bad())
+      throw std::runtime_error("Failed to read file: " + this->filePath);
+
+    std::size_t numberOfBytesRead = static_cast<std::size_t>(this->compressedStream.gcount());
+    if (this->compressedStream.eof())
+      this->isCompressedStreamExhausted = true;
+
+    return numberOfBytesRead;
+  }
+
+  /// @brief Decompresses gzip data into the decompressed buffer until at
+  /// least one byte is available. Returns the number of bytes that are
+  /// available, or 0 if the end of the data was reached.
+  std::size_t SgfcDecompressingInputStream::DecompressGzipData()
+  {
+#ifdef SGFCPLUSPLUS_WITH_ZLIB
+    z_stream& zlibStream = this->decompressionContext->ZlibStream;
+
+    while (true)
+    {
+      if (zlibStream.avail_in == 0 && ! this->isCompressedStreamExhausted)
+      {
+        zlibStream.next_in = reinterpret_cast<Bytef*>(this->compressedBuffer.data());
+        zlibStream.avail_in = static_cast<uInt>(ReadCompressedData());
+      }
+
+      bool isInputAvailable = (zlibStream.avail_in > 0);
+
+      if (this->decompressionContext->IsAtEndOfGzipMember)
+      {
+        if (isInputAvailable)
+        {
+          // Another gzip member follows
+          inflateReset(&zlibStream);
+          this->decompressionContext->IsAtEndOfGzipMember = false;
+        }
+        else if (this->isCompressedStreamExhausted)
+        {
+          return 0;
+        }
+        else
+        {
+          continue;
+        }
+      }
+
+      zlibStream.next_out = reinterpret_cast<Bytef*>(this->decompressedBuffer.data());
+      zlibStream.avail_out = static_cast<uInt>(this->decompressedBuffer.size());
+
+      int inflateResult = inflate(&zlibStream, Z_NO_FLUSH);
+      if (inflateResult == Z_STREAM_END)
+      {
+        this->decompressionContext->IsAtEndOfGzipMember = true;
+      }
+      else if (inflateResult != Z_OK && inflateResult != Z_BUF_ERROR)
+      {
+        std::string errorMessage = (zlibStream.msg != nullptr) ? zlibStream.msg : "Unknown error";
+        throw std::runtime_error("Failed to decompress gzip file " + this->filePath + ": " + errorMessage);
+      }
+
+      std::size_t numberOfDecompressedBytes = this->decompressedBuffer.size() - zlibStream.avail_out;
+      if (numberOfDecompressedBytes > 0)
+        return numberOfDecompressedBytes;
+
+      // No progress although the decompressor got all the input there is
+      if (! isInputAvailable && this->isCompressedStreamExhausted && ! this->decompressionContext->IsAtEndOfGzipMember)
+        throw std::runtime_error("Failed to decompress gzip file " + this->filePath + ": The compressed data is truncated");
+    }
+#else
+    throw std::logic_error("Support for gzip compression is not available in this build of the library");
+#endif
+  }
+
+  /// @brief Decompresses Zstandard data into the decompressed buffer until
+  /// at least one byte is available. Returns the number of bytes that are
+  /// available, or 0 if the end of the data was reached.
+  std::size_t SgfcDecompressingInputStream::DecompressZstdData()
+  {
+#ifdef SGFCPLUSPLUS_WITH_ZSTD
+    ZSTD_inBuffer& zstdInput = this->decompressionContext->ZstdInput;
+
+    while (true)
+    {
+      if (zstdInput.pos == zstdInput.size && ! this->isCompressedStreamExhausted)
+      {
+        zstdInput.src = this->compressedBuffer.data();
+        zstdInput.size = ReadCompressedData();
+        zstdInput.pos = 0;
+      }
+
+      bool isInputAvailable = (zstdInput.pos < zstdInput.size);
+      if (! isInputAvailable && this->isCompressedStreamExhausted && this->decompressionContext->LastZstdResult == 0)
+        return 0;
+
+      // Invoking the decompressor without input is necessary to flush data
+      // that did not fit into the output buffer in the previous invocation
+      ZSTD_outBuffer zstdOutput = { this->decompressedBuffer.data(), this->decompressedBuffer.size(), 0 };
+      std::size_t decompressResult = ZSTD_decompressStream(this->decompressionContext->ZstdContext, &zstdOutput, &zstdInput);
+      if (ZSTD_isError(decompressResult))
+      {
+        std::string errorMessage = ZSTD_getErrorName(decompressResult);
+        throw std::runtime_error("Failed to decompress zstd file " + this->filePath + ": " + errorMessage);
+      }
+
+      this->decompressionContext->LastZstdResult = decompressResult;
+
+      if (zstdOutput.pos > 0)
+        return zstdOutput.pos;
+
+      // No progress although the decompressor got all the input there is
+      if (! isInputAvailable && this->isCompressedStreamExhausted)
+        throw std::runtime_error("Failed to decompress zstd file " + this->filePath + ": The compressed data is truncated");
+    }
+#else
+    throw std::logic_error("Support for zstd compression is not available in this build of the library");
+#endif
+  }
+}
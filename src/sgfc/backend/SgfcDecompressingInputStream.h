@@ -0,0 +1,86 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "SgfcCompressionFormat.h"
+
+// C++ Standard Library includes
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcDecompressingInputStream class is an input stream that
+  /// reads a compressed file and provides the uncompressed content of the
+  /// file. The content is decompressed on the fly in small chunks, so only a
+  /// small, fixed amount of memory is required regardless of the size of the
+  /// file.
+  ///
+  /// @ingroup internals
+  /// @ingroup sgfc-backend
+  ///
+  /// SgfcDecompressingInputStream is its own stream buffer. The private base
+  /// class std::streambuf is initialized before the public base class
+  /// std::istream, so it can be handed to std::istream during construction.
+  ///
+  /// If an error occurs during decompression, the stream buffer throws
+  /// std::runtime_error. Unless the exception mask of the stream contains
+  /// std::ios::badbit, std::istream swallows the exception and merely sets
+  /// std::ios::badbit.
+  class SgfcDecompressingInputStream : private std::streambuf, public std::istream
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcDecompressingInputStream
+    /// object that reads the file at @a filePath, which must be compressed
+    /// in the format @a compressionFormat.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a compressionFormat is
+    /// SgfcCompressionFormat::None, or if support for @a compressionFormat
+    /// was not enabled when the library was built.
+    /// @exception std::runtime_error Is thrown if the file cannot be opened
+    /// for reading, or if memory allocation fails.
+    SgfcDecompressingInputStream(const std::string& filePath, SgfcCompressionFormat compressionFormat);
+
+    /// @brief Destroys and cleans up the SgfcDecompressingInputStream object.
+    virtual ~SgfcDecompressingInputStream();
+
+  protected:
+    virtual std::streambuf::int_type underflow() override;
+
+  private:
+    /// @brief Holds the state of the decompression library. The content
+    /// depends on which compression libraries the library was built with.
+    struct DecompressionContext;
+
+    std::string filePath;
+    SgfcCompressionFormat compressionFormat;
+    std::ifstream compressedStream;
+    bool isCompressedStreamExhausted;
+    std::vector<char> compressedBuffer;
+    std::vector<char> decompressedBuffer;
+    std::unique_ptr<DecompressionContext> decompressionContext;
+
+    std::size_t ReadCompressedData();
+    std::size_t DecompressGzipData();
+    std::size_t DecompressZstdData();
+  };
+}
@@ -0,0 +1,749 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../../include/ISgfcDocumentReader.h"
+#include "../../SgfcBinaryUtility.h"
+#include "../../SgfcPrivateConstants.h"
+#include "../backend/SgfcCompressionUtility.h"
+#include "../message/SgfcMessage.h"
+#include "SgfcArchiveReader.h"
+#include "SgfcDocumentReadResult.h"
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcArchiveReader::SgfcArchiveReader(
+    const std::string& archiveFilePath,
+    std::shared_ptr<ISgfcDocumentReader> documentReader)
+    : archiveFilePath(archiveFilePath)
+    , documentReader(documentReader)
+    , archiveFormat(ArchiveFormat::Tar)
+    , isEndOfArchive(false)
+    , isTarHeaderBlockPending(false)
+    , zipArchiveSize(0)
+    , indexOfNextZipEntry(0)
+  {
+    if (documentReader == nullptr)
+      throw std::invalid_argument("SgfcArchiveReader constructor failed: Document reader object is nullptr");
+
+    auto fileStream = std::unique_ptr<std::ifstream>(new std::ifstream(std::filesystem::u8path(archiveFilePath), std::ios::in | std::ios::binary));
+    if (! fileStream->is_open())
+    {
+      std::stringstream message;
+      message << "Failed to open file for reading: " << archiveFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    // A zip archive cannot be read sequentially, so it must not be wrapped
+    // in a decompressing stream. A tar archive can be compressed as a whole.
+    std::string signatureBytes(4, '\0');
+    fileStream->read(&signatureBytes[0], static_cast<std::streamsize>(signatureBytes.size()));
+    if (fileStream->gcount() == static_cast<std::streamsize>(signatureBytes.size()))
+    {
+      std::istringstream signatureStream(signatureBytes);
+      std::uint32_t signature = SgfcBinaryUtility::ReadUInt32(signatureStream);
+      if (signature == SgfcPrivateConstants::ZipLocalFileHeaderSignature ||
+          signature == SgfcPrivateConstants::ZipEndOfCentralDirectorySignature)
+      {
+        this->archiveFormat = ArchiveFormat::Zip;
+        this->archiveStream = std::move(fileStream);
+        this->archiveStream->exceptions(std::ios::badbit);
+
+        ReadZipCentralDirectory();
+        return;
+      }
+    }
+
+    fileStream.reset();
+    this->archiveStream = SgfcCompressionUtility::CreateInputStream(archiveFilePath);
+
+    this->tarHeaderBlock.resize(SgfcPrivateConstants::TarBlockSize);
+    this->archiveStream->read(&this->tarHeaderBlock[0], static_cast<std::streamsize>(this->tarHeaderBlock.size()));
+    bool isTarArchive =
+      this->archiveStream->gcount() == static_cast<std::streamsize>(this->tarHeaderBlock.size()) &&
+      (this->tarHeaderBlock.find_first_not_of('\0') == std::string::npos || IsTarHeaderBlockChecksumValid());
+    if (! isTarArchive)
+    {
+      std::stringstream message;
+      message << "File is neither a tar nor a zip archive: " << archiveFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    // The first header block is processed by the first ReadNextEntry()
+    this->isTarHeaderBlockPending = true;
+  }
+
+  SgfcArchiveReader::~SgfcArchiveReader()
+  {
+  }
+
+  std::string SgfcArchiveReader::GetArchiveFilePath() const
+  {
+    return this->archiveFilePath;
+  }
+
+  std::shared_ptr<ISgfcDocumentReader> SgfcArchiveReader::GetDocumentReader() const
+  {
+    return this->documentReader;
+  }
+
+  bool SgfcArchiveReader::ReadNextEntry(SgfcArchiveEntryReadResult& entryReadResult)
+  {
+    if (this->isEndOfArchive)
+      return false;
+
+    bool isEntryRead;
+    if (this->archiveFormat == ArchiveFormat::Tar)
+      isEntryRead = ReadNextTarEntry(entryReadResult);
+    else
+      isEntryRead = ReadNextZipEntry(entryReadResult);
+
+    if (! isEntryRead)
+      this->isEndOfArchive = true;
+
+    return isEntryRead;
+  }
+
+  bool SgfcArchiveReader::ReadNextTarEntry(SgfcArchiveEntryReadResult& entryReadResult)
+  {
+    // GNU long name headers and pax extended headers apply to the member
+    // whose header follows them
+    std::string overridingMemberName;
+    bool hasOverridingMemberSize = false;
+    std::uint64_t overridingMemberSize = 0;
+
+    while (ReadTarHeaderBlock())
+    {
+      static const std::size_t typeFlagOffset = 156;
+      char typeFlag = this->tarHeaderBlock[typeFlagOffset];
+      std::uint64_t memberSize = GetTarMemberSize();
+
+      if (typeFlag == 'L')
+      {
+        ReadTarMemberData(memberSize, overridingMemberName);
+        overridingMemberName = overridingMemberName.substr(0, overridingMemberName.find('\0'));
+        continue;
+      }
+      else if (typeFlag == 'x')
+      {
+        std::string paxExtendedHeader;
+        ReadTarMemberData(memberSize, paxExtendedHeader);
+
+        std::string paxMemberName = GetPaxRecordValue(paxExtendedHeader, "path");
+        if (! paxMemberName.empty())
+          overridingMemberName = paxMemberName;
+
+        std::string paxMemberSize = GetPaxRecordValue(paxExtendedHeader, "size");
+        if (! paxMemberSize.empty())
+        {
+          if (! ParseDecimalNumber(paxMemberSize, overridingMemberSize))
+            ThrowCorruptArchiveError("Invalid size in pax extended header");
+
+          hasOverridingMemberSize = true;
+        }
+        continue;
+      }
+
+      if (hasOverridingMemberSize)
+        memberSize = overridingMemberSize;
+      std::string memberName = overridingMemberName.empty() ? GetTarMemberName() : overridingMemberName;
+
+      overridingMemberName.clear();
+      hasOverridingMemberSize = false;
+
+      // '0' is a regular file, '\0' is a regular file in the pre-POSIX
+      // format, '7' is a contiguous file which is treated as a regular file.
+      // Everything else (directories, links, devices, pax global headers,
+      // etc.) is skipped.
+      bool isRegularFile = (typeFlag == '0' || typeFlag == '\0' || typeFlag == '7');
+      if (! isRegularFile || ! IsSgfMemberName(memberName))
+      {
+        SkipTarMemberData(memberSize);
+        continue;
+      }
+
+      entryReadResult.MemberName = memberName;
+
+      if (memberSize > SgfcPrivateConstants::ArchiveMaximumMemberSize)
+      {
+        SkipTarMemberData(memberSize);
+        entryReadResult.DocumentReadResult = CreateFailedReadResult(memberName, "Member is larger than the maximum member size");
+        return true;
+      }
+
+      ReadTarMemberData(memberSize, this->entryContentBuffer);
+
+      entryReadResult.DocumentReadResult = this->documentReader->ReadSgfContent(this->entryContentBuffer);
+      return true;
+    }
+
+    return false;
+  }
+
+  bool SgfcArchiveReader::ReadTarHeaderBlock()
+  {
+    if (this->isTarHeaderBlockPending)
+    {
+      this->isTarHeaderBlockPending = false;
+    }
+    else
+    {
+      this->archiveStream->read(&this->tarHeaderBlock[0], static_cast<std::streamsize>(this->tarHeaderBlock.size()));
+      std::streamsize numberOfBytesRead = this->archiveStream->gcount();
+
+      // Some archivers omit the two zero blocks that mark the end of the
+      // archive. Only a partial block indicates a truncated archive.
+      if (numberOfBytesRead == 0)
+        return false;
+      else if (numberOfBytesRead != static_cast<std::streamsize>(this->tarHeaderBlock.size()))
+        ThrowCorruptArchiveError("Unexpected end of archive");
+    }
+
+    if (this->tarHeaderBlock.find_first_not_of('\0') == std::string::npos)
+      return false;
+
+    if (! IsTarHeaderBlockChecksumValid())
+      ThrowCorruptArchiveError("Tar header checksum mismatch");
+
+    return true;
+  }
+
+  bool SgfcArchiveReader::IsTarHeaderBlockChecksumValid() const
+  {
+    static const std::size_t checksumOffset = 148;
+    static const std::size_t checksumLength = 8;
+
+    // The checksum is calculated as if the checksum field contained spaces.
+    // Some historic implementations summed up signed bytes, so both variants
+    // are accepted.
+    std::uint64_t unsignedChecksum = 0;
+    std::int64_t signedChecksum = 0;
+    for (std::size_t indexOfByte = 0; indexOfByte < this->tarHeaderBlock.size(); indexOfByte++)
+    {
+      char character = this->tarHeaderBlock[indexOfByte];
+      if (indexOfByte >= checksumOffset && indexOfByte < checksumOffset + checksumLength)
+        character = ' ';
+
+      unsignedChecksum += static_cast<unsigned char>(character);
+      signedChecksum += static_cast<signed char>(character);
+    }
+
+    std::uint64_t expectedChecksum = ParseTarNumber(this->tarHeaderBlock, checksumOffset, checksumLength);
+    return
+      expectedChecksum == unsignedChecksum ||
+      static_cast<std::int64_t>(expectedChecksum) == signedChecksum;
+  }
+
+  std::uint64_t SgfcArchiveReader::GetTarMemberSize() const
+  {
+    static const std::size_t sizeOffset = 124;
+    static const std::size_t sizeLength = 12;
+    return ParseTarNumber(this->tarHeaderBlock, sizeOffset, sizeLength);
+  }
+
+  std::string SgfcArchiveReader::GetTarMemberName() const
+  {
+    static const std::size_t nameOffset = 0;
+    static const std::size_t nameLength = 100;
+    static const std::size_t magicOffset = 257;
+    static const std::size_t prefixOffset = 345;
+    static const std::size_t prefixLength = 155;
+
+    std::string memberName = ParseTarString(this->tarHeaderBlock, nameOffset, nameLength);
+
+    if (this->tarHeaderBlock.compare(magicOffset, SgfcPrivateConstants::TarUstarMagic.size(), SgfcPrivateConstants::TarUstarMagic) == 0)
+    {
+      std::string prefix = ParseTarString(this->tarHeaderBlock, prefixOffset, prefixLength);
+      if (! prefix.empty())
+        memberName = prefix + "/" + memberName;
+    }
+
+    return memberName;
+  }
+
+  void SgfcArchiveReader::ReadTarMemberData(std::uint64_t memberSize, std::string& memberData)
+  {
+    if (memberSize > SgfcPrivateConstants::ArchiveMaximumMemberSize)
+      ThrowCorruptArchiveError("Member is larger than the maximum member size");
+
+    // The size of a tar archive is not known up front because the archive
+    // may be compressed, so the member size cannot be checked against it.
+    // Reading in chunks grows the buffer only as far as data is actually
+    // present, so a truncated archive with a bogus member size is detected
+    // before a huge allocation takes place.
+    memberData.clear();
+    while (memberData.size() < memberSize)
+    {
+      std::size_t chunkOffset = memberData.size();
+      std::size_t chunkSize = static_cast<std::size_t>(std::min<std::uint64_t>(
+        memberSize - chunkOffset,
+        SgfcPrivateConstants::ArchiveReadChunkSize));
+
+      memberData.resize(chunkOffset + chunkSize);
+      this->archiveStream->read(&memberData[chunkOffset], static_cast<std::streamsize>(chunkSize));
+      if (this->archiveStream->gcount() != static_cast<std::streamsize>(chunkSize))
+        ThrowCorruptArchiveError("Unexpected end of archive");
+    }
+
+    SkipArchiveData(GetTarPaddingSize(memberSize));
+  }
+
+  void SgfcArchiveReader::SkipTarMemberData(std::uint64_t memberSize)
+  {
+    // Skip the member data and the padding separately, the sum might
+    // overflow for a bogus member size
+    SkipArchiveData(memberSize);
+    SkipArchiveData(GetTarPaddingSize(memberSize));
+  }
+
+  void SgfcArchiveReader::SkipArchiveData(std::uint64_t numberOfBytes)
+  {
+    // Skipping in chunks keeps the number of bytes within the range of
+    // std::streamsize
+    while (numberOfBytes > 0)
+    {
+      std::streamsize chunkSize = static_cast<std::streamsize>(std::min<std::uint64_t>(
+        numberOfBytes,
+        SgfcPrivateConstants::ArchiveReadChunkSize));
+
+      this->archiveStream->ignore(chunkSize);
+      if (this->archiveStream->gcount() != chunkSize)
+        ThrowCorruptArchiveError("Unexpected end of archive");
+
+      numberOfBytes -= static_cast<std::uint64_t>(chunkSize);
+    }
+  }
+
+  std::uint64_t SgfcArchiveReader::GetTarPaddingSize(std::uint64_t memberSize)
+  {
+    // Member data is padded with zero bytes to a multiple of the block size
+    std::uint64_t remainder = memberSize % SgfcPrivateConstants::TarBlockSize;
+    return (remainder == 0) ? 0 : SgfcPrivateConstants::TarBlockSize - remainder;
+  }
+
+  std::string SgfcArchiveReader::GetPaxRecordValue(const std::string& paxExtendedHeader, const std::string& key)
+  {
+    // A pax extended header consists of records with the format
+    // "<length> <key>=<value>\n", where <length> is the decimal length of the
+    // entire record. If a key occurs more than once the last record wins.
+    std::string value;
+
+    std::size_t indexOfRecord = 0;
+    while (indexOfRecord < paxExtendedHeader.size())
+    {
+      std::size_t indexOfSpace = paxExtendedHeader.find(' ', indexOfRecord);
+      if (indexOfSpace == std::string::npos || indexOfSpace == indexOfRecord)
+        break;
+
+      std::string recordLengthString = paxExtendedHeader.substr(indexOfRecord, indexOfSpace - indexOfRecord);
+      std::uint64_t recordLengthNumber;
+      if (! ParseDecimalNumber(recordLengthString, recordLengthNumber) ||
+          recordLengthNumber > paxExtendedHeader.size() - indexOfRecord)
+      {
+        break;
+      }
+
+      std::size_t recordLength = static_cast<std::size_t>(recordLengthNumber);
+      if (recordLength <= indexOfSpace - indexOfRecord + 1)
+        break;
+
+      // Exclude the space and the trailing newline
+      std::string keyValuePair = paxExtendedHeader.substr(indexOfSpace + 1, indexOfRecord + recordLength - indexOfSpace - 2);
+      std::size_t indexOfEqualSign = keyValuePair.find('=');
+      if (indexOfEqualSign != std::string::npos && keyValuePair.substr(0, indexOfEqualSign) == key)
+        value = keyValuePair.substr(indexOfEqualSign + 1);
+
+      indexOfRecord += recordLength;
+    }
+
+    return value;
+  }
+
+  bool SgfcArchiveReader::ParseDecimalNumber(const std::string& string, std::uint64_t& number)
+  {
+    if (string.empty() || string.find_first_not_of("0123456789") != std::string::npos)
+      return false;
+
+    // Don't use std::stoull(), it throws std::out_of_range for a number
+    // that does not fit, which is not a std::runtime_error
+    std::uint64_t parsedNumber = 0;
+    for (char character : string)
+    {
+      std::uint64_t digit = static_cast<std::uint64_t>(character - '0');
+      if (parsedNumber > (std::numeric_limits<std::uint64_t>::max() - digit) / 10)
+        return false;
+
+      parsedNumber = parsedNumber * 10 + digit;
+    }
+
+    number = parsedNumber;
+    return true;
+  }
+
+  std::uint64_t SgfcArchiveReader::ParseTarNumber(const std::string& tarHeaderBlock, std::size_t offset, std::size_t length)
+  {
+    // GNU tar and star store numbers that do not fit into the octal field
+    // in base-256 encoding, which is indicated by the high bit of the first
+    // byte
+    unsigned char firstByte = static_cast<unsigned char>(tarHeaderBlock[offset]);
+    if (firstByte & 0x80)
+    {
+      std::uint64_t number = firstByte & 0x7F;
+      for (std::size_t indexOfByte = offset + 1; indexOfByte < offset + length; indexOfByte++)
+        number = (number << 8) | static_cast<unsigned char>(tarHeaderBlock[indexOfByte]);
+      return number;
+    }
+
+    // Octal digits, optionally surrounded by spaces and/or zero bytes
+    std::uint64_t number = 0;
+    std::size_t indexOfByte = offset;
+    while (indexOfByte < offset + length && (tarHeaderBlock[indexOfByte] == ' ' || tarHeaderBlock[indexOfByte] == '\0'))
+      indexOfByte++;
+    while (indexOfByte < offset + length && tarHeaderBlock[indexOfByte] >= '0' && tarHeaderBlock[indexOfByte] <= '7')
+    {
+      number = (number << 3) | static_cast<std::uint64_t>(tarHeaderBlock[indexOfByte] - '0');
+      indexOfByte++;
+    }
+
+    return number;
+  }
+
+  std::string SgfcArchiveReader::ParseTarString(const std::string& tarHeaderBlock, std::size_t offset, std::size_t length)
+  {
+    // The string is terminated by a zero byte, unless it fills the field
+    std::string string = tarHeaderBlock.substr(offset, length);
+    return string.substr(0, string.find('\0'));
+  }
+
+  bool SgfcArchiveReader::ReadNextZipEntry(SgfcArchiveEntryReadResult& entryReadResult)
+  {
+    if (this->indexOfNextZipEntry >= this->zipEntries.size())
+      return false;
+
+    const ZipEntry& zipEntry = this->zipEntries[this->indexOfNextZipEntry];
+    this->indexOfNextZipEntry++;
+
+    entryReadResult.MemberName = zipEntry.MemberName;
+    entryReadResult.DocumentReadResult = ReadZipEntry(zipEntry);
+    return true;
+  }
+
+  void SgfcArchiveReader::ReadZipCentralDirectory()
+  {
+    static const std::uint64_t endOfCentralDirectorySize = 22;
+    static const std::uint64_t maximumCommentLength = 0xFFFF;
+    static const std::uint64_t zip64EndOfCentralDirectoryLocatorSize = 20;
+    static const std::uint64_t zip64EndOfCentralDirectorySize = 56;
+
+    this->archiveStream->seekg(0, std::ios::end);
+    std::uint64_t archiveFileSize = static_cast<std::uint64_t>(this->archiveStream->tellg());
+    this->zipArchiveSize = archiveFileSize;
+    if (archiveFileSize < endOfCentralDirectorySize)
+      ThrowCorruptArchiveError("End of central directory record not found");
+
+    // The end of central directory record is followed by a comment of
+    // variable length, so it must be searched for backwards
+    std::uint64_t tailLength = std::min(archiveFileSize, endOfCentralDirectorySize + maximumCommentLength);
+    std::uint64_t offsetOfTail = archiveFileSize - tailLength;
+    std::string tail;
+    ReadArchiveData(offsetOfTail, tailLength, tail);
+
+    std::ostringstream signatureStream;
+    SgfcBinaryUtility::WriteUInt32(signatureStream, SgfcPrivateConstants::ZipEndOfCentralDirectorySignature);
+    std::string endOfCentralDirectorySignature = signatureStream.str();
+
+    std::size_t indexOfEndOfCentralDirectory = tail.rfind(endOfCentralDirectorySignature, tail.size() - endOfCentralDirectorySize);
+    if (indexOfEndOfCentralDirectory == std::string::npos)
+      ThrowCorruptArchiveError("End of central directory record not found");
+
+    std::istringstream endOfCentralDirectoryStream(tail.substr(indexOfEndOfCentralDirectory, endOfCentralDirectorySize));
+    SgfcBinaryUtility::ReadUInt32(endOfCentralDirectoryStream);
+    std::uint16_t numberOfThisDisk = SgfcBinaryUtility::ReadUInt16(endOfCentralDirectoryStream);
+    std::uint16_t diskWithCentralDirectory = SgfcBinaryUtility::ReadUInt16(endOfCentralDirectoryStream);
+    SgfcBinaryUtility::ReadUInt16(endOfCentralDirectoryStream);
+    std::uint64_t numberOfEntries = SgfcBinaryUtility::ReadUInt16(endOfCentralDirectoryStream);
+    std::uint64_t centralDirectorySize = SgfcBinaryUtility::ReadUInt32(endOfCentralDirectoryStream);
+    std::uint64_t centralDirectoryOffset = SgfcBinaryUtility::ReadUInt32(endOfCentralDirectoryStream);
+
+    // A zip64 archive indicates with placeholder values that the real values
+    // are stored in the zip64 end of central directory record
+    bool isZip64 =
+      numberOfEntries == 0xFFFF ||
+      centralDirectorySize == 0xFFFFFFFF ||
+      centralDirectoryOffset == 0xFFFFFFFF;
+    std::uint64_t offsetOfEndOfCentralDirectory = offsetOfTail + indexOfEndOfCentralDirectory;
+    if (isZip64 && offsetOfEndOfCentralDirectory >= zip64EndOfCentralDirectoryLocatorSize)
+    {
+      std::string locator;
+      ReadArchiveData(offsetOfEndOfCentralDirectory - zip64EndOfCentralDirectoryLocatorSize, zip64EndOfCentralDirectoryLocatorSize, locator);
+      std::istringstream locatorStream(locator);
+      if (SgfcBinaryUtility::ReadUInt32(locatorStream) == SgfcPrivateConstants::Zip64EndOfCentralDirectoryLocatorSignature)
+      {
+        SgfcBinaryUtility::ReadUInt32(locatorStream);
+        std::uint64_t zip64EndOfCentralDirectoryOffset = SgfcBinaryUtility::ReadUInt64(locatorStream);
+
+        std::string zip64EndOfCentralDirectory;
+        ReadArchiveData(zip64EndOfCentralDirectoryOffset, zip64EndOfCentralDirectorySize, zip64EndOfCentralDirectory);
+        std::istringstream zip64EndOfCentralDirectoryStream(zip64EndOfCentralDirectory);
+        if (SgfcBinaryUtility::ReadUInt32(zip64EndOfCentralDirectoryStream) != SgfcPrivateConstants::Zip64EndOfCentralDirectorySignature)
+          ThrowCorruptArchiveError("Zip64 end of central directory record not found");
+
+        // Skip the record size and the version fields
+        zip64EndOfCentralDirectoryStream.ignore(12);
+        numberOfThisDisk = static_cast<std::uint16_t>(SgfcBinaryUtility::ReadUInt32(zip64EndOfCentralDirectoryStream));
+        diskWithCentralDirectory = static_cast<std::uint16_t>(SgfcBinaryUtility::ReadUInt32(zip64EndOfCentralDirectoryStream));
+        SgfcBinaryUtility::ReadUInt64(zip64EndOfCentralDirectoryStream);
+        numberOfEntries = SgfcBinaryUtility::ReadUInt64(zip64EndOfCentralDirectoryStream);
+        centralDirectorySize = SgfcBinaryUtility::ReadUInt64(zip64EndOfCentralDirectoryStream);
+        centralDirectoryOffset = SgfcBinaryUtility::ReadUInt64(zip64EndOfCentralDirectoryStream);
+      }
+    }
+
+    if (numberOfThisDisk != 0 || diskWithCentralDirectory != 0)
+      ThrowCorruptArchiveError("Zip archives that span multiple disks are not supported");
+    if (centralDirectoryOffset > archiveFileSize || centralDirectorySize > archiveFileSize - centralDirectoryOffset)
+      ThrowCorruptArchiveError("Central directory is outside of the archive");
+
+    std::string centralDirectory;
+    ReadArchiveData(centralDirectoryOffset, centralDirectorySize, centralDirectory);
+    std::istringstream centralDirectoryStream(centralDirectory);
+
+    std::string errorMessage;
+    try
+    {
+      for (std::uint64_t indexOfEntry = 0; indexOfEntry < numberOfEntries; indexOfEntry++)
+      {
+        if (SgfcBinaryUtility::ReadUInt32(centralDirectoryStream) != SgfcPrivateConstants::ZipCentralDirectoryFileHeaderSignature)
+          throw std::runtime_error("Invalid central directory file header signature");
+
+        ZipEntry zipEntry;
+
+        // Skip the version fields
+        centralDirectoryStream.ignore(4);
+        zipEntry.Flags = SgfcBinaryUtility::ReadUInt16(centralDirectoryStream);
+        zipEntry.CompressionMethod = SgfcBinaryUtility::ReadUInt16(centralDirectoryStream);
+        // Skip the modification time and date
+        centralDirectoryStream.ignore(4);
+        zipEntry.Crc32Checksum = SgfcBinaryUtility::ReadUInt32(centralDirectoryStream);
+        zipEntry.CompressedSize = SgfcBinaryUtility::ReadUInt32(centralDirectoryStream);
+        zipEntry.UncompressedSize = SgfcBinaryUtility::ReadUInt32(centralDirectoryStream);
+        std::uint16_t fileNameLength = SgfcBinaryUtility::ReadUInt16(centralDirectoryStream);
+        std::uint16_t extraFieldLength = SgfcBinaryUtility::ReadUInt16(centralDirectoryStream);
+        std::uint16_t fileCommentLength = SgfcBinaryUtility::ReadUInt16(centralDirectoryStream);
+        // Skip the disk number and the file attributes
+        centralDirectoryStream.ignore(8);
+        zipEntry.LocalHeaderOffset = SgfcBinaryUtility::ReadUInt32(centralDirectoryStream);
+        zipEntry.MemberName = SgfcBinaryUtility::ReadCharacters(centralDirectoryStream, fileNameLength);
+        std::string extraField = SgfcBinaryUtility::ReadCharacters(centralDirectoryStream, extraFieldLength);
+        SgfcBinaryUtility::ReadCharacters(centralDirectoryStream, fileCommentLength);
+
+        ApplyZip64ExtraField(extraField, zipEntry);
+
+        if (IsSgfMemberName(zipEntry.MemberName))
+          this->zipEntries.push_back(zipEntry);
+      }
+    }
+    catch (std::runtime_error& exception)
+    {
+      errorMessage = exception.what();
+    }
+
+    if (! errorMessage.empty())
+      ThrowCorruptArchiveError("Central directory is corrupt: " + errorMessage);
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> SgfcArchiveReader::ReadZipEntry(const ZipEntry& zipEntry)
+  {
+    static const std::uint16_t encryptedFlag = 0x1;
+    static const std::uint16_t storedCompressionMethod = 0;
+    static const std::uint16_t deflateCompressionMethod = 8;
+    static const std::uint64_t localFileHeaderSize = 30;
+    static const std::size_t localFileHeaderFileNameLengthOffset = 26;
+
+    if (zipEntry.Flags & encryptedFlag)
+      return CreateFailedReadResult(zipEntry.MemberName, "Member is encrypted");
+
+    if (zipEntry.CompressionMethod == deflateCompressionMethod)
+    {
+      if (! SgfcCompressionUtility::IsCompressionFormatSupported(SgfcCompressionFormat::Gzip))
+        return CreateFailedReadResult(zipEntry.MemberName, "Member is compressed with the deflate method, support for which is not available in this build of the library");
+    }
+    else if (zipEntry.CompressionMethod != storedCompressionMethod)
+    {
+      return CreateFailedReadResult(zipEntry.MemberName, "Member is compressed with unsupported method " + std::to_string(zipEntry.CompressionMethod));
+    }
+
+    // Check the sizes from the central directory before they are used to
+    // allocate memory
+    if (zipEntry.UncompressedSize > SgfcPrivateConstants::ArchiveMaximumMemberSize)
+      return CreateFailedReadResult(zipEntry.MemberName, "Member is larger than the maximum member size");
+    if (zipEntry.CompressedSize > this->zipArchiveSize)
+      return CreateFailedReadResult(zipEntry.MemberName, "Compressed size of member is larger than the archive");
+    if (zipEntry.CompressionMethod == deflateCompressionMethod &&
+        zipEntry.UncompressedSize > zipEntry.CompressedSize * SgfcPrivateConstants::ZipMaximumDeflateCompressionRatio)
+    {
+      return CreateFailedReadResult(zipEntry.MemberName, "Uncompressed size of member exceeds the maximum deflate compression ratio");
+    }
+
+    // The local file header repeats most of the information in the central
+    // directory, but the length of its extra field may differ
+    std::string localFileHeader;
+    ReadArchiveData(zipEntry.LocalHeaderOffset, localFileHeaderSize, localFileHeader);
+    std::istringstream localFileHeaderStream(localFileHeader);
+    if (SgfcBinaryUtility::ReadUInt32(localFileHeaderStream) != SgfcPrivateConstants::ZipLocalFileHeaderSignature)
+      ThrowCorruptArchiveError("Invalid local file header signature");
+    localFileHeaderStream.seekg(localFileHeaderFileNameLengthOffset);
+    std::uint16_t fileNameLength = SgfcBinaryUtility::ReadUInt16(localFileHeaderStream);
+    std::uint16_t extraFieldLength = SgfcBinaryUtility::ReadUInt16(localFileHeaderStream);
+    std::uint64_t offsetOfMemberData = zipEntry.LocalHeaderOffset + localFileHeaderSize + fileNameLength + extraFieldLength;
+    if (offsetOfMemberData > this->zipArchiveSize || zipEntry.CompressedSize > this->zipArchiveSize - offsetOfMemberData)
+      return CreateFailedReadResult(zipEntry.MemberName, "Member data is outside of the archive");
+
+    if (zipEntry.CompressionMethod == storedCompressionMethod)
+    {
+      if (zipEntry.CompressedSize != zipEntry.UncompressedSize)
+        return CreateFailedReadResult(zipEntry.MemberName, "Member is stored without compression, but its compressed and uncompressed sizes differ");
+
+      ReadArchiveData(offsetOfMemberData, zipEntry.CompressedSize, this->entryContentBuffer);
+    }
+    else
+    {
+      ReadArchiveData(offsetOfMemberData, zipEntry.CompressedSize, this->compressedEntryBuffer);
+
+      this->entryContentBuffer.resize(static_cast<std::size_t>(zipEntry.UncompressedSize));
+      try
+      {
+        SgfcCompressionUtility::DecompressDeflateData(
+          this->compressedEntryBuffer.data(),
+          this->compressedEntryBuffer.size(),
+          this->entryContentBuffer);
+      }
+      catch (std::runtime_error& exception)
+      {
+        return CreateFailedReadResult(zipEntry.MemberName, exception.what());
+      }
+    }
+
+    if (SgfcCompressionUtility::GetCrc32Checksum(this->entryContentBuffer) != zipEntry.Crc32Checksum)
+      return CreateFailedReadResult(zipEntry.MemberName, "CRC-32 checksum mismatch");
+
+    return this->documentReader->ReadSgfContent(this->entryContentBuffer);
+  }
+
+  void SgfcArchiveReader::ReadArchiveData(std::uint64_t offset, std::uint64_t length, std::string& data)
+  {
+    // Offsets and lengths come from the archive and cannot be trusted. Check
+    // them before the buffer is allocated.
+    if (offset > this->zipArchiveSize || length > this->zipArchiveSize - offset)
+      ThrowCorruptArchiveError("Unexpected end of archive");
+
+    data.resize(static_cast<std::size_t>(length));
+
+    // A previous read may have hit the end of the file
+    this->archiveStream->clear();
+    this->archiveStream->seekg(static_cast<std::streamoff>(offset));
+    if (length > 0)
+    {
+      this->archiveStream->read(&data[0], static_cast<std::streamsize>(length));
+      if (this->archiveStream->gcount() != static_cast<std::streamsize>(length))
+        ThrowCorruptArchiveError("Unexpected end of archive");
+    }
+    else if (! *this->archiveStream)
+    {
+      ThrowCorruptArchiveError("Unexpected end of archive");
+    }
+  }
+
+  void SgfcArchiveReader::ApplyZip64ExtraField(const std::string& extraField, ZipEntry& zipEntry)
+  {
+    static const std::uint16_t zip64ExtraFieldHeaderID = 0x0001;
+    static const std::uint64_t zip64Placeholder = 0xFFFFFFFF;
+
+    // The zip64 extra field contains only those values whose field in the
+    // central directory file header holds the placeholder, in a fixed order
+    std::istringstream extraFieldStream(extraField);
+    std::uint64_t remainingLength = extraField.size();
+    while (remainingLength >= 4)
+    {
+      std::uint16_t headerID = SgfcBinaryUtility::ReadUInt16(extraFieldStream);
+      std::uint16_t dataSize = SgfcBinaryUtility::ReadUInt16(extraFieldStream);
+      std::string data = SgfcBinaryUtility::ReadCharacters(extraFieldStream, dataSize);
+      remainingLength -= 4 + dataSize;
+
+      if (headerID != zip64ExtraFieldHeaderID)
+        continue;
+
+      std::istringstream dataStream(data);
+      if (zipEntry.UncompressedSize == zip64Placeholder)
+        zipEntry.UncompressedSize = SgfcBinaryUtility::ReadUInt64(dataStream);
+      if (zipEntry.CompressedSize == zip64Placeholder)
+        zipEntry.CompressedSize = SgfcBinaryUtility::ReadUInt64(dataStream);
+      if (zipEntry.LocalHeaderOffset == zip64Placeholder)
+        zipEntry.LocalHeaderOffset = SgfcBinaryUtility::ReadUInt64(dataStream);
+      break;
+    }
+  }
+
+  bool SgfcArchiveReader::IsSgfMemberName(const std::string& memberName)
+  {
+    std::size_t indexOfLastSlash = memberName.find_last_of('/');
+    std::string baseName = (indexOfLastSlash == std::string::npos) ? memberName : memberName.substr(indexOfLastSlash + 1);
+
+    // macOS stores resource forks in "._" files next to the real files
+    if (baseName.compare(0, 2, "._") == 0)
+      return false;
+
+    const std::string& extension = SgfcPrivateConstants::SgfFileNameExtension;
+    if (baseName.size() <= extension.size())
+      return false;
+
+    std::string baseNameExtension = baseName.substr(baseName.size() - extension.size());
+    std::transform(
+      baseNameExtension.begin(),
+      baseNameExtension.end(),
+      baseNameExtension.begin(),
+      [](unsigned char character) { return static_cast<char>(std::tolower(character)); });
+
+    return baseNameExtension == extension;
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> SgfcArchiveReader::CreateFailedReadResult(
+    const std::string& memberName,
+    const std::string& reason)
+  {
+    std::string messageText = "Reading archive member failed: " + reason + ": " + memberName;
+
+    std::shared_ptr<ISgfcDocumentReadResult> readResult = std::shared_ptr<ISgfcDocumentReadResult>(new SgfcDocumentReadResult(
+      std::shared_ptr<ISgfcMessage>(new SgfcMessage(SgfcMessageID::ReadSgfContentFromFilesystemError, messageText))));
+    return readResult;
+  }
+
+  void SgfcArchiveReader::ThrowCorruptArchiveError(const std::string& reason) const
+  {
+    std::stringstream message;
+    message << "Failed to read archive file: " << reason << ": " << this->archiveFilePath;
+    throw std::runtime_error(message.str());
+  }
+}
@@ -0,0 +1,141 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../../include/ISgfcArchiveReader.h"
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcDocumentReadResult;
+
+  /// @brief The SgfcArchiveReader class provides an implementation of the
+  /// ISgfcArchiveReader interface. See the interface header file for
+  /// documentation.
+  ///
+  /// @ingroup internals
+  /// @ingroup sgfc-frontend
+  ///
+  /// A tar archive is read strictly sequentially through the stream that
+  /// SgfcCompressionUtility::CreateInputStream() provides, so that a
+  /// compressed tar archive can be read without seeking. A zip archive is
+  /// read by first loading the central directory at the end of the archive,
+  /// then seeking to the local header of each member that is read.
+  ///
+  /// The buffers that hold the content of an archive member are reused from
+  /// one member to the next, so that reading an archive with many members
+  /// does not allocate memory for each member anew.
+  ///
+  /// Sizes and offsets that are stored in an archive are not trusted. Zip
+  /// offsets and sizes are checked against the size of the archive file,
+  /// and tar member data is read in chunks, so that a corrupt size cannot
+  /// cause a huge allocation. A member that is larger than
+  /// SgfcPrivateConstants::ArchiveMaximumMemberSize is not extracted.
+  class SgfcArchiveReader : public ISgfcArchiveReader
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcArchiveReader object that
+    /// reads from the archive file located at @a archiveFilePath and uses
+    /// @a documentReader to read archive members.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a documentReader is
+    /// @e nullptr.
+    /// @exception std::runtime_error Is thrown if the archive file cannot be
+    /// opened for reading, or if it is neither a tar nor a zip archive.
+    SgfcArchiveReader(
+      const std::string& archiveFilePath,
+      std::shared_ptr<ISgfcDocumentReader> documentReader);
+
+    /// @brief Destroys and cleans up the SgfcArchiveReader object.
+    virtual ~SgfcArchiveReader();
+
+    virtual std::string GetArchiveFilePath() const override;
+    virtual std::shared_ptr<ISgfcDocumentReader> GetDocumentReader() const override;
+    virtual bool ReadNextEntry(SgfcArchiveEntryReadResult& entryReadResult) override;
+
+  private:
+    /// @brief The archive formats that SgfcArchiveReader can read.
+    enum class ArchiveFormat
+    {
+      Tar,
+      Zip,
+    };
+
+    /// @brief The information from the central directory of a zip archive
+    /// that is required to read a member of the zip archive.
+    struct ZipEntry
+    {
+      std::string MemberName;
+      std::uint16_t Flags;
+      std::uint16_t CompressionMethod;
+      std::uint32_t Crc32Checksum;
+      std::uint64_t CompressedSize;
+      std::uint64_t UncompressedSize;
+      std::uint64_t LocalHeaderOffset;
+    };
+
+    std::string archiveFilePath;
+    std::shared_ptr<ISgfcDocumentReader> documentReader;
+    ArchiveFormat archiveFormat;
+    std::unique_ptr<std::istream> archiveStream;
+
+    bool isEndOfArchive;
+    bool isTarHeaderBlockPending;
+    std::string tarHeaderBlock;
+
+    std::uint64_t zipArchiveSize;
+    std::vector<ZipEntry> zipEntries;
+    std::size_t indexOfNextZipEntry;
+
+    std::string entryContentBuffer;
+    std::string compressedEntryBuffer;
+
+    bool ReadNextTarEntry(SgfcArchiveEntryReadResult& entryReadResult);
+    bool ReadTarHeaderBlock();
+    bool IsTarHeaderBlockChecksumValid() const;
+    std::uint64_t GetTarMemberSize() const;
+    std::string GetTarMemberName() const;
+    void ReadTarMemberData(std::uint64_t memberSize, std::string& memberData);
+    void SkipTarMemberData(std::uint64_t memberSize);
+    void SkipArchiveData(std::uint64_t numberOfBytes);
+    static std::uint64_t GetTarPaddingSize(std::uint64_t memberSize);
+    static std::string GetPaxRecordValue(const std::string& paxExtendedHeader, const std::string& key);
+    static bool ParseDecimalNumber(const std::string& string, std::uint64_t& number);
+    static std::uint64_t ParseTarNumber(const std::string& tarHeaderBlock, std::size_t offset, std::size_t length);
+    static std::string ParseTarString(const std::string& tarHeaderBlock, std::size_t offset, std::size_t length);
+
+    bool ReadNextZipEntry(SgfcArchiveEntryReadResult& entryReadResult);
+    void ReadZipCentralDirectory();
+    std::shared_ptr<ISgfcDocumentReadResult> ReadZipEntry(const ZipEntry& zipEntry);
+    void ReadArchiveData(std::uint64_t offset, std::uint64_t length, std::string& data);
+    static void ApplyZip64ExtraField(const std::string& extraField, ZipEntry& zipEntry);
+
+    static bool IsSgfMemberName(const std::string& memberName);
+    static std::shared_ptr<ISgfcDocumentReadResult> CreateFailedReadResult(
+      const std::string& memberName,
+      const std::string& reason);
+    void ThrowCorruptArchiveError(const std::string& reason) const;
+  };
+}
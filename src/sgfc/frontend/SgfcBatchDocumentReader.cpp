@@ -0,0 +1,332 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../SgfcParallelUtility.h"
+#include "../../SgfcUtility.h"
+#include "../argument/SgfcArguments.h"
+#include "../message/SgfcMessage.h"
+#include "SgfcBatchDocumentReader.h"
+#include "SgfcDocumentReader.h"
+#include "SgfcDocumentReadResult.h"
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <numeric>
+#include <stdexcept>
+#include <system_error>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcBatchDocumentReader::SgfcBatchDocumentReader()
+    : arguments(new SgfcArguments())
+    , isResultOrderPreserved(false)
+    , maximumNumberOfPendingResults(1)
+    , numberOfStartedFiles(0)
+    , numberOfCompletedFiles(0)
+    , numberOfHandedOutResults(0)
+    , isStopRequested(false)
+  {
+  }
+
+  SgfcBatchDocumentReader::~SgfcBatchDocumentReader()
+  {
+    StopReading();
+  }
+
+  std::shared_ptr<ISgfcArguments> SgfcBatchDocumentReader::GetArguments() const
+  {
+    return this->arguments;
+  }
+
+  SgfcDocumentReadOptions SgfcBatchDocumentReader::GetReadOptions() const
+  {
+    return this->readOptions;
+  }
+
+  void SgfcBatchDocumentReader::SetReadOptions(const SgfcDocumentReadOptions& readOptions)
+  {
+    this->readOptions = readOptions;
+  }
+
+  SgfcBatchReadOptions SgfcBatchDocumentReader::GetBatchReadOptions() const
+  {
+    return this->batchReadOptions;
+  }
+
+  void SgfcBatchDocumentReader::SetBatchReadOptions(const SgfcBatchReadOptions& batchReadOptions)
+  {
+    this->batchReadOptions = batchReadOptions;
+  }
+
+  std::vector<std::string> SgfcBatchDocumentReader::FindFiles(
+    const std::string& directoryPath,
+    const std::string& fileNamePattern) const
+  {
+    return SgfcUtility::GetFilePathsInDirectory(directoryPath, fileNamePattern);
+  }
+
+  void SgfcBatchDocumentReader::StartReading(const std::vector<std::string>& sgfFilePaths)
+  {
+    if (IsReading())
+      throw std::logic_error("StartReading failed: A batch is already being read");
+
+    // The worker threads of the previous batch have finished, but they may
+    // not have been joined yet if the batch was empty
+    JoinWorkerThreads();
+    ResetBatch();
+
+    if (sgfFilePaths.empty())
+      return;
+
+    this->sgfFilePaths = sgfFilePaths;
+    this->isResultOrderPreserved = this->batchReadOptions.IsResultOrderPreserved;
+    this->maximumNumberOfPendingResults = std::max(this->batchReadOptions.MaximumNumberOfPendingResults, static_cast<std::size_t>(1));
+
+    CreateSchedule();
+
+    unsigned int numberOfWorkerThreads = SgfcParallelUtility::GetNumberOfWorkerThreads(
+      this->batchReadOptions.NumberOfThreads,
+      this->sgfFilePaths.size());
+    PrepareWorkerDocumentReaders(numberOfWorkerThreads);
+
+    try
+    {
+      for (unsigned int workerThreadIndex = 0; workerThreadIndex < numberOfWorkerThreads; workerThreadIndex++)
+        this->workerThreads.emplace_back(&SgfcBatchDocumentReader::ReadFilesOnWorkerThread, this, workerThreadIndex);
+    }
+    catch (...)
+    {
+      StopReading();
+      throw;
+    }
+  }
+
+  bool SgfcBatchDocumentReader::ReadNextResult(SgfcBatchReadResult& batchReadResult)
+  {
+    if (! IsReading())
+      return false;
+
+    {
+      std::unique_lock<std::mutex> lock(this->batchMutex);
+      this->resultCondition.wait(lock, [this]()
+      {
+        return
+          ! this->completedResults.empty() &&
+          this->completedResults.begin()->first == this->numberOfHandedOutResults;
+      });
+
+      auto iterator = this->completedResults.begin();
+      batchReadResult = std::move(iterator->second);
+      this->completedResults.erase(iterator);
+      this->numberOfHandedOutResults++;
+    }
+
+    // A worker thread may have been waiting for a result to be handed out
+    this->workerCondition.notify_all();
+
+    // After the last result the worker threads run out of files and finish
+    if (! IsReading())
+      JoinWorkerThreads();
+
+    return true;
+  }
+
+  bool SgfcBatchDocumentReader::IsReading() const
+  {
+    // Both values are modified only by the thread that controls the batch,
+    // i.e. the thread that is invoking this method
+    return this->numberOfHandedOutResults < this->sgfFilePaths.size();
+  }
+
+  void SgfcBatchDocumentReader::StopReading()
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->batchMutex);
+      this->isStopRequested = true;
+    }
+
+    this->workerCondition.notify_all();
+
+    JoinWorkerThreads();
+    ResetBatch();
+  }
+
+  void SgfcBatchDocumentReader::ReadSgfFiles(
+    const std::vector<std::string>& sgfFilePaths,
+    const std::function<void(const SgfcBatchReadResult& batchReadResult)>& resultHandler)
+  {
+    StartReading(sgfFilePaths);
+
+    try
+    {
+      SgfcBatchReadResult batchReadResult;
+      while (ReadNextResult(batchReadResult))
+        resultHandler(batchReadResult);
+    }
+    catch (...)
+    {
+      StopReading();
+      throw;
+    }
+  }
+
+  void SgfcBatchDocumentReader::CreateSchedule()
+  {
+    std::size_t numberOfFiles = this->sgfFilePaths.size();
+
+    this->schedule.resize(numberOfFiles);
+    std::iota(this->schedule.begin(), this->schedule.end(), 0);
+
+    if (! this->batchReadOptions.IsLargestFileReadFirst)
+      return;
+
+    // A file whose size cannot be determined, e.g. because it does not
+    // exist, is treated as an empty file. Reading it fails fast anyway.
+    std::vector<std::uintmax_t> fileSizes(numberOfFiles, 0);
+    for (std::size_t fileIndex = 0; fileIndex < numberOfFiles; fileIndex++)
+    {
+      std::error_code errorCode;
+      std::uintmax_t fileSize = std::filesystem::file_size(std::filesystem::u8path(this->sgfFilePaths[fileIndex]), errorCode);
+      if (! errorCode)
+        fileSizes[fileIndex] = fileSize;
+    }
+
+    // If the result order is preserved, a file must not be postponed by
+    // more than the number of pending results, otherwise the results that
+    // wait for the postponed file could exceed the limit
+    std::size_t groupSize = this->isResultOrderPreserved ? this->maximumNumberOfPendingResults : numberOfFiles;
+    for (std::size_t groupBegin = 0; groupBegin < numberOfFiles; groupBegin += groupSize)
+    {
+      std::size_t groupEnd = std::min(groupBegin + groupSize, numberOfFiles);
+      std::stable_sort(
+        this->schedule.begin() + groupBegin,
+        this->schedule.begin() + groupEnd,
+        [&fileSizes](std::size_t fileIndex1, std::size_t fileIndex2)
+        {
+          return fileSizes[fileIndex1] > fileSizes[fileIndex2];
+        });
+    }
+  }
+
+  void SgfcBatchDocumentReader::PrepareWorkerDocumentReaders(unsigned int numberOfWorkerThreads)
+  {
+    while (this->workerDocumentReaders.size() < numberOfWorkerThreads)
+      this->workerDocumentReaders.push_back(std::shared_ptr<SgfcDocumentReader>(new SgfcDocumentReader()));
+
+    for (unsigned int workerThreadIndex = 0; workerThreadIndex < numberOfWorkerThreads; workerThreadIndex++)
+    {
+      auto workerDocumentReader = this->workerDocumentReaders[workerThreadIndex];
+      workerDocumentReader->SetReadOptions(this->readOptions);
+      SgfcArguments::CopyArguments(*this->arguments, *workerDocumentReader->GetArguments());
+    }
+  }
+
+  void SgfcBatchDocumentReader::ReadFilesOnWorkerThread(unsigned int workerThreadIndex)
+  {
+    std::shared_ptr<SgfcDocumentReader> documentReader = this->workerDocumentReaders[workerThreadIndex];
+
+    while (true)
+    {
+      std::size_t fileIndex;
+      {
+        std::unique_lock<std::mutex> lock(this->batchMutex);
+        this->workerCondition.wait(lock, [this]()
+        {
+          return
+            this->isStopRequested ||
+            this->numberOfStartedFiles >= this->schedule.size() ||
+            CanStartNextScheduledFile();
+        });
+
+        if (this->isStopRequested || this->numberOfStartedFiles >= this->schedule.size())
+          return;
+
+        fileIndex = this->schedule[this->numberOfStartedFiles];
+        this->numberOfStartedFiles++;
+      }
+
+      SgfcBatchReadResult batchReadResult;
+      batchReadResult.FileIndex = fileIndex;
+      batchReadResult.SgfFilePath = this->sgfFilePaths[fileIndex];
+
+      try
+      {
+        batchReadResult.DocumentReadResult = documentReader->ReadSgfFile(batchReadResult.SgfFilePath);
+      }
+      catch (std::exception& exception)
+      {
+        // An exception must not escape from the worker thread, so it is
+        // reported in the same way as a file that cannot be read
+        std::string messageText = "Reading SGF file failed: " + std::string(exception.what());
+        batchReadResult.DocumentReadResult = std::shared_ptr<ISgfcDocumentReadResult>(new SgfcDocumentReadResult(
+          std::shared_ptr<ISgfcMessage>(new SgfcMessage(SgfcMessageID::ReadSgfContentFromFilesystemError, messageText))));
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(this->batchMutex);
+
+        std::size_t resultKey = this->isResultOrderPreserved ? fileIndex : this->numberOfCompletedFiles;
+        this->numberOfCompletedFiles++;
+        this->completedResults.emplace(resultKey, std::move(batchReadResult));
+      }
+
+      this->resultCondition.notify_one();
+    }
+  }
+
+  bool SgfcBatchDocumentReader::CanStartNextScheduledFile() const
+  {
+    // Files that are being read count against the limit, so that a result
+    // always finds room when the file finishes reading
+    std::size_t numberOfPendingResults = this->numberOfStartedFiles - this->numberOfHandedOutResults;
+    if (numberOfPendingResults >= this->maximumNumberOfPendingResults)
+      return false;
+
+    // If the result order is preserved, results wait for the files that
+    // precede them in the batch. A file that is too far ahead of the next
+    // result to hand out must wait, too.
+    if (this->isResultOrderPreserved)
+    {
+      std::size_t fileIndex = this->schedule[this->numberOfStartedFiles];
+      return fileIndex < this->numberOfHandedOutResults + this->maximumNumberOfPendingResults;
+    }
+
+    return true;
+  }
+
+  void SgfcBatchDocumentReader::JoinWorkerThreads()
+  {
+    for (auto& workerThread : this->workerThreads)
+      workerThread.join();
+
+    this->workerThreads.clear();
+  }
+
+  void SgfcBatchDocumentReader::ResetBatch()
+  {
+    this->sgfFilePaths.clear();
+    this->schedule.clear();
+    this->numberOfStartedFiles = 0;
+    this->numberOfCompletedFiles = 0;
+    this->numberOfHandedOutResults = 0;
+    this->isStopRequested = false;
+    this->completedResults.clear();
+  }
+}
@@ -0,0 +1,110 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../../include/ISgfcBatchDocumentReader.h"
+
+// C++ Standard Library includes
+#include <condition_variable>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class SgfcDocumentReader;
+
+  /// @brief The SgfcBatchDocumentReader class provides an implementation of
+  /// the ISgfcBatchDocumentReader interface. See the interface header file
+  /// for documentation.
+  ///
+  /// @ingroup internals
+  /// @ingroup sgfc-frontend
+  ///
+  /// The worker threads share a single schedule, i.e. a list of file
+  /// indexes in the order in which the files are to be read. A worker
+  /// thread that becomes idle takes the next file from the schedule, so
+  /// the load is balanced dynamically without the need to steal work from
+  /// other worker threads.
+  ///
+  /// Completed results are stored in a map whose key is the order in which
+  /// the results are handed out: The file index if the result order is
+  /// preserved, otherwise a running number that is assigned when a file
+  /// finishes reading. The next result to hand out is therefore always the
+  /// first entry of the map, provided its key matches the number of results
+  /// that have been handed out so far.
+  class SgfcBatchDocumentReader : public ISgfcBatchDocumentReader
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcBatchDocumentReader object.
+    SgfcBatchDocumentReader();
+
+    /// @brief Destroys and cleans up the SgfcBatchDocumentReader object.
+    virtual ~SgfcBatchDocumentReader();
+
+    virtual std::shared_ptr<ISgfcArguments> GetArguments() const override;
+    virtual SgfcDocumentReadOptions GetReadOptions() const override;
+    virtual void SetReadOptions(const SgfcDocumentReadOptions& readOptions) override;
+    virtual SgfcBatchReadOptions GetBatchReadOptions() const override;
+    virtual void SetBatchReadOptions(const SgfcBatchReadOptions& batchReadOptions) override;
+    virtual std::vector<std::string> FindFiles(
+      const std::string& directoryPath,
+      const std::string& fileNamePattern) const override;
+    virtual void StartReading(const std::vector<std::string>& sgfFilePaths) override;
+    virtual bool ReadNextResult(SgfcBatchReadResult& batchReadResult) override;
+    virtual bool IsReading() const override;
+    virtual void StopReading() override;
+    virtual void ReadSgfFiles(
+      const std::vector<std::string>& sgfFilePaths,
+      const std::function<void(const SgfcBatchReadResult& batchReadResult)>& resultHandler) override;
+
+  private:
+    std::shared_ptr<ISgfcArguments> arguments;
+    SgfcDocumentReadOptions readOptions;
+    SgfcBatchReadOptions batchReadOptions;
+    std::vector<std::shared_ptr<SgfcDocumentReader>> workerDocumentReaders;
+
+    // The state of the batch that is being read. Everything below except
+    // the worker threads themselves is protected by batchMutex while worker
+    // threads are running.
+    std::vector<std::string> sgfFilePaths;
+    std::vector<std::size_t> schedule;
+    bool isResultOrderPreserved;
+    std::size_t maximumNumberOfPendingResults;
+    std::size_t numberOfStartedFiles;
+    std::size_t numberOfCompletedFiles;
+    std::size_t numberOfHandedOutResults;
+    bool isStopRequested;
+    std::map<std::size_t, SgfcBatchReadResult> completedResults;
+    std::mutex batchMutex;
+    std::condition_variable workerCondition;
+    std::condition_variable resultCondition;
+    std::vector<std::thread> workerThreads;
+
+    void CreateSchedule();
+    void PrepareWorkerDocumentReaders(unsigned int numberOfWorkerThreads);
+    void ReadFilesOnWorkerThread(unsigned int workerThreadIndex);
+    bool CanStartNextScheduledFile() const;
+    void JoinWorkerThreads();
+    void ResetBatch();
+  };
+}
@@ -0,0 +1,196 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../SgfcParallelUtility.h"
+#include "../../SgfcPrivateConstants.h"
+#include "../argument/SgfcArguments.h"
+#include "../message/SgfcMessage.h"
+#include "SgfcBatchDocumentWriter.h"
+#include "SgfcDocumentWriter.h"
+#include "SgfcDocumentWriteResult.h"
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcBatchDocumentWriter::SgfcBatchDocumentWriter()
+    : arguments(new SgfcArguments())
+    , batchDocumentWriter(new SgfcDocumentWriter())
+    , numberOfStartedFiles(0)
+    , isStopRequested(false)
+  {
+    this->arguments->AddArgument(SgfcArgumentType::DefaultEncoding, SgfcPrivateConstants::TextEncodingNameUTF8);
+  }
+
+  SgfcBatchDocumentWriter::~SgfcBatchDocumentWriter()
+  {
+  }
+
+  std::shared_ptr<ISgfcArguments> SgfcBatchDocumentWriter::GetArguments() const
+  {
+    return this->arguments;
+  }
+
+  SgfcBatchWriteOptions SgfcBatchDocumentWriter::GetBatchWriteOptions() const
+  {
+    return this->batchWriteOptions;
+  }
+
+  void SgfcBatchDocumentWriter::SetBatchWriteOptions(const SgfcBatchWriteOptions& batchWriteOptions)
+  {
+    this->batchWriteOptions = batchWriteOptions;
+  }
+
+  std::vector<SgfcBatchWriteResult> SgfcBatchDocumentWriter::WriteSgfFiles(
+    const std::vector<std::shared_ptr<ISgfcDocument>>& documents,
+    const std::vector<std::string>& sgfFilePaths)
+  {
+    std::vector<SgfcBatchWriteResult> batchWriteResults(documents.size());
+
+    WriteSgfFiles(documents, sgfFilePaths, [&batchWriteResults](const SgfcBatchWriteResult& batchWriteResult)
+    {
+      batchWriteResults[batchWriteResult.FileIndex] = batchWriteResult;
+    });
+
+    return batchWriteResults;
+  }
+
+  void SgfcBatchDocumentWriter::WriteSgfFiles(
+    const std::vector<std::shared_ptr<ISgfcDocument>>& documents,
+    const std::vector<std::string>& sgfFilePaths,
+    const std::function<void(const SgfcBatchWriteResult& batchWriteResult)>& resultHandler)
+  {
+    if (documents.size() != sgfFilePaths.size())
+      throw std::invalid_argument("WriteSgfFiles failed: The number of documents differs from the number of file paths");
+    if (std::find(documents.begin(), documents.end(), nullptr) != documents.end())
+      throw std::invalid_argument("WriteSgfFiles failed: Document is nullptr");
+
+    if (documents.empty())
+      return;
+
+    this->documents = documents;
+    this->sgfFilePaths = sgfFilePaths;
+
+    SgfcArguments::CopyArguments(*this->arguments, *this->batchDocumentWriter->GetArguments());
+
+    unsigned int numberOfWorkerThreads = SgfcParallelUtility::GetNumberOfWorkerThreads(
+      this->batchWriteOptions.NumberOfThreads,
+      this->documents.size());
+
+    try
+    {
+      for (unsigned int workerThreadIndex = 0; workerThreadIndex < numberOfWorkerThreads; workerThreadIndex++)
+        this->workerThreads.emplace_back(&SgfcBatchDocumentWriter::WriteFilesOnWorkerThread, this);
+
+      for (std::size_t numberOfHandedOutResults = 0; numberOfHandedOutResults < this->documents.size(); numberOfHandedOutResults++)
+      {
+        SgfcBatchWriteResult batchWriteResult;
+        {
+          std::unique_lock<std::mutex> lock(this->batchMutex);
+          this->resultCondition.wait(lock, [this]()
+          {
+            return ! this->completedResults.empty();
+          });
+
+          batchWriteResult = std::move(this->completedResults.front());
+          this->completedResults.pop_front();
+        }
+
+        resultHandler(batchWriteResult);
+      }
+    }
+    catch (...)
+    {
+      StopWriting();
+      throw;
+    }
+
+    StopWriting();
+  }
+
+  void SgfcBatchDocumentWriter::WriteFilesOnWorkerThread()
+  {
+    while (true)
+    {
+      std::size_t fileIndex;
+      {
+        std::lock_guard<std::mutex> lock(this->batchMutex);
+
+        if (this->isStopRequested || this->numberOfStartedFiles >= this->documents.size())
+          return;
+
+        fileIndex = this->numberOfStartedFiles;
+        this->numberOfStartedFiles++;
+      }
+
+      SgfcBatchWriteResult batchWriteResult;
+      batchWriteResult.FileIndex = fileIndex;
+      batchWriteResult.SgfFilePath = this->sgfFilePaths[fileIndex];
+
+      try
+      {
+        batchWriteResult.DocumentWriteResult = this->batchDocumentWriter->WriteSgfFile(
+          this->documents[fileIndex],
+          batchWriteResult.SgfFilePath);
+      }
+      catch (std::exception& exception)
+      {
+        // An exception must not escape from the worker thread, and it must
+        // not prevent the other documents of the batch from being written,
+        // so it is reported in the same way as a file that cannot be written
+        std::string messageText = "Writing SGF file failed: " + std::string(exception.what());
+        std::vector<std::shared_ptr<ISgfcMessage>> parseResult;
+        parseResult.push_back(std::shared_ptr<ISgfcMessage>(new SgfcMessage(SgfcMessageID::SaveSgfContentToFilesystemError, messageText)));
+        batchWriteResult.DocumentWriteResult = std::shared_ptr<ISgfcDocumentWriteResult>(new SgfcDocumentWriteResult(parseResult));
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(this->batchMutex);
+        this->completedResults.push_back(std::move(batchWriteResult));
+      }
+
+      this->resultCondition.notify_one();
+    }
+  }
+
+  void SgfcBatchDocumentWriter::StopWriting()
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->batchMutex);
+      this->isStopRequested = true;
+    }
+
+    for (auto& workerThread : this->workerThreads)
+      workerThread.join();
+
+    this->workerThreads.clear();
+
+    ResetBatch();
+  }
+
+  void SgfcBatchDocumentWriter::ResetBatch()
+  {
+    this->documents.clear();
+    this->sgfFilePaths.clear();
+    this->numberOfStartedFiles = 0;
+    this->isStopRequested = false;
+    this->completedResults.clear();
+  }
+}
@@ -0,0 +1,92 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../../include/ISgfcBatchDocumentWriter.h"
+
+// C++ Standard Library includes
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class SgfcDocumentWriter;
+
+  /// @brief The SgfcBatchDocumentWriter class provides an implementation of
+  /// the ISgfcBatchDocumentWriter interface. See the interface header file
+  /// for documentation.
+  ///
+  /// @ingroup internals
+  /// @ingroup sgfc-frontend
+  ///
+  /// The worker threads take the documents of a batch in ascending order.
+  /// All worker threads share a single SgfcDocumentWriter object, which is
+  /// safe because writing a document does not modify the writer. The
+  /// writer's arguments are a copy of the arguments of
+  /// SgfcBatchDocumentWriter that is made when a batch is started.
+  ///
+  /// Completed results are queued until the thread that started the batch
+  /// hands them out.
+  class SgfcBatchDocumentWriter : public ISgfcBatchDocumentWriter
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcBatchDocumentWriter object.
+    SgfcBatchDocumentWriter();
+
+    /// @brief Destroys and cleans up the SgfcBatchDocumentWriter object.
+    virtual ~SgfcBatchDocumentWriter();
+
+    virtual std::shared_ptr<ISgfcArguments> GetArguments() const override;
+    virtual SgfcBatchWriteOptions GetBatchWriteOptions() const override;
+    virtual void SetBatchWriteOptions(const SgfcBatchWriteOptions& batchWriteOptions) override;
+    virtual std::vector<SgfcBatchWriteResult> WriteSgfFiles(
+      const std::vector<std::shared_ptr<ISgfcDocument>>& documents,
+      const std::vector<std::string>& sgfFilePaths) override;
+    virtual void WriteSgfFiles(
+      const std::vector<std::shared_ptr<ISgfcDocument>>& documents,
+      const std::vector<std::string>& sgfFilePaths,
+      const std::function<void(const SgfcBatchWriteResult& batchWriteResult)>& resultHandler) override;
+
+  private:
+    std::shared_ptr<ISgfcArguments> arguments;
+    SgfcBatchWriteOptions batchWriteOptions;
+    std::shared_ptr<SgfcDocumentWriter> batchDocumentWriter;
+
+    // The state of the batch that is being written. Everything below except
+    // the worker threads themselves is protected by batchMutex while worker
+    // threads are running.
+    std::vector<std::shared_ptr<ISgfcDocument>> documents;
+    std::vector<std::string> sgfFilePaths;
+    std::size_t numberOfStartedFiles;
+    bool isStopRequested;
+    std::deque<SgfcBatchWriteResult> completedResults;
+    std::mutex batchMutex;
+    std::condition_variable resultCondition;
+    std::vector<std::thread> workerThreads;
+
+    void WriteFilesOnWorkerThread();
+    void StopWriting();
+    void ResetBatch();
+  };
+}
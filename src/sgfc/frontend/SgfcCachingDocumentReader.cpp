@@ -0,0 +1,556 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../../include/ISgfcBinaryDocumentReader.h"
+#include "../../../include/ISgfcBinaryDocumentWriter.h"
+#include "../../../include/ISgfcDocumentReadResult.h"
+#include "../../../include/ISgfcMessage.h"
+#include "../../../include/SgfcPlusPlusFactory.h"
+#include "../../SgfcBinaryUtility.h"
+#include "../../SgfcPrivateConstants.h"
+#include "../../SgfcUtility.h"
+#include "../message/SgfcMessage.h"
+#include "SgfcCachingDocumentReader.h"
+#include "SgfcDocumentCacheUtility.h"
+#include "SgfcDocumentReader.h"
+#include "SgfcDocumentReadResult.h"
+
+// C++ Standard Library includes
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcCachingDocumentReader::SgfcCachingDocumentReader(const std::string& cacheDirectoryPath)
+    : documentReader(new SgfcDocumentReader())
+    , cacheDirectoryPath(cacheDirectoryPath)
+    , cacheKeyType(SgfcDocumentCacheKeyType::FileContent)
+    , maximumCacheSize(SgfcPrivateConstants::DocumentCacheDefaultMaximumSize)
+    , estimatedCacheSize(0)
+    // The size of the entries already in the cache directory is not known
+    // yet, so the first store scans the cache directory
+    , numberOfStoresSinceLastScan(SgfcPrivateConstants::DocumentCacheEvictionScanInterval)
+  {
+    std::filesystem::path cacheDirectory = std::filesystem::u8path(cacheDirectoryPath);
+
+    std::error_code errorCode;
+    if (std::filesystem::exists(cacheDirectory, errorCode))
+    {
+      if (! std::filesystem::is_directory(cacheDirectory, errorCode))
+      {
+        std::stringstream message;
+        message << "SgfcCachingDocumentReader constructor failed: Cache directory path does not refer to a directory: " << cacheDirectoryPath;
+        throw std::invalid_argument(message.str());
+      }
+    }
+    else
+    {
+      // Another process may create the directory at the same time. This is
+      // not an error, create_directories() simply returns false in that case.
+      std::filesystem::create_directories(cacheDirectory, errorCode);
+      if (errorCode)
+      {
+        std::stringstream message;
+        message << "Failed to create cache directory: " << cacheDirectoryPath << ", error = " << errorCode.message();
+        throw std::runtime_error(message.str());
+      }
+    }
+  }
+
+  SgfcCachingDocumentReader::~SgfcCachingDocumentReader()
+  {
+  }
+
+  std::shared_ptr<ISgfcArguments> SgfcCachingDocumentReader::GetArguments() const
+  {
+    return this->documentReader->GetArguments();
+  }
+
+  SgfcDocumentReadOptions SgfcCachingDocumentReader::GetReadOptions() const
+  {
+    return this->documentReader->GetReadOptions();
+  }
+
+  void SgfcCachingDocumentReader::SetReadOptions(const SgfcDocumentReadOptions& readOptions)
+  {
+    this->documentReader->SetReadOptions(readOptions);
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> SgfcCachingDocumentReader::ReadSgfFile(const std::string& sgfFilePath) const
+  {
+    if (this->cacheKeyType == SgfcDocumentCacheKeyType::FileContent)
+      return ReadSgfFileWithFileContentKey(sgfFilePath);
+    else
+      return ReadSgfFileWithFileMetadataKey(sgfFilePath);
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> SgfcCachingDocumentReader::ReadSgfContent(const std::string& sgfContent) const
+  {
+    std::string key = GetKey(SgfcDocumentCacheUtility::GetContentIdentification(sgfContent));
+
+    auto readResult = LoadCacheEntry(key);
+    if (readResult != nullptr)
+      return readResult;
+
+    readResult = this->documentReader->ReadSgfContent(sgfContent);
+    StoreCacheEntry(key, readResult);
+
+    return readResult;
+  }
+
+  std::string SgfcCachingDocumentReader::GetCacheDirectoryPath() const
+  {
+    return this->cacheDirectoryPath;
+  }
+
+  SgfcDocumentCacheKeyType SgfcCachingDocumentReader::GetCacheKeyType() const
+  {
+    return this->cacheKeyType;
+  }
+
+  void SgfcCachingDocumentReader::SetCacheKeyType(SgfcDocumentCacheKeyType cacheKeyType)
+  {
+    this->cacheKeyType = cacheKeyType;
+  }
+
+  std::uint64_t SgfcCachingDocumentReader::GetMaximumCacheSize() const
+  {
+    return this->maximumCacheSize;
+  }
+
+  void SgfcCachingDocumentReader::SetMaximumCacheSize(std::uint64_t maximumCacheSize)
+  {
+    this->maximumCacheSize = maximumCacheSize;
+  }
+
+  void SgfcCachingDocumentReader::ClearCache() const
+  {
+    std::filesystem::path cacheDirectory = std::filesystem::u8path(this->cacheDirectoryPath);
+
+    // Other processes may add or remove entries while we are iterating, so
+    // all errors are ignored
+    std::error_code errorCode;
+    for (auto iterator = std::filesystem::directory_iterator(cacheDirectory, errorCode);
+         ! errorCode && iterator != std::filesystem::directory_iterator();
+         iterator.increment(errorCode))
+    {
+      if (IsCacheEntryFile(iterator->path().filename().u8string()))
+      {
+        std::error_code removeErrorCode;
+        std::filesystem::remove(iterator->path(), removeErrorCode);
+      }
+    }
+
+    this->estimatedCacheSize = 0;
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> SgfcCachingDocumentReader::ReadSgfFileWithFileContentKey(const std::string& sgfFilePath) const
+  {
+    std::string sgfContent;
+    if (! SgfcDocumentCacheUtility::ReadFileContent(sgfFilePath, sgfContent))
+    {
+      // Let the regular reader generate the appropriate error message
+      return this->documentReader->ReadSgfFile(sgfFilePath);
+    }
+
+    std::string key = GetKey(SgfcDocumentCacheUtility::GetContentIdentification(sgfContent));
+
+    auto readResult = LoadCacheEntry(key);
+    if (readResult != nullptr)
+      return readResult;
+
+    // Parse the content that we hashed, not the file - the file might have
+    // been modified in the meantime
+    readResult = this->documentReader->ReadSgfContent(sgfContent);
+    StoreCacheEntry(key, readResult);
+
+    return readResult;
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> SgfcCachingDocumentReader::ReadSgfFileWithFileMetadataKey(const std::string& sgfFilePath) const
+  {
+    std::string fileMetadataIdentificationBeforeRead;
+    if (! SgfcDocumentCacheUtility::GetFileMetadataIdentification(sgfFilePath, fileMetadataIdentificationBeforeRead))
+      return this->documentReader->ReadSgfFile(sgfFilePath);
+
+    std::string key = GetKey(fileMetadataIdentificationBeforeRead);
+
+    auto readResult = LoadCacheEntry(key);
+    if (readResult != nullptr)
+      return readResult;
+
+    readResult = this->documentReader->ReadSgfFile(sgfFilePath);
+
+    // Don't store the read result if the file was modified while it was
+    // being read - the read result might not match the key
+    std::string fileMetadataIdentificationAfterRead;
+    if (SgfcDocumentCacheUtility::GetFileMetadataIdentification(sgfFilePath, fileMetadataIdentificationAfterRead) &&
+        fileMetadataIdentificationAfterRead == fileMetadataIdentificationBeforeRead)
+    {
+      StoreCacheEntry(key, readResult);
+    }
+
+    return readResult;
+  }
+
+  std::string SgfcCachingDocumentReader::GetKey(const std::string& dataIdentification) const
+  {
+    std::stringstream key;
+
+    // The binary document format version is part of the key because the
+    // cache entry embeds a binary document
+    key
+      << SgfcPrivateConstants::DocumentCacheMagic
+      << " " << SgfcPrivateConstants::DocumentCacheFormatVersion
+      << " " << SgfcPrivateConstants::BinaryDocumentFormatVersion
+      << "\n";
+
+    key
+      << SgfcDocumentCacheUtility::GetArgumentsIdentification(this->documentReader->GetArguments())
+      << SgfcDocumentCacheUtility::GetReadOptionsIdentification(this->documentReader->GetReadOptions())
+      << dataIdentification;
+
+    return key.str();
+  }
+
+  std::string SgfcCachingDocumentReader::GetCacheEntryFilePath(const std::string& key) const
+  {
+    std::stringstream cacheEntryFileName;
+    cacheEntryFileName
+      << std::hex << std::setw(16) << std::setfill('0') << SgfcUtility::GetHash(key)
+      << "."
+      << SgfcPrivateConstants::DocumentCacheFileSuffix;
+
+    return SgfcUtility::JoinPathComponents(this->cacheDirectoryPath, cacheEntryFileName.str());
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> SgfcCachingDocumentReader::LoadCacheEntry(const std::string& key) const
+  {
+    std::filesystem::path cacheEntryFile = std::filesystem::u8path(GetCacheEntryFilePath(key));
+
+    std::ifstream in(cacheEntryFile, std::ios::binary);
+    if (! in.is_open())
+      return nullptr;
+
+    std::stringstream cacheEntryContent;
+    cacheEntryContent << in.rdbuf();
+    in.close();
+
+    std::shared_ptr<ISgfcDocumentReadResult> readResult;
+    try
+    {
+      readResult = ReadCacheEntryContent(key, cacheEntryContent.str());
+    }
+    catch (std::exception&)
+    {
+      // The entry is corrupt or was written by an incompatible version of
+      // the library. Treat this as a cache miss. The entry is not removed,
+      // because another process may have replaced it with a good entry in
+      // the meantime. The entry is simply overwritten when we store our read
+      // result.
+      return nullptr;
+    }
+
+    // A nullptr read result means that the entry belongs to a different key
+    // whose hash collides with ours. The entry is simply overwritten when we
+    // store our read result.
+    if (readResult == nullptr)
+      return nullptr;
+
+    // Mark the entry as recently used so that eviction spares it
+    std::error_code errorCode;
+    std::filesystem::last_write_time(cacheEntryFile, std::filesystem::file_time_type::clock::now(), errorCode);
+
+    return readResult;
+  }
+
+  void SgfcCachingDocumentReader::StoreCacheEntry(const std::string& key, std::shared_ptr<ISgfcDocumentReadResult> readResult) const
+  {
+    // Fatal errors are typically caused by invalid arguments or by I/O
+    // problems, both of which are not a property of the SGF data
+    if (readResult->GetExitCode() == SgfcExitCode::FatalError)
+      return;
+
+    std::string cacheEntryContent;
+    try
+    {
+      cacheEntryContent = WriteCacheEntryContent(key, readResult);
+    }
+    catch (std::invalid_argument&)
+    {
+      // The document is too large for the binary document format
+      return;
+    }
+
+    // Write to a temporary file first, then rename the file. Renaming is
+    // atomic, so other readers of the cache never see a partially written
+    // entry.
+    std::string tempFilePath = SgfcUtility::JoinPathComponents(
+      this->cacheDirectoryPath,
+      SgfcUtility::GetUniqueTempFileName());
+    std::filesystem::path tempFile = std::filesystem::u8path(tempFilePath);
+
+    std::ofstream out(tempFile, std::ios::binary | std::ios::trunc);
+    if (! out.is_open())
+      return;
+
+    out.write(cacheEntryContent.data(), static_cast<std::streamsize>(cacheEntryContent.size()));
+    out.close();
+
+    std::error_code errorCode;
+    if (out.fail())
+    {
+      std::filesystem::remove(tempFile, errorCode);
+      return;
+    }
+
+    std::filesystem::rename(tempFile, std::filesystem::u8path(GetCacheEntryFilePath(key)), errorCode);
+    if (errorCode)
+    {
+      std::error_code removeErrorCode;
+      std::filesystem::remove(tempFile, removeErrorCode);
+      return;
+    }
+
+    // Scanning the cache directory costs O(number of entries), so it is
+    // done only if the cache may have become too large
+    std::uint64_t estimatedCacheSize = (this->estimatedCacheSize += cacheEntryContent.size());
+    std::uint64_t numberOfStoresSinceLastScan = ++this->numberOfStoresSinceLastScan;
+    if (estimatedCacheSize > this->maximumCacheSize ||
+        numberOfStoresSinceLastScan >= SgfcPrivateConstants::DocumentCacheEvictionScanInterval)
+    {
+      EvictCacheEntries();
+    }
+  }
+
+  std::string SgfcCachingDocumentReader::WriteCacheEntryContent(const std::string& key, std::shared_ptr<ISgfcDocumentReadResult> readResult) const
+  {
+    std::string binaryDocumentContent;
+    auto binaryDocumentWriter = SgfcPlusPlusFactory::CreateBinaryDocumentWriter();
+    binaryDocumentWriter->WriteBinaryContent(readResult->GetDocument(), binaryDocumentContent);
+
+    std::stringstream out;
+
+    SgfcBinaryUtility::WriteCharacters(out, SgfcPrivateConstants::DocumentCacheMagic);
+    SgfcBinaryUtility::WriteUInt32(out, SgfcPrivateConstants::DocumentCacheFormatVersion);
+
+    std::uint32_t flags = 0;
+    if (readResult->IsDocumentTruncated())
+      flags |= SgfcPrivateConstants::DocumentCacheFlagDocumentTruncated;
+    SgfcBinaryUtility::WriteUInt32(out, flags);
+    SgfcBinaryUtility::WriteString(out, key);
+
+    auto parseResult = readResult->GetParseResult();
+    SgfcBinaryUtility::WriteUInt64(out, parseResult.size());
+    for (auto message : parseResult)
+    {
+      SgfcBinaryUtility::WriteUInt32(out, static_cast<std::uint32_t>(static_cast<int>(message->GetMessageID())));
+      SgfcBinaryUtility::WriteUInt8(out, static_cast<std::uint8_t>(message->GetMessageType()));
+      SgfcBinaryUtility::WriteUInt64(out, message->GetLineNumber());
+      SgfcBinaryUtility::WriteUInt64(out, message->GetColumnNumber());
+      SgfcBinaryUtility::WriteUInt8(out, message->IsCriticalMessage() ? 1 : 0);
+      SgfcBinaryUtility::WriteUInt32(out, static_cast<std::uint32_t>(message->GetLibraryErrorNumber()));
+      SgfcBinaryUtility::WriteString(out, message->GetMessageText());
+      SgfcBinaryUtility::WriteString(out, message->GetFormattedMessageText());
+    }
+
+    SgfcBinaryUtility::WriteUInt64(out, binaryDocumentContent.size());
+    SgfcBinaryUtility::WriteCharacters(out, binaryDocumentContent);
+
+    return out.str();
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> SgfcCachingDocumentReader::ReadCacheEntryContent(const std::string& key, const std::string& cacheEntryContent) const
+  {
+    std::istringstream in(cacheEntryContent);
+
+    std::string magic = SgfcBinaryUtility::ReadCharacters(in, SgfcPrivateConstants::DocumentCacheMagic.size());
+    if (magic != SgfcPrivateConstants::DocumentCacheMagic)
+      throw std::runtime_error("Cache entry is not a document cache entry");
+
+    std::uint32_t formatVersion = SgfcBinaryUtility::ReadUInt32(in);
+    if (formatVersion != SgfcPrivateConstants::DocumentCacheFormatVersion)
+      throw std::runtime_error("Cache entry has an unsupported format version");
+
+    std::uint32_t flags = SgfcBinaryUtility::ReadUInt32(in);
+    bool isDocumentTruncated = ((flags & SgfcPrivateConstants::DocumentCacheFlagDocumentTruncated) != 0);
+
+    std::string storedKey = SgfcBinaryUtility::ReadString(in);
+    if (storedKey != key)
+      return nullptr;
+
+    // Each message occupies at least 34 bytes. Checking this before the loop
+    // prevents a corrupt message count from causing a huge allocation.
+    const std::uint64_t minimumMessageSize = 34;
+    std::uint64_t numberOfMessages = SgfcBinaryUtility::ReadUInt64(in);
+    if (numberOfMessages > cacheEntryContent.size() / minimumMessageSize)
+      throw std::runtime_error("Cache entry is corrupt: Invalid number of messages");
+
+    std::vector<std::shared_ptr<ISgfcMessage>> parseResult;
+    for (std::uint64_t indexOfMessage = 0; indexOfMessage < numberOfMessages; indexOfMessage++)
+    {
+      SgfcMessageID messageID = static_cast<SgfcMessageID>(static_cast<std::int32_t>(SgfcBinaryUtility::ReadUInt32(in)));
+      SgfcMessageType messageType = static_cast<SgfcMessageType>(SgfcBinaryUtility::ReadUInt8(in));
+      unsigned long lineNumber = static_cast<unsigned long>(SgfcBinaryUtility::ReadUInt64(in));
+      unsigned long columnNumber = static_cast<unsigned long>(SgfcBinaryUtility::ReadUInt64(in));
+      bool isCriticalMessage = (SgfcBinaryUtility::ReadUInt8(in) != 0);
+      int libraryErrorNumber = static_cast<std::int32_t>(SgfcBinaryUtility::ReadUInt32(in));
+      std::string messageText = SgfcBinaryUtility::ReadString(in);
+      std::string formattedMessageText = SgfcBinaryUtility::ReadString(in);
+
+      // The SgfcMessage constructors throw std::invalid_argument if the
+      // values are inconsistent, which is what we want for corrupt data
+      std::shared_ptr<ISgfcMessage> message;
+      if (static_cast<int>(messageID) < 0)
+      {
+        message = std::shared_ptr<ISgfcMessage>(new SgfcMessage(
+          messageID,
+          messageText));
+      }
+      else
+      {
+        message = std::shared_ptr<ISgfcMessage>(new SgfcMessage(
+          messageID,
+          messageType,
+          lineNumber,
+          columnNumber,
+          isCriticalMessage,
+          libraryErrorNumber,
+          messageText,
+          formattedMessageText));
+      }
+
+      parseResult.push_back(message);
+    }
+
+    std::uint64_t binaryDocumentSize = SgfcBinaryUtility::ReadUInt64(in);
+    std::uint64_t numberOfRemainingBytes = cacheEntryContent.size() - static_cast<std::uint64_t>(in.tellg());
+    if (binaryDocumentSize != numberOfRemainingBytes)
+      throw std::runtime_error("Cache entry is corrupt: Invalid binary document size");
+
+    std::string binaryDocumentContent = SgfcBinaryUtility::ReadCharacters(in, static_cast<std::size_t>(binaryDocumentSize));
+
+    auto binaryDocumentReader = SgfcPlusPlusFactory::CreateBinaryDocumentReader();
+    auto document = binaryDocumentReader->ReadBinaryContent(binaryDocumentContent);
+
+    std::shared_ptr<ISgfcDocumentReadResult> readResult = std::shared_ptr<ISgfcDocumentReadResult>(new SgfcDocumentReadResult(
+      parseResult,
+      document,
+      isDocumentTruncated));
+    return readResult;
+  }
+
+  void SgfcCachingDocumentReader::EvictCacheEntries() const
+  {
+    struct CacheEntryFile
+    {
+      std::filesystem::path Path;
+      std::uintmax_t Size;
+      std::filesystem::file_time_type LastWriteTime;
+    };
+
+    std::filesystem::path cacheDirectory = std::filesystem::u8path(this->cacheDirectoryPath);
+    std::filesystem::file_time_type now = std::filesystem::file_time_type::clock::now();
+    std::chrono::seconds staleTempFileAge(SgfcPrivateConstants::DocumentCacheStaleTempFileAge);
+
+    std::vector<CacheEntryFile> cacheEntryFiles;
+    std::uint64_t totalCacheSize = 0;
+
+    // Other processes may add or remove entries while we are iterating, so
+    // all errors are ignored. The worst thing that can happen is that the
+    // cache temporarily exceeds its maximum size.
+    std::error_code errorCode;
+    for (auto iterator = std::filesystem::directory_iterator(cacheDirectory, errorCode);
+         ! errorCode && iterator != std::filesystem::directory_iterator();
+         iterator.increment(errorCode))
+    {
+      std::error_code fileErrorCode;
+
+      std::string fileName = iterator->path().filename().u8string();
+      std::filesystem::file_time_type lastWriteTime = iterator->last_write_time(fileErrorCode);
+      if (fileErrorCode)
+        continue;
+
+      if (IsTempFile(fileName))
+      {
+        // A temporary file that has been around for a long time was left
+        // behind by a process that died while writing a cache entry
+        if (now - lastWriteTime > staleTempFileAge)
+          std::filesystem::remove(iterator->path(), fileErrorCode);
+      }
+      else if (IsCacheEntryFile(fileName))
+      {
+        std::uintmax_t fileSize = iterator->file_size(fileErrorCode);
+        if (fileErrorCode)
+          continue;
+
+        cacheEntryFiles.push_back({ iterator->path(), fileSize, lastWriteTime });
+        totalCacheSize += fileSize;
+      }
+    }
+
+    this->numberOfStoresSinceLastScan = 0;
+
+    if (totalCacheSize <= this->maximumCacheSize)
+    {
+      this->estimatedCacheSize = totalCacheSize;
+      return;
+    }
+
+    // Shrink the cache below the maximum so that the next store does not
+    // immediately exceed the maximum again
+    std::uint64_t targetCacheSize = this->maximumCacheSize / 100 * SgfcPrivateConstants::DocumentCacheEvictionTargetPercentage;
+
+    std::sort(
+      cacheEntryFiles.begin(),
+      cacheEntryFiles.end(),
+      [](const CacheEntryFile& cacheEntryFile1, const CacheEntryFile& cacheEntryFile2)
+      {
+        return cacheEntryFile1.LastWriteTime < cacheEntryFile2.LastWriteTime;
+      });
+
+    for (const auto& cacheEntryFile : cacheEntryFiles)
+    {
+      if (totalCacheSize <= targetCacheSize)
+        break;
+
+      std::error_code removeErrorCode;
+      std::filesystem::remove(cacheEntryFile.Path, removeErrorCode);
+      totalCacheSize -= cacheEntryFile.Size;
+    }
+
+    this->estimatedCacheSize = totalCacheSize;
+  }
+
+  bool SgfcCachingDocumentReader::IsCacheEntryFile(const std::string& fileName) const
+  {
+    return SgfcUtility::StringEndsWith(fileName, "." + SgfcPrivateConstants::DocumentCacheFileSuffix);
+  }
+
+  bool SgfcCachingDocumentReader::IsTempFile(const std::string& fileName) const
+  {
+    return
+      SgfcUtility::StringStartsWith(fileName, SgfcPrivateConstants::TempFilePrefix + "_") &&
+      SgfcUtility::StringEndsWith(fileName, "." + SgfcPrivateConstants::TempFileSuffix);
+  }
+}
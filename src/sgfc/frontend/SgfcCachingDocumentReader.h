@@ -0,0 +1,110 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../../include/ISgfcCachingDocumentReader.h"
+
+// C++ Standard Library includes
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcDocumentReadResult;
+
+  /// @brief The SgfcCachingDocumentReader class provides an implementation
+  /// of the ISgfcCachingDocumentReader interface. See the interface header
+  /// file for documentation.
+  ///
+  /// @ingroup internals
+  /// @ingroup sgfc-frontend
+  /// @ingroup document
+  ///
+  /// SgfcCachingDocumentReader delegates the actual read operations to an
+  /// ISgfcDocumentReader object.
+  ///
+  /// A cache entry is a file in the cache directory whose name is derived
+  /// from the hash of the entry's key. The key is stored in the entry file
+  /// as well so that hash collisions are detected. The entry file layout is:
+  /// Magic (8 bytes), format version (4 bytes), flags (4 bytes), key
+  /// (string), number of messages (8 bytes), the messages, and finally the
+  /// length of the binary document (8 bytes) followed by the binary document.
+  class SgfcCachingDocumentReader : public ISgfcCachingDocumentReader
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcCachingDocumentReader
+    /// object that stores cache entries in the directory located at
+    /// @a cacheDirectoryPath.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a cacheDirectoryPath
+    /// refers to a filesystem object that is not a directory.
+    /// @exception std::runtime_error Is thrown if the directory does not
+    /// exist and cannot be created.
+    SgfcCachingDocumentReader(const std::string& cacheDirectoryPath);
+
+    /// @brief Destroys and cleans up the SgfcCachingDocumentReader object.
+    virtual ~SgfcCachingDocumentReader();
+
+    virtual std::shared_ptr<ISgfcArguments> GetArguments() const override;
+    virtual SgfcDocumentReadOptions GetReadOptions() const override;
+    virtual void SetReadOptions(const SgfcDocumentReadOptions& readOptions) override;
+    virtual std::shared_ptr<ISgfcDocumentReadResult> ReadSgfFile(const std::string& sgfFilePath) const override;
+    virtual std::shared_ptr<ISgfcDocumentReadResult> ReadSgfContent(const std::string& sgfContent) const override;
+
+    virtual std::string GetCacheDirectoryPath() const override;
+    virtual SgfcDocumentCacheKeyType GetCacheKeyType() const override;
+    virtual void SetCacheKeyType(SgfcDocumentCacheKeyType cacheKeyType) override;
+    virtual std::uint64_t GetMaximumCacheSize() const override;
+    virtual void SetMaximumCacheSize(std::uint64_t maximumCacheSize) override;
+    virtual void ClearCache() const override;
+
+  private:
+    std::shared_ptr<ISgfcDocumentReader> documentReader;
+    std::string cacheDirectoryPath;
+    SgfcDocumentCacheKeyType cacheKeyType;
+    std::uint64_t maximumCacheSize;
+
+    /// @brief The size of all cache entries when the cache directory was last
+    /// scanned, plus the sizes of the entries stored since then. This is an
+    /// estimate because other processes may store or remove entries, and
+    /// because a stored entry may replace an existing one.
+    mutable std::atomic<std::uint64_t> estimatedCacheSize;
+
+    /// @brief The number of entries stored since the cache directory was
+    /// last scanned.
+    mutable std::atomic<std::uint64_t> numberOfStoresSinceLastScan;
+
+    std::shared_ptr<ISgfcDocumentReadResult> ReadSgfFileWithFileContentKey(const std::string& sgfFilePath) const;
+    std::shared_ptr<ISgfcDocumentReadResult> ReadSgfFileWithFileMetadataKey(const std::string& sgfFilePath) const;
+
+    std::string GetKey(const std::string& dataIdentification) const;
+    std::string GetCacheEntryFilePath(const std::string& key) const;
+
+    std::shared_ptr<ISgfcDocumentReadResult> LoadCacheEntry(const std::string& key) const;
+    void StoreCacheEntry(const std::string& key, std::shared_ptr<ISgfcDocumentReadResult> readResult) const;
+    std::string WriteCacheEntryContent(const std::string& key, std::shared_ptr<ISgfcDocumentReadResult> readResult) const;
+    std::shared_ptr<ISgfcDocumentReadResult> ReadCacheEntryContent(const std::string& key, const std::string& cacheEntryContent) const;
+    void EvictCacheEntries() const;
+
+    bool IsCacheEntryFile(const std::string& fileName) const;
+    bool IsTempFile(const std::string& fileName) const;
+  };
+}
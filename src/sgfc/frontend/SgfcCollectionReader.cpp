@@ -0,0 +1,358 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../../include/ISgfcDocumentReader.h"
+#include "../../SgfcBinaryUtility.h"
+#include "../../SgfcPrivateConstants.h"
+#include "../../SgfcUtility.h"
+#include "SgfcCollectionReader.h"
+#include "SgfcDocumentCacheUtility.h"
+
+// C++ Standard Library includes
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcCollectionReader::SgfcCollectionReader(
+    const std::string& sgfFilePath,
+    const std::string& indexFilePath,
+    std::shared_ptr<ISgfcDocumentReader> documentReader)
+    : sgfFilePath(sgfFilePath)
+    , documentReader(documentReader)
+    , isIndexLoadedFromIndexFile(false)
+    , hasUtf8ByteOrderMark(false)
+  {
+    if (documentReader == nullptr)
+      throw std::invalid_argument("SgfcCollectionReader constructor failed: Document reader object is nullptr");
+
+    // The identification must be obtained before the .sgf file is scanned.
+    // If the file is modified while it is scanned, the index file then
+    // contains an outdated identification and is not used later on.
+    std::string fileMetadataIdentification;
+    bool isIndexFileUsed =
+      ! indexFilePath.empty() &&
+      SgfcDocumentCacheUtility::GetFileMetadataIdentification(sgfFilePath, fileMetadataIdentification);
+
+    if (isIndexFileUsed && LoadIndexFile(indexFilePath, fileMetadataIdentification))
+    {
+      this->isIndexLoadedFromIndexFile = true;
+      return;
+    }
+
+    std::ifstream in(std::filesystem::u8path(sgfFilePath), std::ios::binary);
+    if (! in.is_open())
+    {
+      std::stringstream message;
+      message << "Failed to open file for reading: " << sgfFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    BuildIndex(in);
+
+    if (isIndexFileUsed)
+      WriteIndexFile(indexFilePath, fileMetadataIdentification);
+  }
+
+  SgfcCollectionReader::~SgfcCollectionReader()
+  {
+  }
+
+  std::string SgfcCollectionReader::GetSgfFilePath() const
+  {
+    return this->sgfFilePath;
+  }
+
+  std::shared_ptr<ISgfcDocumentReader> SgfcCollectionReader::GetDocumentReader() const
+  {
+    return this->documentReader;
+  }
+
+  bool SgfcCollectionReader::IsIndexLoadedFromIndexFile() const
+  {
+    return this->isIndexLoadedFromIndexFile;
+  }
+
+  std::size_t SgfcCollectionReader::GetNumberOfGames() const
+  {
+    return this->gameTreeLocations.size();
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> SgfcCollectionReader::ReadGame(std::size_t gameIndex) const
+  {
+    return ReadGames(gameIndex, 1);
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> SgfcCollectionReader::ReadGames(
+    std::size_t firstGameIndex,
+    std::size_t numberOfGames) const
+  {
+    std::size_t numberOfGamesInCollection = this->gameTreeLocations.size();
+    if (numberOfGames == 0)
+      throw std::invalid_argument("ReadGames failed: Number of games is 0");
+    if (firstGameIndex >= numberOfGamesInCollection || numberOfGames > numberOfGamesInCollection - firstGameIndex)
+    {
+      std::stringstream message;
+      message << "ReadGames failed: Game index range exceeds number of games " << numberOfGamesInCollection;
+      throw std::invalid_argument(message.str());
+    }
+
+    const GameTreeLocation& firstGameTreeLocation = this->gameTreeLocations[firstGameIndex];
+    const GameTreeLocation& lastGameTreeLocation = this->gameTreeLocations[firstGameIndex + numberOfGames - 1];
+    std::uint64_t length = lastGameTreeLocation.Offset + lastGameTreeLocation.Length - firstGameTreeLocation.Offset;
+
+    std::ifstream in(std::filesystem::u8path(this->sgfFilePath), std::ios::binary);
+    if (! in.is_open())
+    {
+      std::stringstream message;
+      message << "Failed to open file for reading: " << this->sgfFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    // SGFC looks for the BOM only at the beginning of the SGF content
+    std::string sgfContent;
+    if (this->hasUtf8ByteOrderMark)
+      sgfContent = SgfcPrivateConstants::Utf8ByteOrderMark;
+    std::size_t indexOfFirstGameTreeByte = sgfContent.size();
+    sgfContent.resize(indexOfFirstGameTreeByte + static_cast<std::size_t>(length));
+
+    in.seekg(static_cast<std::streamoff>(firstGameTreeLocation.Offset));
+    in.read(&sgfContent[indexOfFirstGameTreeByte], static_cast<std::streamsize>(length));
+    if (in.gcount() != static_cast<std::streamsize>(length) || sgfContent[indexOfFirstGameTreeByte] != '(')
+    {
+      std::stringstream message;
+      message << "Failed to read game trees, file was modified after the index was obtained: " << this->sgfFilePath;
+      throw std::runtime_error(message.str());
+    }
+
+    return this->documentReader->ReadSgfContent(sgfContent);
+  }
+
+  void SgfcCollectionReader::BuildIndex(std::istream& in)
+  {
+    std::vector<char> buffer(SgfcPrivateConstants::CollectionIndexScanBufferSize);
+    std::uint64_t offsetOfBuffer = 0;
+
+    // The scan knows only enough about the SGF syntax to find the beginning
+    // and the end of each top-level game tree. Like SGFC it treats a "("
+    // as the beginning of a game tree only if it is followed by a ";",
+    // possibly with whitespace in between, so that text outside of game
+    // trees is skipped.
+    std::uint64_t offsetOfGameTree = 0;
+    std::size_t depth = 0;
+    bool isGameTreeStartPending = false;
+    bool isInsidePropertyValue = false;
+    bool isEscaped = false;
+
+    while (true)
+    {
+      in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+      std::size_t numberOfBytesRead = static_cast<std::size_t>(in.gcount());
+      if (numberOfBytesRead == 0)
+        break;
+
+      std::size_t indexOfFirstByte = 0;
+      std::size_t byteOrderMarkSize = SgfcPrivateConstants::Utf8ByteOrderMark.size();
+      if (offsetOfBuffer == 0 &&
+          numberOfBytesRead >= byteOrderMarkSize &&
+          std::string(buffer.data(), byteOrderMarkSize) == SgfcPrivateConstants::Utf8ByteOrderMark)
+      {
+        this->hasUtf8ByteOrderMark = true;
+        indexOfFirstByte = byteOrderMarkSize;
+      }
+
+      for (std::size_t indexOfByte = indexOfFirstByte; indexOfByte < numberOfBytesRead; indexOfByte++)
+      {
+        char character = buffer[indexOfByte];
+
+        if (depth == 0)
+        {
+          if (isGameTreeStartPending)
+          {
+            if (character == ';')
+            {
+              isGameTreeStartPending = false;
+              depth = 1;
+              continue;
+            }
+            else if (character == ' ' || character == '\t' || character == '\r' || character == '\n')
+            {
+              continue;
+            }
+
+            isGameTreeStartPending = false;
+          }
+
+          if (character == '(')
+          {
+            isGameTreeStartPending = true;
+            offsetOfGameTree = offsetOfBuffer + indexOfByte;
+          }
+        }
+        else if (isInsidePropertyValue)
+        {
+          if (isEscaped)
+            isEscaped = false;
+          else if (character == '\\')
+            isEscaped = true;
+          else if (character == ']')
+            isInsidePropertyValue = false;
+        }
+        else if (character == '[')
+        {
+          isInsidePropertyValue = true;
+        }
+        else if (character == '(')
+        {
+          depth++;
+        }
+        else if (character == ')')
+        {
+          depth--;
+          if (depth == 0)
+          {
+            std::uint64_t offsetOfGameTreeEnd = offsetOfBuffer + indexOfByte + 1;
+            this->gameTreeLocations.push_back( { offsetOfGameTree, offsetOfGameTreeEnd - offsetOfGameTree } );
+          }
+        }
+      }
+
+      offsetOfBuffer += numberOfBytesRead;
+    }
+
+    // SGFC tolerates missing closing parentheses at the end of the file
+    if (depth > 0)
+      this->gameTreeLocations.push_back( { offsetOfGameTree, offsetOfBuffer - offsetOfGameTree } );
+  }
+
+  bool SgfcCollectionReader::LoadIndexFile(const std::string& indexFilePath, const std::string& fileMetadataIdentification)
+  {
+    std::filesystem::path indexFile = std::filesystem::u8path(indexFilePath);
+
+    std::error_code errorCode;
+    std::uintmax_t indexFileSize = std::filesystem::file_size(indexFile, errorCode);
+    if (errorCode)
+      return false;
+
+    std::ifstream in(indexFile, std::ios::binary);
+    if (! in.is_open())
+      return false;
+
+    try
+    {
+      std::string magic = SgfcBinaryUtility::ReadCharacters(in, SgfcPrivateConstants::CollectionIndexMagic.size());
+      if (magic != SgfcPrivateConstants::CollectionIndexMagic)
+        return false;
+
+      std::uint32_t formatVersion = SgfcBinaryUtility::ReadUInt32(in);
+      if (formatVersion != SgfcPrivateConstants::CollectionIndexFormatVersion)
+        return false;
+
+      std::uint32_t flags = SgfcBinaryUtility::ReadUInt32(in);
+
+      std::string storedFileMetadataIdentification = SgfcBinaryUtility::ReadString(in);
+      if (storedFileMetadataIdentification != fileMetadataIdentification)
+        return false;
+
+      // Checking this before the locations are read prevents a corrupt
+      // number of game trees from causing a huge allocation
+      const std::uint64_t gameTreeLocationSize = 16;
+      std::uint64_t numberOfGameTrees = SgfcBinaryUtility::ReadUInt64(in);
+      std::uint64_t numberOfRemainingBytes = indexFileSize - static_cast<std::uint64_t>(in.tellg());
+      if (numberOfGameTrees != numberOfRemainingBytes / gameTreeLocationSize)
+        return false;
+
+      std::vector<std::uint64_t> values = SgfcBinaryUtility::ReadUInt64Vector(
+        in,
+        static_cast<std::size_t>(numberOfGameTrees * 2));
+
+      std::vector<GameTreeLocation> gameTreeLocations;
+      std::uint64_t offsetOfPreviousGameTreeEnd = 0;
+      for (std::size_t indexOfValue = 0; indexOfValue < values.size(); indexOfValue += 2)
+      {
+        GameTreeLocation gameTreeLocation = { values[indexOfValue], values[indexOfValue + 1] };
+        if (gameTreeLocation.Offset < offsetOfPreviousGameTreeEnd || gameTreeLocation.Length == 0)
+          return false;
+
+        offsetOfPreviousGameTreeEnd = gameTreeLocation.Offset + gameTreeLocation.Length;
+        gameTreeLocations.push_back(gameTreeLocation);
+      }
+
+      this->hasUtf8ByteOrderMark = ((flags & SgfcPrivateConstants::CollectionIndexFlagUtf8ByteOrderMark) != 0);
+      this->gameTreeLocations = std::move(gameTreeLocations);
+    }
+    catch (std::runtime_error&)
+    {
+      // The index file is corrupt
+      return false;
+    }
+
+    return true;
+  }
+
+  void SgfcCollectionReader::WriteIndexFile(const std::string& indexFilePath, const std::string& fileMetadataIdentification) const
+  {
+    std::stringstream out;
+
+    std::uint32_t flags = 0;
+    if (this->hasUtf8ByteOrderMark)
+      flags |= SgfcPrivateConstants::CollectionIndexFlagUtf8ByteOrderMark;
+
+    SgfcBinaryUtility::WriteCharacters(out, SgfcPrivateConstants::CollectionIndexMagic);
+    SgfcBinaryUtility::WriteUInt32(out, SgfcPrivateConstants::CollectionIndexFormatVersion);
+    SgfcBinaryUtility::WriteUInt32(out, flags);
+    SgfcBinaryUtility::WriteString(out, fileMetadataIdentification);
+    SgfcBinaryUtility::WriteUInt64(out, this->gameTreeLocations.size());
+    for (const auto& gameTreeLocation : this->gameTreeLocations)
+    {
+      SgfcBinaryUtility::WriteUInt64(out, gameTreeLocation.Offset);
+      SgfcBinaryUtility::WriteUInt64(out, gameTreeLocation.Length);
+    }
+
+    std::string indexFileContent = out.str();
+
+    // Write to a temporary file first, then rename the file, so that other
+    // collection readers never see a partially written index file. Failure
+    // to write the index file is not an error, the index is simply built
+    // again the next time.
+    std::filesystem::path indexFile = std::filesystem::u8path(indexFilePath);
+    std::filesystem::path tempFile = indexFile.parent_path() / std::filesystem::u8path(SgfcUtility::GetUniqueTempFileName());
+
+    std::ofstream tempFileStream(tempFile, std::ios::binary | std::ios::trunc);
+    if (! tempFileStream.is_open())
+      return;
+
+    tempFileStream.write(indexFileContent.data(), static_cast<std::streamsize>(indexFileContent.size()));
+    tempFileStream.close();
+
+    std::error_code errorCode;
+    if (tempFileStream.fail())
+    {
+      std::filesystem::remove(tempFile, errorCode);
+      return;
+    }
+
+    std::filesystem::rename(tempFile, indexFile, errorCode);
+    if (errorCode)
+    {
+      std::error_code removeErrorCode;
+      std::filesystem::remove(tempFile, removeErrorCode);
+    }
+  }
+}
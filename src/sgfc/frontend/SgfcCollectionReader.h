@@ -0,0 +1,91 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../../include/ISgfcCollectionReader.h"
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcCollectionReader class provides an implementation of
+  /// the ISgfcCollectionReader interface. See the interface header file for
+  /// documentation.
+  ///
+  /// @ingroup internals
+  /// @ingroup sgfc-frontend
+  ///
+  /// The index file layout is: Magic (8 bytes), format version (4 bytes),
+  /// flags (4 bytes), the file metadata identification of the .sgf file
+  /// (string), number of game trees (8 bytes), and finally the offset
+  /// (8 bytes) and the length (8 bytes) of each game tree.
+  class SgfcCollectionReader : public ISgfcCollectionReader
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcCollectionReader object
+    /// that reads from the .sgf file located at @a sgfFilePath and uses
+    /// @a documentReader to read game trees. If @a indexFilePath is not an
+    /// empty string the index is loaded from the index file located at
+    /// @a indexFilePath, or if that is not possible the index is built and
+    /// then written to the index file.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a documentReader is
+    /// @e nullptr.
+    /// @exception std::runtime_error Is thrown if the .sgf file cannot be
+    /// opened for reading.
+    SgfcCollectionReader(
+      const std::string& sgfFilePath,
+      const std::string& indexFilePath,
+      std::shared_ptr<ISgfcDocumentReader> documentReader);
+
+    /// @brief Destroys and cleans up the SgfcCollectionReader object.
+    virtual ~SgfcCollectionReader();
+
+    virtual std::string GetSgfFilePath() const override;
+    virtual std::shared_ptr<ISgfcDocumentReader> GetDocumentReader() const override;
+    virtual bool IsIndexLoadedFromIndexFile() const override;
+    virtual std::size_t GetNumberOfGames() const override;
+    virtual std::shared_ptr<ISgfcDocumentReadResult> ReadGame(std::size_t gameIndex) const override;
+    virtual std::shared_ptr<ISgfcDocumentReadResult> ReadGames(
+      std::size_t firstGameIndex,
+      std::size_t numberOfGames) const override;
+
+  private:
+    /// @brief The location of a top-level game tree in the .sgf file.
+    struct GameTreeLocation
+    {
+      std::uint64_t Offset;
+      std::uint64_t Length;
+    };
+
+    std::string sgfFilePath;
+    std::shared_ptr<ISgfcDocumentReader> documentReader;
+    bool isIndexLoadedFromIndexFile;
+    bool hasUtf8ByteOrderMark;
+    std::vector<GameTreeLocation> gameTreeLocations;
+
+    void BuildIndex(std::istream& in);
+    bool LoadIndexFile(const std::string& indexFilePath, const std::string& fileMetadataIdentification);
+    void WriteIndexFile(const std::string& indexFilePath, const std::string& fileMetadataIdentification) const;
+  };
+}
@@ -0,0 +1,396 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../../include/ISgfcArgument.h"
+#include "../../../include/ISgfcArguments.h"
+#include "../../../include/ISgfcComposedPropertyValue.h"
+#include "../../../include/ISgfcDocument.h"
+#include "../../../include/ISgfcDocumentReadResult.h"
+#include "../../../include/ISgfcGame.h"
+#include "../../../include/ISgfcGoMovePropertyValue.h"
+#include "../../../include/ISgfcGoPointPropertyValue.h"
+#include "../../../include/ISgfcGoStonePropertyValue.h"
+#include "../../../include/ISgfcMessage.h"
+#include "../../../include/ISgfcMovePropertyValue.h"
+#include "../../../include/ISgfcNode.h"
+#include "../../../include/ISgfcPointPropertyValue.h"
+#include "../../../include/ISgfcProperty.h"
+#include "../../../include/ISgfcSinglePropertyValue.h"
+#include "../../../include/ISgfcStonePropertyValue.h"
+#include "../../document/SgfcComposedPropertyValue.h"
+#include "../../document/SgfcDocument.h"
+#include "../../document/SgfcGame.h"
+#include "../../document/SgfcNode.h"
+#include "../../document/SgfcNodeIterator.h"
+#include "../../document/SgfcProperty.h"
+#include "../../document/SgfcSinglePropertyValue.h"
+#include "../../document/SgfcTreeBuilder.h"
+#include "../../document/typedproperty/SgfcBoardSizeProperty.h"
+#include "../../document/typedproperty/SgfcGameTypeProperty.h"
+#include "../../document/typedpropertyvalue/go/SgfcGoMovePropertyValue.h"
+#include "../../document/typedpropertyvalue/go/SgfcGoPointPropertyValue.h"
+#include "../../document/typedpropertyvalue/go/SgfcGoStonePropertyValue.h"
+#include "../../document/typedpropertyvalue/SgfcColorPropertyValue.h"
+#include "../../document/typedpropertyvalue/SgfcDoublePropertyValue.h"
+#include "../../document/typedpropertyvalue/SgfcMovePropertyValue.h"
+#include "../../document/typedpropertyvalue/SgfcNumberPropertyValue.h"
+#include "../../document/typedpropertyvalue/SgfcPointPropertyValue.h"
+#include "../../document/typedpropertyvalue/SgfcRealPropertyValue.h"
+#include "../../document/typedpropertyvalue/SgfcSimpleTextPropertyValue.h"
+#include "../../document/typedpropertyvalue/SgfcStonePropertyValue.h"
+#include "../../document/typedpropertyvalue/SgfcTextPropertyValue.h"
+#include "../../game/go/SgfcGoMove.h"
+#include "../../game/go/SgfcGoPoint.h"
+#include "../../game/go/SgfcGoStone.h"
+#include "../../SgfcUtility.h"
+#include "../backend/SgfcCompressionUtility.h"
+#include "../message/SgfcMessage.h"
+#include "SgfcDocumentCacheUtility.h"
+#include "SgfcDocumentReadResult.h"
+
+// C++ Standard Library includes
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace LibSgfcPlusPlus
+{
+  std::string SgfcDocumentCacheUtility::GetArgumentsIdentification(std::shared_ptr<ISgfcArguments> arguments)
+  {
+    std::stringstream argumentsIdentification;
+
+    for (auto argument : arguments->GetArguments())
+      argumentsIdentification << argument->ToString() << "\n";
+
+    return argumentsIdentification.str();
+  }
+
+  std::string SgfcDocumentCacheUtility::GetReadOptionsIdentification(const SgfcDocumentReadOptions& readOptions)
+  {
+    // The number of threads is not part of the identification because it
+    // does not change the content of the document
+    std::stringstream readOptionsIdentification;
+    readOptionsIdentification
+      << "readoptions "
+      << (readOptions.IsMainVariationOnly ? 1 : 0)
+      << " "
+      << readOptions.MaximumDepth
+      << " "
+      << readOptions.MaximumNumberOfNodes
+      << " "
+      << static_cast<int>(readOptions.PropertyFilterMode);
+
+    for (auto propertyType : readOptions.PropertyFilterTypes)
+      readOptionsIdentification << " t" << static_cast<int>(propertyType);
+
+    // The length prefix prevents a name that contains spaces from being
+    // confused with several names
+    for (const auto& propertyName : readOptions.PropertyFilterNames)
+      readOptionsIdentification << " n" << propertyName.size() << ":" << propertyName;
+
+    readOptionsIdentification << "\n";
+
+    return readOptionsIdentification.str();
+  }
+
+  std::string SgfcDocumentCacheUtility::GetContentIdentification(const std::string& sgfContent)
+  {
+    std::stringstream contentIdentification;
+    contentIdentification
+      << "content "
+      << sgfContent.size()
+      << " "
+      << std::hex << std::setw(16) << std::setfill('0') << SgfcUtility::GetHash(sgfContent);
+
+    return contentIdentification.str();
+  }
+
+  bool SgfcDocumentCacheUtility::GetFileMetadataIdentification(const std::string& sgfFilePath, std::string& fileMetadataIdentification)
+  {
+    std::filesystem::path sgfFile = std::filesystem::u8path(sgfFilePath);
+
+    std::error_code errorCode;
+    std::filesystem::path absoluteSgfFile = std::filesystem::absolute(sgfFile, errorCode);
+    if (errorCode)
+      return false;
+
+    std::uintmax_t fileSize = std::filesystem::file_size(absoluteSgfFile, errorCode);
+    if (errorCode)
+      return false;
+
+    std::filesystem::file_time_type lastWriteTime = std::filesystem::last_write_time(absoluteSgfFile, errorCode);
+    if (errorCode)
+      return false;
+
+    std::stringstream identification;
+    identification
+      << "file "
+      << absoluteSgfFile.u8string()
+      << "\n"
+      << fileSize
+      << " "
+      << lastWriteTime.time_since_epoch().count();
+
+    fileMetadataIdentification = identification.str();
+    return true;
+  }
+
+  bool SgfcDocumentCacheUtility::ReadFileContent(const std::string& sgfFilePath, std::string& sgfContent)
+  {
+    // Detect compression the same way as the regular reader, i.e. by
+    // examining the magic number and not the file name extension
+    SgfcCompressionFormat compressionFormat = SgfcCompressionUtility::GetCompressionFormatOfFile(sgfFilePath);
+    if (compressionFormat != SgfcCompressionFormat::None)
+    {
+      char* sgfContentBuffer = nullptr;
+      std::size_t sgfContentSize = 0;
+      try
+      {
+        sgfContentBuffer = SgfcCompressionUtility::DecompressFile(sgfFilePath, compressionFormat, sgfContentSize);
+      }
+      catch (std::exception&)
+      {
+        return false;
+      }
+
+      sgfContent.assign(sgfContentBuffer, sgfContentSize);
+      free(sgfContentBuffer);
+
+      return true;
+    }
+
+    std::ifstream in(std::filesystem::u8path(sgfFilePath), std::ios::binary);
+    if (! in.is_open())
+      return false;
+
+    std::stringstream sgfContentStream;
+    sgfContentStream << in.rdbuf();
+    sgfContent = sgfContentStream.str();
+
+    return true;
+  }
+
+  std::uint64_t SgfcDocumentCacheUtility::GetMemoryUsage(std::shared_ptr<ISgfcDocumentReadResult> readResult)
+  {
+    std::uint64_t memoryUsage = GetHeapObjectMemoryUsage(sizeof(SgfcDocumentReadResult));
+
+    auto parseResult = readResult->GetParseResult();
+    memoryUsage += parseResult.size() * sizeof(std::shared_ptr<ISgfcMessage>);
+    for (auto message : parseResult)
+      memoryUsage += GetMemoryUsage(message);
+
+    memoryUsage += GetMemoryUsage(readResult->GetDocument());
+
+    return memoryUsage;
+  }
+
+  std::uint64_t SgfcDocumentCacheUtility::GetMemoryUsage(std::shared_ptr<ISgfcDocument> document)
+  {
+    std::uint64_t memoryUsage = GetHeapObjectMemoryUsage(sizeof(SgfcDocument));
+
+    auto games = document->GetGames();
+    memoryUsage += games.size() * sizeof(std::shared_ptr<ISgfcGame>);
+
+    SgfcNodeIterator nodeIterator;
+    NodeVisitCallback nodeVisitCallback = [&](std::shared_ptr<ISgfcNode> node) -> SgfcNodeIterationContinuation
+    {
+      memoryUsage += GetMemoryUsage(node);
+      return SgfcNodeIterationContinuation::VerticalAndLateral;
+    };
+
+    for (auto game : games)
+    {
+      memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcGame));
+      memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcTreeBuilder));
+
+      nodeIterator.IterateOverNodesDepthFirst(game->GetRootNode(), nodeVisitCallback);
+    }
+
+    return memoryUsage;
+  }
+
+  std::uint64_t SgfcDocumentCacheUtility::GetMemoryUsage(std::shared_ptr<ISgfcNode> node)
+  {
+    std::uint64_t memoryUsage = GetHeapObjectMemoryUsage(sizeof(SgfcNode));
+
+    auto properties = node->GetProperties();
+    memoryUsage += properties.size() * sizeof(std::shared_ptr<ISgfcProperty>);
+    for (auto property : properties)
+      memoryUsage += GetMemoryUsage(property);
+
+    return memoryUsage;
+  }
+
+  std::uint64_t SgfcDocumentCacheUtility::GetMemoryUsage(std::shared_ptr<ISgfcProperty> property)
+  {
+    std::uint64_t memoryUsage;
+    if (property->ToGameTypeProperty() != nullptr)
+      memoryUsage = GetHeapObjectMemoryUsage(sizeof(SgfcGameTypeProperty));
+    else if (property->ToBoardSizeProperty() != nullptr)
+      memoryUsage = GetHeapObjectMemoryUsage(sizeof(SgfcBoardSizeProperty));
+    else
+      memoryUsage = GetHeapObjectMemoryUsage(sizeof(SgfcProperty));
+
+    memoryUsage += GetStringMemoryUsage(property->GetPropertyName());
+
+    auto propertyValues = property->GetPropertyValues();
+    memoryUsage += propertyValues.size() * sizeof(std::shared_ptr<ISgfcPropertyValue>);
+    for (auto propertyValue : propertyValues)
+      memoryUsage += GetMemoryUsage(propertyValue);
+
+    return memoryUsage;
+  }
+
+  std::uint64_t SgfcDocumentCacheUtility::GetMemoryUsage(std::shared_ptr<ISgfcPropertyValue> propertyValue)
+  {
+    if (propertyValue->IsComposedValue())
+    {
+      const ISgfcComposedPropertyValue* composedValue = propertyValue->ToComposedValue();
+
+      return
+        GetHeapObjectMemoryUsage(sizeof(SgfcComposedPropertyValue)) +
+        GetMemoryUsage(*composedValue->GetValue1()) +
+        GetMemoryUsage(*composedValue->GetValue2());
+    }
+    else
+    {
+      return GetMemoryUsage(*propertyValue->ToSingleValue());
+    }
+  }
+
+  std::uint64_t SgfcDocumentCacheUtility::GetMemoryUsage(const ISgfcSinglePropertyValue& singlePropertyValue)
+  {
+    std::string rawValue = singlePropertyValue.GetRawValue();
+
+    // Values whose typed value is a string hold a copy of the raw value in
+    // addition to the raw value itself. The copy is counted below.
+    std::uint64_t memoryUsage = GetStringMemoryUsage(rawValue);
+    memoryUsage += GetStringMemoryUsage(singlePropertyValue.GetTypeConversionErrorMessage());
+
+    if (singlePropertyValue.ToNumberValue() != nullptr)
+    {
+      memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcNumberPropertyValue));
+    }
+    else if (singlePropertyValue.ToRealValue() != nullptr)
+    {
+      memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcRealPropertyValue));
+    }
+    else if (singlePropertyValue.ToDoubleValue() != nullptr)
+    {
+      memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcDoublePropertyValue));
+    }
+    else if (singlePropertyValue.ToColorValue() != nullptr)
+    {
+      memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcColorPropertyValue));
+    }
+    else if (singlePropertyValue.ToSimpleTextValue() != nullptr)
+    {
+      memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcSimpleTextPropertyValue));
+      memoryUsage += GetStringMemoryUsage(rawValue);
+    }
+    else if (singlePropertyValue.ToTextValue() != nullptr)
+    {
+      memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcTextPropertyValue));
+      memoryUsage += GetStringMemoryUsage(rawValue);
+    }
+    else if (singlePropertyValue.ToPointValue() != nullptr)
+    {
+      if (singlePropertyValue.ToPointValue()->ToGoPointValue() != nullptr)
+      {
+        memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcGoPointPropertyValue));
+        memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcGoPoint));
+      }
+      else
+      {
+        memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcPointPropertyValue));
+      }
+      memoryUsage += GetStringMemoryUsage(rawValue);
+    }
+    else if (singlePropertyValue.ToMoveValue() != nullptr)
+    {
+      if (singlePropertyValue.ToMoveValue()->ToGoMoveValue() != nullptr)
+      {
+        // A pass move has no stone and no point. The estimate is slightly too
+        // high for pass moves, but the difference does not matter.
+        memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcGoMovePropertyValue));
+        memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcGoMove));
+        memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcGoStone));
+        memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcGoPoint));
+      }
+      else
+      {
+        memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcMovePropertyValue));
+      }
+      memoryUsage += GetStringMemoryUsage(rawValue);
+    }
+    else if (singlePropertyValue.ToStoneValue() != nullptr)
+    {
+      if (singlePropertyValue.ToStoneValue()->ToGoStoneValue() != nullptr)
+      {
+        memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcGoStonePropertyValue));
+        memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcGoStone));
+        memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcGoPoint));
+      }
+      else
+      {
+        memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcStonePropertyValue));
+      }
+      memoryUsage += GetStringMemoryUsage(rawValue);
+    }
+    else
+    {
+      memoryUsage += GetHeapObjectMemoryUsage(sizeof(SgfcSinglePropertyValue));
+    }
+
+    return memoryUsage;
+  }
+
+  std::uint64_t SgfcDocumentCacheUtility::GetMemoryUsage(std::shared_ptr<ISgfcMessage> message)
+  {
+    return
+      GetHeapObjectMemoryUsage(sizeof(SgfcMessage)) +
+      GetStringMemoryUsage(message->GetMessageText()) +
+      GetStringMemoryUsage(message->GetFormattedMessageText());
+  }
+
+  std::uint64_t SgfcDocumentCacheUtility::GetHeapObjectMemoryUsage(std::size_t objectSize)
+  {
+    // Objects are allocated with operator new and then handed over to a
+    // std::shared_ptr, which allocates a separate control block (vtable
+    // pointer plus two reference counts). The heap allocator typically adds
+    // a header of two pointers to each allocation.
+    const std::uint64_t allocationOverhead = 2 * sizeof(void*);
+    const std::uint64_t controlBlockSize = sizeof(void*) + 2 * sizeof(long);
+
+    return objectSize + allocationOverhead + controlBlockSize + allocationOverhead;
+  }
+
+  std::uint64_t SgfcDocumentCacheUtility::GetStringMemoryUsage(const std::string& string)
+  {
+    // All major standard library implementations store strings of up to 15
+    // characters inside the std::string object itself
+    const std::string::size_type maximumInlineStringLength = 15;
+    if (string.size() <= maximumInlineStringLength)
+      return 0;
+
+    const std::uint64_t allocationOverhead = 2 * sizeof(void*);
+    return string.size() + 1 + allocationOverhead;
+  }
+}
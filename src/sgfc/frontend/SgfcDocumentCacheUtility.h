@@ -0,0 +1,108 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../../include/SgfcDocumentReadOptions.h"
+
+// C++ Standard Library includes
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcArguments;
+  class ISgfcDocument;
+  class ISgfcDocumentReadResult;
+  class ISgfcMessage;
+  class ISgfcNode;
+  class ISgfcProperty;
+  class ISgfcPropertyValue;
+  class ISgfcSinglePropertyValue;
+
+  /// @brief The SgfcDocumentCacheUtility class is a container for static
+  /// helper functions shared by the document reader classes that cache read
+  /// results.
+  ///
+  /// @ingroup internals
+  /// @ingroup sgfc-frontend
+  class SgfcDocumentCacheUtility
+  {
+  public:
+    SgfcDocumentCacheUtility() = delete;
+    ~SgfcDocumentCacheUtility() = delete;
+
+    /// @brief Returns a string that identifies the arguments in
+    /// @a arguments. Two argument collections have the same identification
+    /// if they contain the same arguments in the same order.
+    static std::string GetArgumentsIdentification(std::shared_ptr<ISgfcArguments> arguments);
+
+    /// @brief Returns a string that identifies the read options in
+    /// @a readOptions. Two sets of read options have the same
+    /// identification if all of their values that affect the content of a
+    /// document are equal.
+    static std::string GetReadOptionsIdentification(const SgfcDocumentReadOptions& readOptions);
+
+    /// @brief Returns a string that identifies @a sgfContent. The string
+    /// consists of the size and a hash of the content.
+    static std::string GetContentIdentification(const std::string& sgfContent);
+
+    /// @brief Stores a string that identifies the file located at
+    /// @a sgfFilePath in @a fileMetadataIdentification. The string consists
+    /// of the absolute path, the size and the last modification time of the
+    /// file.
+    ///
+    /// @retval true if the identification could be determined.
+    /// @retval false if the file metadata could not be queried, e.g. because
+    ///         the file does not exist. @a fileMetadataIdentification remains
+    ///         unchanged in that case.
+    static bool GetFileMetadataIdentification(const std::string& sgfFilePath, std::string& fileMetadataIdentification);
+
+    /// @brief Reads the content of the file located at @a sgfFilePath into
+    /// @a sgfContent without any newline conversion. If the file is
+    /// compressed (see SgfcCompressionUtility::GetCompressionFormatOfFile())
+    /// the uncompressed content is stored in @a sgfContent, so that the
+    /// content can be parsed with ISgfcDocumentReader::ReadSgfContent().
+    ///
+    /// @retval true if the file could be read.
+    /// @retval false if the file could not be opened, or if the file is
+    ///         compressed and could not be decompressed.
+    static bool ReadFileContent(const std::string& sgfFilePath, std::string& sgfContent);
+
+    /// @brief Returns an estimate of the number of bytes of memory that
+    /// @a readResult occupies, including the document and the messages.
+    ///
+    /// The estimate is based on the sizes of the classes that implement the
+    /// document object tree and on the lengths of the strings that the
+    /// objects hold. Memory that the document allocates lazily after the
+    /// estimate was made (e.g. the game property index) is not included.
+    static std::uint64_t GetMemoryUsage(std::shared_ptr<ISgfcDocumentReadResult> readResult);
+
+  private:
+    static std::uint64_t GetMemoryUsage(std::shared_ptr<ISgfcDocument> document);
+    static std::uint64_t GetMemoryUsage(std::shared_ptr<ISgfcNode> node);
+    static std::uint64_t GetMemoryUsage(std::shared_ptr<ISgfcProperty> property);
+    static std::uint64_t GetMemoryUsage(std::shared_ptr<ISgfcPropertyValue> propertyValue);
+    static std::uint64_t GetMemoryUsage(const ISgfcSinglePropertyValue& singlePropertyValue);
+    static std::uint64_t GetMemoryUsage(std::shared_ptr<ISgfcMessage> message);
+    static std::uint64_t GetHeapObjectMemoryUsage(std::size_t objectSize);
+    static std::uint64_t GetStringMemoryUsage(const std::string& string);
+  };
+}
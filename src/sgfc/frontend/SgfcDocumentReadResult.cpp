@@ -28,6 +28,7 @@ namespace LibSgfcPlusPlus
     std::shared_ptr<ISgfcMessage> invalidCommandLineReason)
     : parseResult( { invalidCommandLineReason } )
     , document(new SgfcDocument())
+    , isDocumentTruncated(false)
   {
     this->exitCode = SgfcUtility::GetSgfcExitCodeFromMessageCollection(this->parseResult);
     this->isSgfDataValid = SgfcUtility::GetIsSgfDataValidFromMessageCollection(this->parseResult);
@@ -36,8 +37,17 @@ namespace LibSgfcPlusPlus
   SgfcDocumentReadResult::SgfcDocumentReadResult(
     std::vector<std::shared_ptr<ISgfcMessage>> parseResult,
     std::shared_ptr<ISgfcDocument> document)
+    : SgfcDocumentReadResult(parseResult, document, false)
+  {
+  }
+
+  SgfcDocumentReadResult::SgfcDocumentReadResult(
+    std::vector<std::shared_ptr<ISgfcMessage>> parseResult,
+    std::shared_ptr<ISgfcDocument> document,
+    bool isDocumentTruncated)
     : parseResult(parseResult)
     , document(document)
+    , isDocumentTruncated(isDocumentTruncated)
   {
     this->exitCode = SgfcUtility::GetSgfcExitCodeFromMessageCollection(this->parseResult);
     this->isSgfDataValid = SgfcUtility::GetIsSgfDataValidFromMessageCollection(this->parseResult);
@@ -67,10 +77,16 @@ namespace LibSgfcPlusPlus
     return this->document;
   }
 
+  bool SgfcDocumentReadResult::IsDocumentTruncated() const
+  {
+    return this->isDocumentTruncated;
+  }
+
   void SgfcDocumentReadResult::DebugPrintToConsole() const
   {
     std::cout << "Exit code = " << static_cast<int>(GetExitCode()) << std::endl;
     std::cout << "IsSgfDataValid = " << IsSgfDataValid() << std::endl;
+    std::cout << "IsDocumentTruncated = " << IsDocumentTruncated() << std::endl;
 
     for (auto parseResultMessage : GetParseResult())
     {
@@ -51,6 +51,16 @@ namespace LibSgfcPlusPlus
       std::vector<std::shared_ptr<ISgfcMessage>> parseResult,
       std::shared_ptr<ISgfcDocument> document);
 
+    /// @brief Initializes a newly constructed SgfcDocumentReadResult object
+    /// that encapsulates a read operation result consisting of the collection
+    /// of messages @a parseResult and the document @a document.
+    /// @a isDocumentTruncated indicates whether the read options prevented
+    /// some nodes from being built into @a document.
+    SgfcDocumentReadResult(
+      std::vector<std::shared_ptr<ISgfcMessage>> parseResult,
+      std::shared_ptr<ISgfcDocument> document,
+      bool isDocumentTruncated);
+
     /// @brief Destroys and cleans up the SgfcDocumentReadResult object.
     virtual ~SgfcDocumentReadResult();
 
@@ -58,6 +68,7 @@ namespace LibSgfcPlusPlus
     virtual bool IsSgfDataValid() const override;
     virtual std::vector<std::shared_ptr<ISgfcMessage>> GetParseResult() const override;
     virtual std::shared_ptr<ISgfcDocument> GetDocument() const override;
+    virtual bool IsDocumentTruncated() const override;
     virtual void DebugPrintToConsole() const override;
 
   private:
@@ -65,5 +76,6 @@ namespace LibSgfcPlusPlus
     bool isSgfDataValid;
     std::vector<std::shared_ptr<ISgfcMessage>> parseResult;
     std::shared_ptr<ISgfcDocument> document;
+    bool isDocumentTruncated;
   };
 }
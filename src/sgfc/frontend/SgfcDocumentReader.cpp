@@ -51,6 +51,16 @@ namespace LibSgfcPlusPlus
     return this->arguments;
   }
 
+  SgfcDocumentReadOptions SgfcDocumentReader::GetReadOptions() const
+  {
+    return this->readOptions;
+  }
+
+  void SgfcDocumentReader::SetReadOptions(const SgfcDocumentReadOptions& readOptions)
+  {
+    this->readOptions = readOptions;
+  }
+
   std::shared_ptr<ISgfcDocumentReadResult> SgfcDocumentReader::ReadSgfFile(const std::string& sgfFilePath) const
   {
     std::string sgfContent;
@@ -83,6 +93,7 @@ namespace LibSgfcPlusPlus
       auto parseResult = backendLoadResult->GetParseResult();
 
       std::shared_ptr<ISgfcDocument> document;
+      bool isDocumentTruncated = false;
       if (sgfcExitCode == SgfcExitCode::FatalError)
       {
         document = std::shared_ptr<ISgfcDocument>(new SgfcDocument());
@@ -91,7 +102,11 @@ namespace LibSgfcPlusPlus
       {
         try
         {
-          document = std::shared_ptr<ISgfcDocument>(new SgfcDocument(backendLoadResult->GetSgfDataWrapper()->GetSgfData()));
+          auto sgfcDocument = std::shared_ptr<SgfcDocument>(new SgfcDocument(
+            backendLoadResult->GetSgfDataWrapper()->GetSgfData(),
+            this->readOptions));
+          isDocumentTruncated = sgfcDocument->IsTruncated();
+          document = sgfcDocument;
         }
         catch (std::invalid_argument& exception)
         {
@@ -113,7 +128,8 @@ namespace LibSgfcPlusPlus
 
       std::shared_ptr<ISgfcDocumentReadResult> result = std::shared_ptr<ISgfcDocumentReadResult>(new SgfcDocumentReadResult(
         parseResult,
-        document));
+        document,
+        isDocumentTruncated));
       return result;
     }
     else
@@ -39,11 +39,14 @@ namespace LibSgfcPlusPlus
     virtual ~SgfcDocumentReader();
 
     virtual std::shared_ptr<ISgfcArguments> GetArguments() const override;
+    virtual SgfcDocumentReadOptions GetReadOptions() const override;
+    virtual void SetReadOptions(const SgfcDocumentReadOptions& readOptions) override;
     virtual std::shared_ptr<ISgfcDocumentReadResult> ReadSgfFile(const std::string& sgfFilePath) const override;
     virtual std::shared_ptr<ISgfcDocumentReadResult> ReadSgfContent(const std::string& sgfContent) const override;
 
   private:
     std::shared_ptr<ISgfcArguments> arguments;
+    SgfcDocumentReadOptions readOptions;
 
     std::shared_ptr<ISgfcDocumentReadResult> ReadSgfContentFromFilesystemOrInMemoryBuffer(
       const std::string& sgfFilePath,
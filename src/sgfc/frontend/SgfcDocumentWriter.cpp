@@ -17,6 +17,7 @@
 // Project includes
 #include "../../document/SgfcDocument.h"
 #include "../../parsing/SgfcDocumentEncoder.h"
+#include "../../parsing/SgfcDocumentEncoderCache.h"
 #include "../../SgfcPrivateConstants.h"
 #include "../argument/SgfcArguments.h"
 #include "../backend/SgfcBackendController.h"
@@ -30,6 +31,8 @@ namespace LibSgfcPlusPlus
 {
   SgfcDocumentWriter::SgfcDocumentWriter()
     : arguments(new SgfcArguments())
+    , numberOfThreads(1)
+    , encoderCache(nullptr)
   {
     this->arguments->AddArgument(SgfcArgumentType::DefaultEncoding, SgfcPrivateConstants::TextEncodingNameUTF8);
   }
@@ -43,6 +46,32 @@ namespace LibSgfcPlusPlus
     return this->arguments;
   }
 
+  unsigned int SgfcDocumentWriter::GetNumberOfThreads() const
+  {
+    return this->numberOfThreads;
+  }
+
+  void SgfcDocumentWriter::SetNumberOfThreads(unsigned int numberOfThreads)
+  {
+    this->numberOfThreads = numberOfThreads;
+  }
+
+  bool SgfcDocumentWriter::GetUseIncrementalEncoding() const
+  {
+    return this->encoderCache != nullptr;
+  }
+
+  void SgfcDocumentWriter::SetUseIncrementalEncoding(bool useIncrementalEncoding)
+  {
+    if (useIncrementalEncoding == GetUseIncrementalEncoding())
+      return;
+
+    if (useIncrementalEncoding)
+      this->encoderCache = std::shared_ptr<SgfcDocumentEncoderCache>(new SgfcDocumentEncoderCache());
+    else
+      this->encoderCache = nullptr;
+  }
+
   std::shared_ptr<ISgfcDocumentWriteResult> SgfcDocumentWriter::WriteSgfFile(
     std::shared_ptr<ISgfcDocument> document,
     const std::string& sgfFilePath) const
@@ -70,11 +99,25 @@ namespace LibSgfcPlusPlus
   void SgfcDocumentWriter::DebugPrintToConsole(
     std::shared_ptr<ISgfcDocument> document) const
   {
-    SgfcDocumentEncoder encoder(document);
+    SgfcDocumentEncoder encoder(document, this->numberOfThreads);
     std::string sgfContent = encoder.Encode();
     std::cout << sgfContent;
   }
 
+  std::string SgfcDocumentWriter::EncodeDocument(std::shared_ptr<ISgfcDocument> document) const
+  {
+    if (this->encoderCache != nullptr)
+    {
+      SgfcDocumentEncoder encoder(document, this->numberOfThreads, this->encoderCache);
+      return encoder.Encode();
+    }
+    else
+    {
+      SgfcDocumentEncoder encoder(document, this->numberOfThreads);
+      return encoder.Encode();
+    }
+  }
+
   std::shared_ptr<ISgfcDocumentWriteResult> SgfcDocumentWriter::WriteSgfContentToFilesystemOrInMemoryBuffer(
     std::shared_ptr<ISgfcDocument> document,
     const std::string& sgfFilePath,
@@ -84,8 +127,7 @@ namespace LibSgfcPlusPlus
     SgfcBackendController backendController(this->arguments->GetArguments());
     if (backendController.IsCommandLineValid())
     {
-      SgfcDocumentEncoder encoder(document);
-      sgfContent = encoder.Encode();
+      sgfContent = EncodeDocument(document);
 
       std::shared_ptr<SgfcBackendDataWrapper> sgfDataWrapper =
         std::shared_ptr<SgfcBackendDataWrapper>(new SgfcBackendDataWrapper(sgfContent));
@@ -20,8 +20,15 @@
 #include "../backend/SgfcDataLocation.h"
 #include "../../../include/ISgfcDocumentWriter.h"
 
+// C++ Standard Library includes
+#include <memory>
+#include <string>
+
 namespace LibSgfcPlusPlus
 {
+  // Forward declarations
+  class SgfcDocumentEncoderCache;
+
   /// @brief The SgfcDocumentWriter class provides an implementation of the
   /// ISgfcDocumentWriter interface. See the interface header file for
   /// documentation.
@@ -36,6 +43,10 @@ namespace LibSgfcPlusPlus
     virtual ~SgfcDocumentWriter();
 
     virtual std::shared_ptr<ISgfcArguments> GetArguments() const override;
+    virtual unsigned int GetNumberOfThreads() const override;
+    virtual void SetNumberOfThreads(unsigned int numberOfThreads) override;
+    virtual bool GetUseIncrementalEncoding() const override;
+    virtual void SetUseIncrementalEncoding(bool useIncrementalEncoding) override;
     virtual std::shared_ptr<ISgfcDocumentWriteResult> WriteSgfFile(
       std::shared_ptr<ISgfcDocument> document,
       const std::string& sgfFilePath) const override;
@@ -49,7 +60,10 @@ namespace LibSgfcPlusPlus
 
   private:
     std::shared_ptr<ISgfcArguments> arguments;
+    unsigned int numberOfThreads;
+    std::shared_ptr<SgfcDocumentEncoderCache> encoderCache;
 
+    std::string EncodeDocument(std::shared_ptr<ISgfcDocument> document) const;
     std::shared_ptr<ISgfcDocumentWriteResult> WriteSgfContentToFilesystemOrInMemoryBuffer(
       std::shared_ptr<ISgfcDocument> document,
       const std::string& sgfFilePath,
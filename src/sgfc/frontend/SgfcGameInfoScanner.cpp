@@ -0,0 +1,96 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../../include/ISgfcDocument.h"
+#include "../../../include/ISgfcDocumentReader.h"
+#include "../../../include/ISgfcDocumentReadResult.h"
+#include "../../../include/ISgfcGame.h"
+#include "../../../include/SgfcPlusPlusFactory.h"
+#include "../../parsing/SgfcHeaderScanner.h"
+#include "SgfcDocumentCacheUtility.h"
+#include "SgfcGameInfoScanner.h"
+
+namespace LibSgfcPlusPlus
+{
+  SgfcGameInfoScanner::SgfcGameInfoScanner()
+  {
+  }
+
+  SgfcGameInfoScanner::~SgfcGameInfoScanner()
+  {
+  }
+
+  SgfcGameInfoScanResult SgfcGameInfoScanner::ScanSgfFile(const std::string& sgfFilePath) const
+  {
+    SgfcGameInfoScanResult scanResult;
+
+    std::string sgfContent;
+    if (SgfcDocumentCacheUtility::ReadFileContent(sgfFilePath, sgfContent) &&
+        ScanSgfContentWithHeaderScanner(sgfContent, scanResult))
+    {
+      return scanResult;
+    }
+
+    // Let SGFC read the file, not the content, so that the read result
+    // describes the problem in the same way as ISgfcDocumentReader would
+    auto documentReader = SgfcPlusPlusFactory::CreateDocumentReader();
+    ApplyFallbackReadResult(documentReader->ReadSgfFile(sgfFilePath), scanResult);
+
+    return scanResult;
+  }
+
+  SgfcGameInfoScanResult SgfcGameInfoScanner::ScanSgfContent(const std::string& sgfContent) const
+  {
+    SgfcGameInfoScanResult scanResult;
+
+    if (ScanSgfContentWithHeaderScanner(sgfContent, scanResult))
+      return scanResult;
+
+    auto documentReader = SgfcPlusPlusFactory::CreateDocumentReader();
+    ApplyFallbackReadResult(documentReader->ReadSgfContent(sgfContent), scanResult);
+
+    return scanResult;
+  }
+
+  bool SgfcGameInfoScanner::ScanSgfContentWithHeaderScanner(
+    const std::string& sgfContent,
+    SgfcGameInfoScanResult& scanResult) const
+  {
+    SgfcHeaderScanner headerScanner(sgfContent);
+
+    std::vector<std::shared_ptr<ISgfcGameInfo>> gameInfos;
+    if (! headerScanner.ScanGameInfos(gameInfos))
+      return false;
+
+    scanResult.GameInfos = gameInfos;
+    return true;
+  }
+
+  void SgfcGameInfoScanner::ApplyFallbackReadResult(
+    std::shared_ptr<ISgfcDocumentReadResult> readResult,
+    SgfcGameInfoScanResult& scanResult) const
+  {
+    scanResult.IsFallbackUsed = true;
+    scanResult.FallbackReadResult = readResult;
+
+    if (readResult->GetExitCode() == SgfcExitCode::FatalError)
+      return;
+
+    for (auto game : readResult->GetDocument()->GetGames())
+      scanResult.GameInfos.push_back(game->CreateGameInfo());
+  }
+}
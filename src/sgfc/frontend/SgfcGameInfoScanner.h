@@ -0,0 +1,45 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../../include/ISgfcGameInfoScanner.h"
+
+namespace LibSgfcPlusPlus
+{
+  /// @brief The SgfcGameInfoScanner class provides an implementation of the
+  /// ISgfcGameInfoScanner interface. See the interface header file for
+  /// documentation.
+  ///
+  /// @ingroup internals
+  /// @ingroup sgfc-frontend
+  class SgfcGameInfoScanner : public ISgfcGameInfoScanner
+  {
+  public:
+    SgfcGameInfoScanner();
+    virtual ~SgfcGameInfoScanner();
+
+    virtual SgfcGameInfoScanResult ScanSgfFile(const std::string& sgfFilePath) const override;
+    virtual SgfcGameInfoScanResult ScanSgfContent(const std::string& sgfContent) const override;
+
+  private:
+    bool ScanSgfContentWithHeaderScanner(const std::string& sgfContent, SgfcGameInfoScanResult& scanResult) const;
+    void ApplyFallbackReadResult(
+      std::shared_ptr<ISgfcDocumentReadResult> readResult,
+      SgfcGameInfoScanResult& scanResult) const;
+  };
+}
@@ -0,0 +1,288 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../../include/ISgfcDocumentReadResult.h"
+#include "../../SgfcPrivateConstants.h"
+#include "SgfcDocumentCacheUtility.h"
+#include "SgfcMemoryCachingDocumentReader.h"
+
+// C++ Standard Library includes
+#include <stdexcept>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcMemoryCachingDocumentReader::SgfcMemoryCachingDocumentReader(std::shared_ptr<ISgfcDocumentReader> documentReader)
+    : documentReader(documentReader)
+    , cacheKeyType(SgfcDocumentCacheKeyType::FileMetadata)
+    , maximumMemoryUsage(SgfcPrivateConstants::DocumentCacheDefaultMaximumMemoryUsage)
+  {
+    if (documentReader == nullptr)
+      throw std::invalid_argument("SgfcMemoryCachingDocumentReader constructor failed: Document reader object is nullptr");
+  }
+
+  SgfcMemoryCachingDocumentReader::~SgfcMemoryCachingDocumentReader()
+  {
+  }
+
+  std::shared_ptr<ISgfcArguments> SgfcMemoryCachingDocumentReader::GetArguments() const
+  {
+    return this->documentReader->GetArguments();
+  }
+
+  SgfcDocumentReadOptions SgfcMemoryCachingDocumentReader::GetReadOptions() const
+  {
+    return this->documentReader->GetReadOptions();
+  }
+
+  void SgfcMemoryCachingDocumentReader::SetReadOptions(const SgfcDocumentReadOptions& readOptions)
+  {
+    this->documentReader->SetReadOptions(readOptions);
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> SgfcMemoryCachingDocumentReader::ReadSgfFile(const std::string& sgfFilePath) const
+  {
+    if (GetCacheKeyType() == SgfcDocumentCacheKeyType::FileContent)
+      return ReadSgfFileWithFileContentKey(sgfFilePath);
+    else
+      return ReadSgfFileWithFileMetadataKey(sgfFilePath);
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> SgfcMemoryCachingDocumentReader::ReadSgfContent(const std::string& sgfContent) const
+  {
+    std::string key = GetKey(SgfcDocumentCacheUtility::GetContentIdentification(sgfContent));
+
+    return GetOrReadReadResult(key, [&](bool& isCacheable)
+    {
+      isCacheable = true;
+      return this->documentReader->ReadSgfContent(sgfContent);
+    });
+  }
+
+  SgfcDocumentCacheKeyType SgfcMemoryCachingDocumentReader::GetCacheKeyType() const
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->cacheKeyType;
+  }
+
+  void SgfcMemoryCachingDocumentReader::SetCacheKeyType(SgfcDocumentCacheKeyType cacheKeyType)
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->cacheKeyType = cacheKeyType;
+  }
+
+  std::uint64_t SgfcMemoryCachingDocumentReader::GetMaximumMemoryUsage() const
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->maximumMemoryUsage;
+  }
+
+  void SgfcMemoryCachingDocumentReader::SetMaximumMemoryUsage(std::uint64_t maximumMemoryUsage)
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->maximumMemoryUsage = maximumMemoryUsage;
+    EvictCacheEntries();
+  }
+
+  SgfcDocumentCacheStatistics SgfcMemoryCachingDocumentReader::GetStatistics() const
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->statistics;
+  }
+
+  void SgfcMemoryCachingDocumentReader::ResetStatistics()
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->statistics.NumberOfHits = 0;
+    this->statistics.NumberOfMisses = 0;
+    this->statistics.NumberOfCoalescedReads = 0;
+    this->statistics.NumberOfEvictions = 0;
+  }
+
+  void SgfcMemoryCachingDocumentReader::ClearCache()
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->cacheEntries.clear();
+    this->keyToCacheEntryMap.clear();
+    this->statistics.NumberOfReadResults = 0;
+    this->statistics.MemoryUsage = 0;
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> SgfcMemoryCachingDocumentReader::ReadSgfFileWithFileContentKey(const std::string& sgfFilePath) const
+  {
+    std::string sgfContent;
+    if (! SgfcDocumentCacheUtility::ReadFileContent(sgfFilePath, sgfContent))
+    {
+      // Let the wrapped reader generate the appropriate error message
+      return this->documentReader->ReadSgfFile(sgfFilePath);
+    }
+
+    std::string key = GetKey(SgfcDocumentCacheUtility::GetContentIdentification(sgfContent));
+
+    // Read the content that we hashed, not the file - the file might have
+    // been modified in the meantime
+    return GetOrReadReadResult(key, [&](bool& isCacheable)
+    {
+      isCacheable = true;
+      return this->documentReader->ReadSgfContent(sgfContent);
+    });
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> SgfcMemoryCachingDocumentReader::ReadSgfFileWithFileMetadataKey(const std::string& sgfFilePath) const
+  {
+    std::string fileMetadataIdentificationBeforeRead;
+    if (! SgfcDocumentCacheUtility::GetFileMetadataIdentification(sgfFilePath, fileMetadataIdentificationBeforeRead))
+      return this->documentReader->ReadSgfFile(sgfFilePath);
+
+    std::string key = GetKey(fileMetadataIdentificationBeforeRead);
+
+    return GetOrReadReadResult(key, [&](bool& isCacheable)
+    {
+      auto readResult = this->documentReader->ReadSgfFile(sgfFilePath);
+
+      // Don't cache the read result if the file was modified while it was
+      // being read - the read result might not match the key
+      std::string fileMetadataIdentificationAfterRead;
+      isCacheable =
+        SgfcDocumentCacheUtility::GetFileMetadataIdentification(sgfFilePath, fileMetadataIdentificationAfterRead) &&
+        fileMetadataIdentificationAfterRead == fileMetadataIdentificationBeforeRead;
+
+      return readResult;
+    });
+  }
+
+  std::string SgfcMemoryCachingDocumentReader::GetKey(const std::string& dataIdentification) const
+  {
+    return
+      SgfcDocumentCacheUtility::GetArgumentsIdentification(this->documentReader->GetArguments()) +
+      SgfcDocumentCacheUtility::GetReadOptionsIdentification(this->documentReader->GetReadOptions()) +
+      dataIdentification;
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> SgfcMemoryCachingDocumentReader::GetOrReadReadResult(
+    const std::string& key,
+    ReadFunction readFunction) const
+  {
+    std::unique_lock<std::mutex> lock(this->mutex);
+
+    auto iterator = this->keyToCacheEntryMap.find(key);
+    if (iterator != this->keyToCacheEntryMap.end())
+    {
+      // Move the entry to the front of the list so that it becomes the most
+      // recently used entry
+      this->cacheEntries.splice(this->cacheEntries.begin(), this->cacheEntries, iterator->second);
+      this->statistics.NumberOfHits++;
+      return iterator->second->ReadResult;
+    }
+
+    auto inFlightIterator = this->inFlightReadOperations.find(key);
+    if (inFlightIterator != this->inFlightReadOperations.end())
+    {
+      auto inFlightReadResult = inFlightIterator->second;
+      this->statistics.NumberOfCoalescedReads++;
+      lock.unlock();
+
+      // Rethrows the exception if the read operation in the other thread
+      // failed
+      return inFlightReadResult.get();
+    }
+
+    this->statistics.NumberOfMisses++;
+
+    std::promise<std::shared_ptr<ISgfcDocumentReadResult>> readResultPromise;
+    this->inFlightReadOperations[key] = readResultPromise.get_future().share();
+
+    // Don't hold the lock while the SGF data is read, otherwise read
+    // operations for different keys could not run in parallel
+    lock.unlock();
+
+    std::shared_ptr<ISgfcDocumentReadResult> readResult;
+    bool isCacheable = false;
+    std::uint64_t memoryUsage = 0;
+    try
+    {
+      readResult = readFunction(isCacheable);
+
+      if (readResult->GetExitCode() == SgfcExitCode::FatalError)
+        isCacheable = false;
+      if (isCacheable)
+        memoryUsage = SgfcDocumentCacheUtility::GetMemoryUsage(readResult);
+    }
+    catch (...)
+    {
+      lock.lock();
+      this->inFlightReadOperations.erase(key);
+      lock.unlock();
+
+      readResultPromise.set_exception(std::current_exception());
+      throw;
+    }
+
+    lock.lock();
+    this->inFlightReadOperations.erase(key);
+    if (isCacheable)
+      AddCacheEntry(key, readResult, memoryUsage);
+    lock.unlock();
+
+    readResultPromise.set_value(readResult);
+
+    return readResult;
+  }
+
+  void SgfcMemoryCachingDocumentReader::AddCacheEntry(
+    const std::string& key,
+    std::shared_ptr<ISgfcDocumentReadResult> readResult,
+    std::uint64_t memoryUsage) const
+  {
+    // A read result that does not fit into the cache at all would only
+    // cause all other entries to be evicted
+    if (memoryUsage > this->maximumMemoryUsage)
+      return;
+
+    // Concurrent read operations for the same key are coalesced, so there
+    // should be no entry for the key. Replacing an existing entry keeps the
+    // bookkeeping consistent nonetheless.
+    auto iterator = this->keyToCacheEntryMap.find(key);
+    if (iterator != this->keyToCacheEntryMap.end())
+    {
+      this->statistics.MemoryUsage -= iterator->second->MemoryUsage;
+      this->statistics.NumberOfReadResults--;
+      this->cacheEntries.erase(iterator->second);
+      this->keyToCacheEntryMap.erase(iterator);
+    }
+
+    this->cacheEntries.push_front({ key, readResult, memoryUsage });
+    this->keyToCacheEntryMap[key] = this->cacheEntries.begin();
+    this->statistics.MemoryUsage += memoryUsage;
+    this->statistics.NumberOfReadResults++;
+
+    EvictCacheEntries();
+  }
+
+  void SgfcMemoryCachingDocumentReader::EvictCacheEntries() const
+  {
+    while (this->statistics.MemoryUsage > this->maximumMemoryUsage && ! this->cacheEntries.empty())
+    {
+      const CacheEntry& leastRecentlyUsedCacheEntry = this->cacheEntries.back();
+
+      this->statistics.MemoryUsage -= leastRecentlyUsedCacheEntry.MemoryUsage;
+      this->statistics.NumberOfReadResults--;
+      this->statistics.NumberOfEvictions++;
+      this->keyToCacheEntryMap.erase(leastRecentlyUsedCacheEntry.Key);
+      this->cacheEntries.pop_back();
+    }
+  }
+}
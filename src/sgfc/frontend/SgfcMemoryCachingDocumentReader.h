@@ -0,0 +1,110 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Project includes
+#include "../../../include/ISgfcMemoryCachingDocumentReader.h"
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcDocumentReadResult;
+
+  /// @brief The SgfcMemoryCachingDocumentReader class provides an
+  /// implementation of the ISgfcMemoryCachingDocumentReader interface. See
+  /// the interface header file for documentation.
+  ///
+  /// @ingroup internals
+  /// @ingroup sgfc-frontend
+  /// @ingroup document
+  ///
+  /// The cache is a list of entries ordered by the time of their last use,
+  /// the most recently used entry first, plus a map that allows to look up
+  /// list entries by key. A second map holds the read operations that are
+  /// currently in progress, so that concurrent read operations for the same
+  /// key can wait for the result of the first read operation.
+  class SgfcMemoryCachingDocumentReader : public ISgfcMemoryCachingDocumentReader
+  {
+  public:
+    /// @brief Initializes a newly constructed SgfcMemoryCachingDocumentReader
+    /// object that delegates read operations to @a documentReader.
+    ///
+    /// @exception std::invalid_argument Is thrown if @a documentReader is
+    /// @e nullptr.
+    SgfcMemoryCachingDocumentReader(std::shared_ptr<ISgfcDocumentReader> documentReader);
+
+    /// @brief Destroys and cleans up the SgfcMemoryCachingDocumentReader
+    /// object.
+    virtual ~SgfcMemoryCachingDocumentReader();
+
+    virtual std::shared_ptr<ISgfcArguments> GetArguments() const override;
+    virtual SgfcDocumentReadOptions GetReadOptions() const override;
+    virtual void SetReadOptions(const SgfcDocumentReadOptions& readOptions) override;
+    virtual std::shared_ptr<ISgfcDocumentReadResult> ReadSgfFile(const std::string& sgfFilePath) const override;
+    virtual std::shared_ptr<ISgfcDocumentReadResult> ReadSgfContent(const std::string& sgfContent) const override;
+
+    virtual SgfcDocumentCacheKeyType GetCacheKeyType() const override;
+    virtual void SetCacheKeyType(SgfcDocumentCacheKeyType cacheKeyType) override;
+    virtual std::uint64_t GetMaximumMemoryUsage() const override;
+    virtual void SetMaximumMemoryUsage(std::uint64_t maximumMemoryUsage) override;
+    virtual SgfcDocumentCacheStatistics GetStatistics() const override;
+    virtual void ResetStatistics() override;
+    virtual void ClearCache() override;
+
+  private:
+    /// @brief Defines the signature of the function that performs a read
+    /// operation on a cache miss. The function sets its parameter to false
+    /// if the read result must not be stored in the cache.
+    typedef std::function<std::shared_ptr<ISgfcDocumentReadResult> (bool&)> ReadFunction;
+
+    struct CacheEntry
+    {
+      std::string Key;
+      std::shared_ptr<ISgfcDocumentReadResult> ReadResult;
+      std::uint64_t MemoryUsage;
+    };
+
+    std::shared_ptr<ISgfcDocumentReader> documentReader;
+
+    // All members below are protected by the mutex
+    mutable std::mutex mutex;
+    SgfcDocumentCacheKeyType cacheKeyType;
+    std::uint64_t maximumMemoryUsage;
+    mutable std::list<CacheEntry> cacheEntries;
+    mutable std::unordered_map<std::string, std::list<CacheEntry>::iterator> keyToCacheEntryMap;
+    mutable std::unordered_map<std::string, std::shared_future<std::shared_ptr<ISgfcDocumentReadResult>>> inFlightReadOperations;
+    mutable SgfcDocumentCacheStatistics statistics;
+
+    std::shared_ptr<ISgfcDocumentReadResult> ReadSgfFileWithFileContentKey(const std::string& sgfFilePath) const;
+    std::shared_ptr<ISgfcDocumentReadResult> ReadSgfFileWithFileMetadataKey(const std::string& sgfFilePath) const;
+
+    std::string GetKey(const std::string& dataIdentification) const;
+    std::shared_ptr<ISgfcDocumentReadResult> GetOrReadReadResult(const std::string& key, ReadFunction readFunction) const;
+    void AddCacheEntry(const std::string& key, std::shared_ptr<ISgfcDocumentReadResult> readResult, std::uint64_t memoryUsage) const;
+    void EvictCacheEntries() const;
+  };
+}
@@ -0,0 +1,132 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../../include/ISgfcParseEventHandler.h"
+#include "../../document/SgfcDocument.h"
+#include "../../parsing/SgfcParseEventGenerator.h"
+#include "../../SgfcPrivateConstants.h"
+#include "../../SgfcUtility.h"
+#include "../argument/SgfcArgument.h"
+#include "../argument/SgfcArguments.h"
+#include "../backend/SgfcBackendController.h"
+#include "../message/SgfcMessage.h"
+#include "SgfcDocumentReadResult.h"
+#include "SgfcParseEventReader.h"
+
+// C++ Standard Library includes
+#include <stdexcept>
+
+namespace LibSgfcPlusPlus
+{
+  SgfcParseEventReader::SgfcParseEventReader()
+    : arguments(new SgfcArguments())
+  {
+  }
+
+  SgfcParseEventReader::~SgfcParseEventReader()
+  {
+  }
+
+  std::shared_ptr<ISgfcArguments> SgfcParseEventReader::GetArguments() const
+  {
+    return this->arguments;
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> SgfcParseEventReader::ReadSgfFile(
+    const std::string& sgfFilePath,
+    std::shared_ptr<ISgfcParseEventHandler> eventHandler) const
+  {
+    std::string sgfContent;
+    return ReadSgfContentFromFilesystemOrInMemoryBuffer(sgfFilePath, sgfContent, SgfcDataLocation::Filesystem, eventHandler);
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> SgfcParseEventReader::ReadSgfContent(
+    const std::string& sgfContent,
+    std::shared_ptr<ISgfcParseEventHandler> eventHandler) const
+  {
+    std::string sgfFilePath;
+    return ReadSgfContentFromFilesystemOrInMemoryBuffer(sgfFilePath, sgfContent, SgfcDataLocation::InMemoryBuffer, eventHandler);
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> SgfcParseEventReader::ReadSgfContentFromFilesystemOrInMemoryBuffer(
+    const std::string& sgfFilePath,
+    const std::string& sgfContent,
+    SgfcDataLocation dataLocation,
+    std::shared_ptr<ISgfcParseEventHandler> eventHandler) const
+  {
+    if (eventHandler == nullptr)
+      throw std::invalid_argument("SgfcParseEventReader read operation failed: Event handler object is nullptr");
+
+    // The document of the read result is always empty
+    std::shared_ptr<ISgfcDocument> document = std::shared_ptr<ISgfcDocument>(new SgfcDocument());
+
+    SgfcBackendController backendController(this->arguments->GetArguments());
+    if (! backendController.IsCommandLineValid())
+    {
+      std::shared_ptr<ISgfcDocumentReadResult> result = std::shared_ptr<ISgfcDocumentReadResult>(new SgfcDocumentReadResult(
+        backendController.GetInvalidCommandLineReason()));
+      return result;
+    }
+
+    std::shared_ptr<SgfcBackendLoadResult> backendLoadResult;
+    if (dataLocation == SgfcDataLocation::Filesystem)
+      backendLoadResult = backendController.LoadSgfFile(sgfFilePath);
+    else
+      backendLoadResult = backendController.LoadSgfContent(sgfContent);
+
+    SgfcExitCode sgfcExitCode = SgfcUtility::GetSgfcExitCodeFromMessageCollection(
+      backendLoadResult->GetParseResult());
+
+    auto parseResult = backendLoadResult->GetParseResult();
+
+    if (sgfcExitCode != SgfcExitCode::FatalError)
+    {
+      SgfcParseEventGenerator eventGenerator(
+        backendLoadResult->GetSgfDataWrapper()->GetSgfData(),
+        IsTextEncodingUtf8());
+
+      // Exceptions thrown by the event handler are passed through to the
+      // caller
+      std::string errorMessage;
+      if (! eventGenerator.GenerateEvents(*eventHandler, errorMessage))
+      {
+        parseResult.push_back(std::shared_ptr<ISgfcMessage>(new SgfcMessage(
+          SgfcMessageID::SGFCInterfacingError,
+          errorMessage)));
+      }
+    }
+
+    std::shared_ptr<ISgfcDocumentReadResult> result = std::shared_ptr<ISgfcDocumentReadResult>(new SgfcDocumentReadResult(
+      parseResult,
+      document));
+    return result;
+  }
+
+  bool SgfcParseEventReader::IsTextEncodingUtf8() const
+  {
+    for (auto argument : this->arguments->GetArguments())
+    {
+      if (argument->GetArgumentType() == SgfcArgumentType::EncodingMode &&
+          argument->GetIntegerTypeParameter() == SgfcPrivateConstants::EncodingModeNoDecoding)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+}
@@ -0,0 +1,87 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "RecordingDocumentReader.h"
+
+// Library includes
+#include <ISgfcArguments.h>
+#include <ISgfcDocumentReadResult.h>
+#include <SgfcPlusPlusFactory.h>
+#include <SgfcUtility.h>
+#include <sgfc/frontend/SgfcDocumentReadResult.h>
+#include <sgfc/message/SgfcMessage.h>
+
+// C++ Standard Library includes
+#include <thread>
+
+namespace LibSgfcPlusPlus
+{
+  RecordingDocumentReader::RecordingDocumentReader()
+    : NumberOfReadOperations(0)
+    , ReadDuration(0)
+    , arguments(SgfcPlusPlusFactory::CreateSgfcArguments())
+  {
+  }
+
+  RecordingDocumentReader::~RecordingDocumentReader()
+  {
+  }
+
+  std::shared_ptr<ISgfcArguments> RecordingDocumentReader::GetArguments() const
+  {
+    return this->arguments;
+  }
+
+  SgfcDocumentReadOptions RecordingDocumentReader::GetReadOptions() const
+  {
+    return this->readOptions;
+  }
+
+  void RecordingDocumentReader::SetReadOptions(const SgfcDocumentReadOptions& readOptions)
+  {
+    this->readOptions = readOptions;
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> RecordingDocumentReader::ReadSgfFile(const std::string& sgfFilePath) const
+  {
+    return ReadSgfContent(SgfcUtility::ReadFileContent(sgfFilePath));
+  }
+
+  std::shared_ptr<ISgfcDocumentReadResult> RecordingDocumentReader::ReadSgfContent(const std::string& sgfContent) const
+  {
+    this->NumberOfReadOperations++;
+
+    {
+      std::lock_guard<std::mutex> lock(this->sgfContentsMutex);
+      this->SgfContents.push_back(sgfContent);
+    }
+
+    std::this_thread::sleep_for(this->ReadDuration);
+
+    std::vector<std::shared_ptr<ISgfcMessage>> parseResult;
+    if (! this->FatalErrorSgfContent.empty() && sgfContent == this->FatalErrorSgfContent)
+    {
+      parseResult.push_back(std::shared_ptr<ISgfcMessage>(new SgfcMessage(
+        SgfcMessageID::ParseSgfContentError,
+        "Fatal error")));
+    }
+
+    return std::shared_ptr<ISgfcDocumentReadResult>(new SgfcDocumentReadResult(
+      parseResult,
+      SgfcPlusPlusFactory::CreateDocument()));
+  }
+}
@@ -0,0 +1,73 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+// Library includes
+#include <ISgfcDocumentReader.h>
+#include <SgfcDocumentReadOptions.h>
+
+// C++ Standard Library includes
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace LibSgfcPlusPlus
+{
+  // Forward declarations
+  class ISgfcArguments;
+  class ISgfcDocumentReadResult;
+
+  /// @brief The RecordingDocumentReader class is an ISgfcDocumentReader test
+  /// double that does not invoke SGFC. It counts how often it is asked to
+  /// read SGF data, records the SGF content that it is asked to read and
+  /// returns a read result with an empty document.
+  ///
+  /// RecordingDocumentReader can be used by several threads at the same
+  /// time. Tests must examine the recorded SGF content only after all
+  /// threads have finished.
+  class RecordingDocumentReader : public ISgfcDocumentReader
+  {
+  public:
+    RecordingDocumentReader();
+    virtual ~RecordingDocumentReader();
+
+    std::shared_ptr<ISgfcArguments> GetArguments() const override;
+    SgfcDocumentReadOptions GetReadOptions() const override;
+    void SetReadOptions(const SgfcDocumentReadOptions& readOptions) override;
+    std::shared_ptr<ISgfcDocumentReadResult> ReadSgfFile(const std::string& sgfFilePath) const override;
+    std::shared_ptr<ISgfcDocumentReadResult> ReadSgfContent(const std::string& sgfContent) const override;
+
+    /// @brief The number of read operations so far.
+    mutable std::atomic<int> NumberOfReadOperations;
+    /// @brief The SGF content of the read operations so far, in the order in
+    /// which the read operations started.
+    mutable std::vector<std::string> SgfContents;
+    /// @brief How long a read operation takes.
+    std::chrono::milliseconds ReadDuration;
+    /// @brief SGF content whose read result has a fatal error message. No
+    /// read result has a fatal error message if this is empty.
+    std::string FatalErrorSgfContent;
+
+  private:
+    std::shared_ptr<ISgfcArguments> arguments;
+    SgfcDocumentReadOptions readOptions;
+    mutable std::mutex sgfContentsMutex;
+  };
+}
@@ -1,28 +1,43 @@
 set (
   SOURCES
+  document/SgfcBinaryDocumentTest.cpp
   document/SgfcDocumentTest.cpp
   document/SgfcGameTest.cpp
   document/SgfcNodeTest.cpp
   document/SgfcNodeTraitsTest.cpp
   document/SgfcTreeBuilderTest.cpp
   game/SgfcDateTest.cpp
+  game/SgfcGameInfoCatalogTest.cpp
   game/SgfcGameResultTest.cpp
   game/SgfcRoundInformationTest.cpp
   game/go/SgfcGoMoveTest.cpp
+  game/go/SgfcGoOpeningTreeBuilderTest.cpp
   game/go/SgfcGoPlayerRankTest.cpp
   game/go/SgfcGoPointTest.cpp
+  game/go/SgfcGoPositionIndexTest.cpp
+  game/go/SgfcGoReplayEngineTest.cpp
   game/go/SgfcGoRulesetTest.cpp
   game/go/SgfcGoStoneTest.cpp
+  parsing/SgfcDocumentEncoderTest.cpp
   parsing/SgfcPropertyDecoderTest.cpp
   parsing/SgfcValueConverterTest.cpp
   sgfc/argument/SgfcArgumentsTest.cpp
   sgfc/argument/SgfcArgumentTest.cpp
   sgfc/backend/SgfcBackendControllerTest.cpp
   sgfc/backend/SgfcBackendDataWrapperTest.cpp
+  sgfc/backend/SgfcCompressionUtilityTest.cpp
   sgfc/frontend/EncodingTest.cpp
+  sgfc/frontend/SgfcArchiveReaderTest.cpp
+  sgfc/frontend/SgfcBatchDocumentReaderTest.cpp
+  sgfc/frontend/SgfcBatchDocumentWriterTest.cpp
+  sgfc/frontend/SgfcCachingDocumentReaderTest.cpp
+  sgfc/frontend/SgfcCollectionReaderTest.cpp
   sgfc/frontend/SgfcCommandLineTest.cpp
   sgfc/frontend/SgfcDocumentReaderTest.cpp
   sgfc/frontend/SgfcDocumentWriterTest.cpp
+  sgfc/frontend/SgfcGameInfoScannerTest.cpp
+  sgfc/frontend/SgfcMemoryCachingDocumentReaderTest.cpp
+  sgfc/frontend/SgfcParseEventReaderTest.cpp
   sgfc/message/SgfcMessageStreamTest.cpp
   sgfc/message/SgfcMessageTest.cpp
   sgfc/save/SgfcSaveStreamTest.cpp
@@ -30,6 +45,8 @@ set (
   ${SOURCES_LIST_FILE_NAME}
   AssertHelperFunctions.h
   AssertHelperFunctions.cpp
+  RecordingDocumentReader.h
+  RecordingDocumentReader.cpp
   SetupHelperFunctions.h
   SetupHelperFunctions.cpp
   TestDataGenerator.cpp
@@ -0,0 +1,518 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Library includes
+#include <document/SgfcProperty.h>
+#include <document/SgfcSinglePropertyValue.h>
+#include <ISgfcBinaryDocumentReader.h>
+#include <ISgfcBinaryDocumentWriter.h>
+#include <ISgfcColorPropertyValue.h>
+#include <ISgfcComposedPropertyValue.h>
+#include <ISgfcDocument.h>
+#include <ISgfcDoublePropertyValue.h>
+#include <ISgfcGame.h>
+#include <ISgfcGoMove.h>
+#include <ISgfcGoMovePropertyValue.h>
+#include <ISgfcGoPoint.h>
+#include <ISgfcGoPointPropertyValue.h>
+#include <ISgfcGoStone.h>
+#include <ISgfcGoStonePropertyValue.h>
+#include <ISgfcMovePropertyValue.h>
+#include <ISgfcNode.h>
+#include <ISgfcNumberPropertyValue.h>
+#include <ISgfcPointPropertyValue.h>
+#include <ISgfcProperty.h>
+#include <ISgfcPropertyFactory.h>
+#include <ISgfcPropertyValueFactory.h>
+#include <ISgfcRealPropertyValue.h>
+#include <ISgfcSimpleTextPropertyValue.h>
+#include <ISgfcStonePropertyValue.h>
+#include <ISgfcTextPropertyValue.h>
+#include <ISgfcTreeBuilder.h>
+#include <SgfcPlusPlusFactory.h>
+#include <SgfcUtility.h>
+
+// Unit test library includes
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+
+using namespace LibSgfcPlusPlus;
+
+std::shared_ptr<ISgfcDocument> CreateBinaryDocumentTestDocument();
+void RequireEqualDocuments(std::shared_ptr<ISgfcDocument> document1, std::shared_ptr<ISgfcDocument> document2);
+void RequireEqualNodes(std::shared_ptr<ISgfcNode> node1, std::shared_ptr<ISgfcNode> node2);
+void RequireEqualSingleValues(std::shared_ptr<ISgfcSinglePropertyValue> value1, std::shared_ptr<ISgfcSinglePropertyValue> value2);
+void RequireEqualGoPoints(std::shared_ptr<ISgfcGoPoint> goPoint1, std::shared_ptr<ISgfcGoPoint> goPoint2);
+
+SCENARIO( "SgfcBinaryDocumentWriter and SgfcBinaryDocumentReader are constructed", "[document]" )
+{
+  GIVEN( "The factory methods are used" )
+  {
+    WHEN( "SgfcBinaryDocumentWriter and SgfcBinaryDocumentReader are constructed" )
+    {
+      THEN( "SgfcBinaryDocumentWriter and SgfcBinaryDocumentReader are constructed successfully" )
+      {
+        REQUIRE( SgfcPlusPlusFactory::CreateBinaryDocumentWriter() != nullptr );
+        REQUIRE( SgfcPlusPlusFactory::CreateBinaryDocumentReader() != nullptr );
+      }
+    }
+  }
+}
+
+SCENARIO( "A document is written and read in the binary document format", "[document]" )
+{
+  auto writer = SgfcPlusPlusFactory::CreateBinaryDocumentWriter();
+  auto reader = SgfcPlusPlusFactory::CreateBinaryDocumentReader();
+
+  GIVEN( "A document with typed and untyped property values" )
+  {
+    auto document = CreateBinaryDocumentTestDocument();
+
+    WHEN( "The document is written to and read from an in-memory string" )
+    {
+      std::string binaryContent;
+      writer->WriteBinaryContent(document, binaryContent);
+      auto documentRead = reader->ReadBinaryContent(binaryContent);
+
+      THEN( "The document read is identical to the original document" )
+      {
+        RequireEqualDocuments(document, documentRead);
+
+        std::string binaryContentRead;
+        writer->WriteBinaryContent(documentRead, binaryContentRead);
+        REQUIRE( binaryContentRead == binaryContent );
+      }
+    }
+
+    WHEN( "The document is written to and read from a file" )
+    {
+      std::string binaryFilePath = SgfcUtility::GetUniqueTempFilePath();
+      writer->WriteBinaryFile(document, binaryFilePath);
+      auto documentRead = reader->ReadBinaryFile(binaryFilePath);
+      SgfcUtility::DeleteFileIfExists(binaryFilePath);
+
+      THEN( "The document read is identical to the original document" )
+      {
+        RequireEqualDocuments(document, documentRead);
+      }
+    }
+  }
+
+  GIVEN( "A document without games" )
+  {
+    auto document = SgfcPlusPlusFactory::CreateDocument();
+    document->SetGames({});
+
+    WHEN( "The document is written and read" )
+    {
+      std::string binaryContent;
+      writer->WriteBinaryContent(document, binaryContent);
+      auto documentRead = reader->ReadBinaryContent(binaryContent);
+
+      THEN( "The document read has no games" )
+      {
+        REQUIRE( documentRead->IsEmpty() == true );
+      }
+    }
+  }
+
+  GIVEN( "The document is nullptr" )
+  {
+    WHEN( "The document is written" )
+    {
+      THEN( "The writer throws an exception" )
+      {
+        std::string binaryContent;
+        REQUIRE_THROWS_AS(
+          writer->WriteBinaryContent(nullptr, binaryContent),
+          std::invalid_argument);
+        REQUIRE_THROWS_AS(
+          writer->WriteBinaryFile(nullptr, SgfcUtility::GetUniqueTempFilePath()),
+          std::invalid_argument);
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcBinaryDocumentReader reads data that is not a valid binary document", "[document]" )
+{
+  auto writer = SgfcPlusPlusFactory::CreateBinaryDocumentWriter();
+  auto reader = SgfcPlusPlusFactory::CreateBinaryDocumentReader();
+
+  std::string binaryContent;
+  writer->WriteBinaryContent(CreateBinaryDocumentTestDocument(), binaryContent);
+
+  GIVEN( "The data is not a binary document" )
+  {
+    std::string content = "(;FF[4]GM[1]SZ[19]) and more text to fill the header";
+    content += std::string(64, ' ');
+
+    WHEN( "The data is read" )
+    {
+      THEN( "The reader throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          reader->ReadBinaryContent(content),
+          std::runtime_error);
+        REQUIRE_THROWS_AS(
+          reader->ReadBinaryContent(""),
+          std::runtime_error);
+      }
+    }
+  }
+
+  GIVEN( "The data has an unsupported format version" )
+  {
+    std::string content = binaryContent;
+    content[8] = 99;
+
+    WHEN( "The data is read" )
+    {
+      THEN( "The reader throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          reader->ReadBinaryContent(content),
+          std::runtime_error);
+      }
+    }
+  }
+
+  GIVEN( "The data is truncated" )
+  {
+    std::string content = binaryContent.substr(0, binaryContent.size() - 1);
+
+    WHEN( "The data is read" )
+    {
+      THEN( "The reader throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          reader->ReadBinaryContent(content),
+          std::runtime_error);
+      }
+    }
+  }
+
+  GIVEN( "The header of the data contains a corrupt count" )
+  {
+    std::string content = binaryContent;
+    // The most significant byte of the number of nodes
+    content[39] = 0x7f;
+
+    WHEN( "The data is read" )
+    {
+      THEN( "The reader throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          reader->ReadBinaryContent(content),
+          std::runtime_error);
+      }
+    }
+  }
+
+  GIVEN( "The data contains a corrupt property type" )
+  {
+    std::string content = binaryContent;
+
+    auto readUInt = [&content](std::size_t offset, std::size_t size) -> std::uint64_t
+    {
+      std::uint64_t value = 0;
+      for (std::size_t byteIndex = size; byteIndex > 0; byteIndex--)
+        value = (value << 8) | static_cast<unsigned char>(content[offset + byteIndex - 1]);
+      return value;
+    };
+
+    std::uint64_t numberOfStrings = readUInt(16, 8);
+    std::uint64_t numberOfGames = readUInt(24, 8);
+    std::uint64_t numberOfNodes = readUInt(32, 8);
+    std::uint64_t numberOfProperties = readUInt(40, 8);
+
+    // The column that flags typed properties follows the string, game and
+    // node columns. The property type column follows the flags.
+    std::size_t isTypedPropertyOffset = 64;
+    for (std::uint64_t stringIndex = 0; stringIndex < numberOfStrings; stringIndex++)
+      isTypedPropertyOffset += 4 + readUInt(64 + stringIndex * 4, 4);
+    isTypedPropertyOffset += numberOfGames * 4 + numberOfNodes * (4 + 4);
+    std::size_t propertyTypeOffset = isTypedPropertyOffset + numberOfProperties;
+
+    // The type of an untyped property is corrupted, because the property
+    // factory already rejects unknown types for typed properties
+    std::uint64_t propertyIndex = 0;
+    while (propertyIndex < numberOfProperties && content[isTypedPropertyOffset + propertyIndex] != 0)
+      propertyIndex++;
+    REQUIRE( propertyIndex < numberOfProperties );
+
+    std::uint32_t corruptPropertyType = GENERATE( static_cast<std::uint32_t>(SgfcPropertyType::Unknown) + 1, 0xffffffff );
+    for (std::size_t byteIndex = 0; byteIndex < 4; byteIndex++)
+      content[propertyTypeOffset + propertyIndex * 4 + byteIndex] = static_cast<char>((corruptPropertyType >> (byteIndex * 8)) & 0xff);
+
+    WHEN( "The data is read" )
+    {
+      THEN( "The reader throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          reader->ReadBinaryContent(content),
+          std::runtime_error);
+      }
+    }
+  }
+
+  GIVEN( "The file does not exist" )
+  {
+    WHEN( "The file is read" )
+    {
+      THEN( "The reader throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          reader->ReadBinaryFile(SgfcUtility::GetUniqueTempFilePath()),
+          std::runtime_error);
+      }
+    }
+  }
+}
+
+std::shared_ptr<ISgfcDocument> CreateBinaryDocumentTestDocument()
+{
+  auto propertyFactory = SgfcPlusPlusFactory::CreatePropertyFactory();
+  auto valueFactory = SgfcPlusPlusFactory::CreatePropertyValueFactory();
+
+  // Game 1: A Go game with variations and property values of all kinds
+  SgfcBoardSize boardSize19 = { 19, 19 };
+  auto rootNode1 = SgfcPlusPlusFactory::CreateNode();
+  rootNode1->SetProperties(
+  {
+    propertyFactory->CreateProperty(SgfcPropertyType::GM, valueFactory->CreateGameTypePropertyValue(SgfcGameType::Go)),
+    propertyFactory->CreateProperty(SgfcPropertyType::SZ, valueFactory->CreateBoardSizePropertyValue(boardSize19, SgfcGameType::Go)),
+    propertyFactory->CreateProperty(SgfcPropertyType::PB, valueFactory->CreateSimpleTextPropertyValue("Black Player")),
+    propertyFactory->CreateProperty(SgfcPropertyType::KM, valueFactory->CreateRealPropertyValue(6.5)),
+    propertyFactory->CreateProperty(SgfcPropertyType::C, valueFactory->CreateTextPropertyValue("Line 1\nLine 2 [escaped]")),
+    propertyFactory->CreateProperty(SgfcPropertyType::AB, std::vector<std::shared_ptr<ISgfcPropertyValue>>
+    {
+      valueFactory->CreateGoStonePropertyValue("dd", boardSize19, SgfcColor::Black),
+      valueFactory->CreateGoStonePropertyValue("pp", boardSize19, SgfcColor::Black),
+    }),
+    propertyFactory->CreateProperty(SgfcPropertyType::LB, valueFactory->CreateComposedGoPointAndSimpleTextPropertyValue("qd", boardSize19, "A")),
+    propertyFactory->CreateProperty("XX", valueFactory->CreateCustomPropertyValue("custom value")),
+    propertyFactory->CreateProperty("YY", std::shared_ptr<ISgfcPropertyValue>(new SgfcSinglePropertyValue("abc", SgfcPropertyValueType::Number, "Not a number"))),
+  });
+
+  auto node1a = SgfcPlusPlusFactory::CreateNode();
+  node1a->SetProperties(
+  {
+    propertyFactory->CreateProperty(SgfcPropertyType::B, valueFactory->CreateGoMovePropertyValue("pd", boardSize19, SgfcColor::Black)),
+    propertyFactory->CreateProperty(SgfcPropertyType::GB, valueFactory->CreateDoublePropertyValue(SgfcDouble::Emphasized)),
+  });
+  auto node1b = SgfcPlusPlusFactory::CreateNode();
+  node1b->SetProperties(
+  {
+    propertyFactory->CreateProperty(SgfcPropertyType::W, valueFactory->CreateGoMovePropertyValue(SgfcColor::White)),
+    propertyFactory->CreateProperty(SgfcPropertyType::PL, valueFactory->CreateColorPropertyValue(SgfcColor::Black)),
+  });
+  auto node1c = SgfcPlusPlusFactory::CreateNode();
+  node1c->SetProperties(
+  {
+    propertyFactory->CreateProperty(SgfcPropertyType::B, valueFactory->CreateGoMovePropertyValue("cq", boardSize19, SgfcColor::Black)),
+    propertyFactory->CreateProperty(SgfcPropertyType::MN, valueFactory->CreateNumberPropertyValue(-3)),
+  });
+  auto node1d = SgfcPlusPlusFactory::CreateNode();
+
+  auto game1 = SgfcPlusPlusFactory::CreateGame(rootNode1);
+  auto treeBuilder1 = game1->GetTreeBuilder();
+  treeBuilder1->AppendChild(rootNode1, node1a);
+  treeBuilder1->AppendChild(node1a, node1b);
+  treeBuilder1->AppendChild(rootNode1, node1c);
+  treeBuilder1->AppendChild(rootNode1, node1d);
+
+  // Game 2: A game without root node
+  auto game2 = SgfcPlusPlusFactory::CreateGame();
+  game2->SetRootNode(nullptr);
+
+  // Game 3: A Go game on a rectangular board
+  SgfcBoardSize boardSize9x13 = { 9, 13 };
+  auto rootNode3 = SgfcPlusPlusFactory::CreateNode();
+  rootNode3->SetProperties(
+  {
+    propertyFactory->CreateProperty(SgfcPropertyType::SZ, valueFactory->CreateBoardSizePropertyValue(boardSize9x13, SgfcGameType::Go)),
+    propertyFactory->CreateProperty(SgfcPropertyType::AW, valueFactory->CreateGoStonePropertyValue("cj", boardSize9x13, SgfcColor::White)),
+    propertyFactory->CreateProperty(SgfcPropertyType::AR, valueFactory->CreateComposedGoPointAndGoPointPropertyValue("aa", "im", boardSize9x13)),
+  });
+  auto game3 = SgfcPlusPlusFactory::CreateGame(rootNode3);
+
+  // Game 4: A non-Go game with untyped point, move and stone values, and a
+  // GM property that is not an ISgfcGameTypeProperty
+  auto rootNode4 = SgfcPlusPlusFactory::CreateNode();
+  rootNode4->SetProperties(
+  {
+    std::shared_ptr<ISgfcProperty>(new SgfcProperty(
+      SgfcPropertyType::GM,
+      "GM",
+      std::vector<std::shared_ptr<ISgfcPropertyValue>> { valueFactory->CreateSimpleTextPropertyValue("not a number") })),
+    propertyFactory->CreateProperty(SgfcPropertyType::B, valueFactory->CreateMovePropertyValue("e2e4")),
+    propertyFactory->CreateProperty(SgfcPropertyType::AB, valueFactory->CreateStonePropertyValue("x")),
+    propertyFactory->CreateProperty(SgfcPropertyType::SL, valueFactory->CreatePointPropertyValue("a1")),
+    propertyFactory->CreateProperty(SgfcPropertyType::AP, valueFactory->CreateComposedSimpleTextAndSimpleTextPropertyValue("libsgfc++", "2.0")),
+  });
+  auto game4 = SgfcPlusPlusFactory::CreateGame(rootNode4);
+
+  auto document = SgfcPlusPlusFactory::CreateDocument();
+  document->SetGames({ game1, game2, game3, game4 });
+  return document;
+}
+
+void RequireEqualDocuments(std::shared_ptr<ISgfcDocument> document1, std::shared_ptr<ISgfcDocument> document2)
+{
+  auto games1 = document1->GetGames();
+  auto games2 = document2->GetGames();
+  REQUIRE( games1.size() == games2.size() );
+
+  for (std::size_t gameIndex = 0; gameIndex < games1.size(); gameIndex++)
+  {
+    REQUIRE( games1[gameIndex]->HasRootNode() == games2[gameIndex]->HasRootNode() );
+    if (games1[gameIndex]->HasRootNode())
+      RequireEqualNodes(games1[gameIndex]->GetRootNode(), games2[gameIndex]->GetRootNode());
+  }
+}
+
+void RequireEqualNodes(std::shared_ptr<ISgfcNode> node1, std::shared_ptr<ISgfcNode> node2)
+{
+  auto properties1 = node1->GetProperties();
+  auto properties2 = node2->GetProperties();
+  REQUIRE( properties1.size() == properties2.size() );
+
+  for (std::size_t propertyIndex = 0; propertyIndex < properties1.size(); propertyIndex++)
+  {
+    auto property1 = properties1[propertyIndex];
+    auto property2 = properties2[propertyIndex];
+    REQUIRE( property1->GetPropertyType() == property2->GetPropertyType() );
+    REQUIRE( property1->GetPropertyName() == property2->GetPropertyName() );
+    REQUIRE( (property1->ToGameTypeProperty() == nullptr) == (property2->ToGameTypeProperty() == nullptr) );
+    REQUIRE( (property1->ToBoardSizeProperty() == nullptr) == (property2->ToBoardSizeProperty() == nullptr) );
+
+    auto propertyValues1 = property1->GetPropertyValues();
+    auto propertyValues2 = property2->GetPropertyValues();
+    REQUIRE( propertyValues1.size() == propertyValues2.size() );
+
+    for (std::size_t valueIndex = 0; valueIndex < propertyValues1.size(); valueIndex++)
+    {
+      auto propertyValue1 = propertyValues1[valueIndex];
+      auto propertyValue2 = propertyValues2[valueIndex];
+      REQUIRE( propertyValue1->IsComposedValue() == propertyValue2->IsComposedValue() );
+
+      if (propertyValue1->IsComposedValue())
+      {
+        RequireEqualSingleValues(propertyValue1->ToComposedValue()->GetValue1(), propertyValue2->ToComposedValue()->GetValue1());
+        RequireEqualSingleValues(propertyValue1->ToComposedValue()->GetValue2(), propertyValue2->ToComposedValue()->GetValue2());
+      }
+      else
+      {
+        RequireEqualSingleValues(
+          std::dynamic_pointer_cast<ISgfcSinglePropertyValue>(propertyValue1),
+          std::dynamic_pointer_cast<ISgfcSinglePropertyValue>(propertyValue2));
+      }
+    }
+  }
+
+  auto children1 = node1->GetChildren();
+  auto children2 = node2->GetChildren();
+  REQUIRE( children1.size() == children2.size() );
+
+  for (std::size_t childIndex = 0; childIndex < children1.size(); childIndex++)
+  {
+    REQUIRE( children2[childIndex]->GetParent() == node2 );
+    RequireEqualNodes(children1[childIndex], children2[childIndex]);
+  }
+}
+
+void RequireEqualSingleValues(std::shared_ptr<ISgfcSinglePropertyValue> value1, std::shared_ptr<ISgfcSinglePropertyValue> value2)
+{
+  REQUIRE( value1->GetValueType() == value2->GetValueType() );
+  REQUIRE( value1->HasTypedValue() == value2->HasTypedValue() );
+  REQUIRE( value1->GetTypeConversionErrorMessage() == value2->GetTypeConversionErrorMessage() );
+  REQUIRE( value1->GetRawValue() == value2->GetRawValue() );
+
+  REQUIRE( (value1->ToNumberValue() == nullptr) == (value2->ToNumberValue() == nullptr) );
+  REQUIRE( (value1->ToRealValue() == nullptr) == (value2->ToRealValue() == nullptr) );
+  REQUIRE( (value1->ToDoubleValue() == nullptr) == (value2->ToDoubleValue() == nullptr) );
+  REQUIRE( (value1->ToColorValue() == nullptr) == (value2->ToColorValue() == nullptr) );
+  REQUIRE( (value1->ToSimpleTextValue() == nullptr) == (value2->ToSimpleTextValue() == nullptr) );
+  REQUIRE( (value1->ToTextValue() == nullptr) == (value2->ToTextValue() == nullptr) );
+  REQUIRE( (value1->ToPointValue() == nullptr) == (value2->ToPointValue() == nullptr) );
+  REQUIRE( (value1->ToMoveValue() == nullptr) == (value2->ToMoveValue() == nullptr) );
+  REQUIRE( (value1->ToStoneValue() == nullptr) == (value2->ToStoneValue() == nullptr) );
+
+  if (value1->ToNumberValue() != nullptr)
+    REQUIRE( value1->ToNumberValue()->GetNumberValue() == value2->ToNumberValue()->GetNumberValue() );
+  if (value1->ToRealValue() != nullptr)
+    REQUIRE( value1->ToRealValue()->GetRealValue() == value2->ToRealValue()->GetRealValue() );
+  if (value1->ToDoubleValue() != nullptr)
+    REQUIRE( value1->ToDoubleValue()->GetDoubleValue() == value2->ToDoubleValue()->GetDoubleValue() );
+  if (value1->ToColorValue() != nullptr)
+    REQUIRE( value1->ToColorValue()->GetColorValue() == value2->ToColorValue()->GetColorValue() );
+  if (value1->ToSimpleTextValue() != nullptr)
+    REQUIRE( value1->ToSimpleTextValue()->GetSimpleTextValue() == value2->ToSimpleTextValue()->GetSimpleTextValue() );
+  if (value1->ToTextValue() != nullptr)
+    REQUIRE( value1->ToTextValue()->GetTextValue() == value2->ToTextValue()->GetTextValue() );
+
+  if (value1->ToPointValue() != nullptr)
+  {
+    REQUIRE( value1->ToPointValue()->GetPointValue() == value2->ToPointValue()->GetPointValue() );
+    REQUIRE( (value1->ToPointValue()->ToGoPointValue() == nullptr) == (value2->ToPointValue()->ToGoPointValue() == nullptr) );
+    if (value1->ToPointValue()->ToGoPointValue() != nullptr)
+      RequireEqualGoPoints(value1->ToPointValue()->ToGoPointValue()->GetGoPoint(), value2->ToPointValue()->ToGoPointValue()->GetGoPoint());
+  }
+
+  if (value1->ToMoveValue() != nullptr)
+  {
+    REQUIRE( value1->ToMoveValue()->GetMoveValue() == value2->ToMoveValue()->GetMoveValue() );
+    REQUIRE( (value1->ToMoveValue()->ToGoMoveValue() == nullptr) == (value2->ToMoveValue()->ToGoMoveValue() == nullptr) );
+    if (value1->ToMoveValue()->ToGoMoveValue() != nullptr)
+    {
+      auto goMove1 = value1->ToMoveValue()->ToGoMoveValue()->GetGoMove();
+      auto goMove2 = value2->ToMoveValue()->ToGoMoveValue()->GetGoMove();
+      REQUIRE( goMove1->IsPassMove() == goMove2->IsPassMove() );
+      REQUIRE( goMove1->GetPlayerColor() == goMove2->GetPlayerColor() );
+      if (! goMove1->IsPassMove())
+        RequireEqualGoPoints(goMove1->GetStoneLocation(), goMove2->GetStoneLocation());
+    }
+  }
+
+  if (value1->ToStoneValue() != nullptr)
+  {
+    REQUIRE( value1->ToStoneValue()->GetStoneValue() == value2->ToStoneValue()->GetStoneValue() );
+    REQUIRE( (value1->ToStoneValue()->ToGoStoneValue() == nullptr) == (value2->ToStoneValue()->ToGoStoneValue() == nullptr) );
+    if (value1->ToStoneValue()->ToGoStoneValue() != nullptr)
+    {
+      auto goStone1 = value1->ToStoneValue()->ToGoStoneValue()->GetGoStone();
+      auto goStone2 = value2->ToStoneValue()->ToGoStoneValue()->GetGoStone();
+      REQUIRE( goStone1->GetColor() == goStone2->GetColor() );
+      RequireEqualGoPoints(goStone1->GetLocation(), goStone2->GetLocation());
+    }
+  }
+}
+
+void RequireEqualGoPoints(std::shared_ptr<ISgfcGoPoint> goPoint1, std::shared_ptr<ISgfcGoPoint> goPoint2)
+{
+  REQUIRE( goPoint1->GetXPosition(SgfcCoordinateSystem::UpperLeftOrigin) == goPoint2->GetXPosition(SgfcCoordinateSystem::UpperLeftOrigin) );
+  REQUIRE( goPoint1->GetYPosition(SgfcCoordinateSystem::UpperLeftOrigin) == goPoint2->GetYPosition(SgfcCoordinateSystem::UpperLeftOrigin) );
+  REQUIRE( goPoint1->GetXPosition(SgfcCoordinateSystem::LowerLeftOrigin) == goPoint2->GetXPosition(SgfcCoordinateSystem::LowerLeftOrigin) );
+  REQUIRE( goPoint1->GetYPosition(SgfcCoordinateSystem::LowerLeftOrigin) == goPoint2->GetYPosition(SgfcCoordinateSystem::LowerLeftOrigin) );
+
+  for (auto goPointNotation : { SgfcGoPointNotation::Sgf, SgfcGoPointNotation::Figure, SgfcGoPointNotation::Hybrid })
+  {
+    REQUIRE( goPoint1->HasPosition(goPointNotation) == goPoint2->HasPosition(goPointNotation) );
+    if (goPoint1->HasPosition(goPointNotation))
+      REQUIRE( goPoint1->GetPosition(goPointNotation) == goPoint2->GetPosition(goPointNotation) );
+  }
+}
@@ -27,8 +27,13 @@
 #include <document/typedproperty/SgfcBoardSizeProperty.h>
 #include <document/typedproperty/SgfcGameTypeProperty.h>
 #include <ISgfcGoGameInfo.h>
+#include <ISgfcGoMovePropertyValue.h>
+#include <ISgfcGoPosition.h>
+#include <ISgfcGoStonePropertyValue.h>
+#include <ISgfcNumberPropertyValue.h>
 #include <ISgfcPropertyFactory.h>
 #include <ISgfcPropertyValueFactory.h>
+#include <ISgfcTextPropertyValue.h>
 #include <SgfcConstants.h>
 #include <SgfcPlusPlusFactory.h>
 #include <SgfcUtility.h>
@@ -37,6 +42,9 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators_all.hpp>
 
+// C++ Standard Library includes
+#include <thread>
+
 using namespace LibSgfcPlusPlus;
 
 SCENARIO( "SgfcGame is constructed", "[document]" )
@@ -676,6 +684,302 @@ SCENARIO( "SgfcGame is queried for the game info nodes", "[document]" )
   }
 }
 
+SCENARIO( "SgfcGame is queried for nodes with a given property", "[document]" )
+{
+  auto game = std::make_shared<SgfcGame>();
+  SgfcTreeBuilder treeBuilder(game);
+
+  auto rootNode = std::make_shared<SgfcNode>();
+  auto intermediateNode = std::make_shared<SgfcNode>();
+  auto intermediateSiblingNode = std::make_shared<SgfcNode>();
+  auto leafNode = std::make_shared<SgfcNode>();
+
+  game->SetRootNode(rootNode);
+  treeBuilder.SetFirstChild(rootNode, intermediateNode);
+  treeBuilder.SetNextSibling(intermediateNode, intermediateSiblingNode);
+  treeBuilder.SetFirstChild(intermediateNode, leafNode);
+
+  auto commentProperty = std::shared_ptr<ISgfcProperty>(new SgfcProperty(SgfcPropertyType::C, "C"));
+  auto customProperty = std::shared_ptr<ISgfcProperty>(new SgfcProperty(SgfcPropertyType::Unknown, "XY"));
+
+  GIVEN( "SgfcGame has no root node" )
+  {
+    game->SetRootNode(nullptr);
+
+    WHEN( "SgfcGame is queried" )
+    {
+      auto nodesQueriedByType = game->GetNodesWithProperty(SgfcPropertyType::C);
+      auto nodesQueriedByName = game->GetNodesWithProperty("C");
+
+      THEN( "SgfcGame returns an empty collection" )
+      {
+        REQUIRE( nodesQueriedByType.size() == 0 );
+        REQUIRE( nodesQueriedByName.size() == 0 );
+        REQUIRE( game->HasPropertyIndex() == true );
+      }
+    }
+  }
+
+  GIVEN( "SgfcGame has nodes with the property" )
+  {
+    leafNode->SetProperties({commentProperty});
+    intermediateSiblingNode->SetProperties({commentProperty, customProperty});
+
+    WHEN( "SgfcGame is queried" )
+    {
+      REQUIRE( game->HasPropertyIndex() == false );
+      auto nodesQueriedByType = game->GetNodesWithProperty(SgfcPropertyType::C);
+      auto nodesQueriedByName = game->GetNodesWithProperty("C");
+      auto nodesQueriedByCustomName = game->GetNodesWithProperty("XY");
+      auto nodesQueriedByMissingType = game->GetNodesWithProperty(SgfcPropertyType::LB);
+
+      THEN( "SgfcGame builds the property index and returns the nodes in depth-first order" )
+      {
+        REQUIRE( game->HasPropertyIndex() == true );
+        std::vector<std::shared_ptr<ISgfcNode>> expectedNodes = { leafNode, intermediateSiblingNode };
+        REQUIRE( nodesQueriedByType == expectedNodes );
+        REQUIRE( nodesQueriedByName == expectedNodes );
+        REQUIRE( nodesQueriedByCustomName.size() == 1 );
+        REQUIRE( nodesQueriedByCustomName.front() == intermediateSiblingNode );
+        REQUIRE( nodesQueriedByMissingType.size() == 0 );
+      }
+    }
+
+    WHEN( "The properties of a node change after the property index was built" )
+    {
+      game->BuildPropertyIndex();
+      rootNode->SetProperty(commentProperty);
+      intermediateSiblingNode->RemoveProperty(commentProperty);
+
+      THEN( "SgfcGame returns the nodes that currently have the property" )
+      {
+        std::vector<std::shared_ptr<ISgfcNode>> expectedNodes = { rootNode, leafNode };
+        REQUIRE( game->GetNodesWithProperty(SgfcPropertyType::C) == expectedNodes );
+        REQUIRE( game->GetNodesWithProperty("XY").size() == 1 );
+      }
+    }
+
+    WHEN( "The structure of the game tree changes after the property index was built" )
+    {
+      game->BuildPropertyIndex();
+      treeBuilder.RemoveChild(intermediateNode, leafNode);
+      treeBuilder.AppendChild(intermediateSiblingNode, leafNode);
+
+      THEN( "SgfcGame returns the nodes in the new depth-first order" )
+      {
+        std::vector<std::shared_ptr<ISgfcNode>> expectedNodes = { intermediateSiblingNode, leafNode };
+        REQUIRE( game->GetNodesWithProperty(SgfcPropertyType::C) == expectedNodes );
+      }
+    }
+
+    WHEN( "A node with the property is removed from the game tree" )
+    {
+      game->BuildPropertyIndex();
+      treeBuilder.RemoveChild(rootNode, intermediateSiblingNode);
+
+      THEN( "SgfcGame no longer returns the removed node" )
+      {
+        REQUIRE( game->GetNodesWithProperty(SgfcPropertyType::C).size() == 1 );
+        REQUIRE( game->GetNodesWithProperty(SgfcPropertyType::C).front() == leafNode );
+
+        // Changes to the properties of the removed node do not affect the game
+        intermediateSiblingNode->RemoveAllProperties();
+        REQUIRE( game->GetNodesWithProperty(SgfcPropertyType::C).size() == 1 );
+      }
+    }
+
+    WHEN( "A node with the property is moved to the game tree of another game" )
+    {
+      auto otherGame = std::make_shared<SgfcGame>();
+      SgfcTreeBuilder otherTreeBuilder(otherGame);
+      auto otherRootNode = std::make_shared<SgfcNode>();
+      otherGame->SetRootNode(otherRootNode);
+      otherGame->BuildPropertyIndex();
+
+      game->BuildPropertyIndex();
+      otherTreeBuilder.AppendChild(otherRootNode, intermediateSiblingNode);
+
+      THEN( "SgfcGame no longer returns the moved node" )
+      {
+        REQUIRE( game->GetNodesWithProperty(SgfcPropertyType::C).size() == 1 );
+        REQUIRE( game->GetNodesWithProperty(SgfcPropertyType::C).front() == leafNode );
+        REQUIRE( game->GetNodesWithProperty("XY").size() == 0 );
+        REQUIRE( otherGame->GetNodesWithProperty(SgfcPropertyType::C).size() == 1 );
+        REQUIRE( otherGame->GetNodesWithProperty(SgfcPropertyType::C).front() == intermediateSiblingNode );
+      }
+    }
+
+    WHEN( "The property index is discarded" )
+    {
+      game->BuildPropertyIndex();
+      game->DiscardPropertyIndex();
+
+      THEN( "SgfcGame has no property index until it is queried again" )
+      {
+        REQUIRE( game->HasPropertyIndex() == false );
+        leafNode->RemoveAllProperties();
+        REQUIRE( game->GetNodesWithProperty(SgfcPropertyType::C).size() == 1 );
+        REQUIRE( game->HasPropertyIndex() == true );
+      }
+    }
+
+    WHEN( "SgfcGame is queried by several threads at the same time" )
+    {
+      const int numberOfThreads = 4;
+      std::vector<std::vector<std::shared_ptr<ISgfcNode>>> queryResults(numberOfThreads);
+      std::vector<std::thread> threads;
+      for (int indexOfThread = 0; indexOfThread < numberOfThreads; indexOfThread++)
+      {
+        threads.push_back(std::thread([&, indexOfThread]()
+        {
+          queryResults[indexOfThread] = game->GetNodesWithProperty(SgfcPropertyType::C);
+        }));
+      }
+      for (auto& thread : threads)
+        thread.join();
+
+      THEN( "All threads get the same result" )
+      {
+        std::vector<std::shared_ptr<ISgfcNode>> expectedNodes = { leafNode, intermediateSiblingNode };
+        for (const auto& queryResult : queryResults)
+          REQUIRE( queryResult == expectedNodes );
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcGame is queried for the Go moves of a variation", "[document]" )
+{
+  auto game = std::make_shared<SgfcGame>();
+  SgfcTreeBuilder treeBuilder(game);
+  auto propertyFactory = SgfcPlusPlusFactory::CreatePropertyFactory();
+  auto propertyValueFactory = SgfcPlusPlusFactory::CreatePropertyValueFactory();
+  SgfcBoardSize boardSize = SgfcConstants::BoardSizeDefaultGo;
+
+  auto rootNode = std::make_shared<SgfcNode>();
+  auto firstMoveNode = std::make_shared<SgfcNode>();
+  auto secondMoveNode = std::make_shared<SgfcNode>();
+  auto thirdMoveNode = std::make_shared<SgfcNode>();
+  auto variationNode = std::make_shared<SgfcNode>();
+
+  game->SetRootNode(rootNode);
+  treeBuilder.SetFirstChild(rootNode, firstMoveNode);
+  treeBuilder.SetFirstChild(firstMoveNode, secondMoveNode);
+  treeBuilder.SetNextSibling(secondMoveNode, variationNode);
+  treeBuilder.SetFirstChild(secondMoveNode, thirdMoveNode);
+
+  firstMoveNode->SetProperty(propertyFactory->CreateProperty(
+    SgfcPropertyType::B, propertyValueFactory->CreateGoMovePropertyValue("dd", boardSize, SgfcColor::Black)));
+  secondMoveNode->SetProperty(propertyFactory->CreateProperty(
+    SgfcPropertyType::W, propertyValueFactory->CreateGoMovePropertyValue(SgfcColor::White)));
+  thirdMoveNode->SetProperty(propertyFactory->CreateProperty(
+    SgfcPropertyType::B, propertyValueFactory->CreateGoMovePropertyValue("pp", boardSize, SgfcColor::Black)));
+  variationNode->SetProperty(propertyFactory->CreateProperty(
+    SgfcPropertyType::W, propertyValueFactory->CreateGoMovePropertyValue("qc", boardSize, SgfcColor::White)));
+
+  SgfcColor colors[3];
+  unsigned int xPositions[3];
+  unsigned int yPositions[3];
+  bool passMoves[3];
+  SgfcGoMoveBuffers moveBuffers;
+  moveBuffers.Colors = colors;
+  moveBuffers.XPositions = xPositions;
+  moveBuffers.YPositions = yPositions;
+  moveBuffers.PassMoves = passMoves;
+  moveBuffers.Capacity = 3;
+
+  GIVEN( "The main variation is queried" )
+  {
+    WHEN( "The buffers are large enough" )
+    {
+      auto numberOfMoves = game->GetMainVariationGoMoves(moveBuffers);
+
+      THEN( "SgfcGame writes all moves of the main variation" )
+      {
+        REQUIRE( numberOfMoves == 3 );
+        REQUIRE( colors[0] == SgfcColor::Black );
+        REQUIRE( xPositions[0] == 4 );
+        REQUIRE( yPositions[0] == 4 );
+        REQUIRE( passMoves[0] == false );
+        REQUIRE( colors[1] == SgfcColor::White );
+        REQUIRE( xPositions[1] == 0 );
+        REQUIRE( yPositions[1] == 0 );
+        REQUIRE( passMoves[1] == true );
+        REQUIRE( colors[2] == SgfcColor::Black );
+        REQUIRE( xPositions[2] == 16 );
+        REQUIRE( yPositions[2] == 16 );
+        REQUIRE( passMoves[2] == false );
+      }
+    }
+
+    WHEN( "The buffers are too small" )
+    {
+      SgfcGoMoveBuffers emptyMoveBuffers;
+      moveBuffers.Capacity = 1;
+      moveBuffers.CoordinateSystem = SgfcCoordinateSystem::LowerLeftOrigin;
+      passMoves[1] = false;
+
+      THEN( "SgfcGame writes only as many moves as fit into the buffers but returns the total number of moves" )
+      {
+        REQUIRE( game->GetMainVariationGoMoves(emptyMoveBuffers) == 3 );
+        REQUIRE( game->GetMainVariationGoMoves(moveBuffers) == 3 );
+        REQUIRE( xPositions[0] == 4 );
+        REQUIRE( yPositions[0] == 16 );
+        REQUIRE( passMoves[1] == false );
+      }
+    }
+  }
+
+  GIVEN( "A variation other than the main variation is queried" )
+  {
+    WHEN( "The variation is selected with its leaf node" )
+    {
+      auto numberOfMoves = game->GetMainVariationGoMoves(variationNode, moveBuffers);
+
+      THEN( "SgfcGame writes the moves of the variation" )
+      {
+        REQUIRE( numberOfMoves == 2 );
+        REQUIRE( colors[0] == SgfcColor::Black );
+        REQUIRE( xPositions[0] == 4 );
+        REQUIRE( colors[1] == SgfcColor::White );
+        REQUIRE( xPositions[1] == 17 );
+        REQUIRE( yPositions[1] == 3 );
+      }
+    }
+
+    WHEN( "The variation is selected with a node that is not part of the game tree" )
+    {
+      auto otherNode = std::make_shared<SgfcNode>();
+
+      THEN( "SgfcGame throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          game->GetMainVariationGoMoves(otherNode, moveBuffers),
+          std::invalid_argument);
+        REQUIRE_THROWS_AS(
+          game->GetMainVariationGoMoves(nullptr, moveBuffers),
+          std::invalid_argument);
+      }
+    }
+  }
+
+  GIVEN( "The game is not a Go game" )
+  {
+    rootNode->SetProperty(propertyFactory->CreateGameTypeProperty(
+      propertyValueFactory->CreateGameTypePropertyValue(SgfcGameType::Chess)));
+
+    WHEN( "SgfcGame is queried" )
+    {
+      auto numberOfMoves = game->GetMainVariationGoMoves(moveBuffers);
+
+      THEN( "SgfcGame writes no moves" )
+      {
+        REQUIRE( numberOfMoves == 0 );
+      }
+    }
+  }
+}
+
 SCENARIO( "SgfcGame creates an ISgfcGameInfo object", "[document]" )
 {
   auto game = std::make_shared<SgfcGame>();
@@ -924,3 +1228,370 @@ SCENARIO( "SgfcGame writes an ISgfcGameInfo object", "[document]" )
     }
   }
 }
+
+SCENARIO( "SgfcGame is queried for the node changes between two game trees", "[document]" )
+{
+  auto propertyFactory = SgfcPlusPlusFactory::CreatePropertyFactory();
+  auto propertyValueFactory = SgfcPlusPlusFactory::CreatePropertyValueFactory();
+
+  auto createCommentProperty = [&](const std::string& comment) -> std::shared_ptr<ISgfcProperty>
+  {
+    return propertyFactory->CreateProperty(SgfcPropertyType::C, propertyValueFactory->CreateTextPropertyValue(comment));
+  };
+
+  // Creates the game tree "root" -> "1" -> ("2" -> "3", "v") and returns
+  // the nodes in that order
+  auto createGame = [&](std::vector<std::shared_ptr<ISgfcNode>>& nodes) -> std::shared_ptr<SgfcGame>
+  {
+    auto game = std::make_shared<SgfcGame>();
+    SgfcTreeBuilder treeBuilder(game);
+
+    nodes.clear();
+    for (const auto& comment : { "root", "1", "2", "3", "v" })
+    {
+      auto node = std::make_shared<SgfcNode>();
+      node->SetProperty(createCommentProperty(comment));
+      nodes.push_back(node);
+    }
+
+    game->SetRootNode(nodes[0]);
+    treeBuilder.SetFirstChild(nodes[0], nodes[1]);
+    treeBuilder.SetFirstChild(nodes[1], nodes[2]);
+    treeBuilder.SetNextSibling(nodes[2], nodes[4]);
+    treeBuilder.SetFirstChild(nodes[2], nodes[3]);
+
+    return game;
+  };
+
+  GIVEN( "The game trees have the same content" )
+  {
+    std::vector<std::shared_ptr<ISgfcNode>> oldNodes;
+    std::vector<std::shared_ptr<ISgfcNode>> newNodes;
+    auto oldGame = createGame(oldNodes);
+    auto newGame = createGame(newNodes);
+
+    WHEN( "SgfcGame is queried" )
+    {
+      auto nodeChanges = oldGame->GetNodeChanges(newGame);
+
+      THEN( "SgfcGame reports no changes" )
+      {
+        REQUIRE( nodeChanges.size() == 0 );
+        REQUIRE( oldNodes[0]->GetContentHash() == newNodes[0]->GetContentHash() );
+        REQUIRE( oldGame->GetNodeChanges(oldGame).size() == 0 );
+      }
+    }
+  }
+
+  GIVEN( "The properties of a node differ" )
+  {
+    std::vector<std::shared_ptr<ISgfcNode>> oldNodes;
+    std::vector<std::shared_ptr<ISgfcNode>> newNodes;
+    auto oldGame = createGame(oldNodes);
+    auto newGame = createGame(newNodes);
+    newNodes[3]->SetProperty(createCommentProperty("3 changed"));
+
+    WHEN( "SgfcGame is queried" )
+    {
+      auto nodeChanges = oldGame->GetNodeChanges(newGame);
+
+      THEN( "SgfcGame reports the node as changed" )
+      {
+        REQUIRE( nodeChanges.size() == 1 );
+        REQUIRE( nodeChanges[0].ChangeType == SgfcNodeChangeType::Changed );
+        REQUIRE( nodeChanges[0].OldNode == oldNodes[3] );
+        REQUIRE( nodeChanges[0].NewNode == newNodes[3] );
+      }
+    }
+  }
+
+  GIVEN( "A variation was inserted before the other variations" )
+  {
+    std::vector<std::shared_ptr<ISgfcNode>> oldNodes;
+    std::vector<std::shared_ptr<ISgfcNode>> newNodes;
+    auto oldGame = createGame(oldNodes);
+    auto newGame = createGame(newNodes);
+    auto insertedNode = std::make_shared<SgfcNode>();
+    insertedNode->SetProperty(createCommentProperty("inserted"));
+    SgfcTreeBuilder treeBuilder(newGame);
+    treeBuilder.InsertChild(newNodes[1], insertedNode, newNodes[2]);
+
+    WHEN( "SgfcGame is queried" )
+    {
+      auto nodeChanges = oldGame->GetNodeChanges(newGame);
+
+      THEN( "SgfcGame reports only the inserted node as added" )
+      {
+        REQUIRE( nodeChanges.size() == 1 );
+        REQUIRE( nodeChanges[0].ChangeType == SgfcNodeChangeType::Added );
+        REQUIRE( nodeChanges[0].OldNode == nullptr );
+        REQUIRE( nodeChanges[0].NewNode == insertedNode );
+      }
+    }
+  }
+
+  GIVEN( "Nodes were added, removed and changed" )
+  {
+    std::vector<std::shared_ptr<ISgfcNode>> oldNodes;
+    std::vector<std::shared_ptr<ISgfcNode>> newNodes;
+    auto oldGame = createGame(oldNodes);
+    auto newGame = createGame(newNodes);
+    auto appendedNode = std::make_shared<SgfcNode>();
+    SgfcTreeBuilder treeBuilder(newGame);
+    treeBuilder.RemoveChild(newNodes[1], newNodes[4]);
+    treeBuilder.AppendChild(newNodes[3], appendedNode);
+    newNodes[0]->SetProperty(createCommentProperty("root changed"));
+
+    WHEN( "SgfcGame is queried" )
+    {
+      auto nodeChanges = oldGame->GetNodeChanges(newGame);
+
+      THEN( "SgfcGame reports the changes in depth-first order" )
+      {
+        REQUIRE( nodeChanges.size() == 3 );
+        REQUIRE( nodeChanges[0].ChangeType == SgfcNodeChangeType::Changed );
+        REQUIRE( nodeChanges[0].OldNode == oldNodes[0] );
+        REQUIRE( nodeChanges[0].NewNode == newNodes[0] );
+        REQUIRE( nodeChanges[1].ChangeType == SgfcNodeChangeType::Added );
+        REQUIRE( nodeChanges[1].OldNode == nullptr );
+        REQUIRE( nodeChanges[1].NewNode == appendedNode );
+        REQUIRE( nodeChanges[2].ChangeType == SgfcNodeChangeType::Removed );
+        REQUIRE( nodeChanges[2].OldNode == oldNodes[4] );
+        REQUIRE( nodeChanges[2].NewNode == nullptr );
+      }
+    }
+  }
+
+  GIVEN( "Only one of the games has a root node" )
+  {
+    std::vector<std::shared_ptr<ISgfcNode>> nodes;
+    auto game = createGame(nodes);
+    auto gameWithoutRootNode = std::make_shared<SgfcGame>();
+
+    WHEN( "SgfcGame is queried" )
+    {
+      auto nodeChangesAdded = gameWithoutRootNode->GetNodeChanges(game);
+      auto nodeChangesRemoved = game->GetNodeChanges(gameWithoutRootNode);
+
+      THEN( "SgfcGame reports the root node as added or removed" )
+      {
+        REQUIRE( nodeChangesAdded.size() == 1 );
+        REQUIRE( nodeChangesAdded[0].ChangeType == SgfcNodeChangeType::Added );
+        REQUIRE( nodeChangesAdded[0].NewNode == nodes[0] );
+        REQUIRE( nodeChangesRemoved.size() == 1 );
+        REQUIRE( nodeChangesRemoved[0].ChangeType == SgfcNodeChangeType::Removed );
+        REQUIRE( nodeChangesRemoved[0].OldNode == nodes[0] );
+        REQUIRE( gameWithoutRootNode->GetNodeChanges(std::make_shared<SgfcGame>()).size() == 0 );
+      }
+    }
+  }
+
+  GIVEN( "SgfcGame is queried with invalid data" )
+  {
+    auto game = std::make_shared<SgfcGame>();
+
+    WHEN( "SgfcGame is queried" )
+    {
+      THEN( "The query throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          game->GetNodeChanges(nullptr),
+          std::invalid_argument);
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcGame is queried for the Go position at a node", "[document]" )
+{
+  auto game = std::make_shared<SgfcGame>();
+  SgfcTreeBuilder treeBuilder(game);
+  auto propertyFactory = SgfcPlusPlusFactory::CreatePropertyFactory();
+  auto propertyValueFactory = SgfcPlusPlusFactory::CreatePropertyValueFactory();
+  SgfcBoardSize boardSize = SgfcConstants::BoardSizeDefaultGo;
+
+  auto rootNode = std::make_shared<SgfcNode>();
+  auto firstMoveNode = std::make_shared<SgfcNode>();
+  auto secondMoveNode = std::make_shared<SgfcNode>();
+  auto thirdMoveNode = std::make_shared<SgfcNode>();
+  auto variationNode = std::make_shared<SgfcNode>();
+
+  game->SetRootNode(rootNode);
+  treeBuilder.SetFirstChild(rootNode, firstMoveNode);
+  treeBuilder.SetFirstChild(firstMoveNode, secondMoveNode);
+  treeBuilder.SetNextSibling(secondMoveNode, variationNode);
+  treeBuilder.SetFirstChild(secondMoveNode, thirdMoveNode);
+
+  rootNode->SetProperty(propertyFactory->CreateProperty(
+    SgfcPropertyType::AB, propertyValueFactory->CreateGoStonePropertyValue("jj", boardSize, SgfcColor::Black)));
+  firstMoveNode->SetProperty(propertyFactory->CreateProperty(
+    SgfcPropertyType::W, propertyValueFactory->CreateGoMovePropertyValue("dd", boardSize, SgfcColor::White)));
+  secondMoveNode->SetProperty(propertyFactory->CreateProperty(
+    SgfcPropertyType::B, propertyValueFactory->CreateGoMovePropertyValue("pp", boardSize, SgfcColor::Black)));
+  thirdMoveNode->SetProperty(propertyFactory->CreateProperty(
+    SgfcPropertyType::W, propertyValueFactory->CreateGoMovePropertyValue("pd", boardSize, SgfcColor::White)));
+  variationNode->SetProperty(propertyFactory->CreateProperty(
+    SgfcPropertyType::B, propertyValueFactory->CreateGoMovePropertyValue("dp", boardSize, SgfcColor::Black)));
+
+  std::size_t checkpointInterval = GENERATE( 1, 2, 16 );
+  std::size_t maximumNumberOfCheckpoints = GENERATE( 0, 1, 1024 );
+  game->ConfigureGoPositionCheckpoints(checkpointInterval, maximumNumberOfCheckpoints);
+
+  GIVEN( "The position is queried at different nodes" )
+  {
+    WHEN( "The nodes are queried in any order" )
+    {
+      auto thirdMovePosition = game->GetGoPosition(thirdMoveNode);
+      auto variationPosition = game->GetGoPosition(variationNode);
+      auto rootPosition = game->GetGoPosition(rootNode);
+      auto thirdMovePositionAgain = game->GetGoPosition(thirdMoveNode);
+
+      THEN( "The positions reflect the nodes on the path from the root node" )
+      {
+        REQUIRE( rootPosition->GetNumberOfStones(SgfcColor::Black) == 1 );
+        REQUIRE( rootPosition->GetNumberOfStones(SgfcColor::White) == 0 );
+
+        REQUIRE( thirdMovePosition->GetNumberOfStones(SgfcColor::Black) == 2 );
+        REQUIRE( thirdMovePosition->GetNumberOfStones(SgfcColor::White) == 2 );
+        REQUIRE( thirdMovePosition->GetStoneColor(16, 16) == SgfcColor::Black );
+        REQUIRE( thirdMovePosition->GetStoneColor(16, 4) == SgfcColor::White );
+        REQUIRE( thirdMovePosition->HasStone(4, 16) == false );
+
+        REQUIRE( variationPosition->GetNumberOfStones(SgfcColor::Black) == 2 );
+        REQUIRE( variationPosition->GetNumberOfStones(SgfcColor::White) == 1 );
+        REQUIRE( variationPosition->GetStoneColor(4, 16) == SgfcColor::Black );
+        REQUIRE( variationPosition->HasStone(16, 16) == false );
+
+        REQUIRE( thirdMovePositionAgain->IsSameBoard(*thirdMovePosition) == true );
+      }
+    }
+
+    WHEN( "The nodes are queried by several threads at the same time" )
+    {
+      const int numberOfThreads = 4;
+      std::vector<std::shared_ptr<ISgfcGoPosition>> positions(numberOfThreads);
+      std::vector<std::thread> threads;
+      for (int indexOfThread = 0; indexOfThread < numberOfThreads; indexOfThread++)
+      {
+        threads.push_back(std::thread([&, indexOfThread]()
+        {
+          positions[indexOfThread] = game->GetGoPosition(indexOfThread % 2 == 0 ? thirdMoveNode : variationNode);
+        }));
+      }
+      for (auto& thread : threads)
+        thread.join();
+
+      THEN( "All threads get the correct position" )
+      {
+        for (int indexOfThread = 0; indexOfThread < numberOfThreads; indexOfThread++)
+        {
+          auto expectedPosition = game->GetGoPosition(indexOfThread % 2 == 0 ? thirdMoveNode : variationNode);
+          REQUIRE( positions[indexOfThread]->IsSameBoard(*expectedPosition) == true );
+        }
+      }
+    }
+  }
+
+  GIVEN( "The game tree changes after a query" )
+  {
+    auto positionBeforeChange = game->GetGoPosition(thirdMoveNode);
+    REQUIRE( positionBeforeChange->HasStone(16, 16) == true );
+
+    WHEN( "The properties of a node on the path change" )
+    {
+      secondMoveNode->SetProperty(propertyFactory->CreateProperty(
+        SgfcPropertyType::B, propertyValueFactory->CreateGoMovePropertyValue("qq", boardSize, SgfcColor::Black)));
+
+      THEN( "The position reflects the changed properties" )
+      {
+        auto positionAfterChange = game->GetGoPosition(thirdMoveNode);
+        REQUIRE( positionAfterChange->HasStone(16, 16) == false );
+        REQUIRE( positionAfterChange->GetStoneColor(17, 17) == SgfcColor::Black );
+      }
+    }
+
+    WHEN( "The structure of the game tree changes" )
+    {
+      treeBuilder.RemoveChild(firstMoveNode, secondMoveNode);
+      treeBuilder.SetFirstChild(firstMoveNode, thirdMoveNode);
+
+      THEN( "The position reflects the changed game tree" )
+      {
+        auto positionAfterChange = game->GetGoPosition(thirdMoveNode);
+        REQUIRE( positionAfterChange->HasStone(16, 16) == false );
+        REQUIRE( positionAfterChange->GetStoneColor(16, 4) == SgfcColor::White );
+      }
+    }
+
+    WHEN( "A node on the path is moved to the game tree of another game" )
+    {
+      auto otherGame = std::make_shared<SgfcGame>();
+      SgfcTreeBuilder otherTreeBuilder(otherGame);
+      auto otherRootNode = std::make_shared<SgfcNode>();
+      otherGame->SetRootNode(otherRootNode);
+
+      otherTreeBuilder.AppendChild(otherRootNode, secondMoveNode);
+
+      THEN( "The moved nodes are no longer part of the game tree" )
+      {
+        REQUIRE_THROWS_AS(
+          game->GetGoPosition(thirdMoveNode),
+          std::invalid_argument);
+        REQUIRE( game->GetGoPosition(variationNode)->GetNumberOfStones(SgfcColor::Black) == 2 );
+      }
+    }
+
+    WHEN( "The checkpoints are discarded" )
+    {
+      game->DiscardGoPositionCheckpoints();
+
+      THEN( "The position is the same as before" )
+      {
+        REQUIRE( game->GetGoPosition(thirdMoveNode)->IsSameBoard(*positionBeforeChange) == true );
+      }
+    }
+  }
+
+  GIVEN( "The game is not a Go game" )
+  {
+    rootNode->SetProperty(propertyFactory->CreateProperty(
+      SgfcPropertyType::GM, propertyValueFactory->CreateNumberPropertyValue(2)));
+
+    WHEN( "The position is queried" )
+    {
+      auto position = game->GetGoPosition(thirdMoveNode);
+
+      THEN( "The query returns nullptr" )
+      {
+        REQUIRE( position == nullptr );
+      }
+    }
+  }
+
+  GIVEN( "The position is queried with invalid data" )
+  {
+    auto nodeNotInGameTree = std::make_shared<SgfcNode>();
+    auto childOfNodeNotInGameTree = std::make_shared<SgfcNode>();
+    SgfcTreeBuilder otherTreeBuilder(std::make_shared<SgfcGame>());
+    otherTreeBuilder.SetFirstChild(nodeNotInGameTree, childOfNodeNotInGameTree);
+
+    WHEN( "The query is invoked" )
+    {
+      THEN( "The query throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          game->GetGoPosition(nullptr),
+          std::invalid_argument);
+        REQUIRE_THROWS_AS(
+          game->GetGoPosition(nodeNotInGameTree),
+          std::invalid_argument);
+        REQUIRE_THROWS_AS(
+          game->GetGoPosition(childOfNodeNotInGameTree),
+          std::invalid_argument);
+        REQUIRE_THROWS_AS(
+          game->ConfigureGoPositionCheckpoints(0, maximumNumberOfCheckpoints),
+          std::invalid_argument);
+      }
+    }
+  }
+}
@@ -19,8 +19,14 @@
 #include "../SetupHelperFunctions.h"
 
 // Library includes
+#include <ISgfcComposedPropertyValue.h>
 #include <ISgfcGameInfo.h>
+#include <ISgfcPropertyFactory.h>
+#include <ISgfcPropertyValueFactory.h>
+#include <ISgfcSimpleTextPropertyValue.h>
+#include <ISgfcTextPropertyValue.h>
 #include <SgfcConstants.h>
+#include <SgfcPlusPlusFactory.h>
 #include <document/SgfcGame.h>
 #include <document/SgfcNode.h>
 #include <document/SgfcProperty.h>
@@ -31,6 +37,10 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators_range.hpp>
 
+// C++ Standard Library includes
+#include <thread>
+#include <vector>
+
 using namespace LibSgfcPlusPlus;
 
 SCENARIO( "SgfcNode is constructed", "[document]" )
@@ -647,6 +657,9 @@ SCENARIO( "A property is removed from SgfcNode", "[document]" )
         REQUIRE( propertyList.back() != propertyToRemove );
         propertyList.push_back(propertyToRemove);
         REQUIRE( propertyList == initialPropertyList );
+        REQUIRE( node.HasProperty(SgfcPropertyType::B) == false );
+        REQUIRE( node.GetProperty(SgfcPropertyType::B) == nullptr );
+        REQUIRE( node.GetProperty(SgfcPropertyType::SZ) == initialPropertyList[1] );
       }
     }
   }
@@ -710,6 +723,9 @@ SCENARIO( "A property is removed from SgfcNode", "[document]" )
       {
         REQUIRE( node.HasProperties() == true );
         REQUIRE( node.GetProperties().size() == 1 );
+        REQUIRE( node.HasProperty(SgfcPropertyType::GM) == false );
+        REQUIRE( node.HasProperty(SgfcPropertyType::SZ) == true );
+        REQUIRE( node.GetProperty(SgfcPropertyType::SZ) == initialPropertyList[1] );
       }
     }
   }
@@ -753,6 +769,8 @@ SCENARIO( "All properties are removed from SgfcNode", "[document]" )
       {
         REQUIRE( node.HasProperties() == false );
         REQUIRE( node.GetProperties().size() == 0 );
+        REQUIRE( node.HasProperty(SgfcPropertyType::GM) == false );
+        REQUIRE( node.GetProperty(SgfcPropertyType::GM) == nullptr );
       }
     }
   }
@@ -782,6 +800,7 @@ SCENARIO( "SgfcNode is queried for properties", "[document]" )
   {
     WHEN( "SgfcNode is queried for properties" )
     {
+      auto hasPropertyQueriedByType = node->HasProperty(SgfcPropertyType::HA);
       auto propertyQueriedByType = node->GetProperty(SgfcPropertyType::HA);
       auto propertyQueriedByName = node->GetProperty("HA");
       auto propertiesQueriedByCategory = node->GetProperties(SgfcPropertyCategory::GameInfo);
@@ -789,6 +808,7 @@ SCENARIO( "SgfcNode is queried for properties", "[document]" )
 
       THEN( "SgfcNode returns nullptr" )
       {
+        REQUIRE( hasPropertyQueriedByType == false );
         REQUIRE( propertyQueriedByType == nullptr );
         REQUIRE( propertyQueriedByName == nullptr );
         REQUIRE( propertiesQueriedByCategory.size() == 0 );
@@ -809,6 +829,7 @@ SCENARIO( "SgfcNode is queried for properties", "[document]" )
 
     WHEN( "SgfcNode is queried for properties that it contains" )
     {
+      auto hasPropertyQueriedByType = node->HasProperty(SgfcPropertyType::SZ);
       auto propertyQueriedByType = node->GetProperty(SgfcPropertyType::SZ);
       auto propertyQueriedByName = node->GetProperty("HA");
       auto propertiesQueriedByCategory = node->GetProperties(SgfcPropertyCategory::Root);
@@ -816,6 +837,7 @@ SCENARIO( "SgfcNode is queried for properties", "[document]" )
 
       THEN( "SgfcNode returns the properties" )
       {
+        REQUIRE( hasPropertyQueriedByType == true );
         REQUIRE( propertyQueriedByType->GetPropertyType() == SgfcPropertyType::SZ );
         REQUIRE( propertyQueriedByType->GetPropertyName() == "HA" );
         REQUIRE( propertyQueriedByType == properties.back() );
@@ -832,6 +854,7 @@ SCENARIO( "SgfcNode is queried for properties", "[document]" )
 
     WHEN( "SgfcNode is queried for properties that it does not contain" )
     {
+      auto hasPropertyQueriedByType = node->HasProperty(SgfcPropertyType::HA);
       auto propertyQueriedByType = node->GetProperty(SgfcPropertyType::HA);
       auto propertyQueriedByName = node->GetProperty("SZ");
       auto propertiesQueriedByCategory = node->GetProperties(SgfcPropertyCategory::GameInfo);
@@ -839,6 +862,7 @@ SCENARIO( "SgfcNode is queried for properties", "[document]" )
 
       THEN( "SgfcNode returns nullptr" )
       {
+        REQUIRE( hasPropertyQueriedByType == false );
         REQUIRE( propertyQueriedByType == nullptr );
         REQUIRE( propertyQueriedByName == nullptr );
         REQUIRE( propertiesQueriedByCategory.size() == 0 );
@@ -859,6 +883,7 @@ SCENARIO( "SgfcNode is queried for properties", "[document]" )
 
     WHEN( "SgfcNode is queried for custom properties" )
     {
+      auto hasPropertyQueriedByType = node->HasProperty(SgfcPropertyType::Unknown);
       auto propertyQueriedByType = node->GetProperty(SgfcPropertyType::Unknown);
       auto propertyQueriedByName = node->GetProperty("BB");
       auto propertiesQueriedByCategory = node->GetProperties(SgfcPropertyCategory::Miscellaneous);
@@ -866,6 +891,7 @@ SCENARIO( "SgfcNode is queried for properties", "[document]" )
 
       THEN( "SgfcNode returns the properties" )
       {
+        REQUIRE( hasPropertyQueriedByType == true );
         REQUIRE( propertyQueriedByType->GetPropertyType() == SgfcPropertyType::Unknown );
         REQUIRE( propertyQueriedByType->GetPropertyName() == "AA" );
         REQUIRE( propertyQueriedByType == properties.front() );
@@ -1632,3 +1658,270 @@ SCENARIO( "SgfcNode writes an ISgfcGameInfo object", "[document]" )
   }
 }
 
+
+SCENARIO( "SgfcNode tracks modifications of its subtree", "[document]" )
+{
+  GIVEN( "SgfcNode was newly constructed" )
+  {
+    auto otherNode = std::make_shared<SgfcNode>();
+    auto node = std::make_shared<SgfcNode>();
+
+    WHEN( "SgfcNode is queried for its modification state" )
+    {
+      THEN( "SgfcNode is modified and has a unique generation" )
+      {
+        REQUIRE( node->IsSubtreeModified() == true );
+        REQUIRE( node->GetSubtreeGeneration() == node->GetPropertiesGeneration() );
+        REQUIRE( node->GetSubtreeGeneration() != otherNode->GetSubtreeGeneration() );
+      }
+    }
+  }
+
+  GIVEN( "The modification flags of all nodes were cleared" )
+  {
+    auto game = std::make_shared<SgfcGame>();
+    SgfcTreeBuilder treeBuilder(game);
+
+    auto rootNode = std::make_shared<SgfcNode>();
+    game->SetRootNode(rootNode);
+    auto middleNode = std::make_shared<SgfcNode>();
+    treeBuilder.AppendChild(rootNode, middleNode);
+    auto leafNode = std::make_shared<SgfcNode>();
+    treeBuilder.AppendChild(middleNode, leafNode);
+
+    rootNode->ClearSubtreeModified();
+    middleNode->ClearSubtreeModified();
+    leafNode->ClearSubtreeModified();
+
+    auto rootSubtreeGeneration = rootNode->GetSubtreeGeneration();
+    auto rootPropertiesGeneration = rootNode->GetPropertiesGeneration();
+    auto middleSubtreeGeneration = middleNode->GetSubtreeGeneration();
+    auto middlePropertiesGeneration = middleNode->GetPropertiesGeneration();
+    auto leafSubtreeGeneration = leafNode->GetSubtreeGeneration();
+    auto leafPropertiesGeneration = leafNode->GetPropertiesGeneration();
+
+    WHEN( "The properties of the leaf node are modified" )
+    {
+      leafNode->AppendProperty(std::shared_ptr<ISgfcProperty>(new SgfcProperty(SgfcPropertyType::C, "C")));
+
+      THEN( "The leaf node and all of its ancestors are modified" )
+      {
+        REQUIRE( leafNode->IsSubtreeModified() == true );
+        REQUIRE( middleNode->IsSubtreeModified() == true );
+        REQUIRE( rootNode->IsSubtreeModified() == true );
+        REQUIRE( leafNode->GetPropertiesGeneration() != leafPropertiesGeneration );
+        REQUIRE( leafNode->GetSubtreeGeneration() != leafSubtreeGeneration );
+        REQUIRE( middleNode->GetPropertiesGeneration() == middlePropertiesGeneration );
+        REQUIRE( middleNode->GetSubtreeGeneration() != middleSubtreeGeneration );
+        REQUIRE( rootNode->GetPropertiesGeneration() == rootPropertiesGeneration );
+        REQUIRE( rootNode->GetSubtreeGeneration() != rootSubtreeGeneration );
+      }
+    }
+
+    WHEN( "The leaf node is removed" )
+    {
+      treeBuilder.RemoveChild(middleNode, leafNode);
+
+      THEN( "The former parent node and all of its ancestors are modified" )
+      {
+        REQUIRE( leafNode->IsSubtreeModified() == false );
+        REQUIRE( leafNode->GetSubtreeGeneration() == leafSubtreeGeneration );
+        REQUIRE( middleNode->IsSubtreeModified() == true );
+        REQUIRE( middleNode->GetPropertiesGeneration() == middlePropertiesGeneration );
+        REQUIRE( middleNode->GetSubtreeGeneration() != middleSubtreeGeneration );
+        REQUIRE( rootNode->IsSubtreeModified() == true );
+        REQUIRE( rootNode->GetSubtreeGeneration() != rootSubtreeGeneration );
+      }
+    }
+  }
+
+  GIVEN( "Only the modification flags of the root node and the leaf node were cleared" )
+  {
+    auto game = std::make_shared<SgfcGame>();
+    SgfcTreeBuilder treeBuilder(game);
+
+    auto rootNode = std::make_shared<SgfcNode>();
+    game->SetRootNode(rootNode);
+    auto middleNode = std::make_shared<SgfcNode>();
+    treeBuilder.AppendChild(rootNode, middleNode);
+    auto leafNode = std::make_shared<SgfcNode>();
+    treeBuilder.AppendChild(middleNode, leafNode);
+
+    rootNode->ClearSubtreeModified();
+    leafNode->ClearSubtreeModified();
+    auto rootSubtreeGeneration = rootNode->GetSubtreeGeneration();
+
+    WHEN( "The properties of the leaf node are modified" )
+    {
+      leafNode->AppendProperty(std::shared_ptr<ISgfcProperty>(new SgfcProperty(SgfcPropertyType::C, "C")));
+
+      THEN( "The ancestors are not marked again" )
+      {
+        // The middle node is still modified, so the walk up the game tree
+        // stops there
+        REQUIRE( middleNode->IsSubtreeModified() == true );
+        REQUIRE( middleNode->GetSubtreeGeneration() == leafNode->GetSubtreeGeneration() );
+        REQUIRE( rootNode->IsSubtreeModified() == false );
+        REQUIRE( rootNode->GetSubtreeGeneration() == rootSubtreeGeneration );
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcNode computes the content hash of its subtree", "[document]" )
+{
+  auto propertyFactory = SgfcPlusPlusFactory::CreatePropertyFactory();
+  auto propertyValueFactory = SgfcPlusPlusFactory::CreatePropertyValueFactory();
+
+  auto createCommentProperty = [&](const std::string& comment) -> std::shared_ptr<ISgfcProperty>
+  {
+    return propertyFactory->CreateProperty(SgfcPropertyType::C, propertyValueFactory->CreateTextPropertyValue(comment));
+  };
+
+  GIVEN( "Nodes without child nodes" )
+  {
+    auto node = std::make_shared<SgfcNode>();
+    auto otherNode = std::make_shared<SgfcNode>();
+    auto gameNameProperty = propertyFactory->CreateProperty(SgfcPropertyType::GN, propertyValueFactory->CreateSimpleTextPropertyValue("foo"));
+
+    WHEN( "The nodes have the same properties in a different order" )
+    {
+      node->SetProperties({ createCommentProperty("bar"), gameNameProperty });
+      otherNode->SetProperties({ gameNameProperty, createCommentProperty("bar") });
+
+      THEN( "The nodes have the same hash" )
+      {
+        REQUIRE( node->GetContentHash() == otherNode->GetContentHash() );
+        REQUIRE( node->GetPropertiesHash() == otherNode->GetPropertiesHash() );
+      }
+    }
+
+    WHEN( "The nodes have properties with different values" )
+    {
+      node->SetProperties({ createCommentProperty("bar") });
+      otherNode->SetProperties({ createCommentProperty("baz") });
+
+      THEN( "The nodes have different hashes" )
+      {
+        REQUIRE( node->GetContentHash() != otherNode->GetContentHash() );
+      }
+    }
+
+    WHEN( "The nodes have the same raw values in a single and in a composed value" )
+    {
+      node->SetProperties({ propertyFactory->CreateProperty(
+        SgfcPropertyType::AP, propertyValueFactory->CreateSimpleTextPropertyValue("foo:bar")) });
+      otherNode->SetProperties({ propertyFactory->CreateProperty(
+        SgfcPropertyType::AP, propertyValueFactory->CreateComposedSimpleTextAndSimpleTextPropertyValue("foo", "bar")) });
+
+      THEN( "The nodes have different hashes" )
+      {
+        REQUIRE( node->GetContentHash() != otherNode->GetContentHash() );
+      }
+    }
+  }
+
+  GIVEN( "The hash of a game tree was computed" )
+  {
+    auto game = std::make_shared<SgfcGame>();
+    SgfcTreeBuilder treeBuilder(game);
+
+    auto rootNode = std::make_shared<SgfcNode>();
+    game->SetRootNode(rootNode);
+    auto middleNode = std::make_shared<SgfcNode>();
+    treeBuilder.AppendChild(rootNode, middleNode);
+    auto leafNode = std::make_shared<SgfcNode>();
+    treeBuilder.AppendChild(middleNode, leafNode);
+    leafNode->SetProperty(createCommentProperty("foo"));
+
+    // The new nodes are all modified. Computing the hash must clear the
+    // modification flags, otherwise the following modifications would not
+    // reach the root node.
+    auto rootContentHash = rootNode->GetContentHash();
+    auto middleContentHash = middleNode->GetContentHash();
+    auto leafContentHash = leafNode->GetContentHash();
+
+    WHEN( "The properties of the leaf node are modified" )
+    {
+      leafNode->SetProperty(createCommentProperty("bar"));
+
+      THEN( "The hashes of the leaf node and of all of its ancestors change" )
+      {
+        REQUIRE( rootNode->IsSubtreeModified() == true );
+        REQUIRE( leafNode->GetContentHash() != leafContentHash );
+        REQUIRE( middleNode->GetContentHash() != middleContentHash );
+        REQUIRE( rootNode->GetContentHash() != rootContentHash );
+        REQUIRE( rootNode->IsSubtreeModified() == false );
+      }
+
+      THEN( "The hashes are restored when the modification is reverted" )
+      {
+        REQUIRE( rootNode->GetContentHash() != rootContentHash );
+        leafNode->SetProperty(createCommentProperty("foo"));
+        REQUIRE( rootNode->GetContentHash() == rootContentHash );
+      }
+    }
+
+    WHEN( "A child node is added to the leaf node" )
+    {
+      treeBuilder.AppendChild(leafNode, std::make_shared<SgfcNode>());
+
+      THEN( "The hashes of the leaf node and of all of its ancestors change" )
+      {
+        REQUIRE( leafNode->GetContentHash() != leafContentHash );
+        REQUIRE( middleNode->GetContentHash() != middleContentHash );
+        REQUIRE( rootNode->GetContentHash() != rootContentHash );
+      }
+    }
+  }
+
+  GIVEN( "A deep game tree" )
+  {
+    auto game = std::make_shared<SgfcGame>();
+    SgfcTreeBuilder treeBuilder(game);
+
+    auto rootNode = std::make_shared<SgfcNode>();
+    game->SetRootNode(rootNode);
+    std::shared_ptr<ISgfcNode> deepestNode = rootNode;
+    for (int nodeNumber = 0; nodeNumber < 10000; nodeNumber++)
+    {
+      auto childNode = std::make_shared<SgfcNode>();
+      treeBuilder.AppendChild(deepestNode, childNode);
+      deepestNode = childNode;
+    }
+
+    WHEN( "The hash is computed" )
+    {
+      auto rootContentHash = rootNode->GetContentHash();
+
+      THEN( "The hash changes when the deepest node is modified" )
+      {
+        deepestNode->SetProperty(createCommentProperty("foo"));
+        REQUIRE( rootNode->GetContentHash() != rootContentHash );
+      }
+    }
+
+    WHEN( "The hash is computed by several threads at the same time" )
+    {
+      const int numberOfThreads = 4;
+      std::vector<std::uint64_t> contentHashes(numberOfThreads);
+      std::vector<std::thread> threads;
+      for (int indexOfThread = 0; indexOfThread < numberOfThreads; indexOfThread++)
+      {
+        threads.push_back(std::thread([&, indexOfThread]()
+        {
+          contentHashes[indexOfThread] = rootNode->GetContentHash();
+        }));
+      }
+      for (auto& thread : threads)
+        thread.join();
+
+      THEN( "All threads get the same hash" )
+      {
+        for (auto contentHash : contentHashes)
+          REQUIRE( contentHash == rootNode->GetContentHash() );
+        REQUIRE( rootNode->IsSubtreeModified() == false );
+      }
+    }
+  }
+}
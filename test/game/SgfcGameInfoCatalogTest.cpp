@@ -0,0 +1,341 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Library includes
+#include <game/SgfcGameInfoCatalogWriter.h>
+#include <ISgfcGame.h>
+#include <ISgfcGameInfoCatalog.h>
+#include <ISgfcGameInfoCatalogWriter.h>
+#include <ISgfcGoGameInfo.h>
+#include <SgfcPlusPlusFactory.h>
+#include <SgfcUtility.h>
+
+// Unit test library includes
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+
+// C++ Standard Library includes
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+using namespace LibSgfcPlusPlus;
+
+std::shared_ptr<ISgfcGame> CreateCatalogGame(
+  const SgfcSimpleText& blackPlayerName,
+  const SgfcSimpleText& whitePlayerName,
+  const std::vector<SgfcDate>& gameDates,
+  const SgfcSimpleText& gameResult,
+  SgfcReal komi,
+  const SgfcSimpleText& rulesName);
+
+SCENARIO( "SgfcGameInfoCatalogWriter is constructed", "[game]" )
+{
+  GIVEN( "The factory method is used" )
+  {
+    WHEN( "SgfcGameInfoCatalogWriter is constructed" )
+    {
+      auto gameInfoCatalogWriter = SgfcPlusPlusFactory::CreateGameInfoCatalogWriter();
+
+      THEN( "SgfcGameInfoCatalogWriter is constructed successfully" )
+      {
+        REQUIRE( gameInfoCatalogWriter->GetNumberOfThreads() == 0 );
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcGameInfoCatalog finds games", "[game]" )
+{
+  auto game0 = CreateCatalogGame("Lee Sedol", "AlphaGo", { { 2016, 3, 9 } }, "B+R", 7.5, "Chinese");
+  auto game1 = CreateCatalogGame("AlphaGo", "Lee Sedol", { { 2016, 3, 10 } }, "W+R", 7.5, "Chinese");
+  auto game2 = CreateCatalogGame("Ke Jie", "Lee Sedol", { { 2019, 5, 0 } }, "B+2.5", 6.5, "Japanese");
+  auto game3 = CreateCatalogGame("", "", {}, "", 0.0, "");
+
+  std::vector<std::string> filePaths = { "a.sgf", "b.sgf" };
+  std::vector<std::vector<SgfcGameInfoCatalogEntry>> entriesPerFile =
+  {
+    { SgfcGameInfoCatalogWriter::CreateEntry(*game0, 0), SgfcGameInfoCatalogWriter::CreateEntry(*game1, 1) },
+    { SgfcGameInfoCatalogWriter::CreateEntry(*game2, 0), SgfcGameInfoCatalogWriter::CreateEntry(*game3, 1) },
+  };
+
+  std::string catalogFilePath = SgfcUtility::GetUniqueTempFilePath();
+  SgfcGameInfoCatalogWriter::WriteCatalogFile(catalogFilePath, filePaths, entriesPerFile);
+
+  auto gameInfoCatalog = SgfcPlusPlusFactory::CreateGameInfoCatalog(catalogFilePath);
+
+  GIVEN( "The catalog was written" )
+  {
+    WHEN( "An entry is read back" )
+    {
+      auto entry = gameInfoCatalog->GetEntry(2);
+
+      THEN( "The entry contains the game information of the game" )
+      {
+        REQUIRE( gameInfoCatalog->GetNumberOfGames() == 4 );
+        REQUIRE( entry.FilePath == "b.sgf" );
+        REQUIRE( entry.GameIndex == 0 );
+        REQUIRE( entry.BlackPlayerName == "Ke Jie" );
+        REQUIRE( entry.WhitePlayerName == "Lee Sedol" );
+        REQUIRE( entry.FirstGameDate == SgfcDate { 2019, 5, 0 } );
+        REQUIRE( entry.LastGameDate == SgfcDate { 2019, 5, 0 } );
+        REQUIRE( entry.GameResult.IsValid == true );
+        REQUIRE( entry.GameResult.GameResultType == SgfcGameResultType::BlackWin );
+        REQUIRE( entry.GameResult.WinType == SgfcWinType::WinWithScore );
+        REQUIRE( entry.GameResult.Score == 2.5 );
+        REQUIRE( entry.Komi == 6.5 );
+        REQUIRE( entry.RulesName == "Japanese" );
+      }
+    }
+
+    WHEN( "An entry without game information is read back" )
+    {
+      auto entry = gameInfoCatalog->GetEntry(3);
+
+      THEN( "The entry contains default values" )
+      {
+        REQUIRE( entry.FilePath == "b.sgf" );
+        REQUIRE( entry.GameIndex == 1 );
+        REQUIRE( entry.BlackPlayerName == "" );
+        REQUIRE( entry.FirstGameDate == SgfcDate() );
+        REQUIRE( entry.GameResult.IsValid == false );
+      }
+    }
+
+    WHEN( "An entry with an invalid catalog index is read" )
+    {
+      THEN( "The catalog throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          gameInfoCatalog->GetEntry(4),
+          std::invalid_argument);
+      }
+    }
+  }
+
+  GIVEN( "The catalog is queried" )
+  {
+    SgfcGameInfoCatalogQuery query;
+
+    WHEN( "The query has no criteria" )
+    {
+      THEN( "All games match" )
+      {
+        REQUIRE( gameInfoCatalog->FindGames(query) == std::vector<std::size_t> { 0, 1, 2, 3 } );
+      }
+    }
+
+    WHEN( "The query has player name criteria" )
+    {
+      THEN( "The games of the player match" )
+      {
+        query.PlayerName = "Lee Sedol";
+        REQUIRE( gameInfoCatalog->FindGames(query) == std::vector<std::size_t> { 0, 1, 2 } );
+
+        query.BlackPlayerName = "AlphaGo";
+        REQUIRE( gameInfoCatalog->FindGames(query) == std::vector<std::size_t> { 1 } );
+
+        query = SgfcGameInfoCatalogQuery();
+        query.WhitePlayerName = "Lee Sedol";
+        REQUIRE( gameInfoCatalog->FindGames(query) == std::vector<std::size_t> { 1, 2 } );
+
+        query.WhitePlayerName = "Unknown Player";
+        REQUIRE( gameInfoCatalog->FindGames(query).empty() == true );
+      }
+    }
+
+    WHEN( "The query has date criteria" )
+    {
+      THEN( "The games played in the date range match" )
+      {
+        query.EarliestGameDate = { 2016, 3, 10 };
+        REQUIRE( gameInfoCatalog->FindGames(query) == std::vector<std::size_t> { 1, 2 } );
+
+        query = SgfcGameInfoCatalogQuery();
+        query.LatestGameDate = { 2016, 3, 9 };
+        REQUIRE( gameInfoCatalog->FindGames(query) == std::vector<std::size_t> { 0 } );
+
+        // Partial dates on both sides
+        query.EarliestGameDate = { 2019, 0, 0 };
+        query.LatestGameDate = { 2021, 0, 0 };
+        REQUIRE( gameInfoCatalog->FindGames(query) == std::vector<std::size_t> { 2 } );
+
+        query.EarliestGameDate = { 2019, 5, 31 };
+        query.LatestGameDate = { 2019, 6, 1 };
+        REQUIRE( gameInfoCatalog->FindGames(query) == std::vector<std::size_t> { 2 } );
+
+        query.EarliestGameDate = { 2019, 6, 0 };
+        query.LatestGameDate = { 2021, 0, 0 };
+        REQUIRE( gameInfoCatalog->FindGames(query).empty() == true );
+      }
+    }
+
+    WHEN( "The query has game result criteria" )
+    {
+      THEN( "The games with the game result match" )
+      {
+        query.IsGameResultTypeSet = true;
+        query.GameResultType = SgfcGameResultType::WhiteWin;
+        REQUIRE( gameInfoCatalog->FindGames(query) == std::vector<std::size_t> { 1 } );
+
+        query = SgfcGameInfoCatalogQuery();
+        query.IsWinTypeSet = true;
+        query.WinType = SgfcWinType::WinByResignation;
+        REQUIRE( gameInfoCatalog->FindGames(query) == std::vector<std::size_t> { 0, 1 } );
+      }
+    }
+
+    WHEN( "The query has komi and rules criteria" )
+    {
+      THEN( "The games with the komi and rules match" )
+      {
+        query.IsKomiRangeSet = true;
+        query.MinimumKomi = 7.0;
+        query.MaximumKomi = 8.0;
+        REQUIRE( gameInfoCatalog->FindGames(query) == std::vector<std::size_t> { 0, 1 } );
+
+        query = SgfcGameInfoCatalogQuery();
+        query.RulesName = "Japanese";
+        REQUIRE( gameInfoCatalog->FindGames(query) == std::vector<std::size_t> { 2 } );
+      }
+    }
+
+    WHEN( "The query combines criteria" )
+    {
+      THEN( "Only the games that match all criteria match" )
+      {
+        query.PlayerName = "Lee Sedol";
+        query.EarliestGameDate = { 2016, 0, 0 };
+        query.LatestGameDate = { 2016, 0, 0 };
+        query.IsWinTypeSet = true;
+        query.WinType = SgfcWinType::WinByResignation;
+        query.IsGameResultTypeSet = true;
+        query.GameResultType = SgfcGameResultType::BlackWin;
+        REQUIRE( gameInfoCatalog->FindGames(query) == std::vector<std::size_t> { 0 } );
+      }
+    }
+  }
+
+  gameInfoCatalog = nullptr;
+  SgfcUtility::DeleteFileIfExists(catalogFilePath);
+}
+
+SCENARIO( "SgfcGameInfoCatalog reads a corrupt catalog file", "[game]" )
+{
+  auto game = CreateCatalogGame("Lee Sedol", "AlphaGo", { { 2016, 3, 9 } }, "B+R", 7.5, "Chinese");
+  std::vector<std::string> filePaths = { "a.sgf" };
+  std::vector<std::vector<SgfcGameInfoCatalogEntry>> entriesPerFile = { { SgfcGameInfoCatalogWriter::CreateEntry(*game, 0) } };
+
+  std::string catalogFilePath = SgfcUtility::GetUniqueTempFilePath();
+  SgfcGameInfoCatalogWriter::WriteCatalogFile(catalogFilePath, filePaths, entriesPerFile);
+
+  std::ifstream in(std::filesystem::u8path(catalogFilePath), std::ios::binary);
+  std::string catalogContent((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  in.close();
+
+  GIVEN( "A count or a string length in the catalog file is corrupt" )
+  {
+    // Offset 16 is the number of games, offset 24 is the number of strings,
+    // offset 32 is the length of the first string
+    auto corruptField = GENERATE( std::make_pair(16, 8), std::make_pair(24, 8), std::make_pair(32, 4) );
+    for (int byteIndex = 0; byteIndex < corruptField.second; byteIndex++)
+      catalogContent[corruptField.first + byteIndex] = static_cast<char>(0xff);
+
+    std::ofstream out(std::filesystem::u8path(catalogFilePath), std::ios::binary | std::ios::trunc);
+    out << catalogContent;
+    out.close();
+
+    WHEN( "The catalog is read" )
+    {
+      THEN( "The catalog throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          SgfcPlusPlusFactory::CreateGameInfoCatalog(catalogFilePath),
+          std::runtime_error);
+      }
+    }
+  }
+
+  SgfcUtility::DeleteFileIfExists(catalogFilePath);
+}
+
+SCENARIO( "SgfcGameInfoCatalogWriter writes a catalog for a directory", "[game]" )
+{
+  auto gameInfoCatalogWriter = SgfcPlusPlusFactory::CreateGameInfoCatalogWriter();
+  std::string catalogFilePath = SgfcUtility::GetUniqueTempFilePath();
+
+  GIVEN( "The directory contains no SGF files" )
+  {
+    std::string sgfDirectoryPath = SgfcUtility::GetUniqueTempFilePath();
+    std::filesystem::create_directory(std::filesystem::u8path(sgfDirectoryPath));
+
+    WHEN( "The catalog is written" )
+    {
+      std::size_t numberOfGames = gameInfoCatalogWriter->WriteCatalog(sgfDirectoryPath, catalogFilePath);
+
+      THEN( "The catalog is empty" )
+      {
+        REQUIRE( numberOfGames == 0 );
+
+        auto gameInfoCatalog = SgfcPlusPlusFactory::CreateGameInfoCatalog(catalogFilePath);
+        REQUIRE( gameInfoCatalog->GetNumberOfGames() == 0 );
+        REQUIRE( gameInfoCatalog->FindGames(SgfcGameInfoCatalogQuery()).empty() == true );
+      }
+    }
+
+    std::filesystem::remove(std::filesystem::u8path(sgfDirectoryPath));
+  }
+
+  GIVEN( "The directory does not exist" )
+  {
+    std::string sgfDirectoryPath = SgfcUtility::GetUniqueTempFilePath();
+
+    WHEN( "The catalog is written" )
+    {
+      THEN( "The writer throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          gameInfoCatalogWriter->WriteCatalog(sgfDirectoryPath, catalogFilePath),
+          std::invalid_argument);
+      }
+    }
+  }
+
+  SgfcUtility::DeleteFileIfExists(catalogFilePath);
+}
+
+std::shared_ptr<ISgfcGame> CreateCatalogGame(
+  const SgfcSimpleText& blackPlayerName,
+  const SgfcSimpleText& whitePlayerName,
+  const std::vector<SgfcDate>& gameDates,
+  const SgfcSimpleText& gameResult,
+  SgfcReal komi,
+  const SgfcSimpleText& rulesName)
+{
+  auto gameInfo = SgfcPlusPlusFactory::CreateGameInfo();
+  gameInfo->SetBlackPlayerName(blackPlayerName);
+  gameInfo->SetWhitePlayerName(whitePlayerName);
+  gameInfo->SetGameDates(gameDates);
+  gameInfo->SetGameResult(SgfcGameResult::FromPropertyValue(gameResult));
+  gameInfo->SetKomi(komi);
+  gameInfo->SetRulesName(rulesName);
+
+  auto game = SgfcPlusPlusFactory::CreateGame();
+  game->SetRootNode(nullptr);
+  game->WriteGameInfo(gameInfo);
+  return game;
+}
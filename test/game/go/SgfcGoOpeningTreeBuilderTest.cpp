@@ -0,0 +1,403 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Library includes
+#include <ISgfcDocument.h>
+#include <ISgfcGame.h>
+#include <ISgfcGoMovePropertyValue.h>
+#include <ISgfcGoOpeningTreeBuilder.h>
+#include <ISgfcGoStonePropertyValue.h>
+#include <ISgfcNode.h>
+#include <ISgfcNumberPropertyValue.h>
+#include <ISgfcProperty.h>
+#include <ISgfcPropertyFactory.h>
+#include <ISgfcPropertyValueFactory.h>
+#include <ISgfcSimpleTextPropertyValue.h>
+#include <ISgfcSinglePropertyValue.h>
+#include <ISgfcTextPropertyValue.h>
+#include <ISgfcTreeBuilder.h>
+#include <SgfcConstants.h>
+#include <SgfcPlusPlusFactory.h>
+
+// Unit test library includes
+#include <catch2/catch_test_macros.hpp>
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace LibSgfcPlusPlus;
+
+std::shared_ptr<ISgfcGame> CreateOpeningTreeGame(
+  const std::vector<std::string>& moves,
+  const std::string& gameResult,
+  SgfcBoardSize boardSize = SgfcConstants::BoardSizeDefaultGo);
+std::string GetMoveRawValue(std::shared_ptr<ISgfcNode> node);
+std::string GetCommentText(std::shared_ptr<ISgfcNode> node);
+
+SCENARIO( "SgfcGoOpeningTreeBuilder is constructed", "[go]" )
+{
+  GIVEN( "SgfcGoOpeningTreeBuilder is constructed with a valid board size" )
+  {
+    WHEN( "SgfcGoOpeningTreeBuilder is constructed" )
+    {
+      auto openingTreeBuilder = SgfcPlusPlusFactory::CreateGoOpeningTreeBuilder(SgfcConstants::BoardSizeDefaultGo);
+
+      THEN( "SgfcGoOpeningTreeBuilder has the expected default state" )
+      {
+        REQUIRE( openingTreeBuilder->GetBoardSize() == SgfcConstants::BoardSizeDefaultGo );
+        REQUIRE( openingTreeBuilder->GetMaximumNumberOfMoves() == 0 );
+        REQUIRE( openingTreeBuilder->GetUseCanonicalSymmetry() == false );
+        REQUIRE( openingTreeBuilder->GetMinimumNumberOfGames() == 1 );
+        REQUIRE( openingTreeBuilder->GetNumberOfThreads() == 0 );
+        REQUIRE( openingTreeBuilder->GetNumberOfGames() == 0 );
+        REQUIRE( openingTreeBuilder->GetNumberOfNodes() == 0 );
+      }
+    }
+  }
+
+  GIVEN( "SgfcGoOpeningTreeBuilder is constructed with an invalid board size" )
+  {
+    WHEN( "SgfcGoOpeningTreeBuilder is constructed" )
+    {
+      THEN( "The factory throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          SgfcPlusPlusFactory::CreateGoOpeningTreeBuilder(SgfcConstants::BoardSizeNone),
+          std::invalid_argument);
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcGoOpeningTreeBuilder merges games", "[go]" )
+{
+  GIVEN( "Games that share their first moves" )
+  {
+    auto openingTreeBuilder = SgfcPlusPlusFactory::CreateGoOpeningTreeBuilder(SgfcConstants::BoardSizeDefaultGo);
+
+    WHEN( "The games are added" )
+    {
+      REQUIRE( openingTreeBuilder->AddGame(CreateOpeningTreeGame({ "pd", "dp", "pp", "dd", "fq" }, "B+R")) == true );
+      REQUIRE( openingTreeBuilder->AddGame(CreateOpeningTreeGame({ "pd", "dp", "pp", "dc" }, "W+2.5")) == true );
+      REQUIRE( openingTreeBuilder->AddGame(CreateOpeningTreeGame({ "pd", "dd" }, "0")) == true );
+
+      THEN( "The games are merged into one tree" )
+      {
+        REQUIRE( openingTreeBuilder->GetNumberOfGames() == 3 );
+        // pd, dp, pp, dd, fq, dc, dd
+        REQUIRE( openingTreeBuilder->GetNumberOfNodes() == 7 );
+      }
+    }
+  }
+
+  GIVEN( "Games that cannot be merged" )
+  {
+    auto openingTreeBuilder = SgfcPlusPlusFactory::CreateGoOpeningTreeBuilder(SgfcConstants::BoardSizeDefaultGo);
+    auto propertyFactory = SgfcPlusPlusFactory::CreatePropertyFactory();
+    auto propertyValueFactory = SgfcPlusPlusFactory::CreatePropertyValueFactory();
+
+    WHEN( "The game is not a Go game" )
+    {
+      auto game = CreateOpeningTreeGame({ "pd" }, "B+R");
+      game->GetRootNode()->SetProperty(propertyFactory->CreateProperty(
+        SgfcPropertyType::GM, propertyValueFactory->CreateGameTypePropertyValue(SgfcGameType::Chess)));
+
+      THEN( "The game is skipped" )
+      {
+        REQUIRE( openingTreeBuilder->AddGame(game) == false );
+        REQUIRE( openingTreeBuilder->GetNumberOfGames() == 0 );
+        REQUIRE( openingTreeBuilder->GetNumberOfNodes() == 0 );
+      }
+    }
+
+    WHEN( "The game has a different board size" )
+    {
+      auto game = CreateOpeningTreeGame({ "cc" }, "B+R", { 9, 9 });
+
+      THEN( "The game is skipped" )
+      {
+        REQUIRE( openingTreeBuilder->AddGame(game) == false );
+        REQUIRE( openingTreeBuilder->GetNumberOfGames() == 0 );
+      }
+    }
+
+    WHEN( "The game has setup stones in the root node" )
+    {
+      auto game = CreateOpeningTreeGame({ "pd" }, "B+R");
+      game->GetRootNode()->SetProperty(propertyFactory->CreateProperty(
+        SgfcPropertyType::AB,
+        propertyValueFactory->CreateGoStonePropertyValue("dd", SgfcConstants::BoardSizeDefaultGo, SgfcColor::Black)));
+
+      THEN( "The game is skipped" )
+      {
+        REQUIRE( openingTreeBuilder->AddGame(game) == false );
+        REQUIRE( openingTreeBuilder->GetNumberOfGames() == 0 );
+      }
+    }
+
+    WHEN( "The game is nullptr" )
+    {
+      THEN( "SgfcGoOpeningTreeBuilder throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          openingTreeBuilder->AddGame(nullptr),
+          std::invalid_argument);
+        REQUIRE_THROWS_AS(
+          openingTreeBuilder->AddGames({ CreateOpeningTreeGame({ "pd" }, "B+R"), nullptr }),
+          std::invalid_argument);
+        REQUIRE( openingTreeBuilder->GetNumberOfGames() == 0 );
+      }
+    }
+  }
+
+  GIVEN( "Games that are equivalent under a symmetry of the board" )
+  {
+    // The second game is the first game mirrored along the vertical axis,
+    // the third game is the first game transposed
+    std::vector<std::shared_ptr<ISgfcGame>> games =
+    {
+      CreateOpeningTreeGame({ "pd", "dp", "qf" }, "B+R"),
+      CreateOpeningTreeGame({ "dd", "pp", "cf" }, "W+R"),
+      CreateOpeningTreeGame({ "dp", "pd", "fq" }, "B+R"),
+    };
+
+    WHEN( "Canonical symmetry is not used" )
+    {
+      auto openingTreeBuilder = SgfcPlusPlusFactory::CreateGoOpeningTreeBuilder(SgfcConstants::BoardSizeDefaultGo);
+      openingTreeBuilder->AddGames(games);
+
+      THEN( "The games are not merged" )
+      {
+        REQUIRE( openingTreeBuilder->GetNumberOfGames() == 3 );
+        REQUIRE( openingTreeBuilder->GetNumberOfNodes() == 9 );
+      }
+    }
+
+    WHEN( "Canonical symmetry is used" )
+    {
+      auto openingTreeBuilder = SgfcPlusPlusFactory::CreateGoOpeningTreeBuilder(SgfcConstants::BoardSizeDefaultGo);
+      openingTreeBuilder->SetUseCanonicalSymmetry(true);
+      openingTreeBuilder->AddGames(games);
+
+      THEN( "The games are merged" )
+      {
+        REQUIRE( openingTreeBuilder->GetNumberOfGames() == 3 );
+        REQUIRE( openingTreeBuilder->GetNumberOfNodes() == 3 );
+
+        auto rootNode = openingTreeBuilder->CreateDocument()->GetGame()->GetRootNode();
+        REQUIRE( rootNode->GetChildren().size() == 1 );
+        REQUIRE( GetCommentText(rootNode->GetFirstChild()->GetFirstChild()->GetFirstChild()) ==
+                 "Games: 3\nBlack wins: 2 (66.7%)\nWhite wins: 1 (33.3%)\nDraws: 0 (0.0%)" );
+      }
+    }
+  }
+
+  GIVEN( "Games that are longer than the maximum number of moves" )
+  {
+    auto openingTreeBuilder = SgfcPlusPlusFactory::CreateGoOpeningTreeBuilder(SgfcConstants::BoardSizeDefaultGo);
+
+    WHEN( "The maximum number of moves is set before games are added" )
+    {
+      openingTreeBuilder->SetMaximumNumberOfMoves(2);
+      openingTreeBuilder->AddGame(CreateOpeningTreeGame({ "pd", "dp", "pp", "dd" }, "B+R"));
+      openingTreeBuilder->AddGame(CreateOpeningTreeGame({ "pd", "dp", "cc" }, "B+R"));
+
+      THEN( "Only the moves up to the maximum are merged" )
+      {
+        REQUIRE( openingTreeBuilder->GetNumberOfGames() == 2 );
+        REQUIRE( openingTreeBuilder->GetNumberOfNodes() == 2 );
+      }
+    }
+
+    WHEN( "The settings are changed after games were added" )
+    {
+      openingTreeBuilder->AddGame(CreateOpeningTreeGame({ "pd" }, "B+R"));
+
+      THEN( "SgfcGoOpeningTreeBuilder throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          openingTreeBuilder->SetMaximumNumberOfMoves(2),
+          std::logic_error);
+        REQUIRE_THROWS_AS(
+          openingTreeBuilder->SetUseCanonicalSymmetry(true),
+          std::logic_error);
+        REQUIRE_NOTHROW( openingTreeBuilder->SetMinimumNumberOfGames(2) );
+      }
+    }
+  }
+
+  GIVEN( "Many games are added at once" )
+  {
+    std::vector<std::shared_ptr<ISgfcGame>> games;
+    const char* firstMoves[] = { "pd", "dd", "qc" };
+    const char* laterMoves[] = { "dp", "pp", "qq", "cd", "ec", "fq", "cq" };
+    const char* gameResults[] = { "B+R", "W+R", "0", "?" };
+    for (int gameIndex = 0; gameIndex < 200; gameIndex++)
+    {
+      std::vector<std::string> moves;
+      moves.push_back(firstMoves[gameIndex % 3]);
+      for (int moveIndex = 0; moveIndex < 6; moveIndex++)
+        moves.push_back(laterMoves[(gameIndex / (moveIndex + 1) + moveIndex) % 7]);
+      games.push_back(CreateOpeningTreeGame(moves, gameResults[gameIndex % 4]));
+    }
+
+    auto sequentialOpeningTreeBuilder = SgfcPlusPlusFactory::CreateGoOpeningTreeBuilder(SgfcConstants::BoardSizeDefaultGo);
+    for (const auto& game : games)
+      sequentialOpeningTreeBuilder->AddGame(game);
+
+    WHEN( "The games are merged with different numbers of threads" )
+    {
+      auto singleThreadOpeningTreeBuilder = SgfcPlusPlusFactory::CreateGoOpeningTreeBuilder(SgfcConstants::BoardSizeDefaultGo);
+      singleThreadOpeningTreeBuilder->SetNumberOfThreads(1);
+      auto multiThreadOpeningTreeBuilder = SgfcPlusPlusFactory::CreateGoOpeningTreeBuilder(SgfcConstants::BoardSizeDefaultGo);
+      multiThreadOpeningTreeBuilder->SetNumberOfThreads(4);
+
+      REQUIRE( singleThreadOpeningTreeBuilder->AddGames(games) == games.size() );
+      REQUIRE( multiThreadOpeningTreeBuilder->AddGames(games) == games.size() );
+
+      THEN( "The result is the same as if the games were added one by one" )
+      {
+        std::uint64_t contentHash = sequentialOpeningTreeBuilder->CreateDocument()->GetGame()->GetRootNode()->GetContentHash();
+
+        REQUIRE( singleThreadOpeningTreeBuilder->GetNumberOfGames() == sequentialOpeningTreeBuilder->GetNumberOfGames() );
+        REQUIRE( singleThreadOpeningTreeBuilder->GetNumberOfNodes() == sequentialOpeningTreeBuilder->GetNumberOfNodes() );
+        REQUIRE( singleThreadOpeningTreeBuilder->CreateDocument()->GetGame()->GetRootNode()->GetContentHash() == contentHash );
+        REQUIRE( multiThreadOpeningTreeBuilder->GetNumberOfGames() == sequentialOpeningTreeBuilder->GetNumberOfGames() );
+        REQUIRE( multiThreadOpeningTreeBuilder->GetNumberOfNodes() == sequentialOpeningTreeBuilder->GetNumberOfNodes() );
+        REQUIRE( multiThreadOpeningTreeBuilder->CreateDocument()->GetGame()->GetRootNode()->GetContentHash() == contentHash );
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcGoOpeningTreeBuilder creates a document", "[go]" )
+{
+  GIVEN( "Games with different popularity of moves" )
+  {
+    auto openingTreeBuilder = SgfcPlusPlusFactory::CreateGoOpeningTreeBuilder(SgfcConstants::BoardSizeDefaultGo);
+    openingTreeBuilder->AddGames(
+    {
+      CreateOpeningTreeGame({ "dd" }, "W+R"),
+      CreateOpeningTreeGame({ "pd", "dp" }, "B+R"),
+      CreateOpeningTreeGame({ "pd", "" }, "W+R"),
+      CreateOpeningTreeGame({ "pd", "dp" }, "0"),
+    });
+
+    WHEN( "The document is created" )
+    {
+      auto document = openingTreeBuilder->CreateDocument();
+
+      THEN( "The document contains the opening tree" )
+      {
+        REQUIRE( document->GetGames().size() == 1 );
+        auto game = document->GetGame();
+        REQUIRE( game->GetGameType() == SgfcGameType::Go );
+        REQUIRE( game->GetBoardSize() == SgfcConstants::BoardSizeDefaultGo );
+
+        auto rootNode = game->GetRootNode();
+        REQUIRE( GetCommentText(rootNode) == "Games: 4\nBlack wins: 1 (25.0%)\nWhite wins: 2 (50.0%)\nDraws: 1 (25.0%)" );
+
+        auto firstMoveNodes = rootNode->GetChildren();
+        REQUIRE( firstMoveNodes.size() == 2 );
+        REQUIRE( firstMoveNodes[0]->HasProperty(SgfcPropertyType::B) );
+        REQUIRE( GetMoveRawValue(firstMoveNodes[0]) == "pd" );
+        REQUIRE( GetCommentText(firstMoveNodes[0]) == "Games: 3\nBlack wins: 1 (33.3%)\nWhite wins: 1 (33.3%)\nDraws: 1 (33.3%)" );
+        REQUIRE( GetMoveRawValue(firstMoveNodes[1]) == "dd" );
+
+        auto secondMoveNodes = firstMoveNodes[0]->GetChildren();
+        REQUIRE( secondMoveNodes.size() == 2 );
+        REQUIRE( secondMoveNodes[0]->HasProperty(SgfcPropertyType::W) );
+        REQUIRE( GetMoveRawValue(secondMoveNodes[0]) == "dp" );
+        REQUIRE( GetMoveRawValue(secondMoveNodes[1]) == SgfcConstants::GoMovePassString );
+        REQUIRE( GetCommentText(secondMoveNodes[1]) == "Games: 1\nBlack wins: 0 (0.0%)\nWhite wins: 1 (100.0%)\nDraws: 0 (0.0%)" );
+      }
+    }
+
+    WHEN( "The document is created with a minimum number of games" )
+    {
+      openingTreeBuilder->SetMinimumNumberOfGames(2);
+      auto document = openingTreeBuilder->CreateDocument();
+
+      THEN( "Moves that were played in fewer games are omitted" )
+      {
+        auto rootNode = document->GetGame()->GetRootNode();
+        REQUIRE( rootNode->GetChildren().size() == 1 );
+        REQUIRE( GetMoveRawValue(rootNode->GetFirstChild()) == "pd" );
+        REQUIRE( rootNode->GetFirstChild()->GetChildren().size() == 1 );
+        REQUIRE( GetMoveRawValue(rootNode->GetFirstChild()->GetFirstChild()) == "dp" );
+      }
+    }
+  }
+}
+
+/// Creates a game with the moves @a moves. Black plays the first move, the
+/// players then alternate. An empty string denotes a pass move.
+std::shared_ptr<ISgfcGame> CreateOpeningTreeGame(
+  const std::vector<std::string>& moves,
+  const std::string& gameResult,
+  SgfcBoardSize boardSize)
+{
+  auto propertyFactory = SgfcPlusPlusFactory::CreatePropertyFactory();
+  auto propertyValueFactory = SgfcPlusPlusFactory::CreatePropertyValueFactory();
+
+  auto rootNode = SgfcPlusPlusFactory::CreateNode();
+  rootNode->SetProperties(
+  {
+    propertyFactory->CreateProperty(
+      SgfcPropertyType::SZ, propertyValueFactory->CreateBoardSizePropertyValue(boardSize, SgfcGameType::Go)),
+    propertyFactory->CreateProperty(
+      SgfcPropertyType::RE, propertyValueFactory->CreateSimpleTextPropertyValue(gameResult)),
+  });
+
+  auto game = SgfcPlusPlusFactory::CreateGame(rootNode);
+  auto treeBuilder = game->GetTreeBuilder();
+
+  auto parentNode = rootNode;
+  SgfcColor color = SgfcColor::Black;
+  for (const auto& move : moves)
+  {
+    auto goMoveValue = move.empty()
+      ? propertyValueFactory->CreateGoMovePropertyValue(color)
+      : propertyValueFactory->CreateGoMovePropertyValue(move, boardSize, color);
+
+    auto node = SgfcPlusPlusFactory::CreateNode();
+    node->SetProperty(propertyFactory->CreateProperty(
+      color == SgfcColor::Black ? SgfcPropertyType::B : SgfcPropertyType::W,
+      goMoveValue));
+    treeBuilder->AppendChild(parentNode, node);
+
+    parentNode = node;
+    color = (color == SgfcColor::Black) ? SgfcColor::White : SgfcColor::Black;
+  }
+
+  return game;
+}
+
+std::string GetMoveRawValue(std::shared_ptr<ISgfcNode> node)
+{
+  auto property = node->HasProperty(SgfcPropertyType::B)
+    ? node->GetProperty(SgfcPropertyType::B)
+    : node->GetProperty(SgfcPropertyType::W);
+  return property->GetPropertyValue()->ToSingleValue()->GetRawValue();
+}
+
+std::string GetCommentText(std::shared_ptr<ISgfcNode> node)
+{
+  return node->GetProperty(SgfcPropertyType::C)->GetPropertyValue()->ToSingleValue()->ToTextValue()->GetTextValue();
+}
@@ -0,0 +1,290 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Library includes
+#include <document/SgfcGame.h>
+#include <document/SgfcNode.h>
+#include <document/SgfcTreeBuilder.h>
+#include <game/go/SgfcGoPositionIndexFileWriter.h>
+#include <game/go/SgfcGoPositionIndexWriter.h>
+#include <ISgfcGoMovePropertyValue.h>
+#include <ISgfcGoPosition.h>
+#include <ISgfcGoPositionIndex.h>
+#include <ISgfcGoPositionIndexWriter.h>
+#include <ISgfcGoReplayEngine.h>
+#include <ISgfcProperty.h>
+#include <ISgfcPropertyFactory.h>
+#include <ISgfcPropertyValueFactory.h>
+#include <SgfcConstants.h>
+#include <SgfcPlusPlusFactory.h>
+#include <SgfcUtility.h>
+
+// Unit test library includes
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+
+// C++ Standard Library includes
+#include <filesystem>
+
+using namespace LibSgfcPlusPlus;
+
+std::shared_ptr<SgfcNode> CreateGoMoveNode(SgfcPropertyType propertyType, const std::string& position);
+
+SCENARIO( "SgfcGoPositionIndexWriter is constructed", "[go]" )
+{
+  GIVEN( "The factory method is used" )
+  {
+    WHEN( "SgfcGoPositionIndexWriter is constructed" )
+    {
+      auto goPositionIndexWriter = SgfcPlusPlusFactory::CreateGoPositionIndexWriter();
+
+      THEN( "SgfcGoPositionIndexWriter is constructed successfully" )
+      {
+        REQUIRE( goPositionIndexWriter->GetUseCanonicalHashes() == false );
+        REQUIRE( goPositionIndexWriter->GetNumberOfThreads() == 0 );
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcGoPositionIndex finds positions", "[go]" )
+{
+  // Game 0 has a main variation B dd - W pp - B dp and a variation B pd that
+  // branches off after the first move. Game 1 reaches the main variation's
+  // final position with a different move order, and contains two mirror
+  // images of the first position of game 0.
+  //
+  //   Game 0:  root - B dd - W pp - B dp
+  //                       \- B pd
+  //   Game 1:  root - B dp - W pp - B dd
+  //                \- B pd
+  auto game0 = std::make_shared<SgfcGame>();
+  SgfcTreeBuilder treeBuilder0(game0);
+  auto rootNode0 = std::make_shared<SgfcNode>();
+  auto firstMoveNode0 = CreateGoMoveNode(SgfcPropertyType::B, "dd");
+  auto secondMoveNode0 = CreateGoMoveNode(SgfcPropertyType::W, "pp");
+  auto thirdMoveNode0 = CreateGoMoveNode(SgfcPropertyType::B, "dp");
+  auto variationNode0 = CreateGoMoveNode(SgfcPropertyType::B, "pd");
+  game0->SetRootNode(rootNode0);
+  treeBuilder0.SetFirstChild(rootNode0, firstMoveNode0);
+  treeBuilder0.SetFirstChild(firstMoveNode0, secondMoveNode0);
+  treeBuilder0.SetNextSibling(secondMoveNode0, variationNode0);
+  treeBuilder0.SetFirstChild(secondMoveNode0, thirdMoveNode0);
+
+  auto game1 = std::make_shared<SgfcGame>();
+  SgfcTreeBuilder treeBuilder1(game1);
+  auto rootNode1 = std::make_shared<SgfcNode>();
+  auto firstMoveNode1 = CreateGoMoveNode(SgfcPropertyType::B, "dp");
+  auto secondMoveNode1 = CreateGoMoveNode(SgfcPropertyType::W, "pp");
+  auto thirdMoveNode1 = CreateGoMoveNode(SgfcPropertyType::B, "dd");
+  auto variationNode1 = CreateGoMoveNode(SgfcPropertyType::B, "pd");
+  game1->SetRootNode(rootNode1);
+  treeBuilder1.SetFirstChild(rootNode1, firstMoveNode1);
+  treeBuilder1.SetNextSibling(firstMoveNode1, variationNode1);
+  treeBuilder1.SetFirstChild(firstMoveNode1, secondMoveNode1);
+  treeBuilder1.SetFirstChild(secondMoveNode1, thirdMoveNode1);
+
+  bool useCanonicalHashes = GENERATE( false, true );
+
+  // A maximum run size of 1 forces every record into its own sorted run,
+  // and a maximum merge width of 2 forces several merge passes
+  std::size_t maximumRunSize = GENERATE( 1000, 1 );
+  SgfcGoPositionIndexFileWriter fileWriter(useCanonicalHashes, maximumRunSize, 2);
+
+  std::vector<SgfcGoPositionIndexRecord> records0;
+  std::vector<SgfcGoPositionIndexNode> nodes0;
+  SgfcGoPositionIndexWriter::AddGameRecords(*game0, 0, 0, useCanonicalHashes, records0, nodes0);
+  fileWriter.AddRecords(records0, nodes0);
+
+  std::vector<SgfcGoPositionIndexRecord> records1;
+  std::vector<SgfcGoPositionIndexNode> nodes1;
+  SgfcGoPositionIndexWriter::AddGameRecords(*game1, 0, 1, useCanonicalHashes, records1, nodes1);
+  fileWriter.AddRecords(records1, nodes1);
+
+  REQUIRE( nodes0.size() == 5 );
+  REQUIRE( nodes1.size() == 5 );
+  REQUIRE( fileWriter.GetNumberOfRecords() == 8 );
+  REQUIRE( fileWriter.GetNumberOfSortedRuns() == (maximumRunSize == 1 ? 8 : 0) );
+
+  std::vector<std::string> filePaths = { "games.sgf" };
+  std::string indexFilePath = SgfcUtility::GetUniqueTempFilePath();
+  fileWriter.WriteIndexFile(indexFilePath, filePaths);
+
+  auto goPositionIndex = SgfcPlusPlusFactory::CreateGoPositionIndex(indexFilePath);
+
+  GIVEN( "The index was written" )
+  {
+    WHEN( "The index is opened" )
+    {
+      THEN( "The index contains an entry for every node with stones on the board" )
+      {
+        REQUIRE( goPositionIndex->IsCanonical() == useCanonicalHashes );
+        REQUIRE( goPositionIndex->GetNumberOfEntries() == 8 );
+        REQUIRE( goPositionIndex->GetFilePaths() == filePaths );
+      }
+    }
+
+    WHEN( "A position that occurs in both games is queried" )
+    {
+      auto position = game0->GetGoPosition(thirdMoveNode0);
+      auto entries = goPositionIndex->FindPositions(*position);
+
+      THEN( "The entries are found in game order" )
+      {
+        REQUIRE( entries.size() == 2 );
+        REQUIRE( entries[0].FilePath == "games.sgf" );
+        REQUIRE( entries[0].GameIndex == 0 );
+        REQUIRE( entries[0].NodePath == std::vector<std::size_t> { 0, 0, 0 } );
+        REQUIRE( entries[1].FilePath == "games.sgf" );
+        REQUIRE( entries[1].GameIndex == 1 );
+        REQUIRE( entries[1].NodePath == std::vector<std::size_t> { 0, 0, 0 } );
+      }
+    }
+
+    WHEN( "A position that occurs in a variation is queried" )
+    {
+      auto position = game0->GetGoPosition(variationNode0);
+      auto entries = goPositionIndex->FindPositions(*position);
+
+      THEN( "The node path leads into the variation" )
+      {
+        REQUIRE( entries.size() == 1 );
+        REQUIRE( entries[0].GameIndex == 0 );
+        REQUIRE( entries[0].NodePath == std::vector<std::size_t> { 0, 1 } );
+      }
+    }
+
+    WHEN( "A position that is a mirror image of another position is queried" )
+    {
+      auto position = game0->GetGoPosition(firstMoveNode0);
+      auto entries = goPositionIndex->FindPositions(*position);
+
+      THEN( "The mirror image is found only with canonical hashes" )
+      {
+        if (useCanonicalHashes)
+        {
+          // The single stones B dd, B dp and B pd are all images of each
+          // other
+          REQUIRE( entries.size() == 3 );
+          REQUIRE( entries[0].GameIndex == 0 );
+          REQUIRE( entries[0].NodePath == std::vector<std::size_t> { 0 } );
+          REQUIRE( entries[1].GameIndex == 1 );
+          REQUIRE( entries[1].NodePath == std::vector<std::size_t> { 0 } );
+          REQUIRE( entries[2].GameIndex == 1 );
+          REQUIRE( entries[2].NodePath == std::vector<std::size_t> { 1 } );
+        }
+        else
+        {
+          REQUIRE( entries.size() == 1 );
+          REQUIRE( entries[0].GameIndex == 0 );
+          REQUIRE( entries[0].NodePath == std::vector<std::size_t> { 0 } );
+        }
+      }
+    }
+
+    WHEN( "A position that does not occur is queried" )
+    {
+      auto goReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(game0);
+      goReplayEngine->ApplyNode(CreateGoMoveNode(SgfcPropertyType::W, "jj"));
+      auto entries = goPositionIndex->FindPositions(*goReplayEngine->GetPosition());
+
+      THEN( "No entries are found" )
+      {
+        REQUIRE( entries.empty() == true );
+      }
+    }
+  }
+
+  goPositionIndex = nullptr;
+  SgfcUtility::DeleteFileIfExists(indexFilePath);
+}
+
+SCENARIO( "SgfcGoPositionIndexWriter writes an index for a directory", "[go]" )
+{
+  auto goPositionIndexWriter = SgfcPlusPlusFactory::CreateGoPositionIndexWriter();
+  std::string indexFilePath = SgfcUtility::GetUniqueTempFilePath();
+
+  GIVEN( "The directory contains no SGF files" )
+  {
+    std::string sgfDirectoryPath = SgfcUtility::GetUniqueTempFilePath();
+    std::filesystem::create_directory(std::filesystem::u8path(sgfDirectoryPath));
+
+    WHEN( "The index is written" )
+    {
+      unsigned int numberOfThreads = GENERATE( 0, 1, 4 );
+      goPositionIndexWriter->SetNumberOfThreads(numberOfThreads);
+
+      std::size_t numberOfEntries = goPositionIndexWriter->WriteIndex(sgfDirectoryPath, indexFilePath);
+
+      THEN( "The index is empty" )
+      {
+        REQUIRE( numberOfEntries == 0 );
+
+        auto goPositionIndex = SgfcPlusPlusFactory::CreateGoPositionIndex(indexFilePath);
+        REQUIRE( goPositionIndex->GetNumberOfEntries() == 0 );
+        REQUIRE( goPositionIndex->GetFilePaths().empty() == true );
+        REQUIRE( goPositionIndex->FindPositions(static_cast<std::uint64_t>(42)).empty() == true );
+      }
+    }
+
+    std::filesystem::remove(std::filesystem::u8path(sgfDirectoryPath));
+  }
+
+  GIVEN( "The directory does not exist" )
+  {
+    std::string sgfDirectoryPath = SgfcUtility::GetUniqueTempFilePath();
+
+    WHEN( "The index is written" )
+    {
+      THEN( "The writer throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          goPositionIndexWriter->WriteIndex(sgfDirectoryPath, indexFilePath),
+          std::invalid_argument);
+      }
+    }
+  }
+
+  GIVEN( "The index file is not a Go position index file" )
+  {
+    SgfcUtility::AppendTextToFile(indexFilePath, "(;FF[4])");
+
+    WHEN( "The index is opened" )
+    {
+      THEN( "The factory throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          SgfcPlusPlusFactory::CreateGoPositionIndex(indexFilePath),
+          std::runtime_error);
+      }
+    }
+  }
+
+  SgfcUtility::DeleteFileIfExists(indexFilePath);
+}
+
+std::shared_ptr<SgfcNode> CreateGoMoveNode(SgfcPropertyType propertyType, const std::string& position)
+{
+  auto propertyFactory = SgfcPlusPlusFactory::CreatePropertyFactory();
+  auto propertyValueFactory = SgfcPlusPlusFactory::CreatePropertyValueFactory();
+  SgfcColor color = (propertyType == SgfcPropertyType::B) ? SgfcColor::Black : SgfcColor::White;
+
+  auto node = std::make_shared<SgfcNode>();
+  node->SetProperty(propertyFactory->CreateProperty(
+    propertyType,
+    propertyValueFactory->CreateGoMovePropertyValue(position, SgfcConstants::BoardSizeDefaultGo, color)));
+  return node;
+}
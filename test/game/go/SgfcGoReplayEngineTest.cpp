@@ -0,0 +1,712 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Library includes
+#include <document/SgfcGame.h>
+#include <document/SgfcNode.h>
+#include <document/SgfcTreeBuilder.h>
+#include <game/go/SgfcGoMove.h>
+#include <game/go/SgfcGoPoint.h>
+#include <game/go/SgfcGoReplayEngine.h>
+#include <game/go/SgfcGoStone.h>
+#include <ISgfcBoardSizeProperty.h>
+#include <ISgfcComposedPropertyValue.h>
+#include <ISgfcGoMovePropertyValue.h>
+#include <ISgfcGoPointPropertyValue.h>
+#include <ISgfcGoPosition.h>
+#include <ISgfcGoReplayEngine.h>
+#include <ISgfcGoStonePropertyValue.h>
+#include <ISgfcNumberPropertyValue.h>
+#include <ISgfcProperty.h>
+#include <ISgfcPropertyFactory.h>
+#include <ISgfcPropertyValueFactory.h>
+#include <ISgfcSimpleTextPropertyValue.h>
+#include <SgfcConstants.h>
+#include <SgfcPlusPlusFactory.h>
+
+// Unit test library includes
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+
+// C++ Standard Library includes
+#include <map>
+
+using namespace LibSgfcPlusPlus;
+
+std::shared_ptr<ISgfcGoMove> CreateGoMove(SgfcColor color, const std::string& position, SgfcBoardSize boardSize);
+void CreateKoShape(ISgfcGoReplayEngine& goReplayEngine);
+
+SCENARIO( "SgfcGoReplayEngine is constructed", "[go]" )
+{
+  SgfcGoRuleset goRuleset;
+  goRuleset.GoRulesetType = SgfcGoRulesetType::Japanese;
+  goRuleset.IsValid = true;
+
+  GIVEN( "SgfcGoReplayEngine is constructed with a board size and a ruleset" )
+  {
+    WHEN( "SgfcGoReplayEngine is constructed with valid data" )
+    {
+      SgfcBoardSize boardSize = GENERATE(
+        SgfcConstants::BoardSizeMinimum,
+        SgfcConstants::BoardSizeDefaultGo,
+        SgfcConstants::BoardSizeMaximumGo );
+
+      auto goReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(boardSize, goRuleset);
+
+      THEN( "SgfcGoReplayEngine is constructed successfully" )
+      {
+        REQUIRE( goReplayEngine->GetBoardSize() == boardSize );
+        REQUIRE( goReplayEngine->GetGoRuleset() == goRuleset );
+
+        auto position = goReplayEngine->GetPosition();
+        REQUIRE( position->GetBoardSize() == boardSize );
+        REQUIRE( position->GetNumberOfStones(SgfcColor::Black) == 0 );
+        REQUIRE( position->GetNumberOfStones(SgfcColor::White) == 0 );
+        REQUIRE( position->GetNumberOfCapturedStones(SgfcColor::Black) == 0 );
+        REQUIRE( position->GetNumberOfCapturedStones(SgfcColor::White) == 0 );
+      }
+    }
+
+    WHEN( "SgfcGoReplayEngine is constructed with a rectangular board size" )
+    {
+      SgfcBoardSize boardSize = { 7, 13 };
+
+      auto goReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(boardSize, goRuleset);
+
+      THEN( "SgfcGoReplayEngine is constructed successfully" )
+      {
+        REQUIRE( goReplayEngine->GetBoardSize() == boardSize );
+        REQUIRE( goReplayEngine->GetPosition()->GetBoardSize() == boardSize );
+        REQUIRE_THROWS_AS( goReplayEngine->GetPosition()->HasStone(8, 1), std::invalid_argument );
+        REQUIRE_THROWS_AS( goReplayEngine->GetPosition()->HasStone(1, 14), std::invalid_argument );
+      }
+    }
+
+    WHEN( "SgfcGoReplayEngine is constructed with invalid data" )
+    {
+      SgfcBoardSize boardSize = GENERATE(
+        SgfcConstants::BoardSizeNone,
+        SgfcConstants::BoardSizeInvalid );
+      SgfcBoardSize boardSizeTooLarge = { 53, 53 };
+
+      THEN( "The factory method throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          SgfcPlusPlusFactory::CreateGoReplayEngine(boardSize, goRuleset),
+          std::invalid_argument);
+        REQUIRE_THROWS_AS(
+          SgfcPlusPlusFactory::CreateGoReplayEngine(boardSizeTooLarge, goRuleset),
+          std::invalid_argument);
+      }
+    }
+  }
+
+  GIVEN( "SgfcGoReplayEngine is constructed with a game" )
+  {
+    auto propertyFactory = SgfcPlusPlusFactory::CreatePropertyFactory();
+    auto propertyValueFactory = SgfcPlusPlusFactory::CreatePropertyValueFactory();
+
+    WHEN( "The game contains a ruleset and a board size" )
+    {
+      auto rootNode = std::make_shared<SgfcNode>();
+      rootNode->SetProperties(
+      {
+        propertyFactory->CreateProperty(SgfcPropertyType::RU, propertyValueFactory->CreateSimpleTextPropertyValue("NZ")),
+        propertyFactory->CreateBoardSizeProperty(propertyValueFactory->CreateNumberPropertyValue(9)),
+      });
+      auto game = std::make_shared<SgfcGame>(rootNode);
+
+      auto goReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(game);
+
+      THEN( "SgfcGoReplayEngine is constructed with the game's ruleset and board size" )
+      {
+        REQUIRE( goReplayEngine->GetBoardSize() == SgfcBoardSize { 9, 9 } );
+        REQUIRE( goReplayEngine->GetGoRuleset().IsValid == true );
+        REQUIRE( goReplayEngine->GetGoRuleset().GoRulesetType == SgfcGoRulesetType::NZ );
+      }
+    }
+
+    WHEN( "SgfcGoReplayEngine is constructed with invalid data" )
+    {
+      auto gameWithoutRootNode = std::make_shared<SgfcGame>();
+      auto rootNode = std::make_shared<SgfcNode>();
+      rootNode->SetProperty(
+        propertyFactory->CreateProperty(SgfcPropertyType::GM, propertyValueFactory->CreateNumberPropertyValue(2)));
+      auto gameWithOtherGameType = std::make_shared<SgfcGame>(rootNode);
+
+      THEN( "The factory method throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          SgfcPlusPlusFactory::CreateGoReplayEngine(nullptr),
+          std::invalid_argument);
+        REQUIRE_THROWS_AS(
+          SgfcPlusPlusFactory::CreateGoReplayEngine(gameWithoutRootNode),
+          std::invalid_argument);
+        REQUIRE_THROWS_AS(
+          SgfcPlusPlusFactory::CreateGoReplayEngine(gameWithOtherGameType),
+          std::invalid_argument);
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcGoReplayEngine plays moves", "[go]" )
+{
+  SgfcBoardSize boardSize = SgfcConstants::BoardSizeDefaultGo;
+  SgfcGoRuleset goRuleset;
+  goRuleset.GoRulesetType = SgfcGoRulesetType::Japanese;
+  goRuleset.IsValid = true;
+  auto goReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(boardSize, goRuleset);
+
+  GIVEN( "A move is played on an empty intersection" )
+  {
+    WHEN( "The move leaves the stone with liberties" )
+    {
+      auto moveLegality = goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "dd", boardSize));
+
+      THEN( "The move is legal and the stone is placed on the board" )
+      {
+        REQUIRE( moveLegality == SgfcGoMoveLegality::Legal );
+        auto position = goReplayEngine->GetPosition();
+        REQUIRE( position->HasStone(4, 4) == true );
+        REQUIRE( position->GetStoneColor(4, 4) == SgfcColor::Black );
+        REQUIRE( position->HasStone(3, 4) == false );
+        REQUIRE_THROWS_AS( position->GetStoneColor(3, 4), std::invalid_argument );
+        REQUIRE( position->GetNumberOfStones(SgfcColor::Black) == 1 );
+      }
+    }
+
+    WHEN( "The move removes the last liberty of opponent stones" )
+    {
+      goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, "aa", boardSize));
+      goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, "ba", boardSize));
+      goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "ab", boardSize));
+      goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "bb", boardSize));
+      auto moveLegality = goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "ca", boardSize));
+
+      THEN( "The move is legal and the opponent stones are captured" )
+      {
+        REQUIRE( moveLegality == SgfcGoMoveLegality::Legal );
+        auto position = goReplayEngine->GetPosition();
+        REQUIRE( position->HasStone(1, 1) == false );
+        REQUIRE( position->HasStone(2, 1) == false );
+        REQUIRE( position->GetNumberOfStones(SgfcColor::White) == 0 );
+        REQUIRE( position->GetNumberOfStones(SgfcColor::Black) == 3 );
+        REQUIRE( position->GetNumberOfCapturedStones(SgfcColor::White) == 2 );
+        REQUIRE( position->GetNumberOfCapturedStones(SgfcColor::Black) == 0 );
+      }
+    }
+
+    WHEN( "The move is played on the largest board allowed by the SGF standard" )
+    {
+      SgfcBoardSize maximumBoardSize = SgfcConstants::BoardSizeMaximumGo;
+      auto maximumBoardSizeReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(maximumBoardSize, goRuleset);
+      maximumBoardSizeReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, "ZZ", maximumBoardSize));
+      maximumBoardSizeReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "YZ", maximumBoardSize));
+      auto moveLegality = maximumBoardSizeReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "ZY", maximumBoardSize));
+
+      THEN( "Stones on the last column and row are handled correctly" )
+      {
+        REQUIRE( moveLegality == SgfcGoMoveLegality::Legal );
+        auto position = maximumBoardSizeReplayEngine->GetPosition();
+        REQUIRE( position->HasStone(52, 52) == false );
+        REQUIRE( position->GetStoneColor(51, 52) == SgfcColor::Black );
+        REQUIRE( position->GetStoneColor(52, 51) == SgfcColor::Black );
+        REQUIRE( position->GetNumberOfCapturedStones(SgfcColor::White) == 1 );
+      }
+    }
+
+    WHEN( "A pass move is played" )
+    {
+      auto moveLegality = goReplayEngine->ApplyGoMove(std::make_shared<SgfcGoMove>(SgfcColor::Black));
+
+      THEN( "The move is legal and the board does not change" )
+      {
+        REQUIRE( moveLegality == SgfcGoMoveLegality::Legal );
+        REQUIRE( goReplayEngine->GetPosition()->GetNumberOfStones(SgfcColor::Black) == 0 );
+      }
+    }
+  }
+
+  GIVEN( "A move is played on an occupied intersection" )
+  {
+    goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "dd", boardSize));
+    auto positionBeforeMove = goReplayEngine->GetPosition();
+
+    WHEN( "The move is played" )
+    {
+      SgfcColor color = GENERATE( SgfcColor::Black, SgfcColor::White );
+      auto moveLegality = goReplayEngine->ApplyGoMove(CreateGoMove(color, "dd", boardSize));
+
+      THEN( "The move is illegal and the board does not change" )
+      {
+        REQUIRE( moveLegality == SgfcGoMoveLegality::IntersectionOccupied );
+        REQUIRE( goReplayEngine->GetPosition()->IsSameBoard(*positionBeforeMove) == true );
+      }
+    }
+  }
+
+  GIVEN( "ApplyGoMove is invoked with invalid data" )
+  {
+    WHEN( "The move is nullptr" )
+    {
+      THEN( "ApplyGoMove throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          goReplayEngine->ApplyGoMove(nullptr),
+          std::invalid_argument);
+      }
+    }
+
+    WHEN( "The move is outside of the board" )
+    {
+      SgfcBoardSize largerBoardSize = SgfcConstants::BoardSizeMaximumGo;
+
+      THEN( "ApplyGoMove throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "tt", largerBoardSize)),
+          std::invalid_argument);
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcGoReplayEngine checks moves according to the ruleset", "[go]" )
+{
+  SgfcBoardSize boardSize = SgfcConstants::BoardSizeDefaultGo;
+
+  GIVEN( "A suicide move is played" )
+  {
+    WHEN( "The ruleset forbids suicide" )
+    {
+      SgfcGoRuleset goRuleset;
+      goRuleset.GoRulesetType = GENERATE( SgfcGoRulesetType::AGA, SgfcGoRulesetType::Japanese );
+      goRuleset.IsValid = GENERATE( true, false );
+      auto goReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(boardSize, goRuleset);
+      goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "ba", boardSize));
+      goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "ab", boardSize));
+      auto positionBeforeMove = goReplayEngine->GetPosition();
+
+      auto moveLegality = goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, "aa", boardSize));
+
+      THEN( "The move is illegal and the board does not change" )
+      {
+        REQUIRE( moveLegality == SgfcGoMoveLegality::Suicide );
+        auto position = goReplayEngine->GetPosition();
+        REQUIRE( position->IsSameBoard(*positionBeforeMove) == true );
+        REQUIRE( position->GetNumberOfCapturedStones(SgfcColor::White) == 0 );
+      }
+    }
+
+    WHEN( "The ruleset allows suicide" )
+    {
+      SgfcGoRuleset goRuleset;
+      goRuleset.GoRulesetType = GENERATE( SgfcGoRulesetType::Ing, SgfcGoRulesetType::NZ );
+      goRuleset.IsValid = true;
+      auto goReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(boardSize, goRuleset);
+      goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "ba", boardSize));
+      goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "ab", boardSize));
+
+      auto moveLegality = goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, "aa", boardSize));
+
+      THEN( "The move is legal and the suicided stones are removed from the board" )
+      {
+        REQUIRE( moveLegality == SgfcGoMoveLegality::Legal );
+        auto position = goReplayEngine->GetPosition();
+        REQUIRE( position->HasStone(1, 1) == false );
+        REQUIRE( position->GetNumberOfCapturedStones(SgfcColor::White) == 1 );
+      }
+    }
+  }
+
+  GIVEN( "A ko is retaken immediately" )
+  {
+    WHEN( "The ruleset uses the basic ko rule" )
+    {
+      SgfcGoRuleset goRuleset;
+      goRuleset.GoRulesetType = GENERATE( SgfcGoRulesetType::Ing, SgfcGoRulesetType::Japanese );
+      goRuleset.IsValid = true;
+      auto goReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(boardSize, goRuleset);
+      CreateKoShape(*goReplayEngine);
+
+      auto koMoveLegality = goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "cb", boardSize));
+      auto positionAfterKoMove = goReplayEngine->GetPosition();
+      auto retakeMoveLegality = goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, "bb", boardSize));
+
+      THEN( "The immediate retake is illegal" )
+      {
+        REQUIRE( koMoveLegality == SgfcGoMoveLegality::Legal );
+        REQUIRE( positionAfterKoMove->GetNumberOfCapturedStones(SgfcColor::White) == 1 );
+        REQUIRE( retakeMoveLegality == SgfcGoMoveLegality::Ko );
+        REQUIRE( goReplayEngine->GetPosition()->IsSameBoard(*positionAfterKoMove) == true );
+      }
+
+      THEN( "The retake is legal after moves elsewhere" )
+      {
+        goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, "pp", boardSize));
+        goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "pd", boardSize));
+
+        REQUIRE( goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, "bb", boardSize)) == SgfcGoMoveLegality::Legal );
+        REQUIRE( goReplayEngine->GetPosition()->GetNumberOfCapturedStones(SgfcColor::Black) == 1 );
+      }
+    }
+
+    WHEN( "The ruleset uses situational superko" )
+    {
+      SgfcGoRuleset goRuleset;
+      goRuleset.GoRulesetType = GENERATE( SgfcGoRulesetType::AGA, SgfcGoRulesetType::NZ );
+      goRuleset.IsValid = true;
+      auto goReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(boardSize, goRuleset);
+      CreateKoShape(*goReplayEngine);
+
+      goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "cb", boardSize));
+      auto retakeMoveLegality = goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, "bb", boardSize));
+
+      THEN( "The immediate retake is illegal" )
+      {
+        REQUIRE( retakeMoveLegality == SgfcGoMoveLegality::Superko );
+      }
+
+      THEN( "The retake is legal after moves elsewhere" )
+      {
+        goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, "pp", boardSize));
+        goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "pd", boardSize));
+
+        REQUIRE( goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, "bb", boardSize)) == SgfcGoMoveLegality::Legal );
+      }
+    }
+
+    WHEN( "The position history is shared with a copy of the replay engine" )
+    {
+      SgfcGoRuleset goRuleset;
+      goRuleset.GoRulesetType = SgfcGoRulesetType::AGA;
+      goRuleset.IsValid = true;
+      SgfcGoReplayEngine goReplayEngine(boardSize, goRuleset);
+      CreateKoShape(goReplayEngine);
+
+      goReplayEngine.ApplyGoMove(CreateGoMove(SgfcColor::Black, "cb", boardSize));
+      goReplayEngine.SharePositionHistory();
+      SgfcGoReplayEngine copiedGoReplayEngine = goReplayEngine;
+
+      THEN( "Both replay engines detect the superko" )
+      {
+        REQUIRE( goReplayEngine.ApplyGoMove(CreateGoMove(SgfcColor::White, "bb", boardSize)) == SgfcGoMoveLegality::Superko );
+        REQUIRE( copiedGoReplayEngine.ApplyGoMove(CreateGoMove(SgfcColor::White, "bb", boardSize)) == SgfcGoMoveLegality::Superko );
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcGoReplayEngine replays nodes", "[go]" )
+{
+  SgfcBoardSize boardSize = SgfcConstants::BoardSizeDefaultGo;
+  SgfcGoRuleset goRuleset;
+  goRuleset.GoRulesetType = SgfcGoRulesetType::Japanese;
+  goRuleset.IsValid = true;
+  auto goReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(boardSize, goRuleset);
+  auto propertyFactory = SgfcPlusPlusFactory::CreatePropertyFactory();
+  auto propertyValueFactory = SgfcPlusPlusFactory::CreatePropertyValueFactory();
+
+  GIVEN( "A node contains setup properties" )
+  {
+    auto setupNode = std::make_shared<SgfcNode>();
+    setupNode->SetProperties(
+    {
+      propertyFactory->CreateProperty(
+        SgfcPropertyType::AB,
+        std::vector<std::shared_ptr<ISgfcPropertyValue>>
+        {
+          propertyValueFactory->CreateComposedGoPointAndGoPointPropertyValue("aa", "cc", boardSize),
+          propertyValueFactory->CreateGoStonePropertyValue("dd", boardSize, SgfcColor::Black),
+        }),
+      propertyFactory->CreateProperty(
+        SgfcPropertyType::AW, propertyValueFactory->CreateGoStonePropertyValue("ee", boardSize, SgfcColor::White)),
+      propertyFactory->CreateProperty(
+        SgfcPropertyType::AE, propertyValueFactory->CreateGoPointPropertyValue("bb", boardSize)),
+    });
+
+    WHEN( "The node is applied" )
+    {
+      auto moveLegality = goReplayEngine->ApplyNode(setupNode);
+
+      THEN( "The setup stones are placed on the board" )
+      {
+        REQUIRE( moveLegality == SgfcGoMoveLegality::Legal );
+        auto position = goReplayEngine->GetPosition();
+        REQUIRE( position->GetNumberOfStones(SgfcColor::Black) == 9 );
+        REQUIRE( position->GetNumberOfStones(SgfcColor::White) == 1 );
+        REQUIRE( position->GetStoneColor(3, 3) == SgfcColor::Black );
+        REQUIRE( position->GetStoneColor(4, 4) == SgfcColor::Black );
+        REQUIRE( position->GetStoneColor(5, 5) == SgfcColor::White );
+        REQUIRE( position->HasStone(2, 2) == false );
+      }
+    }
+  }
+
+  GIVEN( "A sequence of nodes contains an illegal move" )
+  {
+    auto firstMoveNode = std::make_shared<SgfcNode>();
+    auto secondMoveNode = std::make_shared<SgfcNode>();
+    auto illegalMoveNode = std::make_shared<SgfcNode>();
+    auto fourthMoveNode = std::make_shared<SgfcNode>();
+    firstMoveNode->SetProperty(propertyFactory->CreateProperty(
+      SgfcPropertyType::B, propertyValueFactory->CreateGoMovePropertyValue("dd", boardSize, SgfcColor::Black)));
+    secondMoveNode->SetProperty(propertyFactory->CreateProperty(
+      SgfcPropertyType::W, propertyValueFactory->CreateGoMovePropertyValue(SgfcColor::White)));
+    illegalMoveNode->SetProperty(propertyFactory->CreateProperty(
+      SgfcPropertyType::B, propertyValueFactory->CreateGoMovePropertyValue("dd", boardSize, SgfcColor::Black)));
+    fourthMoveNode->SetProperty(propertyFactory->CreateProperty(
+      SgfcPropertyType::W, propertyValueFactory->CreateGoMovePropertyValue("pp", boardSize, SgfcColor::White)));
+
+    WHEN( "The nodes are replayed" )
+    {
+      auto replayResult = goReplayEngine->ReplayNodes(
+        { firstMoveNode, secondMoveNode, illegalMoveNode, fourthMoveNode });
+
+      THEN( "The replay stops at the illegal move" )
+      {
+        REQUIRE( replayResult.MoveLegality == SgfcGoMoveLegality::IntersectionOccupied );
+        REQUIRE( replayResult.IllegalMoveNode == illegalMoveNode );
+        REQUIRE( replayResult.NumberOfMoves == 2 );
+        auto position = goReplayEngine->GetPosition();
+        REQUIRE( position->GetNumberOfStones(SgfcColor::Black) == 1 );
+        REQUIRE( position->GetNumberOfStones(SgfcColor::White) == 0 );
+      }
+    }
+
+    WHEN( "The nodes before the illegal move are replayed" )
+    {
+      auto game = std::make_shared<SgfcGame>();
+      SgfcTreeBuilder treeBuilder(game);
+      game->SetRootNode(firstMoveNode);
+      treeBuilder.SetFirstChild(firstMoveNode, secondMoveNode);
+      treeBuilder.SetFirstChild(secondMoveNode, illegalMoveNode);
+      treeBuilder.SetNextSibling(illegalMoveNode, fourthMoveNode);
+
+      auto replayResult = goReplayEngine->ReplayToNode(fourthMoveNode);
+
+      THEN( "The replay succeeds" )
+      {
+        REQUIRE( replayResult.MoveLegality == SgfcGoMoveLegality::Legal );
+        REQUIRE( replayResult.IllegalMoveNode == nullptr );
+        REQUIRE( replayResult.NumberOfMoves == 3 );
+        auto position = goReplayEngine->GetPosition();
+        REQUIRE( position->GetStoneColor(4, 4) == SgfcColor::Black );
+        REQUIRE( position->GetStoneColor(16, 16) == SgfcColor::White );
+      }
+    }
+
+    WHEN( "A node contains a move property without a valid value" )
+    {
+      auto invalidMoveNode = std::make_shared<SgfcNode>();
+      invalidMoveNode->SetProperty(propertyFactory->CreateProperty(SgfcPropertyType::B));
+
+      THEN( "The move is illegal" )
+      {
+        REQUIRE( goReplayEngine->ApplyNode(invalidMoveNode) == SgfcGoMoveLegality::InvalidMoveValue );
+      }
+    }
+  }
+
+  GIVEN( "The replay functions are invoked with invalid data" )
+  {
+    WHEN( "The functions are invoked" )
+    {
+      THEN( "The functions throw an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          goReplayEngine->ApplyNode(nullptr),
+          std::invalid_argument);
+        REQUIRE_THROWS_AS(
+          goReplayEngine->ReplayNodes({ std::make_shared<SgfcNode>(), nullptr }),
+          std::invalid_argument);
+        REQUIRE_THROWS_AS(
+          goReplayEngine->ReplayToNode(nullptr),
+          std::invalid_argument);
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcGoReplayEngine maintains the Zobrist hash of the position", "[go]" )
+{
+  SgfcGoRuleset goRuleset;
+  goRuleset.GoRulesetType = SgfcGoRulesetType::Japanese;
+  goRuleset.IsValid = true;
+  SgfcBoardSize boardSize = SgfcConstants::BoardSizeDefaultGo;
+
+  auto goReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(boardSize, goRuleset);
+
+  GIVEN( "Positions are compared by their Zobrist hash" )
+  {
+    WHEN( "The boards are empty" )
+    {
+      auto otherGoReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(boardSize, goRuleset);
+      auto smallBoardGoReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(SgfcConstants::BoardSizeMinimum, goRuleset);
+
+      THEN( "The hash depends only on the board size" )
+      {
+        REQUIRE( goReplayEngine->GetPosition()->GetZobristHash() == otherGoReplayEngine->GetPosition()->GetZobristHash() );
+        REQUIRE( goReplayEngine->GetPosition()->GetZobristHash() != smallBoardGoReplayEngine->GetPosition()->GetZobristHash() );
+      }
+    }
+
+    WHEN( "The same position is reached with moves played in a different order" )
+    {
+      goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "dd", boardSize));
+      goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, "pp", boardSize));
+      goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "dp", boardSize));
+
+      auto otherGoReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(boardSize, goRuleset);
+      otherGoReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "dp", boardSize));
+      otherGoReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, "pp", boardSize));
+      otherGoReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "dd", boardSize));
+
+      THEN( "The hashes are equal" )
+      {
+        REQUIRE( goReplayEngine->GetPosition()->GetZobristHash() == otherGoReplayEngine->GetPosition()->GetZobristHash() );
+      }
+    }
+
+    WHEN( "The positions differ in the color of a stone" )
+    {
+      goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "dd", boardSize));
+
+      auto otherGoReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(boardSize, goRuleset);
+      otherGoReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, "dd", boardSize));
+
+      THEN( "The hashes are different" )
+      {
+        REQUIRE( goReplayEngine->GetPosition()->GetZobristHash() != otherGoReplayEngine->GetPosition()->GetZobristHash() );
+      }
+    }
+
+    WHEN( "Stones are captured" )
+    {
+      CreateKoShape(*goReplayEngine);
+      goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "cb", boardSize));
+
+      // The same stones, placed without ever placing the captured stone
+      auto otherGoReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(boardSize, goRuleset);
+      for (const auto& position : { "ba", "ab", "bc", "cb" })
+        otherGoReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, position, boardSize));
+      for (const auto& position : { "ca", "db", "cc" })
+        otherGoReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, position, boardSize));
+
+      THEN( "The captured stones no longer contribute to the hash" )
+      {
+        REQUIRE( goReplayEngine->GetPosition()->GetNumberOfCapturedStones(SgfcColor::White) == 1 );
+        REQUIRE( goReplayEngine->GetPosition()->IsSameBoard(*otherGoReplayEngine->GetPosition()) == true );
+        REQUIRE( goReplayEngine->GetPosition()->GetZobristHash() == otherGoReplayEngine->GetPosition()->GetZobristHash() );
+      }
+    }
+  }
+
+  GIVEN( "Positions are compared by their canonical Zobrist hash" )
+  {
+    WHEN( "The positions are rotations and reflections of each other on a square board" )
+    {
+      // All 8 symmetric images of a Black stone on "cd" and a White stone on
+      // "ef" on a 19x19 board
+      std::string blackPosition = GENERATE( "cd", "dc", "qd", "pc", "cp", "dq", "qp", "pq" );
+
+      std::map<std::string, std::string> blackToWhitePositionMap =
+      {
+        { "cd", "ef" }, { "dc", "fe" }, { "qd", "of" }, { "pc", "ne" },
+        { "cp", "en" }, { "dq", "fo" }, { "qp", "on" }, { "pq", "no" },
+      };
+
+      goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "cd", boardSize));
+      goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, "ef", boardSize));
+
+      auto otherGoReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(boardSize, goRuleset);
+      otherGoReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, blackPosition, boardSize));
+      otherGoReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, blackToWhitePositionMap[blackPosition], boardSize));
+
+      THEN( "The canonical hashes are equal" )
+      {
+        REQUIRE( goReplayEngine->GetPosition()->GetCanonicalZobristHash() == otherGoReplayEngine->GetPosition()->GetCanonicalZobristHash() );
+        if (blackPosition != "cd")
+          REQUIRE( goReplayEngine->GetPosition()->GetZobristHash() != otherGoReplayEngine->GetPosition()->GetZobristHash() );
+      }
+    }
+
+    WHEN( "The positions are not symmetric images of each other" )
+    {
+      goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "cd", boardSize));
+      goReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, "ef", boardSize));
+
+      auto otherGoReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(boardSize, goRuleset);
+      otherGoReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "cd", boardSize));
+      otherGoReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::White, "fe", boardSize));
+
+      THEN( "The canonical hashes are different" )
+      {
+        REQUIRE( goReplayEngine->GetPosition()->GetCanonicalZobristHash() != otherGoReplayEngine->GetPosition()->GetCanonicalZobristHash() );
+      }
+    }
+
+    WHEN( "The positions are on a rectangular board" )
+    {
+      SgfcBoardSize rectangularBoardSize = { 7, 13 };
+      auto rectangularGoReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(rectangularBoardSize, goRuleset);
+      rectangularGoReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "ab", rectangularBoardSize));
+
+      // 180 degree rotation
+      auto rotatedGoReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(rectangularBoardSize, goRuleset);
+      rotatedGoReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "gl", rectangularBoardSize));
+
+      // Swapping columns and rows is not a symmetry of a rectangular board
+      auto transposedGoReplayEngine = SgfcPlusPlusFactory::CreateGoReplayEngine(rectangularBoardSize, goRuleset);
+      transposedGoReplayEngine->ApplyGoMove(CreateGoMove(SgfcColor::Black, "ba", rectangularBoardSize));
+
+      THEN( "Only rotations and reflections that preserve the board shape are considered" )
+      {
+        REQUIRE( rectangularGoReplayEngine->GetPosition()->GetCanonicalZobristHash() == rotatedGoReplayEngine->GetPosition()->GetCanonicalZobristHash() );
+        REQUIRE( rectangularGoReplayEngine->GetPosition()->GetCanonicalZobristHash() != transposedGoReplayEngine->GetPosition()->GetCanonicalZobristHash() );
+      }
+    }
+  }
+}
+
+std::shared_ptr<ISgfcGoMove> CreateGoMove(SgfcColor color, const std::string& position, SgfcBoardSize boardSize)
+{
+  auto goPoint = std::make_shared<SgfcGoPoint>(position, boardSize);
+  auto goStone = std::make_shared<SgfcGoStone>(color, goPoint);
+  return std::make_shared<SgfcGoMove>(goStone);
+}
+
+/// Creates the following shape in the upper-left corner of the board. The
+/// ko can be started by Black playing on "cb", capturing the White stone
+/// on "bb".
+///
+///   a b c d
+/// a . X O .
+/// b X O . O
+/// c . X O .
+void CreateKoShape(ISgfcGoReplayEngine& goReplayEngine)
+{
+  SgfcBoardSize boardSize = goReplayEngine.GetBoardSize();
+
+  goReplayEngine.ApplyGoMove(CreateGoMove(SgfcColor::Black, "ba", boardSize));
+  goReplayEngine.ApplyGoMove(CreateGoMove(SgfcColor::Black, "ab", boardSize));
+  goReplayEngine.ApplyGoMove(CreateGoMove(SgfcColor::Black, "bc", boardSize));
+  goReplayEngine.ApplyGoMove(CreateGoMove(SgfcColor::White, "ca", boardSize));
+  goReplayEngine.ApplyGoMove(CreateGoMove(SgfcColor::White, "bb", boardSize));
+  goReplayEngine.ApplyGoMove(CreateGoMove(SgfcColor::White, "db", boardSize));
+  goReplayEngine.ApplyGoMove(CreateGoMove(SgfcColor::White, "cc", boardSize));
+}
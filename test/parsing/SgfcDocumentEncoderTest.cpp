@@ -0,0 +1,388 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Library includes
+#include <document/SgfcDocument.h>
+#include <document/SgfcGame.h>
+#include <ISgfcDocument.h>
+#include <ISgfcGame.h>
+#include <ISgfcNode.h>
+#include <ISgfcNumberPropertyValue.h>
+#include <ISgfcPropertyFactory.h>
+#include <ISgfcPropertyValueFactory.h>
+#include <ISgfcTextPropertyValue.h>
+#include <ISgfcTreeBuilder.h>
+#include <parsing/SgfcDocumentEncoder.h>
+#include <parsing/SgfcDocumentEncoderCache.h>
+#include <SgfcPlusPlusFactory.h>
+
+// Unit test library includes
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+// C++ Standard Library includes
+#include <stdexcept>
+
+using namespace LibSgfcPlusPlus;
+
+
+std::shared_ptr<ISgfcNode> CreateEncoderTestNode(std::size_t nodeNumber);
+void AppendEncoderTestMainVariation(std::shared_ptr<ISgfcGame> game, std::shared_ptr<ISgfcNode> node, std::size_t numberOfNodes, std::size_t& nodeNumber);
+std::shared_ptr<ISgfcDocument> CreateIncrementalEncoderTestDocument(std::size_t& nodeNumber);
+std::string EncodeWithoutEncoderCache(std::shared_ptr<ISgfcDocument> document);
+
+
+SCENARIO( "SgfcDocumentEncoder encodes a document", "[parsing]" )
+{
+  GIVEN( "A game has variations" )
+  {
+    auto document = std::shared_ptr<ISgfcDocument>(new SgfcDocument());
+
+    auto rootNode = SgfcPlusPlusFactory::CreateNode();
+    auto game = SgfcPlusPlusFactory::CreateGame(rootNode);
+    document->AppendGame(game);
+
+    auto treeBuilder = game->GetTreeBuilder();
+    auto variationNode1 = SgfcPlusPlusFactory::CreateNode();
+    auto variationNode2 = SgfcPlusPlusFactory::CreateNode();
+    treeBuilder->AppendChild(rootNode, variationNode1);
+    treeBuilder->AppendChild(rootNode, variationNode2);
+    treeBuilder->AppendChild(variationNode1, SgfcPlusPlusFactory::CreateNode());
+
+    WHEN( "The document is encoded" )
+    {
+      auto numberOfThreads = GENERATE( 1u, 4u );
+      SgfcDocumentEncoder encoder(document, numberOfThreads);
+      std::string sgfContent = encoder.Encode();
+
+      THEN( "The variations are enclosed in parentheses and indented" )
+      {
+        std::string expectedSgfContent =
+          "(\n"
+          "  ;\n"
+          "  (\n"
+          "    ;\n"
+          "    ;\n"
+          "  )\n"
+          "  (\n"
+          "    ;\n"
+          "  )\n"
+          ")\n";
+        REQUIRE( sgfContent == expectedSgfContent );
+      }
+    }
+  }
+
+  GIVEN( "The document has several large games with nested variations" )
+  {
+    auto document = std::shared_ptr<ISgfcDocument>(new SgfcDocument());
+
+    std::size_t nodeNumber = 0;
+
+    for (std::size_t gameIndex = 0; gameIndex < 3; gameIndex++)
+    {
+      auto rootNode = CreateEncoderTestNode(nodeNumber++);
+      auto game = SgfcPlusPlusFactory::CreateGame(rootNode);
+      document->AppendGame(game);
+
+      // A long main variation that branches off variations that are long
+      // enough to be encoded separately, and that branch off variations of
+      // their own
+      auto treeBuilder = game->GetTreeBuilder();
+      auto node = rootNode;
+      for (std::size_t branchIndex = 0; branchIndex < 10; branchIndex++)
+      {
+        auto variationNode = CreateEncoderTestNode(nodeNumber++);
+        auto mainVariationNode = CreateEncoderTestNode(nodeNumber++);
+        treeBuilder->AppendChild(node, mainVariationNode);
+        treeBuilder->AppendChild(node, variationNode);
+
+        AppendEncoderTestMainVariation(game, variationNode, 300, nodeNumber);
+        auto nestedVariationNode = CreateEncoderTestNode(nodeNumber++);
+        treeBuilder->AppendChild(variationNode, nestedVariationNode);
+        AppendEncoderTestMainVariation(game, nestedVariationNode, 600, nodeNumber);
+
+        node = mainVariationNode;
+        for (std::size_t moveIndex = 0; moveIndex < 100; moveIndex++)
+        {
+          auto childNode = CreateEncoderTestNode(nodeNumber++);
+          treeBuilder->AppendChild(node, childNode);
+          node = childNode;
+        }
+      }
+    }
+
+    // A small game that cannot be split
+    document->AppendGame(SgfcPlusPlusFactory::CreateGame(CreateEncoderTestNode(nodeNumber++)));
+
+    WHEN( "The document is encoded on multiple threads" )
+    {
+      SgfcDocumentEncoder singleThreadEncoder(document);
+      std::string expectedSgfContent = singleThreadEncoder.Encode();
+
+      auto numberOfThreads = GENERATE( 2u, 3u, 8u, 0u );
+      SgfcDocumentEncoder encoder(document, numberOfThreads);
+      std::string sgfContent = encoder.Encode();
+
+      THEN( "The SGF content is the same as when the document is encoded on a single thread" )
+      {
+        REQUIRE( sgfContent.length() == expectedSgfContent.length() );
+        REQUIRE( sgfContent == expectedSgfContent );
+      }
+    }
+  }
+
+  GIVEN( "A game has no root node" )
+  {
+    auto document = std::shared_ptr<ISgfcDocument>(new SgfcDocument());
+
+    document->AppendGame(SgfcPlusPlusFactory::CreateGame(SgfcPlusPlusFactory::CreateNode()));
+    document->AppendGame(std::shared_ptr<ISgfcGame>(new SgfcGame()));
+
+    WHEN( "The document is encoded" )
+    {
+      auto numberOfThreads = GENERATE( 1u, 4u );
+      SgfcDocumentEncoder encoder(document, numberOfThreads);
+
+      THEN( "The encoding operation throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          encoder.Encode(),
+          std::logic_error);
+      }
+    }
+  }
+
+  GIVEN( "The document has no games" )
+  {
+    auto document = std::shared_ptr<ISgfcDocument>(new SgfcDocument());
+    WHEN( "The document is encoded" )
+    {
+      auto numberOfThreads = GENERATE( 1u, 4u );
+      SgfcDocumentEncoder encoder(document, numberOfThreads);
+
+      THEN( "The SGF content is empty" )
+      {
+        REQUIRE( encoder.Encode() == "" );
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcDocumentEncoder encodes a document incrementally", "[parsing]" )
+{
+  GIVEN( "The document has not been encoded yet" )
+  {
+    std::size_t nodeNumber = 0;
+    auto document = CreateIncrementalEncoderTestDocument(nodeNumber);
+    auto encoderCache = std::shared_ptr<SgfcDocumentEncoderCache>(new SgfcDocumentEncoderCache());
+
+    WHEN( "The document is encoded" )
+    {
+      auto numberOfThreads = GENERATE( 1u, 4u );
+      SgfcDocumentEncoder encoder(document, numberOfThreads, encoderCache);
+      std::string sgfContent = encoder.Encode();
+
+      THEN( "The SGF content is the same as when the document is encoded without cache" )
+      {
+        REQUIRE( sgfContent == EncodeWithoutEncoderCache(document) );
+        REQUIRE( encoderCache->GetGameEntry(document->GetGame()->GetRootNode().get()) != nullptr );
+      }
+    }
+  }
+
+  GIVEN( "The properties of a node deep down in the game tree were modified" )
+  {
+    std::size_t nodeNumber = 0;
+    auto document = CreateIncrementalEncoderTestDocument(nodeNumber);
+    auto encoderCache = std::shared_ptr<SgfcDocumentEncoderCache>(new SgfcDocumentEncoderCache());
+    SgfcDocumentEncoder encoder(document, 1, encoderCache);
+    encoder.Encode();
+
+    auto rootNode = document->GetGame()->GetRootNode();
+    auto gameEntryBefore = encoderCache->GetGameEntry(rootNode.get());
+    auto leafNode = rootNode->GetFirstChild();
+    while (leafNode->HasChildren())
+      leafNode = leafNode->GetFirstChild();
+    leafNode->SetProperties(CreateEncoderTestNode(nodeNumber++)->GetProperties());
+
+    WHEN( "The document is encoded again" )
+    {
+      std::string sgfContent = encoder.Encode();
+
+      THEN( "The SGF content reflects the modification and the SGF content of unmodified subtrees is reused" )
+      {
+        REQUIRE( sgfContent == EncodeWithoutEncoderCache(document) );
+
+        auto gameEntryAfter = encoderCache->GetGameEntry(rootNode.get());
+        REQUIRE( gameEntryAfter != gameEntryBefore );
+        REQUIRE( gameEntryAfter->Children.size() == 2 );
+        REQUIRE( gameEntryAfter->Children[0] != gameEntryBefore->Children[0] );
+        REQUIRE( gameEntryAfter->Children[1] == gameEntryBefore->Children[1] );
+      }
+    }
+  }
+
+  GIVEN( "The structure of the game tree was modified" )
+  {
+    std::size_t nodeNumber = 0;
+    auto document = CreateIncrementalEncoderTestDocument(nodeNumber);
+    auto encoderCache = std::shared_ptr<SgfcDocumentEncoderCache>(new SgfcDocumentEncoderCache());
+    SgfcDocumentEncoder encoder(document, 1, encoderCache);
+    encoder.Encode();
+
+    auto game = document->GetGame();
+    auto treeBuilder = game->GetTreeBuilder();
+    auto rootNode = game->GetRootNode();
+    auto mainVariationNode = rootNode->GetFirstChild()->GetFirstChild();
+
+    // The first change turns a node into a variation, which changes the
+    // indentation of the subtree. The second change turns a variation back
+    // into a node that is not a variation.
+    treeBuilder->AppendChild(mainVariationNode->GetParent(), CreateEncoderTestNode(nodeNumber++));
+    treeBuilder->RemoveChild(rootNode, rootNode->GetLastChild());
+
+    WHEN( "The document is encoded again" )
+    {
+      std::string sgfContent = encoder.Encode();
+
+      THEN( "The SGF content is the same as when the document is encoded without cache" )
+      {
+        REQUIRE( sgfContent == EncodeWithoutEncoderCache(document) );
+      }
+    }
+  }
+
+  GIVEN( "The document was not modified" )
+  {
+    std::size_t nodeNumber = 0;
+    auto document = CreateIncrementalEncoderTestDocument(nodeNumber);
+    auto encoderCache = std::shared_ptr<SgfcDocumentEncoderCache>(new SgfcDocumentEncoderCache());
+    SgfcDocumentEncoder encoder(document, 1, encoderCache);
+    std::string expectedSgfContent = encoder.Encode();
+
+    auto rootNode = document->GetGame()->GetRootNode();
+    auto gameEntryBefore = encoderCache->GetGameEntry(rootNode.get());
+
+    WHEN( "The document is encoded again" )
+    {
+      std::string sgfContent = encoder.Encode();
+
+      THEN( "The SGF content is the same and the entire cache is reused" )
+      {
+        REQUIRE( sgfContent == expectedSgfContent );
+        REQUIRE( encoderCache->GetGameEntry(rootNode.get()) == gameEntryBefore );
+      }
+    }
+  }
+
+  GIVEN( "A different document is encoded with the same cache" )
+  {
+    std::size_t nodeNumber = 0;
+    auto document = CreateIncrementalEncoderTestDocument(nodeNumber);
+    auto otherDocument = CreateIncrementalEncoderTestDocument(nodeNumber);
+    auto encoderCache = std::shared_ptr<SgfcDocumentEncoderCache>(new SgfcDocumentEncoderCache());
+    SgfcDocumentEncoder encoder(document, 1, encoderCache);
+    encoder.Encode();
+
+    WHEN( "The other document is encoded" )
+    {
+      SgfcDocumentEncoder otherEncoder(otherDocument, 1, encoderCache);
+      std::string sgfContent = otherEncoder.Encode();
+
+      THEN( "The SGF content is correct and the cache contains only the other document" )
+      {
+        REQUIRE( sgfContent == EncodeWithoutEncoderCache(otherDocument) );
+        REQUIRE( encoderCache->GetGameEntry(document->GetGame()->GetRootNode().get()) == nullptr );
+        REQUIRE( encoderCache->GetGameEntry(otherDocument->GetGame()->GetRootNode().get()) != nullptr );
+      }
+    }
+  }
+
+  GIVEN( "The encoder cache is nullptr" )
+  {
+    auto document = std::shared_ptr<ISgfcDocument>(new SgfcDocument());
+
+    WHEN( "SgfcDocumentEncoder is constructed" )
+    {
+      THEN( "The constructor throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          SgfcDocumentEncoder(document, 1, nullptr),
+          std::invalid_argument);
+      }
+    }
+  }
+}
+
+std::shared_ptr<ISgfcNode> CreateEncoderTestNode(std::size_t nodeNumber)
+{
+  auto propertyFactory = SgfcPlusPlusFactory::CreatePropertyFactory();
+  auto propertyValueFactory = SgfcPlusPlusFactory::CreatePropertyValueFactory();
+
+  std::shared_ptr<ISgfcPropertyValue> moveNumberPropertyValue =
+    propertyValueFactory->CreateNumberPropertyValue(static_cast<SgfcNumber>(nodeNumber));
+  // The comment contains characters that must be escaped
+  std::shared_ptr<ISgfcPropertyValue> commentPropertyValue =
+    propertyValueFactory->CreateTextPropertyValue("Node " + std::to_string(nodeNumber) + " [a]\\b");
+
+  std::vector<std::shared_ptr<ISgfcProperty>> properties;
+  properties.push_back(propertyFactory->CreateProperty(SgfcPropertyType::MN, moveNumberPropertyValue));
+  properties.push_back(propertyFactory->CreateProperty(SgfcPropertyType::C, commentPropertyValue));
+
+  auto node = SgfcPlusPlusFactory::CreateNode();
+  node->SetProperties(properties);
+  return node;
+}
+
+void AppendEncoderTestMainVariation(std::shared_ptr<ISgfcGame> game, std::shared_ptr<ISgfcNode> node, std::size_t numberOfNodes, std::size_t& nodeNumber)
+{
+  auto treeBuilder = game->GetTreeBuilder();
+
+  for (std::size_t nodeIndex = 0; nodeIndex < numberOfNodes; nodeIndex++)
+  {
+    auto childNode = CreateEncoderTestNode(nodeNumber++);
+    treeBuilder->AppendChild(node, childNode);
+    node = childNode;
+  }
+}
+
+std::shared_ptr<ISgfcDocument> CreateIncrementalEncoderTestDocument(std::size_t& nodeNumber)
+{
+  auto document = std::shared_ptr<ISgfcDocument>(new SgfcDocument());
+
+  auto rootNode = CreateEncoderTestNode(nodeNumber++);
+  auto game = SgfcPlusPlusFactory::CreateGame(rootNode);
+  document->AppendGame(game);
+
+  // Two variations below the root node, the first of which is long enough
+  // to be encoded in several chunks
+  auto treeBuilder = game->GetTreeBuilder();
+  for (std::size_t variationIndex = 0; variationIndex < 2; variationIndex++)
+  {
+    auto variationNode = CreateEncoderTestNode(nodeNumber++);
+    treeBuilder->AppendChild(rootNode, variationNode);
+    AppendEncoderTestMainVariation(game, variationNode, variationIndex == 0 ? 600 : 10, nodeNumber);
+  }
+
+  return document;
+}
+
+std::string EncodeWithoutEncoderCache(std::shared_ptr<ISgfcDocument> document)
+{
+  SgfcDocumentEncoder encoder(document);
+  return encoder.Encode();
+}
@@ -522,3 +522,51 @@ SCENARIO( "SgfcArguments is cleared", "[argument]" )
     }
   }
 }
+
+SCENARIO( "SgfcArguments is copied", "[argument]" )
+{
+  SgfcArguments sourceArguments;
+  SgfcArguments destinationArguments;
+  destinationArguments.AddArgument(SgfcArgumentType::DeleteEmptyNodes);
+
+  GIVEN( "The source contains arguments with all kinds of parameters" )
+  {
+    sourceArguments.AddArgument(SgfcArgumentType::DeleteUnknownProperties);
+    sourceArguments.AddArgument(SgfcArgumentType::BeginningOfSgfData, 2);
+    sourceArguments.AddArgument(SgfcArgumentType::DefaultEncoding, "UTF-8");
+    sourceArguments.AddArgument(SgfcArgumentType::DeletePropertyType, SgfcPropertyType::GM);
+    sourceArguments.AddArgument(SgfcArgumentType::DisableMessageID, SgfcMessageID::UnknownPropertyDeleted);
+
+    WHEN( "The arguments are copied" )
+    {
+      SgfcArguments::CopyArguments(sourceArguments, destinationArguments);
+
+      THEN( "The destination contains copies of the source arguments and nothing else" )
+      {
+        auto sourceArgumentsCollection = sourceArguments.GetArguments();
+        auto destinationArgumentsCollection = destinationArguments.GetArguments();
+        REQUIRE( destinationArgumentsCollection.size() == sourceArgumentsCollection.size() );
+        for (std::size_t argumentIndex = 0; argumentIndex < sourceArgumentsCollection.size(); argumentIndex++)
+        {
+          auto sourceArgument = sourceArgumentsCollection[argumentIndex];
+          auto destinationArgument = destinationArgumentsCollection[argumentIndex];
+          REQUIRE( destinationArgument != sourceArgument );
+          REQUIRE( destinationArgument->ToString() == sourceArgument->ToString() );
+        }
+      }
+    }
+  }
+
+  GIVEN( "The source contains no arguments" )
+  {
+    WHEN( "The arguments are copied" )
+    {
+      SgfcArguments::CopyArguments(sourceArguments, destinationArguments);
+
+      THEN( "The destination is cleared" )
+      {
+        REQUIRE( destinationArguments.HasArguments() == false );
+      }
+    }
+  }
+}
@@ -17,6 +17,7 @@
 // Library includes
 #include <sgfc/argument/SgfcArgument.h>
 #include <sgfc/backend/SgfcBackendController.h>
+#include <sgfc/backend/SgfcCompressionUtility.h>
 #include <SgfcConstants.h>
 #include <SgfcUtility.h>
 
@@ -270,6 +271,69 @@ SCENARIO( "SgfcBackendController loads SGF content from the filesystem", "[backe
 
     SgfcUtility::DeleteFileIfExists(tempFilePath);
   }
+
+  GIVEN( "The file exists and is a compressed .sgf file" )
+  {
+    auto compressionFormat = GENERATE( SgfcCompressionFormat::Gzip, SgfcCompressionFormat::Zstd );
+    std::string fileContent = "(;SZ[9]KM[6.5]B[aa])";
+
+    bool isCompressionFormatSupported = SgfcCompressionUtility::IsCompressionFormatSupported(compressionFormat);
+    if (isCompressionFormatSupported)
+      SgfcCompressionUtility::CompressToFile(fileContent, tempFilePath, compressionFormat);
+    else
+      SgfcUtility::AppendTextToFile(tempFilePath, compressionFormat == SgfcCompressionFormat::Gzip ? "\x1F\x8B" : "\x28\xB5\x2F\xFD");
+
+    WHEN( "SgfcBackendController performs the load operation" )
+    {
+      SgfcBackendController backendController(emptyCommandLineArguments);
+      auto loadResult = backendController.LoadSgfFile(tempFilePath);
+
+      THEN( "The load operation result indicates success if the compression format is supported, otherwise failure" )
+      {
+        if (isCompressionFormatSupported)
+        {
+          AssertLoadResultWhenSgfDataHasNoWarningsOrErrors(loadResult, fileContent);
+        }
+        else
+        {
+          auto parseResult = loadResult->GetParseResult();
+          REQUIRE( parseResult.size() == 1 );
+
+          auto errorMessage = parseResult.front();
+          REQUIRE( errorMessage->GetMessageType() == SgfcMessageType::FatalError );
+          REQUIRE( errorMessage->GetMessageID() == SgfcMessageID::ReadSgfContentFromFilesystemError );
+          REQUIRE( errorMessage->GetMessageText().length() > 0 );
+        }
+      }
+    }
+
+    SgfcUtility::DeleteFileIfExists(tempFilePath);
+  }
+
+  GIVEN( "The file exists and is a compressed .sgf file with corrupt data" )
+  {
+    std::string fileContent = GENERATE( "\x1F\x8B" "foobar", "\x28\xB5\x2F\xFD" "foobar" );
+    SgfcUtility::AppendTextToFile(tempFilePath, fileContent);
+
+    WHEN( "SgfcBackendController performs the load operation" )
+    {
+      SgfcBackendController backendController(emptyCommandLineArguments);
+      auto loadResult = backendController.LoadSgfFile(tempFilePath);
+
+      THEN( "The load operation result indicates failure" )
+      {
+        auto parseResult = loadResult->GetParseResult();
+        REQUIRE( parseResult.size() == 1 );
+
+        auto errorMessage = parseResult.front();
+        REQUIRE( errorMessage->GetMessageType() == SgfcMessageType::FatalError );
+        REQUIRE( errorMessage->GetMessageID() == SgfcMessageID::ReadSgfContentFromFilesystemError );
+        REQUIRE( errorMessage->GetMessageText().length() > 0 );
+      }
+    }
+
+    SgfcUtility::DeleteFileIfExists(tempFilePath);
+  }
 }
 
 SCENARIO( "SgfcBackendController loads SGF content from a string", "[backend]" )
@@ -450,6 +514,47 @@ SCENARIO( "SgfcBackendController saves SGF content to the filesystem", "[backend
 
     SgfcUtility::DeleteFileIfExists(tempFilePath);
   }
+
+  GIVEN( "The file name has the extension of a compression format" )
+  {
+    auto compressionFormat = GENERATE( SgfcCompressionFormat::Gzip, SgfcCompressionFormat::Zstd );
+    std::string compressedFilePath = tempFilePath + (compressionFormat == SgfcCompressionFormat::Gzip ? ".gz" : ".zst");
+
+    WHEN( "SgfcBackendController performs the save operation" )
+    {
+      std::string contentBuffer = "(;)";
+      auto backendDataWrapper = std::shared_ptr<SgfcBackendDataWrapper>(new SgfcBackendDataWrapper(contentBuffer));
+      SgfcBackendController backendController(emptyCommandLineArguments);
+      auto backendSaveResult = backendController.SaveSgfFile(compressedFilePath, backendDataWrapper);
+
+      THEN( "The save operation writes a compressed file if the compression format is supported, otherwise it fails" )
+      {
+        auto saveResult = backendSaveResult->GetSaveResult();
+
+        if (SgfcCompressionUtility::IsCompressionFormatSupported(compressionFormat))
+        {
+          REQUIRE( saveResult.size() == 0 );
+          REQUIRE( SgfcCompressionUtility::GetCompressionFormatOfFile(compressedFilePath) == compressionFormat );
+
+          std::size_t decompressedSize = 0;
+          char* decompressedBuffer = SgfcCompressionUtility::DecompressFile(compressedFilePath, compressionFormat, decompressedSize);
+          std::string fileContent(decompressedBuffer, decompressedSize);
+          free(decompressedBuffer);
+          REQUIRE( fileContent == expectedFileContent );
+        }
+        else
+        {
+          REQUIRE( saveResult.size() == 1 );
+
+          auto errorMessage = saveResult.front();
+          REQUIRE( errorMessage->GetMessageType() == SgfcMessageType::FatalError );
+          REQUIRE( errorMessage->GetMessageID() == SgfcMessageID::SaveSgfContentToFilesystemError );
+        }
+      }
+    }
+
+    SgfcUtility::DeleteFileIfExists(compressedFilePath);
+  }
 }
 
 SCENARIO( "SgfcBackendController saves SGF content to a string", "[backend]" )
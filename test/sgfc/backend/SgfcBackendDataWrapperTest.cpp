@@ -28,6 +28,9 @@ extern "C"
   #include <../sgfc/src/protos.h>
 }
 
+// C++ Standard Library includes
+#include <cstring>  // for memcpy()
+
 using namespace LibSgfcPlusPlus;
 
 SCENARIO( "SgfcBackendDataWrapper does not wrap a copy of an externally-provided content buffer", "[backend]" )
@@ -129,3 +132,37 @@ SCENARIO( "SgfcBackendDataWrapper wraps a copy of an externally-provided content
     }
   }
 }
+
+SCENARIO( "SgfcBackendDataWrapper takes ownership of an externally-provided content buffer", "[backend]" )
+{
+  GIVEN( "An external content buffer that was allocated with malloc() is provided" )
+  {
+    std::string content = GENERATE("f", "foobar");
+    char* contentBuffer = static_cast<char*>(malloc(content.size()));
+    memcpy(contentBuffer, content.c_str(), content.size());
+
+    WHEN( "SgfcBackendDataWrapper is constructed" )
+    {
+      SgfcBackendDataWrapper backendDataWrapper(contentBuffer, content.size());
+
+      THEN( "SgfcBackendDataWrapper wraps the external content buffer itself instead of a copy" )
+      {
+        auto sgfData = backendDataWrapper.GetSgfData();
+
+        REQUIRE( sgfData != nullptr );
+
+        REQUIRE( sgfData->first == nullptr );
+        REQUIRE( sgfData->tail == nullptr );
+        REQUIRE( sgfData->tree == nullptr );
+        REQUIRE( sgfData->last == nullptr );
+        REQUIRE( sgfData->info == nullptr );
+        REQUIRE( sgfData->root == nullptr );
+        REQUIRE( sgfData->start == nullptr );
+
+        REQUIRE( sgfData->buffer == contentBuffer );
+        REQUIRE( std::string(sgfData->buffer, content.size()) == content );
+        REQUIRE( sgfData->b_end == sgfData->buffer + content.size() );
+      }
+    }
+  }
+}
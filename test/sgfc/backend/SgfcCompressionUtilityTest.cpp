@@ -0,0 +1,307 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Library includes
+#include <sgfc/backend/SgfcCompressionUtility.h>
+#include <SgfcUtility.h>
+
+// Unit test library includes
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+// C++ Standard Library includes
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+using namespace LibSgfcPlusPlus;
+
+
+// Helper functions
+void WriteBinaryFileContent(const std::string& filePath, const std::string& content);
+std::string ReadBinaryFileContent(const std::string& filePath);
+std::string DecompressFileIntoString(const std::string& filePath, SgfcCompressionFormat compressionFormat);
+
+
+SCENARIO( "SgfcCompressionUtility detects the compression format", "[backend][filesystem]" )
+{
+  std::string tempFilePath = SgfcUtility::GetUniqueTempFilePath();
+
+  GIVEN( "A file whose content starts with a magic number" )
+  {
+    auto testData = GENERATE(
+      std::make_pair(std::string("\x1F\x8B" "foo"), SgfcCompressionFormat::Gzip),
+      std::make_pair(std::string("\x28\xB5\x2F\xFD" "foo"), SgfcCompressionFormat::Zstd),
+      std::make_pair(std::string("(;FF[4])"), SgfcCompressionFormat::None),
+      std::make_pair(std::string("\x1F"), SgfcCompressionFormat::None),
+      std::make_pair(std::string(""), SgfcCompressionFormat::None)
+    );
+    WriteBinaryFileContent(tempFilePath, testData.first);
+
+    WHEN( "The compression format of the file is determined" )
+    {
+      auto compressionFormat = SgfcCompressionUtility::GetCompressionFormatOfFile(tempFilePath);
+
+      THEN( "The compression format matches the magic number" )
+      {
+        REQUIRE( compressionFormat == testData.second );
+      }
+    }
+
+    SgfcUtility::DeleteFileIfExists(tempFilePath);
+  }
+
+  GIVEN( "The file does not exist" )
+  {
+    WHEN( "The compression format of the file is determined" )
+    {
+      auto compressionFormat = SgfcCompressionUtility::GetCompressionFormatOfFile(tempFilePath);
+
+      THEN( "The file is treated as not compressed" )
+      {
+        REQUIRE( compressionFormat == SgfcCompressionFormat::None );
+      }
+    }
+  }
+
+  GIVEN( "A file name" )
+  {
+    auto testData = GENERATE(
+      std::make_pair(std::string("foo.sgf.gz"), SgfcCompressionFormat::Gzip),
+      std::make_pair(std::string("foo.zst"), SgfcCompressionFormat::Zstd),
+      std::make_pair(std::string("foo.sgf"), SgfcCompressionFormat::None),
+      std::make_pair(std::string("gz"), SgfcCompressionFormat::None),
+      std::make_pair(std::string(""), SgfcCompressionFormat::None)
+    );
+
+    WHEN( "The compression format of the file name is determined" )
+    {
+      auto compressionFormat = SgfcCompressionUtility::GetCompressionFormatOfFileName(testData.first);
+
+      THEN( "The compression format matches the file name extension" )
+      {
+        REQUIRE( compressionFormat == testData.second );
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcCompressionUtility compresses and decompresses files", "[backend][filesystem]" )
+{
+  std::string tempFilePath = SgfcUtility::GetUniqueTempFilePath();
+
+  GIVEN( "The compression format is not supported by this build" )
+  {
+    auto compressionFormat = GENERATE( SgfcCompressionFormat::Gzip, SgfcCompressionFormat::Zstd );
+
+    WHEN( "A file is compressed or decompressed" )
+    {
+      THEN( "The operation throws an exception" )
+      {
+        if (! SgfcCompressionUtility::IsCompressionFormatSupported(compressionFormat))
+        {
+          std::size_t decompressedSize = 0;
+          REQUIRE_THROWS_AS(
+            SgfcCompressionUtility::CompressToFile("(;)", tempFilePath, compressionFormat),
+            std::invalid_argument);
+          REQUIRE_THROWS_AS(
+            SgfcCompressionUtility::DecompressFile(tempFilePath, compressionFormat, decompressedSize),
+            std::invalid_argument);
+        }
+      }
+    }
+  }
+
+  GIVEN( "The compression format is SgfcCompressionFormat::None" )
+  {
+    WHEN( "A file is compressed or decompressed" )
+    {
+      THEN( "The operation throws an exception" )
+      {
+        std::size_t decompressedSize = 0;
+        REQUIRE_THROWS_AS(
+          SgfcCompressionUtility::CompressToFile("(;)", tempFilePath, SgfcCompressionFormat::None),
+          std::invalid_argument);
+        REQUIRE_THROWS_AS(
+          SgfcCompressionUtility::DecompressFile(tempFilePath, SgfcCompressionFormat::None, decompressedSize),
+          std::invalid_argument);
+      }
+    }
+  }
+
+  GIVEN( "The compression format is supported by this build" )
+  {
+    auto compressionFormat = GENERATE( SgfcCompressionFormat::Gzip, SgfcCompressionFormat::Zstd );
+    bool isCompressionFormatSupported = SgfcCompressionUtility::IsCompressionFormatSupported(compressionFormat);
+
+    WHEN( "Content is compressed to a file and the file is decompressed" )
+    {
+      // The large content spans several stream buffers
+      std::string content = GENERATE(
+        std::string(""),
+        std::string("(;FF[4]GM[1]SZ[19];B[aa];W[bb])"),
+        std::string(300000, 'x'));
+
+      THEN( "The file is compressed and decompresses to the original content" )
+      {
+        if (isCompressionFormatSupported)
+        {
+          bool success = SgfcCompressionUtility::CompressToFile(content, tempFilePath, compressionFormat);
+          REQUIRE( success == true );
+          REQUIRE( SgfcCompressionUtility::GetCompressionFormatOfFile(tempFilePath) == compressionFormat );
+          REQUIRE( DecompressFileIntoString(tempFilePath, compressionFormat) == content );
+        }
+      }
+    }
+
+    WHEN( "A file with truncated compressed data is decompressed" )
+    {
+      std::string content(300000, 'x');
+      for (std::size_t indexOfCharacter = 0; indexOfCharacter < content.size(); indexOfCharacter += 7)
+        content[indexOfCharacter] = static_cast<char>('a' + (indexOfCharacter % 26));
+
+      THEN( "The operation throws an exception" )
+      {
+        if (isCompressionFormatSupported)
+        {
+          SgfcCompressionUtility::CompressToFile(content, tempFilePath, compressionFormat);
+          std::string compressedContent = ReadBinaryFileContent(tempFilePath);
+          WriteBinaryFileContent(tempFilePath, compressedContent.substr(0, compressedContent.size() / 2));
+
+          std::size_t decompressedSize = 0;
+          REQUIRE_THROWS_AS(
+            SgfcCompressionUtility::DecompressFile(tempFilePath, compressionFormat, decompressedSize),
+            std::runtime_error);
+        }
+      }
+    }
+
+    SgfcUtility::DeleteFileIfExists(tempFilePath);
+  }
+}
+
+SCENARIO( "SgfcCompressionUtility creates input streams", "[backend][filesystem]" )
+{
+  std::string tempFilePath = SgfcUtility::GetUniqueTempFilePath();
+
+  GIVEN( "The file is not compressed" )
+  {
+    WriteBinaryFileContent(tempFilePath, "(;FF[4])");
+
+    WHEN( "An input stream is created" )
+    {
+      auto in = SgfcCompressionUtility::CreateInputStream(tempFilePath);
+
+      THEN( "The stream provides the file content as is" )
+      {
+        std::stringstream content;
+        content << in->rdbuf();
+        REQUIRE( content.str() == "(;FF[4])" );
+      }
+    }
+  }
+
+  GIVEN( "The file does not exist" )
+  {
+    WHEN( "An input stream is created" )
+    {
+      THEN( "The operation throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          SgfcCompressionUtility::CreateInputStream(tempFilePath),
+          std::runtime_error);
+      }
+    }
+  }
+
+  GIVEN( "The file is compressed" )
+  {
+    auto compressionFormat = GENERATE( SgfcCompressionFormat::Gzip, SgfcCompressionFormat::Zstd );
+    bool isCompressionFormatSupported = SgfcCompressionUtility::IsCompressionFormatSupported(compressionFormat);
+
+    WHEN( "An input stream is created" )
+    {
+      // The large content spans several stream buffers
+      std::string content(300000, 'x');
+      for (std::size_t indexOfCharacter = 0; indexOfCharacter < content.size(); indexOfCharacter += 7)
+        content[indexOfCharacter] = static_cast<char>('a' + (indexOfCharacter % 26));
+
+      THEN( "The stream provides the decompressed content if the compression format is supported" )
+      {
+        if (isCompressionFormatSupported)
+        {
+          SgfcCompressionUtility::CompressToFile(content, tempFilePath, compressionFormat);
+
+          auto in = SgfcCompressionUtility::CreateInputStream(tempFilePath);
+          std::string decompressedContent(content.size(), '\0');
+          in->read(&decompressedContent[0], static_cast<std::streamsize>(decompressedContent.size()));
+          REQUIRE( decompressedContent == content );
+          REQUIRE( in->get() == std::char_traits<char>::eof() );
+        }
+        else
+        {
+          WriteBinaryFileContent(tempFilePath, compressionFormat == SgfcCompressionFormat::Gzip ? "\x1F\x8B" "foo" : "\x28\xB5\x2F\xFD" "foo");
+          REQUIRE_THROWS_AS(
+            SgfcCompressionUtility::CreateInputStream(tempFilePath),
+            std::runtime_error);
+        }
+      }
+    }
+  }
+
+  SgfcUtility::DeleteFileIfExists(tempFilePath);
+}
+
+SCENARIO( "SgfcCompressionUtility calculates CRC-32 checksums", "[backend]" )
+{
+  GIVEN( "Some data" )
+  {
+    WHEN( "The CRC-32 checksum is calculated" )
+    {
+      THEN( "The checksum is the one used by the gzip and zip formats" )
+      {
+        REQUIRE( SgfcCompressionUtility::GetCrc32Checksum("") == 0 );
+        REQUIRE( SgfcCompressionUtility::GetCrc32Checksum("123456789") == 0xCBF43926 );
+      }
+    }
+  }
+}
+
+void WriteBinaryFileContent(const std::string& filePath, const std::string& content)
+{
+  std::ofstream out(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+  out << content;
+}
+
+std::string ReadBinaryFileContent(const std::string& filePath)
+{
+  std::ifstream in(filePath, std::ios::in | std::ios::binary);
+  std::stringstream content;
+  content << in.rdbuf();
+  return content.str();
+}
+
+std::string DecompressFileIntoString(const std::string& filePath, SgfcCompressionFormat compressionFormat)
+{
+  std::size_t decompressedSize = 0;
+  char* decompressedBuffer = SgfcCompressionUtility::DecompressFile(filePath, compressionFormat, decompressedSize);
+
+  std::string decompressedContent(decompressedBuffer, decompressedSize);
+  free(decompressedBuffer);
+
+  return decompressedContent;
+}
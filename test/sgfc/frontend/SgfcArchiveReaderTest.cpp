@@ -0,0 +1,664 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../RecordingDocumentReader.h"
+
+// Library includes
+#include <ISgfcArchiveReader.h>
+#include <ISgfcDocumentReadResult.h>
+#include <SgfcArchiveEntryReadResult.h>
+#include <SgfcBinaryUtility.h>
+#include <SgfcPlusPlusFactory.h>
+#include <SgfcUtility.h>
+#include <sgfc/backend/SgfcCompressionUtility.h>
+
+// Unit test library includes
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+// C++ Standard Library includes
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace LibSgfcPlusPlus;
+
+
+std::string CreateTarHeaderBlock(const std::string& memberName, const std::string& memberNamePrefix, std::size_t memberSize, char typeFlag);
+void AddTarMember(std::string& tarArchive, const std::string& memberName, const std::string& memberData, char typeFlag);
+std::string FinishTarArchive(const std::string& tarArchive);
+void AddZipMember(
+  std::string& localFileSection,
+  std::string& centralDirectory,
+  const std::string& memberName,
+  const std::string& memberData,
+  std::uint16_t compressionMethod,
+  std::uint16_t flags,
+  std::uint32_t crc32Checksum,
+  std::uint32_t uncompressedSize);
+void AddStoredZipMember(std::string& localFileSection, std::string& centralDirectory, const std::string& memberName, const std::string& memberData);
+std::string FinishZipArchive(const std::string& localFileSection, const std::string& centralDirectory, std::uint16_t numberOfEntries);
+void WriteArchiveFile(const std::string& archiveFilePath, const std::string& archiveContent);
+std::vector<SgfcArchiveEntryReadResult> ReadAllArchiveEntries(std::shared_ptr<ISgfcArchiveReader> reader);
+
+
+SCENARIO( "SgfcArchiveReader is constructed", "[frontend]" )
+{
+  auto documentReader = std::shared_ptr<RecordingDocumentReader>(new RecordingDocumentReader());
+  std::string archiveFilePath = SgfcUtility::GetUniqueTempFilePath();
+
+  GIVEN( "The archive file is a tar archive" )
+  {
+    std::string tarArchive;
+    AddTarMember(tarArchive, "game.sgf", "(;)", '0');
+    WriteArchiveFile(archiveFilePath, FinishTarArchive(tarArchive));
+
+    WHEN( "SgfcArchiveReader is constructed" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateArchiveReader(archiveFilePath, documentReader);
+
+      THEN( "SgfcArchiveReader has the expected state" )
+      {
+        REQUIRE( reader->GetArchiveFilePath() == archiveFilePath );
+        REQUIRE( reader->GetDocumentReader() == documentReader );
+      }
+    }
+  }
+
+  GIVEN( "The document reader is nullptr" )
+  {
+    WriteArchiveFile(archiveFilePath, FinishTarArchive(""));
+
+    WHEN( "SgfcArchiveReader is constructed" )
+    {
+      THEN( "SgfcArchiveReader throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          SgfcPlusPlusFactory::CreateArchiveReader(archiveFilePath, nullptr),
+          std::invalid_argument);
+      }
+    }
+  }
+
+  GIVEN( "The archive file does not exist" )
+  {
+    WHEN( "SgfcArchiveReader is constructed" )
+    {
+      THEN( "SgfcArchiveReader throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          SgfcPlusPlusFactory::CreateArchiveReader(archiveFilePath, documentReader),
+          std::runtime_error);
+      }
+    }
+  }
+
+  GIVEN( "The archive file is neither a tar nor a zip archive" )
+  {
+    WriteArchiveFile(archiveFilePath, "(;)" + std::string(1024, ' '));
+
+    WHEN( "SgfcArchiveReader is constructed" )
+    {
+      THEN( "SgfcArchiveReader throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          SgfcPlusPlusFactory::CreateArchiveReader(archiveFilePath, documentReader),
+          std::runtime_error);
+      }
+    }
+  }
+
+  SgfcUtility::DeleteFileIfExists(archiveFilePath);
+}
+
+SCENARIO( "SgfcArchiveReader reads a tar archive", "[frontend]" )
+{
+  auto documentReader = std::shared_ptr<RecordingDocumentReader>(new RecordingDocumentReader());
+  std::string archiveFilePath = SgfcUtility::GetUniqueTempFilePath();
+
+  GIVEN( "The tar archive contains .sgf files and other members" )
+  {
+    std::string tarArchive;
+    AddTarMember(tarArchive, "games/", "", '5');
+    AddTarMember(tarArchive, "games/first.sgf", "(;C[1])", '0');
+    AddTarMember(tarArchive, "games/readme.txt", std::string(600, 'x'), '0');
+    AddTarMember(tarArchive, "games/._first.sgf", "resource fork", '0');
+    AddTarMember(tarArchive, "games/link.sgf", "", '2');
+    AddTarMember(tarArchive, "games/SECOND.SGF", std::string(512, ' ') + "(;C[2])", '\0');
+    WriteArchiveFile(archiveFilePath, FinishTarArchive(tarArchive));
+
+    WHEN( "All entries are read" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateArchiveReader(archiveFilePath, documentReader);
+      auto entryReadResults = ReadAllArchiveEntries(reader);
+
+      THEN( "Only the .sgf files are read, in the order in which they appear in the archive" )
+      {
+        REQUIRE( entryReadResults.size() == 2 );
+        REQUIRE( entryReadResults[0].MemberName == "games/first.sgf" );
+        REQUIRE( entryReadResults[0].DocumentReadResult != nullptr );
+        REQUIRE( entryReadResults[1].MemberName == "games/SECOND.SGF" );
+        REQUIRE( entryReadResults[1].DocumentReadResult != nullptr );
+        REQUIRE( documentReader->SgfContents.size() == 2 );
+        REQUIRE( documentReader->SgfContents[0] == "(;C[1])" );
+        REQUIRE( documentReader->SgfContents[1] == std::string(512, ' ') + "(;C[2])" );
+      }
+
+      THEN( "Further read operations do not read any more entries" )
+      {
+        SgfcArchiveEntryReadResult entryReadResult;
+        REQUIRE( reader->ReadNextEntry(entryReadResult) == false );
+        REQUIRE( entryReadResult.MemberName.empty() );
+      }
+    }
+  }
+
+  GIVEN( "The tar archive contains members with long names" )
+  {
+    std::string longDirectoryName(120, 'd');
+    std::string longFileName(110, 'f');
+
+    std::string tarArchive;
+
+    // POSIX ustar: The name is split into prefix and name
+    tarArchive += CreateTarHeaderBlock("ustar.sgf", longDirectoryName, 3, '0') + "(;)" + std::string(509, '\0');
+
+    // GNU tar: The name is stored in a separate member
+    AddTarMember(tarArchive, "././@LongLink", longFileName + ".sgf" + std::string(1, '\0'), 'L');
+    AddTarMember(tarArchive, "truncated-name", "(;)", '0');
+
+    // pax: The name is stored in an extended header record
+    std::string paxRecord = "138 path=" + longDirectoryName + "/pax.sgf\n";
+    AddTarMember(tarArchive, "PaxHeaders/pax.sgf", paxRecord, 'x');
+    AddTarMember(tarArchive, "truncated-name", "(;)", '0');
+
+    WriteArchiveFile(archiveFilePath, FinishTarArchive(tarArchive));
+
+    WHEN( "All entries are read" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateArchiveReader(archiveFilePath, documentReader);
+      auto entryReadResults = ReadAllArchiveEntries(reader);
+
+      THEN( "The full member names are reported" )
+      {
+        REQUIRE( paxRecord.size() == 138 );
+        REQUIRE( entryReadResults.size() == 3 );
+        REQUIRE( entryReadResults[0].MemberName == longDirectoryName + "/ustar.sgf" );
+        REQUIRE( entryReadResults[1].MemberName == longFileName + ".sgf" );
+        REQUIRE( entryReadResults[2].MemberName == longDirectoryName + "/pax.sgf" );
+      }
+    }
+  }
+
+  GIVEN( "The tar archive is empty" )
+  {
+    WriteArchiveFile(archiveFilePath, FinishTarArchive(""));
+
+    WHEN( "The first entry is read" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateArchiveReader(archiveFilePath, documentReader);
+      SgfcArchiveEntryReadResult entryReadResult;
+      bool isEntryRead = reader->ReadNextEntry(entryReadResult);
+
+      THEN( "No entry is read" )
+      {
+        REQUIRE( isEntryRead == false );
+        REQUIRE( documentReader->SgfContents.size() == 0 );
+      }
+    }
+  }
+
+  GIVEN( "The tar archive is truncated" )
+  {
+    std::string tarArchive;
+    AddTarMember(tarArchive, "first.sgf", "(;C[1])", '0');
+    AddTarMember(tarArchive, "second.sgf", std::string(1000, ' '), '0');
+    WriteArchiveFile(archiveFilePath, tarArchive.substr(0, tarArchive.size() - 600));
+
+    WHEN( "All entries are read" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateArchiveReader(archiveFilePath, documentReader);
+      SgfcArchiveEntryReadResult entryReadResult;
+
+      THEN( "The entries before the truncation are read, then an exception is thrown" )
+      {
+        REQUIRE( reader->ReadNextEntry(entryReadResult) == true );
+        REQUIRE( entryReadResult.MemberName == "first.sgf" );
+        REQUIRE_THROWS_AS( reader->ReadNextEntry(entryReadResult), std::runtime_error );
+      }
+    }
+  }
+
+  GIVEN( "The tar archive has a corrupt header" )
+  {
+    std::string tarArchive;
+    AddTarMember(tarArchive, "first.sgf", "(;C[1])", '0');
+    AddTarMember(tarArchive, "second.sgf", "(;C[2])", '0');
+    tarArchive[1024] = 'X';
+    WriteArchiveFile(archiveFilePath, FinishTarArchive(tarArchive));
+
+    WHEN( "All entries are read" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateArchiveReader(archiveFilePath, documentReader);
+      SgfcArchiveEntryReadResult entryReadResult;
+
+      THEN( "The entries before the corrupt header are read, then an exception is thrown" )
+      {
+        REQUIRE( reader->ReadNextEntry(entryReadResult) == true );
+        REQUIRE_THROWS_AS( reader->ReadNextEntry(entryReadResult), std::runtime_error );
+      }
+    }
+  }
+
+  GIVEN( "The tar archive declares member sizes that cannot be satisfied" )
+  {
+    // The first size does not fit into 64 bits, the second size is larger
+    // than the maximum member size
+    std::string paxRecord = GENERATE ( "33 size=123456789012345678901234\n", "28 size=1000000000000000000\n" );
+
+    std::string tarArchive;
+    AddTarMember(tarArchive, "first.sgf", "(;C[1])", '0');
+    AddTarMember(tarArchive, "PaxHeaders/huge.sgf", paxRecord, 'x');
+    AddTarMember(tarArchive, "huge.sgf", "(;C[2])", '0');
+    WriteArchiveFile(archiveFilePath, FinishTarArchive(tarArchive));
+
+    WHEN( "All entries are read" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateArchiveReader(archiveFilePath, documentReader);
+      SgfcArchiveEntryReadResult entryReadResult;
+
+      THEN( "The entries before the bogus size are read, then a std::runtime_error is thrown" )
+      {
+        REQUIRE( paxRecord.size() == std::stoul(paxRecord.substr(0, 2)) );
+        REQUIRE( reader->ReadNextEntry(entryReadResult) == true );
+        REQUIRE( entryReadResult.MemberName == "first.sgf" );
+        REQUIRE_THROWS_AS( reader->ReadNextEntry(entryReadResult), std::runtime_error );
+        REQUIRE( documentReader->SgfContents.size() == 1 );
+      }
+    }
+  }
+
+  GIVEN( "The tar archive is compressed" )
+  {
+    std::string tarArchive;
+    AddTarMember(tarArchive, "first.sgf", "(;C[1])", '0');
+    AddTarMember(tarArchive, "second.sgf", "(;C[2])", '0');
+
+    WHEN( "The tar archive is compressed with each supported compression format and read" )
+    {
+      THEN( "The tar archive is decompressed while it is read" )
+      {
+        for (auto compressionFormat : { SgfcCompressionFormat::Gzip, SgfcCompressionFormat::Zstd })
+        {
+          if (! SgfcCompressionUtility::IsCompressionFormatSupported(compressionFormat))
+            continue;
+
+          REQUIRE( SgfcCompressionUtility::CompressToFile(FinishTarArchive(tarArchive), archiveFilePath, compressionFormat) == true );
+
+          auto reader = SgfcPlusPlusFactory::CreateArchiveReader(archiveFilePath, documentReader);
+          auto entryReadResults = ReadAllArchiveEntries(reader);
+
+          REQUIRE( entryReadResults.size() == 2 );
+          REQUIRE( entryReadResults[0].MemberName == "first.sgf" );
+          REQUIRE( entryReadResults[1].MemberName == "second.sgf" );
+          REQUIRE( documentReader->SgfContents.back() == "(;C[2])" );
+        }
+      }
+    }
+  }
+
+  SgfcUtility::DeleteFileIfExists(archiveFilePath);
+}
+
+SCENARIO( "SgfcArchiveReader reads a zip archive", "[frontend]" )
+{
+  auto documentReader = std::shared_ptr<RecordingDocumentReader>(new RecordingDocumentReader());
+  std::string archiveFilePath = SgfcUtility::GetUniqueTempFilePath();
+
+  GIVEN( "The zip archive contains .sgf files and other members" )
+  {
+    std::string localFileSection;
+    std::string centralDirectory;
+    AddStoredZipMember(localFileSection, centralDirectory, "games/", "");
+    AddStoredZipMember(localFileSection, centralDirectory, "games/first.sgf", "(;C[1])");
+    AddStoredZipMember(localFileSection, centralDirectory, "games/readme.txt", "foo");
+    AddStoredZipMember(localFileSection, centralDirectory, "__MACOSX/games/._first.sgf", "resource fork");
+    AddStoredZipMember(localFileSection, centralDirectory, "games/second.Sgf", "(;C[2])");
+    WriteArchiveFile(archiveFilePath, FinishZipArchive(localFileSection, centralDirectory, 5));
+
+    WHEN( "All entries are read" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateArchiveReader(archiveFilePath, documentReader);
+      auto entryReadResults = ReadAllArchiveEntries(reader);
+
+      THEN( "Only the .sgf files are read, in the order of the central directory" )
+      {
+        REQUIRE( entryReadResults.size() == 2 );
+        REQUIRE( entryReadResults[0].MemberName == "games/first.sgf" );
+        REQUIRE( entryReadResults[1].MemberName == "games/second.Sgf" );
+        REQUIRE( documentReader->SgfContents.size() == 2 );
+        REQUIRE( documentReader->SgfContents[0] == "(;C[1])" );
+        REQUIRE( documentReader->SgfContents[1] == "(;C[2])" );
+      }
+    }
+  }
+
+  GIVEN( "The zip archive contains members that cannot be extracted" )
+  {
+    std::string sgfContent = "(;)";
+    std::uint32_t crc32Checksum = SgfcCompressionUtility::GetCrc32Checksum(sgfContent);
+    std::uint32_t uncompressedSize = static_cast<std::uint32_t>(sgfContent.size());
+
+    std::string localFileSection;
+    std::string centralDirectory;
+    AddZipMember(localFileSection, centralDirectory, "encrypted.sgf", sgfContent, 0, 0x1, crc32Checksum, uncompressedSize);
+    AddZipMember(localFileSection, centralDirectory, "bzip2.sgf", sgfContent, 12, 0, crc32Checksum, uncompressedSize);
+    AddZipMember(localFileSection, centralDirectory, "checksum.sgf", sgfContent, 0, 0, crc32Checksum + 1, uncompressedSize);
+    AddStoredZipMember(localFileSection, centralDirectory, "valid.sgf", sgfContent);
+    WriteArchiveFile(archiveFilePath, FinishZipArchive(localFileSection, centralDirectory, 4));
+
+    WHEN( "All entries are read" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateArchiveReader(archiveFilePath, documentReader);
+      auto entryReadResults = ReadAllArchiveEntries(reader);
+
+      THEN( "The members that cannot be extracted have a fatal read result" )
+      {
+        REQUIRE( entryReadResults.size() == 4 );
+        for (std::size_t indexOfEntry = 0; indexOfEntry < 3; indexOfEntry++)
+        {
+          auto documentReadResult = entryReadResults[indexOfEntry].DocumentReadResult;
+          REQUIRE( documentReadResult->GetExitCode() == SgfcExitCode::FatalError );
+          REQUIRE( documentReadResult->GetParseResult().size() == 1 );
+        }
+        REQUIRE( entryReadResults[3].MemberName == "valid.sgf" );
+        REQUIRE( documentReader->SgfContents.size() == 1 );
+        REQUIRE( documentReader->SgfContents[0] == sgfContent );
+      }
+    }
+  }
+
+  GIVEN( "The zip archive declares member sizes that cannot be satisfied" )
+  {
+    std::string sgfContent = "(;)";
+    std::uint32_t crc32Checksum = SgfcCompressionUtility::GetCrc32Checksum(sgfContent);
+
+    std::string localFileSection;
+    std::string centralDirectory;
+    // Larger than the maximum member size
+    AddZipMember(localFileSection, centralDirectory, "huge.sgf", sgfContent, 8, 0, crc32Checksum, 0xF0000000);
+    // Exceeds the maximum deflate compression ratio
+    AddZipMember(localFileSection, centralDirectory, "ratio.sgf", sgfContent, 8, 0, crc32Checksum, 100000);
+    // The compressed size is larger than the archive
+    std::size_t offsetOfCentralDirectoryFileHeader = centralDirectory.size();
+    AddStoredZipMember(localFileSection, centralDirectory, "outside.sgf", sgfContent);
+    std::ostringstream compressedSizeStream;
+    SgfcBinaryUtility::WriteUInt32(compressedSizeStream, 0x7FFFFFFF);
+    centralDirectory.replace(offsetOfCentralDirectoryFileHeader + 20, 4, compressedSizeStream.str());
+    AddStoredZipMember(localFileSection, centralDirectory, "valid.sgf", sgfContent);
+    WriteArchiveFile(archiveFilePath, FinishZipArchive(localFileSection, centralDirectory, 4));
+
+    WHEN( "All entries are read" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateArchiveReader(archiveFilePath, documentReader);
+      auto entryReadResults = ReadAllArchiveEntries(reader);
+
+      THEN( "The members with bogus sizes have a fatal read result" )
+      {
+        REQUIRE( entryReadResults.size() == 4 );
+        for (std::size_t indexOfEntry = 0; indexOfEntry < 3; indexOfEntry++)
+        {
+          auto documentReadResult = entryReadResults[indexOfEntry].DocumentReadResult;
+          REQUIRE( documentReadResult->GetExitCode() == SgfcExitCode::FatalError );
+          REQUIRE( documentReadResult->GetParseResult().size() == 1 );
+        }
+        REQUIRE( entryReadResults[3].MemberName == "valid.sgf" );
+        REQUIRE( documentReader->SgfContents.size() == 1 );
+      }
+    }
+  }
+
+  GIVEN( "The zip archive contains a deflate-compressed member" )
+  {
+    std::string sgfContent = "(;C[deflated])";
+    std::string deflateData("\xD3\xB0\x76\x8E\x4E\x49\x4D\xCB\x49\x2C\x49\x4D\x89\xD5\x04\x00", 16);
+
+    std::string localFileSection;
+    std::string centralDirectory;
+    AddZipMember(
+      localFileSection,
+      centralDirectory,
+      "deflated.sgf",
+      deflateData,
+      8,
+      0,
+      SgfcCompressionUtility::GetCrc32Checksum(sgfContent),
+      static_cast<std::uint32_t>(sgfContent.size()));
+    WriteArchiveFile(archiveFilePath, FinishZipArchive(localFileSection, centralDirectory, 1));
+
+    WHEN( "All entries are read" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateArchiveReader(archiveFilePath, documentReader);
+      auto entryReadResults = ReadAllArchiveEntries(reader);
+
+      THEN( "The member is decompressed if deflate is supported, otherwise it has a fatal read result" )
+      {
+        REQUIRE( entryReadResults.size() == 1 );
+        if (SgfcCompressionUtility::IsCompressionFormatSupported(SgfcCompressionFormat::Gzip))
+        {
+          REQUIRE( documentReader->SgfContents.size() == 1 );
+          REQUIRE( documentReader->SgfContents[0] == sgfContent );
+        }
+        else
+        {
+          REQUIRE( documentReader->SgfContents.size() == 0 );
+          REQUIRE( entryReadResults[0].DocumentReadResult->GetExitCode() == SgfcExitCode::FatalError );
+        }
+      }
+    }
+  }
+
+  GIVEN( "The zip archive is empty" )
+  {
+    WriteArchiveFile(archiveFilePath, FinishZipArchive("", "", 0));
+
+    WHEN( "The first entry is read" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateArchiveReader(archiveFilePath, documentReader);
+      SgfcArchiveEntryReadResult entryReadResult;
+      bool isEntryRead = reader->ReadNextEntry(entryReadResult);
+
+      THEN( "No entry is read" )
+      {
+        REQUIRE( isEntryRead == false );
+      }
+    }
+  }
+
+  GIVEN( "The zip archive is truncated" )
+  {
+    std::string localFileSection;
+    std::string centralDirectory;
+    AddStoredZipMember(localFileSection, centralDirectory, "first.sgf", "(;C[1])");
+    std::string zipArchive = FinishZipArchive(localFileSection, centralDirectory, 1);
+    WriteArchiveFile(archiveFilePath, zipArchive.substr(0, zipArchive.size() - 10));
+
+    WHEN( "SgfcArchiveReader is constructed" )
+    {
+      THEN( "SgfcArchiveReader throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          SgfcPlusPlusFactory::CreateArchiveReader(archiveFilePath, documentReader),
+          std::runtime_error);
+      }
+    }
+  }
+
+  SgfcUtility::DeleteFileIfExists(archiveFilePath);
+}
+
+std::string CreateTarHeaderBlock(const std::string& memberName, const std::string& memberNamePrefix, std::size_t memberSize, char typeFlag)
+{
+  std::string headerBlock(512, '\0');
+  headerBlock.replace(0, memberName.size(), memberName);
+  headerBlock.replace(345, memberNamePrefix.size(), memberNamePrefix);
+  headerBlock.replace(100, 7, "0000644");
+  headerBlock.replace(108, 7, "0000000");
+  headerBlock.replace(116, 7, "0000000");
+
+  std::ostringstream sizeStream;
+  sizeStream.width(11);
+  sizeStream.fill('0');
+  sizeStream << std::oct << memberSize;
+  headerBlock.replace(124, 11, sizeStream.str());
+
+  headerBlock.replace(136, 11, "00000000000");
+  headerBlock[156] = typeFlag;
+  headerBlock.replace(257, 6, std::string("ustar\0", 6));
+  headerBlock.replace(263, 2, "00");
+
+  // The checksum is calculated with the checksum field filled with spaces
+  headerBlock.replace(148, 8, 8, ' ');
+  unsigned int checksum = 0;
+  for (char character : headerBlock)
+    checksum += static_cast<unsigned char>(character);
+
+  std::ostringstream checksumStream;
+  checksumStream.width(6);
+  checksumStream.fill('0');
+  checksumStream << std::oct << checksum;
+  headerBlock.replace(148, 8, checksumStream.str() + std::string(1, '\0') + " ");
+
+  return headerBlock;
+}
+
+void AddTarMember(std::string& tarArchive, const std::string& memberName, const std::string& memberData, char typeFlag)
+{
+  tarArchive += CreateTarHeaderBlock(memberName, "", memberData.size(), typeFlag);
+  tarArchive += memberData;
+
+  std::size_t remainder = memberData.size() % 512;
+  if (remainder != 0)
+    tarArchive += std::string(512 - remainder, '\0');
+}
+
+std::string FinishTarArchive(const std::string& tarArchive)
+{
+  return tarArchive + std::string(1024, '\0');
+}
+
+void AddZipMember(
+  std::string& localFileSection,
+  std::string& centralDirectory,
+  const std::string& memberName,
+  const std::string& memberData,
+  std::uint16_t compressionMethod,
+  std::uint16_t flags,
+  std::uint32_t crc32Checksum,
+  std::uint32_t uncompressedSize)
+{
+  std::uint32_t localHeaderOffset = static_cast<std::uint32_t>(localFileSection.size());
+  std::uint32_t compressedSize = static_cast<std::uint32_t>(memberData.size());
+  std::uint16_t fileNameLength = static_cast<std::uint16_t>(memberName.size());
+
+  std::ostringstream localFileStream;
+  SgfcBinaryUtility::WriteUInt32(localFileStream, 0x04034B50);
+  SgfcBinaryUtility::WriteUInt16(localFileStream, 20);
+  SgfcBinaryUtility::WriteUInt16(localFileStream, flags);
+  SgfcBinaryUtility::WriteUInt16(localFileStream, compressionMethod);
+  SgfcBinaryUtility::WriteUInt32(localFileStream, 0);
+  SgfcBinaryUtility::WriteUInt32(localFileStream, crc32Checksum);
+  SgfcBinaryUtility::WriteUInt32(localFileStream, compressedSize);
+  SgfcBinaryUtility::WriteUInt32(localFileStream, uncompressedSize);
+  SgfcBinaryUtility::WriteUInt16(localFileStream, fileNameLength);
+  // A local extra field that is not repeated in the central directory
+  SgfcBinaryUtility::WriteUInt16(localFileStream, 4);
+  SgfcBinaryUtility::WriteCharacters(localFileStream, memberName);
+  SgfcBinaryUtility::WriteUInt32(localFileStream, 0);
+  SgfcBinaryUtility::WriteCharacters(localFileStream, memberData);
+  localFileSection += localFileStream.str();
+
+  std::ostringstream centralDirectoryStream;
+  SgfcBinaryUtility::WriteUInt32(centralDirectoryStream, 0x02014B50);
+  SgfcBinaryUtility::WriteUInt16(centralDirectoryStream, 20);
+  SgfcBinaryUtility::WriteUInt16(centralDirectoryStream, 20);
+  SgfcBinaryUtility::WriteUInt16(centralDirectoryStream, flags);
+  SgfcBinaryUtility::WriteUInt16(centralDirectoryStream, compressionMethod);
+  SgfcBinaryUtility::WriteUInt32(centralDirectoryStream, 0);
+  SgfcBinaryUtility::WriteUInt32(centralDirectoryStream, crc32Checksum);
+  SgfcBinaryUtility::WriteUInt32(centralDirectoryStream, compressedSize);
+  SgfcBinaryUtility::WriteUInt32(centralDirectoryStream, uncompressedSize);
+  SgfcBinaryUtility::WriteUInt16(centralDirectoryStream, fileNameLength);
+  SgfcBinaryUtility::WriteUInt16(centralDirectoryStream, 0);
+  SgfcBinaryUtility::WriteUInt16(centralDirectoryStream, 0);
+  SgfcBinaryUtility::WriteUInt16(centralDirectoryStream, 0);
+  SgfcBinaryUtility::WriteUInt16(centralDirectoryStream, 0);
+  SgfcBinaryUtility::WriteUInt32(centralDirectoryStream, 0);
+  SgfcBinaryUtility::WriteUInt32(centralDirectoryStream, localHeaderOffset);
+  SgfcBinaryUtility::WriteCharacters(centralDirectoryStream, memberName);
+  centralDirectory += centralDirectoryStream.str();
+}
+
+void AddStoredZipMember(std::string& localFileSection, std::string& centralDirectory, const std::string& memberName, const std::string& memberData)
+{
+  AddZipMember(
+    localFileSection,
+    centralDirectory,
+    memberName,
+    memberData,
+    0,
+    0,
+    SgfcCompressionUtility::GetCrc32Checksum(memberData),
+    static_cast<std::uint32_t>(memberData.size()));
+}
+
+std::string FinishZipArchive(const std::string& localFileSection, const std::string& centralDirectory, std::uint16_t numberOfEntries)
+{
+  std::ostringstream endOfCentralDirectoryStream;
+  SgfcBinaryUtility::WriteUInt32(endOfCentralDirectoryStream, 0x06054B50);
+  SgfcBinaryUtility::WriteUInt16(endOfCentralDirectoryStream, 0);
+  SgfcBinaryUtility::WriteUInt16(endOfCentralDirectoryStream, 0);
+  SgfcBinaryUtility::WriteUInt16(endOfCentralDirectoryStream, numberOfEntries);
+  SgfcBinaryUtility::WriteUInt16(endOfCentralDirectoryStream, numberOfEntries);
+  SgfcBinaryUtility::WriteUInt32(endOfCentralDirectoryStream, static_cast<std::uint32_t>(centralDirectory.size()));
+  SgfcBinaryUtility::WriteUInt32(endOfCentralDirectoryStream, static_cast<std::uint32_t>(localFileSection.size()));
+  // An archive comment
+  SgfcBinaryUtility::WriteUInt16(endOfCentralDirectoryStream, 7);
+  SgfcBinaryUtility::WriteCharacters(endOfCentralDirectoryStream, "comment");
+
+  return localFileSection + centralDirectory + endOfCentralDirectoryStream.str();
+}
+
+void WriteArchiveFile(const std::string& archiveFilePath, const std::string& archiveContent)
+{
+  std::ofstream out(std::filesystem::u8path(archiveFilePath), std::ios::out | std::ios::binary | std::ios::trunc);
+  out.write(archiveContent.data(), static_cast<std::streamsize>(archiveContent.size()));
+}
+
+std::vector<SgfcArchiveEntryReadResult> ReadAllArchiveEntries(std::shared_ptr<ISgfcArchiveReader> reader)
+{
+  std::vector<SgfcArchiveEntryReadResult> entryReadResults;
+
+  SgfcArchiveEntryReadResult entryReadResult;
+  while (reader->ReadNextEntry(entryReadResult))
+    entryReadResults.push_back(entryReadResult);
+
+  return entryReadResults;
+}
@@ -0,0 +1,304 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Library includes
+#include <ISgfcBatchDocumentReader.h>
+#include <ISgfcDocument.h>
+#include <ISgfcDocumentReadResult.h>
+#include <SgfcPlusPlusFactory.h>
+#include <SgfcUtility.h>
+
+// Unit test library includes
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+// C++ Standard Library includes
+#include <filesystem>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+using namespace LibSgfcPlusPlus;
+
+
+std::string CreateBatchTestDirectory();
+std::vector<std::string> WriteBatchTestFiles(const std::string& directoryPath, std::size_t numberOfFiles);
+std::vector<SgfcBatchReadResult> ReadAllBatchResults(std::shared_ptr<ISgfcBatchDocumentReader> reader);
+
+
+SCENARIO( "SgfcBatchDocumentReader is constructed", "[frontend]" )
+{
+  GIVEN( "The default constructor is used" )
+  {
+    WHEN( "SgfcBatchDocumentReader is constructed" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateBatchDocumentReader();
+
+      THEN( "SgfcBatchDocumentReader has the expected default state" )
+      {
+        REQUIRE( reader->GetArguments()->HasArguments() == false );
+        REQUIRE( reader->GetReadOptions().NumberOfThreads == SgfcDocumentReadOptions().NumberOfThreads );
+
+        SgfcBatchReadOptions batchReadOptions = reader->GetBatchReadOptions();
+        REQUIRE( batchReadOptions.NumberOfThreads == 0 );
+        REQUIRE( batchReadOptions.IsResultOrderPreserved == false );
+        REQUIRE( batchReadOptions.IsLargestFileReadFirst == true );
+        REQUIRE( batchReadOptions.MaximumNumberOfPendingResults == 64 );
+
+        REQUIRE( reader->IsReading() == false );
+        SgfcBatchReadResult batchReadResult;
+        REQUIRE( reader->ReadNextResult(batchReadResult) == false );
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcBatchDocumentReader finds files", "[frontend][filesystem]" )
+{
+  auto reader = SgfcPlusPlusFactory::CreateBatchDocumentReader();
+
+  GIVEN( "The directory contains files in subdirectories" )
+  {
+    std::string directoryPath = CreateBatchTestDirectory();
+    std::string subdirectoryPath = SgfcUtility::JoinPathComponents(directoryPath, "sub");
+    std::filesystem::create_directory(std::filesystem::u8path(subdirectoryPath));
+    std::string filePath1 = SgfcUtility::JoinPathComponents(directoryPath, "game1.sgf");
+    std::string filePath2 = SgfcUtility::JoinPathComponents(subdirectoryPath, "game2.sgf");
+    std::string filePath3 = SgfcUtility::JoinPathComponents(directoryPath, "game3.txt");
+    for (const auto& filePath : { filePath1, filePath2, filePath3 })
+      SgfcUtility::AppendTextToFile(filePath, "(;)");
+
+    WHEN( "The files matching a pattern are searched" )
+    {
+      auto sgfFilePaths = reader->FindFiles(directoryPath, "*.sgf");
+      auto textFilePaths = reader->FindFiles(directoryPath, "game?.txt");
+      auto noFilePaths = reader->FindFiles(directoryPath, "*.SGF");
+
+      THEN( "The paths of the matching files are returned in sorted order" )
+      {
+        REQUIRE( sgfFilePaths == std::vector<std::string> { filePath1, filePath2 } );
+        REQUIRE( textFilePaths == std::vector<std::string> { filePath3 } );
+        REQUIRE( noFilePaths.empty() );
+      }
+    }
+
+    std::filesystem::remove_all(std::filesystem::u8path(directoryPath));
+  }
+
+  GIVEN( "The directory does not exist" )
+  {
+    std::string directoryPath = SgfcUtility::GetUniqueTempFilePath();
+
+    WHEN( "The files matching a pattern are searched" )
+    {
+      THEN( "The operation throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          reader->FindFiles(directoryPath, "*.sgf"),
+          std::invalid_argument);
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcBatchDocumentReader reads a batch of files", "[frontend][filesystem]" )
+{
+  std::string directoryPath = CreateBatchTestDirectory();
+  std::vector<std::string> sgfFilePaths = WriteBatchTestFiles(directoryPath, 7);
+  std::string missingFilePath = SgfcUtility::JoinPathComponents(directoryPath, "missing.sgf");
+  sgfFilePaths.insert(sgfFilePaths.begin() + 3, missingFilePath);
+
+  auto reader = SgfcPlusPlusFactory::CreateBatchDocumentReader();
+
+  GIVEN( "The batch read options vary" )
+  {
+    auto numberOfThreads = GENERATE( 1u, 4u );
+    auto isResultOrderPreserved = GENERATE( false, true );
+    auto isLargestFileReadFirst = GENERATE( false, true );
+    auto maximumNumberOfPendingResults = GENERATE( static_cast<std::size_t>(1), static_cast<std::size_t>(3), static_cast<std::size_t>(64) );
+
+    SgfcBatchReadOptions batchReadOptions;
+    batchReadOptions.NumberOfThreads = numberOfThreads;
+    batchReadOptions.IsResultOrderPreserved = isResultOrderPreserved;
+    batchReadOptions.IsLargestFileReadFirst = isLargestFileReadFirst;
+    batchReadOptions.MaximumNumberOfPendingResults = maximumNumberOfPendingResults;
+    reader->SetBatchReadOptions(batchReadOptions);
+
+    WHEN( "The batch is read" )
+    {
+      reader->StartReading(sgfFilePaths);
+      bool isReadingAfterStart = reader->IsReading();
+      auto batchReadResults = ReadAllBatchResults(reader);
+
+      THEN( "There is one result per file" )
+      {
+        REQUIRE( isReadingAfterStart == true );
+        REQUIRE( reader->IsReading() == false );
+        REQUIRE( batchReadResults.size() == sgfFilePaths.size() );
+
+        std::set<std::size_t> fileIndexes;
+        for (std::size_t resultIndex = 0; resultIndex < batchReadResults.size(); resultIndex++)
+        {
+          const auto& batchReadResult = batchReadResults[resultIndex];
+          fileIndexes.insert(batchReadResult.FileIndex);
+
+          REQUIRE( batchReadResult.FileIndex < sgfFilePaths.size() );
+          REQUIRE( batchReadResult.SgfFilePath == sgfFilePaths[batchReadResult.FileIndex] );
+          REQUIRE( batchReadResult.DocumentReadResult != nullptr );
+          if (isResultOrderPreserved)
+            REQUIRE( batchReadResult.FileIndex == resultIndex );
+
+          if (batchReadResult.SgfFilePath == missingFilePath)
+          {
+            REQUIRE( batchReadResult.DocumentReadResult->GetExitCode() == SgfcExitCode::FatalError );
+          }
+          else
+          {
+            REQUIRE( batchReadResult.DocumentReadResult->GetExitCode() == SgfcExitCode::Ok );
+            REQUIRE( batchReadResult.DocumentReadResult->GetDocument()->GetGames().size() == 1 );
+          }
+        }
+        REQUIRE( fileIndexes.size() == sgfFilePaths.size() );
+      }
+    }
+  }
+
+  GIVEN( "The batch is empty" )
+  {
+    WHEN( "The batch is read" )
+    {
+      reader->StartReading(std::vector<std::string>());
+
+      THEN( "There are no results" )
+      {
+        REQUIRE( reader->IsReading() == false );
+        SgfcBatchReadResult batchReadResult;
+        REQUIRE( reader->ReadNextResult(batchReadResult) == false );
+      }
+    }
+  }
+
+  GIVEN( "A batch is being read" )
+  {
+    reader->StartReading(sgfFilePaths);
+
+    WHEN( "Another batch is started" )
+    {
+      THEN( "The operation throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          reader->StartReading(sgfFilePaths),
+          std::logic_error);
+      }
+    }
+
+    WHEN( "The batch is stopped after the first result" )
+    {
+      SgfcBatchReadResult batchReadResult;
+      bool isResultRead = reader->ReadNextResult(batchReadResult);
+      reader->StopReading();
+
+      THEN( "There are no more results and another batch can be read" )
+      {
+        REQUIRE( isResultRead == true );
+        REQUIRE( reader->IsReading() == false );
+        REQUIRE( reader->ReadNextResult(batchReadResult) == false );
+
+        reader->StartReading(sgfFilePaths);
+        REQUIRE( ReadAllBatchResults(reader).size() == sgfFilePaths.size() );
+      }
+    }
+  }
+
+  GIVEN( "The batch is read with a result handler" )
+  {
+    WHEN( "The result handler processes all results" )
+    {
+      std::vector<SgfcBatchReadResult> batchReadResults;
+      reader->ReadSgfFiles(sgfFilePaths, [&batchReadResults](const SgfcBatchReadResult& batchReadResult)
+      {
+        batchReadResults.push_back(batchReadResult);
+      });
+
+      THEN( "The result handler is invoked once per file" )
+      {
+        REQUIRE( batchReadResults.size() == sgfFilePaths.size() );
+        REQUIRE( reader->IsReading() == false );
+      }
+    }
+
+    WHEN( "The result handler throws an exception" )
+    {
+      std::size_t numberOfHandlerInvocations = 0;
+      auto resultHandler = [&numberOfHandlerInvocations](const SgfcBatchReadResult&)
+      {
+        numberOfHandlerInvocations++;
+        throw std::runtime_error("result handler failed");
+      };
+
+      THEN( "The exception is rethrown and the batch is stopped" )
+      {
+        REQUIRE_THROWS_AS(
+          reader->ReadSgfFiles(sgfFilePaths, resultHandler),
+          std::runtime_error);
+        REQUIRE( numberOfHandlerInvocations == 1 );
+        REQUIRE( reader->IsReading() == false );
+      }
+    }
+  }
+
+  std::filesystem::remove_all(std::filesystem::u8path(directoryPath));
+}
+
+std::string CreateBatchTestDirectory()
+{
+  std::string directoryPath = SgfcUtility::GetUniqueTempFilePath();
+  std::filesystem::create_directory(std::filesystem::u8path(directoryPath));
+  return directoryPath;
+}
+
+std::vector<std::string> WriteBatchTestFiles(const std::string& directoryPath, std::size_t numberOfFiles)
+{
+  static const std::string moveProperties[] = { "B[aa]", "W[ab]", "B[ac]", "W[ad]", "B[ae]", "W[af]", "B[ag]" };
+
+  // The files have different sizes so that the largest-file-first schedule
+  // differs from the order of the batch
+  std::vector<std::string> sgfFilePaths;
+  for (std::size_t fileIndex = 0; fileIndex < numberOfFiles; fileIndex++)
+  {
+    std::string sgfContent = "(;SZ[9]KM[6.5]";
+    for (std::size_t moveIndex = 0; moveIndex <= (fileIndex * 3) % 7; moveIndex++)
+      sgfContent += ";" + moveProperties[moveIndex];
+    sgfContent += ")";
+
+    std::string sgfFilePath = SgfcUtility::JoinPathComponents(directoryPath, "game" + std::to_string(fileIndex) + ".sgf");
+    SgfcUtility::AppendTextToFile(sgfFilePath, sgfContent);
+    sgfFilePaths.push_back(sgfFilePath);
+  }
+
+  return sgfFilePaths;
+}
+
+std::vector<SgfcBatchReadResult> ReadAllBatchResults(std::shared_ptr<ISgfcBatchDocumentReader> reader)
+{
+  std::vector<SgfcBatchReadResult> batchReadResults;
+
+  SgfcBatchReadResult batchReadResult;
+  while (reader->ReadNextResult(batchReadResult))
+    batchReadResults.push_back(batchReadResult);
+
+  return batchReadResults;
+}
@@ -0,0 +1,216 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Library includes
+#include <document/SgfcDocument.h>
+#include <document/SgfcGame.h>
+#include <document/SgfcNode.h>
+#include <ISgfcArgument.h>
+#include <ISgfcBatchDocumentWriter.h>
+#include <ISgfcDocumentWriteResult.h>
+#include <SgfcConstants.h>
+#include <SgfcPlusPlusFactory.h>
+#include <SgfcUtility.h>
+
+// Unit test library includes
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+// C++ Standard Library includes
+#include <filesystem>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+using namespace LibSgfcPlusPlus;
+
+
+std::shared_ptr<ISgfcDocument> CreateBatchWriteTestDocument(bool hasRootNode);
+
+
+SCENARIO( "SgfcBatchDocumentWriter is constructed", "[frontend]" )
+{
+  GIVEN( "The default constructor is used" )
+  {
+    WHEN( "SgfcBatchDocumentWriter is constructed" )
+    {
+      auto writer = SgfcPlusPlusFactory::CreateBatchDocumentWriter();
+
+      THEN( "SgfcBatchDocumentWriter has the expected default state" )
+      {
+        auto argumentsCollection = writer->GetArguments()->GetArguments();
+        REQUIRE( argumentsCollection.size() == 1 );
+        REQUIRE( argumentsCollection.front()->GetArgumentType() == SgfcArgumentType::DefaultEncoding );
+        REQUIRE( argumentsCollection.front()->GetStringTypeParameter() == "UTF-8" );
+
+        REQUIRE( writer->GetBatchWriteOptions().NumberOfThreads == 0 );
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcBatchDocumentWriter writes a batch of documents", "[frontend][filesystem]" )
+{
+  std::string directoryPath = SgfcUtility::GetUniqueTempFilePath();
+  std::filesystem::create_directory(std::filesystem::u8path(directoryPath));
+
+  auto writer = SgfcPlusPlusFactory::CreateBatchDocumentWriter();
+
+  std::vector<std::shared_ptr<ISgfcDocument>> documents;
+  std::vector<std::string> sgfFilePaths;
+  for (std::size_t fileIndex = 0; fileIndex < 6; fileIndex++)
+  {
+    // The document in the middle of the batch cannot be encoded
+    documents.push_back(CreateBatchWriteTestDocument(fileIndex != 2));
+    sgfFilePaths.push_back(SgfcUtility::JoinPathComponents(directoryPath, "game" + std::to_string(fileIndex) + ".sgf"));
+  }
+
+  std::string expectedFileContentSaved = "(;FF[4]CA[UTF-8]GM[1]SZ[19]AP[SGFC:" + SgfcConstants::SgfcVersion + "])\n";
+
+  GIVEN( "The number of worker threads varies" )
+  {
+    SgfcBatchWriteOptions batchWriteOptions;
+    batchWriteOptions.NumberOfThreads = GENERATE( 1u, 4u );
+    writer->SetBatchWriteOptions(batchWriteOptions);
+
+    WHEN( "The batch is written" )
+    {
+      auto batchWriteResults = writer->WriteSgfFiles(documents, sgfFilePaths);
+
+      THEN( "There is one result per document in the order of the batch" )
+      {
+        REQUIRE( batchWriteResults.size() == documents.size() );
+
+        for (std::size_t fileIndex = 0; fileIndex < batchWriteResults.size(); fileIndex++)
+        {
+          const auto& batchWriteResult = batchWriteResults[fileIndex];
+          REQUIRE( batchWriteResult.FileIndex == fileIndex );
+          REQUIRE( batchWriteResult.SgfFilePath == sgfFilePaths[fileIndex] );
+          REQUIRE( batchWriteResult.DocumentWriteResult != nullptr );
+
+          if (fileIndex == 2)
+          {
+            REQUIRE( batchWriteResult.DocumentWriteResult->GetExitCode() == SgfcExitCode::FatalError );
+            REQUIRE( std::filesystem::exists(std::filesystem::u8path(sgfFilePaths[fileIndex])) == false );
+          }
+          else
+          {
+            REQUIRE( batchWriteResult.DocumentWriteResult->GetExitCode() == SgfcExitCode::Ok );
+            REQUIRE( SgfcUtility::ReadFileContent(sgfFilePaths[fileIndex]) == expectedFileContentSaved );
+          }
+        }
+      }
+    }
+  }
+
+  GIVEN( "The batch is written with a result handler" )
+  {
+    WHEN( "The result handler processes all results" )
+    {
+      std::set<std::size_t> fileIndexes;
+      writer->WriteSgfFiles(documents, sgfFilePaths, [&fileIndexes, &sgfFilePaths](const SgfcBatchWriteResult& batchWriteResult)
+      {
+        REQUIRE( batchWriteResult.SgfFilePath == sgfFilePaths[batchWriteResult.FileIndex] );
+        fileIndexes.insert(batchWriteResult.FileIndex);
+      });
+
+      THEN( "The result handler is invoked once per document" )
+      {
+        REQUIRE( fileIndexes.size() == documents.size() );
+      }
+    }
+
+    WHEN( "The result handler throws an exception" )
+    {
+      std::size_t numberOfHandlerInvocations = 0;
+      auto resultHandler = [&numberOfHandlerInvocations](const SgfcBatchWriteResult&)
+      {
+        numberOfHandlerInvocations++;
+        throw std::runtime_error("result handler failed");
+      };
+
+      THEN( "The exception is rethrown and a new batch can be written" )
+      {
+        REQUIRE_THROWS_AS(
+          writer->WriteSgfFiles(documents, sgfFilePaths, resultHandler),
+          std::runtime_error);
+        REQUIRE( numberOfHandlerInvocations == 1 );
+
+        REQUIRE( writer->WriteSgfFiles(documents, sgfFilePaths).size() == documents.size() );
+      }
+    }
+  }
+
+  GIVEN( "The batch is empty" )
+  {
+    WHEN( "The batch is written" )
+    {
+      std::size_t numberOfHandlerInvocations = 0;
+      writer->WriteSgfFiles(
+        std::vector<std::shared_ptr<ISgfcDocument>>(),
+        std::vector<std::string>(),
+        [&numberOfHandlerInvocations](const SgfcBatchWriteResult&) { numberOfHandlerInvocations++; });
+
+      THEN( "The result handler is not invoked" )
+      {
+        REQUIRE( numberOfHandlerInvocations == 0 );
+      }
+    }
+  }
+
+  GIVEN( "The batch is invalid" )
+  {
+    WHEN( "The number of documents differs from the number of file paths" )
+    {
+      sgfFilePaths.pop_back();
+
+      THEN( "The operation throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          writer->WriteSgfFiles(documents, sgfFilePaths),
+          std::invalid_argument);
+      }
+    }
+
+    WHEN( "A document is nullptr" )
+    {
+      documents[1] = nullptr;
+
+      THEN( "The operation throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          writer->WriteSgfFiles(documents, sgfFilePaths),
+          std::invalid_argument);
+      }
+    }
+  }
+
+  std::filesystem::remove_all(std::filesystem::u8path(directoryPath));
+}
+
+std::shared_ptr<ISgfcDocument> CreateBatchWriteTestDocument(bool hasRootNode)
+{
+  auto document = std::shared_ptr<ISgfcDocument>(new SgfcDocument());
+
+  std::shared_ptr<ISgfcGame> game;
+  if (hasRootNode)
+    game = std::shared_ptr<ISgfcGame>(new SgfcGame(std::shared_ptr<ISgfcNode>(new SgfcNode())));
+  else
+    game = std::shared_ptr<ISgfcGame>(new SgfcGame());
+  document->AppendGame(game);
+
+  return document;
+}
@@ -0,0 +1,360 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Library includes
+#include <ISgfcArguments.h>
+#include <ISgfcCachingDocumentReader.h>
+#include <ISgfcDocument.h>
+#include <ISgfcDocumentReadResult.h>
+#include <ISgfcGame.h>
+#include <ISgfcMessage.h>
+#include <ISgfcNode.h>
+#include <SgfcPlusPlusFactory.h>
+#include <SgfcPrivateConstants.h>
+#include <SgfcUtility.h>
+#include <sgfc/backend/SgfcCompressionUtility.h>
+
+// Unit test library includes
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+// C++ Standard Library includes
+#include <filesystem>
+
+using namespace LibSgfcPlusPlus;
+
+
+std::string GetCacheDirectoryPath();
+std::vector<std::string> GetCacheEntryFilePaths(const std::string& cacheDirectoryPath);
+void AssertReadResultsAreEqual(std::shared_ptr<ISgfcDocumentReadResult> readResult1, std::shared_ptr<ISgfcDocumentReadResult> readResult2);
+
+
+SCENARIO( "SgfcCachingDocumentReader is constructed", "[frontend][filesystem]" )
+{
+  std::string cacheDirectoryPath = GetCacheDirectoryPath();
+
+  GIVEN( "The cache directory does not exist" )
+  {
+    WHEN( "SgfcCachingDocumentReader is constructed" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateCachingDocumentReader(cacheDirectoryPath);
+
+      THEN( "The cache directory is created" )
+      {
+        REQUIRE( std::filesystem::is_directory(std::filesystem::u8path(cacheDirectoryPath)) == true );
+      }
+
+      THEN( "SgfcCachingDocumentReader has the expected default state" )
+      {
+        REQUIRE( reader->GetCacheDirectoryPath() == cacheDirectoryPath );
+        REQUIRE( reader->GetCacheKeyType() == SgfcDocumentCacheKeyType::FileContent );
+        REQUIRE( reader->GetMaximumCacheSize() == SgfcPrivateConstants::DocumentCacheDefaultMaximumSize );
+        REQUIRE( reader->GetArguments() != nullptr );
+        REQUIRE( reader->GetArguments()->HasArguments() == false );
+        REQUIRE( GetCacheEntryFilePaths(cacheDirectoryPath).size() == 0 );
+      }
+    }
+  }
+
+  GIVEN( "The cache directory path refers to a file" )
+  {
+    SgfcUtility::CreateOrTruncateFile(cacheDirectoryPath);
+
+    WHEN( "SgfcCachingDocumentReader is constructed" )
+    {
+      THEN( "The SgfcCachingDocumentReader constructor throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          SgfcPlusPlusFactory::CreateCachingDocumentReader(cacheDirectoryPath),
+          std::invalid_argument);
+      }
+    }
+  }
+
+  std::filesystem::remove_all(std::filesystem::u8path(cacheDirectoryPath));
+}
+
+SCENARIO( "SgfcCachingDocumentReader caches read results", "[frontend][filesystem]" )
+{
+  std::string cacheDirectoryPath = GetCacheDirectoryPath();
+  auto reader = SgfcPlusPlusFactory::CreateCachingDocumentReader(cacheDirectoryPath);
+  auto uncachedReader = SgfcPlusPlusFactory::CreateDocumentReader();
+
+  // The second SGF content generates warning 17 = SGFC error code "empty
+  // value deleted"
+  std::string sgfContent = GENERATE ( "(;SZ[9]KM[6.5]B[aa])", "(;C[])" );
+
+  GIVEN( "SGF content is read from a string" )
+  {
+    WHEN( "The same SGF content is read twice" )
+    {
+      auto readResult1 = reader->ReadSgfContent(sgfContent);
+      auto entryFilePaths1 = GetCacheEntryFilePaths(cacheDirectoryPath);
+      auto readResult2 = reader->ReadSgfContent(sgfContent);
+      auto entryFilePaths2 = GetCacheEntryFilePaths(cacheDirectoryPath);
+
+      THEN( "The first read operation stores a cache entry that the second read operation uses" )
+      {
+        REQUIRE( entryFilePaths1.size() == 1 );
+        REQUIRE( entryFilePaths2 == entryFilePaths1 );
+        REQUIRE( readResult1->GetDocument() != readResult2->GetDocument() );
+        AssertReadResultsAreEqual(readResult1, readResult2);
+        AssertReadResultsAreEqual(readResult2, uncachedReader->ReadSgfContent(sgfContent));
+      }
+    }
+
+    WHEN( "The same SGF content is read with different arguments" )
+    {
+      reader->ReadSgfContent(sgfContent);
+      reader->GetArguments()->AddArgument(SgfcArgumentType::DisableWarningMessages);
+      auto readResult = reader->ReadSgfContent(sgfContent);
+
+      THEN( "The read operations use different cache entries" )
+      {
+        REQUIRE( GetCacheEntryFilePaths(cacheDirectoryPath).size() == 2 );
+        uncachedReader->GetArguments()->AddArgument(SgfcArgumentType::DisableWarningMessages);
+        AssertReadResultsAreEqual(readResult, uncachedReader->ReadSgfContent(sgfContent));
+      }
+    }
+  }
+
+  GIVEN( "SGF content is read from the filesystem" )
+  {
+    std::string sgfFilePath = SgfcUtility::JoinPathComponents(cacheDirectoryPath, "test.sgf");
+    SgfcUtility::AppendTextToFile(sgfFilePath, sgfContent);
+
+    auto cacheKeyType = GENERATE ( SgfcDocumentCacheKeyType::FileContent, SgfcDocumentCacheKeyType::FileMetadata );
+    reader->SetCacheKeyType(cacheKeyType);
+
+    WHEN( "The same file is read twice" )
+    {
+      auto readResult1 = reader->ReadSgfFile(sgfFilePath);
+      auto entryFilePaths1 = GetCacheEntryFilePaths(cacheDirectoryPath);
+      auto readResult2 = reader->ReadSgfFile(sgfFilePath);
+      auto entryFilePaths2 = GetCacheEntryFilePaths(cacheDirectoryPath);
+
+      THEN( "The first read operation stores a cache entry that the second read operation uses" )
+      {
+        REQUIRE( entryFilePaths1.size() == 1 );
+        REQUIRE( entryFilePaths2 == entryFilePaths1 );
+        AssertReadResultsAreEqual(readResult1, readResult2);
+        AssertReadResultsAreEqual(readResult2, uncachedReader->ReadSgfFile(sgfFilePath));
+      }
+    }
+  }
+
+  GIVEN( "Compressed SGF content is read from the filesystem" )
+  {
+    reader->SetCacheKeyType(SgfcDocumentCacheKeyType::FileContent);
+
+    WHEN( "The same compressed file is read twice" )
+    {
+      THEN( "The file is decompressed and the second read operation uses the cache entry of the first read operation" )
+      {
+        for (auto compressionFormat : { SgfcCompressionFormat::Gzip, SgfcCompressionFormat::Zstd })
+        {
+          if (! SgfcCompressionUtility::IsCompressionFormatSupported(compressionFormat))
+            continue;
+
+          std::string sgfFilePath = SgfcUtility::JoinPathComponents(cacheDirectoryPath, "test.sgf.compressed");
+          REQUIRE( SgfcCompressionUtility::CompressToFile(sgfContent, sgfFilePath, compressionFormat) == true );
+
+          auto readResult1 = reader->ReadSgfFile(sgfFilePath);
+          auto entryFilePaths1 = GetCacheEntryFilePaths(cacheDirectoryPath);
+          auto readResult2 = reader->ReadSgfFile(sgfFilePath);
+          auto entryFilePaths2 = GetCacheEntryFilePaths(cacheDirectoryPath);
+
+          // The cache key is derived from the uncompressed content, so all
+          // compression formats share the same cache entry
+          REQUIRE( entryFilePaths1.size() == 1 );
+          REQUIRE( entryFilePaths2 == entryFilePaths1 );
+          AssertReadResultsAreEqual(readResult1, readResult2);
+          AssertReadResultsAreEqual(readResult2, uncachedReader->ReadSgfFile(sgfFilePath));
+          AssertReadResultsAreEqual(readResult2, uncachedReader->ReadSgfContent(sgfContent));
+
+          SgfcUtility::DeleteFileIfExists(sgfFilePath);
+        }
+      }
+    }
+  }
+
+  GIVEN( "The cache entry is corrupt" )
+  {
+    reader->ReadSgfContent(sgfContent);
+    auto entryFilePaths = GetCacheEntryFilePaths(cacheDirectoryPath);
+    REQUIRE( entryFilePaths.size() == 1 );
+    SgfcUtility::CreateOrTruncateFile(entryFilePaths.front());
+    SgfcUtility::AppendTextToFile(entryFilePaths.front(), "foobar");
+
+    WHEN( "The SGF content is read" )
+    {
+      auto readResult = reader->ReadSgfContent(sgfContent);
+
+      THEN( "The corrupt cache entry is ignored and replaced" )
+      {
+        AssertReadResultsAreEqual(readResult, uncachedReader->ReadSgfContent(sgfContent));
+        REQUIRE( GetCacheEntryFilePaths(cacheDirectoryPath) == entryFilePaths );
+        REQUIRE( std::filesystem::file_size(std::filesystem::u8path(entryFilePaths.front())) > 6 );
+      }
+    }
+  }
+
+  std::filesystem::remove_all(std::filesystem::u8path(cacheDirectoryPath));
+}
+
+SCENARIO( "SgfcCachingDocumentReader limits the cache size", "[frontend][filesystem]" )
+{
+  std::string cacheDirectoryPath = GetCacheDirectoryPath();
+  auto reader = SgfcPlusPlusFactory::CreateCachingDocumentReader(cacheDirectoryPath);
+
+  GIVEN( "The maximum cache size is smaller than a single cache entry" )
+  {
+    reader->SetMaximumCacheSize(0);
+
+    WHEN( "SGF content is read" )
+    {
+      reader->ReadSgfContent("(;SZ[9]KM[6.5]B[aa])");
+
+      THEN( "The cache entry is evicted immediately" )
+      {
+        REQUIRE( GetCacheEntryFilePaths(cacheDirectoryPath).size() == 0 );
+      }
+    }
+  }
+
+  GIVEN( "New cache entries cause the cache to exceed the maximum cache size" )
+  {
+    reader->ReadSgfContent("(;SZ[9]KM[6.5]B[aa])");
+    auto entryFilePaths = GetCacheEntryFilePaths(cacheDirectoryPath);
+    REQUIRE( entryFilePaths.size() == 1 );
+    auto entryFileSize = std::filesystem::file_size(std::filesystem::u8path(entryFilePaths.front()));
+    reader->SetMaximumCacheSize(entryFileSize + entryFileSize / 2);
+
+    WHEN( "More SGF content is read" )
+    {
+      reader->ReadSgfContent("(;SZ[9]KM[6.5]B[bb])");
+      reader->ReadSgfContent("(;SZ[9]KM[6.5]B[cc])");
+
+      THEN( "The least recently used cache entries are evicted" )
+      {
+        auto entryFilePathsAfterEviction = GetCacheEntryFilePaths(cacheDirectoryPath);
+        REQUIRE( entryFilePathsAfterEviction.size() == 1 );
+        REQUIRE( entryFilePathsAfterEviction != entryFilePaths );
+      }
+    }
+  }
+
+  GIVEN( "The cache contains entries" )
+  {
+    reader->ReadSgfContent("(;SZ[9]KM[6.5]B[aa])");
+    reader->ReadSgfContent("(;SZ[19]KM[7.5]B[aa])");
+    REQUIRE( GetCacheEntryFilePaths(cacheDirectoryPath).size() == 2 );
+
+    WHEN( "The cache is cleared" )
+    {
+      reader->ClearCache();
+
+      THEN( "All cache entries are deleted" )
+      {
+        REQUIRE( GetCacheEntryFilePaths(cacheDirectoryPath).size() == 0 );
+      }
+    }
+  }
+
+  std::filesystem::remove_all(std::filesystem::u8path(cacheDirectoryPath));
+}
+
+SCENARIO( "SgfcCachingDocumentReader does not cache fatal errors", "[frontend][filesystem]" )
+{
+  std::string cacheDirectoryPath = GetCacheDirectoryPath();
+  auto reader = SgfcPlusPlusFactory::CreateCachingDocumentReader(cacheDirectoryPath);
+
+  GIVEN( "The arguments are invalid" )
+  {
+    reader->GetArguments()->AddArgument(SgfcArgumentType::HardLineBreakMode, 42);
+
+    WHEN( "SGF content is read" )
+    {
+      auto readResult = reader->ReadSgfContent("(;GM[1])");
+
+      THEN( "The read operation fails and no cache entry is stored" )
+      {
+        REQUIRE( readResult->GetExitCode() == SgfcExitCode::FatalError );
+        REQUIRE( GetCacheEntryFilePaths(cacheDirectoryPath).size() == 0 );
+      }
+    }
+  }
+
+  std::filesystem::remove_all(std::filesystem::u8path(cacheDirectoryPath));
+}
+
+std::string GetCacheDirectoryPath()
+{
+  // Using a random UUID as the directory name, it is reasonably safe to
+  // assume that the directory does not exist
+  return SgfcUtility::JoinPathComponents(
+    SgfcUtility::GetTempFolderPath(),
+    SgfcUtility::CreateUuid());
+}
+
+std::vector<std::string> GetCacheEntryFilePaths(const std::string& cacheDirectoryPath)
+{
+  std::vector<std::string> cacheEntryFilePaths;
+
+  for (const auto& directoryEntry : std::filesystem::directory_iterator(std::filesystem::u8path(cacheDirectoryPath)))
+  {
+    std::string filePath = directoryEntry.path().u8string();
+    if (SgfcUtility::StringEndsWith(filePath, "." + SgfcPrivateConstants::DocumentCacheFileSuffix))
+      cacheEntryFilePaths.push_back(filePath);
+  }
+
+  return cacheEntryFilePaths;
+}
+
+void AssertReadResultsAreEqual(std::shared_ptr<ISgfcDocumentReadResult> readResult1, std::shared_ptr<ISgfcDocumentReadResult> readResult2)
+{
+  REQUIRE( readResult1->GetExitCode() == readResult2->GetExitCode() );
+  REQUIRE( readResult1->IsSgfDataValid() == readResult2->IsSgfDataValid() );
+
+  auto parseResult1 = readResult1->GetParseResult();
+  auto parseResult2 = readResult2->GetParseResult();
+  REQUIRE( parseResult1.size() == parseResult2.size() );
+  for (std::vector<std::shared_ptr<ISgfcMessage>>::size_type indexOfMessage = 0; indexOfMessage < parseResult1.size(); indexOfMessage++)
+  {
+    auto message1 = parseResult1[indexOfMessage];
+    auto message2 = parseResult2[indexOfMessage];
+    REQUIRE( message1->GetMessageID() == message2->GetMessageID() );
+    REQUIRE( message1->GetMessageType() == message2->GetMessageType() );
+    REQUIRE( message1->GetLineNumber() == message2->GetLineNumber() );
+    REQUIRE( message1->GetColumnNumber() == message2->GetColumnNumber() );
+    REQUIRE( message1->IsCriticalMessage() == message2->IsCriticalMessage() );
+    REQUIRE( message1->GetLibraryErrorNumber() == message2->GetLibraryErrorNumber() );
+    REQUIRE( message1->GetMessageText() == message2->GetMessageText() );
+    REQUIRE( message1->GetFormattedMessageText() == message2->GetFormattedMessageText() );
+  }
+
+  auto games1 = readResult1->GetDocument()->GetGames();
+  auto games2 = readResult2->GetDocument()->GetGames();
+  REQUIRE( games1.size() == games2.size() );
+  for (std::vector<std::shared_ptr<ISgfcGame>>::size_type indexOfGame = 0; indexOfGame < games1.size(); indexOfGame++)
+  {
+    auto game1 = games1[indexOfGame];
+    auto game2 = games2[indexOfGame];
+    REQUIRE( game1->HasRootNode() == game2->HasRootNode() );
+    if (game1->HasRootNode())
+      REQUIRE( game1->GetRootNode()->GetProperties().size() == game2->GetRootNode()->GetProperties().size() );
+  }
+}
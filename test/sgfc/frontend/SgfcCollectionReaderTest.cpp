@@ -0,0 +1,335 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../RecordingDocumentReader.h"
+
+// Library includes
+#include <ISgfcCollectionReader.h>
+#include <ISgfcDocumentReadResult.h>
+#include <SgfcPlusPlusFactory.h>
+#include <SgfcUtility.h>
+
+// Unit test library includes
+#include <catch2/catch_test_macros.hpp>
+
+// C++ Standard Library includes
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+
+using namespace LibSgfcPlusPlus;
+
+
+std::string WriteCollectionSgfFile(const std::string& sgfContent);
+
+
+SCENARIO( "SgfcCollectionReader is constructed", "[frontend]" )
+{
+  auto documentReader = std::shared_ptr<RecordingDocumentReader>(new RecordingDocumentReader());
+
+  GIVEN( "The .sgf file exists" )
+  {
+    std::string sgfFilePath = WriteCollectionSgfFile("(;)(;)");
+
+    WHEN( "SgfcCollectionReader is constructed" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath, "", documentReader);
+
+      THEN( "SgfcCollectionReader has the expected state" )
+      {
+        REQUIRE( reader->GetSgfFilePath() == sgfFilePath );
+        REQUIRE( reader->GetDocumentReader() == documentReader );
+        REQUIRE( reader->IsIndexLoadedFromIndexFile() == false );
+        REQUIRE( reader->GetNumberOfGames() == 2 );
+      }
+    }
+
+    WHEN( "SgfcCollectionReader is constructed without a document reader" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath);
+
+      THEN( "SgfcCollectionReader uses a newly constructed document reader" )
+      {
+        REQUIRE( reader->GetDocumentReader() != nullptr );
+        REQUIRE( reader->GetNumberOfGames() == 2 );
+      }
+    }
+
+    WHEN( "The document reader is nullptr" )
+    {
+      THEN( "The SgfcCollectionReader constructor throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath, "", nullptr),
+          std::invalid_argument);
+      }
+    }
+
+    SgfcUtility::DeleteFileIfExists(sgfFilePath);
+  }
+
+  GIVEN( "The .sgf file does not exist" )
+  {
+    std::string sgfFilePath = SgfcUtility::GetUniqueTempFilePath();
+
+    WHEN( "SgfcCollectionReader is constructed" )
+    {
+      THEN( "The SgfcCollectionReader constructor throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath, "", documentReader),
+          std::runtime_error);
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcCollectionReader builds the index", "[frontend]" )
+{
+  auto documentReader = std::shared_ptr<RecordingDocumentReader>(new RecordingDocumentReader());
+
+  GIVEN( "The .sgf file contains text outside of the game trees" )
+  {
+    std::string sgfFilePath = WriteCollectionSgfFile("header (not a game) (;C[1])\n ( ;C[2]) trailer");
+    auto reader = SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath, "", documentReader);
+
+    WHEN( "SgfcCollectionReader reads the game trees" )
+    {
+      reader->ReadGame(0);
+      reader->ReadGame(1);
+
+      THEN( "Only the game trees are read" )
+      {
+        REQUIRE( reader->GetNumberOfGames() == 2 );
+        REQUIRE( documentReader->SgfContents == std::vector<std::string> { "(;C[1])", "( ;C[2])" } );
+      }
+    }
+
+    SgfcUtility::DeleteFileIfExists(sgfFilePath);
+  }
+
+  GIVEN( "The .sgf file contains property values with brackets and parentheses" )
+  {
+    std::string sgfFilePath = WriteCollectionSgfFile("(;C[a\\]b)(c];B[aa](;W[bb])(;W[cc]))(;C[)])");
+    auto reader = SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath, "", documentReader);
+
+    WHEN( "SgfcCollectionReader reads the game trees" )
+    {
+      reader->ReadGame(0);
+      reader->ReadGame(1);
+
+      THEN( "Brackets and parentheses in property values are ignored" )
+      {
+        REQUIRE( reader->GetNumberOfGames() == 2 );
+        REQUIRE( documentReader->SgfContents == std::vector<std::string> { "(;C[a\\]b)(c];B[aa](;W[bb])(;W[cc]))", "(;C[)])" } );
+      }
+    }
+
+    SgfcUtility::DeleteFileIfExists(sgfFilePath);
+  }
+
+  GIVEN( "The last game tree in the .sgf file is not terminated" )
+  {
+    std::string sgfFilePath = WriteCollectionSgfFile("(;C[1])(;C[2](;B[aa])");
+    auto reader = SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath, "", documentReader);
+
+    WHEN( "SgfcCollectionReader reads the last game tree" )
+    {
+      reader->ReadGame(1);
+
+      THEN( "The game tree extends to the end of the file" )
+      {
+        REQUIRE( reader->GetNumberOfGames() == 2 );
+        REQUIRE( documentReader->SgfContents == std::vector<std::string> { "(;C[2](;B[aa])" } );
+      }
+    }
+
+    SgfcUtility::DeleteFileIfExists(sgfFilePath);
+  }
+
+  GIVEN( "The .sgf file begins with a UTF-8 BOM" )
+  {
+    std::string sgfFilePath = WriteCollectionSgfFile("\xEF\xBB\xBF(;C[1])(;C[2])");
+    auto reader = SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath, "", documentReader);
+
+    WHEN( "SgfcCollectionReader reads a game tree" )
+    {
+      reader->ReadGame(1);
+
+      THEN( "The BOM is prepended to the game tree" )
+      {
+        REQUIRE( reader->GetNumberOfGames() == 2 );
+        REQUIRE( documentReader->SgfContents == std::vector<std::string> { "\xEF\xBB\xBF(;C[2])" } );
+      }
+    }
+
+    SgfcUtility::DeleteFileIfExists(sgfFilePath);
+  }
+
+  GIVEN( "The .sgf file does not contain game trees" )
+  {
+    std::string sgfFilePath = WriteCollectionSgfFile("foobar");
+    auto reader = SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath, "", documentReader);
+
+    WHEN( "SgfcCollectionReader is constructed" )
+    {
+      THEN( "The index is empty" )
+      {
+        REQUIRE( reader->GetNumberOfGames() == 0 );
+      }
+    }
+
+    SgfcUtility::DeleteFileIfExists(sgfFilePath);
+  }
+}
+
+SCENARIO( "SgfcCollectionReader reads game trees", "[frontend]" )
+{
+  auto documentReader = std::shared_ptr<RecordingDocumentReader>(new RecordingDocumentReader());
+  std::string sgfFilePath = WriteCollectionSgfFile("(;C[1])\n(;C[2])\n(;C[3])\n");
+  auto reader = SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath, "", documentReader);
+
+  GIVEN( "A range of game trees is read" )
+  {
+    WHEN( "SgfcCollectionReader reads the game trees" )
+    {
+      auto readResult = reader->ReadGames(1, 2);
+
+      THEN( "The game trees are read with a single read operation" )
+      {
+        REQUIRE( readResult != nullptr );
+        REQUIRE( documentReader->SgfContents == std::vector<std::string> { "(;C[2])\n(;C[3])" } );
+      }
+    }
+  }
+
+  GIVEN( "The game index or the range of game indexes is invalid" )
+  {
+    WHEN( "SgfcCollectionReader reads the game trees" )
+    {
+      THEN( "SgfcCollectionReader throws an exception" )
+      {
+        REQUIRE_THROWS_AS( reader->ReadGame(3), std::invalid_argument );
+        REQUIRE_THROWS_AS( reader->ReadGames(0, 0), std::invalid_argument );
+        REQUIRE_THROWS_AS( reader->ReadGames(2, 2), std::invalid_argument );
+        REQUIRE( documentReader->SgfContents.size() == 0 );
+      }
+    }
+  }
+
+  GIVEN( "The .sgf file was modified after the index was obtained" )
+  {
+    SgfcUtility::CreateOrTruncateFile(sgfFilePath);
+    SgfcUtility::AppendTextToFile(sgfFilePath, "(;C[1])");
+
+    WHEN( "SgfcCollectionReader reads a game tree" )
+    {
+      THEN( "SgfcCollectionReader throws an exception" )
+      {
+        REQUIRE_THROWS_AS( reader->ReadGame(1), std::runtime_error );
+      }
+    }
+  }
+
+  SgfcUtility::DeleteFileIfExists(sgfFilePath);
+}
+
+SCENARIO( "SgfcCollectionReader uses an index file", "[frontend][filesystem]" )
+{
+  auto documentReader = std::shared_ptr<RecordingDocumentReader>(new RecordingDocumentReader());
+  std::string sgfFilePath = WriteCollectionSgfFile("\xEF\xBB\xBF(;C[1])(;C[2])");
+  std::string indexFilePath = SgfcUtility::GetUniqueTempFilePath();
+
+  GIVEN( "The index file does not exist" )
+  {
+    WHEN( "SgfcCollectionReader is constructed" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath, indexFilePath, documentReader);
+
+      THEN( "The index is built and written to the index file" )
+      {
+        REQUIRE( reader->IsIndexLoadedFromIndexFile() == false );
+        REQUIRE( reader->GetNumberOfGames() == 2 );
+        REQUIRE( std::filesystem::exists(std::filesystem::u8path(indexFilePath)) == true );
+      }
+    }
+  }
+
+  GIVEN( "The index file was written for the current version of the .sgf file" )
+  {
+    SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath, indexFilePath, documentReader);
+
+    WHEN( "SgfcCollectionReader is constructed" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath, indexFilePath, documentReader);
+      reader->ReadGame(1);
+
+      THEN( "The index is loaded from the index file" )
+      {
+        REQUIRE( reader->IsIndexLoadedFromIndexFile() == true );
+        REQUIRE( reader->GetNumberOfGames() == 2 );
+        REQUIRE( documentReader->SgfContents == std::vector<std::string> { "\xEF\xBB\xBF(;C[2])" } );
+      }
+    }
+  }
+
+  GIVEN( "The index file was written for a different version of the .sgf file" )
+  {
+    SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath, indexFilePath, documentReader);
+    SgfcUtility::AppendTextToFile(sgfFilePath, "(;C[3])");
+
+    WHEN( "SgfcCollectionReader is constructed" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath, indexFilePath, documentReader);
+      auto secondReader = SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath, indexFilePath, documentReader);
+
+      THEN( "The index is built and the index file is replaced" )
+      {
+        REQUIRE( reader->IsIndexLoadedFromIndexFile() == false );
+        REQUIRE( reader->GetNumberOfGames() == 3 );
+        REQUIRE( secondReader->IsIndexLoadedFromIndexFile() == true );
+        REQUIRE( secondReader->GetNumberOfGames() == 3 );
+      }
+    }
+  }
+
+  GIVEN( "The index file is not an index file" )
+  {
+    SgfcUtility::AppendTextToFile(indexFilePath, "foobar");
+
+    WHEN( "SgfcCollectionReader is constructed" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateCollectionReader(sgfFilePath, indexFilePath, documentReader);
+
+      THEN( "The index is built" )
+      {
+        REQUIRE( reader->IsIndexLoadedFromIndexFile() == false );
+        REQUIRE( reader->GetNumberOfGames() == 2 );
+      }
+    }
+  }
+
+  SgfcUtility::DeleteFileIfExists(sgfFilePath);
+  SgfcUtility::DeleteFileIfExists(indexFilePath);
+}
+
+std::string WriteCollectionSgfFile(const std::string& sgfContent)
+{
+  std::string sgfFilePath = SgfcUtility::GetUniqueTempFilePath();
+  SgfcUtility::AppendTextToFile(sgfFilePath, sgfContent);
+  return sgfFilePath;
+}
@@ -25,6 +25,11 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators_range.hpp>
 
+// C++ Standard Library includes
+#include <limits>
+#include <string>
+#include <vector>
+
 using namespace LibSgfcPlusPlus;
 
 
@@ -33,6 +38,9 @@ void AssertSuccessReadResultWhenValidSgfContent(std::shared_ptr<ISgfcDocumentRea
 void AssertAllRootNodesContainCaProperty(std::shared_ptr<ISgfcDocumentReadResult> readResult, const SgfcSimpleText& textEncodingName);
 void AssertRootNodeContainsCaProperty(std::shared_ptr<ISgfcGame> game, const SgfcSimpleText& textEncodingName);
 void AssertRootNodeDoesNotContainCaProperty(std::shared_ptr<ISgfcGame> game);
+std::size_t GetNumberOfNodes(std::shared_ptr<ISgfcDocumentReadResult> readResult);
+std::string CreateLargeGameSgfContent(int numberOfMoves, int variationMoveNumber);
+void AssertGameTreesAreEqual(std::shared_ptr<ISgfcGame> game, std::shared_ptr<ISgfcGame> expectedGame);
 
 
 SCENARIO( "SgfcDocumentReader is constructed", "[frontend]" )
@@ -57,6 +65,15 @@ SCENARIO( "SgfcDocumentReader is constructed", "[frontend]" )
         REQUIRE( arguments != nullptr );
         REQUIRE( arguments->HasArguments() == false );
         REQUIRE( arguments->GetArguments().size() == 0 );
+
+        auto readOptions = reader.GetReadOptions();
+        REQUIRE( readOptions.IsMainVariationOnly == false );
+        REQUIRE( readOptions.MaximumDepth == std::numeric_limits<std::size_t>::max() );
+        REQUIRE( readOptions.MaximumNumberOfNodes == std::numeric_limits<std::size_t>::max() );
+        REQUIRE( readOptions.PropertyFilterMode == SgfcPropertyFilterMode::KeepAllProperties );
+        REQUIRE( readOptions.PropertyFilterTypes.size() == 0 );
+        REQUIRE( readOptions.PropertyFilterNames.size() == 0 );
+        REQUIRE( readOptions.NumberOfThreads == 1 );
       }
     }
   }
@@ -308,6 +325,317 @@ SCENARIO("The read operation behaviour is changed by arguments", "[frontend]")
   // TODO: Add more tests that excercise the argument types
 }
 
+SCENARIO( "The read operation behaviour is changed by read options", "[frontend]" )
+{
+  SgfcDocumentReader reader;
+  SgfcDocumentReadOptions readOptions;
+
+  // Node depths: B[aa] = 1, W[bb] = 2, B[cc] = 3, W[dd] = 2
+  std::string sgfContent = "(;FF[4]GM[1]SZ[19];B[aa](;W[bb];B[cc])(;W[dd]))";
+
+  GIVEN( "The default read options are used" )
+  {
+    WHEN( "SgfcDocumentReader performs the read operation" )
+    {
+      reader.SetReadOptions(readOptions);
+      auto readResult = reader.ReadSgfContent(sgfContent);
+
+      THEN( "All nodes are built and the document is not truncated" )
+      {
+        AssertSuccessReadResultWhenValidSgfContent(readResult);
+        REQUIRE( readResult->IsDocumentTruncated() == false );
+        REQUIRE( GetNumberOfNodes(readResult) == 5 );
+      }
+    }
+  }
+
+  GIVEN( "Only the main variation is read" )
+  {
+    readOptions.IsMainVariationOnly = true;
+
+    WHEN( "SgfcDocumentReader performs the read operation" )
+    {
+      reader.SetReadOptions(readOptions);
+      auto readResult = reader.ReadSgfContent(sgfContent);
+
+      THEN( "Only the main variation is built and the document is truncated" )
+      {
+        AssertSuccessReadResultWhenValidSgfContent(readResult);
+        REQUIRE( readResult->IsDocumentTruncated() == true );
+        REQUIRE( GetNumberOfNodes(readResult) == 4 );
+        auto firstMoveNode = readResult->GetDocument()->GetGame()->GetRootNode()->GetFirstChild();
+        REQUIRE( firstMoveNode->GetChildren().size() == 1 );
+      }
+    }
+  }
+
+  GIVEN( "The maximum depth is limited" )
+  {
+    WHEN( "The game tree is deeper than the maximum depth" )
+    {
+      readOptions.MaximumDepth = 2;
+      reader.SetReadOptions(readOptions);
+      auto readResult = reader.ReadSgfContent(sgfContent);
+
+      THEN( "Nodes that are deeper than the maximum depth are not built and the document is truncated" )
+      {
+        AssertSuccessReadResultWhenValidSgfContent(readResult);
+        REQUIRE( readResult->IsDocumentTruncated() == true );
+        REQUIRE( GetNumberOfNodes(readResult) == 4 );
+      }
+    }
+
+    WHEN( "The maximum depth is 0" )
+    {
+      readOptions.MaximumDepth = 0;
+      reader.SetReadOptions(readOptions);
+      auto readResult = reader.ReadSgfContent(sgfContent);
+
+      THEN( "Only the root node is built and the document is truncated" )
+      {
+        AssertSuccessReadResultWhenValidSgfContent(readResult);
+        REQUIRE( readResult->IsDocumentTruncated() == true );
+        REQUIRE( GetNumberOfNodes(readResult) == 1 );
+      }
+    }
+
+    WHEN( "The game tree is not deeper than the maximum depth" )
+    {
+      readOptions.MaximumDepth = 3;
+      reader.SetReadOptions(readOptions);
+      auto readResult = reader.ReadSgfContent(sgfContent);
+
+      THEN( "All nodes are built and the document is not truncated" )
+      {
+        AssertSuccessReadResultWhenValidSgfContent(readResult);
+        REQUIRE( readResult->IsDocumentTruncated() == false );
+        REQUIRE( GetNumberOfNodes(readResult) == 5 );
+      }
+    }
+  }
+
+  GIVEN( "The maximum number of nodes is limited" )
+  {
+    WHEN( "The game tree has more nodes than the maximum number of nodes" )
+    {
+      readOptions.MaximumNumberOfNodes = 3;
+      reader.SetReadOptions(readOptions);
+      auto readResult = reader.ReadSgfContent(sgfContent);
+
+      THEN( "The nodes are built in depth-first order up to the limit and the document is truncated" )
+      {
+        AssertSuccessReadResultWhenValidSgfContent(readResult);
+        REQUIRE( readResult->IsDocumentTruncated() == true );
+        REQUIRE( GetNumberOfNodes(readResult) == 3 );
+        auto firstMoveNode = readResult->GetDocument()->GetGame()->GetRootNode()->GetFirstChild();
+        REQUIRE( firstMoveNode->GetFirstChild()->HasChildren() == false );
+      }
+    }
+
+    WHEN( "The game tree has exactly the maximum number of nodes" )
+    {
+      readOptions.MaximumNumberOfNodes = 5;
+      reader.SetReadOptions(readOptions);
+      auto readResult = reader.ReadSgfContent(sgfContent);
+
+      THEN( "All nodes are built and the document is not truncated" )
+      {
+        AssertSuccessReadResultWhenValidSgfContent(readResult);
+        REQUIRE( readResult->IsDocumentTruncated() == false );
+        REQUIRE( GetNumberOfNodes(readResult) == 5 );
+      }
+    }
+  }
+}
+
+SCENARIO( "The read operation builds games on multiple threads", "[frontend]" )
+{
+  SgfcDocumentReader reader;
+  SgfcDocumentReadOptions readOptions;
+
+  // The empty C property value in the last game generates a warning
+  std::string sgfContent =
+    "(;FF[4]GM[1]SZ[9];B[aa];W[bb])\n"
+    "(;FF[4]GM[1]SZ[13];B[cc](;W[dd])(;W[ee]))\n"
+    "(;FF[4]GM[1]SZ[19];B[ff]C[])\n";
+
+  GIVEN( "The number of threads is greater than 1" )
+  {
+    unsigned int numberOfThreads = GENERATE( 0, 2, 8 );
+    readOptions.NumberOfThreads = numberOfThreads;
+
+    WHEN( "SgfcDocumentReader performs the read operation" )
+    {
+      reader.SetReadOptions(readOptions);
+      auto readResult = reader.ReadSgfContent(sgfContent);
+
+      THEN( "The games are in the same order and the messages are the same as if one thread were used" )
+      {
+        SgfcDocumentReader singleThreadReader;
+        auto singleThreadReadResult = singleThreadReader.ReadSgfContent(sgfContent);
+
+        REQUIRE( readResult->GetExitCode() == singleThreadReadResult->GetExitCode() );
+        REQUIRE( readResult->IsDocumentTruncated() == false );
+
+        auto games = readResult->GetDocument()->GetGames();
+        REQUIRE( games.size() == 3 );
+        REQUIRE( games[0]->GetBoardSize().Columns == 9 );
+        REQUIRE( games[1]->GetBoardSize().Columns == 13 );
+        REQUIRE( games[2]->GetBoardSize().Columns == 19 );
+        REQUIRE( games[1]->GetRootNode()->GetFirstChild()->GetChildren().size() == 2 );
+
+        auto parseResult = readResult->GetParseResult();
+        auto singleThreadParseResult = singleThreadReadResult->GetParseResult();
+        REQUIRE( parseResult.size() == singleThreadParseResult.size() );
+        REQUIRE( parseResult.size() > 0 );
+        for (std::size_t indexOfMessage = 0; indexOfMessage < parseResult.size(); indexOfMessage++)
+        {
+          REQUIRE( parseResult[indexOfMessage]->GetMessageID() == singleThreadParseResult[indexOfMessage]->GetMessageID() );
+          REQUIRE( parseResult[indexOfMessage]->GetLineNumber() == singleThreadParseResult[indexOfMessage]->GetLineNumber() );
+          REQUIRE( parseResult[indexOfMessage]->GetColumnNumber() == singleThreadParseResult[indexOfMessage]->GetColumnNumber() );
+        }
+        REQUIRE( parseResult.front()->GetLineNumber() == 3 );
+      }
+    }
+  }
+}
+
+SCENARIO( "The read operation decodes the nodes of a single game on multiple threads", "[frontend]" )
+{
+  SgfcDocumentReader reader;
+  SgfcDocumentReadOptions readOptions;
+
+  // Enough nodes for several decoding chunks, with a variation that starts
+  // in the middle of a chunk
+  std::string sgfContent = CreateLargeGameSgfContent(1000, 300);
+
+  GIVEN( "The number of threads is greater than 1" )
+  {
+    unsigned int numberOfThreads = GENERATE( 0, 2, 8 );
+    readOptions.NumberOfThreads = numberOfThreads;
+
+    WHEN( "SgfcDocumentReader performs the read operation" )
+    {
+      reader.SetReadOptions(readOptions);
+      auto readResult = reader.ReadSgfContent(sgfContent);
+
+      THEN( "The game tree is the same as if one thread were used" )
+      {
+        SgfcDocumentReader singleThreadReader;
+        auto singleThreadReadResult = singleThreadReader.ReadSgfContent(sgfContent);
+
+        AssertSuccessReadResultWhenValidSgfContent(readResult);
+        REQUIRE( readResult->IsDocumentTruncated() == false );
+        REQUIRE( GetNumberOfNodes(readResult) == 1 + 1000 + 10 );
+        AssertGameTreesAreEqual(
+          readResult->GetDocument()->GetGame(),
+          singleThreadReadResult->GetDocument()->GetGame());
+      }
+    }
+
+    WHEN( "The game tree has more nodes than the maximum number of nodes" )
+    {
+      readOptions.MaximumNumberOfNodes = 600;
+      reader.SetReadOptions(readOptions);
+      auto readResult = reader.ReadSgfContent(sgfContent);
+
+      THEN( "The nodes are built in depth-first order up to the limit and the document is truncated" )
+      {
+        AssertSuccessReadResultWhenValidSgfContent(readResult);
+        REQUIRE( readResult->IsDocumentTruncated() == true );
+        REQUIRE( GetNumberOfNodes(readResult) == 600 );
+      }
+    }
+  }
+}
+
+SCENARIO( "The read operation filters properties", "[frontend]" )
+{
+  SgfcDocumentReader reader;
+  SgfcDocumentReadOptions readOptions;
+
+  // SGFC generates warnings for the private properties XA and XB
+  reader.GetArguments()->AddArgument(SgfcArgumentType::DisableWarningMessages);
+  std::string sgfContent = "(;FF[4]GM[1]SZ[19]XA[foo];B[aa]C[comment]CR[bb]XB[bar]LB[cc:label])";
+
+  GIVEN( "Listed properties are dropped" )
+  {
+    readOptions.PropertyFilterMode = SgfcPropertyFilterMode::DropListedProperties;
+    readOptions.PropertyFilterTypes = { SgfcPropertyType::C, SgfcPropertyType::CR, SgfcPropertyType::LB };
+    readOptions.PropertyFilterNames = { "XA" };
+
+    WHEN( "SgfcDocumentReader performs the read operation" )
+    {
+      reader.SetReadOptions(readOptions);
+      auto readResult = reader.ReadSgfContent(sgfContent);
+
+      THEN( "The listed properties are not built" )
+      {
+        AssertSuccessReadResultWhenValidSgfContent(readResult);
+        REQUIRE( readResult->IsDocumentTruncated() == false );
+        auto rootNode = readResult->GetDocument()->GetGame()->GetRootNode();
+        REQUIRE( rootNode->GetProperty("XA") == nullptr );
+        REQUIRE( rootNode->GetProperty(SgfcPropertyType::SZ) != nullptr );
+        auto moveNode = rootNode->GetFirstChild();
+        REQUIRE( moveNode->GetProperty(SgfcPropertyType::B) != nullptr );
+        REQUIRE( moveNode->GetProperty("XB") != nullptr );
+        REQUIRE( moveNode->GetProperty(SgfcPropertyType::C) == nullptr );
+        REQUIRE( moveNode->GetProperty(SgfcPropertyType::CR) == nullptr );
+        REQUIRE( moveNode->GetProperty(SgfcPropertyType::LB) == nullptr );
+      }
+    }
+  }
+
+  GIVEN( "All properties not defined by the SGF standard are dropped" )
+  {
+    readOptions.PropertyFilterMode = SgfcPropertyFilterMode::DropListedProperties;
+    readOptions.PropertyFilterTypes = { SgfcPropertyType::Unknown };
+
+    WHEN( "SgfcDocumentReader performs the read operation" )
+    {
+      reader.SetReadOptions(readOptions);
+      auto readResult = reader.ReadSgfContent(sgfContent);
+
+      THEN( "The private properties are not built" )
+      {
+        AssertSuccessReadResultWhenValidSgfContent(readResult);
+        auto rootNode = readResult->GetDocument()->GetGame()->GetRootNode();
+        REQUIRE( rootNode->GetProperty("XA") == nullptr );
+        auto moveNode = rootNode->GetFirstChild();
+        REQUIRE( moveNode->GetProperty("XB") == nullptr );
+        REQUIRE( moveNode->GetProperties().size() == 4 );
+      }
+    }
+  }
+
+  GIVEN( "Only listed properties are kept" )
+  {
+    readOptions.PropertyFilterMode = SgfcPropertyFilterMode::KeepListedProperties;
+    readOptions.PropertyFilterTypes = { SgfcPropertyType::GM, SgfcPropertyType::SZ, SgfcPropertyType::B };
+    readOptions.PropertyFilterNames = { "XB" };
+
+    WHEN( "SgfcDocumentReader performs the read operation" )
+    {
+      reader.SetReadOptions(readOptions);
+      auto readResult = reader.ReadSgfContent(sgfContent);
+
+      THEN( "Only the listed properties are built" )
+      {
+        AssertSuccessReadResultWhenValidSgfContent(readResult);
+        auto rootNode = readResult->GetDocument()->GetGame()->GetRootNode();
+        REQUIRE( rootNode->GetProperty(SgfcPropertyType::GM) != nullptr );
+        REQUIRE( rootNode->GetProperty(SgfcPropertyType::SZ) != nullptr );
+        REQUIRE( rootNode->GetProperty(SgfcPropertyType::FF) == nullptr );
+        REQUIRE( rootNode->GetProperty("XA") == nullptr );
+        auto moveNode = rootNode->GetFirstChild();
+        REQUIRE( moveNode->GetProperties().size() == 2 );
+        REQUIRE( moveNode->GetProperty(SgfcPropertyType::B) != nullptr );
+        REQUIRE( moveNode->GetProperty("XB") != nullptr );
+      }
+    }
+  }
+}
+
 SCENARIO( "SgfcDocumentReader performs post-processing", "[frontend]" )
 {
   GIVEN( "Encoding mode 1 or 2 are used" )
@@ -477,3 +805,82 @@ void AssertRootNodeDoesNotContainCaProperty(std::shared_ptr<ISgfcGame> game)
   auto caProperty = rootNode->GetProperty(SgfcPropertyType::CA);
   REQUIRE( caProperty == nullptr );
 }
+
+std::size_t GetNumberOfNodes(std::shared_ptr<ISgfcDocumentReadResult> readResult)
+{
+  std::size_t numberOfNodes = 0;
+
+  std::vector<std::shared_ptr<ISgfcNode>> nodes = { readResult->GetDocument()->GetGame()->GetRootNode() };
+  while (! nodes.empty())
+  {
+    auto node = nodes.back();
+    nodes.pop_back();
+    numberOfNodes++;
+
+    for (auto child : node->GetChildren())
+      nodes.push_back(child);
+  }
+
+  return numberOfNodes;
+}
+
+std::string CreateLargeGameSgfContent(int numberOfMoves, int variationMoveNumber)
+{
+  std::string sgfContent = "(;FF[4]GM[1]SZ[19]";
+
+  for (int moveNumber = 1; moveNumber <= numberOfMoves; moveNumber++)
+  {
+    if (moveNumber == variationMoveNumber)
+    {
+      // The variation is a sibling of the main variation's move and ends
+      // after 10 moves
+      sgfContent += "(";
+      for (int variationMoveIndex = 0; variationMoveIndex < 10; variationMoveIndex++)
+        sgfContent += ";C[variation move " + std::to_string(variationMoveIndex) + "]";
+      sgfContent += ")(";
+    }
+
+    std::string color = (moveNumber % 2 == 1) ? "B" : "W";
+    char column = static_cast<char>('a' + (moveNumber % 19));
+    char row = static_cast<char>('a' + ((moveNumber / 19) % 19));
+    sgfContent += ";" + color + "[" + column + row + "]C[move " + std::to_string(moveNumber) + "]";
+  }
+
+  if (variationMoveNumber <= numberOfMoves)
+    sgfContent += ")";
+
+  sgfContent += ")";
+
+  return sgfContent;
+}
+
+void AssertGameTreesAreEqual(std::shared_ptr<ISgfcGame> game, std::shared_ptr<ISgfcGame> expectedGame)
+{
+  std::vector<std::shared_ptr<ISgfcNode>> nodes = { game->GetRootNode() };
+  std::vector<std::shared_ptr<ISgfcNode>> expectedNodes = { expectedGame->GetRootNode() };
+  while (! expectedNodes.empty())
+  {
+    REQUIRE( nodes.size() == expectedNodes.size() );
+
+    auto node = nodes.back();
+    nodes.pop_back();
+    auto expectedNode = expectedNodes.back();
+    expectedNodes.pop_back();
+
+    auto properties = node->GetProperties();
+    auto expectedProperties = expectedNode->GetProperties();
+    REQUIRE( properties.size() == expectedProperties.size() );
+    for (std::size_t indexOfProperty = 0; indexOfProperty < properties.size(); indexOfProperty++)
+    {
+      REQUIRE( properties[indexOfProperty]->GetPropertyType() == expectedProperties[indexOfProperty]->GetPropertyType() );
+      REQUIRE( properties[indexOfProperty]->GetPropertyValue()->ToSingleValue()->GetRawValue() == expectedProperties[indexOfProperty]->GetPropertyValue()->ToSingleValue()->GetRawValue() );
+    }
+
+    for (auto child : node->GetChildren())
+      nodes.push_back(child);
+    for (auto expectedChild : expectedNode->GetChildren())
+      expectedNodes.push_back(expectedChild);
+  }
+
+  REQUIRE( nodes.empty() == true );
+}
@@ -18,11 +18,16 @@
 #include <document/SgfcDocument.h>
 #include <document/SgfcGame.h>
 #include <document/SgfcNode.h>
+#include <ISgfcPropertyFactory.h>
+#include <ISgfcPropertyValueFactory.h>
+#include <ISgfcTextPropertyValue.h>
+#include <ISgfcTreeBuilder.h>
 #include <sgfc/argument/SgfcArgument.h>
 #include <sgfc/argument/SgfcArguments.h>
 #include <sgfc/frontend/SgfcDocumentWriter.h>
 #include <sgfc/frontend/SgfcDocumentWriteResult.h>
 #include <SgfcConstants.h>
+#include <SgfcPlusPlusFactory.h>
 #include <SgfcUtility.h>
 
 // Unit test library includes
@@ -61,6 +66,8 @@ SCENARIO( "SgfcDocumentWriter is constructed", "[frontend]" )
         REQUIRE( argument->GetArgumentType() == SgfcArgumentType::DefaultEncoding );
         REQUIRE( argument->HasStringTypeParameter() == true );
         REQUIRE( argument->GetStringTypeParameter() == "UTF-8" );
+        REQUIRE( writer.GetNumberOfThreads() == 1 );
+        REQUIRE( writer.GetUseIncrementalEncoding() == false );
       }
     }
   }
@@ -213,6 +220,55 @@ SCENARIO( "SgfcDocumentWriter writes SGF content to a string", "[frontend]" )
   // TODO: Add more tests for various compositions of the document
 }
 
+SCENARIO( "SgfcDocumentWriter encodes documents incrementally", "[frontend]" )
+{
+  GIVEN( "Incremental encoding is enabled" )
+  {
+    auto document = std::shared_ptr<ISgfcDocument>(new SgfcDocument());
+    auto rootNode = SgfcPlusPlusFactory::CreateNode();
+    auto game = SgfcPlusPlusFactory::CreateGame(rootNode);
+    document->AppendGame(game);
+
+    SgfcDocumentWriter writer;
+    writer.SetUseIncrementalEncoding(true);
+
+    std::string sgfContent;
+    writer.WriteSgfContent(document, sgfContent);
+
+    WHEN( "The document is modified and written again" )
+    {
+      std::shared_ptr<ISgfcPropertyValue> commentPropertyValue =
+        SgfcPlusPlusFactory::CreatePropertyValueFactory()->CreateTextPropertyValue("foo");
+      auto commentProperty = SgfcPlusPlusFactory::CreatePropertyFactory()->CreateProperty(SgfcPropertyType::C, commentPropertyValue);
+      auto childNode = SgfcPlusPlusFactory::CreateNode();
+      childNode->AppendProperty(commentProperty);
+      game->GetTreeBuilder()->AppendChild(rootNode, childNode);
+
+      auto writeResult = writer.WriteSgfContent(document, sgfContent);
+
+      THEN( "The SGF content is the same as when the document is written without incremental encoding" )
+      {
+        SgfcDocumentWriter nonIncrementalWriter;
+        std::string expectedSgfContent;
+        nonIncrementalWriter.WriteSgfContent(document, expectedSgfContent);
+
+        REQUIRE( writer.GetUseIncrementalEncoding() == true );
+        REQUIRE( sgfContent == expectedSgfContent );
+      }
+    }
+
+    WHEN( "Incremental encoding is disabled" )
+    {
+      writer.SetUseIncrementalEncoding(false);
+
+      THEN( "SgfcDocumentWriter no longer encodes incrementally" )
+      {
+        REQUIRE( writer.GetUseIncrementalEncoding() == false );
+      }
+    }
+  }
+}
+
 SCENARIO("The write operation behaviour is changed by arguments", "[frontend]")
 {
   SgfcDocumentWriter writer;
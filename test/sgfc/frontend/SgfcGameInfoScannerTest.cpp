@@ -0,0 +1,217 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Library includes
+#include <ISgfcDocumentReadResult.h>
+#include <ISgfcGameInfo.h>
+#include <ISgfcGameInfoScanner.h>
+#include <ISgfcGoGameInfo.h>
+#include <SgfcConstants.h>
+#include <SgfcPlusPlusFactory.h>
+#include <SgfcUtility.h>
+
+// Unit test library includes
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+using namespace LibSgfcPlusPlus;
+
+
+SCENARIO( "SgfcGameInfoScanner scans well-formed SGF content", "[frontend]" )
+{
+  auto scanner = SgfcPlusPlusFactory::CreateGameInfoScanner();
+
+  GIVEN( "The SGF content contains the game info properties in the root node" )
+  {
+    std::string sgfContent = "(;FF[4]GM[1]SZ[13]CA[UTF-8]PB[Black]PW[White]DT[2024-01-01]RE[B+R]KM[6.5]HA[2];B[aa];W[bb])";
+
+    WHEN( "SgfcGameInfoScanner scans the content" )
+    {
+      auto scanResult = scanner->ScanSgfContent(sgfContent);
+
+      THEN( "The header scanner provides the game info" )
+      {
+        REQUIRE( scanResult.IsFallbackUsed == false );
+        REQUIRE( scanResult.FallbackReadResult == nullptr );
+        REQUIRE( scanResult.GameInfos.size() == 1 );
+        auto gameInfo = scanResult.GameInfos.front();
+        REQUIRE( gameInfo->GetGameType() == SgfcGameType::Go );
+        REQUIRE( gameInfo->GetBoardSize().Columns == 13 );
+        REQUIRE( gameInfo->GetBoardSize().Rows == 13 );
+        REQUIRE( gameInfo->GetBlackPlayerName() == "Black" );
+        REQUIRE( gameInfo->GetWhitePlayerName() == "White" );
+        REQUIRE( gameInfo->GetRawGameDates() == "2024-01-01" );
+        REQUIRE( gameInfo->GetRawGameResult() == "B+R" );
+        auto goGameInfo = gameInfo->ToGoGameInfo();
+        REQUIRE( goGameInfo != nullptr );
+        REQUIRE( goGameInfo->GetKomi() == 6.5 );
+        REQUIRE( goGameInfo->GetNumberOfHandicapStones() == 2 );
+      }
+    }
+  }
+
+  GIVEN( "The SGF content contains the game info properties in a node below the root node" )
+  {
+    std::string sgfContent = "(;GM[1]SZ[9:9];C[comment](;PB[Black];B[aa])(;PB[Other];B[bb]))";
+
+    WHEN( "SgfcGameInfoScanner scans the content" )
+    {
+      auto scanResult = scanner->ScanSgfContent(sgfContent);
+
+      THEN( "The game info is taken from the first game info node" )
+      {
+        REQUIRE( scanResult.IsFallbackUsed == false );
+        REQUIRE( scanResult.GameInfos.size() == 1 );
+        auto gameInfo = scanResult.GameInfos.front();
+        REQUIRE( gameInfo->GetBoardSize().Columns == 9 );
+        REQUIRE( gameInfo->GetBlackPlayerName() == "Black" );
+      }
+    }
+  }
+
+  GIVEN( "The SGF content contains multiple game trees" )
+  {
+    std::string sgfContent = "Header text\n(;GM[1]PB[First](;B[aa])(;B[bb]))\n(;GM[1]PB[Second];W[cc])\n";
+
+    WHEN( "SgfcGameInfoScanner scans the content" )
+    {
+      auto scanResult = scanner->ScanSgfContent(sgfContent);
+
+      THEN( "The header scanner provides one game info per game tree" )
+      {
+        REQUIRE( scanResult.IsFallbackUsed == false );
+        REQUIRE( scanResult.GameInfos.size() == 2 );
+        REQUIRE( scanResult.GameInfos[0]->GetBlackPlayerName() == "First" );
+        REQUIRE( scanResult.GameInfos[1]->GetBlackPlayerName() == "Second" );
+        REQUIRE( scanResult.GameInfos[1]->GetBoardSize() == SgfcConstants::BoardSizeDefaultGo );
+      }
+    }
+  }
+
+  GIVEN( "The SGF content contains escaped characters" )
+  {
+    std::string sgfContent = "(;GM[1]PB[Black \\] Player]PW[White\\\\Player])";
+
+    WHEN( "SgfcGameInfoScanner scans the content" )
+    {
+      auto scanResult = scanner->ScanSgfContent(sgfContent);
+
+      THEN( "The escape characters are removed" )
+      {
+        REQUIRE( scanResult.IsFallbackUsed == false );
+        REQUIRE( scanResult.GameInfos.size() == 1 );
+        REQUIRE( scanResult.GameInfos.front()->GetBlackPlayerName() == "Black ] Player" );
+        REQUIRE( scanResult.GameInfos.front()->GetWhitePlayerName() == "White\\Player" );
+      }
+    }
+  }
+
+  GIVEN( "The SGF content contains non-ASCII characters" )
+  {
+    auto testData = GENERATE( table<std::string, std::string>(
+      {
+        // No CA property, the default encoding ISO-8859-1 is used
+        std::make_tuple("(;GM[1]PB[Ren\xE9])", "Ren\xC3\xA9"),
+        std::make_tuple("(;GM[1]CA[iso-8859-1]PB[Ren\xE9])", "Ren\xC3\xA9"),
+        std::make_tuple("(;GM[1]CA[UTF-8]PB[Ren\xC3\xA9])", "Ren\xC3\xA9"),
+        std::make_tuple("\xEF\xBB\xBF(;GM[1]PB[Ren\xC3\xA9])", "Ren\xC3\xA9"),
+      }));
+
+    WHEN( "SgfcGameInfoScanner scans the content" )
+    {
+      auto scanResult = scanner->ScanSgfContent(std::get<0>(testData));
+
+      THEN( "The values are decoded to UTF-8" )
+      {
+        REQUIRE( scanResult.IsFallbackUsed == false );
+        REQUIRE( scanResult.GameInfos.size() == 1 );
+        REQUIRE( scanResult.GameInfos.front()->GetBlackPlayerName() == std::get<1>(testData) );
+      }
+    }
+  }
+
+  GIVEN( "The SGF content is located in the filesystem" )
+  {
+    std::string sgfFilePath = SgfcUtility::GetUniqueTempFilePath();
+    SgfcUtility::AppendTextToFile(sgfFilePath, "(;GM[1]PB[Black])");
+
+    WHEN( "SgfcGameInfoScanner scans the file" )
+    {
+      auto scanResult = scanner->ScanSgfFile(sgfFilePath);
+
+      THEN( "The header scanner provides the game info" )
+      {
+        REQUIRE( scanResult.IsFallbackUsed == false );
+        REQUIRE( scanResult.GameInfos.size() == 1 );
+        REQUIRE( scanResult.GameInfos.front()->GetBlackPlayerName() == "Black" );
+      }
+    }
+
+    SgfcUtility::DeleteFileIfExists(sgfFilePath);
+  }
+}
+
+SCENARIO( "SgfcGameInfoScanner falls back to the full read", "[frontend]" )
+{
+  auto scanner = SgfcPlusPlusFactory::CreateGameInfoScanner();
+
+  GIVEN( "The SGF content cannot be handled by the header scanner" )
+  {
+    auto sgfContent = GENERATE(
+      std::string(""),
+      std::string("(;GM[1]PB[Black]"),
+      std::string("(;GM[1]PB[Black)"),
+      std::string("(;GaMe[1]PB[Black])"),
+      std::string("(;GM[1]PB[Black]PB[Other])"),
+      std::string("(;GM[1]KM[abc])"),
+      std::string("(;GM[1]PB[ Black])"),
+      std::string("(;GM[1]PB[])"),
+      std::string("(;GM[1]SZ[100])"),
+      std::string("(;GM[1]CA[Shift_JIS]PB[Black])"),
+      std::string("(;GM[1]CA[UTF-8]PB[\xE9])"),
+      std::string("(;GM[1](;B[aa]);W[bb])"),
+      std::string("(;GM[1]PB[Black]) junk"));
+
+    WHEN( "SgfcGameInfoScanner scans the content" )
+    {
+      auto scanResult = scanner->ScanSgfContent(sgfContent);
+
+      THEN( "The fallback is used" )
+      {
+        REQUIRE( scanResult.IsFallbackUsed == true );
+        REQUIRE( scanResult.FallbackReadResult != nullptr );
+      }
+    }
+  }
+
+  GIVEN( "The SGF file does not exist" )
+  {
+    std::string sgfFilePath = SgfcUtility::GetUniqueTempFilePath();
+
+    WHEN( "SgfcGameInfoScanner scans the file" )
+    {
+      auto scanResult = scanner->ScanSgfFile(sgfFilePath);
+
+      THEN( "The fallback is used and the scan operation fails" )
+      {
+        REQUIRE( scanResult.IsFallbackUsed == true );
+        REQUIRE( scanResult.FallbackReadResult != nullptr );
+        REQUIRE( scanResult.FallbackReadResult->GetExitCode() == SgfcExitCode::FatalError );
+        REQUIRE( scanResult.GameInfos.empty() );
+      }
+    }
+  }
+}
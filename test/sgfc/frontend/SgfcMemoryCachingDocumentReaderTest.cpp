@@ -0,0 +1,324 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Project includes
+#include "../../RecordingDocumentReader.h"
+
+// Library includes
+#include <ISgfcArguments.h>
+#include <ISgfcDocumentReadResult.h>
+#include <ISgfcMemoryCachingDocumentReader.h>
+#include <SgfcPlusPlusFactory.h>
+#include <SgfcPrivateConstants.h>
+#include <SgfcUtility.h>
+
+// Unit test library includes
+#include <catch2/catch_test_macros.hpp>
+
+// C++ Standard Library includes
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace LibSgfcPlusPlus;
+
+
+SCENARIO( "SgfcMemoryCachingDocumentReader is constructed", "[frontend]" )
+{
+  GIVEN( "A document reader is specified" )
+  {
+    WHEN( "SgfcMemoryCachingDocumentReader is constructed" )
+    {
+      auto documentReader = std::shared_ptr<RecordingDocumentReader>(new RecordingDocumentReader());
+      auto reader = SgfcPlusPlusFactory::CreateMemoryCachingDocumentReader(documentReader);
+
+      THEN( "SgfcMemoryCachingDocumentReader has the expected default state" )
+      {
+        REQUIRE( reader->GetArguments() == documentReader->GetArguments() );
+        REQUIRE( reader->GetCacheKeyType() == SgfcDocumentCacheKeyType::FileMetadata );
+        REQUIRE( reader->GetMaximumMemoryUsage() == SgfcPrivateConstants::DocumentCacheDefaultMaximumMemoryUsage );
+
+        auto statistics = reader->GetStatistics();
+        REQUIRE( statistics.NumberOfHits == 0 );
+        REQUIRE( statistics.NumberOfMisses == 0 );
+        REQUIRE( statistics.NumberOfCoalescedReads == 0 );
+        REQUIRE( statistics.NumberOfEvictions == 0 );
+        REQUIRE( statistics.NumberOfReadResults == 0 );
+        REQUIRE( statistics.MemoryUsage == 0 );
+      }
+    }
+  }
+
+  GIVEN( "The document reader is nullptr" )
+  {
+    WHEN( "SgfcMemoryCachingDocumentReader is constructed" )
+    {
+      THEN( "The SgfcMemoryCachingDocumentReader constructor throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          SgfcPlusPlusFactory::CreateMemoryCachingDocumentReader(nullptr),
+          std::invalid_argument);
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcMemoryCachingDocumentReader caches read results", "[frontend]" )
+{
+  auto documentReader = std::shared_ptr<RecordingDocumentReader>(new RecordingDocumentReader());
+  auto reader = SgfcPlusPlusFactory::CreateMemoryCachingDocumentReader(documentReader);
+
+  GIVEN( "SGF content is read from a string" )
+  {
+    WHEN( "The same SGF content is read twice" )
+    {
+      auto readResult1 = reader->ReadSgfContent("(;)");
+      auto readResult2 = reader->ReadSgfContent("(;)");
+
+      THEN( "The second read operation returns the cached read result" )
+      {
+        REQUIRE( documentReader->NumberOfReadOperations == 1 );
+        REQUIRE( readResult1 == readResult2 );
+
+        auto statistics = reader->GetStatistics();
+        REQUIRE( statistics.NumberOfHits == 1 );
+        REQUIRE( statistics.NumberOfMisses == 1 );
+        REQUIRE( statistics.NumberOfReadResults == 1 );
+        REQUIRE( statistics.MemoryUsage > 0 );
+      }
+    }
+
+    WHEN( "Different SGF content is read" )
+    {
+      auto readResult1 = reader->ReadSgfContent("(;)");
+      auto readResult2 = reader->ReadSgfContent("(;SZ[9])");
+
+      THEN( "Both read operations read the SGF content" )
+      {
+        REQUIRE( documentReader->NumberOfReadOperations == 2 );
+        REQUIRE( readResult1 != readResult2 );
+        REQUIRE( reader->GetStatistics().NumberOfReadResults == 2 );
+      }
+    }
+
+    WHEN( "The same SGF content is read with different arguments" )
+    {
+      auto readResult1 = reader->ReadSgfContent("(;)");
+      reader->GetArguments()->AddArgument(SgfcArgumentType::DisableWarningMessages);
+      auto readResult2 = reader->ReadSgfContent("(;)");
+
+      THEN( "Both read operations read the SGF content" )
+      {
+        REQUIRE( documentReader->NumberOfReadOperations == 2 );
+        REQUIRE( readResult1 != readResult2 );
+      }
+    }
+
+    WHEN( "The same SGF content is read with different read options" )
+    {
+      auto readResult1 = reader->ReadSgfContent("(;)");
+      SgfcDocumentReadOptions readOptions;
+      readOptions.IsMainVariationOnly = true;
+      reader->SetReadOptions(readOptions);
+      auto readResult2 = reader->ReadSgfContent("(;)");
+
+      THEN( "Both read operations read the SGF content" )
+      {
+        REQUIRE( documentReader->NumberOfReadOperations == 2 );
+        REQUIRE( documentReader->GetReadOptions().IsMainVariationOnly == true );
+        REQUIRE( readResult1 != readResult2 );
+      }
+    }
+
+    WHEN( "The read operation results in a fatal error" )
+    {
+      documentReader->FatalErrorSgfContent = "foobar";
+      reader->ReadSgfContent("foobar");
+      reader->ReadSgfContent("foobar");
+
+      THEN( "The read result is not cached" )
+      {
+        REQUIRE( documentReader->NumberOfReadOperations == 2 );
+        REQUIRE( reader->GetStatistics().NumberOfReadResults == 0 );
+      }
+    }
+  }
+
+  GIVEN( "SGF content is read from the filesystem" )
+  {
+    std::string sgfFilePath = SgfcUtility::GetUniqueTempFilePath();
+    SgfcUtility::AppendTextToFile(sgfFilePath, "(;)");
+
+    WHEN( "The same file is read twice using the file metadata key" )
+    {
+      reader->SetCacheKeyType(SgfcDocumentCacheKeyType::FileMetadata);
+      auto readResult1 = reader->ReadSgfFile(sgfFilePath);
+      auto readResult2 = reader->ReadSgfFile(sgfFilePath);
+
+      THEN( "The second read operation returns the cached read result" )
+      {
+        REQUIRE( documentReader->NumberOfReadOperations == 1 );
+        REQUIRE( readResult1 == readResult2 );
+      }
+    }
+
+    WHEN( "The same file is read twice using the file content key" )
+    {
+      reader->SetCacheKeyType(SgfcDocumentCacheKeyType::FileContent);
+      auto readResult1 = reader->ReadSgfFile(sgfFilePath);
+      auto readResult2 = reader->ReadSgfFile(sgfFilePath);
+      auto readResult3 = reader->ReadSgfContent("(;)");
+
+      THEN( "The second and third read operations return the cached read result" )
+      {
+        REQUIRE( documentReader->NumberOfReadOperations == 1 );
+        REQUIRE( readResult1 == readResult2 );
+        REQUIRE( readResult1 == readResult3 );
+      }
+    }
+
+    SgfcUtility::DeleteFileIfExists(sgfFilePath);
+  }
+}
+
+SCENARIO( "SgfcMemoryCachingDocumentReader limits its memory usage", "[frontend]" )
+{
+  auto documentReader = std::shared_ptr<RecordingDocumentReader>(new RecordingDocumentReader());
+  auto reader = SgfcPlusPlusFactory::CreateMemoryCachingDocumentReader(documentReader);
+
+  reader->ReadSgfContent("(;)");
+  std::uint64_t memoryUsageOfOneReadResult = reader->GetStatistics().MemoryUsage;
+  reader->ClearCache();
+
+  GIVEN( "The maximum memory usage allows for two read results" )
+  {
+    reader->SetMaximumMemoryUsage(memoryUsageOfOneReadResult * 2);
+
+    WHEN( "Three different read results are added to the cache" )
+    {
+      reader->ReadSgfContent("(;A)");
+      reader->ReadSgfContent("(;B)");
+      reader->ReadSgfContent("(;A)");
+      reader->ReadSgfContent("(;C)");
+
+      THEN( "The least recently used read result is evicted" )
+      {
+        auto statistics = reader->GetStatistics();
+        REQUIRE( statistics.NumberOfEvictions == 1 );
+        REQUIRE( statistics.NumberOfReadResults == 2 );
+        REQUIRE( statistics.MemoryUsage <= memoryUsageOfOneReadResult * 2 );
+
+        int numberOfReadOperations = documentReader->NumberOfReadOperations;
+        reader->ReadSgfContent("(;A)");
+        reader->ReadSgfContent("(;C)");
+        REQUIRE( documentReader->NumberOfReadOperations == numberOfReadOperations );
+        reader->ReadSgfContent("(;B)");
+        REQUIRE( documentReader->NumberOfReadOperations == numberOfReadOperations + 1 );
+      }
+    }
+
+    WHEN( "The maximum memory usage is lowered" )
+    {
+      reader->ReadSgfContent("(;A)");
+      reader->ReadSgfContent("(;B)");
+      reader->SetMaximumMemoryUsage(0);
+
+      THEN( "All read results are evicted" )
+      {
+        auto statistics = reader->GetStatistics();
+        REQUIRE( statistics.NumberOfEvictions == 2 );
+        REQUIRE( statistics.NumberOfReadResults == 0 );
+        REQUIRE( statistics.MemoryUsage == 0 );
+      }
+    }
+  }
+
+  GIVEN( "The maximum memory usage is smaller than a single read result" )
+  {
+    reader->SetMaximumMemoryUsage(memoryUsageOfOneReadResult - 1);
+
+    WHEN( "SGF content is read" )
+    {
+      reader->ReadSgfContent("(;A)");
+
+      THEN( "The read result is not cached" )
+      {
+        auto statistics = reader->GetStatistics();
+        REQUIRE( statistics.NumberOfReadResults == 0 );
+        REQUIRE( statistics.NumberOfEvictions == 0 );
+      }
+    }
+  }
+
+  GIVEN( "The cache contains read results" )
+  {
+    reader->ReadSgfContent("(;A)");
+    reader->ReadSgfContent("(;A)");
+
+    WHEN( "The statistics are reset and the cache is cleared" )
+    {
+      reader->ResetStatistics();
+      reader->ClearCache();
+
+      THEN( "All counters are 0" )
+      {
+        auto statistics = reader->GetStatistics();
+        REQUIRE( statistics.NumberOfHits == 0 );
+        REQUIRE( statistics.NumberOfMisses == 0 );
+        REQUIRE( statistics.NumberOfReadResults == 0 );
+        REQUIRE( statistics.MemoryUsage == 0 );
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcMemoryCachingDocumentReader coalesces concurrent read operations", "[frontend]" )
+{
+  auto documentReader = std::shared_ptr<RecordingDocumentReader>(new RecordingDocumentReader());
+  auto reader = SgfcPlusPlusFactory::CreateMemoryCachingDocumentReader(documentReader);
+
+  GIVEN( "Several threads read the same SGF content at the same time" )
+  {
+    documentReader->ReadDuration = std::chrono::milliseconds(200);
+    const int numberOfThreads = 4;
+
+    WHEN( "The read operations are performed" )
+    {
+      std::vector<std::shared_ptr<ISgfcDocumentReadResult>> readResults(numberOfThreads);
+      std::vector<std::thread> threads;
+      for (int indexOfThread = 0; indexOfThread < numberOfThreads; indexOfThread++)
+      {
+        threads.push_back(std::thread([&, indexOfThread]()
+        {
+          readResults[indexOfThread] = reader->ReadSgfContent("(;)");
+        }));
+      }
+      for (auto& thread : threads)
+        thread.join();
+
+      THEN( "The SGF content is read only once and all threads get the same read result" )
+      {
+        REQUIRE( documentReader->NumberOfReadOperations == 1 );
+        for (const auto& readResult : readResults)
+          REQUIRE( readResult == readResults.front() );
+
+        auto statistics = reader->GetStatistics();
+        REQUIRE( statistics.NumberOfMisses == 1 );
+        REQUIRE( statistics.NumberOfHits + statistics.NumberOfCoalescedReads == numberOfThreads - 1 );
+      }
+    }
+  }
+}
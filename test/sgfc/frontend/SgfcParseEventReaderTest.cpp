@@ -0,0 +1,314 @@
+// -----------------------------------------------------------------------------
+// Copyright 2024 Patrick Näf (herzbube@herzbube.ch)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// -----------------------------------------------------------------------------
+
+// Library includes
+#include <ISgfcArguments.h>
+#include <ISgfcDocumentReadResult.h>
+#include <ISgfcParseEventHandler.h>
+#include <ISgfcParseEventReader.h>
+#include <ISgfcSinglePropertyValue.h>
+#include <SgfcPlusPlusFactory.h>
+#include <SgfcUtility.h>
+
+// Unit test library includes
+#include <catch2/catch_test_macros.hpp>
+
+// C++ Standard Library includes
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace LibSgfcPlusPlus;
+
+
+/// @brief The RecordingParseEventHandler class records the events it
+/// receives in a compact string, e.g. "G(N[GM:1]...)". The property types
+/// reported by the Property() events are recorded separately.
+class RecordingParseEventHandler : public ISgfcParseEventHandler
+{
+public:
+  void BeginGame(SgfcGameType gameType, SgfcBoardSize boardSize) override;
+  void EndGame() override;
+  void BeginVariation() override;
+  void EndVariation() override;
+  void BeginNode() override;
+  void EndNode() override;
+  void Property(
+    SgfcPropertyType propertyType,
+    const std::string& propertyName,
+    const std::vector<std::shared_ptr<ISgfcPropertyValue>>& propertyValues) override;
+
+  std::stringstream Events;
+  std::vector<SgfcPropertyType> PropertyTypes;
+  SgfcGameType GameType = SgfcGameType::Unknown;
+  SgfcBoardSize BoardSize;
+};
+
+/// @brief The ThrowingParseEventHandler class throws an exception when it
+/// receives the first node.
+class ThrowingParseEventHandler : public ISgfcParseEventHandler
+{
+public:
+  void BeginNode() override;
+};
+
+
+SCENARIO( "SgfcParseEventReader is constructed", "[frontend]" )
+{
+  GIVEN( "The factory is used" )
+  {
+    WHEN( "SgfcParseEventReader is constructed" )
+    {
+      auto reader = SgfcPlusPlusFactory::CreateParseEventReader();
+
+      THEN( "SgfcParseEventReader has the expected default state" )
+      {
+        auto arguments = reader->GetArguments();
+        REQUIRE( arguments != nullptr );
+        REQUIRE( arguments->HasArguments() == false );
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcParseEventReader reports SGF content as events", "[frontend]" )
+{
+  auto reader = SgfcPlusPlusFactory::CreateParseEventReader();
+  auto eventHandler = std::shared_ptr<RecordingParseEventHandler>(new RecordingParseEventHandler());
+
+  GIVEN( "The SGF content contains a single game without variations" )
+  {
+    std::string sgfContent = "(;GM[1]SZ[9]CA[ISO-8859-1];B[aa];W[bb])";
+
+    WHEN( "SgfcParseEventReader performs the read operation" )
+    {
+      auto readResult = reader->ReadSgfContent(sgfContent, eventHandler);
+
+      THEN( "The events describe the game and the CA property value is UTF-8" )
+      {
+        REQUIRE( readResult->GetExitCode() == SgfcExitCode::Ok );
+        REQUIRE( readResult->GetDocument()->IsEmpty() == true );
+        REQUIRE( eventHandler->Events.str() == "G(N[GM:1][SZ:9][CA:UTF-8])(N[B:aa])(N[W:bb])g" );
+        std::vector<SgfcPropertyType> expectedPropertyTypes =
+        {
+          SgfcPropertyType::GM,
+          SgfcPropertyType::SZ,
+          SgfcPropertyType::CA,
+          SgfcPropertyType::B,
+          SgfcPropertyType::W,
+        };
+        REQUIRE( eventHandler->PropertyTypes == expectedPropertyTypes );
+        REQUIRE( eventHandler->GameType == SgfcGameType::Go );
+        REQUIRE( eventHandler->BoardSize.Columns == 9 );
+        REQUIRE( eventHandler->BoardSize.Rows == 9 );
+      }
+    }
+  }
+
+  GIVEN( "The SGF content contains a game with variations" )
+  {
+    std::string sgfContent = "(;GM[1](;B[aa];W[bb](;B[cc])(;B[dd]))(;B[ee]))";
+
+    WHEN( "SgfcParseEventReader performs the read operation" )
+    {
+      auto readResult = reader->ReadSgfContent(sgfContent, eventHandler);
+
+      THEN( "Each variation is enclosed by variation events" )
+      {
+        REQUIRE( readResult->GetExitCode() == SgfcExitCode::Ok );
+        REQUIRE( eventHandler->Events.str() ==
+          "G(N[GM:1][CA:UTF-8])"
+          "V(N[B:aa])(N[W:bb])V(N[B:cc])vV(N[B:dd])vv"
+          "V(N[B:ee])v"
+          "g" );
+      }
+    }
+  }
+
+  GIVEN( "The SGF content contains multiple games" )
+  {
+    std::string sgfContent = "(;GM[1]B[aa])(;GM[1]W[bb])";
+
+    WHEN( "SgfcParseEventReader performs the read operation" )
+    {
+      reader->ReadSgfContent(sgfContent, eventHandler);
+
+      THEN( "Each game is enclosed by game events" )
+      {
+        REQUIRE( eventHandler->Events.str() == "G(N[GM:1][B:aa][CA:UTF-8])gG(N[GM:1][W:bb][CA:UTF-8])g" );
+      }
+    }
+  }
+
+  GIVEN( "The SGF content contains a private property" )
+  {
+    std::string sgfContent = "(;GM[1]XY[foo];B[aa])";
+
+    WHEN( "SgfcParseEventReader performs the read operation" )
+    {
+      reader->ReadSgfContent(sgfContent, eventHandler);
+
+      THEN( "The private property is reported with property type Unknown" )
+      {
+        REQUIRE( eventHandler->Events.str() == "G(N[GM:1][XY:foo][CA:UTF-8])(N[B:aa])g" );
+        std::vector<SgfcPropertyType> expectedPropertyTypes =
+        {
+          SgfcPropertyType::GM,
+          SgfcPropertyType::Unknown,
+          SgfcPropertyType::CA,
+          SgfcPropertyType::B,
+        };
+        REQUIRE( eventHandler->PropertyTypes == expectedPropertyTypes );
+      }
+    }
+  }
+
+  GIVEN( "The SGF content is read with encoding mode 3" )
+  {
+    reader->GetArguments()->AddArgument(SgfcArgumentType::EncodingMode, 3);
+    std::string sgfContent = "(;GM[1]B[aa])";
+
+    WHEN( "SgfcParseEventReader performs the read operation" )
+    {
+      reader->ReadSgfContent(sgfContent, eventHandler);
+
+      THEN( "No CA property is reported" )
+      {
+        REQUIRE( eventHandler->Events.str() == "G(N[GM:1][B:aa])g" );
+      }
+    }
+  }
+
+  GIVEN( "The SGF content is read from the filesystem" )
+  {
+    std::string sgfFilePath = SgfcUtility::GetUniqueTempFilePath();
+    SgfcUtility::AppendTextToFile(sgfFilePath, "(;GM[1]B[aa])");
+
+    WHEN( "SgfcParseEventReader performs the read operation" )
+    {
+      auto readResult = reader->ReadSgfFile(sgfFilePath, eventHandler);
+
+      THEN( "The events describe the game" )
+      {
+        REQUIRE( readResult->GetExitCode() == SgfcExitCode::Ok );
+        REQUIRE( eventHandler->Events.str() == "G(N[GM:1][B:aa][CA:UTF-8])g" );
+      }
+    }
+
+    SgfcUtility::DeleteFileIfExists(sgfFilePath);
+  }
+
+  GIVEN( "The SGF content is not valid" )
+  {
+    std::string sgfContent = "foobar";
+
+    WHEN( "SgfcParseEventReader performs the read operation" )
+    {
+      auto readResult = reader->ReadSgfContent(sgfContent, eventHandler);
+
+      THEN( "The read operation fails and no events are reported" )
+      {
+        REQUIRE( readResult->GetExitCode() == SgfcExitCode::FatalError );
+        REQUIRE( eventHandler->Events.str() == "" );
+      }
+    }
+  }
+}
+
+SCENARIO( "SgfcParseEventReader is invoked with invalid event handlers", "[frontend]" )
+{
+  auto reader = SgfcPlusPlusFactory::CreateParseEventReader();
+
+  GIVEN( "The event handler is nullptr" )
+  {
+    WHEN( "SgfcParseEventReader performs the read operation" )
+    {
+      THEN( "The read operation throws an exception" )
+      {
+        REQUIRE_THROWS_AS(
+          reader->ReadSgfContent("(;)", nullptr),
+          std::invalid_argument);
+      }
+    }
+  }
+
+  GIVEN( "The event handler throws an exception" )
+  {
+    auto eventHandler = std::shared_ptr<ThrowingParseEventHandler>(new ThrowingParseEventHandler());
+
+    WHEN( "SgfcParseEventReader performs the read operation" )
+    {
+      THEN( "The exception is passed through" )
+      {
+        REQUIRE_THROWS_AS(
+          reader->ReadSgfContent("(;)", eventHandler),
+          std::logic_error);
+      }
+    }
+  }
+}
+
+void RecordingParseEventHandler::BeginGame(SgfcGameType gameType, SgfcBoardSize boardSize)
+{
+  this->GameType = gameType;
+  this->BoardSize = boardSize;
+  this->Events << "G";
+}
+
+void RecordingParseEventHandler::EndGame()
+{
+  this->Events << "g";
+}
+
+void RecordingParseEventHandler::BeginVariation()
+{
+  this->Events << "V";
+}
+
+void RecordingParseEventHandler::EndVariation()
+{
+  this->Events << "v";
+}
+
+void RecordingParseEventHandler::BeginNode()
+{
+  this->Events << "(N";
+}
+
+void RecordingParseEventHandler::EndNode()
+{
+  this->Events << ")";
+}
+
+void RecordingParseEventHandler::Property(
+  SgfcPropertyType propertyType,
+  const std::string& propertyName,
+  const std::vector<std::shared_ptr<ISgfcPropertyValue>>& propertyValues)
+{
+  this->PropertyTypes.push_back(propertyType);
+  this->Events << "[" << propertyName;
+  for (const auto& propertyValue : propertyValues)
+  {
+    if (! propertyValue->IsComposedValue())
+      this->Events << ":" << propertyValue->ToSingleValue()->GetRawValue();
+  }
+  this->Events << "]";
+}
+
+void ThrowingParseEventHandler::BeginNode()
+{
+  throw std::logic_error("ThrowingParseEventHandler");
+}